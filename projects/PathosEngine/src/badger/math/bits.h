@@ -1,5 +1,9 @@
 #pragma once
 
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
 namespace badger {
 
 	// Count leading zeros
@@ -32,4 +36,25 @@ namespace badger {
 		return n - (x & 1);
 	}
 
+	// Index of the lowest set bit. x must not be zero.
+	inline int32 bitScanForward64(uint64 x) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, x);
+		return (int32)index;
+#else
+		return __builtin_ctzll(x);
+#endif
+	}
+	// Index of the highest set bit, i.e., floor(log2(x)). x must not be zero.
+	inline int32 bitScanReverse64(uint64 x) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, x);
+		return (int32)index;
+#else
+		return 63 - __builtin_clzll(x);
+#endif
+	}
+
 }
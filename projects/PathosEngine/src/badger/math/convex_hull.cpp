@@ -1,9 +1,16 @@
 #include "convex_hull.h"
 #include "aabb.h"
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
 
-namespace badger {
+#include <algorithm>
+#include <unordered_map>
+#include <limits>
+
+// Points per job when assigning conflict lists.
+#define CONVEX_HULL_PARALLEL_BATCH_SIZE 1024
 
-	// #todo-physics: It seems lots of util functions here are O(NN) when they can be O(N).
+namespace badger {
 
 	static vector3 safeNormalize(const vector3& v) {
 		if (v == vector3(0.0f)) return v;
@@ -36,7 +43,7 @@ namespace badger {
 	}
 
 	// a, b : two points on the line.
-	static vector3 findFurthestPointFromLine(const std::vector<vector3>& points, const vector3& a, const vector3& b) {
+	static size_t findFurthestPointFromLine(const std::vector<vector3>& points, const vector3& a, const vector3& b) {
 		size_t ix = 0;
 		float maxDist = distanceFromLine(a, b, points[0]);
 		for (size_t i = 1u; i < points.size(); ++i) {
@@ -46,7 +53,7 @@ namespace badger {
 				ix = i;
 			}
 		}
-		return points[ix];
+		return ix;
 	}
 
 	// a, b, c : vertices of the triangle.
@@ -60,221 +67,414 @@ namespace badger {
 		return dist;
 	}
 
-	static vector3 findFurthestPointFromTriangle(const std::vector<vector3>& points, const vector3& a, const vector3& b, const vector3& c) {
+	// Furthest from the plane of the triangle, on either side.
+	static size_t findFurthestPointFromTriangle(const std::vector<vector3>& points, const vector3& a, const vector3& b, const vector3& c) {
 		size_t ix = 0;
-		float maxDist = distanceFromTriangle(a, b, c, points[0]);
+		float maxDist = std::abs(distanceFromTriangle(a, b, c, points[0]));
 		for (size_t i = 1u; i < points.size(); ++i) {
-			float dist = distanceFromTriangle(a, b, c, points[i]);
+			float dist = std::abs(distanceFromTriangle(a, b, c, points[i]));
 			if (dist > maxDist) {
 				maxDist = dist;
 				ix = i;
 			}
 		}
-		return points[ix];
+		return ix;
 	}
 
-	static void buildTetrahedron(
-		const std::vector<vector3>& vertices,
-		std::vector<vector3>& outHullPoints,
-		std::vector<ConvexHullTriangle>& outHullTriangles)
-	{
+	class ConvexHullBuilder {
+
+	public:
+		ConvexHullBuilder(const std::vector<vector3>& inVertices, JobSystem* inJobSystem)
+			: vertices(inVertices)
+			, jobSystem(inJobSystem)
+		{}
+
+		bool build(std::vector<vector3>& outHullPoints, std::vector<ConvexHullTriangle>& outHullTriangles);
+
+	private:
+		static constexpr uint32 INVALID_INDEX = 0xffffffff;
+
+		struct Face {
+			uint32  v[3];
+			uint32  neighbors[3]; // Face across edge (v[i], v[(i + 1) % 3])
+			// Planes are in double precision. With float, near-coplanar points decided within
+			// the tolerance accumulate into visibly concave hulls when there are thousands of points.
+			glm::dvec3 normal;
+			double  offset;       // dot(normal, x) == offset on the plane
+			bool    bAlive;
+			std::vector<uint32> conflicts; // Vertices in front of this face
+
+			inline double distance(const vector3& pt) const { return glm::dot(normal, glm::dvec3(pt)) - offset; }
+		};
+
+		struct HorizonEdge {
+			uint32 a, b;        // Edge of a visible face
+			uint32 outsideFace; // Face across the edge, not visible
+			uint32 outsideEdge; // Edge index in outsideFace
+		};
+
+		uint32 addFace(uint32 a, uint32 b, uint32 c);
+		uint32 findNeighborEdge(uint32 face, uint32 neighbor) const;
+		void buildInitialTetrahedron(uint32 i0, uint32 i1, uint32 i2, uint32 i3);
+		void assignConflicts(const std::vector<uint32>& candidates, const uint32* faceIndices, uint32 numFaces);
+		void findHorizon(uint32 eyeFace, const vector3& eyePoint);
+		void addVertex(uint32 eyeFace, uint32 eyeVertex);
+
+		const std::vector<vector3>& vertices;
+		JobSystem* jobSystem;
+		double epsilon = 0.0;
+
+		std::vector<Face> faces;
+		std::vector<uint32> faceVisitStamps;
+		uint32 visitStamp = 0;
+		std::vector<double> vertexDistances; // Distance to the face whose conflict list has the vertex
+
+		// Temporary storage for addVertex()
+		std::vector<uint32> visibleFaces;
+		std::vector<HorizonEdge> horizon;
+		std::vector<uint32> orphans;
+		std::vector<uint32> newFaces;
+		std::vector<uint32> assignedFaces;
+		std::unordered_map<uint32, uint32> firstVertexToFace;
+	};
+
+	bool ConvexHullBuilder::build(std::vector<vector3>& outHullPoints, std::vector<ConvexHullTriangle>& outHullTriangles) {
 		outHullPoints.clear();
 		outHullTriangles.clear();
 
-		vector3 points[4];
-
-		size_t ix = findFurthestPointInDir(vertices, vector3(1.0f, 0.0f, 0.0f));
-		points[0] = vertices[ix];
-		ix = findFurthestPointInDir(vertices, -points[0]);
-		points[1] = vertices[ix];
-		points[2] = findFurthestPointFromLine(vertices, points[0], points[1]);
-		points[3] = findFurthestPointFromTriangle(vertices, points[0], points[1], points[2]);
-
-		// Ensure ordering is CCW.
-		float dist = distanceFromTriangle(points[0], points[1], points[2], points[3]);
-		if (dist > 0.0f) {
-			std::swap(points[0], points[1]);
+		// Tolerance for coplanar points, relative to the magnitude of coordinates.
+		vector3 maxAbs(0.0f);
+		for (const vector3& v : vertices) {
+			maxAbs = (glm::max)(maxAbs, glm::abs(v));
 		}
+		epsilon = 3.0 * ((double)maxAbs.x + maxAbs.y + maxAbs.z) * std::numeric_limits<double>::epsilon();
+
+		const uint32 i0 = (uint32)findFurthestPointInDir(vertices, vector3(1.0f, 0.0f, 0.0f));
+		const uint32 i1 = (uint32)findFurthestPointInDir(vertices, -vertices[i0]);
+		const uint32 i2 = (uint32)findFurthestPointFromLine(vertices, vertices[i0], vertices[i1]);
+		const uint32 i3 = (uint32)findFurthestPointFromTriangle(vertices, vertices[i0], vertices[i1], vertices[i2]);
+
+		// All points are on a plane or a line. The initial tetrahedron would be flat.
+		// Same precision as face planes, or float error makes a flat input look like a thin volume.
+		const glm::dvec3 p0(vertices[i0]), p1(vertices[i1]), p2(vertices[i2]), p3(vertices[i3]);
+		const glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+		const double normalLength = glm::length(normal);
+		if (normalLength == 0.0 || std::abs(glm::dot(normal, p3 - p0)) <= epsilon * normalLength) {
+			return false;
+		}
+		buildInitialTetrahedron(i0, i1, i2, i3);
+
+		vertexDistances.resize(vertices.size(), 0.0);
+		std::vector<uint32> candidates;
+		candidates.reserve(vertices.size());
+		for (uint32 i = 0; i < (uint32)vertices.size(); ++i) {
+			if (i != i0 && i != i1 && i != i2 && i != i3) {
+				candidates.push_back(i);
+			}
+		}
+		const uint32 initialFaces[4] = { 0, 1, 2, 3 };
+		assignConflicts(candidates, initialFaces, 4);
 
-		outHullPoints.emplace_back(points[0]);
-		outHullPoints.emplace_back(points[1]);
-		outHullPoints.emplace_back(points[2]);
-		outHullPoints.emplace_back(points[3]);
-		outHullTriangles.emplace_back(ConvexHullTriangle{ 0, 1, 2 });
-		outHullTriangles.emplace_back(ConvexHullTriangle{ 0, 2, 3 });
-		outHullTriangles.emplace_back(ConvexHullTriangle{ 2, 1, 3 });
-		outHullTriangles.emplace_back(ConvexHullTriangle{ 1, 0, 3 });
-	}
-
-	static void removeInternalPoints(
-		const std::vector<vector3>& hullPoints,
-		const std::vector<ConvexHullTriangle>& hullTriangles,
-		std::vector<vector3>& outCheckPoints)
-	{
-		for (size_t i = 0u; i < outCheckPoints.size(); ++i) {
-			const vector3& pt = outCheckPoints[i];
-
-			bool isExternal = false;
-			for (size_t t = 0u; t < hullTriangles.size(); ++t) {
-				const ConvexHullTriangle& tri = hullTriangles[t];
-				const vector3& a = hullPoints[tri.a];
-				const vector3& b = hullPoints[tri.b];
-				const vector3& c = hullPoints[tri.c];
-
-				// If the point is in front of any triangle then it's external.
-				if (distanceFromTriangle(a, b, c, pt) > 0.0f) {
-					isExternal = true;
-					break;
-				}
+		// New faces are appended, so this visits them too.
+		for (uint32 faceIx = 0; faceIx < (uint32)faces.size(); ++faceIx) {
+			if (!faces[faceIx].bAlive || faces[faceIx].conflicts.size() == 0) {
+				continue;
 			}
-			// If it's not external, then it's inside the polyhderon and should be removed.
-			if (!isExternal) {
-				outCheckPoints.erase(outCheckPoints.begin() + i);
-				--i;
+			uint32 eyeVertex = faces[faceIx].conflicts[0];
+			for (uint32 vertex : faces[faceIx].conflicts) {
+				if (vertexDistances[vertex] > vertexDistances[eyeVertex]) {
+					eyeVertex = vertex;
+				}
 			}
+			addVertex(faceIx, eyeVertex);
 		}
-		// Also remove any points that are a little too close to the hull points.
-		for (size_t i = 0u; i < outCheckPoints.size(); ++i) {
-			const vector3& pt = outCheckPoints[i];
-
-			bool tooClose = false;
-			for (size_t j = 0u; j < hullPoints.size(); ++j) {
-				vector3 ray = hullPoints[j] - pt;
-				if (glm::dot(ray, ray) < 0.01f * 0.01f) {
-					tooClose = true;
-					break;
+
+		// Collect alive faces and compact vertices.
+		std::vector<uint32> remap(vertices.size(), INVALID_INDEX);
+		for (const Face& face : faces) {
+			if (!face.bAlive) continue;
+			size_t tri[3];
+			for (uint32 i = 0; i < 3; ++i) {
+				if (remap[face.v[i]] == INVALID_INDEX) {
+					remap[face.v[i]] = (uint32)outHullPoints.size();
+					outHullPoints.push_back(vertices[face.v[i]]);
 				}
+				tri[i] = remap[face.v[i]];
 			}
-			if (tooClose) {
-				outCheckPoints.erase(outCheckPoints.begin() + i);
-				--i;
-			}
+			outHullTriangles.emplace_back(ConvexHullTriangle{ tri[0], tri[1], tri[2] });
 		}
+		return true;
 	}
 
-	// Compare the incoming edge with all the edges in the facing tris, then return true if it's unique.
-	static bool isEdgeUnique(const std::vector<ConvexHullTriangle>& triangles,
-		const std::vector<size_t>& facingTriangles, size_t ignoreTriangle, const Edge& edge)
-	{
-		for (size_t triIx : facingTriangles) {
-			if (ignoreTriangle == triIx) continue;
+	uint32 ConvexHullBuilder::addFace(uint32 a, uint32 b, uint32 c) {
+		const uint32 faceIx = (uint32)faces.size();
+		faces.emplace_back();
+		faceVisitStamps.push_back(0);
+
+		Face& face = faces.back();
+		face.v[0] = a;
+		face.v[1] = b;
+		face.v[2] = c;
+		face.neighbors[0] = face.neighbors[1] = face.neighbors[2] = INVALID_INDEX;
+		const glm::dvec3 va(vertices[a]), vb(vertices[b]), vc(vertices[c]);
+		const glm::dvec3 normal = glm::cross(vb - va, vc - va);
+		const double normalLength = glm::length(normal);
+		face.normal = (normalLength > 0.0) ? (normal / normalLength) : glm::dvec3(0.0);
+		face.offset = glm::dot(face.normal, va);
+		face.bAlive = true;
+		return faceIx;
+	}
 
-			const ConvexHullTriangle& tri = triangles[triIx];
-			Edge edges[3] = { { tri.a, tri.b }, { tri.b, tri.c }, { tri.c, tri.a } };
-			for (size_t e = 0; e < 3; ++e) {
-				if (edge == edges[e]) return false;
+	uint32 ConvexHullBuilder::findNeighborEdge(uint32 face, uint32 neighbor) const {
+		for (uint32 i = 0; i < 3; ++i) {
+			if (faces[face].neighbors[i] == neighbor) {
+				return i;
 			}
 		}
-		return true;
+		CHECK_NO_ENTRY();
+		return INVALID_INDEX;
 	}
 
-	static void addPoint(const vector3& pt,
-		std::vector<vector3>& inoutHullPoints,
-		std::vector<ConvexHullTriangle>& inoutHullTriangles)
-	{
-		CHECK(inoutHullTriangles.size() > 1);
-
-		// Find all triangles that face this point.
-		std::vector<size_t> facingTriangles;
-		for (int32 i = (int32)(inoutHullTriangles.size() - 1); i >= 0; --i) {
-			const ConvexHullTriangle& tri = inoutHullTriangles[i];
-			const vector3& a = inoutHullPoints[tri.a];
-			const vector3& b = inoutHullPoints[tri.b];
-			const vector3& c = inoutHullPoints[tri.c];
-			if (distanceFromTriangle(a, b, c, pt) > 0.0f) {
-				facingTriangles.push_back(i);
-			}
+	void ConvexHullBuilder::buildInitialTetrahedron(uint32 i0, uint32 i1, uint32 i2, uint32 i3) {
+		// Ensure ordering is CCW.
+		float dist = distanceFromTriangle(vertices[i0], vertices[i1], vertices[i2], vertices[i3]);
+		if (dist > 0.0f) {
+			std::swap(i0, i1);
 		}
 
-		// Find all edges that are unique to the triangles.
-		std::vector<Edge> uniqueEdges;
-		for (size_t triIx : facingTriangles) {
-			const ConvexHullTriangle& tri = inoutHullTriangles[triIx];
-			Edge edges[3] = { { tri.a, tri.b }, { tri.b, tri.c }, { tri.c, tri.a } };
-			for (size_t e = 0; e < 3; ++e) {
-				if (isEdgeUnique(inoutHullTriangles, facingTriangles, triIx, edges[e])) {
-					uniqueEdges.push_back(edges[e]);
+		addFace(i0, i1, i2);
+		addFace(i0, i2, i3);
+		addFace(i2, i1, i3);
+		addFace(i1, i0, i3);
+
+		// Link each edge to the face that has the same edge in reverse.
+		for (uint32 f = 0; f < 4; ++f) {
+			for (uint32 e = 0; e < 3; ++e) {
+				const uint32 a = faces[f].v[e];
+				const uint32 b = faces[f].v[(e + 1) % 3];
+				for (uint32 g = 0; g < 4; ++g) {
+					for (uint32 k = 0; k < 3; ++k) {
+						if (g != f && faces[g].v[k] == b && faces[g].v[(k + 1) % 3] == a) {
+							faces[f].neighbors[e] = g;
+						}
+					}
 				}
 			}
 		}
+	}
+
+	void ConvexHullBuilder::assignConflicts(const std::vector<uint32>& candidates, const uint32* faceIndices, uint32 numFaces) {
+		const uint32 numCandidates = (uint32)candidates.size();
+		assignedFaces.resize(numCandidates);
+
+		// Each candidate goes to the face it's furthest in front of. Points inside the hull are dropped.
+		JobSystem* parallelJobSystem = (numCandidates > CONVEX_HULL_PARALLEL_BATCH_SIZE) ? jobSystem : nullptr;
+		parallelFor(parallelJobSystem, numCandidates, CONVEX_HULL_PARALLEL_BATCH_SIZE,
+			[this, &candidates, faceIndices, numFaces](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					const vector3& pt = vertices[candidates[i]];
+					uint32 bestFace = INVALID_INDEX;
+					double bestDistance = epsilon;
+					for (uint32 f = 0; f < numFaces; ++f) {
+						const double dist = faces[faceIndices[f]].distance(pt);
+						if (dist > bestDistance) {
+							bestDistance = dist;
+							bestFace = faceIndices[f];
+						}
+					}
+					assignedFaces[i] = bestFace;
+					vertexDistances[candidates[i]] = bestDistance;
+				}
+			}
+		);
 
-		// Remove old facing triangles.
-		for (size_t triIx : facingTriangles) {
-			inoutHullTriangles.erase(inoutHullTriangles.begin() + triIx);
+		for (uint32 i = 0; i < numCandidates; ++i) {
+			if (assignedFaces[i] != INVALID_INDEX) {
+				faces[assignedFaces[i]].conflicts.push_back(candidates[i]);
+			}
 		}
+	}
 
-		// Add the new point.
-		inoutHullPoints.push_back(pt);
-		size_t newIx = inoutHullPoints.size() - 1;
+	// Depth-first search from the eye face over faces that see the eye point.
+	// Visiting edges in order yields the horizon as a closed loop.
+	void ConvexHullBuilder::findHorizon(uint32 eyeFace, const vector3& eyePoint) {
+		struct StackItem { uint32 face; uint32 firstEdge; uint32 numVisited; };
+		std::vector<StackItem> stack;
+
+		++visitStamp;
+		visibleFaces.clear();
+		horizon.clear();
+
+		faceVisitStamps[eyeFace] = visitStamp;
+		visibleFaces.push_back(eyeFace);
+		stack.push_back(StackItem{ eyeFace, 0, 0 });
+
+		while (stack.size() > 0) {
+			StackItem& item = stack.back();
+			if (item.numVisited == 3) {
+				stack.pop_back();
+				continue;
+			}
+			const uint32 face = item.face;
+			const uint32 edge = (item.firstEdge + item.numVisited) % 3;
+			++item.numVisited;
 
-		// Add triangles for each unique edge.
-		for (const Edge& e : uniqueEdges) {
-			ConvexHullTriangle tri{ e.a, e.b, newIx };
-			inoutHullTriangles.emplace_back(tri);
+			const uint32 neighbor = faces[face].neighbors[edge];
+			if (faceVisitStamps[neighbor] == visitStamp) {
+				continue;
+			}
+			if (faces[neighbor].distance(eyePoint) > epsilon) {
+				faceVisitStamps[neighbor] = visitStamp;
+				visibleFaces.push_back(neighbor);
+				// Continue from the edge after the one we came through.
+				const uint32 sharedEdge = findNeighborEdge(neighbor, face);
+				stack.push_back(StackItem{ neighbor, (sharedEdge + 1) % 3, 0 });
+			} else {
+				HorizonEdge horizonEdge;
+				horizonEdge.a = faces[face].v[edge];
+				horizonEdge.b = faces[face].v[(edge + 1) % 3];
+				horizonEdge.outsideFace = neighbor;
+				horizonEdge.outsideEdge = findNeighborEdge(neighbor, face);
+				horizon.push_back(horizonEdge);
+			}
 		}
 	}
 
-	static void removeUnreferencedVertices(
-		std::vector<vector3>& inoutHullPoints,
-		std::vector<ConvexHullTriangle>& inoutHullTriangles)
-	{
-		for (size_t i = 0u; i < inoutHullPoints.size(); ++i) {
-			bool isUsed = false;
-			for (size_t j = 0u; j < inoutHullTriangles.size(); ++j) {
-				const ConvexHullTriangle& tri = inoutHullTriangles[j];
-				if (tri.a == i || tri.b == i || tri.c == i) {
-					isUsed = true;
-					break;
+	void ConvexHullBuilder::addVertex(uint32 eyeFace, uint32 eyeVertex) {
+		findHorizon(eyeFace, vertices[eyeVertex]);
+
+		// Remove visible faces. Their points will be assigned to new faces or dropped.
+		orphans.clear();
+		for (uint32 face : visibleFaces) {
+			for (uint32 vertex : faces[face].conflicts) {
+				if (vertex != eyeVertex) {
+					orphans.push_back(vertex);
 				}
 			}
-			if (isUsed) continue;
+			faces[face].conflicts.clear();
+			faces[face].conflicts.shrink_to_fit();
+			faces[face].bAlive = false;
+		}
 
-			for (size_t j = 0u; j < inoutHullTriangles.size(); ++j) {
-				ConvexHullTriangle& tri = inoutHullTriangles[j];
-				if (tri.a > i) --tri.a;
-				if (tri.b > i) --tri.b;
-				if (tri.c > i) --tri.c;
-			}
-			inoutHullPoints.erase(inoutHullPoints.begin() + i);
-			--i;
+		// Connect each horizon edge to the eye vertex.
+		newFaces.clear();
+		firstVertexToFace.clear();
+		for (const HorizonEdge& edge : horizon) {
+			const uint32 newFace = addFace(edge.a, edge.b, eyeVertex);
+			faces[newFace].neighbors[0] = edge.outsideFace;
+			faces[edge.outsideFace].neighbors[edge.outsideEdge] = newFace;
+			newFaces.push_back(newFace);
+			firstVertexToFace[edge.a] = newFace;
+		}
+		// Edge (b, eye) of a new face is shared with edge (eye, a) of the next new face.
+		for (uint32 newFace : newFaces) {
+			auto it = firstVertexToFace.find(faces[newFace].v[1]);
+			CHECKF(it != firstVertexToFace.end(), "Horizon is not a closed loop");
+			faces[newFace].neighbors[1] = it->second;
+			faces[it->second].neighbors[2] = newFace;
 		}
+
+		assignConflicts(orphans, newFaces.data(), (uint32)newFaces.size());
 	}
 
-	static void expandConvexHull(
+	bool buildConvexHull(
 		const std::vector<vector3>& vertices,
-		std::vector<vector3>& inoutHullPoints,
-		std::vector<ConvexHullTriangle>& inoutHullTriangles)
+		std::vector<vector3>& outHullPoints,
+		std::vector<ConvexHullTriangle>& outHullTriangles,
+		JobSystem* jobSystem)
 	{
-		auto externalVertices = vertices;
-		removeInternalPoints(inoutHullPoints, inoutHullTriangles, externalVertices);
+		if (vertices.size() < 4) {
+			outHullPoints.clear();
+			outHullTriangles.clear();
+			return false;
+		}
 
-		while (externalVertices.size() > 0) {
-			size_t ix = findFurthestPointInDir(externalVertices, externalVertices[0]);
-			vector3 pt = externalVertices[ix];
+		ConvexHullBuilder builder(vertices, jobSystem);
+		return builder.build(outHullPoints, outHullTriangles);
+	}
+
+}
+
+namespace badger {
 
-			externalVertices.erase(externalVertices.begin() + ix);
+	vector3 calculateCenterOfMass(
+		const std::vector<vector3>& points,
+		const std::vector<ConvexHullTriangle>& triangles)
+	{
+		// Any point works as the apex of the tetrahedra, but one inside the hull keeps them small.
+		vector3 apex(0.0f);
+		for (const vector3& pt : points) {
+			apex += pt;
+		}
+		if (points.size() > 0) {
+			apex /= (float)points.size();
+		}
 
-			addPoint(pt, inoutHullPoints, inoutHullTriangles);
-			removeInternalPoints(inoutHullPoints, inoutHullTriangles, externalVertices);
+		float totalVolume = 0.0f;
+		vector3 cm(0.0f);
+		for (const ConvexHullTriangle& tri : triangles) {
+			const vector3 a = points[tri.a] - apex;
+			const vector3 b = points[tri.b] - apex;
+			const vector3 c = points[tri.c] - apex;
+
+			// Centroid of tetrahedron (apex, a, b, c) weighted by its signed volume.
+			const float volume = glm::dot(a, glm::cross(b, c)) / 6.0f;
+			cm += volume * 0.25f * (a + b + c);
+			totalVolume += volume;
 		}
-		removeUnreferencedVertices(inoutHullPoints, inoutHullTriangles);
+		// No volume (e.g., flat points without triangles). Average of the points.
+		if (!(totalVolume > 0.0f)) {
+			return apex;
+		}
+		cm /= totalVolume;
+		return cm + apex;
 	}
 
-	void buildConvexHull(
-		const std::vector<vector3>& vertices,
-		std::vector<vector3>& outHullPoints,
-		std::vector<ConvexHullTriangle>& outHullTriangles)
+	matrix3 calculateInertiaTensor(
+		const std::vector<vector3>& points,
+		const std::vector<ConvexHullTriangle>& triangles,
+		const vector3& centerOfMass)
 	{
-		if (vertices.size() < 4) return;
+		// Covariance (integral of x * x^T) of the canonical tetrahedron (0, e1, e2, e3).
+		const matrix3 canonicalCovariance = (1.0f / 120.0f) * matrix3(
+			2.0f, 1.0f, 1.0f,
+			1.0f, 2.0f, 1.0f,
+			1.0f, 1.0f, 2.0f);
+
+		// Tetrahedron (centerOfMass, a, b, c) is the canonical one transformed by A = [a b c],
+		// so its covariance is det(A) * A * C' * A^T.
+		float totalVolume = 0.0f;
+		matrix3 covariance(0.0f);
+		for (const ConvexHullTriangle& tri : triangles) {
+			const matrix3 A(
+				points[tri.a] - centerOfMass,
+				points[tri.b] - centerOfMass,
+				points[tri.c] - centerOfMass);
+			const float detA = glm::determinant(A);
+			covariance += detA * (A * canonicalCovariance * glm::transpose(A));
+			totalVolume += detA / 6.0f;
+		}
+
+		// No volume (e.g., flat points without triangles). Treat the points as equal point masses.
+		if (!(totalVolume > 0.0f)) {
+			covariance = matrix3(0.0f);
+			for (const vector3& pt : points) {
+				const vector3 r = pt - centerOfMass;
+				covariance += glm::outerProduct(r, r);
+			}
+			totalVolume = (float)std::max((size_t)1, points.size());
+		}
 
-		buildTetrahedron(vertices, outHullPoints, outHullTriangles);
-		expandConvexHull(vertices, outHullPoints, outHullTriangles);
+		const float trace = covariance[0][0] + covariance[1][1] + covariance[2][2];
+		matrix3 tensor = trace * matrix3(1.0f) - covariance;
+		tensor *= 1.0f / totalVolume;
+		return tensor;
 	}
 
 }
 
 namespace badger {
-	
+
 	static bool isExternal(
 		const std::vector<vector3>& points,
 		const std::vector<ConvexHullTriangle>& triangles,
@@ -306,7 +506,7 @@ namespace badger {
 		return aabb;
 	}
 
-	vector3 calculateCenterOfMass(
+	vector3 calculateCenterOfMassSampled(
 		const std::vector<vector3>& points,
 		const std::vector<ConvexHullTriangle>& triangles)
 	{
@@ -337,7 +537,7 @@ namespace badger {
 		return cm;
 	}
 
-	matrix3 calculateInertiaTensor(
+	matrix3 calculateInertiaTensorSampled(
 		const std::vector<vector3>& points,
 		const std::vector<ConvexHullTriangle>& triangles,
 		const vector3& centerOfMass)
@@ -359,7 +559,7 @@ namespace badger {
 					if (isExternal(points, triangles, pt)) {
 						continue;
 					}
-					
+
 					pt -= centerOfMass;
 
 					tensor[0] += vector3(pt.y * pt.y + pt.z * pt.z, -pt.x * pt.y, -pt.x * pt.z);
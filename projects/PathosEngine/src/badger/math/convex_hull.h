@@ -2,6 +2,8 @@
 
 #include <vector>
 
+class JobSystem;
+
 namespace badger {
 
 	struct ConvexHullTriangle { size_t a, b, c; };
@@ -13,18 +15,38 @@ namespace badger {
 		}
 	};
 
-	void buildConvexHull(
+	// Incremental convex hull (quickhull). Each remaining point belongs to the conflict list of a triangle
+	// it's in front of, so a new hull vertex only tests points of the triangles it removes.
+	// Triangles are CCW when seen from outside.
+	// jobSystem is optional. Conflict lists are assigned in parallel if there are many points.
+	// Returns false and empty outputs if the points don't span a volume (less than 4 points, or all on a plane).
+	bool buildConvexHull(
 		const std::vector<vector3>& vertices,
 		std::vector<vector3>& outHullPoints,
-		std::vector<ConvexHullTriangle>& outHullTriangles);
+		std::vector<ConvexHullTriangle>& outHullTriangles,
+		JobSystem* jobSystem = nullptr);
 
+	// Closed form by decomposing the hull into tetrahedra.
+	// If the triangles enclose no volume, the points are treated as equal point masses.
 	vector3 calculateCenterOfMass(
 		const std::vector<vector3>& points,
 		const std::vector<ConvexHullTriangle>& triangles);
 
+	// Inertia tensor per unit mass, by decomposing the hull into tetrahedra.
 	matrix3 calculateInertiaTensor(
 		const std::vector<vector3>& points,
 		const std::vector<ConvexHullTriangle>& triangles,
 		const vector3& centerOfMass);
 
+	// Reference implementations that sample a 100x100x100 grid in the bounds of the hull.
+	// Very slow. Only for validation.
+	vector3 calculateCenterOfMassSampled(
+		const std::vector<vector3>& points,
+		const std::vector<ConvexHullTriangle>& triangles);
+
+	matrix3 calculateInertiaTensorSampled(
+		const std::vector<vector3>& points,
+		const std::vector<ConvexHullTriangle>& triangles,
+		const vector3& centerOfMass);
+
 }
@@ -0,0 +1,317 @@
+#include "frustum_culling.h"
+#include "badger/assertion/assertion.h"
+
+#include <emmintrin.h> // SSE2 is always available on x64.
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstring>
+
+namespace badger {
+
+	void AABBStream::resize(uint32 newCount) {
+		count = newCount;
+		for (std::vector<float>& component : components) {
+			component.resize(getPaddedSize(), 0.0f);
+		}
+	}
+
+	void AABBStream::set(uint32 index, const AABB& box) {
+		const vector3 center = box.getCenter();
+		const vector3 halfSize = box.getHalfSize();
+		components[(uint32)EAABBComponent::CenterX][index] = center.x;
+		components[(uint32)EAABBComponent::CenterY][index] = center.y;
+		components[(uint32)EAABBComponent::CenterZ][index] = center.z;
+		components[(uint32)EAABBComponent::HalfX][index] = halfSize.x;
+		components[(uint32)EAABBComponent::HalfY][index] = halfSize.y;
+		components[(uint32)EAABBComponent::HalfZ][index] = halfSize.z;
+	}
+
+	AABB AABBStream::get(uint32 index) const {
+		const vector3 center(
+			components[(uint32)EAABBComponent::CenterX][index],
+			components[(uint32)EAABBComponent::CenterY][index],
+			components[(uint32)EAABBComponent::CenterZ][index]);
+		const vector3 halfSize(
+			components[(uint32)EAABBComponent::HalfX][index],
+			components[(uint32)EAABBComponent::HalfY][index],
+			components[(uint32)EAABBComponent::HalfZ][index]);
+		return AABB::fromCenterAndHalfSize(center, halfSize);
+	}
+
+	AABBStreamView AABBStream::getView() const {
+		AABBStreamView view;
+		for (uint32 i = 0; i < (uint32)EAABBComponent::Count; ++i) {
+			view.components[i] = components[i].data();
+		}
+		view.count = count;
+		return view;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// BoundingVolumeHierarchy
+
+	// Node bounds are slightly inflated so that rounding errors never make a node smaller than its boxes.
+	static constexpr float BVH_NODE_INFLATION = 1.0f + 1e-5f;
+	static constexpr uint32 INVALID_NODE = 0xffffffff;
+
+	void BoundingVolumeHierarchy::build(const std::vector<AABB>& boxes, uint32 maxLeafSize, std::vector<uint32>& outOrder) {
+		const uint32 numBoxes = (uint32)boxes.size();
+		outOrder.resize(numBoxes);
+		std::iota(outOrder.begin(), outOrder.end(), 0);
+
+		nodes.clear();
+		parents.clear();
+		boxToLeaf.resize(numBoxes);
+		bNeedsRefit = false;
+		if (numBoxes == 0) {
+			dirtyNodes.clear();
+			return;
+		}
+		maxLeafSize = std::max(1u, maxLeafSize);
+		nodes.reserve(2 * (numBoxes / maxLeafSize) + 1);
+		parents.reserve(nodes.capacity());
+		buildRecursive(boxes, outOrder, 0, numBoxes, maxLeafSize, INVALID_NODE);
+		dirtyNodes.assign(nodes.size(), 0);
+	}
+
+	void BoundingVolumeHierarchy::markBoxMoved(uint32 boxIndex) {
+		uint32 node = boxToLeaf[boxIndex];
+		while (node != INVALID_NODE && dirtyNodes[node] == 0) {
+			dirtyNodes[node] = 1;
+			node = parents[node];
+		}
+		bNeedsRefit = true;
+	}
+
+	uint32 BoundingVolumeHierarchy::buildRecursive(const std::vector<AABB>& boxes, std::vector<uint32>& order, uint32 first, uint32 count, uint32 maxLeafSize, uint32 parent) {
+		const uint32 nodeIndex = (uint32)nodes.size();
+		nodes.emplace_back();
+		parents.push_back(parent);
+
+		AABB bounds = boxes[order[first]];
+		AABB centroidBounds = AABB::fromMinMax(bounds.getCenter(), bounds.getCenter());
+		for (uint32 i = first + 1; i < first + count; ++i) {
+			const AABB& box = boxes[order[i]];
+			bounds = bounds + box;
+			centroidBounds.expand(box.getCenter());
+		}
+
+		BVHNode& node = nodes[nodeIndex];
+		node.center = bounds.getCenter();
+		node.halfSize = bounds.getHalfSize() * BVH_NODE_INFLATION;
+		node.firstBox = first;
+		node.numBoxes = count;
+		node.rightChild = 0;
+		if (count <= maxLeafSize) {
+			for (uint32 i = first; i < first + count; ++i) {
+				boxToLeaf[i] = nodeIndex;
+			}
+			return nodeIndex;
+		}
+
+		// Median split along the longest axis of centroids.
+		const vector3 extent = centroidBounds.getSize();
+		const int32 axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+		const uint32 numLeft = count / 2;
+		std::nth_element(order.begin() + first, order.begin() + first + numLeft, order.begin() + first + count,
+			[&boxes, axis](uint32 a, uint32 b) {
+				return boxes[a].getCenter()[axis] < boxes[b].getCenter()[axis];
+			}
+		);
+
+		buildRecursive(boxes, order, first, numLeft, maxLeafSize, nodeIndex);
+		const uint32 rightChild = buildRecursive(boxes, order, first + numLeft, count - numLeft, maxLeafSize, nodeIndex);
+		nodes[nodeIndex].rightChild = rightChild;
+		return nodeIndex;
+	}
+
+	void BoundingVolumeHierarchy::refit(const AABBStream& stream) {
+		if (!bNeedsRefit) {
+			return;
+		}
+		const float* cx = stream.getComponent(EAABBComponent::CenterX);
+		const float* cy = stream.getComponent(EAABBComponent::CenterY);
+		const float* cz = stream.getComponent(EAABBComponent::CenterZ);
+		const float* hx = stream.getComponent(EAABBComponent::HalfX);
+		const float* hy = stream.getComponent(EAABBComponent::HalfY);
+		const float* hz = stream.getComponent(EAABBComponent::HalfZ);
+
+		// Children always come after their parent.
+		for (int64 i = (int64)nodes.size() - 1; i >= 0; --i) {
+			if (dirtyNodes[i] == 0) {
+				continue;
+			}
+			dirtyNodes[i] = 0;
+
+			BVHNode& node = nodes[i];
+			vector3 minB, maxB;
+			if (node.rightChild == 0) {
+				minB = vector3(std::numeric_limits<float>::max());
+				maxB = vector3(std::numeric_limits<float>::lowest());
+				for (uint32 k = node.firstBox; k < node.firstBox + node.numBoxes; ++k) {
+					const vector3 center(cx[k], cy[k], cz[k]);
+					const vector3 halfSize(hx[k], hy[k], hz[k]);
+					minB = (glm::min)(minB, center - halfSize);
+					maxB = (glm::max)(maxB, center + halfSize);
+				}
+			} else {
+				const BVHNode& left = nodes[i + 1];
+				const BVHNode& right = nodes[node.rightChild];
+				minB = (glm::min)(left.center - left.halfSize, right.center - right.halfSize);
+				maxB = (glm::max)(left.center + left.halfSize, right.center + right.halfSize);
+			}
+			node.center = 0.5f * (minB + maxB);
+			node.halfSize = 0.5f * (maxB - minB) * BVH_NODE_INFLATION;
+		}
+		bNeedsRefit = false;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SIMD tests
+
+	namespace {
+
+		struct PlaneSIMD {
+			__m128 nx, ny, nz, d;
+			__m128 ax, ay, az; // abs(normal)
+		};
+
+		void loadPlanes(const Frustum3D& frustum, uint32 numPlanes, PlaneSIMD* outPlanes) {
+			for (uint32 i = 0; i < numPlanes; ++i) {
+				const Plane3D& plane = frustum.planes[i];
+				outPlanes[i].nx = _mm_set1_ps(plane.normal.x);
+				outPlanes[i].ny = _mm_set1_ps(plane.normal.y);
+				outPlanes[i].nz = _mm_set1_ps(plane.normal.z);
+				outPlanes[i].d  = _mm_set1_ps(plane.distance);
+				outPlanes[i].ax = _mm_set1_ps(std::abs(plane.normal.x));
+				outPlanes[i].ay = _mm_set1_ps(std::abs(plane.normal.y));
+				outPlanes[i].az = _mm_set1_ps(std::abs(plane.normal.z));
+			}
+		}
+
+		// Returns a 4-bit mask of boxes [index, index + 4) that are not outside of any active plane.
+		// Same math as hitTest::AABB_plane() so that results match the scalar version.
+		inline uint32 testFourBoxes(const AABBStreamView& boxes, uint32 index, const PlaneSIMD* planes, const uint8* activePlanes, uint32 numActivePlanes) {
+			const __m128 cx = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::CenterX] + index);
+			const __m128 cy = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::CenterY] + index);
+			const __m128 cz = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::CenterZ] + index);
+			const __m128 hx = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::HalfX] + index);
+			const __m128 hy = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::HalfY] + index);
+			const __m128 hz = _mm_loadu_ps(boxes.components[(uint32)EAABBComponent::HalfZ] + index);
+			const __m128 zero = _mm_setzero_ps();
+
+			__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (uint32 i = 0; i < numActivePlanes; ++i) {
+				const PlaneSIMD& P = planes[activePlanes[i]];
+				__m128 s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, P.nx), _mm_mul_ps(cy, P.ny)), _mm_mul_ps(cz, P.nz));
+				s = _mm_sub_ps(s, P.d);
+				__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(hx, P.ax), _mm_mul_ps(hy, P.ay)), _mm_mul_ps(hz, P.az));
+				visible = _mm_and_ps(visible, _mm_cmple_ps(_mm_sub_ps(zero, r), s));
+			}
+			return (uint32)_mm_movemask_ps(visible);
+		}
+
+		uint32 testRange(
+			const AABBStreamView& boxes, uint32 first, uint32 count,
+			const PlaneSIMD* planes, const uint8* activePlanes, uint32 numActivePlanes,
+			uint8* outVisible)
+		{
+			uint32 numVisible = 0;
+			for (uint32 i = 0; i < count; i += AABBStream::SIMD_WIDTH) {
+				const uint32 mask = testFourBoxes(boxes, first + i, planes, activePlanes, numActivePlanes);
+				const uint32 n = std::min(AABBStream::SIMD_WIDTH, count - i);
+				for (uint32 j = 0; j < n; ++j) {
+					const uint8 bVisible = (uint8)((mask >> j) & 1);
+					outVisible[i + j] = bVisible;
+					numVisible += bVisible;
+				}
+			}
+			return numVisible;
+		}
+
+	}
+
+	namespace hitTest {
+
+		uint32 AABBStream_frustum(
+			const AABBStreamView& boxes, uint32 first, uint32 count,
+			const Frustum3D& frustum, uint32 numPlanes,
+			uint8* outVisible)
+		{
+			CHECK(numPlanes <= 6 && first + count <= boxes.count);
+			PlaneSIMD planes[6];
+			const uint8 activePlanes[6] = { 0, 1, 2, 3, 4, 5 };
+			loadPlanes(frustum, numPlanes, planes);
+			return testRange(boxes, first, count, planes, activePlanes, numPlanes, outVisible);
+		}
+
+		uint32 BVH_frustum(
+			const BVHNode* nodes, uint32 numNodes, const AABBStreamView& boxes,
+			const Frustum3D& frustum, uint32 numPlanes,
+			uint8* outVisible)
+		{
+			CHECK(numPlanes <= 6);
+			if (numNodes == 0) {
+				return 0;
+			}
+			PlaneSIMD planes[6];
+			loadPlanes(frustum, numPlanes, planes);
+
+			// planeMask: Planes that the parent node intersects. If a node is entirely
+			// on the positive side of a plane, so are its children.
+			struct StackItem { uint32 node; uint32 planeMask; };
+			constexpr int32 MAX_STACK = 64;
+			StackItem stack[MAX_STACK];
+			int32 stackSize = 0;
+			stack[stackSize++] = StackItem{ 0, (1u << numPlanes) - 1 };
+
+			uint32 numVisible = 0;
+			while (stackSize > 0) {
+				const StackItem item = stack[--stackSize];
+				const BVHNode& node = nodes[item.node];
+
+				bool bOutside = false;
+				uint32 planeMask = item.planeMask;
+				for (uint32 i = 0; i < numPlanes; ++i) {
+					if ((planeMask & (1u << i)) == 0) {
+						continue;
+					}
+					const Plane3D& plane = frustum.planes[i];
+					const float r = glm::dot(node.halfSize, glm::abs(plane.normal));
+					const float s = plane.getSignedDistance(node.center);
+					if (s < -r) {
+						bOutside = true;
+						break;
+					}
+					if (s >= r) {
+						planeMask &= ~(1u << i);
+					}
+				}
+
+				if (bOutside) {
+					memset(outVisible + node.firstBox, 0, node.numBoxes);
+				} else if (planeMask == 0) {
+					memset(outVisible + node.firstBox, 1, node.numBoxes);
+					numVisible += node.numBoxes;
+				} else if (node.rightChild == 0) {
+					uint8 activePlanes[6];
+					uint32 numActivePlanes = 0;
+					for (uint32 i = 0; i < numPlanes; ++i) {
+						if (planeMask & (1u << i)) {
+							activePlanes[numActivePlanes++] = (uint8)i;
+						}
+					}
+					numVisible += testRange(boxes, node.firstBox, node.numBoxes, planes, activePlanes, numActivePlanes, outVisible + node.firstBox);
+				} else {
+					CHECK(stackSize + 2 <= MAX_STACK);
+					stack[stackSize++] = StackItem{ node.rightChild, planeMask };
+					stack[stackSize++] = StackItem{ item.node + 1, planeMask };
+				}
+			}
+			return numVisible;
+		}
+
+	}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "aabb.h"
+#include "plane.h"
+#include "badger/types/int_types.h"
+#include <vector>
+
+// Frustum culling of many AABBs at once.
+// Boxes are stored in structure-of-arrays layout (center and half size)
+// so that SSE tests 4 boxes against a plane per instruction.
+
+namespace badger {
+
+	enum class EAABBComponent : uint32 {
+		CenterX = 0, CenterY, CenterZ,
+		HalfX, HalfY, HalfZ,
+		Count
+	};
+
+	// Non-owning view of boxes in structure-of-arrays layout.
+	// Each array has at least (count + AABBStream::SIMD_WIDTH) elements so that any 4 consecutive boxes can be loaded.
+	struct AABBStreamView {
+		const float* components[(uint32)EAABBComponent::Count] = { nullptr, };
+		uint32 count = 0;
+	};
+
+	class AABBStream {
+	public:
+		static constexpr uint32 SIMD_WIDTH = 4;
+
+		void resize(uint32 newCount);
+		void set(uint32 index, const AABB& box);
+		AABB get(uint32 index) const;
+
+		inline uint32 size() const { return count; }
+		// Number of floats in each component array.
+		inline uint32 getPaddedSize() const { return count + SIMD_WIDTH; }
+		inline const float* getComponent(EAABBComponent c) const { return components[(uint32)c].data(); }
+
+		AABBStreamView getView() const;
+
+	private:
+		std::vector<float> components[(uint32)EAABBComponent::Count];
+		uint32 count = 0;
+	};
+
+	// Nodes are in depth-first order, so the left child of an internal node is always the next node.
+	struct BVHNode {
+		vector3 center;
+		vector3 halfSize;
+		uint32  firstBox;   // Boxes of this subtree are [firstBox, firstBox + numBoxes) in the stream.
+		uint32  numBoxes;
+		uint32  rightChild; // 0 if leaf.
+	};
+
+	// Static bounding volume hierarchy over an AABBStream.
+	// Boxes are reordered so that every node covers a contiguous range of the stream.
+	// Moving boxes only need refit(); rebuild when boxes are added or removed.
+	class BoundingVolumeHierarchy {
+	public:
+		// outOrder[i] = index in 'boxes' of the i-th box in BVH order.
+		// The caller should fill the stream in that order.
+		void build(const std::vector<AABB>& boxes, uint32 maxLeafSize, std::vector<uint32>& outOrder);
+
+		// boxIndex is in BVH order. Nodes above the box are refit by the next refit().
+		void markBoxMoved(uint32 boxIndex);
+
+		// Recalculate bounds of marked nodes from the stream. Tree structure is kept.
+		void refit(const AABBStream& stream);
+
+		inline const std::vector<BVHNode>& getNodes() const { return nodes; }
+		inline uint32 getNumNodes() const { return (uint32)nodes.size(); }
+
+	private:
+		uint32 buildRecursive(const std::vector<AABB>& boxes, std::vector<uint32>& order, uint32 first, uint32 count, uint32 maxLeafSize, uint32 parent);
+
+		std::vector<BVHNode> nodes;
+		std::vector<uint32>  parents;   // Parent of each node. 0xffffffff for the root.
+		std::vector<uint32>  boxToLeaf; // Leaf node of each box
+		std::vector<uint8>   dirtyNodes;
+		bool                 bNeedsRefit = false;
+	};
+
+	namespace hitTest {
+
+		// Test boxes [first, first + count) against the first numPlanes planes of the frustum.
+		// outVisible[i] = 1 if (first + i)-th box is inside or intersects the frustum, 0 otherwise.
+		// Returns the number of visible boxes.
+		uint32 AABBStream_frustum(
+			const AABBStreamView& boxes, uint32 first, uint32 count,
+			const Frustum3D& frustum, uint32 numPlanes,
+			uint8* outVisible);
+
+		// Same as above for the whole stream, but subtrees entirely outside or inside
+		// of the frustum are resolved without testing their boxes.
+		uint32 BVH_frustum(
+			const BVHNode* nodes, uint32 numNodes, const AABBStreamView& boxes,
+			const Frustum3D& frustum, uint32 numPlanes,
+			uint8* outVisible);
+
+	}
+
+}
@@ -0,0 +1,248 @@
+#include "height_field.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace badger {
+
+	// Parametric interval where the ray is inside the box. Returns false if it's empty.
+	static bool intersectRayBox(
+		const vector3& origin, const vector3& invDirection,
+		const vector3& boxMin, const vector3& boxMax,
+		float& inOutT0, float& inOutT1)
+	{
+		for (int32 axis = 0; axis < 3; ++axis) {
+			float tNear = (boxMin[axis] - origin[axis]) * invDirection[axis];
+			float tFar = (boxMax[axis] - origin[axis]) * invDirection[axis];
+			if (std::isnan(tNear) || std::isnan(tFar)) {
+				// Parallel to the slab and on its boundary (0 * inf).
+				continue;
+			}
+			if (tNear > tFar) std::swap(tNear, tFar);
+			inOutT0 = std::max(inOutT0, tNear);
+			inOutT1 = std::min(inOutT1, tFar);
+			if (inOutT0 > inOutT1) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void HeightField::initialize(uint32 inWidth, uint32 inHeight, const float* inValues) {
+		CHECKF(inWidth >= 2 && inHeight >= 2, "HeightField needs at least 2x2 samples");
+		width = inWidth;
+		height = inHeight;
+		values.assign(inValues, inValues + width * height);
+
+		levels.clear();
+		{
+			Level level0{ width - 1, height - 1 };
+			level0.ranges.resize(level0.sizeX * level0.sizeY);
+			for (uint32 y = 0; y < level0.sizeY; ++y) {
+				for (uint32 x = 0; x < level0.sizeX; ++x) {
+					const float h00 = getValue(x, y), h10 = getValue(x + 1, y);
+					const float h01 = getValue(x, y + 1), h11 = getValue(x + 1, y + 1);
+					// The bilinear patch never leaves the range of its corners.
+					level0.ranges[y * level0.sizeX + x] = vector2(
+						std::min(std::min(h00, h10), std::min(h01, h11)),
+						std::max(std::max(h00, h10), std::max(h01, h11)));
+				}
+			}
+			levels.emplace_back(std::move(level0));
+		}
+		while (levels.back().sizeX > 1 || levels.back().sizeY > 1) {
+			const Level& below = levels.back();
+			Level level{ (below.sizeX + 1) / 2, (below.sizeY + 1) / 2 };
+			level.ranges.resize(level.sizeX * level.sizeY);
+			for (uint32 y = 0; y < level.sizeY; ++y) {
+				for (uint32 x = 0; x < level.sizeX; ++x) {
+					vector2 range(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+					for (uint32 i = 0; i < 4; ++i) {
+						const uint32 cx = 2 * x + (i & 1), cy = 2 * y + (i >> 1);
+						if (cx < below.sizeX && cy < below.sizeY) {
+							const vector2& child = below.ranges[cy * below.sizeX + cx];
+							range.x = std::min(range.x, child.x);
+							range.y = std::max(range.y, child.y);
+						}
+					}
+					level.ranges[y * level.sizeX + x] = range;
+				}
+			}
+			levels.emplace_back(std::move(level));
+		}
+	}
+
+	float HeightField::sample(float x, float y) const {
+		if (!isValid()) {
+			return 0.0f;
+		}
+		x = std::max(0.0f, std::min(x, (float)(width - 1)));
+		y = std::max(0.0f, std::min(y, (float)(height - 1)));
+		const uint32 x0 = std::min((uint32)x, width - 2);
+		const uint32 y0 = std::min((uint32)y, height - 2);
+		const float fx = x - (float)x0, fy = y - (float)y0;
+
+		const float h0 = getValue(x0, y0) + fx * (getValue(x0 + 1, y0) - getValue(x0, y0));
+		const float h1 = getValue(x0, y0 + 1) + fx * (getValue(x0 + 1, y0 + 1) - getValue(x0, y0 + 1));
+		return h0 + fy * (h1 - h0);
+	}
+
+	vector2 HeightField::getHeightRange(int32 x0, int32 y0, int32 x1, int32 y1) const {
+		x0 = std::max(x0, 0); y0 = std::max(y0, 0);
+		x1 = std::min(x1, (int32)width - 1); y1 = std::min(y1, (int32)height - 1);
+		vector2 range(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+		for (int32 y = y0; y <= y1; ++y) {
+			for (int32 x = x0; x <= x1; ++x) {
+				const float h = getValue(x, y);
+				range.x = std::min(range.x, h);
+				range.y = std::max(range.y, h);
+			}
+		}
+		return range;
+	}
+
+	bool HeightField::raycastCell(uint32 cellX, uint32 cellY, const vector3& origin, const vector3& direction, float tMin, float tMax, float& outT) const {
+		const vector3 invDirection = 1.0f / direction;
+		float t0 = tMin, t1 = tMax;
+		const vector3 cellMin((float)cellX, (float)cellY, -std::numeric_limits<float>::max());
+		const vector3 cellMax((float)(cellX + 1), (float)(cellY + 1), std::numeric_limits<float>::max());
+		if (!intersectRayBox(origin, invDirection, cellMin, cellMax, t0, t1)) {
+			return false;
+		}
+
+		// h(u, v) = a + b*u + c*v + d*u*v in cell local coordinates.
+		const float h00 = getValue(cellX, cellY), h10 = getValue(cellX + 1, cellY);
+		const float h01 = getValue(cellX, cellY + 1), h11 = getValue(cellX + 1, cellY + 1);
+		const float a = h00, b = h10 - h00, c = h01 - h00, d = h00 - h10 - h01 + h11;
+		const float ou = origin.x - (float)cellX, ov = origin.y - (float)cellY;
+
+		// f(t) = rayZ(t) - h(u(t), v(t)) = A*t^2 + B*t + C. The ray is above the surface where f > 0.
+		const float A = -d * direction.x * direction.y;
+		const float B = direction.z - (b * direction.x + c * direction.y + d * (ou * direction.y + ov * direction.x));
+		const float C = origin.z - (a + b * ou + c * ov + d * ou * ov);
+		auto f = [A, B, C](float t) { return (A * t + B) * t + C; };
+
+		if (f(t0) <= 0.0f) {
+			outT = t0;
+			return true;
+		}
+		if (f(t1) > 0.0f && A == 0.0f) {
+			// Linear and positive at both ends.
+			return false;
+		}
+
+		// Smallest root in [t0, t1].
+		float roots[2];
+		int32 numRoots = 0;
+		if (std::abs(A) <= 1e-12f * (std::abs(B) + std::abs(C))) {
+			if (B != 0.0f) {
+				roots[numRoots++] = -C / B;
+			}
+		} else {
+			const float discriminant = B * B - 4.0f * A * C;
+			if (discriminant < 0.0f) {
+				return false;
+			}
+			// Numerically stable form.
+			const float q = -0.5f * (B + std::copysign(std::sqrt(discriminant), B));
+			roots[numRoots++] = q / A;
+			if (q != 0.0f) {
+				roots[numRoots++] = C / q;
+			}
+		}
+		float hitT = std::numeric_limits<float>::max();
+		for (int32 i = 0; i < numRoots; ++i) {
+			if (roots[i] >= t0 && roots[i] <= t1) {
+				hitT = std::min(hitT, roots[i]);
+			}
+		}
+		if (hitT == std::numeric_limits<float>::max()) {
+			// Rounding can push a root just out of the interval when the ray leaves below the surface.
+			if (f(t1) <= 0.0f) {
+				hitT = t1;
+			} else {
+				return false;
+			}
+		}
+		outT = hitT;
+		return true;
+	}
+
+	bool HeightField::raycast(const vector3& origin, const vector3& direction, float tMin, float tMax, HeightFieldHit& outHit) const {
+		if (!isValid() || tMin > tMax) {
+			return false;
+		}
+		const vector3 invDirection = 1.0f / direction;
+
+		struct StackItem { uint32 level, x, y; };
+		// Each level pushes at most 3 siblings below the node being visited.
+		StackItem stack[4 * 32];
+		int32 stackSize = 0;
+		stack[stackSize++] = StackItem{ (uint32)levels.size() - 1, 0, 0 };
+
+		const uint32 cellsX = width - 1, cellsY = height - 1;
+		while (stackSize > 0) {
+			const StackItem item = stack[--stackSize];
+			const vector2 range = getCellRange(item.level, item.x, item.y);
+
+			// Area of the node in grid space.
+			const uint32 x0 = item.x << item.level, y0 = item.y << item.level;
+			const uint32 x1 = std::min((item.x + 1) << item.level, cellsX);
+			const uint32 y1 = std::min((item.y + 1) << item.level, cellsY);
+			// Below the node's minimum is also a hit, so only the maximum height bounds the box.
+			float t0 = tMin, t1 = tMax;
+			const vector3 boxMin((float)x0, (float)y0, -std::numeric_limits<float>::max());
+			const vector3 boxMax((float)x1, (float)y1, range.y);
+			if (!intersectRayBox(origin, invDirection, boxMin, boxMax, t0, t1)) {
+				continue;
+			}
+
+			if (item.level == 0) {
+				float hitT;
+				if (raycastCell(item.x, item.y, origin, direction, t0, t1, hitT)) {
+					outHit.t = hitT;
+					outHit.position = origin + hitT * direction;
+					return true;
+				}
+				continue;
+			}
+
+			// Push children so that the one the ray enters first is popped first.
+			// Children don't overlap in xy, so the first hit found in this order is the nearest one.
+			const Level& below = levels[item.level - 1];
+			StackItem children[4];
+			float entries[4];
+			int32 numChildren = 0;
+			for (uint32 i = 0; i < 4; ++i) {
+				const uint32 cx = 2 * item.x + (i & 1), cy = 2 * item.y + (i >> 1);
+				if (cx >= below.sizeX || cy >= below.sizeY) {
+					continue;
+				}
+				const uint32 level = item.level - 1;
+				const float minX = (float)(cx << level), minY = (float)(cy << level);
+				const float maxX = (float)std::min((cx + 1) << level, cellsX), maxY = (float)std::min((cy + 1) << level, cellsY);
+				float e0 = -std::numeric_limits<float>::max(), e1 = std::numeric_limits<float>::max();
+				const vector3 childMin(minX, minY, -std::numeric_limits<float>::max());
+				const vector3 childMax(maxX, maxY, std::numeric_limits<float>::max());
+				if (!intersectRayBox(origin, invDirection, childMin, childMax, e0, e1) || e1 < t0 || e0 > t1) {
+					continue;
+				}
+				int32 j = numChildren++;
+				for (; j > 0 && entries[j - 1] < e0; --j) {
+					children[j] = children[j - 1];
+					entries[j] = entries[j - 1];
+				}
+				children[j] = StackItem{ level, cx, cy };
+				entries[j] = e0;
+			}
+			CHECK(stackSize + numChildren <= (int32)(sizeof(stack) / sizeof(stack[0])));
+			for (int32 i = 0; i < numChildren; ++i) {
+				stack[stackSize++] = children[i];
+			}
+		}
+		return false;
+	}
+
+}
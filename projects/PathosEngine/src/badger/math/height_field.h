@@ -0,0 +1,63 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+#include <vector>
+
+// Heightfield with a min/max pyramid for ray queries.
+// Everything is in grid space: sample (x, y) is at integer coordinates and its value is the z coordinate.
+
+namespace badger {
+
+	struct HeightFieldHit {
+		float   t;        // Ray parameter of the hit
+		vector3 position; // Grid space
+	};
+
+	// The surface is bilinear between samples and clamped outside of [0, width - 1] x [0, height - 1].
+	// A cell is the quad between 4 adjacent samples. Level 0 of the pyramid stores the height range of each cell,
+	// and each upper level stores the range of 2x2 cells of the level below, up to a single cell.
+	class HeightField {
+	public:
+		// Requires at least 2x2 samples. values has width * height elements in row-major order.
+		void initialize(uint32 inWidth, uint32 inHeight, const float* values);
+
+		float sample(float x, float y) const;
+
+		// Min and max of samples in [x0, x1] x [y0, y1] (inclusive, clamped to the grid).
+		vector2 getHeightRange(int32 x0, int32 y0, int32 x1, int32 y1) const;
+
+		// First point where the ray is on or below the surface, for t in [tMin, tMax].
+		// Only the area covered by samples is tested. Walks the pyramid front to back,
+		// so it only visits cells whose height range overlaps the ray.
+		bool raycast(const vector3& origin, const vector3& direction, float tMin, float tMax, HeightFieldHit& outHit) const;
+
+		// Exact intersection with the bilinear patch of a single cell, for t in [tMin, tMax].
+		bool raycastCell(uint32 cellX, uint32 cellY, const vector3& origin, const vector3& direction, float tMin, float tMax, float& outT) const;
+
+		inline uint32 getWidth() const { return width; }
+		inline uint32 getHeight() const { return height; }
+		inline bool isValid() const { return width >= 2 && height >= 2; }
+
+		inline uint32 getNumLevels() const { return (uint32)levels.size(); }
+		inline uint32 getLevelSizeX(uint32 level) const { return levels[level].sizeX; }
+		inline uint32 getLevelSizeY(uint32 level) const { return levels[level].sizeY; }
+		// (min, max) of the cell in the given level.
+		inline vector2 getCellRange(uint32 level, uint32 x, uint32 y) const { return levels[level].ranges[y * levels[level].sizeX + x]; }
+
+	private:
+		struct Level {
+			uint32 sizeX;
+			uint32 sizeY;
+			std::vector<vector2> ranges;
+		};
+
+		inline float getValue(uint32 x, uint32 y) const { return values[y * width + x]; }
+
+		uint32 width = 0;
+		uint32 height = 0;
+		std::vector<float> values;
+		std::vector<Level> levels;
+	};
+
+}
@@ -8,23 +8,16 @@
 
 namespace badger {
 
+	// Transform the center and project the half size onto world axes (Arvo's method).
+	// Same result as transforming all 8 corners for affine transforms.
 	inline AABB calculateWorldBounds(const AABB& localBounds, const matrix4& localToWorld) {
-		vector3 minB = localBounds.minBounds;
-		vector3 maxB = localBounds.maxBounds;
-		vector3 vs[8];
-		for (uint32 i = 0; i < 8; ++i) {
-			vs[i].x = (i & 1) ? minB.x : maxB.x;
-			vs[i].y = ((i >> 1) & 1) ? minB.y : maxB.y;
-			vs[i].z = ((i >> 2) & 1) ? minB.z : maxB.z;
-		}
-		minB = vector3(std::numeric_limits<float>::max());
-		maxB = vector3(std::numeric_limits<float>::lowest());
-		for (uint32 i = 0; i < 8; ++i) {
-			vs[i] = vector3(localToWorld * vector4(vs[i], 1.0f));
-			minB = glm::min(minB, vs[i]);
-			maxB = glm::max(maxB, vs[i]);
-		}
-		return AABB::fromMinMax(minB, maxB);
+		const vector3 localCenter = localBounds.getCenter();
+		const vector3 localHalfSize = localBounds.getHalfSize();
+		const vector3 center = vector3(localToWorld * vector4(localCenter, 1.0f));
+		const vector3 halfSize = glm::abs(vector3(localToWorld[0])) * localHalfSize.x
+			+ glm::abs(vector3(localToWorld[1])) * localHalfSize.y
+			+ glm::abs(vector3(localToWorld[2])) * localHalfSize.z;
+		return AABB::fromCenterAndHalfSize(center, halfSize);
 	}
 
 	namespace hitTest {
@@ -1,8 +1,20 @@
 #include "spline.h"
 #include "badger/assertion/assertion.h"
+#include "badger/math/minmax.h"
+
+#include <algorithm>
+#include <limits>
 
 #define HERMITE_SPLINE_SEGMENTATION     10
 #define INV_HERMITE_SPLINE_SEGMENTATION (1.0f / (float)HERMITE_SPLINE_SEGMENTATION)
+#define HERMITE_SPLINE_CHUNK_SIZE       16 // Segments per chunk of bounds
+#define HERMITE_SPLINE_NEWTON_STEPS     4
+
+static float distanceSqToAABB(const vector3& p, const AABB& box)
+{
+	vector3 d = (glm::max)(box.minBounds - p, (glm::max)(vector3(0.0f), p - box.maxBounds));
+	return glm::dot(d, d);
+}
 
 void HermiteSpline::clearPoints()
 {
@@ -24,7 +36,15 @@ void HermiteSpline::updateSpline()
 	totalDistance = 0.0f;
 
 	reparam.clear();
-	reparam.reserve((numPoints - 1) * HERMITE_SPLINE_SEGMENTATION);
+	reparamBuckets.clear();
+	segmentBounds.clear();
+	chunkBounds.clear();
+	if (numPoints < 2) {
+		invalidated = false;
+		return;
+	}
+
+	reparam.reserve((numPoints - 1) * HERMITE_SPLINE_SEGMENTATION + 1);
 
 	for (uint32 i = 0; i < numPoints - 1; ++i) {
 		for (uint32 j = 0; j < HERMITE_SPLINE_SEGMENTATION; ++j) {
@@ -37,6 +57,9 @@ void HermiteSpline::updateSpline()
 	}
 	reparam.push_back(vector4(points[points.size() - 1], totalDistance));
 
+	buildReparamBuckets();
+	buildSegmentBounds();
+
 	invalidated = false;
 }
 
@@ -52,7 +75,7 @@ float HermiteSpline::getTotalDistance() const
 	return totalDistance;
 }
 
-vector3 HermiteSpline::locationAtTime(float time)
+vector3 HermiteSpline::locationAtTime(float time) const
 {
 	if (time < 0.0f || points.size() < 2) return points[0];
 	else if (time >= getTotalTime()) return points[points.size() - 1];
@@ -60,7 +83,7 @@ vector3 HermiteSpline::locationAtTime(float time)
 	return evaluate((uint32)time, time - (uint32)time);
 }
 
-vector3 HermiteSpline::locationAtDistance(float distance)
+vector3 HermiteSpline::locationAtDistance(float distance) const
 {
 	CHECK(!invalidated);
 
@@ -69,17 +92,10 @@ vector3 HermiteSpline::locationAtDistance(float distance)
 	else if (distance >= totalDistance) return points[points.size() - 1];
 
 	int32 i = findReparamIndex(distance);
-	if (i >= 0) {
-		// Distance-time relation is not linear, but do it anyway.
-		float progress = (distance - reparam[i].w) / (reparam[i + 1].w - reparam[i].w);
-		return vector3(reparam[i]) * (1.0f - progress) + vector3(reparam[i + 1]) * progress;
-	}
-
-	CHECK_NO_ENTRY();
-	return vector3(0.0f);
+	return locationAtTime(reparamIndexToTime(i, distance));
 }
 
-vector3 HermiteSpline::tangentAtTime(float time)
+vector3 HermiteSpline::tangentAtTime(float time) const
 {
 	if (time < 0.0f || points.size() < 2) return tangents[0];
 	else if (time >= getTotalTime()) return tangents[tangents.size() - 1];
@@ -87,7 +103,7 @@ vector3 HermiteSpline::tangentAtTime(float time)
 	return derivative((uint32)time, time - (uint32)time);
 }
 
-vector3 HermiteSpline::tangentAtDistance(float distance)
+vector3 HermiteSpline::tangentAtDistance(float distance) const
 {
 	CHECK(!invalidated);
 
@@ -95,17 +111,114 @@ vector3 HermiteSpline::tangentAtDistance(float distance)
 	if (distance <= 0.0f) return tangents[0];
 	else if (distance >= totalDistance) return tangents[tangents.size() - 1];
 
-	int32 reparamIndex = findReparamIndex(distance);
-	if (reparamIndex >= 0) {
-		int32 i = int32(reparamIndex * INV_HERMITE_SPLINE_SEGMENTATION);
-		float progress = (float)(reparamIndex - i * HERMITE_SPLINE_SEGMENTATION) * INV_HERMITE_SPLINE_SEGMENTATION;
-		// #todo-spline: slerp between nearest tangents?
-		progress += INV_HERMITE_SPLINE_SEGMENTATION * (distance - reparam[reparamIndex].w) / (reparam[reparamIndex + 1].w - reparam[reparamIndex].w);
-		return derivative(i, progress);
+	// #todo-spline: slerp between nearest tangents?
+	int32 i = findReparamIndex(distance);
+	return tangentAtTime(reparamIndexToTime(i, distance));
+}
+
+float HermiteSpline::timeAtDistance(float distance) const
+{
+	CHECK(!invalidated);
+
+	if (reparam.size() == 0 || distance <= 0.0f) return 0.0f;
+	else if (distance >= totalDistance) return getTotalTime();
+
+	return reparamIndexToTime(findReparamIndex(distance), distance);
+}
+
+void HermiteSpline::locationsAtDistances(const float* distances, uint32 count, vector3* outLocations, vector3* outTangents) const
+{
+	CHECK(!invalidated);
+
+	if (reparam.size() == 0) {
+		for (uint32 k = 0; k < count; ++k) {
+			outLocations[k] = vector3(0.0f);
+			if (outTangents != nullptr) outTangents[k] = vector3(0.0f);
+		}
+		return;
+	}
+
+	const int32 lastInterval = (int32)reparam.size() - 2;
+	int32 i = 0;
+	for (uint32 k = 0; k < count; ++k) {
+		const float distance = distances[k];
+		float time;
+		if (distance <= 0.0f) {
+			time = -1.0f;
+		} else if (distance >= totalDistance) {
+			time = getTotalTime();
+		} else {
+			// Try the previous interval and the next one before searching.
+			if (distance < reparam[i].w || reparam[i + 1].w <= distance) {
+				if (i < lastInterval && reparam[i + 1].w <= distance && distance < reparam[i + 2].w) {
+					i += 1;
+				} else {
+					i = findReparamIndex(distance);
+				}
+			}
+			time = reparamIndexToTime(i, distance);
+		}
+		outLocations[k] = locationAtTime(time);
+		if (outTangents != nullptr) {
+			outTangents[k] = tangentAtTime(time);
+		}
+	}
+}
+
+float HermiteSpline::findNearestDistance(const vector3& position, vector3* outLocation) const
+{
+	CHECK(!invalidated);
+
+	if (points.size() < 2) {
+		if (outLocation != nullptr) *outLocation = (points.size() > 0) ? points[0] : vector3(0.0f);
+		return 0.0f;
+	}
+
+	const uint32 numSegments = (uint32)segmentBounds.size();
+	const uint32 numChunks = (uint32)chunkBounds.size();
+
+	float bestDistSq = std::numeric_limits<float>::max();
+	uint32 bestSegment = 0;
+	float bestTime = 0.0f;
+
+	auto searchChunk = [&](uint32 chunk) {
+		const uint32 first = chunk * HERMITE_SPLINE_CHUNK_SIZE;
+		const uint32 last = badger::min(first + HERMITE_SPLINE_CHUNK_SIZE, numSegments);
+		for (uint32 i = first; i < last; ++i) {
+			if (distanceSqToAABB(position, segmentBounds[i]) >= bestDistSq) {
+				continue;
+			}
+			float t;
+			float distSq = findNearestTimeInSegment(i, position, t);
+			if (distSq < bestDistSq) {
+				bestDistSq = distSq;
+				bestSegment = i;
+				bestTime = t;
+			}
+		}
+	};
+
+	// Start from the closest chunk to get a tight bound, then skip chunks that can't be closer.
+	uint32 closestChunk = 0;
+	float closestChunkDistSq = std::numeric_limits<float>::max();
+	for (uint32 chunk = 0; chunk < numChunks; ++chunk) {
+		float distSq = distanceSqToAABB(position, chunkBounds[chunk]);
+		if (distSq < closestChunkDistSq) {
+			closestChunkDistSq = distSq;
+			closestChunk = chunk;
+		}
+	}
+	searchChunk(closestChunk);
+	for (uint32 chunk = 0; chunk < numChunks; ++chunk) {
+		if (chunk != closestChunk && distanceSqToAABB(position, chunkBounds[chunk]) < bestDistSq) {
+			searchChunk(chunk);
+		}
 	}
 
-	CHECK_NO_ENTRY();
-	return vector3(0.0f);
+	if (outLocation != nullptr) {
+		*outLocation = evaluate(bestSegment, bestTime);
+	}
+	return reparam[bestSegment * HERMITE_SPLINE_SEGMENTATION].w + getArcLength(bestSegment, bestTime);
 }
 
 vector3 HermiteSpline::evaluate(uint32 i, float t) const
@@ -133,6 +246,17 @@ vector3 HermiteSpline::derivative(uint32 i, float t) const
 		+ (3.0f * tt - 2.0f * t) * m1;
 }
 
+vector3 HermiteSpline::secondDerivative(uint32 i, float t) const
+{
+	vector3 p0 = points[i], p1 = points[i + 1];
+	vector3 m0 = tangents[i], m1 = tangents[i + 1];
+
+	return (12.0f * t - 6.0f) * p0
+		+ (6.0f * t - 4.0f) * m0
+		+ (-12.0f * t + 6.0f) * p1
+		+ (6.0f * t - 2.0f) * m1;
+}
+
 float HermiteSpline::getArcLength(uint32 i, float t) const
 {
 	// Gauss-Legendre Quadrature
@@ -168,12 +292,108 @@ float HermiteSpline::getArcLength(uint32 i, float t) const
 
 int32 HermiteSpline::findReparamIndex(float distance) const
 {
-	// #todo-spline: Binary search
-	uint32 numReparam = (uint32)reparam.size();
-	for (uint32 i = 0; i < numReparam - 1; ++i) {
-		if (reparam[i].w <= distance && distance < reparam[i + 1].w) {
-			return i;
+	const int32 lastInterval = (int32)reparam.size() - 2;
+	const uint32 bucket = badger::min((uint32)(distance * reparamBucketScale), (uint32)reparamBuckets.size() - 1);
+	const int32 first = (int32)reparamBuckets[bucket];
+	const int32 last = (bucket + 1 < (uint32)reparamBuckets.size()) ? (int32)reparamBuckets[bucket + 1] : lastInterval;
+
+	// Intervals are not uniform in distance, so a bucket might span many of them.
+	// Find the first interval in the bucket whose end is past the distance.
+	auto endIt = std::upper_bound(reparam.begin() + first + 1, reparam.begin() + last + 1, distance,
+		[](float d, const vector4& r) { return d < r.w; });
+	int32 i = (int32)(endIt - reparam.begin()) - 1;
+	// In case rounding put the distance in the previous bucket.
+	while (i < lastInterval && reparam[i + 1].w <= distance) {
+		++i;
+	}
+	return i;
+}
+
+float HermiteSpline::reparamIndexToTime(int32 reparamIndex, float distance) const
+{
+	const int32 i = reparamIndex / HERMITE_SPLINE_SEGMENTATION;
+	const float d0 = reparam[reparamIndex].w;
+	const float d1 = reparam[reparamIndex + 1].w;
+	// Distance-time relation is not linear, but do it anyway.
+	const float progress = (d1 > d0) ? glm::clamp((distance - d0) / (d1 - d0), 0.0f, 1.0f) : 0.0f;
+	return (float)i + ((float)(reparamIndex - i * HERMITE_SPLINE_SEGMENTATION) + progress) * INV_HERMITE_SPLINE_SEGMENTATION;
+}
+
+void HermiteSpline::buildReparamBuckets()
+{
+	const uint32 numIntervals = (uint32)reparam.size() - 1;
+	const uint32 numBuckets = numIntervals;
+	reparamBuckets.resize(numBuckets);
+	reparamBucketScale = (totalDistance > 0.0f) ? ((float)numBuckets / totalDistance) : 0.0f;
+
+	uint32 i = 0;
+	for (uint32 bucket = 0; bucket < numBuckets; ++bucket) {
+		const float bucketStart = (reparamBucketScale > 0.0f) ? ((float)bucket / reparamBucketScale) : 0.0f;
+		while (i + 1 < numIntervals && reparam[i + 1].w <= bucketStart) {
+			++i;
 		}
+		reparamBuckets[bucket] = i;
 	}
-	return -1;
+}
+
+void HermiteSpline::buildSegmentBounds()
+{
+	const uint32 numSegments = (uint32)points.size() - 1;
+	segmentBounds.resize(numSegments);
+	chunkBounds.clear();
+	for (uint32 i = 0; i < numSegments; ++i) {
+		// Control points of the segment in Bezier form.
+		AABB bounds = AABB::fromMinMax(points[i], points[i]);
+		bounds.expand(points[i] + tangents[i] / 3.0f);
+		bounds.expand(points[i + 1] - tangents[i + 1] / 3.0f);
+		bounds.expand(points[i + 1]);
+		segmentBounds[i] = bounds;
+
+		if (i % HERMITE_SPLINE_CHUNK_SIZE == 0) {
+			chunkBounds.push_back(bounds);
+		} else {
+			chunkBounds.back() = chunkBounds.back() + bounds;
+		}
+	}
+}
+
+float HermiteSpline::findNearestTimeInSegment(uint32 i, const vector3& position, float& outTime) const
+{
+	// Nearest sample in the reparam table.
+	const uint32 firstSample = i * HERMITE_SPLINE_SEGMENTATION;
+	uint32 bestSample = 0;
+	float bestDistSq = std::numeric_limits<float>::max();
+	for (uint32 j = 0; j <= HERMITE_SPLINE_SEGMENTATION; ++j) {
+		vector3 d = vector3(reparam[firstSample + j]) - position;
+		float distSq = glm::dot(d, d);
+		if (distSq < bestDistSq) {
+			bestDistSq = distSq;
+			bestSample = j;
+		}
+	}
+	float bestTime = (float)bestSample * INV_HERMITE_SPLINE_SEGMENTATION;
+
+	// Refine with Newton's method on (P(t) - position) . P'(t) = 0 around the sample.
+	const float tMin = badger::max(0.0f, bestTime - INV_HERMITE_SPLINE_SEGMENTATION);
+	const float tMax = badger::min(1.0f, bestTime + INV_HERMITE_SPLINE_SEGMENTATION);
+	float t = bestTime;
+	for (uint32 step = 0; step < HERMITE_SPLINE_NEWTON_STEPS; ++step) {
+		vector3 d = evaluate(i, t) - position;
+		vector3 d1 = derivative(i, t);
+		float f = glm::dot(d, d1);
+		float df = glm::dot(d1, d1) + glm::dot(d, secondDerivative(i, t));
+		if (df <= 0.0f) {
+			break;
+		}
+		t = glm::clamp(t - f / df, tMin, tMax);
+	}
+	vector3 d = evaluate(i, t) - position;
+	float distSq = glm::dot(d, d);
+	if (distSq < bestDistSq) {
+		bestDistSq = distSq;
+		bestTime = t;
+	}
+
+	outTime = bestTime;
+	return bestDistSq;
 }
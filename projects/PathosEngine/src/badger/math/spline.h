@@ -3,6 +3,7 @@
 #include "badger/types/vector_types.h"
 #include "badger/types/int_types.h"
 #include "badger/types/matrix_types.h"
+#include "badger/math/aabb.h"
 #include <vector>
 
 class HermiteSpline
@@ -18,11 +19,21 @@ public:
 	float getTotalTime() const;
 	float getTotalDistance() const;
 
-	vector3 locationAtTime(float time);
-	vector3 locationAtDistance(float distance);
+	vector3 locationAtTime(float time) const;
+	vector3 locationAtDistance(float distance) const;
 
-	vector3 tangentAtTime(float time);
-	vector3 tangentAtDistance(float distance);
+	vector3 tangentAtTime(float time) const;
+	vector3 tangentAtDistance(float distance) const;
+
+	// Inverse of the arc-length function, from the reparameterization table.
+	float timeAtDistance(float distance) const;
+
+	// Same as calling locationAtDistance() (and tangentAtDistance() if outTangents is not null) for each distance.
+	// Sorted distances are faster as each lookup starts from the previous one.
+	void locationsAtDistances(const float* distances, uint32 count, vector3* outLocations, vector3* outTangents = nullptr) const;
+
+	// Distance along the spline to the point on the spline that is nearest to the position.
+	float findNearestDistance(const vector3& position, vector3* outLocation = nullptr) const;
 
 private:
 	// Function value of P_i(t) where P_i is the hermite spline
@@ -36,7 +47,19 @@ private:
 	// defined by points[i], points[i+1], tangents[i], and tangents[i+1]
 	float getArcLength(uint32 i, float t) const;
 
+	// Second derivative of P_i(t)
+	vector3 secondDerivative(uint32 i, float t) const;
+
+	// Index of the reparam interval that contains the distance, found through reparamBuckets.
 	int32 findReparamIndex(float distance) const;
+	// Time of the distance that is in the reparam interval.
+	float reparamIndexToTime(int32 reparamIndex, float distance) const;
+
+	void buildReparamBuckets();
+	void buildSegmentBounds();
+
+	// Nearest point on P_i. Returns squared distance to the position.
+	float findNearestTimeInSegment(uint32 i, const vector3& position, float& outTime) const;
 
 	bool invalidated = true;
 
@@ -46,4 +69,14 @@ private:
 
 	// xyz = location, w = distance
 	std::vector<vector4> reparam;
+
+	// Uniform buckets over the total distance.
+	// Each bucket stores the reparam interval at its start, so a lookup only searches the intervals between two buckets.
+	std::vector<uint32> reparamBuckets;
+	float reparamBucketScale = 0.0f;
+
+	// Bounds of control points of each segment in Bezier form, which contain the segment.
+	// Grouped into chunks to skip far segments in findNearestDistance().
+	std::vector<AABB> segmentBounds;
+	std::vector<AABB> chunkBounds;
 };
@@ -0,0 +1,508 @@
+#include "broad_phase.h"
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+
+// Absolute margin of fat leaves in the dynamic AABB tree.
+#define AABB_TREE_FAT_MARGIN 0.1f
+// Fat leaves are also extended by (displacement * multiplier) in the direction of movement.
+#define AABB_TREE_DISPLACEMENT_MULTIPLIER 2.0f
+// Bodies per pair query job
+#define AABB_TREE_QUERY_BATCH_SIZE 64
+
+namespace badger {
+	namespace physics {
+
+		static inline uint64 makePairKey(uint32 a, uint32 b) {
+			return (a < b) ? (((uint64)a << 32) | b) : (((uint64)b << 32) | a);
+		}
+
+		std::unique_ptr<BroadPhase> createBroadPhase(EBroadPhaseType type, JobSystem* jobSystem) {
+			switch (type) {
+				case EBroadPhaseType::SweepAndPrune1D: return std::make_unique<BroadPhaseSAP1D>();
+				case EBroadPhaseType::SweepAndPrune3D: return std::make_unique<BroadPhaseSAP3D>();
+				case EBroadPhaseType::DynamicAABBTree: return std::make_unique<BroadPhaseAABBTree>(jobSystem);
+				default: CHECK_NO_ENTRY();
+			}
+			return nullptr;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// BroadPhaseSAP1D
+
+		void BroadPhaseSAP1D::update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) {
+			broadPhase(bodyBounds, outPairs);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// BroadPhaseSAP3D
+
+		static inline bool isMaxEndpoint(uint32 data) { return (data & 1) != 0; }
+		static inline uint32 getEndpointBody(uint32 data) { return data >> 1; }
+
+		// Min endpoint goes first if values are equal, same as AABB::intersects() which treats touching bounds as overlapping.
+		template<typename Endpoint>
+		static inline bool endpointLess(const Endpoint& x, const Endpoint& y) {
+			return (x.value < y.value) || (x.value == y.value && !isMaxEndpoint(x.data) && isMaxEndpoint(y.data));
+		}
+
+		void BroadPhaseSAP3D::update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) {
+			if (bNeedsRebuild || numBodies != (uint32)bodyBounds.size()) {
+				rebuild(bodyBounds);
+			} else {
+				for (uint32 axis = 0; axis < 3; ++axis) {
+					sortAxis(axis, bodyBounds);
+				}
+			}
+
+			outPairs.resize(overlappingPairs.size());
+			size_t n = 0;
+			for (uint64 key : overlappingPairs) {
+				outPairs[n].a = (int32)(key >> 32);
+				outPairs[n].b = (int32)(key & 0xffffffff);
+				++n;
+			}
+			std::sort(outPairs.begin(), outPairs.end(), [](const CollisionPair& x, const CollisionPair& y) {
+				return (x.a < y.a) || (x.a == y.a && x.b < y.b);
+			});
+		}
+
+		void BroadPhaseSAP3D::removeBody(uint32 index, uint32 lastIndex) {
+			bNeedsRebuild = true;
+		}
+
+		void BroadPhaseSAP3D::rebuild(const std::vector<AABB>& bodyBounds) {
+			numBodies = (uint32)bodyBounds.size();
+			bNeedsRebuild = false;
+
+			for (uint32 axis = 0; axis < 3; ++axis) {
+				std::vector<Endpoint>& axisEndpoints = endpoints[axis];
+				axisEndpoints.resize(numBodies * 2);
+				for (uint32 i = 0; i < numBodies; ++i) {
+					axisEndpoints[i * 2 + 0] = Endpoint{ bodyBounds[i].minBounds[axis], i << 1 };
+					axisEndpoints[i * 2 + 1] = Endpoint{ bodyBounds[i].maxBounds[axis], (i << 1) | 1 };
+				}
+				std::sort(axisEndpoints.begin(), axisEndpoints.end(), endpointLess<Endpoint>);
+
+				endpointIndices[axis].resize(numBodies * 2);
+				for (uint32 i = 0; i < numBodies * 2; ++i) {
+					endpointIndices[axis][axisEndpoints[i].data] = i;
+				}
+			}
+
+			// Sweep along the axis where bodies are most spread out.
+			vector3 centerMin(0.0f), centerMax(0.0f);
+			for (uint32 i = 0; i < numBodies; ++i) {
+				const vector3 center = bodyBounds[i].getCenter();
+				centerMin = (i == 0) ? center : (glm::min)(centerMin, center);
+				centerMax = (i == 0) ? center : (glm::max)(centerMax, center);
+			}
+			const vector3 spread = centerMax - centerMin;
+			const uint32 sweepAxis = (spread.x >= spread.y && spread.x >= spread.z) ? 0 : (spread.y >= spread.z ? 1 : 2);
+
+			overlappingPairs.clear();
+			std::vector<uint32> activeBodies;
+			std::vector<uint32> activeIndices(numBodies);
+			for (const Endpoint& endpoint : endpoints[sweepAxis]) {
+				const uint32 body = getEndpointBody(endpoint.data);
+				if (isMaxEndpoint(endpoint.data)) {
+					const uint32 ix = activeIndices[body];
+					activeBodies[ix] = activeBodies.back();
+					activeIndices[activeBodies[ix]] = ix;
+					activeBodies.pop_back();
+				} else {
+					for (uint32 other : activeBodies) {
+						if (bodyBounds[body].intersects(bodyBounds[other])) {
+							overlappingPairs.insert(makePairKey(body, other));
+						}
+					}
+					activeIndices[body] = (uint32)activeBodies.size();
+					activeBodies.push_back(body);
+				}
+			}
+		}
+
+		void BroadPhaseSAP3D::sortAxis(uint32 axis, const std::vector<AABB>& bodyBounds) {
+			std::vector<Endpoint>& axisEndpoints = endpoints[axis];
+			std::vector<uint32>& indices = endpointIndices[axis];
+
+			for (uint32 i = 0; i < numBodies; ++i) {
+				axisEndpoints[indices[i << 1]].value = bodyBounds[i].minBounds[axis];
+				axisEndpoints[indices[(i << 1) | 1]].value = bodyBounds[i].maxBounds[axis];
+			}
+
+			// Insertion sort swaps every two endpoints whose order changed exactly once.
+			// Bounds are already updated on all axes, so testing them tells the final overlap state.
+			const uint32 numEndpoints = (uint32)axisEndpoints.size();
+			for (uint32 i = 1; i < numEndpoints; ++i) {
+				const Endpoint key = axisEndpoints[i];
+				const uint32 keyBody = getEndpointBody(key.data);
+				const bool bKeyIsMax = isMaxEndpoint(key.data);
+
+				uint32 j = i;
+				while (j > 0 && endpointLess(key, axisEndpoints[j - 1])) {
+					const Endpoint& prev = axisEndpoints[j - 1];
+					const uint32 prevBody = getEndpointBody(prev.data);
+					const bool bPrevIsMax = isMaxEndpoint(prev.data);
+					if (!bKeyIsMax && bPrevIsMax) {
+						// Started to overlap on this axis.
+						if (bodyBounds[keyBody].intersects(bodyBounds[prevBody])) {
+							overlappingPairs.insert(makePairKey(keyBody, prevBody));
+						}
+					} else if (bKeyIsMax && !bPrevIsMax) {
+						// Separated on this axis.
+						overlappingPairs.erase(makePairKey(keyBody, prevBody));
+					}
+					axisEndpoints[j] = prev;
+					indices[prev.data] = j;
+					--j;
+				}
+				if (j != i) {
+					axisEndpoints[j] = key;
+					indices[key.data] = j;
+				}
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// BroadPhaseAABBTree
+
+		static inline float surfaceArea(const AABB& bounds) {
+			const vector3 size = bounds.getSize();
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		static inline bool containsAABB(const AABB& outer, const AABB& inner) {
+			return glm::all(glm::lessThanEqual(outer.minBounds, inner.minBounds))
+				&& glm::all(glm::lessThanEqual(inner.maxBounds, outer.maxBounds));
+		}
+
+		void BroadPhaseAABBTree::update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) {
+			const uint32 numBodies = (uint32)bodyBounds.size();
+			CHECKF(bodyToLeaf.size() <= numBodies, "Bodies were removed without removeBody()");
+
+			numReinserted = 0;
+			bodyToLeaf.resize(numBodies, NULL_NODE);
+			for (uint32 i = 0; i < numBodies; ++i) {
+				const AABB& bounds = bodyBounds[i];
+				uint32 leaf = bodyToLeaf[i];
+				if (leaf == NULL_NODE) {
+					leaf = allocateNode();
+					nodes[leaf].bounds = AABB::fromMinMax(bounds.minBounds - vector3(AABB_TREE_FAT_MARGIN), bounds.maxBounds + vector3(AABB_TREE_FAT_MARGIN));
+					nodes[leaf].body = i;
+					insertLeaf(leaf);
+					bodyToLeaf[i] = leaf;
+					continue;
+				}
+				if (containsAABB(nodes[leaf].bounds, bounds)) {
+					continue;
+				}
+
+				const vector3 displacement = AABB_TREE_DISPLACEMENT_MULTIPLIER * (bounds.getCenter() - nodes[leaf].bounds.getCenter());
+				AABB fatBounds = AABB::fromMinMax(bounds.minBounds - vector3(AABB_TREE_FAT_MARGIN), bounds.maxBounds + vector3(AABB_TREE_FAT_MARGIN));
+				fatBounds.minBounds += (glm::min)(displacement, vector3(0.0f));
+				fatBounds.maxBounds += (glm::max)(displacement, vector3(0.0f));
+
+				removeLeaf(leaf);
+				nodes[leaf].bounds = fatBounds;
+				insertLeaf(leaf);
+				++numReinserted;
+			}
+
+			// Each body finds overlapping bodies with greater indices, so batches can run in parallel
+			// and concatenating them in order yields sorted pairs.
+			const uint32 numBatches = (numBodies + AABB_TREE_QUERY_BATCH_SIZE - 1) / AABB_TREE_QUERY_BATCH_SIZE;
+			if (batchPairs.size() < numBatches) {
+				batchPairs.resize(numBatches);
+			}
+			// parallelFor() runs all bodies in one call if it falls back to serial, so clear every batch here.
+			for (uint32 i = 0; i < numBatches; ++i) {
+				batchPairs[i].clear();
+			}
+			parallelFor(jobSystem, numBodies, AABB_TREE_QUERY_BATCH_SIZE,
+				[this, &bodyBounds](uint32 begin, uint32 end) {
+					std::vector<CollisionPair>& pairs = batchPairs[begin / AABB_TREE_QUERY_BATCH_SIZE];
+					for (uint32 i = begin; i < end; ++i) {
+						queryPairs(i, bodyBounds, pairs);
+					}
+				}
+			);
+
+			size_t numPairs = 0;
+			for (uint32 i = 0; i < numBatches; ++i) {
+				numPairs += batchPairs[i].size();
+			}
+			outPairs.clear();
+			outPairs.reserve(numPairs);
+			for (uint32 i = 0; i < numBatches; ++i) {
+				outPairs.insert(outPairs.end(), batchPairs[i].begin(), batchPairs[i].end());
+			}
+		}
+
+		void BroadPhaseAABBTree::removeBody(uint32 index, uint32 lastIndex) {
+			CHECK(index <= lastIndex);
+			if (bodyToLeaf.size() <= lastIndex) {
+				bodyToLeaf.resize(lastIndex + 1, NULL_NODE);
+			}
+
+			const uint32 leaf = bodyToLeaf[index];
+			if (leaf != NULL_NODE) {
+				removeLeaf(leaf);
+				freeNode(leaf);
+			}
+
+			bodyToLeaf[index] = bodyToLeaf[lastIndex];
+			if (bodyToLeaf[index] != NULL_NODE) {
+				nodes[bodyToLeaf[index]].body = index;
+			}
+			bodyToLeaf.resize(lastIndex);
+		}
+
+		void BroadPhaseAABBTree::queryPairs(uint32 body, const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) const {
+			const AABB& bounds = bodyBounds[body];
+			const size_t firstPair = outPairs.size();
+
+			// AVL balancing keeps the height under 1.44 * log2(leaves), so this never overflows.
+			uint32 stack[64];
+			uint32 stackSize = 0;
+			if (root != NULL_NODE) {
+				stack[stackSize++] = root;
+			}
+			while (stackSize > 0) {
+				const Node& node = nodes[stack[--stackSize]];
+				if (!node.bounds.intersects(bounds)) {
+					continue;
+				}
+				if (node.isLeaf()) {
+					if (node.body > body && bodyBounds[node.body].intersects(bounds)) {
+						outPairs.push_back(CollisionPair{ (int32)body, (int32)node.body });
+					}
+				} else {
+					stack[stackSize++] = node.child1;
+					stack[stackSize++] = node.child2;
+				}
+			}
+
+			std::sort(outPairs.begin() + firstPair, outPairs.end(), [](const CollisionPair& x, const CollisionPair& y) {
+				return x.b < y.b;
+			});
+		}
+
+		uint32 BroadPhaseAABBTree::allocateNode() {
+			uint32 node;
+			if (freeList != NULL_NODE) {
+				node = freeList;
+				freeList = nodes[node].parent;
+			} else {
+				node = (uint32)nodes.size();
+				nodes.emplace_back();
+			}
+			nodes[node].parent = NULL_NODE;
+			nodes[node].child1 = NULL_NODE;
+			nodes[node].child2 = NULL_NODE;
+			nodes[node].height = 0;
+			nodes[node].body = 0xffffffff;
+			return node;
+		}
+
+		void BroadPhaseAABBTree::freeNode(uint32 node) {
+			nodes[node].parent = freeList;
+			nodes[node].height = -1;
+			freeList = node;
+		}
+
+		void BroadPhaseAABBTree::insertLeaf(uint32 leaf) {
+			if (root == NULL_NODE) {
+				root = leaf;
+				nodes[root].parent = NULL_NODE;
+				return;
+			}
+
+			// Find the best sibling by surface area heuristic.
+			const AABB leafBounds = nodes[leaf].bounds;
+			uint32 index = root;
+			while (!nodes[index].isLeaf()) {
+				const Node& node = nodes[index];
+				const float area = surfaceArea(node.bounds);
+				const float combinedArea = surfaceArea(node.bounds + leafBounds);
+
+				// Cost of creating a new parent for this node and the leaf,
+				// and the minimum cost of pushing the leaf further down the tree.
+				const float cost = 2.0f * combinedArea;
+				const float inheritanceCost = 2.0f * (combinedArea - area);
+
+				float childCosts[2];
+				const uint32 children[2] = { node.child1, node.child2 };
+				for (uint32 i = 0; i < 2; ++i) {
+					const Node& child = nodes[children[i]];
+					const float newArea = surfaceArea(child.bounds + leafBounds);
+					childCosts[i] = (child.isLeaf() ? newArea : (newArea - surfaceArea(child.bounds))) + inheritanceCost;
+				}
+
+				if (cost < childCosts[0] && cost < childCosts[1]) {
+					break;
+				}
+				index = (childCosts[0] < childCosts[1]) ? children[0] : children[1];
+			}
+			const uint32 sibling = index;
+
+			const uint32 oldParent = nodes[sibling].parent;
+			const uint32 newParent = allocateNode();
+			nodes[newParent].parent = oldParent;
+			nodes[newParent].bounds = leafBounds + nodes[sibling].bounds;
+			nodes[newParent].height = nodes[sibling].height + 1;
+			nodes[newParent].child1 = sibling;
+			nodes[newParent].child2 = leaf;
+			nodes[sibling].parent = newParent;
+			nodes[leaf].parent = newParent;
+
+			if (oldParent != NULL_NODE) {
+				if (nodes[oldParent].child1 == sibling) {
+					nodes[oldParent].child1 = newParent;
+				} else {
+					nodes[oldParent].child2 = newParent;
+				}
+			} else {
+				root = newParent;
+			}
+
+			fixUpwards(nodes[leaf].parent);
+		}
+
+		void BroadPhaseAABBTree::removeLeaf(uint32 leaf) {
+			if (leaf == root) {
+				root = NULL_NODE;
+				return;
+			}
+
+			const uint32 parent = nodes[leaf].parent;
+			const uint32 grandParent = nodes[parent].parent;
+			const uint32 sibling = (nodes[parent].child1 == leaf) ? nodes[parent].child2 : nodes[parent].child1;
+
+			if (grandParent != NULL_NODE) {
+				if (nodes[grandParent].child1 == parent) {
+					nodes[grandParent].child1 = sibling;
+				} else {
+					nodes[grandParent].child2 = sibling;
+				}
+				nodes[sibling].parent = grandParent;
+				freeNode(parent);
+				fixUpwards(grandParent);
+			} else {
+				root = sibling;
+				nodes[sibling].parent = NULL_NODE;
+				freeNode(parent);
+			}
+		}
+
+		void BroadPhaseAABBTree::fixUpwards(uint32 index) {
+			while (index != NULL_NODE) {
+				index = balance(index);
+
+				Node& node = nodes[index];
+				node.height = 1 + (std::max)(nodes[node.child1].height, nodes[node.child2].height);
+				node.bounds = nodes[node.child1].bounds + nodes[node.child2].bounds;
+
+				index = node.parent;
+			}
+		}
+
+		// Rotate the taller child up if the subtree is imbalanced. Returns the new root of the subtree.
+		uint32 BroadPhaseAABBTree::balance(uint32 iA) {
+			Node& A = nodes[iA];
+			if (A.isLeaf() || A.height < 2) {
+				return iA;
+			}
+
+			const uint32 iB = A.child1;
+			const uint32 iC = A.child2;
+			Node& B = nodes[iB];
+			Node& C = nodes[iC];
+			const int32 imbalance = C.height - B.height;
+
+			// Rotate C up
+			if (imbalance > 1) {
+				const uint32 iF = C.child1;
+				const uint32 iG = C.child2;
+				Node& F = nodes[iF];
+				Node& G = nodes[iG];
+
+				C.child1 = iA;
+				C.parent = A.parent;
+				A.parent = iC;
+				if (C.parent != NULL_NODE) {
+					if (nodes[C.parent].child1 == iA) {
+						nodes[C.parent].child1 = iC;
+					} else {
+						nodes[C.parent].child2 = iC;
+					}
+				} else {
+					root = iC;
+				}
+
+				if (F.height > G.height) {
+					C.child2 = iF;
+					A.child2 = iG;
+					G.parent = iA;
+					A.bounds = B.bounds + G.bounds;
+					C.bounds = A.bounds + F.bounds;
+					A.height = 1 + (std::max)(B.height, G.height);
+					C.height = 1 + (std::max)(A.height, F.height);
+				} else {
+					C.child2 = iG;
+					A.child2 = iF;
+					F.parent = iA;
+					A.bounds = B.bounds + F.bounds;
+					C.bounds = A.bounds + G.bounds;
+					A.height = 1 + (std::max)(B.height, F.height);
+					C.height = 1 + (std::max)(A.height, G.height);
+				}
+				return iC;
+			}
+
+			// Rotate B up
+			if (imbalance < -1) {
+				const uint32 iD = B.child1;
+				const uint32 iE = B.child2;
+				Node& D = nodes[iD];
+				Node& E = nodes[iE];
+
+				B.child1 = iA;
+				B.parent = A.parent;
+				A.parent = iB;
+				if (B.parent != NULL_NODE) {
+					if (nodes[B.parent].child1 == iA) {
+						nodes[B.parent].child1 = iB;
+					} else {
+						nodes[B.parent].child2 = iB;
+					}
+				} else {
+					root = iB;
+				}
+
+				if (D.height > E.height) {
+					B.child2 = iD;
+					A.child1 = iE;
+					E.parent = iA;
+					A.bounds = C.bounds + E.bounds;
+					B.bounds = A.bounds + D.bounds;
+					A.height = 1 + (std::max)(C.height, E.height);
+					B.height = 1 + (std::max)(A.height, D.height);
+				} else {
+					B.child2 = iE;
+					A.child1 = iD;
+					D.parent = iA;
+					A.bounds = C.bounds + D.bounds;
+					B.bounds = A.bounds + E.bounds;
+					A.height = 1 + (std::max)(C.height, D.height);
+					B.height = 1 + (std::max)(A.height, E.height);
+				}
+				return iB;
+			}
+
+			return iA;
+		}
+
+	}
+}
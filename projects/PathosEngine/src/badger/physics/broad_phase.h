@@ -0,0 +1,121 @@
+#pragma once
+
+#include "collision.h"
+#include "badger/math/aabb.h"
+
+#include <vector>
+#include <memory>
+#include <unordered_set>
+
+class JobSystem;
+
+namespace badger {
+	namespace physics {
+
+		enum class EBroadPhaseType : uint32 {
+			SweepAndPrune1D = 0, // Stateless. Sorts bounds projected to the diagonal every step.
+			SweepAndPrune3D = 1, // Insertion sort on 3 axes, fast if bodies move a little per step.
+			DynamicAABBTree = 2, // Fattened leaves, reinserted only if a body leaves its fat bounds.
+			Count
+		};
+
+		// Broad phase that keeps its data structure across steps.
+		// i-th bounds in update() belong to the same body until removeBody() is called.
+		class BroadPhase {
+		public:
+			virtual ~BroadPhase() = default;
+
+			virtual EBroadPhaseType getType() const = 0;
+
+			// Bodies appended to bodyBounds since the last update are inserted.
+			// SweepAndPrune3D and DynamicAABBTree output exactly the pairs whose bounds overlap,
+			// with a < b and sorted by (a, b), so they always agree with each other.
+			virtual void update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) = 0;
+
+			// Body at 'index' is removed and the last body at 'lastIndex' takes its index.
+			// Bodies may be removed before they are inserted by update().
+			virtual void removeBody(uint32 index, uint32 lastIndex) = 0;
+		};
+
+		// jobSystem is optional. Only used by DynamicAABBTree for pair queries.
+		std::unique_ptr<BroadPhase> createBroadPhase(EBroadPhaseType type, JobSystem* jobSystem = nullptr);
+
+		class BroadPhaseSAP1D : public BroadPhase {
+		public:
+			virtual EBroadPhaseType getType() const override { return EBroadPhaseType::SweepAndPrune1D; }
+			virtual void update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) override;
+			virtual void removeBody(uint32 index, uint32 lastIndex) override {}
+		};
+
+		// Each axis keeps a sorted array of min/max endpoints. Re-sorting it with insertion sort
+		// finds every pair whose overlap state changed, as two endpoints swap exactly then.
+		// Adding or removing bodies sorts the axes from scratch.
+		class BroadPhaseSAP3D : public BroadPhase {
+		public:
+			virtual EBroadPhaseType getType() const override { return EBroadPhaseType::SweepAndPrune3D; }
+			virtual void update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) override;
+			virtual void removeBody(uint32 index, uint32 lastIndex) override;
+
+		private:
+			struct Endpoint {
+				float  value;
+				uint32 data; // (body << 1) | isMax
+			};
+
+			void rebuild(const std::vector<AABB>& bodyBounds);
+			void sortAxis(uint32 axis, const std::vector<AABB>& bodyBounds);
+
+			std::vector<Endpoint> endpoints[3];
+			std::vector<uint32>   endpointIndices[3]; // [axis][endpoint.data] = index in endpoints[axis]
+			std::unordered_set<uint64> overlappingPairs; // (min << 32) | max
+			uint32 numBodies = 0;
+			bool   bNeedsRebuild = true;
+		};
+
+		// Bounding volume tree with one leaf per body, kept balanced by rotations as in Box2D.
+		// Leaves are fattened by a margin and by the last displacement of the body,
+		// so most bodies stay in their leaves for several steps.
+		class BroadPhaseAABBTree : public BroadPhase {
+		public:
+			BroadPhaseAABBTree(JobSystem* inJobSystem) : jobSystem(inJobSystem) {}
+
+			virtual EBroadPhaseType getType() const override { return EBroadPhaseType::DynamicAABBTree; }
+			virtual void update(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) override;
+			virtual void removeBody(uint32 index, uint32 lastIndex) override;
+
+			inline uint32 getHeight() const { return root == NULL_NODE ? 0 : (uint32)nodes[root].height; }
+			// Leaves reinserted in the last update.
+			inline uint32 getNumReinserted() const { return numReinserted; }
+
+		private:
+			static constexpr uint32 NULL_NODE = 0xffffffff;
+
+			struct Node {
+				AABB   bounds; // Fat bounds for leaves
+				uint32 parent; // Next free node if in the free list
+				uint32 child1; // NULL_NODE for leaves
+				uint32 child2;
+				int32  height; // 0 for leaves, -1 for free nodes
+				uint32 body;
+				inline bool isLeaf() const { return child1 == NULL_NODE; }
+			};
+
+			uint32 allocateNode();
+			void freeNode(uint32 node);
+			void insertLeaf(uint32 leaf);
+			void removeLeaf(uint32 leaf);
+			uint32 balance(uint32 node);
+			void fixUpwards(uint32 node);
+			void queryPairs(uint32 body, const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) const;
+
+			JobSystem*          jobSystem;
+			std::vector<Node>   nodes;
+			uint32              root = NULL_NODE;
+			uint32              freeList = NULL_NODE;
+			std::vector<uint32> bodyToLeaf; // NULL_NODE if not inserted yet
+			uint32              numReinserted = 0;
+			std::vector<std::vector<CollisionPair>> batchPairs; // Per query batch
+		};
+
+	}
+}
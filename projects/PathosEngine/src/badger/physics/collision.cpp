@@ -106,22 +106,15 @@ namespace badger {
 			return lengthSq <= (radiusAB * radiusAB);
 		}
 
-		static void sortBodyBounds(std::vector<Body*>& bodies, std::vector<PseudoBody>& sortedArray, float deltaSeconds) {
+		static void sortBodyBounds(const std::vector<AABB>& bodyBounds, std::vector<PseudoBody>& sortedArray) {
 			auto compareSAP = [](const PseudoBody& a, const PseudoBody& b) {
 				return a.value < b.value;
 			};
 			vector3 axis = glm::normalize(vector3(1.0f, 1.0f, 1.0f));
 
-			sortedArray.resize(bodies.size() * 2u);
-			for (auto i = 0u; i < bodies.size(); ++i) {
-				const Body* body = bodies[i];
-				AABB bounds = body->getShape()->getBounds(body->getPosition(), body->getOrientation());
-
-				vector3 mov = body->getLinearVelocity() * deltaSeconds;
-				bounds = bounds + AABB::fromMinMax(bounds.minBounds + mov, bounds.maxBounds + mov);
-
-				const vector3 EPS(0.01f);
-				bounds = bounds + AABB::fromMinMax(bounds.minBounds - EPS, bounds.maxBounds + EPS);
+			sortedArray.resize(bodyBounds.size() * 2u);
+			for (auto i = 0u; i < bodyBounds.size(); ++i) {
+				const AABB& bounds = bodyBounds[i];
 
 				sortedArray[i * 2 + 0].id = (int32)i;
 				sortedArray[i * 2 + 0].value = glm::dot(axis, bounds.minBounds);
@@ -137,7 +130,6 @@ namespace badger {
 
 		static void buildPairs(std::vector<CollisionPair>& collisionPairs, const std::vector<PseudoBody>& sortedBodies) {
 			collisionPairs.clear();
-			collisionPairs.reserve(sortedBodies.size() * sortedBodies.size() / 4);
 
 			for (auto i = 0u; i < sortedBodies.size(); ++i) {
 				const PseudoBody& a = sortedBodies[i];
@@ -157,14 +149,14 @@ namespace badger {
 			}
 		}
 
-		static void sweepAndPrune1D(std::vector<Body*>& bodies, std::vector<CollisionPair>& outPairs, float deltaSeconds) {
+		static void sweepAndPrune1D(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) {
 			std::vector<PseudoBody> sortedBodies;
-			sortBodyBounds(bodies, sortedBodies, deltaSeconds);
+			sortBodyBounds(bodyBounds, sortedBodies);
 			buildPairs(outPairs, sortedBodies);
 		}
 
-		void broadPhase(std::vector<Body*>& bodies, std::vector<CollisionPair>& outPairs, float deltaSeconds) {
-			sweepAndPrune1D(bodies, outPairs, deltaSeconds);
+		void broadPhase(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs) {
+			sweepAndPrune1D(bodyBounds, outPairs);
 		}
 	}
 }
@@ -179,12 +171,21 @@ namespace badger {
 			vector3 ptB = vector3(0.0f); // Point on bodyB
 		};
 
-		static SupportPoint support(const Body* bodyA, const Body* bodyB, vector3 dir, float bias) {
+		static vector3 supportBody(const Body* body, const vector3& dir, float bias, uint32& inOutHint) {
+			const Shape* shape = body->getShape();
+			if (shape->getType() == Shape::EShapeType::Convex) {
+				return static_cast<const ShapeConvex*>(shape)->support(dir, body->getPosition(), body->getOrientation(), bias, inOutHint);
+			}
+			return shape->support(dir, body->getPosition(), body->getOrientation(), bias);
+		}
+
+		// Support vertices are written back to the cache, so the next query climbs from there.
+		static SupportPoint support(const Body* bodyA, const Body* bodyB, vector3 dir, float bias, GJKCache& cache) {
 			dir = glm::normalize(dir);
 
 			SupportPoint point;
-			point.ptA = bodyA->getShape()->support(dir, bodyA->getPosition(), bodyA->getOrientation(), bias);
-			point.ptB = bodyB->getShape()->support(-dir, bodyB->getPosition(), bodyB->getOrientation(), bias);
+			point.ptA = supportBody(bodyA, dir, bias, cache.hintA);
+			point.ptB = supportBody(bodyB, -dir, bias, cache.hintB);
 			point.xyz = point.ptA - point.ptB; // Support in the minkowski sum (A + (-B))
 
 			return point;
@@ -424,7 +425,7 @@ namespace badger {
 
 		static float expandingPolytopeAlgorithm(
 			const Body* bodyA, const Body* bodyB, float bias, const SupportPoint simplexPoints[4],
-			vector3& ptOnA, vector3& ptOnB)
+			GJKCache& cache, vector3& ptOnA, vector3& ptOnB)
 		{
 			std::vector<SupportPoint> points;
 			std::vector<ConvexHullTriangle> triangles;
@@ -460,7 +461,7 @@ namespace badger {
 				const int32 idx = closestTriangle(triangles, points);
 				vector3 normal = normalDirection(triangles[idx], points);
 
-				const SupportPoint newPt = support(bodyA, bodyB, normal, bias);
+				const SupportPoint newPt = support(bodyA, bodyB, normal, bias, cache);
 
 				// If w already exists, then just stop because we can't expand any further.
 				if (hasPoint(newPt.xyz, triangles, points)) {
@@ -537,18 +538,38 @@ namespace badger {
 namespace badger {
 	namespace physics {
 
-		bool intersectGJK(const Body* bodyA, const Body* bodyB) {
+		// Start from the last search direction of the pair. Any direction works, but the one of the
+		// last step is usually close to the separating axis, so GJK terminates in fewer iterations.
+		static vector3 initialSearchDirection(const GJKCache& cache) {
+			const float EPSILON = 1e-6f;
+			if (glm::dot(cache.searchDir, cache.searchDir) > EPSILON * EPSILON) {
+				return cache.searchDir;
+			}
+			return vector3(1.0f, 1.0f, 1.0f);
+		}
+
+		static void storeSearchDirection(GJKCache& cache, const vector3& dir) {
+			const float EPSILON = 1e-6f;
+			if (glm::dot(dir, dir) > EPSILON * EPSILON) {
+				cache.searchDir = dir;
+			}
+		}
+
+		bool intersectGJK(const Body* bodyA, const Body* bodyB, GJKCache* cache) {
 			const vector3 ORIGIN(0.0f);
 
+			GJKCache localCache;
+			GJKCache& gjkCache = (cache != nullptr) ? *cache : localCache;
+
 			int32 numPt = 1;
 			SupportPoint simplexPoints[4];
-			simplexPoints[0] = support(bodyA, bodyB, vector3(1.0f, 1.0f, 1.0f), 0.0f);
+			simplexPoints[0] = support(bodyA, bodyB, initialSearchDirection(gjkCache), 0.0f, gjkCache);
 
 			float closestDist = std::numeric_limits<float>::max();
 			bool bContainsOrigin = false;
 			vector3 newDir = -(simplexPoints[0].xyz);
 			do {
-				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f);
+				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f, gjkCache);
 				if (simplexContainsPoint(simplexPoints, newPt)) {
 					break;
 				}
@@ -565,6 +586,10 @@ namespace badger {
 				if (bContainsOrigin) {
 					break;
 				}
+				// Degenerate simplex (e.g., a flat tetrahedron). Distances below are NaN and never terminate.
+				if (glm::any(glm::isnan(lambdas))) {
+					break;
+				}
 
 				float dist = glm::dot(newDir, newDir);
 				if (dist >= closestDist) {
@@ -577,21 +602,25 @@ namespace badger {
 				bContainsOrigin = (4 == numPt);
 			} while (!bContainsOrigin);
 
+			storeSearchDirection(gjkCache, newDir);
 			return bContainsOrigin;
 		}
 
-		bool intersectGJK(const Body* bodyA, const Body* bodyB, float bias, vector3& ptOnA, vector3& ptOnB) {
+		bool intersectGJK(const Body* bodyA, const Body* bodyB, float bias, vector3& ptOnA, vector3& ptOnB, GJKCache* cache) {
 			const vector3 ORIGIN(0.0f);
 
+			GJKCache localCache;
+			GJKCache& gjkCache = (cache != nullptr) ? *cache : localCache;
+
 			int32 numPt = 1;
 			SupportPoint simplexPoints[4];
-			simplexPoints[0] = support(bodyA, bodyB, vector3(1.0f, 1.0f, 1.0f), 0.0f);
+			simplexPoints[0] = support(bodyA, bodyB, initialSearchDirection(gjkCache), 0.0f, gjkCache);
 
 			float closestDist = std::numeric_limits<float>::max();
 			bool bContainsOrigin = false;
 			vector3 newDir = -(simplexPoints[0].xyz);
 			do {
-				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f);
+				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f, gjkCache);
 				if (simplexContainsPoint(simplexPoints, newPt)) {
 					break;
 				}
@@ -608,6 +637,10 @@ namespace badger {
 				if (bContainsOrigin) {
 					break;
 				}
+				// Degenerate simplex (e.g., a flat tetrahedron). Distances below are NaN and never terminate.
+				if (glm::any(glm::isnan(lambdas))) {
+					break;
+				}
 
 				float dist = glm::dot(newDir, newDir);
 				if (dist >= closestDist) {
@@ -620,6 +653,7 @@ namespace badger {
 				bContainsOrigin = (4 == numPt);
 			} while (!bContainsOrigin);
 
+			storeSearchDirection(gjkCache, newDir);
 			if (!bContainsOrigin) {
 				return false;
 			}
@@ -627,7 +661,7 @@ namespace badger {
 			// Check that we have a 3-simplex (EPA expects a tetrahedron).
 			if (numPt == 1) {
 				vector3 searchDir = -(simplexPoints[0].xyz);
-				SupportPoint newPt = support(bodyA, bodyB, searchDir, 0.0f);
+				SupportPoint newPt = support(bodyA, bodyB, searchDir, 0.0f, gjkCache);
 				simplexPoints[numPt] = newPt;
 				++numPt;
 			}
@@ -637,7 +671,7 @@ namespace badger {
 				badger::calculateOrthonormalBasis(ab, u, v);
 
 				vector3 newDir = u;
-				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f);
+				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f, gjkCache);
 				simplexPoints[numPt] = newPt;
 				++numPt;
 			}
@@ -647,7 +681,7 @@ namespace badger {
 				vector3 norm = glm::cross(ab, ac);
 
 				vector3 newDir = norm;
-				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f);
+				SupportPoint newPt = support(bodyA, bodyB, newDir, 0.0f, gjkCache);
 				simplexPoints[numPt] = newPt;
 				++numPt;
 			}
@@ -669,26 +703,29 @@ namespace badger {
 			}
 
 			// Find the closest face on the CSO.
-			expandingPolytopeAlgorithm(bodyA, bodyB, bias, simplexPoints, ptOnA, ptOnB);
+			expandingPolytopeAlgorithm(bodyA, bodyB, bias, simplexPoints, gjkCache, ptOnA, ptOnB);
 			return true;
 		}
 
 		// Assumes no intersection.
-		void closestPointGJK(const Body* bodyA, const Body* bodyB, vector3& ptOnA, vector3& ptOnB) {
+		void closestPointGJK(const Body* bodyA, const Body* bodyB, vector3& ptOnA, vector3& ptOnB, GJKCache* cache) {
 			const vector3 ORIGIN(0.0f);
 
+			GJKCache localCache;
+			GJKCache& gjkCache = (cache != nullptr) ? *cache : localCache;
+
 			float closestDist = std::numeric_limits<float>::max();
 			const float bias = 0.0f;
 
 			int32 numPt = 1;
 			SupportPoint simplexPoints[4];
-			simplexPoints[0] = support(bodyA, bodyB, vector3(1.0f), bias);
+			simplexPoints[0] = support(bodyA, bodyB, initialSearchDirection(gjkCache), bias, gjkCache);
 
 			vector4 lambdas(1.0f, 0.0f, 0.0f, 0.0f);
 			vector3 newDir = -(simplexPoints[0].xyz);
 
 			do {
-				SupportPoint newPt = support(bodyA, bodyB, newDir, bias);
+				SupportPoint newPt = support(bodyA, bodyB, newDir, bias, gjkCache);
 
 				if (simplexContainsPoint(simplexPoints, newPt)) {
 					break;
@@ -697,17 +734,29 @@ namespace badger {
 				simplexPoints[numPt] = newPt;
 				++numPt;
 
-				simplexSignedVolumes(simplexPoints, numPt, newDir, lambdas);
+				vector3 dir;
+				vector4 newLambdas;
+				simplexSignedVolumes(simplexPoints, numPt, dir, newLambdas);
+				// Degenerate simplex (e.g., a flat tetrahedron). Keep the last one, whose lambda for newPt is zero.
+				if (glm::any(glm::isnan(newLambdas))) {
+					break;
+				}
+				newDir = dir;
+				lambdas = newLambdas;
 				sortValids(simplexPoints, lambdas);
 				numPt = numValids(lambdas);
 
+				// The origin is on the simplex if shapes are just touching. No direction to search anymore.
+				const float EPSILON = 0.0001f * 0.0001f;
 				float dist = glm::dot(newDir, newDir);
-				if (dist >= closestDist) {
+				if (dist >= closestDist || dist < EPSILON) {
 					break;
 				}
 				closestDist = dist;
 			} while (numPt < 4);
 
+			storeSearchDirection(gjkCache, newDir);
+
 			ptOnA = vector3(0.0f);
 			ptOnB = vector3(0.0f);
 			for (int32 i = 0; i < 4; ++i) {
@@ -723,7 +772,7 @@ namespace badger {
 namespace badger {
 	namespace physics {
 
-		static bool conservativeAdvance(Body* bodyA, Body* bodyB, float dt, Contact& outContact) {
+		static bool conservativeAdvance(Body* bodyA, Body* bodyB, float dt, Contact& outContact, GJKCache* cache) {
 			outContact.bodyA = bodyA;
 			outContact.bodyB = bodyB;
 
@@ -732,7 +781,7 @@ namespace badger {
 
 			// Advance the positions of the bodies until they touch or there's no time left.
 			while (dt > 0.0f) {
-				bool bIntersects = intersect(bodyA, bodyB, outContact);
+				bool bIntersects = intersect(bodyA, bodyB, outContact, cache);
 				if (bIntersects) {
 					outContact.timeOfImpact = toi;
 					bodyA->update(-toi);
@@ -776,7 +825,7 @@ namespace badger {
 			return false;
 		}
 
-		bool intersect(Body* bodyA, Body* bodyB, Contact& outContact) {
+		bool intersect(Body* bodyA, Body* bodyB, Contact& outContact, GJKCache* cache) {
 			outContact.bodyA = bodyA;
 			outContact.bodyB = bodyB;
 			outContact.timeOfImpact = 0.0f;
@@ -803,7 +852,7 @@ namespace badger {
 			} else {
 				vector3 ptOnA, ptOnB;
 				const float bias = 0.001f;
-				if (intersectGJK(bodyA, bodyB, bias, ptOnA, ptOnB)) {
+				if (intersectGJK(bodyA, bodyB, bias, ptOnA, ptOnB, cache)) {
 					vector3 normal = safeNormalize(ptOnB - ptOnA);
 
 					ptOnA -= normal * bias;
@@ -822,7 +871,7 @@ namespace badger {
 					return true;
 				}
 
-				closestPointGJK(bodyA, bodyB, ptOnA, ptOnB);
+				closestPointGJK(bodyA, bodyB, ptOnA, ptOnB, cache);
 				outContact.surfaceA_WS = ptOnA;
 				outContact.surfaceB_WS = ptOnB;
 				outContact.surfaceA_LS = bodyA->worldSpaceToBodySpace(outContact.surfaceA_WS);
@@ -836,7 +885,7 @@ namespace badger {
 			return false;
 		}
 
-		bool intersect(Body* bodyA, Body* bodyB, float dt, Contact& outContact) {
+		bool intersect(Body* bodyA, Body* bodyB, float dt, Contact& outContact, GJKCache* cache) {
 			outContact.bodyA = bodyA;
 			outContact.bodyB = bodyB;
 
@@ -872,7 +921,7 @@ namespace badger {
 				}
 			} else {
 				// Use GJK to perform conservative advance.
-				bool bResult = conservativeAdvance(bodyA, bodyB, dt, outContact);
+				bool bResult = conservativeAdvance(bodyA, bodyB, dt, outContact, cache);
 				return bResult;
 			}
 
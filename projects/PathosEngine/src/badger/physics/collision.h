@@ -1,6 +1,7 @@
 #pragma once
 
 #include "badger/types/vector_types.h"
+#include "badger/math/aabb.h"
 
 #include <vector>
 
@@ -34,18 +35,27 @@ namespace badger {
 			}
 		};
 
+		// Kept per body pair across steps to warm-start GJK.
+		struct GJKCache {
+			vector3 searchDir = vector3(1.0f); // Initial search direction, from the last query.
+			uint32  hintA = 0; // Support vertices of the last query where hill climbing starts.
+			uint32  hintB = 0;
+		};
+
 		// Find all body pairs that might collide. Needs narrow phase to actually test it.
-		void broadPhase(std::vector<Body*>& bodies, std::vector<CollisionPair>& outPairs, float deltaSeconds);
+		// bodyBounds: World bounds of bodies that cover their movement in this step. Pairs are indices to this array.
+		void broadPhase(const std::vector<AABB>& bodyBounds, std::vector<CollisionPair>& outPairs);
 
 		// Intersection test between two convex shapes by Gilbert-Johnson-Keerthi algorithm.
-		bool intersectGJK(const Body* bodyA, const Body* bodyB);
+		// cache is optional. If given, the search starts from its state and it's updated.
+		bool intersectGJK(const Body* bodyA, const Body* bodyB, GJKCache* cache = nullptr);
 
 		// A variant that also writes the contact points to ptOnA and ptOnB.
-		bool intersectGJK(const Body* bodyA, const Body* bodyB, float bias, vector3& ptOnA, vector3& ptOnB);
+		bool intersectGJK(const Body* bodyA, const Body* bodyB, float bias, vector3& ptOnA, vector3& ptOnB, GJKCache* cache = nullptr);
 
-		bool intersect(Body* bodyA, Body* bodyB, Contact& outContact);
+		bool intersect(Body* bodyA, Body* bodyB, Contact& outContact, GJKCache* cache = nullptr);
 
-		bool intersect(Body* bodyA, Body* bodyB, float dt, Contact& outContact);
+		bool intersect(Body* bodyA, Body* bodyB, float dt, Contact& outContact, GJKCache* cache = nullptr);
 
 	}
 }
@@ -1,10 +1,17 @@
 #include "physics_scene.h"
 #include "collision.h"
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
 
 #include <algorithm>
 
 static const vector3 GRAVITY = vector3(0.0f, -9.8f, 0.0f);
 
+// Bodies or pairs per job
+static constexpr uint32 PARALLEL_BATCH_SIZE = 256;
+
+static constexpr uint32 INVALID_ISLAND = 0xffffffff;
+
 namespace badger {
 	namespace physics {
 
@@ -86,112 +93,421 @@ namespace badger {
 			}
 		}
 
-		void PhysicsScene::initialize() {
-			//
-		}
 
-		void PhysicsScene::update(float deltaSeconds) {
-			for (auto i = 0u; i < bodies.size(); ++i) {
-				Body* body = bodies[i];
+		void PhysicsScene::initialize(JobSystem* inJobSystem) {
+			jobSystem = inJobSystem;
+			broadPhase.reset();
+		}
 
-				// Gravity needs to be an impulse
-				// I = dp, F = dp/dt => dp = F * dt => I = F * dt
-				// F = mgs
-				float mass = 1.0f / body->invMass;
-				vector3 impulseGravity = GRAVITY * mass * deltaSeconds;
-				body->applyImpulseLinear(impulseGravity);
+		void PhysicsScene::setBroadPhaseType(EBroadPhaseType type) {
+			CHECK(type < EBroadPhaseType::Count);
+			if (broadPhaseType != type) {
+				broadPhaseType = type;
+				broadPhase.reset();
 			}
+		}
+
+		void PhysicsScene::update(float deltaSeconds) {
+			integrateGravity(deltaSeconds);
 
 			// Broad phase
-			std::vector<CollisionPair> collisionPairs;
-			broadPhase(bodies, collisionPairs, deltaSeconds);
+			calculateSweptBounds(deltaSeconds);
+			if (broadPhase == nullptr) {
+				broadPhase = createBroadPhase(broadPhaseType, jobSystem);
+			}
+			broadPhase->update(sweptBounds, collisionPairs);
 
 			// Narrow phase
-			std::vector<Contact> contacts;
-			contacts.reserve(bodies.size() * bodies.size());
-#if 1
-			for (const CollisionPair& cp : collisionPairs) {
-				Body* bodyA = bodies[cp.a];
-				Body* bodyB = bodies[cp.b];
-				// Skip body pairs with infinite mass
-				if (bodyA->hasInfiniteMass() && bodyB->hasInfiniteMass()) {
-					continue;
-				}
-
-				Contact contact;
-				if (intersect(bodyA, bodyB, deltaSeconds, contact)) {
-					contacts.emplace_back(contact);
-				}
-			}
-#else
-			// Brute force ver.
-			for (auto i = 0u; i < bodies.size(); ++i) {
-				for (auto j = i + 1; j < bodies.size(); ++j) {
-					Body* bodyA = bodies[i];
-					Body* bodyB = bodies[j];
+			narrowPhase(deltaSeconds);
+
+			// Bodies that touch each other form an island. Each island sweeps its contacts
+			// in order of time of impact, independent of other islands.
+			buildIslands();
+			solveIslands(deltaSeconds);
+		}
+
+		BodyHandle PhysicsScene::allocateBody() {
+			BodyHandle handle;
+			if (freeHandles.size() > 0) {
+				handle = freeHandles.back();
+				freeHandles.pop_back();
+			} else {
+				handle = (BodyHandle)handleToDense.size();
+				handleToDense.push_back(0);
+			}
+
+			const Body defaultBody;
+			handleToDense[handle] = (uint32)denseToHandle.size();
+			denseToHandle.push_back(handle);
+			positions.push_back(defaultBody.position);
+			orientations.push_back(defaultBody.orientation);
+			linearVelocities.push_back(defaultBody.linearVelocity);
+			angularVelocities.push_back(defaultBody.angularVelocity);
+			invMasses.push_back(defaultBody.invMass);
+			elasticities.push_back(defaultBody.elasticity);
+			frictions.push_back(defaultBody.friction);
+			bodyShapes.push_back(defaultBody.shape);
+			return handle;
+		}
+
+		void PhysicsScene::releaseBody(BodyHandle handle) {
+			CHECK(handle < handleToDense.size() && handleToDense[handle] != INVALID_BODY_HANDLE);
+
+			const uint32 index = handleToDense[handle];
+			const uint32 last = (uint32)denseToHandle.size() - 1;
+			if (broadPhase != nullptr) {
+				broadPhase->removeBody(index, last);
+			}
+			if (index != last) {
+				positions[index] = positions[last];
+				orientations[index] = orientations[last];
+				linearVelocities[index] = linearVelocities[last];
+				angularVelocities[index] = angularVelocities[last];
+				invMasses[index] = invMasses[last];
+				elasticities[index] = elasticities[last];
+				frictions[index] = frictions[last];
+				bodyShapes[index] = bodyShapes[last];
+				denseToHandle[index] = denseToHandle[last];
+				handleToDense[denseToHandle[index]] = index;
+			}
+			positions.pop_back();
+			orientations.pop_back();
+			linearVelocities.pop_back();
+			angularVelocities.pop_back();
+			invMasses.pop_back();
+			elasticities.pop_back();
+			frictions.pop_back();
+			bodyShapes.pop_back();
+			denseToHandle.pop_back();
+
+			handleToDense[handle] = INVALID_BODY_HANDLE;
+			freeHandles.push_back(handle);
+
+			// The handle will be recycled for another body. Its hint vertices don't apply to that shape.
+			for (auto it = gjkCaches.begin(); it != gjkCaches.end(); ) {
+				const uint64 key = it->first;
+				if ((uint32)(key >> 32) == handle || (uint32)(key & 0xffffffff) == handle) {
+					it = gjkCaches.erase(it);
+				} else {
+					++it;
+				}
+			}
+		}
+
+		vector3 PhysicsScene::getCenterOfMassWorldSpace(BodyHandle handle) const {
+			return loadBody(toDense(handle)).getCenterOfMassWorldSpace();
+		}
+
+		Body PhysicsScene::loadBody(uint32 index) const {
+			Body body;
+			body.position = positions[index];
+			body.orientation = orientations[index];
+			body.linearVelocity = linearVelocities[index];
+			body.angularVelocity = angularVelocities[index];
+			body.invMass = invMasses[index];
+			body.elasticity = elasticities[index];
+			body.friction = frictions[index];
+			body.shape = bodyShapes[index];
+			return body;
+		}
+
+		void PhysicsScene::storeBody(uint32 index, const Body& body) {
+			positions[index] = body.position;
+			orientations[index] = body.orientation;
+			linearVelocities[index] = body.linearVelocity;
+			angularVelocities[index] = body.angularVelocity;
+		}
+
+		void PhysicsScene::integrateGravity(float deltaSeconds) {
+			// Gravity needs to be an impulse
+			// I = dp, F = dp/dt => dp = F * dt => I = F * dt
+			// F = mg => dv = I / m = g * dt
+			const vector3 deltaVelocity = GRAVITY * deltaSeconds;
+			const uint32 numBodies = getNumBodies();
+			for (uint32 i = 0; i < numBodies; ++i) {
+				if (invMasses[i] != 0.0f) {
+					linearVelocities[i] += deltaVelocity;
+				}
+			}
+		}
+
+		void PhysicsScene::calculateSweptBounds(float deltaSeconds) {
+			const uint32 numBodies = getNumBodies();
+			sweptBounds.resize(numBodies);
+			parallelFor(jobSystem, numBodies, PARALLEL_BATCH_SIZE, [this, deltaSeconds](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					AABB bounds = bodyShapes[i]->getBounds(positions[i], orientations[i]);
+
+					vector3 mov = linearVelocities[i] * deltaSeconds;
+					bounds = bounds + AABB::fromMinMax(bounds.minBounds + mov, bounds.maxBounds + mov);
+
+					const vector3 EPS(0.01f);
+					bounds = bounds + AABB::fromMinMax(bounds.minBounds - EPS, bounds.maxBounds + EPS);
+
+					sweptBounds[i] = bounds;
+				}
+			});
+		}
+
+		void PhysicsScene::narrowPhase(float deltaSeconds) {
+			const uint32 numPairs = (uint32)collisionPairs.size();
+			pairContacts.resize(numPairs);
+			pairHasContact.assign(numPairs, 0);
+
+			// Warm-start GJK with the state of the same pair in the last step.
+			// Dense indices change when bodies are released, so pairs are keyed by handles
+			// and caches are stored in handle order. A pair can come in the other order after
+			// a release moves a body, then the roles of its bodies are swapped.
+			auto pairKey = [this](uint32 a, uint32 b) {
+				const uint64 handleA = denseToHandle[a], handleB = denseToHandle[b];
+				return (handleA < handleB) ? ((handleA << 32) | handleB) : ((handleB << 32) | handleA);
+			};
+			auto isHandleOrder = [this](uint32 a, uint32 b) {
+				return denseToHandle[a] < denseToHandle[b];
+			};
+			auto swapCacheRoles = [](GJKCache& cache) {
+				std::swap(cache.hintA, cache.hintB);
+				cache.searchDir = -cache.searchDir; // Minkowski difference B - A
+			};
+			pairCaches.resize(numPairs);
+			for (uint32 i = 0; i < numPairs; ++i) {
+				const uint32 a = (uint32)collisionPairs[i].a;
+				const uint32 b = (uint32)collisionPairs[i].b;
+				auto it = gjkCaches.find(pairKey(a, b));
+				pairCaches[i] = (it != gjkCaches.end()) ? it->second : GJKCache();
+				if (it != gjkCaches.end() && !isHandleOrder(a, b)) {
+					swapCacheRoles(pairCaches[i]);
+				}
+			}
+
+			parallelFor(jobSystem, numPairs, PARALLEL_BATCH_SIZE, [this, deltaSeconds](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					const uint32 a = (uint32)collisionPairs[i].a;
+					const uint32 b = (uint32)collisionPairs[i].b;
 					// Skip body pairs with infinite mass
-					if (bodyA->hasInfiniteMass() && bodyB->hasInfiniteMass()) {
+					if (invMasses[a] == 0.0f && invMasses[b] == 0.0f) {
 						continue;
 					}
-					
-					Contact contact;
-					if (intersect(bodyA, bodyB, deltaSeconds, contact)) {
-						contacts.emplace_back(contact);
+					// Broad phase only guarantees overlap along its sweep axis.
+					if (!sweptBounds[a].intersects(sweptBounds[b])) {
+						continue;
+					}
+
+					// intersect() advances and rewinds bodies, so test on copies.
+					Body bodyA = loadBody(a);
+					Body bodyB = loadBody(b);
+					SceneContact& sceneContact = pairContacts[i];
+					if (intersect(&bodyA, &bodyB, deltaSeconds, sceneContact.contact, &pairCaches[i])) {
+						sceneContact.contact.bodyA = nullptr;
+						sceneContact.contact.bodyB = nullptr;
+						sceneContact.bodyA = a;
+						sceneContact.bodyB = b;
+						pairHasContact[i] = 1;
 					}
 				}
+			});
+
+			contacts.clear();
+			for (uint32 i = 0; i < numPairs; ++i) {
+				if (pairHasContact[i] != 0) {
+					contacts.push_back(pairContacts[i]);
+				}
 			}
-#endif
 
-			// Sort by Time of Impact.
-			if (contacts.size() > 1) {
-				auto compareContacts = [](const Contact& a, const Contact& b) {
-					return a.timeOfImpact < b.timeOfImpact;
-				};
-				std::sort(contacts.begin(), contacts.end(), compareContacts);
+			// Pairs that left the broad phase are dropped.
+			gjkCaches.clear();
+			gjkCaches.reserve(numPairs);
+			for (uint32 i = 0; i < numPairs; ++i) {
+				const uint32 a = (uint32)collisionPairs[i].a;
+				const uint32 b = (uint32)collisionPairs[i].b;
+				GJKCache& cache = pairCaches[i];
+				if (!isHandleOrder(a, b)) {
+					swapCacheRoles(cache);
+				}
+				gjkCaches.emplace(pairKey(a, b), cache);
 			}
+		}
 
-			float accumulatedTime = 0.0f;
-			for (auto i = 0u; i < contacts.size(); ++i) {
-				Contact& contact = contacts[i];
-				float dt = contact.timeOfImpact - accumulatedTime;
+		static uint32 findIslandRoot(std::vector<uint32>& parents, uint32 x) {
+			while (parents[x] != x) {
+				parents[x] = parents[parents[x]];
+				x = parents[x];
+			}
+			return x;
+		}
+
+		void PhysicsScene::buildIslands() {
+			const uint32 numBodies = getNumBodies();
+			const uint32 numContacts = (uint32)contacts.size();
 
-				Body* bodyA = contact.bodyA;
-				Body* bodyB = contact.bodyB;
-				// Skip body pairs with infinite mass
-				if (bodyA->hasInfiniteMass() && bodyB->hasInfiniteMass()) {
-					continue;
+			// Union dynamic bodies in contact. Bodies with infinite mass don't connect islands.
+			islandParents.resize(numBodies);
+			for (uint32 i = 0; i < numBodies; ++i) {
+				islandParents[i] = i;
+			}
+			for (const SceneContact& sc : contacts) {
+				if (invMasses[sc.bodyA] != 0.0f && invMasses[sc.bodyB] != 0.0f) {
+					uint32 rootA = findIslandRoot(islandParents, sc.bodyA);
+					uint32 rootB = findIslandRoot(islandParents, sc.bodyB);
+					if (rootA != rootB) {
+						islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+					}
 				}
+			}
 
-				for (auto j = 0u; j < bodies.size(); ++j) {
-					bodies[j]->update(dt);
+			// Number islands that have at least one contact.
+			bodyIslands.assign(numBodies, INVALID_ISLAND);
+			std::vector<uint32> contactIslands(numContacts);
+			numIslands = 0;
+			for (uint32 i = 0; i < numContacts; ++i) {
+				const SceneContact& sc = contacts[i];
+				const uint32 dynamicBody = (invMasses[sc.bodyA] != 0.0f) ? sc.bodyA : sc.bodyB;
+				const uint32 root = findIslandRoot(islandParents, dynamicBody);
+				if (bodyIslands[root] == INVALID_ISLAND) {
+					bodyIslands[root] = numIslands++;
 				}
+				contactIslands[i] = bodyIslands[root];
+			}
+			for (uint32 i = 0; i < numBodies; ++i) {
+				if (invMasses[i] != 0.0f) {
+					bodyIslands[i] = bodyIslands[findIslandRoot(islandParents, i)];
+				} else {
+					bodyIslands[i] = INVALID_ISLAND;
+				}
+			}
 
+			// Group contacts by island. Counting sort keeps the order of the narrow phase.
+			islandContactOffsets.assign(numIslands + 1, 0);
+			for (uint32 i = 0; i < numContacts; ++i) {
+				islandContactOffsets[contactIslands[i] + 1] += 1;
+			}
+			for (uint32 i = 0; i < numIslands; ++i) {
+				islandContactOffsets[i + 1] += islandContactOffsets[i];
+			}
+			std::vector<SceneContact> sortedContacts(numContacts);
+			{
+				std::vector<uint32> cursors(islandContactOffsets.begin(), islandContactOffsets.end() - 1);
+				for (uint32 i = 0; i < numContacts; ++i) {
+					sortedContacts[cursors[contactIslands[i]]++] = contacts[i];
+				}
+			}
+			contacts.swap(sortedContacts);
+
+			// Gather bodies of each island. Bodies with infinite mass can be shared by several islands,
+			// so each island gets its own copy and they are integrated outside of islands.
+			std::vector<uint32> dynamicOffsets(numIslands + 1, 0);
+			for (uint32 i = 0; i < numBodies; ++i) {
+				if (bodyIslands[i] != INVALID_ISLAND) {
+					dynamicOffsets[bodyIslands[i] + 1] += 1;
+				}
+			}
+			for (uint32 i = 0; i < numIslands; ++i) {
+				dynamicOffsets[i + 1] += dynamicOffsets[i];
+			}
+			std::vector<uint32> dynamicBodies(dynamicOffsets[numIslands]);
+			{
+				std::vector<uint32> cursors(dynamicOffsets.begin(), dynamicOffsets.end() - 1);
+				for (uint32 i = 0; i < numBodies; ++i) {
+					if (bodyIslands[i] != INVALID_ISLAND) {
+						dynamicBodies[cursors[bodyIslands[i]]++] = i;
+					}
+				}
+			}
+
+			// Local index of each body in its island. Static bodies are overwritten per island.
+			std::vector<uint32> localIndices(numBodies, INVALID_ISLAND);
+			std::vector<uint32> staticLastIsland(numBodies, INVALID_ISLAND);
+			islandBodies.clear();
+			islandBodyOffsets.resize(numIslands + 1);
+			for (uint32 island = 0; island < numIslands; ++island) {
+				const uint32 first = (uint32)islandBodies.size();
+				islandBodyOffsets[island] = first;
+				for (uint32 k = dynamicOffsets[island]; k < dynamicOffsets[island + 1]; ++k) {
+					localIndices[dynamicBodies[k]] = (uint32)islandBodies.size() - first;
+					islandBodies.push_back(dynamicBodies[k]);
+				}
+				for (uint32 k = islandContactOffsets[island]; k < islandContactOffsets[island + 1]; ++k) {
+					SceneContact& sc = contacts[k];
+					for (uint32 body : { sc.bodyA, sc.bodyB }) {
+						if (invMasses[body] == 0.0f && staticLastIsland[body] != island) {
+							staticLastIsland[body] = island;
+							localIndices[body] = (uint32)islandBodies.size() - first;
+							islandBodies.push_back(body);
+						}
+					}
+					sc.localA = localIndices[sc.bodyA];
+					sc.localB = localIndices[sc.bodyB];
+				}
+			}
+			islandBodyOffsets[numIslands] = (uint32)islandBodies.size();
+		}
+
+		void PhysicsScene::solveIslands(float deltaSeconds) {
+			parallelFor(jobSystem, numIslands, 1, [this, deltaSeconds](uint32 begin, uint32 end) {
+				for (uint32 island = begin; island < end; ++island) {
+					solveIsland(island, deltaSeconds);
+				}
+			});
+
+			// Bodies without contacts just move for the whole step.
+			const uint32 numBodies = getNumBodies();
+			parallelFor(jobSystem, numBodies, PARALLEL_BATCH_SIZE, [this, deltaSeconds](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					if (bodyIslands[i] == INVALID_ISLAND) {
+						Body body = loadBody(i);
+						body.update(deltaSeconds);
+						storeBody(i, body);
+					}
+				}
+			});
+		}
+
+		void PhysicsScene::solveIsland(uint32 island, float deltaSeconds) {
+			static thread_local std::vector<Body> localBodies;
+
+			const uint32 firstBody = islandBodyOffsets[island];
+			const uint32 numLocalBodies = islandBodyOffsets[island + 1] - firstBody;
+			localBodies.resize(numLocalBodies);
+			for (uint32 i = 0; i < numLocalBodies; ++i) {
+				localBodies[i] = loadBody(islandBodies[firstBody + i]);
+			}
+
+			// Sort by Time of Impact.
+			auto contactsBegin = contacts.begin() + islandContactOffsets[island];
+			auto contactsEnd = contacts.begin() + islandContactOffsets[island + 1];
+			std::stable_sort(contactsBegin, contactsEnd, [](const SceneContact& a, const SceneContact& b) {
+				return a.contact.timeOfImpact < b.contact.timeOfImpact;
+			});
+
+			float accumulatedTime = 0.0f;
+			for (auto it = contactsBegin; it != contactsEnd; ++it) {
+				Contact& contact = it->contact;
+				float dt = contact.timeOfImpact - accumulatedTime;
+
+				for (Body& body : localBodies) {
+					body.update(dt);
+				}
+
+				contact.bodyA = &localBodies[it->localA];
+				contact.bodyB = &localBodies[it->localB];
 				resolveContact(contact);
 				accumulatedTime += dt;
 			}
 
 			float timeRemaining = deltaSeconds - accumulatedTime;
 			if (timeRemaining > 0.0f) {
-				for (auto i = 0u; i < bodies.size(); ++i) {
-					bodies[i]->update(timeRemaining);
+				for (Body& body : localBodies) {
+					body.update(timeRemaining);
 				}
 			}
-		}
-
-		Body* PhysicsScene::allocateBody() {
-			Body* body = new Body;
-			bodies.push_back(body);
-			return body;
-		}
 
-		void PhysicsScene::releaseBody(Body* body) {
-			for (auto it = bodies.begin(); it != bodies.end(); ++it) {
-				if (*it == body) {
-					bodies.erase(it);
-					return;
+			// Bodies with infinite mass are integrated outside of islands.
+			for (uint32 i = 0; i < numLocalBodies; ++i) {
+				const uint32 index = islandBodies[firstBody + i];
+				if (invMasses[index] != 0.0f) {
+					storeBody(index, localBodies[i]);
 				}
 			}
-			CHECK_NO_ENTRY();
 		}
 
 	}
@@ -1,24 +1,120 @@
 #pragma once
 
 #include "shape.h"
+#include "collision.h"
+#include "broad_phase.h"
 #include <vector>
+#include <memory>
+#include <unordered_map>
+
+class JobSystem;
 
 namespace badger {
 	namespace physics {
 
+		// Stable handle to a body in a PhysicsScene. Remains valid until releaseBody().
+		using BodyHandle = uint32;
+		constexpr BodyHandle INVALID_BODY_HANDLE = 0xffffffff;
+
 		class PhysicsScene {
 
 		public:
-			void initialize();
+			// Narrow phase, island solving and integration run on the job system if given.
+			void initialize(JobSystem* inJobSystem = nullptr);
 			void update(float deltaSeconds);
 
-			Body* allocateBody();
-			void releaseBody(Body* body);
+			// Takes effect from the next update(). The new broad phase is built from scratch.
+			void setBroadPhaseType(EBroadPhaseType type);
+			inline EBroadPhaseType getBroadPhaseType() const { return broadPhaseType; }
+
+			BodyHandle allocateBody();
+			void releaseBody(BodyHandle handle);
+
+			inline uint32 getNumBodies() const { return (uint32)denseToHandle.size(); }
+
+			const Shape* getShape(BodyHandle handle) const { return bodyShapes[toDense(handle)]; }
+			void setShape(BodyHandle handle, Shape* shape) { bodyShapes[toDense(handle)] = shape; }
+
+			vector3 getPosition(BodyHandle handle) const { return positions[toDense(handle)]; }
+			void setPosition(BodyHandle handle, const vector3& position) { positions[toDense(handle)] = position; }
+
+			quat getOrientation(BodyHandle handle) const { return orientations[toDense(handle)]; }
+			void setOrientation(BodyHandle handle, const quat& orientation) { orientations[toDense(handle)] = orientation; }
+
+			vector3 getLinearVelocity(BodyHandle handle) const { return linearVelocities[toDense(handle)]; }
+			void setLinearVelocity(BodyHandle handle, const vector3& velocity) { linearVelocities[toDense(handle)] = velocity; }
+
+			vector3 getAngularVelocity(BodyHandle handle) const { return angularVelocities[toDense(handle)]; }
+
+			float getInvMass(BodyHandle handle) const { return invMasses[toDense(handle)]; }
+			void setInvMass(BodyHandle handle, float invMass) { invMasses[toDense(handle)] = invMass; }
+
+			void setElasticity(BodyHandle handle, float elasticity) { elasticities[toDense(handle)] = elasticity; }
+			void setFriction(BodyHandle handle, float friction) { frictions[toDense(handle)] = friction; }
+
+			vector3 getCenterOfMassWorldSpace(BodyHandle handle) const;
+
+			// Number of broad phase pairs, contacts and islands in the last update().
+			inline uint32 getNumCollisionPairs() const { return (uint32)collisionPairs.size(); }
+			inline uint32 getNumContacts() const { return (uint32)contacts.size(); }
+			inline uint32 getNumIslands() const { return numIslands; }
+
+		private:
+			struct SceneContact {
+				Contact contact;
+				uint32  bodyA; // Dense index
+				uint32  bodyB;
+				uint32  localA; // Index in the island
+				uint32  localB;
+			};
+
+			inline uint32 toDense(BodyHandle handle) const { return handleToDense[handle]; }
+
+			// Bodies are stored in SoA. Collision routines work on Body copies.
+			Body loadBody(uint32 index) const;
+			void storeBody(uint32 index, const Body& body);
+
+			void integrateGravity(float deltaSeconds);
+			void calculateSweptBounds(float deltaSeconds);
+			void narrowPhase(float deltaSeconds);
+			void buildIslands();
+			void solveIslands(float deltaSeconds);
+			void solveIsland(uint32 island, float deltaSeconds);
 
 		private:
-			// #todo-physics: Memory access is not cache friendly :(
-			// Maybe import FreeNumberList from Cyseal and expose int32 handles rather than pointers?
-			std::vector<Body*> bodies;
+			JobSystem* jobSystem = nullptr;
+			EBroadPhaseType broadPhaseType = EBroadPhaseType::SweepAndPrune3D;
+			std::unique_ptr<BroadPhase> broadPhase;
+
+			// Handle -> dense index. Released handles are recycled.
+			std::vector<uint32> handleToDense;
+			std::vector<BodyHandle> freeHandles;
+			std::vector<BodyHandle> denseToHandle;
+
+			// Body state in dense arrays. Releasing a body moves the last one into its place.
+			std::vector<vector3> positions;
+			std::vector<quat>    orientations;
+			std::vector<vector3> linearVelocities;
+			std::vector<vector3> angularVelocities;
+			std::vector<float>   invMasses;
+			std::vector<float>   elasticities;
+			std::vector<float>   frictions;
+			std::vector<Shape*>  bodyShapes;
+
+			// Per-step data
+			std::vector<AABB>          sweptBounds;
+			std::vector<CollisionPair> collisionPairs;
+			std::vector<SceneContact>  pairContacts; // Per collision pair, valid if pairHasContact[i] != 0
+			std::vector<GJKCache>      pairCaches;   // Per collision pair
+			std::unordered_map<uint64, GJKCache> gjkCaches; // (handleA << 32) | handleB, handleA < handleB. Pairs of the last step.
+			std::vector<uint8>         pairHasContact;
+			std::vector<SceneContact>  contacts;
+			std::vector<uint32>        islandParents;  // Union-find over dense indices
+			std::vector<uint32>        bodyIslands;    // Dense index -> island, or INVALID_ISLAND
+			std::vector<uint32>        islandContactOffsets; // Contacts of island i are [offsets[i], offsets[i+1]) in 'contacts'
+			std::vector<uint32>        islandBodyOffsets;    // Bodies of island i are [offsets[i], offsets[i+1]) in 'islandBodies'
+			std::vector<uint32>        islandBodies;
+			uint32                     numIslands = 0;
 
 		};
 
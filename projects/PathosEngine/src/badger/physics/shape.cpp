@@ -4,9 +4,15 @@
 
 #include "glm/gtx/quaternion.hpp"
 
+#include <emmintrin.h> // SSE2 is always available on x64.
+#include <algorithm>
+
 // #todo-physics: Hard-coded max angular speed
 static const float MAX_ANGULAR_SPEED = 30.0f;
 
+// Hulls with more vertices than this find support points by hill climbing.
+#define HILL_CLIMB_MIN_VERTICES 32
+
 // p : position, q : orientation
 static vector3 rotatePoint(const vector3& p, const quat& q) {
 	return q * p; // GLM's operator*(quat, vec) is rotation.
@@ -61,19 +67,19 @@ namespace badger {
 		}
 
 		vector3 ShapeBox::support(const vector3& dir, const vector3& pos, const quat& orient, float bias) const {
-			// Find the point in furthest in direction.
-			vector3 maxPt = rotatePoint(points[0], orient) + pos;
-			float maxDist = glm::dot(dir, maxPt);
-			for (auto i = 0u; i < points.size(); ++i) {
-				const vector3 pt = rotatePoint(points[i], orient) + pos;
-				float dist = glm::dot(dir, pt);
+			// Find the point in furthest in direction. Rotate the direction instead of every point.
+			const vector3 localDir = rotatePoint(dir, glm::conjugate(orient));
+			uint32 maxIndex = 0;
+			float maxDist = glm::dot(localDir, points[0]);
+			for (auto i = 1u; i < points.size(); ++i) {
+				float dist = glm::dot(localDir, points[i]);
 				if (dist > maxDist) {
 					maxDist = dist;
-					maxPt = pt;
+					maxIndex = i;
 				}
 			}
 			vector3 norm = bias * glm::normalize(dir);
-			return maxPt + norm;
+			return rotatePoint(points[maxIndex], orient) + pos + norm;
 		}
 
 		AABB ShapeBox::getBounds(const vector3& pos, const quat& orient) const {
@@ -160,38 +166,148 @@ namespace badger {
 namespace badger {
 	namespace physics {
 		
-		void ShapeConvex::build(const std::vector<vector3>& points) {
+		void ShapeConvex::build(const std::vector<vector3>& points, JobSystem* jobSystem) {
 			shapePoints = points;
 
 			std::vector<vector3> hullPoints;
 			std::vector<ConvexHullTriangle> hullTriangles;
-			buildConvexHull(shapePoints, hullPoints, hullTriangles);
+			if (!buildConvexHull(shapePoints, hullPoints, hullTriangles, jobSystem)) {
+				// Flat shape. Keep all points; support vertices are found without hull adjacency.
+				hullPoints = shapePoints;
+			}
 			shapePoints = hullPoints;
 
 			bounds = buildAABB(shapePoints);
 
 			centerOfMass = calculateCenterOfMass(hullPoints, hullTriangles);
 			inertiaTensor = calculateInertiaTensor(hullPoints, hullTriangles, centerOfMass);
+
+			buildSupportData(hullTriangles);
 		}
 
-		vector3 ShapeConvex::support(const vector3& dir, const vector3& pos, const quat& orient, float bias) const {
-			// Find the furthest point in direction.
-			vector3 maxPt = rotatePoint(shapePoints[0], orient) + pos;
-			float maxDist = glm::dot(dir, maxPt);
-			for (auto i = 1u; i < shapePoints.size(); ++i) {
-				const vector3 pt = rotatePoint(shapePoints[i], orient) + pos;
-				const float dist = glm::dot(dir, pt);
-				if (dist > maxDist) {
-					maxDist = dist;
-					maxPt = pt;
+		void ShapeConvex::buildSupportData(const std::vector<ConvexHullTriangle>& hullTriangles) {
+			const uint32 numPoints = (uint32)shapePoints.size();
+			const uint32 numPadded = (numPoints + 3) & ~3u;
+			pointsX.resize(numPadded);
+			pointsY.resize(numPadded);
+			pointsZ.resize(numPadded);
+			for (uint32 i = 0; i < numPadded; ++i) {
+				const vector3& pt = shapePoints[i < numPoints ? i : 0];
+				pointsX[i] = pt.x;
+				pointsY[i] = pt.y;
+				pointsZ[i] = pt.z;
+			}
+
+			// Each edge is shared by two triangles, so collect directed edges and remove duplicates.
+			std::vector<uint64> edges;
+			edges.reserve(hullTriangles.size() * 6);
+			for (const ConvexHullTriangle& tri : hullTriangles) {
+				const uint64 v[3] = { (uint64)tri.a, (uint64)tri.b, (uint64)tri.c };
+				for (uint32 k = 0; k < 3; ++k) {
+					const uint64 p = v[k], q = v[(k + 1) % 3];
+					edges.push_back((p << 32) | q);
+					edges.push_back((q << 32) | p);
 				}
 			}
+			std::sort(edges.begin(), edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+			adjacencyOffsets.assign(numPoints + 1, 0);
+			adjacency.resize(edges.size());
+			for (size_t i = 0; i < edges.size(); ++i) {
+				adjacencyOffsets[(uint32)(edges[i] >> 32) + 1] += 1;
+				adjacency[i] = (uint32)(edges[i] & 0xffffffff);
+			}
+			for (uint32 i = 0; i < numPoints; ++i) {
+				adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+			}
+		}
+
+		vector3 ShapeConvex::support(const vector3& dir, const vector3& pos, const quat& orient, float bias) const {
+			uint32 hint = 0;
+			return support(dir, pos, orient, bias, hint);
+		}
+
+		vector3 ShapeConvex::support(const vector3& dir, const vector3& pos, const quat& orient, float bias, uint32& inOutHint) const {
+			// Find the furthest point in direction. Rotate the direction into shape space
+			// so that hull vertices don't need to be transformed.
+			const vector3 localDir = rotatePoint(dir, glm::conjugate(orient));
+			inOutHint = findSupportVertex(localDir, inOutHint);
+			const vector3 maxPt = rotatePoint(shapePoints[inOutHint], orient) + pos;
+
 			vector3 norm = glm::normalize(dir);
 			norm *= bias;
 
 			return maxPt + norm;
 		}
 
+		uint32 ShapeConvex::findSupportVertex(const vector3& localDir, uint32 hint) const {
+			if (shapePoints.size() > HILL_CLIMB_MIN_VERTICES && adjacency.size() > 0) {
+				return findSupportVertexHillClimb(localDir, hint);
+			}
+			return findSupportVertexLinear(localDir);
+		}
+
+		uint32 ShapeConvex::findSupportVertexLinear(const vector3& localDir) const {
+			const uint32 numPadded = (uint32)pointsX.size();
+			const __m128 dx = _mm_set1_ps(localDir.x);
+			const __m128 dy = _mm_set1_ps(localDir.y);
+			const __m128 dz = _mm_set1_ps(localDir.z);
+			const __m128i four = _mm_set1_epi32(4);
+
+			__m128 maxDist = _mm_set1_ps(-FLT_MAX);
+			__m128i maxIndex = _mm_setzero_si128();
+			__m128i index = _mm_set_epi32(3, 2, 1, 0);
+			for (uint32 i = 0; i < numPadded; i += 4) {
+				const __m128 x = _mm_loadu_ps(pointsX.data() + i);
+				const __m128 y = _mm_loadu_ps(pointsY.data() + i);
+				const __m128 z = _mm_loadu_ps(pointsZ.data() + i);
+				const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, dx), _mm_mul_ps(y, dy)), _mm_mul_ps(z, dz));
+
+				// Keep the first of equal distances, same as a scalar loop.
+				const __m128 greater = _mm_cmpgt_ps(dist, maxDist);
+				maxDist = _mm_or_ps(_mm_and_ps(greater, dist), _mm_andnot_ps(greater, maxDist));
+				const __m128i greaterMask = _mm_castps_si128(greater);
+				maxIndex = _mm_or_si128(_mm_and_si128(greaterMask, index), _mm_andnot_si128(greaterMask, maxIndex));
+				index = _mm_add_epi32(index, four);
+			}
+
+			alignas(16) float dists[4];
+			alignas(16) int32 indices[4];
+			_mm_store_ps(dists, maxDist);
+			_mm_store_si128((__m128i*)indices, maxIndex);
+			uint32 best = 0;
+			for (uint32 lane = 1; lane < 4; ++lane) {
+				if (dists[lane] > dists[best] || (dists[lane] == dists[best] && indices[lane] < indices[best])) {
+					best = lane;
+				}
+			}
+			// Padding copies the first vertex.
+			const uint32 result = (uint32)indices[best];
+			return result < shapePoints.size() ? result : 0;
+		}
+
+		uint32 ShapeConvex::findSupportVertexHillClimb(const vector3& localDir, uint32 hint) const {
+			uint32 current = hint < shapePoints.size() ? hint : 0;
+			float currentDist = glm::dot(localDir, shapePoints[current]);
+			while (true) {
+				uint32 next = current;
+				for (uint32 k = adjacencyOffsets[current]; k < adjacencyOffsets[current + 1]; ++k) {
+					const uint32 neighbor = adjacency[k];
+					const float dist = glm::dot(localDir, shapePoints[neighbor]);
+					if (dist > currentDist) {
+						currentDist = dist;
+						next = neighbor;
+					}
+				}
+				if (next == current) {
+					break;
+				}
+				current = next;
+			}
+			return current;
+		}
+
 		AABB ShapeConvex::getBounds(const vector3& pos, const quat& orient) const {
 			std::vector<vector3> corners = {
 				vector3(bounds.minBounds.x, bounds.minBounds.y, bounds.minBounds.z),
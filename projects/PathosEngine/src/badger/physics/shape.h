@@ -9,6 +9,10 @@
 
 #include <vector>
 
+class JobSystem;
+
+namespace badger { struct ConvexHullTriangle; }
+
 using quat = glm::quat;
 
 namespace badger {
@@ -95,14 +99,29 @@ namespace badger {
 		class ShapeConvex : public Shape {
 
 		public:
-			explicit ShapeConvex(const std::vector<vector3>& points) {
-				build(points);
+			// jobSystem is optional. Used to build the convex hull if given.
+			explicit ShapeConvex(const std::vector<vector3>& points, JobSystem* jobSystem = nullptr) {
+				build(points, jobSystem);
 			}
 
-			void build(const std::vector<vector3>& points) override;
+			void build(const std::vector<vector3>& points) override { build(points, nullptr); }
+			void build(const std::vector<vector3>& points, JobSystem* jobSystem);
 
 			vector3 support(const vector3& dir, const vector3& pos, const quat& orient, float bias) const override;
 
+			// Same as above, but hill climbing starts from 'inOutHint' and it's updated to the support vertex.
+			// Hints of the previous query make the climb only a few steps long.
+			vector3 support(const vector3& dir, const vector3& pos, const quat& orient, float bias, uint32& inOutHint) const;
+
+			// Index of the hull vertex furthest in 'localDir' (in shape space).
+			// Big hulls climb the vertex adjacency from 'hint', small or flat ones test all vertices.
+			uint32 findSupportVertex(const vector3& localDir, uint32 hint) const;
+			// Tests all vertices, 4 at a time.
+			uint32 findSupportVertexLinear(const vector3& localDir) const;
+			// Moves to the best neighbor until no neighbor is further. A local maximum is
+			// the global one on a convex hull.
+			uint32 findSupportVertexHillClimb(const vector3& localDir, uint32 hint) const;
+
 			AABB getBounds(const vector3& pos, const quat& orient) const override;
 			AABB getBounds() const override { return bounds; }
 
@@ -111,11 +130,23 @@ namespace badger {
 
 			float fastestLinearSpeed(const vector3& angularVelocity, const vector3& dir) const override;
 
+			inline const std::vector<vector3>& getPoints() const { return shapePoints; }
+
 		private:
+			void buildSupportData(const std::vector<ConvexHullTriangle>& hullTriangles);
+
 			std::vector<vector3> shapePoints;
 			AABB bounds;
 			matrix3 inertiaTensor;
 
+			// Hull vertices in SoA, padded to a multiple of 4 with copies of the first vertex.
+			std::vector<float> pointsX;
+			std::vector<float> pointsY;
+			std::vector<float> pointsZ;
+			// Neighbors of vertex i are adjacency[adjacencyOffsets[i] .. adjacencyOffsets[i + 1]).
+			std::vector<uint32> adjacencyOffsets;
+			std::vector<uint32> adjacency;
+
 		};
 
 		class Body {
@@ -138,6 +169,7 @@ namespace badger {
 			inline void setPosition(const vector3& inPosition) { position = inPosition; }
 
 			inline quat getOrientation() const { return orientation; }
+			inline void setOrientation(const quat& inOrientation) { orientation = inOrientation; }
 
 			inline float getInvMass() const { return invMass; }
 			inline void setInvMass(float inInvMass) { invMass = inInvMass; }
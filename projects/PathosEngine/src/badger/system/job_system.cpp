@@ -0,0 +1,493 @@
+#include "job_system.h"
+#include "badger/system/cpu.h"
+#include "badger/system/platform.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+
+#if PLATFORM_WINDOWS
+#include <Windows.h>
+#endif
+
+// Number of failed job searches before a worker goes to sleep.
+#define JOB_SYSTEM_SPIN_COUNT 64
+
+static thread_local JobSystem* tls_jobSystem = nullptr;
+static thread_local int32 tls_workerIndex = -1;
+static thread_local uint32 tls_stealSeed = 0x9e3779b9;
+
+static uint32 nextStealVictim()
+{
+	// xorshift32
+	uint32 x = tls_stealSeed;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	tls_stealSeed = x;
+	return x;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// WorkStealingQueue
+
+WorkStealingQueue::WorkStealingQueue()
+	: top(0)
+	, bottom(0)
+{
+	static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY should be power of two");
+	buffer = std::make_unique<std::atomic<Job*>[]>(CAPACITY);
+	for (int64 i = 0; i < CAPACITY; ++i)
+	{
+		buffer[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+bool WorkStealingQueue::push(Job* job)
+{
+	int64 b = bottom.load(std::memory_order_relaxed);
+	int64 t = top.load(std::memory_order_acquire);
+	if (b - t >= CAPACITY)
+	{
+		return false;
+	}
+	buffer[b & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b + 1, std::memory_order_relaxed);
+	return true;
+}
+
+Job* WorkStealingQueue::pop()
+{
+	int64 b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64 t = top.load(std::memory_order_relaxed);
+
+	Job* job = nullptr;
+	if (t <= b)
+	{
+		job = buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+		if (t == b)
+		{
+			// Last item. Race against stealers.
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				job = nullptr;
+			}
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+	}
+	else
+	{
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return job;
+}
+
+Job* WorkStealingQueue::steal()
+{
+	int64 t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64 b = bottom.load(std::memory_order_acquire);
+
+	if (t < b)
+	{
+		Job* job = buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+		return job;
+	}
+	return nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// JobSystem
+
+static void JobWorkerMain(JobSystem* jobSystem, int32 workerIndex)
+{
+	jobSystem->internal_workerMain(workerIndex);
+}
+
+JobSystem::JobSystem()
+	: bActive(false)
+	, bStopping(false)
+	, numQueuedJobs(0)
+	, numSleepingWorkers(0)
+	, nextInbox(0)
+{
+}
+
+JobSystem::~JobSystem()
+{
+	if (isActive())
+	{
+		stop();
+	}
+}
+
+void JobSystem::start(uint32 numWorkerThreads, const wchar_t* inWorkerName)
+{
+	CHECK(!isActive());
+	CHECK(numWorkerThreads > 0 && numWorkerThreads <= 256); // you sure it's not underflowed?
+
+	if (isActive() || numWorkerThreads == 0)
+	{
+		return;
+	}
+
+	numWorkers = numWorkerThreads;
+	workerName = inWorkerName;
+	bStopping.store(false);
+	numQueuedJobs.store(0);
+	numSleepingWorkers.store(0);
+
+	workers.resize(numWorkers);
+	for (uint32 i = 0; i < numWorkers; ++i)
+	{
+		workers[i] = std::make_unique<Worker>();
+	}
+
+	bActive.store(true, std::memory_order_release);
+
+	for (uint32 i = 0; i < numWorkers; ++i)
+	{
+		workers[i]->thread = std::thread(JobWorkerMain, this, (int32)i);
+	}
+}
+
+void JobSystem::stop()
+{
+	CHECK(isActive());
+
+	if (!isActive())
+	{
+		return;
+	}
+
+	bStopping.store(true);
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		sleepCondVar.notify_all();
+	}
+
+	for (uint32 i = 0; i < numWorkers; ++i)
+	{
+		if (workers[i]->thread.joinable())
+		{
+			workers[i]->thread.join();
+		}
+	}
+
+	// Discard pending jobs. Jobs parked on counters are owned by whoever owns the counters.
+	// Counters of discarded jobs are still signaled so that their waiters don't block forever.
+	// It might release parked jobs into the inboxes, so repeat until nothing is left.
+	bool bDiscarded = true;
+	while (bDiscarded)
+	{
+		bDiscarded = false;
+		for (uint32 i = 0; i < numWorkers; ++i)
+		{
+			Worker* worker = workers[i].get();
+			std::deque<Job*> pendingJobs;
+			{
+				std::lock_guard<std::mutex> lock(worker->inboxLock);
+				pendingJobs.swap(worker->inbox);
+			}
+			while (Job* job = worker->queue.steal())
+			{
+				pendingJobs.push_back(job);
+			}
+			for (Job* job : pendingJobs)
+			{
+				discardJob(job);
+				bDiscarded = true;
+			}
+		}
+	}
+
+	workers.clear();
+	numWorkers = 0;
+	bActive.store(false, std::memory_order_release);
+}
+
+void JobSystem::addJob(const JobDesc& desc)
+{
+	CHECK(isActive());
+
+	Job* job = new Job;
+	job->routine = desc.routine;
+	job->arg = desc.arg;
+	job->counter = desc.counter;
+
+	if (desc.counter != nullptr)
+	{
+		desc.counter->value.fetch_add(1);
+	}
+
+	if (desc.dependency != nullptr)
+	{
+		// signalCounter() decrements the counter under this lock,
+		// so a job parked here is always picked up by it.
+		std::lock_guard<std::mutex> lock(desc.dependency->dependentsLock);
+		if (desc.dependency->value.load() != 0)
+		{
+			desc.dependency->dependents.push_back(job);
+			return;
+		}
+	}
+
+	pushRunnableJob(job);
+}
+
+void JobSystem::waitForCounter(JobCounter* counter)
+{
+	CHECK(counter != nullptr);
+
+	const int32 workerIndex = getCurrentWorkerIndex();
+	while (!counter->isDone())
+	{
+		Job* job = isActive() ? findJob(workerIndex) : nullptr;
+		if (job != nullptr)
+		{
+			executeJob(job, workerIndex);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// Wait until the last signalCounter() releases the lock. The caller may destroy the counter after this.
+	std::lock_guard<std::mutex> lock(counter->dependentsLock);
+}
+
+void JobSystem::wakeAllWorkers()
+{
+	if (isActive())
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		sleepCondVar.notify_all();
+	}
+}
+
+int32 JobSystem::getCurrentWorkerIndex() const
+{
+	return (tls_jobSystem == this) ? tls_workerIndex : -1;
+}
+
+uint32 JobSystem::getWorkerThreadId(uint32 workerIndex)
+{
+	CHECK(workerIndex < numWorkers);
+#if PLATFORM_WINDOWS
+	HANDLE handle = workers[workerIndex]->thread.native_handle();
+	DWORD id = GetThreadId(handle);
+	return (uint32)id;
+#else
+	#error "Not implemented"
+#endif
+}
+
+void JobSystem::internal_workerMain(int32 workerIndex)
+{
+	tls_jobSystem = this;
+	tls_workerIndex = workerIndex;
+	tls_stealSeed = 0x9e3779b9 ^ (uint32)(workerIndex * 0x85ebca6b + 1);
+
+	wchar_t threadName[128];
+	swprintf_s(threadName, L"%ls %d", workerName.c_str(), workerIndex);
+	CPU::setCurrentThreadName(threadName);
+
+	int32 spinCount = 0;
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		Job* job = findJob(workerIndex);
+		if (job != nullptr)
+		{
+			executeJob(job, workerIndex);
+			spinCount = 0;
+			continue;
+		}
+
+		if (++spinCount < JOB_SYSTEM_SPIN_COUNT)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		spinCount = 0;
+
+		std::unique_lock<std::mutex> lock(sleepMutex);
+		numSleepingWorkers.fetch_add(1);
+		sleepCondVar.wait(lock, [this]() {
+			return numQueuedJobs.load() > 0 || bStopping.load();
+		});
+		numSleepingWorkers.fetch_sub(1);
+	}
+
+	tls_jobSystem = nullptr;
+	tls_workerIndex = -1;
+}
+
+void JobSystem::pushRunnableJob(Job* job)
+{
+	const int32 workerIndex = getCurrentWorkerIndex();
+
+	bool bPushed = false;
+	if (workerIndex >= 0)
+	{
+		bPushed = workers[workerIndex]->queue.push(job);
+	}
+	if (!bPushed)
+	{
+		// Non-worker thread, or the worker's own queue is full.
+		uint32 inboxIndex = (workerIndex >= 0) ? (uint32)workerIndex : (nextInbox.fetch_add(1, std::memory_order_relaxed) % numWorkers);
+		Worker* worker = workers[inboxIndex].get();
+		std::lock_guard<std::mutex> lock(worker->inboxLock);
+		worker->inbox.push_back(job);
+	}
+
+	// Sleeping workers check numQueuedJobs under sleepMutex, so increment it first.
+	numQueuedJobs.fetch_add(1);
+	if (numSleepingWorkers.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		sleepCondVar.notify_one();
+	}
+}
+
+Job* JobSystem::findJob(int32 workerIndex)
+{
+	Job* job = nullptr;
+
+	// 1. Own queue, then own inbox.
+	if (workerIndex >= 0)
+	{
+		Worker* self = workers[workerIndex].get();
+		job = self->queue.pop();
+		if (job == nullptr)
+		{
+			std::lock_guard<std::mutex> lock(self->inboxLock);
+			if (!self->inbox.empty())
+			{
+				job = self->inbox.front();
+				self->inbox.pop_front();
+			}
+		}
+	}
+
+	// 2. Steal from others, starting at a random victim.
+	if (job == nullptr)
+	{
+		const uint32 start = nextStealVictim() % numWorkers;
+		for (uint32 i = 0; i < numWorkers && job == nullptr; ++i)
+		{
+			const uint32 victimIndex = (start + i) % numWorkers;
+			if ((int32)victimIndex == workerIndex)
+			{
+				continue;
+			}
+			Worker* victim = workers[victimIndex].get();
+			job = victim->queue.steal();
+			if (job == nullptr)
+			{
+				std::unique_lock<std::mutex> lock(victim->inboxLock, std::try_to_lock);
+				if (lock.owns_lock() && !victim->inbox.empty())
+				{
+					job = victim->inbox.front();
+					victim->inbox.pop_front();
+				}
+			}
+		}
+	}
+
+	if (job != nullptr)
+	{
+		numQueuedJobs.fetch_sub(1);
+	}
+	return job;
+}
+
+void JobSystem::executeJob(Job* job, int32 workerIndex)
+{
+	JobParam param;
+	param.workerIndex = workerIndex;
+	param.arg = job->arg;
+
+	job->routine(&param);
+
+	if (job->counter != nullptr)
+	{
+		signalCounter(job->counter);
+	}
+	delete job;
+}
+
+void JobSystem::discardJob(Job* job)
+{
+	if (job->counter != nullptr)
+	{
+		signalCounter(job->counter);
+	}
+	delete job;
+}
+
+void JobSystem::signalCounter(JobCounter* counter)
+{
+	// Decrement under the lock. The counter may be destroyed by its waiter as soon as it reads zero,
+	// and waitForCounter() takes this lock before returning, so the counter is not touched after it's released.
+	std::vector<Job*> readyJobs;
+	{
+		std::lock_guard<std::mutex> lock(counter->dependentsLock);
+		if (counter->value.fetch_sub(1) != 1)
+		{
+			return;
+		}
+		// Counter reached zero. Release jobs that were waiting for it.
+		readyJobs.swap(counter->dependents);
+	}
+	for (Job* job : readyJobs)
+	{
+		pushRunnableJob(job);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// parallelFor
+
+void parallelFor(JobSystem* jobSystem, uint32 count, uint32 batchSize, const std::function<void(uint32 begin, uint32 end)>& body)
+{
+	if (count == 0)
+	{
+		return;
+	}
+	if (batchSize == 0)
+	{
+		batchSize = 1;
+	}
+
+	const uint32 numBatches = (count + batchSize - 1) / batchSize;
+	if (jobSystem == nullptr || !jobSystem->isActive() || numBatches == 1)
+	{
+		body(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	JobDesc desc;
+	desc.counter = &counter;
+	// Batch 0 is run by the calling thread.
+	for (uint32 batch = 1; batch < numBatches; ++batch)
+	{
+		const uint32 begin = batch * batchSize;
+		const uint32 end = std::min(begin + batchSize, count);
+		desc.routine = [&body, begin, end](const JobParam* param) {
+			body(begin, end);
+		};
+		jobSystem->addJob(desc);
+	}
+
+	body(0, std::min(batchSize, count));
+
+	jobSystem->waitForCounter(&counter);
+}
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// Work-stealing job system
+// - Each worker owns a lock-free deque (Chase-Lev). Jobs added by a worker go to
+//   its own deque and idle workers steal from the others.
+// - Jobs added by non-worker threads go to per-worker inboxes in round-robin,
+//   so external producers don't fight over a single lock.
+// - JobCounter tracks completion of a group of jobs. It can be waited on or
+//   used as a dependency of other jobs.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/noncopyable.h"
+
+#include <mutex>
+#include <deque>
+#include <string>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <memory>
+#include <functional>
+#include <condition_variable>
+
+class JobSystem;
+struct JobParam;
+struct Job;
+
+using JobRoutine = std::function<void(const JobParam*)>;
+
+// Passed to the JobRoutine as a sole parameter
+struct JobParam
+{
+	// Index of the worker that runs the job, or -1 if a non-worker thread
+	// runs it while helping in JobSystem::waitForCounter().
+	int32 workerIndex;
+	void* arg;
+};
+
+// Counts unfinished jobs that were added with this counter.
+class JobCounter final : public Noncopyable
+{
+	friend class JobSystem;
+
+public:
+	JobCounter() : value(0) {}
+
+	inline bool isDone() const { return value.load(std::memory_order_acquire) == 0; }
+	inline int32 getValue() const { return value.load(std::memory_order_acquire); }
+
+private:
+	std::atomic<int32> value;
+
+	// Jobs that depend on this counter. Only touched when dependencies are used.
+	std::mutex dependentsLock;
+	std::vector<Job*> dependents;
+};
+
+struct JobDesc
+{
+	JobRoutine routine;
+	void* arg = nullptr;
+
+	// Decremented when the job is finished. Can be null.
+	JobCounter* counter = nullptr;
+
+	// The job won't start until this counter reaches zero. Can be null.
+	JobCounter* dependency = nullptr;
+};
+
+// Internal representation of a queued job.
+struct Job
+{
+	JobRoutine routine;
+	void* arg;
+	JobCounter* counter;
+};
+
+/// <summary>
+/// Lock-free single-owner deque (Chase-Lev).
+/// Only the owner thread can push() and pop() at the bottom. Any thread can steal() from the top.
+/// </summary>
+class WorkStealingQueue final : public Noncopyable
+{
+public:
+	static constexpr int64 CAPACITY = 4096; // Must be power of two
+
+	WorkStealingQueue();
+
+	// Owner only. Returns false if the queue is full.
+	bool push(Job* job);
+
+	// Owner only. LIFO order.
+	Job* pop();
+
+	// Any thread. FIFO order. Returns null if empty or lost the race.
+	Job* steal();
+
+	inline int64 sizeApprox() const
+	{
+		int64 b = bottom.load(std::memory_order_relaxed);
+		int64 t = top.load(std::memory_order_relaxed);
+		return b >= t ? (b - t) : 0;
+	}
+
+private:
+	alignas(64) std::atomic<int64> top;
+	alignas(64) std::atomic<int64> bottom;
+	std::unique_ptr<std::atomic<Job*>[]> buffer;
+};
+
+class JobSystem final : public Noncopyable
+{
+	struct alignas(64) Worker
+	{
+		WorkStealingQueue queue;
+
+		// Jobs added by non-worker threads, or overflow of the queue.
+		std::mutex inboxLock;
+		std::deque<Job*> inbox;
+
+		std::thread thread;
+	};
+
+public:
+	JobSystem();
+	~JobSystem();
+
+	// Create worker threads.
+	void start(uint32 numWorkerThreads, const wchar_t* workerName = L"Job Worker");
+
+	// Discard pending jobs and destroy worker threads. Active jobs are finished first.
+	// Counters of the discarded jobs are decremented as if the jobs were finished.
+	void stop();
+
+	// Add a job. OK to call from any thread once started.
+	void addJob(const JobDesc& desc);
+
+	// [Blocking operation] Waits until the counter reaches zero.
+	// The calling thread executes pending jobs while waiting instead of sleeping.
+	// The counter can be destroyed after this returns, but not after isDone() alone.
+	void waitForCounter(JobCounter* counter);
+
+	void wakeAllWorkers();
+
+	// -1 if the current thread is not a worker of this job system.
+	int32 getCurrentWorkerIndex() const;
+
+	uint32 getWorkerThreadId(uint32 workerIndex);
+
+	inline uint32 getNumWorkers() const { return numWorkers; }
+	inline bool isActive() const { return bActive.load(std::memory_order_acquire); }
+
+	// CAUTION: Do not call directly. This is public just for worker threads.
+	void internal_workerMain(int32 workerIndex);
+
+private:
+	void pushRunnableJob(Job* job);
+	Job* findJob(int32 workerIndex);
+	void executeJob(Job* job, int32 workerIndex);
+	void discardJob(Job* job);
+	void signalCounter(JobCounter* counter);
+
+	std::vector<std::unique_ptr<Worker>> workers;
+	uint32 numWorkers = 0;
+	std::wstring workerName;
+
+	std::atomic<bool> bActive;
+	std::atomic<bool> bStopping;
+
+	// Number of jobs that are runnable but not taken yet.
+	std::atomic<int32> numQueuedJobs;
+	std::atomic<int32> numSleepingWorkers;
+	std::atomic<uint32> nextInbox;
+
+	std::mutex sleepMutex;
+	std::condition_variable sleepCondVar;
+};
+
+/// <summary>
+/// Splits [0, count) into batches of batchSize and runs body(begin, end) for each batch in parallel.
+/// The calling thread runs a batch too and helps until all batches are finished.
+/// Runs serially if jobSystem is null or inactive.
+/// </summary>
+void parallelFor(JobSystem* jobSystem, uint32 count, uint32 batchSize, const std::function<void(uint32 begin, uint32 end)>& body);
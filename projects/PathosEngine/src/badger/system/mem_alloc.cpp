@@ -6,11 +6,24 @@ StackAllocator::StackAllocator(uint32 bytes)
 	current = memblock;
 	totalBytes = bytes;
 	usedBytes = 0;
+	bOwnsMemory = true;
+}
+
+StackAllocator::StackAllocator(void* externalMemory, uint32 bytes)
+{
+	memblock = externalMemory;
+	current = memblock;
+	totalBytes = bytes;
+	usedBytes = 0;
+	bOwnsMemory = false;
 }
 
 StackAllocator::~StackAllocator()
 {
-	::free(memblock);
+	if (bOwnsMemory)
+	{
+		::free(memblock);
+	}
 }
 
 void* StackAllocator::alloc(uint32 bytes)
@@ -22,6 +22,8 @@ class StackAllocator
 {
 public:
 	explicit StackAllocator(uint32 bytes);
+	/// Suballocate a memory block owned by the caller. The block is not freed by this allocator.
+	StackAllocator(void* externalMemory, uint32 bytes);
 	~StackAllocator();
 
 	/// Suballocate the internal memory block. Returns null if the request exceeds the remaining memory.
@@ -32,12 +34,14 @@ public:
 
 	inline uint32 getTotalBytes() const { return totalBytes; }
 	inline uint32 getUsedBytes() const { return usedBytes; }
+	inline uint8* getBaseAddress() const { return reinterpret_cast<uint8*>(memblock); }
 
 private:
 	void* memblock;
 	void* current;
 	uint32 totalBytes;
 	uint32 usedBytes;
+	bool bOwnsMemory;
 };
 
 /// <summary>
@@ -0,0 +1,179 @@
+#include "task_graph.h"
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+
+TaskHandle TaskGraph::addTask(const char* name, ETaskThread thread, TaskRoutine routine, std::initializer_list<TaskHandle> dependencies)
+{
+	const TaskHandle handle = (TaskHandle)tasks.size();
+
+	Task task;
+	task.name = name;
+	task.thread = thread;
+	task.routine = std::move(routine);
+	for (TaskHandle dependency : dependencies)
+	{
+		CHECKF(dependency < handle, "Dependencies should be added before the task");
+		task.dependencies.push_back(dependency);
+		tasks[dependency].dependents.push_back(handle);
+	}
+	tasks.emplace_back(std::move(task));
+
+	return handle;
+}
+
+void TaskGraph::clear()
+{
+	tasks.clear();
+	elapsedMs = 0.0f;
+}
+
+void TaskGraph::execute(JobSystem* jobSystem)
+{
+	const uint32 numTasks = (uint32)tasks.size();
+	if (numTasks == 0)
+	{
+		elapsedMs = 0.0f;
+		return;
+	}
+
+	activeJobSystem = (jobSystem != nullptr && jobSystem->isActive()) ? jobSystem : nullptr;
+	numPendingDependencies = std::make_unique<std::atomic<int32>[]>(numTasks);
+	for (uint32 i = 0; i < numTasks; ++i)
+	{
+		numPendingDependencies[i].store((int32)tasks[i].dependencies.size(), std::memory_order_relaxed);
+		tasks[i].timing = TaskTiming();
+	}
+	mainThreadQueue.clear();
+	numRemainingTasks = numTasks;
+	startTime = std::chrono::steady_clock::now();
+
+	if (activeJobSystem == nullptr)
+	{
+		// Dependencies always have smaller handles, so the order of addTask() is valid.
+		for (uint32 i = 0; i < numTasks; ++i)
+		{
+			runTask(i, -1);
+		}
+	}
+	else
+	{
+		for (uint32 i = 0; i < numTasks; ++i)
+		{
+			if (tasks[i].dependencies.size() == 0)
+			{
+				scheduleTask(i);
+			}
+		}
+
+		// Run main thread tasks as they become runnable, until all tasks are finished.
+		while (true)
+		{
+			TaskHandle task;
+			{
+				std::unique_lock<std::mutex> lock(mainThreadMutex);
+				mainThreadCondVar.wait(lock, [this]() {
+					return mainThreadQueue.size() > 0 || numRemainingTasks == 0;
+				});
+				if (mainThreadQueue.size() == 0)
+				{
+					break;
+				}
+				task = mainThreadQueue.front();
+				mainThreadQueue.pop_front();
+			}
+			runTask(task, -1);
+		}
+	}
+
+	elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	activeJobSystem = nullptr;
+}
+
+void TaskGraph::getCriticalPath(std::vector<TaskHandle>& outPath) const
+{
+	outPath.clear();
+	if (tasks.size() == 0)
+	{
+		return;
+	}
+
+	TaskHandle current = 0;
+	for (TaskHandle i = 1; i < (TaskHandle)tasks.size(); ++i)
+	{
+		if (tasks[i].timing.endMs > tasks[current].timing.endMs)
+		{
+			current = i;
+		}
+	}
+	while (true)
+	{
+		outPath.push_back(current);
+		const std::vector<TaskHandle>& dependencies = tasks[current].dependencies;
+		if (dependencies.size() == 0)
+		{
+			break;
+		}
+		TaskHandle lastFinished = dependencies[0];
+		for (TaskHandle dependency : dependencies)
+		{
+			if (tasks[dependency].timing.endMs > tasks[lastFinished].timing.endMs)
+			{
+				lastFinished = dependency;
+			}
+		}
+		current = lastFinished;
+	}
+	std::reverse(outPath.begin(), outPath.end());
+}
+
+void TaskGraph::scheduleTask(TaskHandle task)
+{
+	if (activeJobSystem == nullptr)
+	{
+		// execute() runs all tasks in order.
+		return;
+	}
+	if (tasks[task].thread == ETaskThread::Any)
+	{
+		JobDesc desc;
+		desc.routine = [this, task](const JobParam* param) {
+			runTask(task, param->workerIndex);
+		};
+		activeJobSystem->addJob(desc);
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(mainThreadMutex);
+		mainThreadQueue.push_back(task);
+		mainThreadCondVar.notify_one();
+	}
+}
+
+void TaskGraph::runTask(TaskHandle task, int32 workerIndex)
+{
+	Task& desc = tasks[task];
+	desc.timing.workerIndex = workerIndex;
+	desc.timing.startMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+	desc.routine();
+
+	desc.timing.endMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+	for (TaskHandle dependent : desc.dependents)
+	{
+		if (numPendingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			scheduleTask(dependent);
+		}
+	}
+
+	// execute() may return as soon as the count reaches zero, so don't touch members after unlocking.
+	std::lock_guard<std::mutex> lock(mainThreadMutex);
+	numRemainingTasks -= 1;
+	if (numRemainingTasks == 0)
+	{
+		mainThreadCondVar.notify_all();
+	}
+}
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// Task graph
+// - Tasks and their dependencies are declared first, then execute() starts
+//   each task as soon as all of its dependencies are finished.
+// - Tasks for ETaskThread::Main run on the thread that calls execute().
+//   Other tasks run on the job system, concurrently with main thread tasks.
+// - Start and end times of tasks are recorded, so the critical path (the chain
+//   of tasks that determined the total time) can be reported.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/noncopyable.h"
+
+#include <mutex>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <condition_variable>
+
+class JobSystem;
+
+using TaskHandle = uint32;
+using TaskRoutine = std::function<void()>;
+
+enum class ETaskThread : uint8
+{
+	Main, // The thread that calls TaskGraph::execute()
+	Any,  // Job system worker
+};
+
+class TaskGraph final : public Noncopyable
+{
+public:
+	struct TaskTiming
+	{
+		// Milliseconds since execute() was called.
+		float startMs = 0.0f;
+		float endMs = 0.0f;
+		// Worker index, or -1 if the task ran on the thread that called execute().
+		int32 workerIndex = -1;
+	};
+
+	// Dependencies should be added before the task, so tasks are always in a valid execution order.
+	// 'name' should outlive the graph (usually a string literal).
+	TaskHandle addTask(const char* name, ETaskThread thread, TaskRoutine routine, std::initializer_list<TaskHandle> dependencies = {});
+
+	// Remove all tasks.
+	void clear();
+
+	// [Blocking operation] Runs all tasks and returns when they are finished.
+	// Runs serially in the order of addTask() if jobSystem is null or inactive.
+	void execute(JobSystem* jobSystem);
+
+	inline uint32 getNumTasks() const { return (uint32)tasks.size(); }
+	inline const char* getTaskName(TaskHandle task) const { return tasks[task].name; }
+	inline ETaskThread getTaskThread(TaskHandle task) const { return tasks[task].thread; }
+	inline const TaskTiming& getTaskTiming(TaskHandle task) const { return tasks[task].timing; }
+
+	// Total time of the last execute().
+	inline float getElapsedMs() const { return elapsedMs; }
+
+	// Tasks of the last execute() from the first to the last, that each one was the last
+	// dependency to finish before the next one could start. Ends with the task that finished last.
+	void getCriticalPath(std::vector<TaskHandle>& outPath) const;
+
+private:
+	struct Task
+	{
+		const char* name;
+		ETaskThread thread;
+		TaskRoutine routine;
+		std::vector<TaskHandle> dependencies;
+		std::vector<TaskHandle> dependents;
+		TaskTiming timing;
+	};
+
+	void scheduleTask(TaskHandle task);
+	void runTask(TaskHandle task, int32 workerIndex);
+
+	std::vector<Task> tasks;
+
+	// Per-execute() state
+	JobSystem* activeJobSystem = nullptr;
+	std::unique_ptr<std::atomic<int32>[]> numPendingDependencies;
+	std::chrono::steady_clock::time_point startTime;
+	float elapsedMs = 0.0f;
+
+	// Runnable main thread tasks and the number of unfinished tasks, guarded by mainThreadMutex.
+	std::mutex mainThreadMutex;
+	std::condition_variable mainThreadCondVar;
+	std::deque<TaskHandle> mainThreadQueue;
+	uint32 numRemainingTasks = 0;
+};
@@ -0,0 +1,182 @@
+#include "skeletal_animation.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace pathos {
+
+	static std::atomic<uint32> nextAnimationClipID(0);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skeleton
+
+	int32 Skeleton::addJoint(const std::string& name, int32 parent, const matrix4& localTransform, const matrix4& inverseBindMatrix) {
+		CHECKF(parent == NO_PARENT || (parent >= 0 && parent < (int32)parents.size()), "Parent should be added first");
+		names.push_back(name);
+		parents.push_back(parent);
+		localTransforms.push_back(localTransform);
+		inverseBindMatrices.push_back(inverseBindMatrix);
+		return (int32)parents.size() - 1;
+	}
+
+	void Skeleton::setInverseBindMatrix(int32 joint, const matrix4& inverseBindMatrix) {
+		inverseBindMatrices[joint] = inverseBindMatrix;
+	}
+
+	int32 Skeleton::findJoint(const std::string& name) const {
+		for (size_t i = 0; i < names.size(); ++i) {
+			if (names[i] == name) {
+				return (int32)i;
+			}
+		}
+		return NO_PARENT;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// AnimationClip
+
+	AnimationClip::AnimationClip(const std::string& inName, float inDuration)
+		: name(inName)
+		, duration(inDuration)
+		, clipID(nextAnimationClipID.fetch_add(1))
+	{
+	}
+
+	AnimationTrack& AnimationClip::addTrack(int32 joint) {
+		// Poses that sampled this clip have key cursors for fewer tracks.
+		clipID = nextAnimationClipID.fetch_add(1);
+		tracks.emplace_back();
+		tracks.back().joint = joint;
+		return tracks.back();
+	}
+
+	uint32 AnimationClip::findKey(const float* times, uint32 numKeys, float time, uint32& cursor) {
+		if (numKeys <= 2) {
+			cursor = 0;
+			return 0;
+		}
+		const uint32 lastInterval = numKeys - 2;
+		if (cursor <= lastInterval) {
+			// Same interval as the last query, or the next one.
+			if (times[cursor] <= time && (cursor == lastInterval || time < times[cursor + 1])) {
+				return cursor;
+			}
+			if (cursor < lastInterval && times[cursor + 1] <= time && (cursor + 1 == lastInterval || time < times[cursor + 2])) {
+				return ++cursor;
+			}
+		}
+		// First key greater than the time, then one step back.
+		const float* it = std::upper_bound(times, times + numKeys, time);
+		const uint32 upper = (uint32)(it - times);
+		cursor = std::min(upper == 0 ? 0 : upper - 1, lastInterval);
+		return cursor;
+	}
+
+	static vector3 blendKeys(const vector3& a, const vector3& b, float ratio) {
+		return glm::mix(a, b, ratio);
+	}
+	static glm::quat blendKeys(const glm::quat& a, const glm::quat& b, float ratio) {
+		return glm::normalize(glm::slerp(a, b, ratio));
+	}
+
+	template<typename T>
+	static T sampleKeys(const AnimationKeys<T>& keys, float time, uint32& cursor) {
+		const uint32 numKeys = keys.size();
+		if (numKeys == 1) {
+			return keys.values[0];
+		}
+		const uint32 i = AnimationClip::findKey(keys.times.data(), numKeys, time, cursor);
+		const float t0 = keys.times[i], t1 = keys.times[i + 1];
+		const float ratio = (t1 > t0) ? glm::clamp((time - t0) / (t1 - t0), 0.0f, 1.0f) : 0.0f;
+		return blendKeys(keys.values[i], keys.values[i + 1], ratio);
+	}
+
+	// Rotation part of a TRS matrix whose axis lengths are S.
+	// An axis with zero scale has no direction, so it's rebuilt from the other two.
+	static glm::quat extractRotation(const matrix4& m, const vector3& S) {
+		constexpr float MIN_SCALE = 1e-8f;
+		const bool bX = S.x > MIN_SCALE, bY = S.y > MIN_SCALE, bZ = S.z > MIN_SCALE;
+		if ((int32)bX + (int32)bY + (int32)bZ < 2) {
+			return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		}
+		vector3 X = bX ? vector3(m[0]) / S.x : vector3(0.0f);
+		vector3 Y = bY ? vector3(m[1]) / S.y : vector3(0.0f);
+		vector3 Z = bZ ? vector3(m[2]) / S.z : vector3(0.0f);
+		if (!bX) X = glm::cross(Y, Z);
+		if (!bY) Y = glm::cross(Z, X);
+		if (!bZ) Z = glm::cross(X, Y);
+		return glm::quat_cast(matrix3(X, Y, Z));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// AnimationPose
+
+	void AnimationPose::initialize(const Skeleton* inSkeleton) {
+		CHECK(inSkeleton != nullptr);
+		skeleton = inSkeleton;
+		const uint32 numJoints = skeleton->getNumJoints();
+		localTransforms.resize(numJoints);
+		globalTransforms.resize(numJoints);
+		palette.resize(numJoints);
+		for (uint32 i = 0; i < numJoints; ++i) {
+			localTransforms[i] = skeleton->getLocalTransform(i);
+		}
+		cursorClipID = INVALID_CLIP_ID;
+	}
+
+	void AnimationPose::sample(const AnimationClip& clip, float time) {
+		CHECK(skeleton != nullptr);
+		time = glm::clamp(time, 0.0f, clip.getDuration());
+
+		if (cursorClipID != clip.getClipID()) {
+			cursorClipID = clip.getClipID();
+			keyCursors.assign(clip.getNumTracks() * 3, 0);
+		}
+
+		const uint32 numJoints = skeleton->getNumJoints();
+		for (uint32 i = 0; i < numJoints; ++i) {
+			localTransforms[i] = skeleton->getLocalTransform(i);
+		}
+
+		for (uint32 trackIx = 0; trackIx < clip.getNumTracks(); ++trackIx) {
+			const AnimationTrack& track = clip.getTrack(trackIx);
+			if (track.joint < 0 || track.joint >= (int32)numJoints) {
+				continue;
+			}
+			uint32* cursors = keyCursors.data() + trackIx * 3;
+			matrix4& local = localTransforms[track.joint];
+
+			// Channels without keys keep the corresponding part of the skeleton's local transform.
+			// Assumes the local transform has no shear, as is the case for transforms built from TRS.
+			vector3 T(local[3]);
+			vector3 S(glm::length(vector3(local[0])), glm::length(vector3(local[1])), glm::length(vector3(local[2])));
+			glm::quat R;
+			if (track.rotation.size() > 0) {
+				R = sampleKeys(track.rotation, time, cursors[1]);
+			} else {
+				R = extractRotation(local, S);
+			}
+			if (track.translation.size() > 0) T = sampleKeys(track.translation, time, cursors[0]);
+			if (track.scale.size() > 0) S = sampleKeys(track.scale, time, cursors[2]);
+
+			// T * R * S without full matrix products.
+			const matrix3 rotation = glm::mat3_cast(R);
+			local[0] = vector4(rotation[0] * S.x, 0.0f);
+			local[1] = vector4(rotation[1] * S.y, 0.0f);
+			local[2] = vector4(rotation[2] * S.z, 0.0f);
+			local[3] = vector4(T, 1.0f);
+		}
+	}
+
+	void AnimationPose::updatePalette() {
+		CHECK(skeleton != nullptr);
+		const uint32 numJoints = skeleton->getNumJoints();
+		for (uint32 i = 0; i < numJoints; ++i) {
+			const int32 parent = skeleton->getParent(i);
+			globalTransforms[i] = (parent == Skeleton::NO_PARENT) ? localTransforms[i] : (globalTransforms[parent] * localTransforms[i]);
+			palette[i] = globalTransforms[i] * skeleton->getInverseBindMatrix(i);
+		}
+	}
+
+}
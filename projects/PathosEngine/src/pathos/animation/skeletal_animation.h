@@ -0,0 +1,125 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+#include "badger/types/matrix_types.h"
+
+#include <glm/gtc/quaternion.hpp>
+#include <vector>
+#include <string>
+
+// Runtime data for skeletal animation. Independent of any file format;
+// loaders convert their scene graphs and keyframes into these.
+
+namespace pathos {
+
+	/// Joint hierarchy. Joints are stored parent-first (a parent's index is always smaller than its children's),
+	/// so global transforms are computed in one linear pass without recursion.
+	class Skeleton {
+
+	public:
+		static constexpr int32 NO_PARENT = -1;
+
+		/// @param parent NO_PARENT or an index returned by a previous call.
+		/// @param localTransform Transform relative to the parent when no track animates the joint.
+		/// @param inverseBindMatrix Mesh space to joint space in the bind pose. Identity for joints without vertices.
+		/// @return Index of the new joint.
+		int32 addJoint(const std::string& name, int32 parent, const matrix4& localTransform, const matrix4& inverseBindMatrix = matrix4(1.0f));
+
+		void setInverseBindMatrix(int32 joint, const matrix4& inverseBindMatrix);
+
+		/// @return NO_PARENT if not found.
+		int32 findJoint(const std::string& name) const;
+
+		inline uint32 getNumJoints() const { return (uint32)parents.size(); }
+		inline int32 getParent(int32 joint) const { return parents[joint]; }
+		inline const std::string& getJointName(int32 joint) const { return names[joint]; }
+		inline const matrix4& getLocalTransform(int32 joint) const { return localTransforms[joint]; }
+		inline const matrix4& getInverseBindMatrix(int32 joint) const { return inverseBindMatrices[joint]; }
+
+	private:
+		std::vector<std::string> names;
+		std::vector<int32> parents;
+		std::vector<matrix4> localTransforms;
+		std::vector<matrix4> inverseBindMatrices;
+	};
+
+	/// Keyframes of one channel. times are ascending and have the same length as values.
+	template<typename T>
+	struct AnimationKeys {
+		std::vector<float> times;
+		std::vector<T> values;
+
+		inline uint32 size() const { return (uint32)times.size(); }
+		inline void add(float time, const T& value) { times.push_back(time); values.push_back(value); }
+	};
+
+	/// Local transform of a joint over time. A channel without keys keeps the skeleton's local transform.
+	struct AnimationTrack {
+		int32 joint;
+		AnimationKeys<vector3> translation;
+		AnimationKeys<glm::quat> rotation;
+		AnimationKeys<vector3> scale;
+	};
+
+	class AnimationClip {
+
+	public:
+		AnimationClip(const std::string& inName, float inDuration);
+
+		/// @return The new track, to which keys are added.
+		AnimationTrack& addTrack(int32 joint);
+
+		/// Never shared with another clip, even one at the same address. Changes when a track is added.
+		inline uint32 getClipID() const { return clipID; }
+		inline const std::string& getName() const { return name; }
+		inline float getDuration() const { return duration; }
+		inline uint32 getNumTracks() const { return (uint32)tracks.size(); }
+		inline const AnimationTrack& getTrack(uint32 index) const { return tracks[index]; }
+
+		/// Index i of the key interval that contains the time, i.e., times[i] <= time < times[i + 1].
+		/// Clamped to [0, numKeys - 2] (0 if there is only one key).
+		/// cursor is the result of the previous query. It's checked first, then the next interval,
+		/// and then binary search is used, so playback in either direction is O(1) amortized.
+		static uint32 findKey(const float* times, uint32 numKeys, float time, uint32& cursor);
+
+	private:
+		std::string name;
+		float duration;
+		uint32 clipID;
+		std::vector<AnimationTrack> tracks;
+	};
+
+	/// Evaluated pose of a skeleton. Buffers are allocated once in initialize(),
+	/// so sampling and palette updates don't allocate memory.
+	class AnimationPose {
+
+		static constexpr uint32 INVALID_CLIP_ID = 0xffffffff;
+
+	public:
+		void initialize(const Skeleton* inSkeleton);
+
+		/// Resets every joint to the skeleton's local transform, then samples the clip at the time (clamped to the duration).
+		void sample(const AnimationClip& clip, float time);
+
+		/// Computes global transforms and the skinning palette (global * inverse bind) from local transforms.
+		void updatePalette();
+
+		inline uint32 getNumJoints() const { return (uint32)localTransforms.size(); }
+		inline matrix4* getLocalTransforms() { return localTransforms.data(); }
+		inline const matrix4* getGlobalTransforms() const { return globalTransforms.data(); }
+		/// Flat array of getNumJoints() matrices, indexed by joint.
+		inline const matrix4* getPalette() const { return palette.data(); }
+
+	private:
+		const Skeleton* skeleton = nullptr;
+		std::vector<matrix4> localTransforms;
+		std::vector<matrix4> globalTransforms;
+		std::vector<matrix4> palette;
+
+		// Key cursors of the last sampled clip, 3 per track (translation, rotation, scale).
+		uint32 cursorClipID = INVALID_CLIP_ID;
+		std::vector<uint32> keyCursors;
+	};
+
+}
@@ -0,0 +1,177 @@
+#include "skinning.h"
+#include "pathos/util/cpu_profiler.h"
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
+
+#include <emmintrin.h> // SSE2 is always available on x64.
+#include <algorithm>
+#include <cmath>
+
+// Vertices per job. Large enough to amortize scheduling, small enough to balance dozens of meshes.
+static constexpr uint32 SKINNING_BATCH_VERTICES = 2048;
+
+static constexpr float WEIGHT_SCALE = 1.0f / 65535.0f;
+
+namespace pathos {
+
+	void SoftwareSkinning::initialize(uint32 inNumVertices, const float* bindPositions, const float* bindNormals) {
+		CHECK(bindPositions != nullptr);
+		numVertices = inNumVertices;
+		maxJoint = 0;
+		hasNormals = (bindNormals != nullptr);
+
+		bindPositions4.resize(numVertices);
+		for (uint32 i = 0; i < numVertices; ++i) {
+			bindPositions4[i] = vector4(bindPositions[i * 3], bindPositions[i * 3 + 1], bindPositions[i * 3 + 2], 1.0f);
+		}
+		positions.assign(bindPositions, bindPositions + numVertices * 3);
+
+		if (hasNormals) {
+			bindNormals4.resize(numVertices);
+			for (uint32 i = 0; i < numVertices; ++i) {
+				bindNormals4[i] = vector4(bindNormals[i * 3], bindNormals[i * 3 + 1], bindNormals[i * 3 + 2], 0.0f);
+			}
+			normals.assign(bindNormals, bindNormals + numVertices * 3);
+		} else {
+			bindNormals4.clear();
+			normals.clear();
+		}
+
+		influences.assign(numVertices, Influence{});
+		pendingWeights.assign(numVertices * MAX_INFLUENCES, 0.0f);
+	}
+
+	void SoftwareSkinning::addInfluence(uint32 vertex, uint32 joint, float weight) {
+		CHECK(vertex < numVertices && joint <= 0xffff);
+		CHECKF(pendingWeights.size() > 0, "Influences can't be added after normalizeWeights()");
+		Influence& influence = influences[vertex];
+		float* weights = pendingWeights.data() + vertex * MAX_INFLUENCES;
+		// Replace the smallest weight if the new one is larger.
+		uint32 slot = 0;
+		for (uint32 i = 1; i < MAX_INFLUENCES; ++i) {
+			if (weights[i] < weights[slot]) {
+				slot = i;
+			}
+		}
+		if (weight > weights[slot]) {
+			influence.joints[slot] = (uint16)joint;
+			weights[slot] = weight;
+		}
+	}
+
+	void SoftwareSkinning::normalizeWeights() {
+		maxJoint = 0;
+		for (uint32 v = 0; v < (uint32)influences.size() && pendingWeights.size() > 0; ++v) {
+			Influence& influence = influences[v];
+			float* weights = pendingWeights.data() + v * MAX_INFLUENCES;
+
+			// Sort by weight in descending order, so that skinning stops at the first zero weight.
+			for (uint32 i = 1; i < MAX_INFLUENCES; ++i) {
+				for (uint32 j = i; j > 0 && weights[j] > weights[j - 1]; --j) {
+					std::swap(weights[j], weights[j - 1]);
+					std::swap(influence.joints[j], influence.joints[j - 1]);
+				}
+			}
+			float sum = 0.0f;
+			for (uint32 i = 0; i < MAX_INFLUENCES; ++i) {
+				sum += weights[i];
+			}
+			// A zero weight in the first slot marks an unskinned vertex.
+			int32 quantizedSum = 0;
+			for (uint32 i = 0; i < MAX_INFLUENCES; ++i) {
+				const float normalized = (sum > 0.0f) ? (weights[i] / sum) : 0.0f;
+				influence.weights[i] = (uint16)std::lround(normalized * 65535.0f);
+				quantizedSum += influence.weights[i];
+			}
+			if (quantizedSum > 0) {
+				// Rounding error goes to the largest weight, so that weights sum to exactly 1.
+				influence.weights[0] = (uint16)((int32)influence.weights[0] + (65535 - quantizedSum));
+			}
+			for (uint32 i = 0; i < MAX_INFLUENCES; ++i) {
+				if (influence.weights[i] > 0) {
+					maxJoint = std::max(maxJoint, (uint32)influence.joints[i]);
+				} else {
+					influence.joints[i] = 0;
+				}
+			}
+		}
+		pendingWeights.clear();
+		pendingWeights.shrink_to_fit();
+	}
+
+	void SoftwareSkinning::skin(JobSystem* jobSystem, const matrix4* palette, uint32 numJoints) {
+		SCOPED_CPU_COUNTER(SoftwareSkinning);
+		CHECKF(numVertices == 0 || maxJoint < numJoints, "Palette is smaller than the joints referenced by influences");
+
+		parallelFor(jobSystem, numVertices, SKINNING_BATCH_VERTICES, [this, palette](uint32 begin, uint32 end) {
+			skinRange(palette, begin, end);
+		});
+	}
+
+	void SoftwareSkinning::skinRange(const matrix4* palette, uint32 begin, uint32 end) {
+		// glm matrices are column-major, so each column is loaded as a vector.
+		const float* paletteFloats = reinterpret_cast<const float*>(palette);
+
+		for (uint32 v = begin; v < end; ++v) {
+			const Influence& influence = influences[v];
+			const float* srcPosition = &bindPositions4[v].x;
+			float* dstPosition = positions.data() + v * 3;
+
+			if (influence.weights[0] == 0) {
+				dstPosition[0] = srcPosition[0];
+				dstPosition[1] = srcPosition[1];
+				dstPosition[2] = srcPosition[2];
+				if (hasNormals) {
+					std::copy_n(&bindNormals4[v].x, 3, normals.data() + v * 3);
+				}
+				continue;
+			}
+
+			// Blend the matrices first, then transform once. Weights are sorted and the first one is never zero.
+			const float* m = paletteFloats + influence.joints[0] * 16;
+			__m128 w = _mm_set1_ps(influence.weights[0] * WEIGHT_SCALE);
+			__m128 c0 = _mm_mul_ps(w, _mm_loadu_ps(m + 0));
+			__m128 c1 = _mm_mul_ps(w, _mm_loadu_ps(m + 4));
+			__m128 c2 = _mm_mul_ps(w, _mm_loadu_ps(m + 8));
+			__m128 c3 = _mm_mul_ps(w, _mm_loadu_ps(m + 12));
+			for (uint32 i = 1; i < MAX_INFLUENCES && influence.weights[i] > 0; ++i) {
+				m = paletteFloats + influence.joints[i] * 16;
+				w = _mm_set1_ps(influence.weights[i] * WEIGHT_SCALE);
+				c0 = _mm_add_ps(c0, _mm_mul_ps(w, _mm_loadu_ps(m + 0)));
+				c1 = _mm_add_ps(c1, _mm_mul_ps(w, _mm_loadu_ps(m + 4)));
+				c2 = _mm_add_ps(c2, _mm_mul_ps(w, _mm_loadu_ps(m + 8)));
+				c3 = _mm_add_ps(c3, _mm_mul_ps(w, _mm_loadu_ps(m + 12)));
+			}
+
+			const __m128 p = _mm_loadu_ps(srcPosition);
+			__m128 result = _mm_mul_ps(c0, _mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)));
+			result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1))));
+			result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2))));
+			result = _mm_add_ps(result, c3);
+			// Store xyz only; a 4-wide store would race with the first vertex of the next batch.
+			_mm_storel_pi(reinterpret_cast<__m64*>(dstPosition), result);
+			_mm_store_ss(dstPosition + 2, _mm_movehl_ps(result, result));
+
+			if (hasNormals) {
+				const __m128 n = _mm_loadu_ps(&bindNormals4[v].x);
+				__m128 normal = _mm_mul_ps(c0, _mm_shuffle_ps(n, n, _MM_SHUFFLE(0, 0, 0, 0)));
+				normal = _mm_add_ps(normal, _mm_mul_ps(c1, _mm_shuffle_ps(n, n, _MM_SHUFFLE(1, 1, 1, 1))));
+				normal = _mm_add_ps(normal, _mm_mul_ps(c2, _mm_shuffle_ps(n, n, _MM_SHUFFLE(2, 2, 2, 2))));
+				// Renormalize; blended matrices are not orthonormal.
+				// Approximate reciprocal square root, refined by a Newton-Raphson step.
+				const __m128 sq = _mm_mul_ps(normal, normal);
+				__m128 lengthSq = _mm_add_ss(_mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(sq, sq));
+				lengthSq = _mm_max_ss(lengthSq, _mm_set_ss(1e-20f));
+				lengthSq = _mm_shuffle_ps(lengthSq, lengthSq, _MM_SHUFFLE(0, 0, 0, 0));
+				__m128 invLength = _mm_rsqrt_ps(lengthSq);
+				invLength = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), invLength),
+					_mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_mul_ps(lengthSq, invLength), invLength)));
+				normal = _mm_mul_ps(normal, invLength);
+				float* dstNormal = normals.data() + v * 3;
+				_mm_storel_pi(reinterpret_cast<__m64*>(dstNormal), normal);
+				_mm_store_ss(dstNormal + 2, _mm_movehl_ps(normal, normal));
+			}
+		}
+	}
+
+}
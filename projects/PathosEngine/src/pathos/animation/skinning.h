@@ -0,0 +1,66 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+#include "badger/types/matrix_types.h"
+
+#include <vector>
+
+class JobSystem;
+
+namespace pathos {
+
+	/// Linear blend skinning on CPU.
+	/// Bind pose data and output buffers are allocated once in initialize(),
+	/// and skin() transforms vertices with SSE in batches split across the job system.
+	class SoftwareSkinning {
+
+	public:
+		static constexpr uint32 MAX_INFLUENCES = 4;
+
+		/// @param bindPositions numVertices * 3 floats.
+		/// @param bindNormals numVertices * 3 floats, or nullptr to skin positions only.
+		void initialize(uint32 numVertices, const float* bindPositions, const float* bindNormals = nullptr);
+
+		/// Only the MAX_INFLUENCES largest weights of a vertex are kept. joint should be less than 65536.
+		void addInfluence(uint32 vertex, uint32 joint, float weight);
+
+		/// Call after every influence is added. Weights of each vertex are rescaled to sum to 1
+		/// and stored as 16-bit unorm. Vertices without influences keep their bind pose.
+		void normalizeWeights();
+
+		/// @param palette Skinning matrices indexed by joint. See AnimationPose::getPalette().
+		/// Normals are transformed by the same matrices, so joints are assumed to have uniform scale.
+		void skin(JobSystem* jobSystem, const matrix4* palette, uint32 numJoints);
+
+		inline uint32 getNumVertices() const { return numVertices; }
+		/// numVertices * 3 floats, ready for MeshGeometry::updatePositionData().
+		inline const float* getPositions() const { return positions.data(); }
+		/// nullptr if bind normals were not given.
+		inline const float* getNormals() const { return hasNormals ? normals.data() : nullptr; }
+
+	private:
+		// 16 bytes per vertex. Skinning is mostly bound by memory bandwidth for large meshes.
+		struct Influence {
+			uint16 joints[MAX_INFLUENCES];
+			uint16 weights[MAX_INFLUENCES]; // unorm16, sorted in descending order
+		};
+
+		void skinRange(const matrix4* palette, uint32 begin, uint32 end);
+
+		uint32 numVertices = 0;
+		uint32 maxJoint = 0;
+		bool hasNormals = false;
+
+		// Bind pose as (x, y, z, 1) and (x, y, z, 0), so that SSE loads a whole vertex.
+		std::vector<vector4> bindPositions4;
+		std::vector<vector4> bindNormals4;
+		std::vector<Influence> influences;
+		std::vector<float> pendingWeights; // Full precision weights until normalizeWeights()
+
+		// Skinned output, tightly packed.
+		std::vector<float> positions;
+		std::vector<float> normals;
+	};
+
+}
@@ -74,13 +74,13 @@ namespace pathos {
 		return initialized;
 	}
 
-	void ConsoleWindow::renderConsoleWindow(RenderCommandList& cmdList, DisplayObject2DProxy* rootProxy) {
+	void ConsoleWindow::renderConsoleWindow(RenderCommandList& cmdList, const OverlayDrawList& drawList) {
 		CHECK(initialized);
 		if (visible) {
 			windowWidth = gEngine->getConfig().windowWidth;
 			background->setSize(windowWidth, windowHeight);
 
-			renderer->renderOverlay(cmdList, rootProxy);
+			renderer->renderOverlay(cmdList, drawList);
 		}
 	}
 
@@ -15,7 +15,7 @@ namespace pathos {
 
 	class OverlayRenderer;
 	class DisplayObject2D;
-	class DisplayObject2DProxy;
+	class OverlayDrawList;
 	class Rectangle;
 	class Label;
 
@@ -28,7 +28,7 @@ namespace pathos {
 
 		bool initialize(uint16 width, uint16 height);
 
-		void renderConsoleWindow(RenderCommandList& cmdList, DisplayObject2DProxy* rootProxy);
+		void renderConsoleWindow(RenderCommandList& cmdList, const OverlayDrawList& drawList);
 		void toggle();
 
 		bool isVisible() const;
@@ -190,7 +190,7 @@ namespace pathos {
 		root->addChild(gpuCounterList);
 	}
 
-	void DebugOverlay::renderDebugOverlay(RenderCommandList& cmdList, DisplayObject2DProxy* rootProxy, int32 screenWidth, int32 screenHeight) {
+	void DebugOverlay::updateDebugOverlay(int32 screenWidth, int32 screenHeight) {
 		if (!bEnabled) {
 			return;
 		}
@@ -276,8 +276,13 @@ namespace pathos {
 				gpuCounterList->updateGPUStat(gpuCounterNames, gpuCounterTimes);
 			}
 		}
+	}
 
-		renderer->renderOverlay(cmdList, rootProxy);
+	void DebugOverlay::renderDebugOverlay(RenderCommandList& cmdList, const OverlayDrawList& drawList) {
+		if (!bEnabled) {
+			return;
+		}
+		renderer->renderOverlay(cmdList, drawList);
 	}
 
 }
@@ -10,7 +10,7 @@ namespace pathos {
 
 	class OverlayRenderer;
 	class DisplayObject2D;
-	class DisplayObject2DProxy;
+	class OverlayDrawList;
 	class Label;
 	class Rectangle;
 
@@ -26,7 +26,11 @@ namespace pathos {
 
 		void initialize();
 
-		void renderDebugOverlay(RenderCommandList& cmdList, DisplayObject2DProxy* rootProxy, int32 screenWidth, int32 screenHeight);
+		// Updates the stat labels. Called in the CreateOverlayProxy task before the display objects are read.
+		void updateDebugOverlay(int32 screenWidth, int32 screenHeight);
+
+		// Render thread only draws the snapshot of the display objects.
+		void renderDebugOverlay(RenderCommandList& cmdList, const OverlayDrawList& drawList);
 		
 		inline void toggleEnabled() { bEnabled = !bEnabled; }
 		inline void setEnabled(bool bValue) { bEnabled = bValue; }
@@ -16,6 +16,8 @@
 #include "pathos/util/resource_finder.h"
 #include "pathos/util/renderdoc_integration.h"
 
+#include "badger/math/minmax.h"
+
 #include "pathos/scene/world.h"
 #include "pathos/scene/scene.h"
 #include "pathos/scene/reflection_probe_actor.h"
@@ -30,6 +32,7 @@
 #include "pathos/loader/asset_streamer.h" // subsystem: asset streamer
 
 #include <inttypes.h>
+#include <algorithm>
 
 #define CONSOLE_WINDOW_MIN_HEIGHT    400
 #define ENGINE_CONFIG_FILE           "EngineConfig.ini"
@@ -44,6 +47,8 @@ namespace pathos {
 	//        and the world will look like frozen.
 	static ConsoleVariable<int32> maxFPS("t.maxFPS", 1000, "Limit max framerate (0 = no limit)");
 
+	static ConsoleVariable<int32> cvarFramesInFlight("t.framesInFlight", 2, "Frames that are simulated or rendered at once, including the one in the game thread (2 ~ 4)");
+
 	Engine*        gEngine  = nullptr;
 	ConsoleWindow* gConsole = nullptr;
 
@@ -130,6 +135,7 @@ namespace pathos {
 		// Subsystems that does not depend on the render thread.
 		BailIfFalse( initializeInput()                         );
 		BailIfFalse( initializeAssetStreamer()                 );
+		BailIfFalse( initializeJobSystem()                     );
 		BailIfFalse( initializeImageLibrary()                  );
 		// Launch the render thread and initialize remaining subsystems that require GL context.
 		renderThread->run();
@@ -145,6 +151,9 @@ namespace pathos {
 			registerConsoleCommand("stat", [](const std::string& command) {
 				gEngine->toggleFrameStat();
 			});
+			registerConsoleCommand("profile_frame_graph", [](const std::string& command) {
+				gEngine->dumpFrameGraph();
+			});
 			registerConsoleCommand("set_window_size", [](const std::string& command) {
 				char unused[16];
 				int w, h;
@@ -199,6 +208,7 @@ namespace pathos {
 		createParams.height            = conf.windowHeight;
 		createParams.fullscreen        = conf.fullscreen;
 		createParams.title             = conf.title;
+		createParams.headless          = conf.headless;
 
 		createParams.glMajorVersion    = REQUIRED_GL_MAJOR_VERSION;
 		createParams.glMinorVersion    = REQUIRED_GL_MINOR_VERSION;
@@ -233,6 +243,25 @@ namespace pathos {
 		return true;
 	}
 
+	bool Engine::initializeJobSystem() {
+		uint32 numWorkers = conf.numWorkersForJobSystem;
+		if (numWorkers == 0) {
+			// Leave room for the main thread and the render thread.
+			const uint32 numCores = CPU::getTotalLogicalCoreCount();
+			numWorkers = numCores > 3 ? (numCores - 2) : 1;
+		}
+
+		jobSystem = makeUnique<JobSystem>();
+		jobSystem->start(numWorkers, L"Job Worker");
+		for (uint32 i = 0; i < numWorkers; ++i) {
+			std::string workerName = "Job_Worker " + std::to_string(i);
+			CpuProfiler::getInstance().registerThread(jobSystem->getWorkerThreadId(i), workerName.c_str());
+		}
+
+		LOG(LogInfo, "Initialize job system (%u workers)", numWorkers);
+		return true;
+	}
+
 	bool Engine::initializeImageLibrary() {
 		pathos::initializeImageLibrary();
 		return true;
@@ -455,11 +484,14 @@ namespace pathos {
 	}
 
 	void Engine::internal_pushScreenshot(Screenshot screenshot) {
+		std::lock_guard<std::mutex> lockGuard(screenshotQueueMutex);
 		screenshotQueue.emplace_back(screenshot);
 	}
 
 	void Engine::tickMainThread() {
-		if (frameFence->getValue() + 2 < frameNumber_mainThread) {
+		// Frame N can't start until frame (N - framesInFlight) is rendered.
+		const uint32 numFramesInFlight = (uint32)badger::clamp(2, cvarFramesInFlight.getValue(), 4);
+		if (frameFence->getValue() + numFramesInFlight < frameNumber_mainThread) {
 			return;
 		}
 
@@ -494,6 +526,9 @@ namespace pathos {
 				}
 			}
 
+			// Handlers of the old world must not be invoked after it's destroyed.
+			assetStreamer->cancelAllRequests();
+
 			if (currentWorld != nullptr) {
 				currentWorld->destroy();
 				delete currentWorld;
@@ -503,7 +538,6 @@ namespace pathos {
 
 			pendingNewWorld = nullptr;
 
-			// #todo-asset-streamer: Pending works for old world should be cancelled.
 			assetStreamer->wakeThreadPool();
 		}
 
@@ -512,94 +546,124 @@ namespace pathos {
 		{
 			SCOPED_CPU_COUNTER(WorldTick);
 
-			{
+			// Game code is not thread-safe, so tasks that touch the world stay on the main thread.
+			// Overlay proxies and screenshots are built by workers, overlapped with the rest of the frame.
+			frameGraph.clear();
+
+			const TaskHandle inputTask = frameGraph.addTask("InputTick", ETaskThread::Main, [this]() {
 				SCOPED_CPU_COUNTER(InputTick);
 				inputSystem->tick();
-			}
+			});
 
-			{
+			const TaskHandle flushAssetsTask = frameGraph.addTask("FlushLoadedAssets", ETaskThread::Main, [this]() {
 				SCOPED_CPU_COUNTER(FlushLoadedAssets);
 				getAssetStreamer()->internal_flushLoadedAssets();
-			}
+			});
 
-			if (currentWorld != nullptr) {
-				const float ar = (float)conf.windowWidth / conf.windowHeight;
-				currentWorld->getCamera().getLens().setAspectRatio(ar);
+			// Application UI can be changed by the world tick.
+			TaskHandle overlayDependency = flushAssetsTask;
 
-				{
+			if (currentWorld != nullptr) {
+				const TaskHandle worldTask = frameGraph.addTask("UpdateCurrentWorld", ETaskThread::Main, [this, deltaSeconds]() {
 					SCOPED_CPU_COUNTER(UpdateCurrentWorld);
+					const float ar = (float)conf.windowWidth / conf.windowHeight;
+					currentWorld->getCamera().getLens().setAspectRatio(ar);
 					currentWorld->tick(deltaSeconds);
-				}
-
-				{
-					SCOPED_CPU_COUNTER(CreateSceneProxies);
-
-					// Process probe lighting.
-					{
-						currentWorld->getScene().updateLightProbes();
-					}
-
-					// Render the main view.
-					{
-						SCOPED_CPU_COUNTER(MainSceneProxy);
-
-						SceneProxyCreateParams sceneProxyParams{
-							SceneProxySource::MainScene,
-							frameNumber_mainThread,
-							currentWorld->getCamera(),
-							frameFence.get(),
-							frameNumber_mainThread,
-						};
-						SceneProxy* mainSceneProxy = currentWorld->getScene().createRenderProxy(sceneProxyParams);
-						CHECK(mainSceneProxy != nullptr);
-
-						internal_pushSceneProxy(mainSceneProxy);
-						//renderThread->pushSceneProxy(mainSceneProxy);
-					}
-				}
+				}, { inputTask, flushAssetsTask });
+				overlayDependency = worldTask;
+
+				// Process probe lighting.
+				const TaskHandle lightProbeTask = frameGraph.addTask("UpdateLightProbes", ETaskThread::Main, [this]() {
+					SCOPED_CPU_COUNTER(UpdateLightProbes);
+					currentWorld->getScene().updateLightProbes();
+				}, { worldTask });
+
+				// Render the main view.
+				frameGraph.addTask("MainSceneProxy", ETaskThread::Main, [this]() {
+					SCOPED_CPU_COUNTER(MainSceneProxy);
+
+					SceneProxyCreateParams sceneProxyParams{
+						SceneProxySource::MainScene,
+						frameNumber_mainThread,
+						currentWorld->getCamera(),
+						frameFence.get(),
+						frameNumber_mainThread,
+					};
+					SceneProxy* mainSceneProxy = currentWorld->getScene().createRenderProxy(sceneProxyParams);
+					CHECK(mainSceneProxy != nullptr);
+
+					internal_pushSceneProxy(mainSceneProxy);
+				}, { lightProbeTask });
 			}
 
 			//
 			// UI tick
 			//
-			{
+			frameGraph.addTask("CreateOverlayProxy", ETaskThread::Any, [this]() {
 				SCOPED_CPU_COUNTER(CreateOverlayProxy);
 
-				DisplayObject2D* debugOverlayRoot = renderThread->getDebugOverlay()->internal_getRoot();
+				// Stat labels are updated here, not in the render thread, as display objects are read below.
+				DebugOverlay* debugOverlay = renderThread->getDebugOverlay();
+				debugOverlay->updateDebugOverlay(conf.windowWidth, conf.windowHeight);
+
+				DisplayObject2D* debugOverlayRoot = debugOverlay->internal_getRoot();
 				DisplayObject2D* consoleWindowRoot = gConsole->internal_getRoot();
 
+				// Display objects retain their proxies, so only the changed ones are rebuilt here.
 				OverlaySceneProxy* overlayProxy = new OverlaySceneProxy(conf.windowWidth, conf.windowHeight);
-				overlayProxy->appOverlayRootProxy = DisplayObject2D::createRenderProxyHierarchy(appOverlayRoot.get(), overlayProxy);
-				overlayProxy->debugOverlayRootProxy = DisplayObject2D::createRenderProxyHierarchy(debugOverlayRoot, overlayProxy);
-				overlayProxy->consoleWindowRootProxy = DisplayObject2D::createRenderProxyHierarchy(consoleWindowRoot, overlayProxy);
+				DisplayObject2D::updateRenderProxyHierarchy(appOverlayRoot.get(), overlayProxy->appOverlay);
+				DisplayObject2D::updateRenderProxyHierarchy(debugOverlayRoot, overlayProxy->debugOverlay);
+				DisplayObject2D::updateRenderProxyHierarchy(consoleWindowRoot, overlayProxy->consoleWindow);
 				internal_pushOverlayProxy(overlayProxy);
-			}
+			}, { overlayDependency });
 
 			//
 			// Output screenshots
 			//
-			if (screenshotQueue.size() > 0) {
-				std::string screenshotDir = pathos::getSolutionDir() + "/log/screenshot/";
-				pathos::createDirectory(screenshotDir.c_str());
-				for (size_t i = 0; i < screenshotQueue.size(); ++i) {
-					std::string screenshotPath = screenshotDir;
-
-					time_t now = ::time(0);
-					tm localTm;
-					errno_t timeErr = ::localtime_s(&localTm, &now);
-					CHECKF(timeErr == 0, "Failed to get current time");
-					char timeBuffer[128];
-					::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d-%H-%M-%S", &localTm);
-
-					screenshotPath += std::string(timeBuffer);
-					screenshotPath += "_shot" + std::to_string(i) + ".png";
-					const vector2i& size = screenshotQueue[i].first;
-					uint8* pixels = screenshotQueue[i].second;
-					ImageUtils::saveRGB8ImageAsPNG(size.x, size.y, pixels, screenshotPath.c_str());
-					delete[] pixels;
-				}
+			// The render thread appends to the queue, so take the pending ones before handing them to a worker.
+			std::vector<Screenshot> screenshots;
+			{
+				std::lock_guard<std::mutex> lockGuard(screenshotQueueMutex);
+				screenshots.swap(screenshotQueue);
+			}
+			if (screenshots.size() > 0) {
+				frameGraph.addTask("SaveScreenshots", ETaskThread::Any, [&screenshots]() {
+					SCOPED_CPU_COUNTER(SaveScreenshots);
+
+					std::string screenshotDir = pathos::getSolutionDir() + "/log/screenshot/";
+					pathos::createDirectory(screenshotDir.c_str());
+					for (size_t i = 0; i < screenshots.size(); ++i) {
+						std::string screenshotPath = screenshotDir;
+
+						time_t now = ::time(0);
+						tm localTm;
+						errno_t timeErr = ::localtime_s(&localTm, &now);
+						CHECKF(timeErr == 0, "Failed to get current time");
+						char timeBuffer[128];
+						::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d-%H-%M-%S", &localTm);
+
+						screenshotPath += std::string(timeBuffer);
+						screenshotPath += "_shot" + std::to_string(i) + ".png";
+						const vector2i& size = screenshots[i].first;
+						uint8* pixels = screenshots[i].second;
+						ImageUtils::saveRGB8ImageAsPNG(size.x, size.y, pixels, screenshotPath.c_str());
+						delete[] pixels;
+					}
+				});
+			}
+
+			frameGraph.execute(jobSystem.get());
+
+			if (screenshots.size() > 0) {
 				gConsole->addLine(L"Screenshot saved to log/screenshot/", false, true);
-				screenshotQueue.clear();
+			}
+
+			std::vector<TaskHandle> criticalPath;
+			frameGraph.getCriticalPath(criticalPath);
+			elapsed_criticalPath = 0.0f;
+			if (!criticalPath.empty()) {
+				const TaskGraph::TaskTiming& lastTiming = frameGraph.getTaskTiming(criticalPath.back());
+				elapsed_criticalPath = lastTiming.endMs;
 			}
 		} // End of world tick
 
@@ -608,15 +672,20 @@ namespace pathos {
 		elapsed_gameThread = stopwatch_gameThread.stop();
 		//stopwatch_gameThread.start(); // Should not reset timer here?
 
-		// Wait for previous frame's rendering to finish.
-		uint64 renderFrameNumber = frameNumber_mainThread - 1;
-		if (frameFence->getValue() < renderFrameNumber) {
-			SCOPED_CPU_COUNTER(WaitForRenderThread);
-
-			SyncEvent syncEvent;
-			frameFence->setEventOnCompletion(renderFrameNumber, &syncEvent);
-			syncEvent.waitInfinite();
-			syncEvent.close();
+		// Wait until the render thread has at most (numFramesInFlight - 1) frames to render,
+		// including the one pushed below. Nothing to wait for in the first frames.
+		// Frame numbers wrap around, so compare them by signed difference.
+		const uint32 numFramesToKeep = numFramesInFlight - 1;
+		if (frameNumber_mainThread > numFramesToKeep) {
+			const uint32 renderFrameNumber = frameNumber_mainThread - numFramesToKeep;
+			if ((int32)(renderFrameNumber - (uint32)frameFence->getValue()) > 0) {
+				SCOPED_CPU_COUNTER(WaitForRenderThread);
+
+				SyncEvent syncEvent;
+				frameFence->setEventOnCompletion(renderFrameNumber, &syncEvent);
+				syncEvent.waitInfinite();
+				syncEvent.close();
+			}
 		}
 
 		if (reservedSceneProxies.size() > 0) {
@@ -640,6 +709,32 @@ namespace pathos {
 		}
 	}
 
+	// Tasks of the last frame. Tasks on the critical path are marked with '*'.
+	void Engine::dumpFrameGraph() {
+		std::vector<TaskHandle> criticalPath;
+		frameGraph.getCriticalPath(criticalPath);
+
+		char msg[256];
+		sprintf_s(msg, "Frame graph: %.3f ms (critical path %.3f ms, %u frames in flight)",
+			frameGraph.getElapsedMs(), elapsed_criticalPath, (uint32)badger::clamp(2, cvarFramesInFlight.getValue(), 4));
+		gConsole->addLine(msg, false, true);
+
+		for (TaskHandle task = 0; task < frameGraph.getNumTasks(); ++task) {
+			const TaskGraph::TaskTiming& timing = frameGraph.getTaskTiming(task);
+			const bool bCritical = std::find(criticalPath.begin(), criticalPath.end(), task) != criticalPath.end();
+			char threadName[32];
+			if (timing.workerIndex < 0) {
+				sprintf_s(threadName, "main");
+			} else {
+				sprintf_s(threadName, "worker %d", timing.workerIndex);
+			}
+			sprintf_s(msg, "%c %-20s %-10s start %7.3f ms, duration %7.3f ms",
+				bCritical ? '*' : ' ', frameGraph.getTaskName(task), threadName,
+				timing.startMs, timing.endMs - timing.startMs);
+			gConsole->addLine(msg, false, true);
+		}
+	}
+
 	void Engine::stopDeferred() {
 		if (engineStatus != EngineStatus::Destroying) {
 			return;
@@ -653,6 +748,7 @@ namespace pathos {
 		mainWindow->stopMainLoop();
 
 		assetStreamer->destroy();
+		jobSystem->stop();
 		pathos::destroyImageLibrary();
 
 		renderThread->terminate();
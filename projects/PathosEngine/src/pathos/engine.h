@@ -12,6 +12,8 @@
 #include "badger/types/vector_types.h"
 #include "badger/system/mem_alloc.h"
 #include "badger/system/stopwatch.h"
+#include "badger/system/job_system.h"
+#include "badger/system/task_graph.h"
 
 #include <map>
 #include <list>
@@ -48,6 +50,8 @@ namespace pathos {
 			, fullscreen(false)
 			, title("pathos engine")
 			, numWorkersForAssetStreamer(2)
+			, numWorkersForJobSystem(0)
+			, headless(false)
 		{
 		}
 
@@ -57,6 +61,10 @@ namespace pathos {
 		const char* title;
 
 		uint32 numWorkersForAssetStreamer;
+		uint32 numWorkersForJobSystem; // 0 = (logical core count - 2)
+
+		// No window and no GPU. GL calls are only recorded (see recording_gl.h).
+		bool headless;
 	};
 
 	enum class EngineStatus {
@@ -93,6 +101,9 @@ namespace pathos {
 		// Dump GPU profile to a text file.
 		void dumpGPUProfile();
 
+		// Print tasks of the last frame and its critical path to the console.
+		void dumpFrameGraph();
+
 		// Change current world.
 		void setWorld(World* inWorld);
 
@@ -108,6 +119,7 @@ namespace pathos {
 
 		inline InputSystem*     getInputSystem()   const { return inputSystem.get();    }
 		inline AssetStreamer*   getAssetStreamer() const { return assetStreamer.get();  }
+		inline JobSystem*       getJobSystem()     const { return jobSystem.get();      }
 		inline GUIWindow*       getMainWindow()    const { return mainWindow.get();     }
 		inline DisplayObject2D* getOverlayRoot()   const { return appOverlayRoot.get(); }
 
@@ -171,6 +183,7 @@ namespace pathos {
 		bool initializeMainWindow(int argcp, char** argv);
 		bool initializeInput();
 		bool initializeAssetStreamer();
+		bool initializeJobSystem();
 		
 		bool initializeImageLibrary();
 		bool initializeFontSystem(RenderCommandList& cmdList);
@@ -209,6 +222,10 @@ namespace pathos {
 		uniquePtr<Fence> frameFence;
 		uint32 frameNumber_mainThread = 0; // Set to 1 in initialize()
 		float elapsed_gameThread = 0.0f;
+		float elapsed_criticalPath = 0.0f;
+
+		// Frame tasks of the game thread. Rebuilt every frame.
+		TaskGraph frameGraph;
 
 		World* currentWorld = nullptr;
 		World* pendingNewWorld = nullptr;
@@ -248,10 +265,12 @@ namespace pathos {
 		Texture* textureCube_black   = nullptr;
 
 		std::vector<Screenshot> screenshotQueue;
+		std::mutex screenshotQueueMutex; // Pushed by the render thread, consumed by the game thread
 
 	// Utility thread
 	private:
 		uniquePtr<AssetStreamer> assetStreamer;
+		uniquePtr<JobSystem> jobSystem; // General purpose workers (parallelFor, etc.)
 
 	};
 
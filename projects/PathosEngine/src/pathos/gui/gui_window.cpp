@@ -6,6 +6,7 @@
 #include "pathos/engine.h"
 #include "pathos/util/log.h"
 #include "pathos/rhi/gl_context_manager.h"
+#include "pathos/rhi/recording_gl.h"
 
 #include "GL/freeglut.h"
 #include <stdio.h>
@@ -97,6 +98,8 @@ namespace pathos {
 
 	GUIWindow::GUIWindow()
 		: initialized(false)
+		, bHeadless(false)
+		, bStopRequested(false)
 		, windowWidth(0)
 		, windowHeight(0)
 		, bFullscreen(false)
@@ -125,6 +128,7 @@ namespace pathos {
 		windowHeight               = createParams.height;
 		bFullscreen                = createParams.fullscreen;
 		title                      = createParams.title;
+		bHeadless                  = createParams.headless;
 
 		callback_onClose           = createParams.onClose;
 		callback_onIdle            = createParams.onIdle;
@@ -146,6 +150,13 @@ namespace pathos {
 		windowHeight = badger::max<int32>(WINDOW_MIN_HEIGHT, windowHeight);
 		if (title.empty()) title = "Title here";
 
+		if (bHeadless) {
+			LOG(LogInfo, "[ThirdParty] GUI Backend: None (headless)");
+			OpenGLContextManager::initializeHeadless();
+			OpenGLContextManager::returnContext();
+			return;
+		}
+
 		glutInitErrorFunc(onGlutError);
 		glutInitWarningFunc(onGlutWarning);
 		glutInit(&argc, argv);
@@ -194,13 +205,26 @@ namespace pathos {
 		CHECK(initialized);
 
 		LOG(LogInfo, "Start the main loop");
-		glutMainLoop();
+		if (bHeadless) {
+			// No window events, so only the idle callback drives the engine.
+			while (!bStopRequested) {
+				callback_onIdle();
+			}
+		} else {
+			glutMainLoop();
+		}
 	}
 
 	void GUIWindow::stopMainLoop()
 	{
 		CHECK(initialized);
 
+		if (bHeadless) {
+			bStopRequested = true;
+			LOG(LogInfo, "Stop the main loop");
+			return;
+		}
+
 		GUIWindow::handleToWindow[nativeHandle] = nullptr;
 
 		glutLeaveMainLoop();
@@ -209,8 +233,12 @@ namespace pathos {
 
 	void GUIWindow::updateWindow_renderThread() {
 		OpenGLContextManager::takeContext();
-		glutSwapBuffers();
-		glutPostRedisplay();
+		if (bHeadless) {
+			presentRecordingGLFrame();
+		} else {
+			glutSwapBuffers();
+			glutPostRedisplay();
+		}
 		OpenGLContextManager::returnContext();
 	}
 
@@ -254,6 +282,9 @@ namespace pathos {
 	{
 		title = newTitle;
 
+		if (bHeadless) {
+			return;
+		}
 		glutSetWindow(nativeHandle);
 		glutSetWindowTitle(title.c_str());
 	}
@@ -267,6 +298,9 @@ namespace pathos {
 	{
 		title = std::move(newTitle);
 
+		if (bHeadless) {
+			return;
+		}
 		glutSetWindow(nativeHandle);
 		glutSetWindowTitle(title.c_str());
 	}
@@ -274,10 +308,18 @@ namespace pathos {
 	void GUIWindow::setSize(uint32 newWidth, uint32 newHeight) {
 		windowWidth = badger::clamp(WINDOW_MIN_WIDTH, newWidth, 65536u);
 		windowHeight = badger::clamp(WINDOW_MIN_HEIGHT, newHeight, 65536u);
+		if (bHeadless) {
+			// No reshape event will come.
+			onReshape(windowWidth, windowHeight);
+			return;
+		}
 		glutReshapeWindow((int)windowWidth, (int)windowHeight);
 	}
 
 	void GUIWindow::setFullscreen(bool enable) {
+		if (bHeadless) {
+			return;
+		}
 		if (enable) {
 			glutFullScreen();
 		} else {
@@ -7,6 +7,7 @@
 #include <functional>
 #include <string>
 #include <map>
+#include <atomic>
 
 namespace pathos {
 
@@ -20,6 +21,7 @@ namespace pathos {
 		int32 height;
 		bool fullscreen;
 		const char* title;
+		bool headless = false; // Do not create a window, which also means no GL context.
 		
 		// OpenGL setup
 		int32 glMajorVersion;
@@ -77,8 +79,12 @@ namespace pathos {
 
 		void setFullscreen(bool enable);
 
+		bool isHeadless() const { return bHeadless; }
+
 	private:
 		bool initialized;
+		bool bHeadless;
+		std::atomic<bool> bStopRequested; // Only for headless mode. Set from other threads.
 
 		int32 windowWidth;
 		int32 windowHeight;
@@ -1,55 +1,221 @@
 #include "asset_streamer.h"
 #include "pathos/loader/objloader.h"
 #include "pathos/loader/gltf_loader.h"
+#include "pathos/loader/image_loader.h"
 #include "pathos/rhi/render_device.h"
 #include "pathos/util/cpu_profiler.h"
 #include "pathos/util/engine_thread.h"
+#include "pathos/util/resource_finder.h"
+#include "pathos/util/derived_data_cache.h"
 #include "pathos/util/log.h"
 
 #include "badger/assertion/assertion.h"
 #include <sstream>
+#include <atomic>
+#include <algorithm>
 
+// Requests
 namespace pathos {
 
-	void internal_loadWavefrontOBJ(const WorkItemParam* param) {
-		SCOPED_CPU_COUNTER(AsyncLoad_WavefrontOBJ);
+	// A load shared by every caller that requested the same asset while it was pending or running.
+	// Subscribers are only touched under AssetStreamer::requestLock, or by the main thread after
+	// the request has left every container of the streamer.
+	struct AssetRequest {
+		virtual ~AssetRequest() {}
+
+		// Worker thread.
+		virtual void load(AssetStreamer* streamer) = 0;
+		// Main thread. Invoke the handler of every subscriber.
+		virtual void deliver(AssetStreamer* streamer) = 0;
+		// Main thread. Every subscriber has cancelled, so release whatever load() produced.
+		virtual void discard(AssetStreamer* streamer) = 0;
+
+		virtual void assignHandle(AssetRequestHandle handle) = 0;
+		virtual void adoptSubscribers(AssetRequest* other) = 0;
+		virtual bool removeSubscriber(AssetRequestHandle handle) = 0;
+		virtual void getSubscriberHandles(std::vector<AssetRequestHandle>& outHandles) const = 0;
+		virtual void clearSubscribers() = 0;
+		virtual size_t numSubscribers() const = 0;
+
+		std::string key; // Empty if the request is never shared.
+		float priority = 0.0f;
+		uint64 sequence = 0; // FIFO among requests of the same priority.
+		std::atomic<bool> bCancelled = { false };
+	};
+
+	template<typename Handler>
+	struct AssetRequestWithHandlers : public AssetRequest {
+		struct Subscriber {
+			AssetRequestHandle handle;
+			uint64 payload;
+			Handler handler;
+		};
+
+		void assignHandle(AssetRequestHandle handle) override {
+			for (Subscriber& subscriber : subscribers) {
+				if (subscriber.handle == INVALID_ASSET_REQUEST) subscriber.handle = handle;
+			}
+		}
+		void adoptSubscribers(AssetRequest* other) override {
+			// Requests of the same key are always of the same type.
+			auto typedOther = static_cast<AssetRequestWithHandlers<Handler>*>(other);
+			for (Subscriber& subscriber : typedOther->subscribers) {
+				subscribers.emplace_back(std::move(subscriber));
+			}
+			typedOther->subscribers.clear();
+		}
+		bool removeSubscriber(AssetRequestHandle handle) override {
+			for (auto it = subscribers.begin(); it != subscribers.end(); ++it) {
+				if (it->handle == handle) {
+					subscribers.erase(it);
+					return true;
+				}
+			}
+			return false;
+		}
+		void getSubscriberHandles(std::vector<AssetRequestHandle>& outHandles) const override {
+			for (const Subscriber& subscriber : subscribers) outHandles.push_back(subscriber.handle);
+		}
+		void clearSubscribers() override { subscribers.clear(); }
+		size_t numSubscribers() const override { return subscribers.size(); }
 
-		AssetLoadInfoBase_WavefrontOBJ* arg = (AssetLoadInfoBase_WavefrontOBJ*)param->arg;
-		AssetStreamer* streamer = arg->streamer;
+		std::vector<Subscriber> subscribers;
+	};
 
-		streamer->internal_unregisterLoadInfo(arg);
+	struct AssetRequest_WavefrontOBJ : public AssetRequestWithHandlers<WavefrontOBJHandler> {
+		void load(AssetStreamer* streamer) override {
+			SCOPED_CPU_COUNTER(AsyncLoad_WavefrontOBJ);
 
-		OBJLoader* loader = streamer->internal_allocateOBJLoader();
+			loader = streamer->internal_allocateOBJLoader();
+			loader->setMaterialOverrides(std::move(materialOverrides));
+			bool bLoaded = loader->load(filepath.c_str(), mtlDir.c_str(), streamer->internal_getJobSystem());
 
-		arg->loader = loader;
-		loader->setMaterialOverrides(std::move(arg->materialOverrides));
-		bool bLoaded = loader->load(arg->filepath.c_str(), arg->mtlDir.c_str());
+			if (bLoaded == false) {
+				LOG(LogError, "[AssetStreamer] Failed to load OBJ: %s", filepath.c_str());
+			}
+		}
+		void deliver(AssetStreamer* streamer) override {
+			// Deliver anyway. You should check loader->isValid() in the callback.
+			streamer->internal_retainOBJLoader(loader, (uint32)subscribers.size() - 1);
+			for (Subscriber& subscriber : subscribers) {
+				subscriber.handler(loader, subscriber.payload);
+			}
+		}
+		void discard(AssetStreamer* streamer) override {
+			if (loader != nullptr) streamer->releaseOBJLoader(loader);
+		}
 
-		if (bLoaded == false) {
-			LOG(LogError, "[AssetStreamer] Failed to load OBJ: %s", arg->filepath);
+		std::string filepath;
+		std::string mtlDir;
+		std::vector<std::pair<std::string, assetPtr<Material>>> materialOverrides;
+		OBJLoader* loader = nullptr;
+	};
+
+	struct AssetRequest_GLTF : public AssetRequestWithHandlers<GLTFHandler> {
+		void load(AssetStreamer* streamer) override {
+			SCOPED_CPU_COUNTER(AsyncLoad_GLTF);
+
+			loader = streamer->internal_allocateGLTFLoader();
+			bool bLoaded = loader->load(filepath.c_str(), streamer->internal_getJobSystem());
+
+			if (bLoaded == false) {
+				LOG(LogError, "[AssetStreamer] Failed to load GLTF: %s", filepath.c_str());
+			}
+		}
+		void deliver(AssetStreamer* streamer) override {
+			// Deliver anyway. You should check loader->isValid() in the callback.
+			streamer->internal_retainGLTFLoader(loader, (uint32)subscribers.size() - 1);
+			for (Subscriber& subscriber : subscribers) {
+				subscriber.handler(loader, subscriber.payload);
+			}
 		}
-		// Enqueue anyway. You should check loader->isValid() in the callback.
-		streamer->internal_onLoaded_WavefrontOBJ(arg);
+		void discard(AssetStreamer* streamer) override {
+			if (loader != nullptr) streamer->releaseGLTFLoader(loader);
+		}
+
+		std::string filepath;
+		GLTFLoader* loader = nullptr;
+	};
+
+	static ImageBlob* cloneImageBlob(const ImageBlob* blob) {
+		uint64 bytes = (uint64)blob->width * blob->height * blob->bpp / 8;
+		for (const ImageMip& mip : blob->mips) {
+			bytes = std::max(bytes, mip.offset + mip.bytes);
+		}
+		ImageBlob* clone = new ImageBlob;
+		clone->rawBytes = new uint8[bytes];
+		::memcpy(clone->rawBytes, blob->rawBytes, bytes);
+		clone->width = blob->width;
+		clone->height = blob->height;
+		clone->bpp = blob->bpp;
+		clone->glStorageFormat = blob->glStorageFormat;
+		clone->glPixelFormat = blob->glPixelFormat;
+		clone->glDataType = blob->glDataType;
+		clone->mips = blob->mips;
+		clone->bCompressed = blob->bCompressed;
+		return clone;
 	}
 
-	void internal_loadGLTF(const WorkItemParam* param) {
-		SCOPED_CPU_COUNTER(AsyncLoad_GLTF);
+	struct AssetRequest_Image : public AssetRequestWithHandlers<ImageHandler> {
+		AssetRequest_Image(const AssetReferenceImage& inAssetRef) : assetRef(inAssetRef) {}
+		~AssetRequest_Image() {
+			if (blob != nullptr) delete blob;
+		}
 
-		AssetLoadInfoBase_GLTF* arg = (AssetLoadInfoBase_GLTF*)param->arg;
-		AssetStreamer* streamer = arg->streamer;
+		void load(AssetStreamer* streamer) override {
+			SCOPED_CPU_COUNTER(AsyncLoad_Image);
 
-		streamer->internal_unregisterLoadInfo(arg);
+			if (assetRef.bCook) {
+				blob = ImageUtils::loadCookedImage(assetRef.filepath.c_str(), assetRef.cookSettings, streamer->internal_getJobSystem());
+			} else {
+				blob = ImageUtils::loadImage(assetRef.filepath.c_str());
+			}
+			if (blob == nullptr) {
+				LOG(LogError, "[AssetStreamer] Failed to load image: %s", assetRef.filepath.c_str());
+			}
+		}
+		void deliver(AssetStreamer* streamer) override {
+			// Each handler owns its blob; the last one takes the original.
+			for (size_t i = 0; i < subscribers.size(); ++i) {
+				ImageBlob* handlerBlob = blob;
+				if (blob != nullptr && i + 1 < subscribers.size()) {
+					handlerBlob = cloneImageBlob(blob);
+				}
+				subscribers[i].handler(handlerBlob, subscribers[i].payload);
+			}
+			blob = nullptr;
+		}
+		void discard(AssetStreamer* streamer) override {}
 
-		GLTFLoader* loader = streamer->internal_allocateGLTFLoader();
+		AssetReferenceImage assetRef;
+		ImageBlob* blob = nullptr;
+	};
 
-		arg->loader = loader;
-		bool bLoaded = loader->loadASCII(arg->filepath.c_str());
+	struct AssetRequest_Blob : public AssetRequestWithHandlers<BlobHandler> {
+		void load(AssetStreamer* streamer) override {
+			SCOPED_CPU_COUNTER(AsyncLoad_Blob);
 
-		if (bLoaded == false) {
-			LOG(LogError, "[AssetStreamer] Failed to load GLTF: %s", arg->filepath.c_str());
+			std::string path = ResourceFinder::get().find(filepath);
+			bLoaded = path.size() > 0 && readFileBytes(path.c_str(), bytes);
+			if (bLoaded == false) {
+				LOG(LogError, "[AssetStreamer] Failed to read file: %s", filepath.c_str());
+			}
 		}
-		// Enqueue anyway. You should check loader->isValid() in the callback.
-		streamer->internal_onLoaded_GLTF(arg);
+		void deliver(AssetStreamer* streamer) override {
+			for (Subscriber& subscriber : subscribers) {
+				subscriber.handler(bLoaded ? bytes.data() : nullptr, bLoaded ? bytes.size() : 0, subscriber.payload);
+			}
+		}
+		void discard(AssetStreamer* streamer) override {}
+
+		std::string filepath;
+		std::vector<uint8> bytes;
+		bool bLoaded = false;
+	};
+
+	static void executeNextAssetRequest(const JobParam* param) {
+		AssetStreamer* streamer = (AssetStreamer*)param->arg;
+		streamer->internal_executeNextRequest();
 	}
 
 }
@@ -61,147 +227,321 @@ namespace pathos {
 	}
 
 	AssetStreamer::~AssetStreamer() {
-		for (auto info : loadInfoList) {
-			delete info;
-		}
+		for (AssetRequest* request : pendingRequests) delete request;
+		for (AssetRequest* request : loadedRequests) delete request;
 	}
 
 	void AssetStreamer::initialize(uint32 numWorkerThreads) {
-		threadPool.Start(numWorkerThreads);
+		jobSystem.start(numWorkerThreads, L"AssetStreamer Worker");
 		for (uint32 i = 0; i < numWorkerThreads; ++i) {
 			std::stringstream ss;
 			ss << "AssetStreamer_Worker " << i;
 
-			uint32 threadId = threadPool.GetWorkerThreadId(i);
+			uint32 threadId = jobSystem.getWorkerThreadId(i);
 			CpuProfiler::getInstance().registerThread(threadId, ss.str().c_str());
 		}
 	}
 
 	void AssetStreamer::destroy() {
-		threadPool.Stop();
-		for (auto loader : objLoaderAllocator) delete loader;
-		for (auto loader : objLoadersToDelete) delete loader;
-		for (auto loader : gltfLoaderAllocator) delete loader;
-		for (auto loader : gltfLoadersToDelete) delete loader;
+		jobSystem.stop();
+		{
+			std::lock_guard<std::mutex> lock(requestLock);
+			for (AssetRequest* request : pendingRequests) delete request;
+			for (AssetRequest* request : loadedRequests) delete request;
+			pendingRequests.clear();
+			loadedRequests.clear();
+			sharedRequests.clear();
+			handleToRequest.clear();
+		}
+		{
+			std::lock_guard<std::mutex> lock(loaderLock);
+			for (auto& it : objLoaderRefCounts) delete it.first;
+			for (auto loader : objLoadersToDelete) delete loader;
+			for (auto& it : gltfLoaderRefCounts) delete it.first;
+			for (auto loader : gltfLoadersToDelete) delete loader;
+			objLoaderRefCounts.clear();
+			objLoadersToDelete.clear();
+			gltfLoaderRefCounts.clear();
+			gltfLoadersToDelete.clear();
+		}
 		LOG(LogInfo, "[AssetStreamer] Destroy asset streamer");
 	}
 
 	void AssetStreamer::wakeThreadPool() {
-		threadPool.WakeAllWorkers();
+		jobSystem.wakeAllWorkers();
 	}
 
-	void AssetStreamer::enqueueWavefrontOBJ(const char* inFilepath, const char* inMtlDir, WavefrontOBJHandler handler, uint64 payload) {
-		using LoadInfoType = AssetLoadInfo_WavefrontOBJ<AssetLoadInfoBase::DummyType>;
-		LoadInfoType* arg = new LoadInfoType;
-		loadInfoList.push_back(arg);
-		
-		arg->streamer = this;
-		arg->filepath = inFilepath;
-		arg->mtlDir = inMtlDir;
-		
-		arg->handlerOwner = nullptr;
-		arg->handler = handler;
-		
-		ThreadPoolWork work;
-		work.arg = arg;
-		work.routine = internal_loadWavefrontOBJ;
-		
-		threadPool.AddWorkSafe(work);
+	AssetRequestHandle AssetStreamer::enqueueWavefrontOBJ(const AssetReferenceWavefrontOBJ& assetRef, WavefrontOBJHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		AssetRequest_WavefrontOBJ* request = new AssetRequest_WavefrontOBJ;
+		request->filepath = assetRef.filepath;
+		request->mtlDir = assetRef.baseDir;
+		request->materialOverrides = assetRef.materialOverrides;
+		request->subscribers.push_back({ INVALID_ASSET_REQUEST, payload, std::move(handler) });
+		// Overrides change the loaded materials, so such requests are never shared.
+		if (assetRef.materialOverrides.size() == 0) {
+			request->key = "obj|" + assetRef.filepath + "|" + assetRef.baseDir;
+		}
+		return addRequest(request, priority);
 	}
 
-	void AssetStreamer::enqueueGLTF(const char* inFilepath, GLTFHandler handler, uint64 payload) {
-		using LoadInfoType = AssetLoadInfo_GLTF<AssetLoadInfoBase::DummyType>;
-		LoadInfoType* arg = new LoadInfoType;
-		loadInfoList.push_back(arg);
+	AssetRequestHandle AssetStreamer::enqueueWavefrontOBJ(const char* inFilepath, const char* inMtlDir, WavefrontOBJHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		return enqueueWavefrontOBJ(AssetReferenceWavefrontOBJ(inFilepath, inMtlDir), std::move(handler), payload, priority);
+	}
 
-		arg->streamer = this;
-		arg->filepath = inFilepath;
+	AssetRequestHandle AssetStreamer::enqueueGLTF(const AssetReferenceGLTF& assetRef, GLTFHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		AssetRequest_GLTF* request = new AssetRequest_GLTF;
+		request->filepath = assetRef.filepath;
+		request->subscribers.push_back({ INVALID_ASSET_REQUEST, payload, std::move(handler) });
+		request->key = "gltf|" + assetRef.filepath;
+		return addRequest(request, priority);
+	}
 
-		arg->handlerOwner = nullptr;
-		arg->handler = handler;
+	AssetRequestHandle AssetStreamer::enqueueGLTF(const char* inFilepath, GLTFHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		return enqueueGLTF(AssetReferenceGLTF(inFilepath), std::move(handler), payload, priority);
+	}
 
-		ThreadPoolWork work;
-		work.arg = arg;
-		work.routine = internal_loadGLTF;
-		threadPool.AddWorkSafe(work);
+	AssetRequestHandle AssetStreamer::enqueueImage(const AssetReferenceImage& assetRef, ImageHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		AssetRequest_Image* request = new AssetRequest_Image(assetRef);
+		request->subscribers.push_back({ INVALID_ASSET_REQUEST, payload, std::move(handler) });
+		request->key = "image|" + assetRef.filepath + "|"
+			+ (assetRef.bCook ? std::to_string(TextureCooker::hashSettings(assetRef.cookSettings)) : std::string("source"));
+		return addRequest(request, priority);
 	}
 
-	void AssetStreamer::internal_flushLoadedAssets() {
-		CHECK(!isInRenderThread());
-		std::vector<AssetLoadInfoBase_WavefrontOBJ*> tempLoadedOBJs;
-		std::vector<AssetLoadInfoBase_GLTF*> tempLoadedGLTFs;
+	AssetRequestHandle AssetStreamer::enqueueBlob(const char* inFilepath, BlobHandler handler, uint64 payload, float priority /*= 0.0f*/) {
+		AssetRequest_Blob* request = new AssetRequest_Blob;
+		request->filepath = inFilepath;
+		request->subscribers.push_back({ INVALID_ASSET_REQUEST, payload, std::move(handler) });
+		request->key = std::string("blob|") + inFilepath;
+		return addRequest(request, priority);
+	}
+
+	AssetRequestHandle AssetStreamer::addRequest(AssetRequest* newRequest, float priority) {
+		AssetRequestHandle handle;
+		{
+			std::lock_guard<std::mutex> lock(requestLock);
+			handle = nextHandle++;
+			newRequest->assignHandle(handle);
+
+			auto it = newRequest->key.empty() ? sharedRequests.end() : sharedRequests.find(newRequest->key);
+			if (it != sharedRequests.end()) {
+				// Same asset is pending or running. Fan out the result instead of loading it again.
+				AssetRequest* sharedRequest = it->second;
+				sharedRequest->adoptSubscribers(newRequest);
+				sharedRequest->priority = std::max(sharedRequest->priority, priority);
+				handleToRequest[handle] = sharedRequest;
+				delete newRequest;
+				return handle;
+			}
+
+			newRequest->priority = priority;
+			newRequest->sequence = nextSequence++;
+			pendingRequests.push_back(newRequest);
+			handleToRequest[handle] = newRequest;
+			if (!newRequest->key.empty()) {
+				sharedRequests[newRequest->key] = newRequest;
+			}
+		}
+
+		// Jobs don't carry a request; each one takes the best pending request when it starts.
+		JobDesc job;
+		job.arg = this;
+		job.routine = executeNextAssetRequest;
+		jobSystem.addJob(job);
 
-		// Handlers can take long time, so clone the array and release the mutex
+		return handle;
+	}
+
+	void AssetStreamer::internal_executeNextRequest() {
+		AssetRequest* request = nullptr;
 		{
-			mutex_loadedOBJs.lock();
-			tempLoadedOBJs = loadedOBJs;
-			loadedOBJs.clear();
-			mutex_loadedOBJs.unlock();
+			std::lock_guard<std::mutex> lock(requestLock);
+			// There are only tens of pending requests at most, and a linear scan keeps priority changes trivial.
+			auto best = pendingRequests.end();
+			for (auto it = pendingRequests.begin(); it != pendingRequests.end(); ++it) {
+				if (best == pendingRequests.end()
+					|| (*it)->priority > (*best)->priority
+					|| ((*it)->priority == (*best)->priority && (*it)->sequence < (*best)->sequence))
+				{
+					best = it;
+				}
+			}
+			if (best == pendingRequests.end()) {
+				// Cancelled before this job started.
+				return;
+			}
+			request = *best;
+			pendingRequests.erase(best);
+			runningRequests.push_back(request);
+		}
+
+		if (request->bCancelled.load() == false) {
+			request->load(this);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(requestLock);
+			runningRequests.remove(request);
+			loadedRequests.push_back(request);
+		}
+	}
+
+	bool AssetStreamer::setRequestPriority(AssetRequestHandle handle, float priority) {
+		std::lock_guard<std::mutex> lock(requestLock);
+		auto it = handleToRequest.find(handle);
+		if (it == handleToRequest.end()) {
+			return false;
+		}
+		AssetRequest* request = it->second;
+		if (std::find(pendingRequests.begin(), pendingRequests.end(), request) == pendingRequests.end()) {
+			return false;
+		}
+		request->priority = priority;
+		return true;
+	}
+
+	bool AssetStreamer::cancelRequest(AssetRequestHandle handle) {
+		std::lock_guard<std::mutex> lock(requestLock);
+		auto it = handleToRequest.find(handle);
+		if (it == handleToRequest.end()) {
+			return false;
+		}
+		AssetRequest* request = it->second;
+		handleToRequest.erase(it);
+		request->removeSubscriber(handle);
+		if (request->numSubscribers() == 0) {
+			cancelRequest_locked(request);
+		}
+		return true;
+	}
+
+	void AssetStreamer::cancelAllRequests() {
+		std::lock_guard<std::mutex> lock(requestLock);
+		for (AssetRequest* request : pendingRequests) {
+			delete request;
+		}
+		pendingRequests.clear();
+		// Running and loaded requests are discarded in internal_flushLoadedAssets().
+		for (AssetRequest* request : runningRequests) {
+			request->clearSubscribers();
+			request->bCancelled = true;
+		}
+		for (AssetRequest* request : loadedRequests) {
+			request->clearSubscribers();
+			request->bCancelled = true;
+		}
+		sharedRequests.clear();
+		handleToRequest.clear();
+	}
 
-			for (AssetLoadInfoBase_WavefrontOBJ* assetInfo : tempLoadedOBJs) {
-				assetInfo->invokeHandler();
-				delete assetInfo;
+	void AssetStreamer::cancelRequest_locked(AssetRequest* request) {
+		request->bCancelled = true;
+		if (!request->key.empty()) {
+			auto it = sharedRequests.find(request->key);
+			if (it != sharedRequests.end() && it->second == request) {
+				sharedRequests.erase(it);
 			}
 		}
+		auto it = std::find(pendingRequests.begin(), pendingRequests.end(), request);
+		if (it != pendingRequests.end()) {
+			pendingRequests.erase(it);
+			delete request;
+		}
+	}
+
+	uint32 AssetStreamer::getNumActiveRequests() {
+		std::lock_guard<std::mutex> lock(requestLock);
+		return (uint32)(pendingRequests.size() + runningRequests.size() + loadedRequests.size());
+	}
+
+	void AssetStreamer::internal_flushLoadedAssets() {
+		CHECK(!isInRenderThread());
+
+		// Handlers can take long time, so take the list and release the mutex.
+		std::vector<AssetRequest*> requests;
 		{
-			mutex_loadedGLTFs.lock();
-			tempLoadedGLTFs = loadedGLTFs;
-			loadedGLTFs.clear();
-			mutex_loadedGLTFs.unlock();
+			std::lock_guard<std::mutex> lock(requestLock);
+			requests.swap(loadedRequests);
+
+			std::vector<AssetRequestHandle> handles;
+			for (AssetRequest* request : requests) {
+				if (!request->key.empty()) {
+					auto it = sharedRequests.find(request->key);
+					if (it != sharedRequests.end() && it->second == request) {
+						sharedRequests.erase(it);
+					}
+				}
+				handles.clear();
+				request->getSubscriberHandles(handles);
+				for (AssetRequestHandle handle : handles) {
+					handleToRequest.erase(handle);
+				}
+			}
+		}
 
-			for (AssetLoadInfoBase_GLTF* assetInfo : tempLoadedGLTFs) {
-				assetInfo->invokeHandler();
-				delete assetInfo;
+		for (AssetRequest* request : requests) {
+			if (request->numSubscribers() > 0) {
+				request->deliver(this);
+			} else {
+				request->discard(this);
 			}
+			delete request;
 		}
 
 		// Delete stale loaders.
-		for (auto loader : objLoadersToDelete) delete loader;
-		for (auto loader : gltfLoadersToDelete) delete loader;
-		objLoadersToDelete.clear();
-		gltfLoadersToDelete.clear();
+		std::list<OBJLoader*> staleOBJLoaders;
+		std::list<GLTFLoader*> staleGLTFLoaders;
+		{
+			std::lock_guard<std::mutex> lock(loaderLock);
+			staleOBJLoaders.swap(objLoadersToDelete);
+			staleGLTFLoaders.swap(gltfLoadersToDelete);
+		}
+		for (auto loader : staleOBJLoaders) delete loader;
+		for (auto loader : staleGLTFLoaders) delete loader;
 	}
 
 	void AssetStreamer::releaseOBJLoader(OBJLoader* loader) {
-		auto it = std::find(objLoaderAllocator.begin(), objLoaderAllocator.end(), loader);
-		CHECK(it != objLoaderAllocator.end());
-		objLoaderAllocator.erase(it);
-		objLoadersToDelete.push_back(loader);
+		std::lock_guard<std::mutex> lock(loaderLock);
+		auto it = objLoaderRefCounts.find(loader);
+		CHECK(it != objLoaderRefCounts.end());
+		if (--(it->second) == 0) {
+			objLoaderRefCounts.erase(it);
+			objLoadersToDelete.push_back(loader);
+		}
 	}
 
 	void AssetStreamer::releaseGLTFLoader(GLTFLoader* loader) {
-		auto it = std::find(gltfLoaderAllocator.begin(), gltfLoaderAllocator.end(), loader);
-		CHECK(it != gltfLoaderAllocator.end());
-		gltfLoaderAllocator.erase(it);
-		gltfLoadersToDelete.push_back(loader);
+		std::lock_guard<std::mutex> lock(loaderLock);
+		auto it = gltfLoaderRefCounts.find(loader);
+		CHECK(it != gltfLoaderRefCounts.end());
+		if (--(it->second) == 0) {
+			gltfLoaderRefCounts.erase(it);
+			gltfLoadersToDelete.push_back(loader);
+		}
 	}
 
 	OBJLoader* AssetStreamer::internal_allocateOBJLoader() {
 		auto loader = new OBJLoader;
-		objLoaderAllocator.push_back(loader);
+		std::lock_guard<std::mutex> lock(loaderLock);
+		objLoaderRefCounts[loader] = 1;
 		return loader;
 	}
 
 	GLTFLoader* AssetStreamer::internal_allocateGLTFLoader() {
 		auto loader = new GLTFLoader;
-		gltfLoaderAllocator.push_back(loader);
+		std::lock_guard<std::mutex> lock(loaderLock);
+		gltfLoaderRefCounts[loader] = 1;
 		return loader;
 	}
 
-	void AssetStreamer::internal_onLoaded_WavefrontOBJ(AssetLoadInfoBase_WavefrontOBJ* info) {
-		mutex_loadedOBJs.lock();
-		loadedOBJs.push_back(info);
-		mutex_loadedOBJs.unlock();
-	}
-
-	void AssetStreamer::internal_onLoaded_GLTF(AssetLoadInfoBase_GLTF* info) {
-		mutex_loadedGLTFs.lock();
-		loadedGLTFs.push_back(info);
-		mutex_loadedGLTFs.unlock();
+	void AssetStreamer::internal_retainOBJLoader(OBJLoader* loader, uint32 count) {
+		std::lock_guard<std::mutex> lock(loaderLock);
+		objLoaderRefCounts[loader] += count;
 	}
 
-	void AssetStreamer::internal_unregisterLoadInfo(AssetLoadInfoBase* info) {
-		loadInfoList.remove(info);
+	void AssetStreamer::internal_retainGLTFLoader(GLTFLoader* loader, uint32 count) {
+		std::lock_guard<std::mutex> lock(loaderLock);
+		gltfLoaderRefCounts[loader] += count;
 	}
 
 }
@@ -3,9 +3,10 @@
 #pragma once
 
 #include "pathos/smart_pointer.h"
+#include "pathos/loader/texture_cooker.h"
 
 #include "badger/types/int_types.h"
-#include "badger/system/thread_pool.h"
+#include "badger/system/job_system.h"
 
 #include <list>
 #include <mutex>
@@ -13,6 +14,7 @@
 #include <string>
 #include <utility>
 #include <functional>
+#include <unordered_map>
 
 namespace pathos {
 
@@ -20,19 +22,30 @@ namespace pathos {
 	class Material;
 	class OBJLoader;
 	class GLTFLoader;
-	
+	struct ImageBlob;
+	struct AssetRequest;
+
+	// Identifies a caller of an enqueue function. 0 is invalid.
+	// Callers that requested the same asset share a load but have their own handles.
+	using AssetRequestHandle = uint64;
+	constexpr AssetRequestHandle INVALID_ASSET_REQUEST = 0;
+
 	using WavefrontOBJHandler = std::function<void(OBJLoader* objLoader, uint64 payload)>;
 	using GLTFHandler = std::function<void(GLTFLoader* loader, uint64 payload)>;
+	// The handler owns the blob. Null if the image could not be loaded.
+	using ImageHandler = std::function<void(ImageBlob* blob, uint64 payload)>;
+	// Raw file contents, valid only during the handler. Null if the file could not be read.
+	using BlobHandler = std::function<void(const uint8* data, uint64 bytes, uint64 payload)>;
 
 	// #todo-asset-streamer: Poor man's WTF delegates for asset streamer :(
 	template<typename UserClass>
 	using WavefrontOBJHandlerMethod = void (UserClass::*)(OBJLoader* loader, uint64 payload);
 	template<typename UserClass>
 	using GLTFHandlerMethod = void (UserClass::*)(GLTFLoader* loader, uint64 payload);
-
-	// CAUTION: Do not use
-	void internal_loadWavefrontOBJ(const WorkItemParam* param);
-	void internal_loadGLTF(const WorkItemParam* param);
+	template<typename UserClass>
+	using ImageHandlerMethod = void (UserClass::*)(ImageBlob* blob, uint64 payload);
+	template<typename UserClass>
+	using BlobHandlerMethod = void (UserClass::*)(const uint8* data, uint64 bytes, uint64 payload);
 
 	//////////////////////////////////////////////////////////////////////////
 	// Asset reference
@@ -67,71 +80,29 @@ namespace pathos {
 		std::string filepath;
 	};
 
-	//////////////////////////////////////////////////////////////////////////
-	// Load info
-
-	struct AssetLoadInfoBase {
-		class DummyType {};
-
-		virtual ~AssetLoadInfoBase() {}
-	};
-
-	struct AssetLoadInfoBase_WavefrontOBJ : public AssetLoadInfoBase {
-		virtual void invokeHandler() {}
-
-		AssetStreamer* streamer;
-		OBJLoader* loader;
-		std::string filepath;
-		std::string mtlDir;
-		std::vector<std::pair<std::string, assetPtr<Material>>> materialOverrides;
-
-		uint64 payload;
-	};
-
-	template<typename UserClass>
-	struct AssetLoadInfo_WavefrontOBJ : AssetLoadInfoBase_WavefrontOBJ
-	{
-		UserClass* handlerOwner = nullptr;
-		WavefrontOBJHandlerMethod<UserClass> handlerMethod = nullptr; // Only this is valid if handlerOwner is not null
-		WavefrontOBJHandler handler; // Only this is valid if handlerOwner is null
-
-		void invokeHandler() override {
-			if (handlerOwner == nullptr) {
-				handler(loader, payload);
-			} else {
-				(handlerOwner->*handlerMethod)(loader, payload);
-			}
-		}
-	};
-
-	struct AssetLoadInfoBase_GLTF : public AssetLoadInfoBase {
-		virtual void invokeHandler() {}
+	struct AssetReferenceImage {
+		// Load the image as is.
+		AssetReferenceImage(const char* inFilepath)
+			: filepath(inFilepath)
+		{}
+		// Load through the texture cooker (prebuilt mips, block compression).
+		AssetReferenceImage(const char* inFilepath, const TextureCookSettings& inCookSettings)
+			: filepath(inFilepath)
+			, bCook(true)
+			, cookSettings(inCookSettings)
+		{}
 
-		AssetStreamer* streamer;
-		GLTFLoader* loader;
 		std::string filepath;
-
-		uint64 payload;
-	};
-
-	template<typename UserClass>
-	struct AssetLoadInfo_GLTF : AssetLoadInfoBase_GLTF {
-		UserClass* handlerOwner = nullptr;
-		GLTFHandlerMethod<UserClass> handlerMethod = nullptr;
-		GLTFHandler handler;
-
-		void invokeHandler() override {
-			if (handlerOwner == nullptr) {
-				handler(loader, payload);
-			} else {
-				(handlerOwner->*handlerMethod)(loader, payload);
-			}
-		}
+		bool bCook = false;
+		TextureCookSettings cookSettings;
 	};
 
 	//////////////////////////////////////////////////////////////////////////
 	// AssetStreamer
 
+	// Requests are started in order of priority, not in order of enqueue.
+	// Requests for the same asset that overlap in time are loaded once and every handler is invoked.
+	// Handlers are always invoked in the main thread, in internal_flushLoadedAssets().
 	class AssetStreamer final {
 
 	public:
@@ -144,120 +115,186 @@ namespace pathos {
 
 		void wakeThreadPool();
 
-		void enqueueWavefrontOBJ(const char* inFilepath, const char* inBaseDir, WavefrontOBJHandler handler, uint64 payload);
-
 		/// <summary>
-		/// Request a Wavefront OBJ file and register a callback for load complete event. Use when the callback is a class method.
+		/// Request a Wavefront OBJ file and register a callback for load complete event.
 		/// You need to release the loader manually by releaseOBJLoader() or it will be alive until process termination.
 		/// </summary>
-		/// <typeparam name="UserClass">Class type that declares the callback method.</typeparam>
-		/// <param name="assetRef">Asset to load.</param>
-		/// <param name="handlerOwner">Class instance that will receive the event.</param>
-		/// <param name="handlerMethod">Class method to use as a callback.</param>
+		/// <param name="assetRef">Asset to load. Requests with material overrides are never shared.</param>
+		/// <param name="handler">Callback for load complete event.</param>
 		/// <param name="payload">A value that will be passed as an argument to the callback.</param>
-		template<typename UserClass>
-		void enqueueWavefrontOBJ(const AssetReferenceWavefrontOBJ& assetRef, UserClass* handlerOwner, WavefrontOBJHandlerMethod<UserClass> handlerMethod, uint64 payload);
+		/// <param name="priority">Requests of higher priority are started first. For distance-based streaming, pass the negated distance.</param>
+		/// <returns>Handle to change the priority or cancel the request.</returns>
+		AssetRequestHandle enqueueWavefrontOBJ(const AssetReferenceWavefrontOBJ& assetRef, WavefrontOBJHandler handler, uint64 payload, float priority = 0.0f);
+		AssetRequestHandle enqueueWavefrontOBJ(const char* inFilepath, const char* inBaseDir, WavefrontOBJHandler handler, uint64 payload, float priority = 0.0f);
 
-		void enqueueGLTF(const char* inFilepath, GLTFHandler handler, uint64 payload);
+		/// Same as above, but the callback is a class method.
+		template<typename UserClass>
+		AssetRequestHandle enqueueWavefrontOBJ(const AssetReferenceWavefrontOBJ& assetRef, UserClass* handlerOwner, WavefrontOBJHandlerMethod<UserClass> handlerMethod, uint64 payload, float priority = 0.0f);
 
 		/// <summary>
-		/// Request a GLTF file and register a callback for load complete event. Use when the callback is a class method.
+		/// Request a GLTF file and register a callback for load complete event.
 		/// You need to release the loader manually by releaseGLTFLoader() or it will be alive until process termination.
 		/// </summary>
-		/// <typeparam name="UserClass">Class type that declares the callback method.</typeparam>
 		/// <param name="assetRef">Asset to load.</param>
-		/// <param name="handlerOwner">Class instance that will receive the event.</param>
-		/// <param name="handlerMethod">Class method to use as a callback.</param>
+		/// <param name="handler">Callback for load complete event.</param>
 		/// <param name="payload">A value that will be passed as an argument to the callback.</param>
+		/// <param name="priority">Requests of higher priority are started first.</param>
+		/// <returns>Handle to change the priority or cancel the request.</returns>
+		AssetRequestHandle enqueueGLTF(const AssetReferenceGLTF& assetRef, GLTFHandler handler, uint64 payload, float priority = 0.0f);
+		AssetRequestHandle enqueueGLTF(const char* inFilepath, GLTFHandler handler, uint64 payload, float priority = 0.0f);
+
+		/// Same as above, but the callback is a class method.
+		template<typename UserClass>
+		AssetRequestHandle enqueueGLTF(const AssetReferenceGLTF& assetRef, UserClass* handlerOwner, GLTFHandlerMethod<UserClass> handlerMethod, uint64 payload, float priority = 0.0f);
+
+		/// <summary>
+		/// Request an image file. Decoding, and cooking if requested, run in a worker.
+		/// If the request is shared, each handler receives its own copy of the blob.
+		/// </summary>
+		/// <param name="assetRef">Image to load.</param>
+		/// <param name="handler">Callback for load complete event. It owns the blob, e.g., pass it to ImageUtils::createTexture2DFromImage().</param>
+		/// <param name="payload">A value that will be passed as an argument to the callback.</param>
+		/// <param name="priority">Requests of higher priority are started first.</param>
+		/// <returns>Handle to change the priority or cancel the request.</returns>
+		AssetRequestHandle enqueueImage(const AssetReferenceImage& assetRef, ImageHandler handler, uint64 payload, float priority = 0.0f);
+
+		/// Same as above, but the callback is a class method.
+		template<typename UserClass>
+		AssetRequestHandle enqueueImage(const AssetReferenceImage& assetRef, UserClass* handlerOwner, ImageHandlerMethod<UserClass> handlerMethod, uint64 payload, float priority = 0.0f);
+
+		/// <summary>
+		/// Request raw contents of a file.
+		/// </summary>
+		/// <param name="inFilepath">Absolute path, or relative path recognized by ResourceFinder.</param>
+		/// <param name="handler">Callback for load complete event. The data is freed after the callback returns.</param>
+		/// <param name="payload">A value that will be passed as an argument to the callback.</param>
+		/// <param name="priority">Requests of higher priority are started first.</param>
+		/// <returns>Handle to change the priority or cancel the request.</returns>
+		AssetRequestHandle enqueueBlob(const char* inFilepath, BlobHandler handler, uint64 payload, float priority = 0.0f);
+
+		/// Same as above, but the callback is a class method.
 		template<typename UserClass>
-		void enqueueGLTF(const AssetReferenceGLTF& assetRef, UserClass* handlerOwner, GLTFHandlerMethod<UserClass> handlerMethod, uint64 payload);
+		AssetRequestHandle enqueueBlob(const char* inFilepath, UserClass* handlerOwner, BlobHandlerMethod<UserClass> handlerMethod, uint64 payload, float priority = 0.0f);
+
+		/// Change the priority of a request that has not started yet. A shared request takes the latest value.
+		/// @return false if the request has already started, finished, or been cancelled.
+		bool setRequestPriority(AssetRequestHandle handle, float priority);
+
+		/// The handler of this request will not be invoked. If no other handler waits for the same asset,
+		/// a pending load is dropped and a running load is discarded when it finishes.
+		/// @return false if the handler was already invoked or the handle is invalid.
+		bool cancelRequest(AssetRequestHandle handle);
+
+		/// Cancel every request, e.g., on world transition. Handlers of the old world are never invoked.
+		void cancelAllRequests();
+
+		/// Requests whose handlers are not invoked yet.
+		uint32 getNumActiveRequests();
 
 		/// User should call this when they don't need the loader anymore, or it will be alive until process termination.
+		/// If several requests shared the loader, it is deleted after every handler has released it.
 		void releaseOBJLoader(OBJLoader* loader);
 		/// User should call this when they don't need the loader anymore, or it will be alive until process termination.
+		/// If several requests shared the loader, it is deleted after every handler has released it.
 		void releaseGLTFLoader(GLTFLoader* loader);
 
 	public:
-		// Should be called in render thread
+		// Should be called in the main thread.
 		void internal_flushLoadedAssets();
 		// public due to thread pool callbacks.
+		// Loaders start with one reference. Shared requests add a reference per extra handler.
 		OBJLoader* internal_allocateOBJLoader();
 		GLTFLoader* internal_allocateGLTFLoader();
-		void internal_onLoaded_WavefrontOBJ(AssetLoadInfoBase_WavefrontOBJ* info);
-		void internal_onLoaded_GLTF(AssetLoadInfoBase_GLTF* info);
-		void internal_unregisterLoadInfo(AssetLoadInfoBase* info);
+		void internal_retainOBJLoader(OBJLoader* loader, uint32 count);
+		void internal_retainGLTFLoader(GLTFLoader* loader, uint32 count);
+		void internal_executeNextRequest();
+		// Loaders can split their work into more jobs.
+		inline JobSystem* internal_getJobSystem() { return &jobSystem; }
 
 		// #todo-asset-streamer
 		//void enqueueColladaDAE();
-		//void enqueueImage();
-		//void enqueueBlob();
 
 	private:
-		ThreadPool threadPool;
-		std::list<AssetLoadInfoBase*> loadInfoList;
-
-		std::list<OBJLoader*> objLoaderAllocator;
-		std::list<GLTFLoader*> gltfLoaderAllocator;
-
-		std::vector<AssetLoadInfoBase_WavefrontOBJ*> loadedOBJs;
-		std::vector<AssetLoadInfoBase_GLTF*> loadedGLTFs;
-
-		std::mutex mutex_loadedOBJs;
-		std::mutex mutex_loadedGLTFs;
-		
+		AssetRequestHandle addRequest(AssetRequest* newRequest, float priority);
+		// requestLock should be held.
+		void cancelRequest_locked(AssetRequest* request);
+
+		// Separate from the engine job system as loading jobs block on file I/O.
+		JobSystem jobSystem;
+
+		// Guards every request container below. Workers only touch them to take a pending request
+		// and to hand a loaded one back; handlers are invoked outside of the lock.
+		std::mutex requestLock;
+		std::vector<AssetRequest*> pendingRequests;
+		std::vector<AssetRequest*> loadedRequests;
+		std::unordered_map<std::string, AssetRequest*> sharedRequests; // Pending or running, by asset key
+		std::unordered_map<AssetRequestHandle, AssetRequest*> handleToRequest;
+		std::list<AssetRequest*> runningRequests;
+		AssetRequestHandle nextHandle = 1;
+		uint64 nextSequence = 0;
+
+		// Loaders are allocated by workers and released by the main thread.
+		std::mutex loaderLock;
+		std::unordered_map<OBJLoader*, uint32> objLoaderRefCounts;
+		std::unordered_map<GLTFLoader*, uint32> gltfLoaderRefCounts;
 		std::list<OBJLoader*> objLoadersToDelete;
 		std::list<GLTFLoader*> gltfLoadersToDelete;
 	};
 
 	template<typename UserClass>
-	void AssetStreamer::enqueueWavefrontOBJ(
+	AssetRequestHandle AssetStreamer::enqueueWavefrontOBJ(
 		const AssetReferenceWavefrontOBJ& assetRef,
 		UserClass* handlerOwner,
 		WavefrontOBJHandlerMethod<UserClass> handlerMethod,
-		uint64 payload)
+		uint64 payload,
+		float priority)
 	{
-		using LoadInfoType = AssetLoadInfo_WavefrontOBJ<UserClass>;
-		LoadInfoType* arg = new LoadInfoType;
-		loadInfoList.push_back(arg);
-
-		arg->streamer = this;
-		arg->filepath = assetRef.filepath;
-		arg->mtlDir = assetRef.baseDir;
-		arg->materialOverrides = assetRef.materialOverrides;
-
-		arg->payload = payload;
-
-		arg->handlerOwner = handlerOwner;
-		arg->handlerMethod = handlerMethod;
-
-		ThreadPoolWork work;
-		work.arg = arg;
-		work.routine = internal_loadWavefrontOBJ;
-
-		threadPool.AddWorkSafe(work);
+		WavefrontOBJHandler handler = [handlerOwner, handlerMethod](OBJLoader* loader, uint64 inPayload) {
+			(handlerOwner->*handlerMethod)(loader, inPayload);
+		};
+		return enqueueWavefrontOBJ(assetRef, std::move(handler), payload, priority);
 	}
 
 	template<typename UserClass>
-	void AssetStreamer::enqueueGLTF(
+	AssetRequestHandle AssetStreamer::enqueueGLTF(
 		const AssetReferenceGLTF& assetRef,
 		UserClass* handlerOwner,
 		GLTFHandlerMethod<UserClass> handlerMethod,
-		uint64 payload)
+		uint64 payload,
+		float priority)
 	{
-		using LoadInfoType = AssetLoadInfo_GLTF<UserClass>;
-		LoadInfoType* arg = new LoadInfoType;
-		loadInfoList.push_back(arg);
-
-		arg->streamer = this;
-		arg->filepath = assetRef.filepath;
+		GLTFHandler handler = [handlerOwner, handlerMethod](GLTFLoader* loader, uint64 inPayload) {
+			(handlerOwner->*handlerMethod)(loader, inPayload);
+		};
+		return enqueueGLTF(assetRef, std::move(handler), payload, priority);
+	}
 
-		arg->handlerOwner = handlerOwner;
-		arg->handlerMethod = handlerMethod;
+	template<typename UserClass>
+	AssetRequestHandle AssetStreamer::enqueueImage(
+		const AssetReferenceImage& assetRef,
+		UserClass* handlerOwner,
+		ImageHandlerMethod<UserClass> handlerMethod,
+		uint64 payload,
+		float priority)
+	{
+		ImageHandler handler = [handlerOwner, handlerMethod](ImageBlob* blob, uint64 inPayload) {
+			(handlerOwner->*handlerMethod)(blob, inPayload);
+		};
+		return enqueueImage(assetRef, std::move(handler), payload, priority);
+	}
 
-		ThreadPoolWork work;
-		work.arg = arg;
-		work.routine = internal_loadGLTF;
-		threadPool.AddWorkSafe(work);
+	template<typename UserClass>
+	AssetRequestHandle AssetStreamer::enqueueBlob(
+		const char* inFilepath,
+		UserClass* handlerOwner,
+		BlobHandlerMethod<UserClass> handlerMethod,
+		uint64 payload,
+		float priority)
+	{
+		BlobHandler handler = [handlerOwner, handlerMethod](const uint8* data, uint64 bytes, uint64 inPayload) {
+			(handlerOwner->*handlerMethod)(data, bytes, inPayload);
+		};
+		return enqueueBlob(inFilepath, std::move(handler), payload, priority);
 	}
 
 }
@@ -0,0 +1,216 @@
+#include "cooked_mesh.h"
+#include "badger/assertion/assertion.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace pathos {
+
+	static constexpr uint64 COOKED_STREAM_ALIGNMENT = 16;
+
+	static inline uint64 alignCookedOffset(uint64 offset) {
+		return (offset + COOKED_STREAM_ALIGNMENT - 1) & ~(COOKED_STREAM_ALIGNMENT - 1);
+	}
+
+	static bool isValidRange(uint64 offset, uint64 bytes, uint64 totalBytes) {
+		return offset <= totalBytes && bytes <= totalBytes - offset;
+	}
+
+	template<typename IndexType>
+	static bool areIndicesInRange(const IndexType* indices, uint32 numIndices, uint32 numVertices) {
+		uint32 maxIndex = 0;
+		for (uint32 i = 0; i < numIndices; ++i) {
+			maxIndex = (std::max)(maxIndex, (uint32)indices[i]);
+		}
+		return numIndices == 0 || maxIndex < numVertices;
+	}
+
+	bool CookedMesh::initialize(const uint8* inData, uint64 inBytes, uint64 expectedSourceHash) {
+		data = nullptr;
+		header = nullptr;
+
+		if (inData == nullptr || inBytes < sizeof(CookedMeshHeader)) {
+			return false;
+		}
+		const CookedMeshHeader* hdr = reinterpret_cast<const CookedMeshHeader*>(inData);
+		if (hdr->magic != COOKED_MESH_MAGIC || hdr->version != COOKED_MESH_VERSION
+			|| hdr->sourceHash != expectedSourceHash || hdr->totalBytes != inBytes) {
+			return false;
+		}
+
+		const uint64 shapesOffset = sizeof(CookedMeshHeader);
+		const uint64 sectionsOffset = shapesOffset + (uint64)hdr->numShapes * sizeof(CookedMeshShape);
+		const uint64 tablesEnd = sectionsOffset + (uint64)hdr->numSections * sizeof(CookedMeshSection);
+		if (tablesEnd > inBytes) {
+			return false;
+		}
+		const CookedMeshShape* inShapes = reinterpret_cast<const CookedMeshShape*>(inData + shapesOffset);
+		const CookedMeshSection* inSections = reinterpret_cast<const CookedMeshSection*>(inData + sectionsOffset);
+
+		// Don't trust offsets in the file; a truncated or stale entry should be rejected, not crash.
+		for (uint32 i = 0; i < hdr->numShapes; ++i) {
+			const CookedMeshShape& shape = inShapes[i];
+			if (!isValidRange(shape.nameOffset, (uint64)shape.nameLength + 1, inBytes)
+				|| inData[shape.nameOffset + shape.nameLength] != 0
+				|| (uint64)shape.firstSection + shape.numSections > hdr->numSections) {
+				return false;
+			}
+		}
+		for (uint32 i = 0; i < hdr->numSections; ++i) {
+			const CookedMeshSection& section = inSections[i];
+			const uint64 numVertices = section.numVertices;
+			const uint64 indexBytes = (uint64)section.numIndices * ((section.flags & COOKED_SECTION_INDEX16) ? 2 : 4);
+			bool bValid = isValidRange(section.positionOffset, numVertices * 12, inBytes)
+				&& isValidRange(section.texcoordOffset, numVertices * 8, inBytes)
+				&& isValidRange(section.indexOffset, indexBytes, inBytes);
+			if (section.flags & COOKED_SECTION_HAS_NORMALS) {
+				bValid = bValid && isValidRange(section.normalOffset, numVertices * 12, inBytes);
+			}
+			if (!bValid) {
+				return false;
+			}
+			// Indices go to the GPU as is, so one out of range would read past the vertex buffers.
+			if (section.flags & COOKED_SECTION_INDEX16) {
+				if (!areIndicesInRange(reinterpret_cast<const uint16*>(inData + section.indexOffset), section.numIndices, section.numVertices)) {
+					return false;
+				}
+			} else {
+				if (!areIndicesInRange(reinterpret_cast<const uint32*>(inData + section.indexOffset), section.numIndices, section.numVertices)) {
+					return false;
+				}
+			}
+		}
+
+		data = inData;
+		header = hdr;
+		shapes = inShapes;
+		sections = inSections;
+		return true;
+	}
+
+	void CookedMeshWriter::beginShape(const std::string& name) {
+		shapeDescs.push_back({ name, (uint32)sections.size(), 0 });
+	}
+
+	void CookedMeshWriter::addSection(
+		int32 materialID,
+		const std::vector<float>& positions,
+		const std::vector<float>& texcoords,
+		const std::vector<float>& normals,
+		const std::vector<uint32>& indices)
+	{
+		CHECKF(shapeDescs.size() > 0, "Call beginShape() first");
+		const uint32 numVertices = (uint32)(positions.size() / 3);
+		CHECK(texcoords.size() == numVertices * 2);
+		CHECK(normals.size() == 0 || normals.size() == numVertices * 3);
+		for (uint32 index : indices) {
+			CHECKF(index < numVertices, "Index is out of range");
+		}
+
+		CookedMeshSection section;
+		::memset(&section, 0, sizeof(section));
+		section.materialID = materialID;
+		section.numVertices = numVertices;
+		section.numIndices = (uint32)indices.size();
+
+		vector3 minV(0.0f), maxV(0.0f);
+		if (numVertices > 0) {
+			minV = maxV = vector3(positions[0], positions[1], positions[2]);
+			for (uint32 i = 1; i < numVertices; ++i) {
+				vector3 p(positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+				minV = glm::min(minV, p);
+				maxV = glm::max(maxV, p);
+			}
+		}
+		for (int32 i = 0; i < 3; ++i) {
+			section.boundsMin[i] = minV[i];
+			section.boundsMax[i] = maxV[i];
+		}
+
+		section.positionOffset = appendStream(positions.data(), positions.size() * sizeof(float));
+		section.texcoordOffset = appendStream(texcoords.data(), texcoords.size() * sizeof(float));
+		if (normals.size() > 0) {
+			section.flags |= COOKED_SECTION_HAS_NORMALS;
+			section.normalOffset = appendStream(normals.data(), normals.size() * sizeof(float));
+		}
+		if (numVertices <= 0x10000) {
+			std::vector<uint16> indices16(indices.size());
+			for (size_t i = 0; i < indices.size(); ++i) {
+				indices16[i] = (uint16)indices[i];
+			}
+			section.flags |= COOKED_SECTION_INDEX16;
+			section.indexOffset = appendStream(indices16.data(), indices16.size() * sizeof(uint16));
+		} else {
+			section.indexOffset = appendStream(indices.data(), indices.size() * sizeof(uint32));
+		}
+
+		sections.push_back(section);
+		shapeDescs.back().numSections += 1;
+	}
+
+	uint64 CookedMeshWriter::appendStream(const void* bytes, uint64 numBytes) {
+		const uint64 offset = alignCookedOffset(streamData.size());
+		streamData.resize(offset + numBytes);
+		if (numBytes > 0) {
+			::memcpy(streamData.data() + offset, bytes, numBytes);
+		}
+		return offset;
+	}
+
+	void CookedMeshWriter::finalize(uint64 sourceHash, std::vector<uint8>& outData) {
+		const uint64 shapesOffset = sizeof(CookedMeshHeader);
+		const uint64 sectionsOffset = shapesOffset + shapeDescs.size() * sizeof(CookedMeshShape);
+		const uint64 namesOffset = sectionsOffset + sections.size() * sizeof(CookedMeshSection);
+		uint64 namesBytes = 0;
+		for (const ShapeDesc& desc : shapeDescs) {
+			namesBytes += desc.name.size() + 1;
+		}
+		const uint64 streamsOffset = alignCookedOffset(namesOffset + namesBytes);
+		const uint64 totalBytes = streamsOffset + streamData.size();
+		CHECKF(namesOffset + namesBytes <= 0xffffffff, "Too many shapes");
+
+		outData.clear();
+		outData.resize(totalBytes, 0);
+
+		CookedMeshHeader* header = reinterpret_cast<CookedMeshHeader*>(outData.data());
+		header->magic = COOKED_MESH_MAGIC;
+		header->version = COOKED_MESH_VERSION;
+		header->sourceHash = sourceHash;
+		header->totalBytes = totalBytes;
+		header->numShapes = (uint32)shapeDescs.size();
+		header->numSections = (uint32)sections.size();
+
+		CookedMeshShape* outShapes = reinterpret_cast<CookedMeshShape*>(outData.data() + shapesOffset);
+		uint64 nameCursor = namesOffset;
+		for (size_t i = 0; i < shapeDescs.size(); ++i) {
+			const ShapeDesc& desc = shapeDescs[i];
+			outShapes[i].nameOffset = (uint32)nameCursor;
+			outShapes[i].nameLength = (uint32)desc.name.size();
+			outShapes[i].firstSection = desc.firstSection;
+			outShapes[i].numSections = desc.numSections;
+			::memcpy(outData.data() + nameCursor, desc.name.c_str(), desc.name.size() + 1);
+			nameCursor += desc.name.size() + 1;
+		}
+
+		CookedMeshSection* outSections = reinterpret_cast<CookedMeshSection*>(outData.data() + sectionsOffset);
+		for (size_t i = 0; i < sections.size(); ++i) {
+			CookedMeshSection section = sections[i];
+			section.positionOffset += streamsOffset;
+			section.texcoordOffset += streamsOffset;
+			if (section.flags & COOKED_SECTION_HAS_NORMALS) {
+				section.normalOffset += streamsOffset;
+			}
+			section.indexOffset += streamsOffset;
+			outSections[i] = section;
+		}
+
+		if (streamData.size() > 0) {
+			::memcpy(outData.data() + streamsOffset, streamData.data(), streamData.size());
+		}
+
+		shapeDescs.clear();
+		sections.clear();
+		streamData.clear();
+	}
+
+}
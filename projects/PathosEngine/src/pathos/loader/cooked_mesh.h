@@ -0,0 +1,116 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+
+#include <vector>
+#include <string>
+
+// Binary mesh format for the derived data cache.
+// Layout: CookedMeshHeader | CookedMeshShape[numShapes] | CookedMeshSection[numSections] | name table | vertex/index streams
+// Every stream is 16-byte aligned, so the file can be memory-mapped and streams used in place.
+
+namespace pathos {
+
+	constexpr uint32 COOKED_MESH_MAGIC = 0x48534d50; // "PMSH"
+	constexpr uint32 COOKED_MESH_VERSION = 2; // 2: Triangles and vertices are in optimized order
+
+	struct CookedMeshHeader {
+		uint32 magic;
+		uint32 version;
+		uint64 sourceHash;
+		uint64 totalBytes;
+		uint32 numShapes;
+		uint32 numSections;
+	};
+
+	struct CookedMeshShape {
+		uint32 nameOffset; // Offset in bytes from the file start. Null-terminated.
+		uint32 nameLength;
+		uint32 firstSection;
+		uint32 numSections;
+	};
+
+	enum ECookedMeshSectionFlags : uint32 {
+		COOKED_SECTION_INDEX16     = 1 << 0, // uint16 indices, otherwise uint32
+		COOKED_SECTION_HAS_NORMALS = 1 << 1, // Otherwise normals should be calculated
+	};
+
+	// Deduplicated vertices and indices of one material.
+	struct CookedMeshSection {
+		int32 materialID; // -1 if no material
+		uint32 flags;
+		uint32 numVertices;
+		uint32 numIndices;
+		float boundsMin[3];
+		float boundsMax[3];
+		// Offsets in bytes from the file start.
+		uint64 positionOffset; // vec3
+		uint64 texcoordOffset; // vec2
+		uint64 normalOffset;   // vec3, 0 if no normals
+		uint64 indexOffset;
+	};
+
+	// Read-only view of cooked data. Does not own the memory.
+	class CookedMesh {
+
+	public:
+		// Validates the data, including that every index is less than the number of vertices of its section.
+		// @return false if the data is corrupted, from another version, or from another source.
+		bool initialize(const uint8* inData, uint64 inBytes, uint64 expectedSourceHash);
+
+		inline bool isValid() const { return header != nullptr; }
+		inline uint32 getNumShapes() const { return header->numShapes; }
+		inline const CookedMeshShape& getShape(uint32 shapeIndex) const { return shapes[shapeIndex]; }
+		inline const CookedMeshSection& getSection(uint32 sectionIndex) const { return sections[sectionIndex]; }
+		inline const char* getShapeName(uint32 shapeIndex) const { return reinterpret_cast<const char*>(data + shapes[shapeIndex].nameOffset); }
+
+		inline const float* getPositions(const CookedMeshSection& section) const { return reinterpret_cast<const float*>(data + section.positionOffset); }
+		inline const float* getTexcoords(const CookedMeshSection& section) const { return reinterpret_cast<const float*>(data + section.texcoordOffset); }
+		inline const float* getNormals(const CookedMeshSection& section) const {
+			return (section.flags & COOKED_SECTION_HAS_NORMALS) ? reinterpret_cast<const float*>(data + section.normalOffset) : nullptr;
+		}
+		inline const uint16* getIndices16(const CookedMeshSection& section) const { return reinterpret_cast<const uint16*>(data + section.indexOffset); }
+		inline const uint32* getIndices32(const CookedMeshSection& section) const { return reinterpret_cast<const uint32*>(data + section.indexOffset); }
+		inline uint32 getIndex(const CookedMeshSection& section, uint32 i) const {
+			return (section.flags & COOKED_SECTION_INDEX16) ? (uint32)getIndices16(section)[i] : getIndices32(section)[i];
+		}
+
+	private:
+		const uint8* data = nullptr;
+		const CookedMeshHeader* header = nullptr;
+		const CookedMeshShape* shapes = nullptr;
+		const CookedMeshSection* sections = nullptr;
+	};
+
+	// Builds cooked data in memory.
+	class CookedMeshWriter {
+
+	public:
+		void beginShape(const std::string& name);
+
+		// normals can be empty. Indices are stored as uint16 if possible, and must be less than the number of vertices.
+		void addSection(
+			int32 materialID,
+			const std::vector<float>& positions,
+			const std::vector<float>& texcoords,
+			const std::vector<float>& normals,
+			const std::vector<uint32>& indices);
+
+		void finalize(uint64 sourceHash, std::vector<uint8>& outData);
+
+	private:
+		// @return Offset relative to the start of the stream area.
+		uint64 appendStream(const void* bytes, uint64 numBytes);
+
+		struct ShapeDesc {
+			std::string name;
+			uint32 firstSection;
+			uint32 numSections;
+		};
+		std::vector<ShapeDesc> shapeDescs;
+		std::vector<CookedMeshSection> sections; // Stream offsets are relative until finalize()
+		std::vector<uint8> streamData;
+	};
+
+}
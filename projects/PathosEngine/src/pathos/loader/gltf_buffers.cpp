@@ -0,0 +1,273 @@
+#include "gltf_buffers.h"
+#include "pathos/util/image_data.h"
+#include "pathos/util/log.h"
+
+#include "badger/assertion/assertion.h"
+
+#include <tiny_gltf.h>
+#include <nlohmann/json.hpp>
+#include "stb_image.h"
+
+namespace pathos {
+
+	// A valid data URI of one byte. tinygltf rejects empty buffers.
+	static const char* PLACEHOLDER_BUFFER_URI = "data:application/octet-stream;base64,AA==";
+
+	static bool isDataURI(const std::string& uri) {
+		return uri.compare(0, 5, "data:") == 0;
+	}
+
+	// URIs of external files might be percent-encoded.
+	static std::string decodeURIComponent(const std::string& uri) {
+		auto hexValue = [](char c) -> int32 {
+			if (c >= '0' && c <= '9') return c - '0';
+			if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+			if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+			return -1;
+		};
+		std::string decoded;
+		decoded.reserve(uri.size());
+		for (size_t i = 0; i < uri.size(); ++i) {
+			if (uri[i] == '%' && i + 2 < uri.size()) {
+				int32 hi = hexValue(uri[i + 1]), lo = hexValue(uri[i + 2]);
+				if (hi >= 0 && lo >= 0) {
+					decoded.push_back((char)(hi * 16 + lo));
+					i += 2;
+					continue;
+				}
+			}
+			decoded.push_back(uri[i]);
+		}
+		return decoded;
+	}
+
+	static uint32 readUint32(const uint8* p) {
+		uint32 x;
+		::memcpy(&x, p, sizeof(uint32));
+		return x;
+	}
+
+	bool GLTFBuffers::open(const char* filepath) {
+		close();
+
+		if (!mainFile.open(filepath)) {
+			LOG(LogError, "[GLTF] Can't map the file: %s", filepath);
+			return false;
+		}
+		std::string path = filepath;
+		size_t lastSlash = path.find_last_of("/\\");
+		baseDirectory = (lastSlash == std::string::npos) ? "" : path.substr(0, lastSlash + 1);
+
+		const uint8* data = mainFile.getData();
+		const uint64 size = mainFile.getSize();
+		bIsBinary = (size >= 4 && readUint32(data) == GLB_MAGIC);
+
+		bool bParsed = false;
+		if (bIsBinary) {
+			// Header: magic, version, length. Then chunks of (length, type, data), each 4-byte aligned.
+			if (size < 20 || readUint32(data + 4) != 2 || readUint32(data + 8) > size) {
+				LOG(LogError, "[GLTF] Invalid GLB header: %s", filepath);
+			} else {
+				const uint64 totalBytes = readUint32(data + 8);
+				const uint64 jsonBytes = readUint32(data + 12);
+				const uint64 binHeader = 20 + ((jsonBytes + 3) & ~3ull);
+				const uint8* binChunk = nullptr;
+				uint64 binBytes = 0;
+				if (readUint32(data + 16) != GLB_CHUNK_JSON || 20 + jsonBytes > totalBytes) {
+					LOG(LogError, "[GLTF] First chunk of GLB should be JSON: %s", filepath);
+				} else {
+					if (binHeader + 8 <= totalBytes && readUint32(data + binHeader + 4) == GLB_CHUNK_BIN) {
+						binBytes = readUint32(data + binHeader);
+						binChunk = data + binHeader + 8;
+						if (binHeader + 8 + binBytes > totalBytes) {
+							LOG(LogError, "[GLTF] BIN chunk exceeds the file: %s", filepath);
+							binChunk = nullptr;
+							binBytes = 0;
+						}
+					}
+					bParsed = parseDocument((const char*)(data + 20), jsonBytes, binChunk, binBytes);
+				}
+			}
+		} else {
+			bParsed = parseDocument((const char*)data, size, nullptr, 0);
+		}
+
+		if (!bParsed) {
+			LOG(LogError, "[GLTF] Failed to resolve buffers: %s", filepath);
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	void GLTFBuffers::close() {
+		mainFile.close();
+		externalFiles.clear();
+		decodedBuffers.clear();
+		buffers.clear();
+		bufferViews.clear();
+		images.clear();
+		strippedJSON.clear();
+		baseDirectory.clear();
+		bIsBinary = false;
+	}
+
+	bool GLTFBuffers::parseDocument(const char* json, uint64 jsonBytes, const uint8* binChunk, uint64 binChunkSize) {
+		nlohmann::json document = nlohmann::json::parse(json, json + jsonBytes, nullptr, false);
+		if (document.is_discarded() || !document.is_object()) {
+			LOG(LogError, "[GLTF] Invalid JSON");
+			return false;
+		}
+
+		auto getUint64 = [](const nlohmann::json& obj, const char* key, uint64 fallback) -> uint64 {
+			auto it = obj.find(key);
+			return (it != obj.end() && it->is_number_unsigned()) ? it->get<uint64>() : fallback;
+		};
+		auto getString = [](const nlohmann::json& obj, const char* key) -> std::string {
+			auto it = obj.find(key);
+			return (it != obj.end() && it->is_string()) ? it->get<std::string>() : std::string();
+		};
+
+		auto buffersIt = document.find("buffers");
+		if (buffersIt != document.end() && buffersIt->is_array()) {
+			for (nlohmann::json& buffer : *buffersIt) {
+				const uint64 byteLength = getUint64(buffer, "byteLength", 0);
+				const std::string uri = getString(buffer, "uri");
+
+				BufferRange range;
+				if (uri.empty()) {
+					// Only the first buffer of a GLB may omit uri.
+					if (!bIsBinary || buffers.size() != 0 || binChunk == nullptr || byteLength > binChunkSize) {
+						LOG(LogError, "[GLTF] Buffer without uri does not refer to the BIN chunk");
+						return false;
+					}
+					range.data = binChunk;
+					range.size = byteLength;
+				} else if (isDataURI(uri)) {
+					std::vector<uint8> decoded;
+					std::string mimeType;
+					if (!tinygltf::DecodeDataURI(&decoded, mimeType, uri, (size_t)byteLength, true)) {
+						LOG(LogError, "[GLTF] Failed to decode a data URI of buffer %u", (uint32)buffers.size());
+						return false;
+					}
+					decodedBuffers.emplace_back(std::move(decoded));
+					range.data = decodedBuffers.back().data();
+					range.size = byteLength;
+				} else {
+					const std::string binPath = baseDirectory + decodeURIComponent(uri);
+					uniquePtr<MappedFile> binFile = makeUnique<MappedFile>();
+					if (!binFile->open(binPath.c_str()) || binFile->getSize() < byteLength) {
+						LOG(LogError, "[GLTF] Can't map the buffer file or it's too small: %s", binPath.c_str());
+						return false;
+					}
+					range.data = binFile->getData();
+					range.size = byteLength;
+					externalFiles.emplace_back(std::move(binFile));
+				}
+				buffers.push_back(range);
+
+				buffer["byteLength"] = 1;
+				buffer["uri"] = PLACEHOLDER_BUFFER_URI;
+			}
+		}
+
+		auto viewsIt = document.find("bufferViews");
+		if (viewsIt != document.end() && viewsIt->is_array()) {
+			for (const nlohmann::json& view : *viewsIt) {
+				BufferView desc;
+				desc.buffer = (int32)getUint64(view, "buffer", (uint64)-1);
+				desc.byteOffset = getUint64(view, "byteOffset", 0);
+				desc.byteLength = getUint64(view, "byteLength", 0);
+				desc.byteStride = (uint32)getUint64(view, "byteStride", 0);
+				if (getBufferRange(desc.buffer, desc.byteOffset, desc.byteLength) == nullptr) {
+					LOG(LogError, "[GLTF] bufferView %u is out of range", (uint32)bufferViews.size());
+					return false;
+				}
+				bufferViews.push_back(desc);
+			}
+		}
+
+		auto imagesIt = document.find("images");
+		if (imagesIt != document.end() && imagesIt->is_array()) {
+			for (const nlohmann::json& image : *imagesIt) {
+				GLTFImageSource source;
+				source.name = getString(image, "name");
+				source.uri = getString(image, "uri");
+				source.mimeType = getString(image, "mimeType");
+				source.bufferView = (int32)getUint64(image, "bufferView", (uint64)-1);
+				images.emplace_back(std::move(source));
+			}
+			// Textures still refer to images by index; tinygltf does not validate it.
+			document.erase(imagesIt);
+		}
+
+		strippedJSON = document.dump();
+		return true;
+	}
+
+	const uint8* GLTFBuffers::getBufferRange(int32 bufferIx, uint64 byteOffset, uint64 byteLength) const {
+		if (bufferIx < 0 || (size_t)bufferIx >= buffers.size()) {
+			return nullptr;
+		}
+		const BufferRange& range = buffers[bufferIx];
+		if (byteOffset > range.size || byteLength > range.size - byteOffset) {
+			return nullptr;
+		}
+		return range.data + byteOffset;
+	}
+
+	const uint8* GLTFBuffers::getBufferViewData(int32 viewIx, uint64& outByteLength, uint32& outByteStride) const {
+		if (viewIx < 0 || (size_t)viewIx >= bufferViews.size()) {
+			return nullptr;
+		}
+		const BufferView& view = bufferViews[viewIx];
+		outByteLength = view.byteLength;
+		outByteStride = view.byteStride;
+		return buffers[view.buffer].data + view.byteOffset;
+	}
+
+	ImageBlob* GLTFBuffers::decodeImage(size_t imageIx) const {
+		CHECK(imageIx < images.size());
+		const GLTFImageSource& source = images[imageIx];
+
+		const uint8* bytes = nullptr;
+		uint64 numBytes = 0;
+		std::vector<uint8> decodedURI;
+		MappedFile imageFile;
+		if (source.bufferView != -1) {
+			uint32 byteStride;
+			bytes = getBufferViewData(source.bufferView, numBytes, byteStride);
+		} else if (isDataURI(source.uri)) {
+			std::string mimeType;
+			if (tinygltf::DecodeDataURI(&decodedURI, mimeType, source.uri, 0, false)) {
+				bytes = decodedURI.data();
+				numBytes = decodedURI.size();
+			}
+		} else if (imageFile.open((baseDirectory + decodeURIComponent(source.uri)).c_str())) {
+			bytes = imageFile.getData();
+			numBytes = imageFile.getSize();
+		}
+		if (bytes == nullptr || numBytes == 0 || numBytes > 0x7fffffff) {
+			LOG(LogError, "[GLTF] Can't read image %u: %s", (uint32)imageIx, source.uri.c_str());
+			return nullptr;
+		}
+
+		// Always RGBA, same as tinygltf's default image loader.
+		int32 width, height, numComponents;
+		stbi_uc* pixels = stbi_load_from_memory(bytes, (int32)numBytes, &width, &height, &numComponents, 4);
+		if (pixels == nullptr) {
+			LOG(LogError, "[GLTF] Failed to decode image %u: %s", (uint32)imageIx, stbi_failure_reason());
+			return nullptr;
+		}
+
+		ImageBlob* blob = new ImageBlob;
+		blob->copyRawBytes(pixels, (uint32)width, (uint32)height, 32);
+		blob->glStorageFormat = GL_RGBA8;
+		blob->glPixelFormat = GL_RGBA;
+		blob->glDataType = GL_UNSIGNED_BYTE;
+		stbi_image_free(pixels);
+
+		return blob;
+	}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "pathos/util/mapped_file.h"
+#include "pathos/smart_pointer.h"
+
+#include "badger/types/int_types.h"
+#include "badger/types/noncopyable.h"
+
+#include <string>
+#include <vector>
+
+// Binary data of a glTF asset, resolved without going through tinygltf.
+// .glb files and external .bin files are memory-mapped and accessors point into the mappings.
+// Only data URIs are decoded into owned memory.
+
+namespace pathos {
+
+	struct ImageBlob;
+
+	constexpr uint32 GLB_MAGIC = 0x46546c67;      // "glTF"
+	constexpr uint32 GLB_CHUNK_JSON = 0x4e4f534a; // "JSON"
+	constexpr uint32 GLB_CHUNK_BIN = 0x004e4942;  // "BIN\0"
+
+	struct GLTFImageSource {
+		std::string name;
+		std::string uri;      // Empty if embedded in a buffer view.
+		std::string mimeType;
+		int32 bufferView = -1;
+	};
+
+	class GLTFBuffers final : public Noncopyable {
+
+	public:
+		// Accepts both .gltf and .glb.
+		// @return false if the file can't be mapped, the container is malformed, or a buffer can't be resolved.
+		bool open(const char* filepath);
+		void close();
+
+		// The document with every buffer replaced by a 1-byte data URI and without the images array,
+		// so tinygltf parses the scene structure without copying or decoding any payload.
+		inline const std::string& getStrippedJSON() const { return strippedJSON; }
+		inline const std::string& getBaseDirectory() const { return baseDirectory; }
+		inline bool isBinary() const { return bIsBinary; }
+
+		inline size_t numBuffers() const { return buffers.size(); }
+		inline size_t numImages() const { return images.size(); }
+		inline const GLTFImageSource& getImage(size_t imageIx) const { return images[imageIx]; }
+
+		// @return Pointer to [byteOffset, byteOffset + byteLength) of the buffer, or nullptr if out of range.
+		const uint8* getBufferRange(int32 bufferIx, uint64 byteOffset, uint64 byteLength) const;
+
+		// Buffer views of the original document; tinygltf sees the same views.
+		const uint8* getBufferViewData(int32 viewIx, uint64& outByteLength, uint32& outByteStride) const;
+
+		// Decode an image as 8-bit RGB or RGBA. Thread-safe; external image files are mapped only while decoding.
+		// @return nullptr if the image can't be read or decoded.
+		ImageBlob* decodeImage(size_t imageIx) const;
+
+	private:
+		struct BufferRange {
+			const uint8* data = nullptr;
+			uint64 size = 0;
+		};
+		struct BufferView {
+			int32 buffer = -1;
+			uint64 byteOffset = 0;
+			uint64 byteLength = 0;
+			uint32 byteStride = 0;
+		};
+
+		bool parseDocument(const char* json, uint64 jsonBytes, const uint8* binChunk, uint64 binChunkSize);
+
+		MappedFile mainFile;
+		std::vector<uniquePtr<MappedFile>> externalFiles;
+		std::vector<std::vector<uint8>> decodedBuffers;
+		std::vector<BufferRange> buffers;
+		std::vector<BufferView> bufferViews;
+		std::vector<GLTFImageSource> images;
+		std::string strippedJSON;
+		std::string baseDirectory;
+		bool bIsBinary = false;
+
+	};
+
+}
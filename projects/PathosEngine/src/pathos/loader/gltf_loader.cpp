@@ -11,11 +11,154 @@
 #include "pathos/util/resource_finder.h"
 #include "pathos/util/log.h"
 
+#include "badger/system/job_system.h"
+
 #include <tiny_gltf.h>
 #include <glm/gtc/quaternion.hpp>
+#include <algorithm>
 
 namespace pathos {
 
+	// Copy a float accessor into tightly packed storage.
+	static void copyFloatStream(const GLTFAccessorView& view, uint32 numComponents, std::vector<float>& outData) {
+		outData.resize((size_t)view.count * numComponents);
+		const uint8* src = view.data;
+		for (uint32 i = 0; i < view.count; ++i, src += view.byteStride) {
+			::memcpy(&outData[(size_t)i * numComponents], src, numComponents * sizeof(float));
+		}
+	}
+
+	static const float* resolveFloatStream(const GLTFAccessorView& view, uint32 numComponents, std::vector<float>& storage) {
+		if (view.data == nullptr) {
+			return nullptr;
+		}
+		if (view.byteStride == numComponents * sizeof(float)) {
+			return reinterpret_cast<const float*>(view.data);
+		}
+		copyFloatStream(view, numComponents, storage);
+		return storage.data();
+	}
+
+	// Every index should refer to a vertex, as prepareGeometryStreams() and the GPU read vertices by index.
+	static bool areIndicesInRange(const GLTFAccessorView& indexView, uint32 indexComponentBytes, uint32 numVertices) {
+		uint32 maxIndex = 0;
+		if (indexComponentBytes == 1) {
+			for (uint32 i = 0; i < indexView.count; ++i) {
+				maxIndex = std::max(maxIndex, (uint32)indexView.data[i]);
+			}
+		} else if (indexComponentBytes == 2) {
+			const uint16* indices = reinterpret_cast<const uint16*>(indexView.data);
+			for (uint32 i = 0; i < indexView.count; ++i) {
+				maxIndex = std::max(maxIndex, (uint32)indices[i]);
+			}
+		} else {
+			const uint32* indices = reinterpret_cast<const uint32*>(indexView.data);
+			for (uint32 i = 0; i < indexView.count; ++i) {
+				maxIndex = std::max(maxIndex, indices[i]);
+			}
+		}
+		return maxIndex < numVertices;
+	}
+
+	// Runs on a worker thread. Everything MeshGeometry would otherwise do on the render thread
+	// (texcoord flip, normal and tangent generation) is done here, so finalizeGPUUpload() only uploads.
+	static void prepareGeometryStreams(GLTFPendingGeometry& pending) {
+		const uint32 numVertices = pending.positionView.count;
+		const uint32 numIndices = pending.indexView.count;
+
+		if (pending.indexComponentBytes == 1) {
+			pending.convertedIndices.resize(numIndices);
+			for (uint32 i = 0; i < numIndices; ++i) {
+				pending.convertedIndices[i] = pending.indexView.data[i];
+			}
+			pending.indexData = pending.convertedIndices.data();
+			pending.bIndex16 = true;
+		} else {
+			pending.indexData = pending.indexView.data;
+			pending.bIndex16 = (pending.indexComponentBytes == 2);
+		}
+		auto getIndex = [&pending](uint32 i) -> uint32 {
+			return pending.bIndex16 ? ((const uint16*)pending.indexData)[i] : ((const uint32*)pending.indexData)[i];
+		};
+
+		pending.positionData = resolveFloatStream(pending.positionView, 3, pending.convertedPositions);
+		pending.normalData = resolveFloatStream(pending.normalView, 3, pending.convertedNormals);
+		pending.tangentData = resolveFloatStream(pending.tangentView, 4, pending.convertedTangents);
+
+		// glTF texcoords have the origin at the top-left.
+		pending.convertedUVs.resize((size_t)numVertices * 2, 0.0f);
+		if (pending.uvView.data != nullptr) {
+			const uint8* src = pending.uvView.data;
+			for (uint32 i = 0; i < numVertices; ++i, src += pending.uvView.byteStride) {
+				const float* uv = reinterpret_cast<const float*>(src);
+				pending.convertedUVs[i * 2 + 0] = uv[0];
+				pending.convertedUVs[i * 2 + 1] = 1.0f - uv[1];
+			}
+		}
+		pending.uvData = pending.convertedUVs.data();
+
+		const vector3* positions = reinterpret_cast<const vector3*>(pending.positionData);
+		if (pending.normalData == nullptr) {
+			std::vector<vector3> accum(numVertices, vector3(0.0f));
+			for (uint32 i = 0; i + 2 < numIndices; i += 3) {
+				uint32 i0 = getIndex(i), i1 = getIndex(i + 1), i2 = getIndex(i + 2);
+				vector3 n = glm::cross(positions[i1] - positions[i0], positions[i2] - positions[i0]);
+				accum[i0] += n;
+				accum[i1] += n;
+				accum[i2] += n;
+			}
+			pending.convertedNormals.resize((size_t)numVertices * 3);
+			for (uint32 i = 0; i < numVertices; ++i) {
+				vector3 n = (glm::dot(accum[i], accum[i]) > 0.0f) ? glm::normalize(accum[i]) : vector3(0.0f, 0.0f, 1.0f);
+				pending.convertedNormals[i * 3 + 0] = n.x;
+				pending.convertedNormals[i * 3 + 1] = n.y;
+				pending.convertedNormals[i * 3 + 2] = n.z;
+			}
+			pending.normalData = pending.convertedNormals.data();
+		}
+
+		if (pending.tangentData == nullptr) {
+			const vector2* uvs = reinterpret_cast<const vector2*>(pending.uvData);
+			const vector3* normals = reinterpret_cast<const vector3*>(pending.normalData);
+			std::vector<vector3> accumT(numVertices, vector3(0.0f));
+			std::vector<vector3> accumB(numVertices, vector3(0.0f));
+			for (uint32 i = 0; i + 2 < numIndices; i += 3) {
+				uint32 i0 = getIndex(i), i1 = getIndex(i + 1), i2 = getIndex(i + 2);
+				vector3 dp1 = positions[i1] - positions[i0];
+				vector3 dp2 = positions[i2] - positions[i0];
+				vector2 duv1 = uvs[i1] - uvs[i0];
+				vector2 duv2 = uvs[i2] - uvs[i0];
+				float det = duv1.x * duv2.y - duv1.y * duv2.x;
+				if (det == 0.0f) {
+					continue;
+				}
+				float r = 1.0f / det;
+				vector3 t = (dp1 * duv2.y - dp2 * duv1.y) * r;
+				vector3 b = (dp2 * duv1.x - dp1 * duv2.x) * r;
+				accumT[i0] += t; accumT[i1] += t; accumT[i2] += t;
+				accumB[i0] += b; accumB[i1] += b; accumB[i2] += b;
+			}
+			pending.convertedTangents.resize((size_t)numVertices * 4);
+			for (uint32 i = 0; i < numVertices; ++i) {
+				// Gram-Schmidt, then store handedness in w as glTF does.
+				const vector3& n = normals[i];
+				vector3 t = accumT[i] - n * glm::dot(n, accumT[i]);
+				float w = 1.0f;
+				if (glm::dot(t, t) > 0.0f) {
+					t = glm::normalize(t);
+					w = (glm::dot(glm::cross(n, t), accumB[i]) < 0.0f) ? -1.0f : 1.0f;
+				} else {
+					t = vector3(0.0f);
+				}
+				pending.convertedTangents[i * 4 + 0] = t.x;
+				pending.convertedTangents[i * 4 + 1] = t.y;
+				pending.convertedTangents[i * 4 + 2] = t.z;
+				pending.convertedTangents[i * 4 + 3] = w;
+			}
+			pending.tangentData = pending.convertedTangents.data();
+		}
+	}
+
 	GLTFLoader::GLTFLoader() {
 		tinyLoader = makeUnique<tinygltf::TinyGLTF>();
 		tinyModel = makeUnique<tinygltf::Model>();
@@ -25,7 +168,7 @@ namespace pathos {
 		LOG(LogDebug, "[GLTF] Destroy GLTFLoader");
 	}
 
-	bool GLTFLoader::loadASCII(const char* inFilename) {
+	bool GLTFLoader::load(const char* inFilename, JobSystem* jobSystem) {
 		std::string filename = ResourceFinder::get().find(inFilename);
 
 		if (filename.size() == 0) {
@@ -35,9 +178,16 @@ namespace pathos {
 		}
 		LOG(LogInfo, "[GLTF] Loading: %s", filename.c_str());
 
-		std::string tinyErr, tinyWarn;
+		if (!buffers.open(filename.c_str())) {
+			bIsValid = false;
+			return false;
+		}
 
-		bool ret = tinyLoader->LoadASCIIFromFile(tinyModel.get(), &tinyErr, &tinyWarn, filename);
+		// tinygltf only sees the scene structure; buffers and images are resolved by GLTFBuffers.
+		std::string tinyErr, tinyWarn;
+		const std::string& strippedJSON = buffers.getStrippedJSON();
+		bool ret = tinyLoader->LoadASCIIFromString(tinyModel.get(), &tinyErr, &tinyWarn,
+			strippedJSON.c_str(), (uint32)strippedJSON.size(), buffers.getBaseDirectory());
 
 		if (!tinyWarn.empty()) {
 			LOG(LogWarning, tinyWarn.c_str());
@@ -57,6 +207,7 @@ namespace pathos {
 		fallbackMaterial->setConstantParameter("roughness", 0.9f);
 		fallbackMaterial->setConstantParameter("emissive", vector3(0.0f));
 
+		LOG(LogInfo, "[GLTF] Format: %s", buffers.isBinary() ? "GLB" : "glTF");
 		LOG(LogInfo, "[GLTF] Textures: %u", (uint32)tinyModel->textures.size());
 		LOG(LogInfo, "[GLTF] Materials: %u", (uint32)tinyModel->materials.size());
 		LOG(LogInfo, "[GLTF] Meshes: %u", (uint32)tinyModel->meshes.size());
@@ -64,9 +215,9 @@ namespace pathos {
 		LOG(LogInfo, "[GLTF] Nodes: %u", (uint32)tinyModel->nodes.size());
 		LOG(LogInfo, "[GLTF] Scenes: %u", (uint32)tinyModel->scenes.size());
 
-		parseTextures(tinyModel.get());
+		parseTextures(tinyModel.get(), jobSystem);
 		parseMaterials(tinyModel.get());
-		parseMeshes(tinyModel.get());
+		parseMeshes(tinyModel.get(), jobSystem);
 		parseLights(tinyModel.get());
 
 		const size_t totalNodes = tinyModel->nodes.size();
@@ -128,57 +279,44 @@ namespace pathos {
 	}
 
 	void GLTFLoader::finalizeGPUUpload() {
+		if (bGPUUploaded) {
+			return;
+		}
+		bGPUUploaded = true;
+
 		for (GLTFPendingTexture& pending : pendingTextures) {
 			constexpr uint32 mipLevels = 0;
 			constexpr bool autoDestroy = false;
 
-			pending.glTexture = ImageUtils::createTexture2DFromImage(pending.blob, mipLevels, pending.sRGB, autoDestroy, pending.debugName.c_str());
+			if (pending.blob != nullptr) {
+				pending.glTexture = ImageUtils::createTexture2DFromImage(pending.blob, mipLevels, pending.sRGB, autoDestroy, pending.debugName.c_str());
+			}
 		}
 		for (GLTFPendingTextureParameter& param : pendingTextureParameters) {
+			Texture* texture = (param.index != -1) ? pendingTextures[param.index].glTexture : nullptr;
 			param.material->setTextureParameter(param.parameterName.c_str(),
-				(param.index != -1) ? pendingTextures[param.index].glTexture : param.fallbackTexture);
+				(texture != nullptr) ? texture : param.fallbackTexture);
 		}
 		for (GLTFPendingGeometry& pending : pendingGeometries) {
 			assetPtr<MeshGeometry> geometry = pending.geometry;
+			const uint32 numVertices = pending.positionView.count;
 
 			if (pending.bIndex16) {
-				geometry->updateIndex16Data((uint16*)pending.indexBlob, pending.indexLength);
+				geometry->updateIndex16Data((const uint16*)pending.indexData, pending.indexView.count);
 			} else {
-				geometry->updateIndexData((uint32*)pending.indexBlob, pending.indexLength);
-			}
-			if (pending.bShouldFreeIndex) {
-				delete[] pending.indexBlob;
-			}
-
-			geometry->updatePositionData((float*)pending.positionBlob, pending.positionLength);
-			if (pending.bShouldFreePosition) {
-				delete[] pending.positionBlob;
-			}
-
-			geometry->updateUVData((float*)pending.uvBlob, pending.uvLength, pending.bFlipTexcoordY);
-			if (pending.bShouldFreeUV) {
-				delete[] pending.uvBlob;
-			}
-
-			if (pending.normalBlob != nullptr) {
-				geometry->updateNormalData((float*)pending.normalBlob, pending.normalLength);
-				if (pending.bShouldFreeNormal) {
-					delete[] pending.normalBlob;
-				}
-			} else {
-				geometry->calculateNormals();
-			}
-
-			if (pending.tangentBlob != nullptr) {
-				geometry->updateTangentData((float*)pending.tangentBlob, pending.tangentLength);
-				if (pending.bShouldFreeTangent) {
-					delete[] pending.tangentBlob;
-				}
-				geometry->calculateBitangentOnly();
-			} else {
-				geometry->calculateTangentBasis();
+				geometry->updateIndexData((const uint32*)pending.indexData, pending.indexView.count);
 			}
+			geometry->updatePositionData(pending.positionData, numVertices * 3);
+			geometry->updateUVData(pending.uvData, numVertices * 2);
+			geometry->updateNormalData(pending.normalData, numVertices * 3);
+			geometry->updateTangentData(pending.tangentData, numVertices * 4);
+			geometry->calculateBitangentOnly();
 		}
+
+		// Geometries keep their own copies, so the mappings and converted streams are no longer needed.
+		pendingGeometries.clear();
+		pendingGeometries.shrink_to_fit();
+		buffers.close();
 	}
 
 	void GLTFLoader::attachToActor(Actor* targetActor, std::vector<SceneComponent*>* outComponents) {
@@ -264,7 +402,7 @@ namespace pathos {
 		LOG(LogInfo, "[GLTF] - Skipped            : %u", numSkipped);
 	}
 
-	void GLTFLoader::parseTextures(tinygltf::Model* tinyModel) {
+	void GLTFLoader::parseTextures(tinygltf::Model* tinyModel, JobSystem* jobSystem) {
 		std::vector<bool> isSRGB(tinyModel->textures.size(), false);
 		for (const tinygltf::Material& tinyMat : tinyModel->materials) {
 			int32 texIx = tinyMat.pbrMetallicRoughness.baseColorTexture.index;
@@ -273,34 +411,29 @@ namespace pathos {
 			}
 		}
 
-		for (size_t texIx = 0; texIx < tinyModel->textures.size(); ++texIx) {
-			const tinygltf::Texture& tinyTex = tinyModel->textures[texIx];
-			const tinygltf::Image& tinyImg = tinyModel->images[tinyTex.source];
-			CHECK(tinyImg.bits == 8);
-
-			uint32 bpp = tinyImg.bits * tinyImg.component;
-			CHECK(bpp == 24 || bpp == 32);
-			CHECKF(tinyImg.image.size() == (tinyImg.width * tinyImg.height * tinyImg.component), "Image blob size is invalid");
-
-			ImageBlob* blob = new ImageBlob;
-			blob->copyRawBytes(tinyImg.image.data(), tinyImg.width, tinyImg.height, bpp);
-			if (bpp == 24) {
-				blob->glStorageFormat = GL_RGB8;
-				blob->glPixelFormat = GL_RGB;
-				blob->glDataType = GL_UNSIGNED_BYTE;
-			} else if (bpp == 32) {
-				blob->glStorageFormat = GL_RGBA8;
-				blob->glPixelFormat = GL_RGBA;
-				blob->glDataType = GL_UNSIGNED_BYTE;
-			}
-
-			GLTFPendingTexture pending;
-			pending.blob = blob;
+		const uint32 numTextures = (uint32)tinyModel->textures.size();
+		pendingTextures.resize(numTextures);
+		for (uint32 texIx = 0; texIx < numTextures; ++texIx) {
+			const int32 imageIx = tinyModel->textures[texIx].source;
+			GLTFPendingTexture& pending = pendingTextures[texIx];
 			pending.sRGB = isSRGB[texIx];
-			pending.debugName = tinyImg.uri;
-
-			pendingTextures.emplace_back(pending);
+			if (imageIx >= 0 && (size_t)imageIx < buffers.numImages()) {
+				const GLTFImageSource& source = buffers.getImage(imageIx);
+				pending.debugName = (source.uri.empty() || source.uri.compare(0, 5, "data:") == 0) ? source.name : source.uri;
+			}
 		}
+
+		// Decoding dominates load time of textured models, so each texture is a job.
+		parallelFor(jobSystem, numTextures, 1, [this, tinyModel](uint32 begin, uint32 end) {
+			for (uint32 texIx = begin; texIx < end; ++texIx) {
+				const int32 imageIx = tinyModel->textures[texIx].source;
+				if (imageIx < 0 || (size_t)imageIx >= buffers.numImages()) {
+					LOG(LogWarning, "[GLTF] Texture %u has no image", texIx);
+					continue;
+				}
+				pendingTextures[texIx].blob = buffers.decodeImage(imageIx);
+			}
+		});
 	}
 
 	void GLTFLoader::parseMaterials(tinygltf::Model* tinyModel) {
@@ -371,7 +504,7 @@ namespace pathos {
 		LOG(LogDebug, "[GLTF] Matrials not parsed: MASK=%u BLEND=%u", numMasks, numBlends);
 	}
 
-	void GLTFLoader::parseMeshes(tinygltf::Model* tinyModel) {
+	void GLTFLoader::parseMeshes(tinygltf::Model* tinyModel, JobSystem* jobSystem) {
 		// Primitive mode
 		// 0 POINTS
 		// 1 LINES
@@ -381,13 +514,6 @@ namespace pathos {
 		// 5 TRIANGLE_STRIP
 		// 6 TRIANGLE_FAN
 
-		auto getBlobPtr = [tinyModel](const tinygltf::Accessor& accessor) -> uint8* {
-			const tinygltf::BufferView& view = tinyModel->bufferViews[accessor.bufferView];
-			uint8* blob = tinyModel->buffers[view.buffer].data.data();
-			blob += view.byteOffset + accessor.byteOffset;
-			return blob;
-		};
-
 		// For each mesh
 		for (size_t meshIx = 0; meshIx < tinyModel->meshes.size(); ++meshIx) {
 			const tinygltf::Mesh& tinyMesh = tinyModel->meshes[meshIx];
@@ -411,161 +537,51 @@ namespace pathos {
 					pending.geometry = geometry;
 
 					// Index buffer
-					{
-						const tinygltf::Accessor& indicesDesc = tinyModel->accessors[tinyPrim.indices];
-						CHECK(indicesDesc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT
-							|| indicesDesc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT);
-
-						const tinygltf::BufferView& indicesView = tinyModel->bufferViews[indicesDesc.bufferView];
-						CHECK(indicesView.byteStride == 0); // Indices are consecutive, right?
-
-						pending.indexBlob = getBlobPtr(indicesDesc);
-						pending.indexLength = (uint32)indicesDesc.count;
-						pending.bShouldFreeIndex = false;
-						pending.bIndex16 = (indicesDesc.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT);
-					}
-
-					// Position buffer
-					uint32 numPos = 0;
-					{
-						auto it = tinyPrim.attributes.find("POSITION");
-						const tinygltf::Accessor& posDesc = tinyModel->accessors[it->second];
-						CHECK(posDesc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-						CHECK(posDesc.type == TINYGLTF_TYPE_VEC3);
-
-						const tinygltf::BufferView& posView = tinyModel->bufferViews[posDesc.bufferView];
-
-						uint8* posBlob = getBlobPtr(posDesc);
-						numPos = (uint32)posDesc.count;
-						bool bTempBlob = false;
-						float* tempPos = nullptr;
-
-						if (posView.byteStride != 0) {
-							bTempBlob = true;
-							tempPos = new float[numPos * 3];
-							for (uint32 i = 0; i < numPos; ++i) {
-								float* curr = (float*)posBlob;
-								tempPos[i * 3 + 0] = curr[0];
-								tempPos[i * 3 + 1] = curr[1];
-								tempPos[i * 3 + 2] = curr[2];
-								posBlob += posView.byteStride;
-							}
-						}
-						
-						pending.positionBlob = bTempBlob ? (void*)tempPos : (void*)posBlob;
-						pending.positionLength = numPos * 3;
-						pending.bShouldFreePosition = bTempBlob;
+					const tinygltf::Accessor& indicesDesc = tinyModel->accessors[tinyPrim.indices];
+					switch (indicesDesc.componentType) {
+						case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: pending.indexComponentBytes = 1; break;
+						case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: pending.indexComponentBytes = 2; break;
+						case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: pending.indexComponentBytes = 4; break;
+						default: pending.indexComponentBytes = 0; break;
 					}
-					CHECK(numPos != 0);
-
-					// Texcoord buffer
-					{
-						auto it_uv0 = tinyPrim.attributes.find("TEXCOORD_0");
-						uint8* uvBlob = nullptr;
-						bool bUseTempUV = false;
-						bool bFlipTexcoordY = false;
-						float* tempUV = nullptr;
-						if (it_uv0 != tinyPrim.attributes.end()) {
-							const tinygltf::Accessor& uvDesc = tinyModel->accessors[it_uv0->second];
-							const tinygltf::BufferView& uvView = tinyModel->bufferViews[uvDesc.bufferView];
-							CHECK(uvDesc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-							CHECK(uvDesc.type == TINYGLTF_TYPE_VEC2);
-
-							uvBlob = getBlobPtr(uvDesc);
-							if (uvView.byteStride == 0) {
-								bFlipTexcoordY = true;
-							} else {
-								bUseTempUV = true;
-								tempUV = new float[numPos * 2];
-								for (uint32 i = 0; i < numPos; ++i) {
-									float* curr = (float*)uvBlob;
-									tempUV[i * 2 + 0] = curr[0];
-									tempUV[i * 2 + 1] = 1.0f - curr[1];
-									uvBlob += uvView.byteStride;
-								}
-							}
-						} else {
-							bUseTempUV = true;
-							tempUV = new float[numPos * 2];
-							for (uint32 i = 0; i < numPos; ++i) {
-								tempUV[i * 2 + 0] = tempUV[i * 2 + 1] = 0.0f;
-							}
+					bool bValid = (pending.indexComponentBytes != 0) && getAccessorView(tinyModel, tinyPrim.indices, pending.indexComponentBytes, pending.indexView);
+					// Indices are consecutive, right?
+					bValid = bValid && (pending.indexView.byteStride == pending.indexComponentBytes);
+
+					// Vertex buffers
+					auto findFloatAttribute = [&](const char* name, int32 type, uint32 numComponents, GLTFAccessorView& outView) -> bool {
+						auto it = tinyPrim.attributes.find(name);
+						if (it == tinyPrim.attributes.end()) {
+							return false;
 						}
-						pending.uvBlob = bUseTempUV ? (void*)tempUV : (void*)uvBlob;
-						pending.uvLength = numPos * 2;
-						pending.bShouldFreeUV = bUseTempUV;
-						pending.bFlipTexcoordY = bFlipTexcoordY;
-						// #todo-gltf: Other UV channels
-						if (tinyPrim.attributes.find("TEXCOORD_1") != tinyPrim.attributes.end()) {
-							//LOG(LogDebug, "[GLTF] Need to parse TEXCOORD_1");
+						const tinygltf::Accessor& desc = tinyModel->accessors[it->second];
+						CHECK(desc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
+						CHECK(desc.type == type);
+						return getAccessorView(tinyModel, it->second, numComponents * sizeof(float), outView);
+					};
+					bValid = bValid && findFloatAttribute("POSITION", TINYGLTF_TYPE_VEC3, 3, pending.positionView);
+					const uint32 numPos = pending.positionView.count;
+					findFloatAttribute("TEXCOORD_0", TINYGLTF_TYPE_VEC2, 2, pending.uvView);
+					findFloatAttribute("NORMAL", TINYGLTF_TYPE_VEC3, 3, pending.normalView);
+					// NOTE: Blender does not export tangents for non-triangulated meshes.
+					findFloatAttribute("TANGENT", TINYGLTF_TYPE_VEC4, 4, pending.tangentView);
+					// #todo-gltf: Other UV channels
+					for (GLTFAccessorView* view : { &pending.uvView, &pending.normalView, &pending.tangentView }) {
+						if (view->data != nullptr && view->count != numPos) {
+							LOG(LogWarning, "[GLTF] Vertex attribute count mismatch: mesh=%u prim=%u", (uint32)meshIx, (uint32)primIx);
+							*view = GLTFAccessorView();
 						}
 					}
 
-					// Normal buffer
-					{
-						auto it_n = tinyPrim.attributes.find("NORMAL");
-						uint8* normBlob = nullptr;
-						bool bTempNormal = false;
-						float* tempN = nullptr;
-						if (it_n != tinyPrim.attributes.end()) {
-							const tinygltf::Accessor& normDesc = tinyModel->accessors[it_n->second];
-							const tinygltf::BufferView& normView = tinyModel->bufferViews[normDesc.bufferView];
-							CHECK(normDesc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-							CHECK(normDesc.type == TINYGLTF_TYPE_VEC3);
-
-							normBlob = getBlobPtr(normDesc);
-							if (normView.byteStride != 0) {
-								bTempNormal = true;
-								tempN = new float[numPos * 3];
-								for (uint32 i = 0; i < numPos; ++i) {
-									float* curr = (float*)normBlob;
-									tempN[i * 3 + 0] = curr[0];
-									tempN[i * 3 + 1] = curr[1];
-									tempN[i * 3 + 2] = curr[2];
-									normBlob += normView.byteStride;
-								}
-							}
-						}
-						pending.normalBlob = bTempNormal ? (void*)tempN : (void*)normBlob;
-						pending.normalLength = numPos * 3;
-						pending.bShouldFreeNormal = bTempNormal;
+					if (!bValid) {
+						LOG(LogError, "[GLTF] Invalid index or position accessor: mesh=%u prim=%u", (uint32)meshIx, (uint32)primIx);
+						continue;
 					}
-
-					// Tangent buffer
-					// NOTE: Blender does not export tangents for non-triangulated meshes.
-					{
-						auto it_tan = tinyPrim.attributes.find("TANGENT");
-						uint8* tanBlob = nullptr;
-						uint32 tanLength = 0;
-						bool bTempTangent = false;
-						float* tempT = nullptr;
-						if (it_tan != tinyPrim.attributes.end()) {
-							const tinygltf::Accessor& tanDesc = tinyModel->accessors[it_tan->second];
-							const tinygltf::BufferView& tanView = tinyModel->bufferViews[tanDesc.bufferView];
-							CHECK(tanDesc.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT);
-							CHECK(tanDesc.type == TINYGLTF_TYPE_VEC4);
-
-							tanBlob = getBlobPtr(tanDesc);
-							tanLength = (uint32)tanDesc.count * 4;
-							if (tanView.byteStride != 0) {
-								bTempTangent = true;
-								tempT = new float[tanLength];
-								for (uint32 i = 0; i < numPos; ++i) {
-									float* curr = (float*)tanBlob;
-									tempT[i * 3 + 0] = curr[0];
-									tempT[i * 3 + 1] = curr[1];
-									tempT[i * 3 + 2] = curr[2];
-									tempT[i * 3 + 3] = 1.0f; // #todo-geometry: tangent w
-									tanBlob += tanView.byteStride;
-								}
-							}
-						}
-						pending.tangentBlob = bTempTangent ? (void*)tempT : (void*)tanBlob;
-						pending.tangentLength = tanLength;
-						pending.bShouldFreeTangent = bTempTangent;
+					if (!areIndicesInRange(pending.indexView, pending.indexComponentBytes, numPos)) {
+						LOG(LogError, "[GLTF] Index out of range of vertices: mesh=%u prim=%u", (uint32)meshIx, (uint32)primIx);
+						continue;
 					}
-
-					pendingGeometries.push_back(pending);
+					pendingGeometries.emplace_back(std::move(pending));
 
 					if (tinyPrim.material != -1) {
 						material = materials[tinyPrim.material];
@@ -582,6 +598,30 @@ namespace pathos {
 
 			meshes.push_back(mesh);
 		}
+
+		// Conversions only run for streams that can't be referenced in place.
+		parallelFor(jobSystem, (uint32)pendingGeometries.size(), 1, [this](uint32 begin, uint32 end) {
+			for (uint32 i = begin; i < end; ++i) {
+				prepareGeometryStreams(pendingGeometries[i]);
+			}
+		});
+	}
+
+	bool GLTFLoader::getAccessorView(tinygltf::Model* tinyModel, int32 accessorIx, uint32 elementBytes, GLTFAccessorView& outView) const {
+		const tinygltf::Accessor& accessor = tinyModel->accessors[accessorIx];
+		uint64 viewBytes = 0;
+		uint32 viewStride = 0;
+		const uint8* viewData = buffers.getBufferViewData(accessor.bufferView, viewBytes, viewStride);
+		const uint64 stride = (viewStride != 0) ? viewStride : elementBytes;
+		if (viewData == nullptr || accessor.count == 0 || accessor.sparse.isSparse
+			|| accessor.byteOffset + stride * (accessor.count - 1) + elementBytes > viewBytes) {
+			LOG(LogError, "[GLTF] Accessor %d is sparse or out of range of its buffer view", accessorIx);
+			return false;
+		}
+		outView.data = viewData + accessor.byteOffset;
+		outView.count = (uint32)accessor.count;
+		outView.byteStride = (uint32)stride;
+		return true;
 	}
 
 	void GLTFLoader::parseLights(tinygltf::Model* tinyModel) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pathos/rhi/gl_handles.h"
+#include "pathos/loader/gltf_buffers.h"
 #include "pathos/smart_pointer.h"
 
 #include "badger/types/noncopyable.h"
@@ -11,6 +12,7 @@
 #include <vector>
 
 namespace tinygltf { class TinyGLTF; class Model; }
+class JobSystem;
 
 namespace pathos {
 
@@ -52,30 +54,37 @@ namespace pathos {
 		uint32 index;
 		Texture* fallbackTexture;
 	};
+	// Elements of an accessor in a mapped buffer.
+	struct GLTFAccessorView {
+		const uint8* data = nullptr;
+		uint32 count = 0;
+		uint32 byteStride = 0; // Equals the element size if tightly packed.
+	};
+
 	struct GLTFPendingGeometry {
 		assetPtr<MeshGeometry> geometry;
 
-		void* indexBlob;
-		uint32 indexLength;
-		bool bShouldFreeIndex;
-		bool bIndex16;
-
-		void* positionBlob;
-		uint32 positionLength;
-		bool bShouldFreePosition;
-
-		void* uvBlob;
-		uint32 uvLength;
-		bool bShouldFreeUV;
-		bool bFlipTexcoordY;
-
-		void* normalBlob;
-		uint32 normalLength;
-		bool bShouldFreeNormal;
-
-		void* tangentBlob;
-		uint32 tangentLength;
-		bool bShouldFreeTangent;
+		GLTFAccessorView indexView;
+		uint32 indexComponentBytes = 4; // 1, 2, or 4
+		GLTFAccessorView positionView;
+		GLTFAccessorView uvView;      // data is null if the primitive has no TEXCOORD_0.
+		GLTFAccessorView normalView;  // data is null if the primitive has no NORMAL.
+		GLTFAccessorView tangentView; // data is null if the primitive has no TANGENT.
+
+		// Set on worker threads after parsing. Tightly packed accessors are referenced in place,
+		// others point to the converted storage below.
+		const void* indexData = nullptr;
+		bool bIndex16 = false;
+		const float* positionData = nullptr;
+		const float* uvData = nullptr;
+		const float* normalData = nullptr;
+		const float* tangentData = nullptr;
+
+		std::vector<uint16> convertedIndices;
+		std::vector<float> convertedPositions;
+		std::vector<float> convertedUVs;
+		std::vector<float> convertedNormals;
+		std::vector<float> convertedTangents;
 	};
 
 	struct GLTFPendingLight {
@@ -104,8 +113,11 @@ namespace pathos {
 
 		inline bool isValid() const { return bIsValid; } // Use this to check if load was successful.
 
-		bool loadASCII(const char* inFilename);
+		// Accepts .gltf and .glb. Buffers are memory-mapped instead of being copied by tinygltf.
+		// If jobSystem is given, images are decoded and vertex streams are converted on its workers.
+		bool load(const char* inFilename, JobSystem* jobSystem = nullptr);
 
+		// Only the first call uploads; a loader shared by several requests can be attached more than once.
 		void finalizeGPUUpload();
 
 		// Craft components and attach to the actor.
@@ -118,16 +130,19 @@ namespace pathos {
 		const GLTFModelDesc& getModel(size_t ix) const { return finalModels[ix]; }
 
 	private:
-		void parseTextures(tinygltf::Model* tinyModel);
+		void parseTextures(tinygltf::Model* tinyModel, JobSystem* jobSystem);
 		void parseMaterials(tinygltf::Model* tinyModel);
-		void parseMeshes(tinygltf::Model* tinyModel);
+		void parseMeshes(tinygltf::Model* tinyModel, JobSystem* jobSystem);
+		bool getAccessorView(tinygltf::Model* tinyModel, int32 accessorIx, uint32 elementBytes, GLTFAccessorView& outView) const;
 		void parseLights(tinygltf::Model* tinyModel);
 		void checkSceneReference(tinygltf::Model* tinyModel, int32 sceneIndex, std::vector<GLTFModelDesc>& finalModels);
 
 	private:
 		uniquePtr<tinygltf::TinyGLTF> tinyLoader;
 		uniquePtr<tinygltf::Model> tinyModel;
+		GLTFBuffers buffers;
 		bool bIsValid = false;
+		bool bGPUUploaded = false;
 
 		std::vector<GLTFPendingTexture> pendingTextures;
 		std::vector<GLTFPendingTextureParameter> pendingTextureParameters;
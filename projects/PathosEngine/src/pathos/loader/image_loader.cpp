@@ -2,7 +2,11 @@
 
 #include "pathos/rhi/texture.h"
 #include "pathos/rhi/render_device.h"
+#include "pathos/loader/texture_cooker.h"
 #include "pathos/util/resource_finder.h"
+#include "pathos/util/derived_data_cache.h"
+#include "pathos/util/mapped_file.h"
+#include "pathos/util/file_system.h"
 #include "pathos/util/log.h"
 
 #include "badger/assertion/assertion.h"
@@ -111,6 +115,9 @@ namespace pathos {
 	GLenum convertStorageFormatToSRGB(GLenum storageFormat) {
 		if (storageFormat == GL_RGBA8) storageFormat = GL_SRGB8_ALPHA8;
 		else if (storageFormat == GL_RGB8) storageFormat = GL_SRGB8;
+		else if (storageFormat == GL_COMPRESSED_RGB_S3TC_DXT1_EXT) storageFormat = GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+		else if (storageFormat == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) storageFormat = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+		else if (storageFormat == GL_COMPRESSED_RGBA_BPTC_UNORM) storageFormat = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
 		return storageFormat;
 	}
 }
@@ -188,6 +195,56 @@ namespace pathos {
 		return blob;
 	}
 
+	ImageBlob* ImageUtils::loadCookedImage(const char* inFilename, const TextureCookSettings& settings, JobSystem* jobSystem /*= nullptr*/) {
+		std::string path = ResourceFinder::get().find(inFilename);
+		if (path.size() == 0) {
+			LOG(LogError, "[ImageUtils::loadCookedImage] Can't find file: %s", inFilename);
+			return nullptr;
+		}
+
+		DerivedDataCache& ddc = DerivedDataCache::get();
+		if (!ddc.isEnabled()) {
+			return loadImage(inFilename);
+		}
+
+		uint64 sourceHash;
+		{
+			MappedFile sourceFile;
+			if (!sourceFile.open(path.c_str())) {
+				LOG(LogError, "[ImageUtils::loadCookedImage] Can't read file: %s", path.c_str());
+				return nullptr;
+			}
+			sourceHash = DerivedDataCache::hashBytes(sourceFile.getData(), sourceFile.getSize());
+			sourceHash = DerivedDataCache::combineHash(sourceHash, TextureCooker::hashSettings(settings));
+		}
+
+		const std::string cacheFilepath = ddc.getCacheFilepath("texture", sourceHash, ".ptex");
+		if (pathos::pathExists(cacheFilepath.c_str())) {
+			MappedFile cookedFile;
+			if (cookedFile.open(cacheFilepath.c_str())) {
+				ImageBlob* blob = TextureCooker::createImageBlob(cookedFile.getData(), cookedFile.getSize(), sourceHash);
+				if (blob != nullptr) {
+					return blob;
+				}
+			}
+			LOG(LogWarning, "[ImageUtils::loadCookedImage] Invalid cooked texture, will be recooked: %s", cacheFilepath.c_str());
+		}
+
+		ImageBlob* sourceBlob = loadImage(inFilename);
+		if (sourceBlob == nullptr) {
+			return nullptr;
+		}
+		std::vector<uint8> cookedData;
+		if (!TextureCooker::cook(sourceBlob, settings, sourceHash, jobSystem, cookedData)) {
+			LOG(LogWarning, "[ImageUtils::loadCookedImage] Can't cook, will use the source image: %s", path.c_str());
+			return sourceBlob;
+		}
+		delete sourceBlob;
+
+		ddc.storeEntry(cacheFilepath, cookedData.data(), cookedData.size());
+		return TextureCooker::createImageBlob(cookedData.data(), cookedData.size(), sourceHash);
+	}
+
 	std::vector<ImageBlob*> ImageUtils::loadCubemapImages(const std::array<const char*, 6>& inFilenames, ECubemapImagePreference preference, const RescaleDesc& rescaleDesc /*= RescaleDesc::noScale()*/) {
 		std::vector<ImageBlob*> images(6, nullptr);
 		const int32 glslOrder[6] = { 0, 1, 2, 3, 5, 4 };
@@ -211,7 +268,7 @@ namespace pathos {
 		createParams.width                = imageBlob->width;
 		createParams.height               = imageBlob->height;
 		createParams.depth                = 1;
-		createParams.mipLevels            = mipLevels;
+		createParams.mipLevels            = (imageBlob->mips.size() > 0) ? (uint32)imageBlob->mips.size() : mipLevels;
 		createParams.glDimension          = GL_TEXTURE_2D;
 		createParams.glStorageFormat      = sRGB ? convertStorageFormatToSRGB(imageBlob->glStorageFormat) : imageBlob->glStorageFormat;
 		createParams.imageBlobs           = { imageBlob };
@@ -4,6 +4,8 @@
 #include "pathos/util/image_data.h"
 #include <array>
 
+class JobSystem;
+
 namespace pathos {
 
 	// Called at engine startup.
@@ -17,6 +19,7 @@ namespace pathos {
 namespace pathos {
 
 	class Texture;
+	struct TextureCookSettings;
 
 	/// <summary>
 	/// Specify which shader language's convention the cubemap image files follow.
@@ -53,6 +56,17 @@ namespace pathos {
 		/// <returns>A wrapper struct for the image data. Null if loading has failed.</returns>
 		static ImageBlob* loadImage(const char* inFilename, bool flipHorizontal = false, bool flipVertical = false, const RescaleDesc& rescaleDesc = RescaleDesc::noScale());
 
+		/// <summary>
+		/// Load an image cooked by TextureCooker: prebuilt mips, block compressed unless settings say otherwise.
+		/// Cooked data is cached in the derived data cache, keyed by the hash of the source file and settings.
+		/// Falls back to loadImage() if the cache is disabled or the source format can't be cooked.
+		/// </summary>
+		/// <param name="inFilename">Absolute path, or relative path recognized by ResourceFinder.</param>
+		/// <param name="settings">Compression format and how to filter mips.</param>
+		/// <param name="jobSystem">Mip filtering and compression run in parallel on it when cooking. Can be null.</param>
+		/// <returns>A wrapper struct for the image data. Null if loading has failed.</returns>
+		static ImageBlob* loadCookedImage(const char* inFilename, const TextureCookSettings& settings, JobSystem* jobSystem = nullptr);
+
 		/// <summary>
 		/// Load cubemap image data from 6 image files.
 		/// </summary>
@@ -66,7 +80,7 @@ namespace pathos {
 		/// Create a 2D texture from an image blob.
 		/// </summary>
 		/// <param name="imageBlob">Image data.</param>
-		/// <param name="mipLevels">The number of mip levels.</param>
+		/// <param name="mipLevels">The number of mip levels. Ignored if the image has a prebuilt mip chain.</param>
 		/// <param name="sRGB">Image data is considered to be in sRGB color space.</param>
 		/// <param name="autoDestroyBlob">Automatically deallocate `imageBlob` after it's uploaded to GPU. If false, you should free it manually.</param>
 		/// <param name="debugName">Debug name of the GL texture that will be created.</param>
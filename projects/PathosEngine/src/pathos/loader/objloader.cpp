@@ -3,13 +3,20 @@
 #include "pathos/rhi/render_device.h"
 #include "pathos/material/material.h"
 #include "pathos/loader/objloader.h"
+#include "pathos/loader/vertex_dedup.h"
+#include "pathos/mesh/mesh_optimizer.h"
 #include "pathos/util/resource_finder.h"
+#include "pathos/util/derived_data_cache.h"
+#include "pathos/util/file_system.h"
+#include "pathos/util/cpu_profiler.h"
 #include "pathos/util/log.h"
+#include "pathos/console.h"
 
-#include <unordered_map>
+#include "badger/system/job_system.h"
+#include <atomic>
+#include <algorithm>
 #include <type_traits>
-#define GLM_ENABLE_EXPERIMENTAL
-#include <glm/gtx/hash.hpp>
+#include <sstream>
 
 // 0: Just use fallback material
 // 1: Assert if invalid material
@@ -26,33 +33,53 @@ float PhongSpecularToRoughness(const vector3& specularPower, float shininess) {
 	return std::sqrt(2.0f / (shininess * intensity + 2.0f));
 }
 
-// Vertex deduplication: https://vulkan-tutorial.com/Loading_models
-struct MetaVertex {
-	vector3 position;
-	vector2 texcoord;
-	vector3 normal;
-
-	MetaVertex() = default;
-
-	bool operator==(const MetaVertex& other) const {
-		return position == other.position
-			&& texcoord == other.texcoord
-			&& normal == other.normal;
+// Faces of a shape are reconstructed in chunks of this many faces.
+// Attributes of a chunk are gathered and hashed in parallel, then inserted to the dedup table in order.
+#define RECONSTRUCT_CHUNK_FACES     65536
+#define RECONSTRUCT_GATHER_BATCH    8192
+
+// Collect 'mtllib' statements so that materials can be parsed without the geometry.
+static std::string extractMaterialLibraryLines(const std::vector<uint8>& objBytes) {
+	std::string lines;
+	const char* p = reinterpret_cast<const char*>(objBytes.data());
+	const char* end = p + objBytes.size();
+	while (p < end) {
+		const char* lineEnd = p;
+		while (lineEnd < end && *lineEnd != '\n') ++lineEnd;
+		const char* q = p;
+		while (q < lineEnd && (*q == ' ' || *q == '\t')) ++q;
+		if (lineEnd - q > 7 && ::strncmp(q, "mtllib", 6) == 0 && (q[6] == ' ' || q[6] == '\t')) {
+			lines.append(q, lineEnd);
+			lines.push_back('\n');
+		}
+		p = lineEnd + 1;
 	}
-};
-namespace std {
-	template<> struct std::hash<MetaVertex> {
-		size_t operator()(MetaVertex const& vertex) const {
-			return (
-				std::hash<vector3>()(vertex.position) ^
-				(std::hash<vector2>()(vertex.texcoord) << 1) ^
-				((std::hash<vector3>()(vertex.normal) << 1) >> 1));
+	return lines;
+}
+
+// Cache key of cooked geometry. Material libraries are part of the key as they decide material IDs.
+static uint64 computeSourceHash(const std::vector<uint8>& objBytes, const std::string& mtllibLines, const std::string& mtlDir) {
+	using namespace pathos;
+	uint64 hash = DerivedDataCache::hashBytes(objBytes.data(), objBytes.size(), COOKED_MESH_VERSION);
+
+	std::istringstream stream(mtllibLines);
+	std::string token;
+	std::vector<uint8> mtlBytes;
+	while (stream >> token) {
+		if (token == "mtllib") {
+			continue;
 		}
-	};
+		if (readFileBytes((mtlDir + token).c_str(), mtlBytes)) {
+			hash = DerivedDataCache::combineHash(hash, DerivedDataCache::hashBytes(mtlBytes.data(), mtlBytes.size()));
+		}
+	}
+	return hash;
 }
 
 namespace pathos {
 
+	static ConsoleVariable<int32> cvarPackedVaryings("r.mesh.packedVaryings", 0, "(read only) Store uv, normal, and tangent of OBJ meshes in packed formats (0 = float, 1 = half/snorm10)");
+
 	OBJLoader::~OBJLoader() {
 		unload();
 	}
@@ -67,17 +94,52 @@ namespace pathos {
 		return it->second;
 	}
 
-	bool OBJLoader::load(const char* inObjFile, const char* inMtlDir) {
+	bool OBJLoader::load(const char* inObjFile, const char* inMtlDir, JobSystem* jobSystem) {
 		objFile = ResourceFinder::get().find(inObjFile);
 		mtlDir = ResourceFinder::get().find(inMtlDir);
 
 		LOG(LogInfo, "Loading .obj file: %s", objFile.data());
 
-		// Read data using tinyobjloader
+		std::vector<uint8> objBytes;
+		if (!readFileBytes(objFile.c_str(), objBytes)) {
+			LOG(LogError, "Error while loading OBJ file: can't read %s", objFile.data());
+			bIsValid = false;
+			return bIsValid;
+		}
+		const std::string mtllibLines = extractMaterialLibraryLines(objBytes);
+		const uint64 sourceHash = computeSourceHash(objBytes, mtllibLines, mtlDir);
+		objBytes.clear();
+		objBytes.shrink_to_fit();
+
+		// Try cooked geometry first.
+		DerivedDataCache& ddc = DerivedDataCache::get();
+		std::string cacheFilepath;
+		bool bCacheHit = false;
+		if (ddc.isEnabled()) {
+			cacheFilepath = ddc.getCacheFilepath("mesh", sourceHash, ".pmesh");
+			if (pathos::pathExists(cacheFilepath.c_str()) && mappedCookedData.open(cacheFilepath.c_str())) {
+				bCacheHit = cookedMesh.initialize(mappedCookedData.getData(), mappedCookedData.getSize(), sourceHash);
+				if (!bCacheHit) {
+					LOG(LogWarning, "Invalid cooked mesh, will be recooked: %s", cacheFilepath.c_str());
+					mappedCookedData.close();
+				}
+			}
+		}
+
+		// Read data using tinyobjloader. Only materials are parsed if the geometry is cached.
 		std::string warn, err;
-		bool bLoadSuccessful = tinyobj::LoadObj(
-			&tiny_attrib, &tiny_shapes, &tiny_materials, &warn, &err,
-			objFile.c_str(), mtlDir.c_str());
+		bool bLoadSuccessful;
+		if (bCacheHit) {
+			std::istringstream mtllibStream(mtllibLines);
+			tinyobj::MaterialFileReader mtlReader(mtlDir);
+			bLoadSuccessful = tinyobj::LoadObj(
+				&tiny_attrib, &tiny_shapes, &tiny_materials, &warn, &err,
+				&mtllibStream, &mtlReader);
+		} else {
+			bLoadSuccessful = tinyobj::LoadObj(
+				&tiny_attrib, &tiny_shapes, &tiny_materials, &warn, &err,
+				objFile.c_str(), mtlDir.c_str());
+		}
 
 		if (!warn.empty()) {
 			LOG(LogWarning, "Warning while loading OBJ file: %s", warn.data());
@@ -89,11 +151,21 @@ namespace pathos {
 			bIsValid = false;
 			return bIsValid;
 		}
-		LOG(LogInfo, "    Number of shapes: %d", (int32)tiny_shapes.size());
-		LOG(LogInfo, "    Number of materials: %d", (int32)tiny_materials.size());
 
 		analyzeMaterials();
-		reconstructShapes();
+		if (!bCacheHit && !cookShapes(sourceHash, cacheFilepath, jobSystem)) {
+			LOG(LogError, "Error while loading OBJ file: face indices are out of range: %s", objFile.data());
+			bIsValid = false;
+			return bIsValid;
+		}
+
+		shapeNames.resize(cookedMesh.getNumShapes());
+		for (uint32 i = 0; i < cookedMesh.getNumShapes(); ++i) {
+			shapeNames[i] = cookedMesh.getShapeName(i);
+		}
+
+		LOG(LogInfo, "    Number of shapes: %d%s", (int32)shapeNames.size(), bCacheHit ? " (cooked)" : "");
+		LOG(LogInfo, "    Number of materials: %d", (int32)tiny_materials.size());
 
 		bIsValid = true;
 		return bIsValid;
@@ -112,11 +184,13 @@ namespace pathos {
 			if (it.second.roughnessBlob != nullptr) blobsToDestroy.insert(it.second.roughnessBlob);
 			if (it.second.metallicBlob != nullptr) blobsToDestroy.insert(it.second.metallicBlob);
 		}
-		ENQUEUE_DEFERRED_RENDER_COMMAND([blobsToDestroy](RenderCommandList& cmdList) {
-			for (ImageBlob* blob : blobsToDestroy) {
-				cmdList.registerDeferredCleanup(blob);
-			}
-		});
+		if (blobsToDestroy.size() > 0) {
+			ENQUEUE_DEFERRED_RENDER_COMMAND([blobsToDestroy](RenderCommandList& cmdList) {
+				for (ImageBlob* blob : blobsToDestroy) {
+					cmdList.registerDeferredCleanup(blob);
+				}
+			});
+		}
 
 		mtlDir.clear();
 		tiny_shapes.clear();
@@ -124,7 +198,11 @@ namespace pathos {
 		tiny_attrib.normals.clear();
 		tiny_attrib.texcoords.clear();
 		tiny_attrib.vertices.clear();
-		pendingShapes.clear();
+		cookedMesh = CookedMesh();
+		mappedCookedData.close();
+		cookedData.clear();
+		cookedData.shrink_to_fit();
+		shapeNames.clear();
 		materials.clear();
 		cachedImageDB.clear();
 		pendingTextureData.clear();
@@ -153,129 +231,243 @@ namespace pathos {
 
 			materials.push_back(M);
 		}
-
-		// used for shapes whose material id is invalid
-		defaultMaterial = Material::createMaterialInstance("solid_color");
-		defaultMaterial->setConstantParameter("albedo", vector3(0.0f, 0.9f, 0.0f));
-		defaultMaterial->setConstantParameter("metallic", 0.0f);
-		defaultMaterial->setConstantParameter("roughness", 0.9f);
-		defaultMaterial->setConstantParameter("emissive", vector3(0.0f));
 	}
 
-	void OBJLoader::reconstructShapes() {
-		pendingShapes.clear();
-
-		for (size_t i = 0; i < tiny_shapes.size(); ++i) {
-			const tinyobj::mesh_t& srcMesh = tiny_shapes[i].mesh;
-			PendingShape dst;
+	// Faces of a shape that use the same material.
+	struct OBJSectionBucket {
+		uint32 shapeIndex;
+		int32 materialID;
+		std::vector<uint32> faces;
+
+		// Reconstructed section
+		std::vector<GLfloat> positions;
+		std::vector<GLfloat> texcoords;
+		std::vector<GLfloat> normals; // Empty if some vertices have no normal
+		std::vector<GLuint> indices;
+	};
 
-			// int32 = face material id
-			// uint32 = vertex index
-			std::map<int32, std::unordered_map<MetaVertex, uint32>> uniqueVertices;
-			std::map<int32, std::vector<MetaVertex>> metaVertices;
-			std::set<int32> normalInvalidFlags;
+	static bool isValidOBJIndex(const tinyobj::attrib_t& attrib, const tinyobj::index_t& idx) {
+		// tinyobjloader doesn't check face indices against the number of attributes.
+		return idx.vertex_index >= 0 && (size_t)idx.vertex_index * 3 + 2 < attrib.vertices.size()
+			&& (idx.texcoord_index < 0 || (size_t)idx.texcoord_index * 2 + 1 < attrib.texcoords.size())
+			&& (idx.normal_index < 0 || (size_t)idx.normal_index * 3 + 2 < attrib.normals.size());
+	}
 
-#if VERBOSE_LOG
-			LOG(LogDebug, "Analyzing OBJ shape[%d]: %s", i, src.name.data());
-#endif
+	static void reconstructBucket(const tinyobj::attrib_t& attrib, const tinyobj::mesh_t& srcMesh, OBJSectionBucket& bucket, JobSystem* jobSystem) {
+		const uint32 numFaces = (uint32)bucket.faces.size();
+		const uint32 numCorners = numFaces * 3;
+
+		VertexDedupTable dedupTable;
+		dedupTable.reset(numCorners);
+		bucket.indices.resize(numCorners);
+
+		const uint32 chunkFaces = std::min(numFaces, (uint32)RECONSTRUCT_CHUNK_FACES);
+		std::vector<MetaVertex> corners(chunkFaces * 3);
+		std::vector<uint32> hashes(chunkFaces * 3);
+		std::atomic<bool> bMissingNormals(false);
+
+		for (uint32 chunkBegin = 0; chunkBegin < numFaces; chunkBegin += chunkFaces) {
+			const uint32 chunkEnd = std::min(chunkBegin + chunkFaces, numFaces);
+
+			parallelFor(jobSystem, chunkEnd - chunkBegin, RECONSTRUCT_GATHER_BATCH,
+				[&](uint32 begin, uint32 end) {
+					bool bMissingNormalsInBatch = false;
+					for (uint32 f = begin; f < end; ++f) {
+						const uint32 srcFace = bucket.faces[chunkBegin + f];
+						for (uint32 v = 0; v < 3; ++v) {
+							const tinyobj::index_t idx = srcMesh.indices[srcFace * 3 + v];
+							MetaVertex& metaV = corners[f * 3 + v];
+
+							// position data (should exist)
+							metaV.position = vector3(
+								attrib.vertices[3 * idx.vertex_index + 0],
+								attrib.vertices[3 * idx.vertex_index + 1],
+								attrib.vertices[3 * idx.vertex_index + 2]);
+
+							// texcoord data (optional)
+							metaV.texcoord = vector2(0.0f);
+							if (idx.texcoord_index >= 0) {
+								metaV.texcoord.x = attrib.texcoords[2 * idx.texcoord_index + 0];
+								metaV.texcoord.y = attrib.texcoords[2 * idx.texcoord_index + 1];
+							}
+
+							// normal data (optional)
+							metaV.normal = vector3(0.0f);
+							if (idx.normal_index >= 0) {
+								metaV.normal.x = attrib.normals[3 * idx.normal_index + 0];
+								metaV.normal.y = attrib.normals[3 * idx.normal_index + 1];
+								metaV.normal.z = attrib.normals[3 * idx.normal_index + 2];
+							} else {
+								bMissingNormalsInBatch = true;
+							}
+
+							hashes[f * 3 + v] = VertexDedupTable::hashVertex(metaV);
+						}
+					}
+					if (bMissingNormalsInBatch) {
+						bMissingNormals = true;
+					}
+				}
+			);
 
-			for (size_t f = 0; f < srcMesh.num_face_vertices.size(); ++f) {
-				int32 faceMaterialID = (int32)(srcMesh.material_ids[f]);
-#if WARN_INVALID_FACE_MARTERIAL
-				CHECK(faceMaterialID >= 0); // invalid material id
-#endif
-				dst.materialIDs.insert(faceMaterialID);
+			// Insertion order decides vertex order, so it's serial.
+			GLuint* outIndices = bucket.indices.data() + chunkBegin * 3;
+			const uint32 numChunkCorners = (chunkEnd - chunkBegin) * 3;
+			for (uint32 i = 0; i < numChunkCorners; ++i) {
+				outIndices[i] = dedupTable.findOrAdd(corners[i], hashes[i]);
 			}
+		}
 
-			size_t numMaterials = dst.materialIDs.size();
-			size_t index_offset = 0;
-
+		const std::vector<MetaVertex>& vertices = dedupTable.getVertices();
+		const size_t numVertices = vertices.size();
+		bucket.positions.resize(numVertices * 3);
+		bucket.texcoords.resize(numVertices * 2);
+		if (!bMissingNormals) {
+			bucket.normals.resize(numVertices * 3);
+		}
+		for (size_t i = 0; i < numVertices; ++i) {
+			::memcpy(&bucket.positions[i * 3], &vertices[i].position, sizeof(vector3));
+			::memcpy(&bucket.texcoords[i * 2], &vertices[i].texcoord, sizeof(vector2));
+			if (!bMissingNormals) {
+				::memcpy(&bucket.normals[i * 3], &vertices[i].normal, sizeof(vector3));
+			}
+		}
 #if VERBOSE_LOG
-			LOG(LogDebug, "Number of materials for this shape: %d", numMaterials);
+		if (bMissingNormals) {
+			LOG(LogWarning, "(Material ID = %d) Vertex normals are invalid and will be recalculated", bucket.materialID);
+		}
 #endif
 
-			for (size_t f = 0u; f < srcMesh.num_face_vertices.size(); ++f) {
-				int32 fv = srcMesh.num_face_vertices[f];
-				CHECK(fv == 3);
-
-				int32 materialID = srcMesh.material_ids[f];
-
-				std::vector<GLfloat>& positionBuffer = dst.positions[materialID];
-				std::vector<GLfloat>& texcoordBuffer = dst.texcoords[materialID];
-				std::vector<GLfloat>& normalBuffer = dst.normals[materialID];
-				std::vector<GLuint>& indexBuffer = dst.indices[materialID];
-
-				for (int32 v = 0; v < fv; ++v) {
-					tinyobj::index_t idx = srcMesh.indices[index_offset + v];
-
-					// position data (should exist)
-					float posX = tiny_attrib.vertices[3 * idx.vertex_index + 0];
-					float posY = tiny_attrib.vertices[3 * idx.vertex_index + 1];
-					float posZ = tiny_attrib.vertices[3 * idx.vertex_index + 2];
+		// Cooked data keeps this order, so it's paid only once per source file.
+		MeshOptimizer::optimizeVertexCache(bucket.indices.data(), numCorners, (uint32)numVertices);
+		std::vector<uint32> remap;
+		const uint32 numUsedVertices = MeshOptimizer::optimizeVertexFetch(bucket.indices.data(), numCorners, (uint32)numVertices, remap);
+		MeshOptimizer::remapVertexStream(bucket.positions, 3, remap, numUsedVertices);
+		MeshOptimizer::remapVertexStream(bucket.texcoords, 2, remap, numUsedVertices);
+		if (!bMissingNormals) {
+			MeshOptimizer::remapVertexStream(bucket.normals, 3, remap, numUsedVertices);
+		}
+	}
 
-					// texcoord data (optional)
-					float texU = 0.0f;
-					float texV = 0.0f;
-					if (idx.texcoord_index >= 0) {
-						texU = tiny_attrib.texcoords[2 * idx.texcoord_index + 0];
-						texV = tiny_attrib.texcoords[2 * idx.texcoord_index + 1];
+	bool OBJLoader::reconstructShapes(
+		const tinyobj::attrib_t& attrib,
+		const std::vector<tinyobj::shape_t>& shapes,
+		JobSystem* jobSystem,
+		CookedMeshWriter& writer)
+	{
+		SCOPED_CPU_COUNTER(ReconstructOBJShapes);
+
+		const uint32 numShapes = (uint32)shapes.size();
+		std::vector<std::vector<OBJSectionBucket>> shapeBuckets(numShapes);
+		std::atomic<bool> bInvalidIndices(false);
+
+		// Split faces of each shape by material.
+		parallelFor(jobSystem, numShapes, 1,
+			[&](uint32 begin, uint32 end) {
+				for (uint32 shapeIx = begin; shapeIx < end; ++shapeIx) {
+					const tinyobj::mesh_t& srcMesh = shapes[shapeIx].mesh;
+					const uint32 numFaces = (uint32)srcMesh.num_face_vertices.size();
+
+					for (const tinyobj::index_t& idx : srcMesh.indices) {
+						if (!isValidOBJIndex(attrib, idx)) {
+							bInvalidIndices = true;
+							break;
+						}
 					}
 
-					// normal data (optional)
-					float nx = 0.0f, ny = 0.0f, nz = 0.0f;
-					if (idx.normal_index >= 0) {
-						nx = tiny_attrib.normals[3 * idx.normal_index + 0];
-						ny = tiny_attrib.normals[3 * idx.normal_index + 1];
-						nz = tiny_attrib.normals[3 * idx.normal_index + 2];
-					} else {
-						normalInvalidFlags.insert(materialID);
+					std::vector<int32> materialIDs;
+					for (uint32 f = 0; f < numFaces; ++f) {
+						CHECK(srcMesh.num_face_vertices[f] == 3);
+						const int32 faceMaterialID = srcMesh.material_ids[f];
+#if WARN_INVALID_FACE_MARTERIAL
+						CHECK(faceMaterialID >= 0); // invalid material id
+#endif
+						if (std::find(materialIDs.begin(), materialIDs.end(), faceMaterialID) == materialIDs.end()) {
+							materialIDs.push_back(faceMaterialID);
+						}
 					}
-
-					MetaVertex metaV;
-					metaV.position = vector3(posX, posY, posZ);
-					metaV.texcoord = vector2(texU, texV);
-					metaV.normal = vector3(nx, ny, nz);
-
-					if (uniqueVertices[materialID].count(metaV) == 0) {
-						uniqueVertices[materialID][metaV] = (uint32)metaVertices[materialID].size();
-						metaVertices[materialID].push_back(metaV);
-
-						positionBuffer.push_back(posX);
-						positionBuffer.push_back(posY);
-						positionBuffer.push_back(posZ);
-						texcoordBuffer.push_back(texU);
-						texcoordBuffer.push_back(texV);
-						normalBuffer.push_back(nx);
-						normalBuffer.push_back(ny);
-						normalBuffer.push_back(nz);
+					std::sort(materialIDs.begin(), materialIDs.end());
+
+					std::vector<OBJSectionBucket>& buckets = shapeBuckets[shapeIx];
+					buckets.resize(materialIDs.size());
+					std::vector<uint32> faceCounts(materialIDs.size(), 0);
+					std::vector<uint32> faceBuckets(numFaces);
+					for (uint32 f = 0; f < numFaces; ++f) {
+						auto it = std::lower_bound(materialIDs.begin(), materialIDs.end(), srcMesh.material_ids[f]);
+						faceBuckets[f] = (uint32)(it - materialIDs.begin());
+						faceCounts[faceBuckets[f]] += 1;
+					}
+					for (size_t i = 0; i < buckets.size(); ++i) {
+						buckets[i].shapeIndex = shapeIx;
+						buckets[i].materialID = materialIDs[i];
+						buckets[i].faces.reserve(faceCounts[i]);
+					}
+					for (uint32 f = 0; f < numFaces; ++f) {
+						buckets[faceBuckets[f]].faces.push_back(f);
 					}
-
-					indexBuffer.push_back(uniqueVertices[materialID][metaV]);
 				}
-				index_offset += fv;
 			}
+		);
+		if (bInvalidIndices) {
+			return false;
+		}
 
-			for (const auto& it : dst.normals) {
-				int32 mat = it.first;
-				if (normalInvalidFlags.find(mat) != normalInvalidFlags.end()) {
-					dst.normals[mat].clear();
-#if VERBOSE_LOG
-					LOG(LogWarning, "(Material ID = %d) Vertex normals are invalid and will be recalculated", mat);
-#endif
+		std::vector<OBJSectionBucket*> allBuckets;
+		for (std::vector<OBJSectionBucket>& buckets : shapeBuckets) {
+			for (OBJSectionBucket& bucket : buckets) {
+				allBuckets.push_back(&bucket);
+			}
+		}
+		// Start from large buckets for better load balancing.
+		std::vector<OBJSectionBucket*> sortedBuckets = allBuckets;
+		std::stable_sort(sortedBuckets.begin(), sortedBuckets.end(),
+			[](const OBJSectionBucket* a, const OBJSectionBucket* b) { return a->faces.size() > b->faces.size(); });
+
+		parallelFor(jobSystem, (uint32)sortedBuckets.size(), 1,
+			[&](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					OBJSectionBucket* bucket = sortedBuckets[i];
+					reconstructBucket(attrib, shapes[bucket->shapeIndex].mesh, *bucket, jobSystem);
 				}
 			}
+		);
+
+		for (uint32 shapeIx = 0; shapeIx < numShapes; ++shapeIx) {
+			writer.beginShape(shapes[shapeIx].name);
+			for (OBJSectionBucket& bucket : shapeBuckets[shapeIx]) {
+				writer.addSection(bucket.materialID, bucket.positions, bucket.texcoords, bucket.normals, bucket.indices);
+				// Release early; the writer has its own copy.
+				bucket = OBJSectionBucket();
+			}
+		}
+		return true;
+	}
 
-			pendingShapes.emplace_back(dst);
+	bool OBJLoader::cookShapes(uint64 sourceHash, const std::string& cacheFilepath, JobSystem* jobSystem) {
+		CookedMeshWriter writer;
+		if (!reconstructShapes(tiny_attrib, tiny_shapes, jobSystem, writer)) {
+			return false;
+		}
 
-#if VERBOSE_LOG
-			LOG(LogDebug, "Shape has been parsed");
-#endif
+		writer.finalize(sourceHash, cookedData);
+		bool bValidData = cookedMesh.initialize(cookedData.data(), cookedData.size(), sourceHash);
+		CHECKF(bValidData, "CookedMeshWriter generated invalid data");
+
+		if (cacheFilepath.size() > 0) {
+			DerivedDataCache::get().storeEntry(cacheFilepath, cookedData.data(), cookedData.size());
 		}
+
+		// Raw attributes are not needed anymore.
+		tiny_shapes.clear();
+		tiny_attrib.vertices.clear();
+		tiny_attrib.normals.clear();
+		tiny_attrib.texcoords.clear();
+		return true;
 	}
 
 	assetPtr<StaticMesh> OBJLoader::craftMeshFrom(const std::string& shapeName) {
-		for (size_t i = 0; i < tiny_shapes.size(); ++i) {
-			if (tiny_shapes[i].name == shapeName) {
+		for (size_t i = 0; i < shapeNames.size(); ++i) {
+			if (shapeNames[i] == shapeName) {
 				return craftMeshFrom(static_cast<uint32>(i));
 			}
 		}
@@ -285,78 +477,53 @@ namespace pathos {
 		return craftMesh(shapeIndex, shapeIndex);
 	}
 	assetPtr<StaticMesh> OBJLoader::craftMeshFromAllShapes(bool bMergeShapesIfSameMaterial) {
-		return craftMesh(0, static_cast<uint32>(pendingShapes.size() - 1), bMergeShapesIfSameMaterial);
+		return craftMesh(0, numShapes() - 1, bMergeShapesIfSameMaterial);
 	}
 
 	assetPtr<StaticMesh> OBJLoader::craftMesh(uint32 from, uint32 to, bool bMergeShapesIfSameMaterial) {
-		CHECK(0 <= from && from < pendingShapes.size());
-		CHECK(0 <= to && to < pendingShapes.size());
+		CHECK(0 <= from && from < numShapes());
+		CHECK(0 <= to && to < numShapes());
 		CHECK(from <= to);
 
 		assetPtr<StaticMesh> mesh(new StaticMesh);
 
 		if (bMergeShapesIfSameMaterial) {
-			std::map<int32, std::vector<uint32>> materialToShapes;
+			// Key: materialID, value: section indices
+			std::map<int32, std::vector<uint32>> materialToSections;
 			for (uint32 shapeIx = from; shapeIx <= to; ++shapeIx) {
-				const PendingShape& shape = pendingShapes[shapeIx];
-				for (int32 materialID : shape.materialIDs) {
-					materialToShapes[materialID].push_back(shapeIx);
+				const CookedMeshShape& shape = cookedMesh.getShape(shapeIx);
+				for (uint32 sectionIx = shape.firstSection; sectionIx < shape.firstSection + shape.numSections; ++sectionIx) {
+					materialToSections[cookedMesh.getSection(sectionIx).materialID].push_back(sectionIx);
 				}
 			}
-			for (auto it = materialToShapes.begin(); it != materialToShapes.end(); ++it) {
+			for (auto it = materialToSections.begin(); it != materialToSections.end(); ++it) {
 				const int32 materialID = it->first;
-				const std::vector<uint32>& shapeIxArray = it->second;
+				const std::vector<uint32>& sectionIxArray = it->second;
 
 				// Merged buffers
 				std::vector<float> positions, normals, texcoords;
 				std::vector<uint32> indices;
 				bool bValidNormal = true;
-				for (uint32 shapeIx : shapeIxArray) {
-					bValidNormal = bValidNormal && pendingShapes[shapeIx].containsValidNormals(materialID);
+				for (uint32 sectionIx : sectionIxArray) {
+					bValidNormal = bValidNormal && cookedMesh.getNormals(cookedMesh.getSection(sectionIx)) != nullptr;
 				}
 
-#if 0
-				size_t posLength = 0, normLength = 0, texLength = 0, ixLength = 0;
-				for (uint32 shapeIx : shapeIxArray) {
-					posLength += pendingShapes[shapeIx].positions[materialID].size();
-					normLength += pendingShapes[shapeIx].normals[materialID].size();
-					texLength += pendingShapes[shapeIx].texcoords[materialID].size();
-					ixLength += pendingShapes[shapeIx].indices[materialID].size();
-				}
-
-				positions.resize(posLength);
-				normals.resize(normLength);
-				texcoords.resize(texLength);
-				indices.resize(ixLength);
-
-				posLength = normLength = texLength = ixLength = 0;
-				for (uint32 shapeIx : shapeIxArray) {
-					auto& partPositions = pendingShapes[shapeIx].positions[materialID];
-					auto& partNormals = pendingShapes[shapeIx].normals[materialID];
-					auto& partTexcoords = pendingShapes[shapeIx].texcoords[materialID];
-					auto& partIndices = pendingShapes[shapeIx].indices[materialID];
-					positions.insert(positions.begin() + posLength, partPositions.begin(), partPositions.end());
-					normals.insert(normals.begin() + normLength, partNormals.begin(), partNormals.end());
-					texcoords.insert(texcoords.begin() + texLength, partTexcoords.begin(), partTexcoords.end());
-					indices.insert(indices.begin() + ixLength, partIndices.begin(), partIndices.end());
-					for (size_t ix = ixLength; ix < ixLength + partIndices.size(); ++ix) {
-						indices[ix] += (uint32)(posLength / 3);
-					}
-					posLength += partPositions.size();
-					normLength += partNormals.size();
-					texLength += partTexcoords.size();
-					ixLength += partIndices.size();
+				uint32 numCorners = 0;
+				for (uint32 sectionIx : sectionIxArray) {
+					numCorners += cookedMesh.getSection(sectionIx).numIndices;
 				}
-#else
-				std::unordered_map<MetaVertex, uint32> uniqueVertices;
-				std::vector<MetaVertex> metaVertices;
-				for (uint32 shapeIx : shapeIxArray) {
-					auto& partPositions = pendingShapes[shapeIx].positions[materialID];
-					auto& partNormals = pendingShapes[shapeIx].normals[materialID];
-					auto& partTexcoords = pendingShapes[shapeIx].texcoords[materialID];
-					auto& partIndices = pendingShapes[shapeIx].indices[materialID];
-
-					for (uint32 i : partIndices) {
+				VertexDedupTable dedupTable;
+				dedupTable.reset(numCorners);
+				indices.reserve(numCorners);
+
+				for (uint32 sectionIx : sectionIxArray) {
+					const CookedMeshSection& section = cookedMesh.getSection(sectionIx);
+					const float* partPositions = cookedMesh.getPositions(section);
+					const float* partNormals = cookedMesh.getNormals(section);
+					const float* partTexcoords = cookedMesh.getTexcoords(section);
+
+					for (uint32 k = 0; k < section.numIndices; ++k) {
+						const uint32 i = cookedMesh.getIndex(section, k);
 						MetaVertex metaV;
 						metaV.position = vector3(partPositions[i * 3 + 0], partPositions[i * 3 + 1], partPositions[i * 3 + 2]);
 						metaV.texcoord = vector2(partTexcoords[i * 2 + 0], partTexcoords[i * 2 + 1]);
@@ -365,27 +532,25 @@ namespace pathos {
 						} else {
 							metaV.normal = vector3(0.0f);
 						}
-
-						if (uniqueVertices.count(metaV) == 0) {
-							uniqueVertices[metaV] = (uint32)metaVertices.size();
-							metaVertices.push_back(metaV);
-
-							positions.push_back(metaV.position.x);
-							positions.push_back(metaV.position.y);
-							positions.push_back(metaV.position.z);
-							texcoords.push_back(metaV.texcoord.x);
-							texcoords.push_back(metaV.texcoord.y);
-							normals.push_back(metaV.normal.x);
-							normals.push_back(metaV.normal.y);
-							normals.push_back(metaV.normal.z);
-						}
-						indices.push_back(uniqueVertices[metaV]);
+						indices.push_back(dedupTable.findOrAdd(metaV));
 					}
 				}
-#endif
+
+				const std::vector<MetaVertex>& vertices = dedupTable.getVertices();
+				positions.resize(vertices.size() * 3);
+				texcoords.resize(vertices.size() * 2);
+				normals.resize(vertices.size() * 3);
+				for (size_t i = 0; i < vertices.size(); ++i) {
+					::memcpy(&positions[i * 3], &vertices[i].position, sizeof(vector3));
+					::memcpy(&texcoords[i * 2], &vertices[i].texcoord, sizeof(vector2));
+					::memcpy(&normals[i * 3], &vertices[i].normal, sizeof(vector3));
+				}
 
 				assetPtr<MeshGeometry> geom = makeAssetPtr<MeshGeometry>();
 				geom->initializeVertexLayout(MeshGeometry::EVertexAttributes::All);
+				if (cvarPackedVaryings.getInt() != 0) {
+					geom->setVaryingFormat(MeshGeometry::EVaryingFormat::Packed);
+				}
 				geom->updatePositionData(&positions[0], static_cast<uint32>(positions.size()));
 				geom->updateUVData(&texcoords[0], static_cast<uint32>(texcoords.size()));
 				geom->updateIndexData(&indices[0], static_cast<uint32>(indices.size()));
@@ -400,30 +565,34 @@ namespace pathos {
 			}
 		} else {
 			for (uint32 i = from; i <= to; ++i) {
-				PendingShape& shape = pendingShapes[i];
+				const CookedMeshShape& shape = cookedMesh.getShape(i);
 
-				for (int32 materialID : shape.materialIDs) {
+				for (uint32 sectionIx = shape.firstSection; sectionIx < shape.firstSection + shape.numSections; ++sectionIx) {
+					const CookedMeshSection& section = cookedMesh.getSection(sectionIx);
 #if WARN_INVALID_FACE_MARTERIAL
-					CHECK(materialID >= 0);
+					CHECK(section.materialID >= 0);
 #endif
-					auto& positions = shape.positions[materialID];
-					auto& normals = shape.normals[materialID];
-					auto& texcoords = shape.texcoords[materialID];
-					auto& indices = shape.indices[materialID];
-
+					// Cooked streams are uploaded as they are.
 					assetPtr<MeshGeometry> geom = makeAssetPtr<MeshGeometry>();
 					geom->initializeVertexLayout(MeshGeometry::EVertexAttributes::All);
-					geom->updatePositionData(&positions[0], static_cast<uint32>(positions.size()));
-					geom->updateUVData(&texcoords[0], static_cast<uint32>(texcoords.size()));
-					geom->updateIndexData(&indices[0], static_cast<uint32>(indices.size()));
-					if (shape.containsValidNormals(materialID)) {
-						geom->updateNormalData(&normals[0], static_cast<uint32>(normals.size()));
+					if (cvarPackedVaryings.getInt() != 0) {
+						geom->setVaryingFormat(MeshGeometry::EVaryingFormat::Packed);
+					}
+					geom->updatePositionData(cookedMesh.getPositions(section), section.numVertices * 3);
+					geom->updateUVData(cookedMesh.getTexcoords(section), section.numVertices * 2);
+					if (section.flags & COOKED_SECTION_INDEX16) {
+						geom->updateIndex16Data(cookedMesh.getIndices16(section), section.numIndices);
+					} else {
+						geom->updateIndexData(cookedMesh.getIndices32(section), section.numIndices);
+					}
+					if (const float* normals = cookedMesh.getNormals(section)) {
+						geom->updateNormalData(normals, section.numVertices * 3);
 					} else {
 						geom->calculateNormals();
 					}
 					geom->calculateTangentBasis();
 
-					mesh->addSection(0, geom, getMaterial(materialID));
+					mesh->addSection(0, geom, getMaterial(section.materialID));
 				}
 			}
 		}
@@ -514,6 +683,14 @@ namespace pathos {
 	assetPtr<Material> OBJLoader::getMaterial(int32 index) {
 		CHECK(-1 <= index && index < (int32)materials.size());
 		if (index == -1) {
+			// used for shapes whose material id is invalid
+			if (defaultMaterial == nullptr) {
+				defaultMaterial = Material::createMaterialInstance("solid_color");
+				defaultMaterial->setConstantParameter("albedo", vector3(0.0f, 0.9f, 0.0f));
+				defaultMaterial->setConstantParameter("metallic", 0.0f);
+				defaultMaterial->setConstantParameter("roughness", 0.9f);
+				defaultMaterial->setConstantParameter("emissive", vector3(0.0f));
+			}
 			return defaultMaterial;
 		}
 
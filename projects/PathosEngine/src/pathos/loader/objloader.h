@@ -2,6 +2,8 @@
 
 #include "tiny_obj_loader.h"
 #include "pathos/loader/image_loader.h"
+#include "pathos/loader/cooked_mesh.h"
+#include "pathos/util/mapped_file.h"
 #include "pathos/mesh/static_mesh.h"
 #include "pathos/smart_pointer.h"
 
@@ -11,6 +13,8 @@
 #include <set>
 #include <utility>
 
+class JobSystem;
+
 namespace pathos {
 
 	class Texture;
@@ -42,23 +46,6 @@ namespace pathos {
 		Texture* metallicTexture = nullptr;
 	};
 
-	struct PendingShape {
-		// Key: materialID
-		std::map<int32, std::vector<GLfloat>> positions;
-		std::map<int32, std::vector<GLfloat>> normals;
-		std::map<int32, std::vector<GLfloat>> texcoords;
-		std::map<int32, std::vector<GLuint>> indices;
-		std::set<int32> materialIDs;
-
-		bool containsValidNormals(int32 key) const {
-			auto x = positions.find(key);
-			auto y = normals.find(key);
-			return x != positions.end()
-				&& y != normals.end()
-				&& x->second.size() == y->second.size();
-		}
-	};
-
 	// Wavefront OBJ
 	class OBJLoader {
 
@@ -75,15 +62,17 @@ namespace pathos {
 
 		// Load Wavefront OBJ file and prepare for GPU upload.
 		// Can be called from worker threads.
+		// Geometry is cooked into the derived data cache at the first load and memory-mapped later.
+		// If jobSystem is not null, shapes are reconstructed in parallel on it.
 		// NOTE: Actual GPU resources are created later in craftMesh().
-		bool load(const char* inObjFile, const char* inMtlDir);
+		bool load(const char* inObjFile, const char* inMtlDir, JobSystem* jobSystem = nullptr);
 		void unload();
 
 		inline const std::string& getSourceFilepath() const { return objFile; }
 		inline bool isValid() const { return bIsValid; } // Use this to check if load was successful.
 
-		inline uint32 numShapes() const { return static_cast<uint32>(pendingShapes.size()); }
-		inline const std::string& getShapeName(uint32 index) const { return tiny_shapes[index].name; }
+		inline uint32 numShapes() const { return static_cast<uint32>(shapeNames.size()); }
+		inline const std::string& getShapeName(uint32 index) const { return shapeNames[index]; }
 		
 		// CAUTION: Must be called in render thread
 		assetPtr<StaticMesh> craftMeshFrom(const std::string& shapeName);
@@ -96,9 +85,18 @@ namespace pathos {
 
 		const std::vector<assetPtr<Material>>& getMaterials() { return materials; }
 
+		// Deduplicate vertices of each (shape, material) pair and add them to the writer as sections.
+		// Sections of a shape are sorted by material ID. Runs serially if jobSystem is null.
+		// @return false if a face refers to a vertex attribute that doesn't exist. Nothing is added then.
+		static bool reconstructShapes(
+			const tinyobj::attrib_t& attrib,
+			const std::vector<tinyobj::shape_t>& shapes,
+			JobSystem* jobSystem,
+			CookedMeshWriter& writer);
+
 	private:
 		void analyzeMaterials();
-		void reconstructShapes();
+		bool cookShapes(uint64 sourceHash, const std::string& cacheFilepath, JobSystem* jobSystem);
 		void preloadMaterialResources(size_t materialIndex); // craftMaterialFrom might not be called due to materialOverrides, so ensure resources are always loaded.
 		assetPtr<Material> craftMaterialFrom(size_t materialIndex);
 		assetPtr<Material> getMaterial(int32 index);
@@ -114,7 +112,11 @@ namespace pathos {
 		std::vector<tinyobj::material_t> tiny_materials;
 		tinyobj::attrib_t tiny_attrib;
 
-		std::vector<PendingShape> pendingShapes;
+		// Deduplicated geometry. Points to either mappedCookedData or cookedData.
+		CookedMesh cookedMesh;
+		MappedFile mappedCookedData;
+		std::vector<uint8> cookedData;
+		std::vector<std::string> shapeNames;
 		std::vector<assetPtr<Material>> materials;
 		std::vector<std::pair<std::string, assetPtr<Material>>> materialOverrides;
 		// Fallback material if there's no matching material for that within .mtl
@@ -0,0 +1,470 @@
+#include "texture_cooker.h"
+#include "pathos/util/block_compression.h"
+#include "pathos/util/image_data.h"
+#include "pathos/util/derived_data_cache.h"
+#include "pathos/util/cpu_profiler.h"
+#include "pathos/util/log.h"
+
+#include "badger/system/job_system.h"
+#include "badger/assertion/assertion.h"
+
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace pathos {
+
+	static constexpr uint64 COOKED_MIP_ALIGNMENT = 16;
+	static constexpr uint32 MAX_COOKED_MIPS = 32;
+	// Rows of a destination mip per job while filtering.
+	static constexpr uint32 FILTER_ROWS_PER_BATCH = 16;
+	// Block rows per compression tile. Small mips become a single tile.
+	static constexpr uint32 BLOCK_ROWS_PER_TILE = 4;
+
+	static inline uint64 alignCookedOffset(uint64 offset) {
+		return (offset + COOKED_MIP_ALIGNMENT - 1) & ~(COOKED_MIP_ALIGNMENT - 1);
+	}
+
+	static bool isValidRange(uint64 offset, uint64 bytes, uint64 totalBytes) {
+		return offset <= totalBytes && bytes <= totalBytes - offset;
+	}
+
+	// Working copy of a mip, always 4 channels.
+	struct CookMip {
+		uint32 width = 0;
+		uint32 height = 0;
+		std::vector<uint8> ldr; // RGBA8 if the source is 8-bit.
+		std::vector<float> hdr; // RGBA32F if the source is float.
+	};
+
+	struct SRGBDecodeTable {
+		SRGBDecodeTable() {
+			for (uint32 i = 0; i < 256; ++i) {
+				const float c = (float)i / 255.0f;
+				toLinear[i] = (c <= 0.04045f) ? (c / 12.92f) : std::pow((c + 0.055f) / 1.055f, 2.4f);
+			}
+		}
+		float toLinear[256];
+	};
+	static const SRGBDecodeTable& getSRGBDecodeTable() {
+		static SRGBDecodeTable table;
+		return table;
+	}
+
+	static inline float linearToSRGB(float c) {
+		return (c <= 0.0031308f) ? (c * 12.92f) : (1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+	}
+
+	static inline uint8 unormToByte(float x) {
+		return (uint8)std::min(255.0f, std::max(0.0f, x * 255.0f + 0.5f));
+	}
+
+	static bool convertSource(const ImageBlob* source, CookMip& outMip) {
+		const uint64 numTexels = (uint64)source->width * source->height;
+		outMip.width = source->width;
+		outMip.height = source->height;
+
+		if (source->glDataType == GL_UNSIGNED_BYTE) {
+			uint32 numChannels = 0;
+			bool bSwapRB = false;
+			switch (source->glPixelFormat) {
+				case GL_RED:  numChannels = 1; break;
+				case GL_RG:   numChannels = 2; break;
+				case GL_RGB:  numChannels = 3; break;
+				case GL_BGR:  numChannels = 3; bSwapRB = true; break;
+				case GL_RGBA: numChannels = 4; break;
+				case GL_BGRA: numChannels = 4; bSwapRB = true; break;
+				default: return false;
+			}
+			if (source->bpp != numChannels * 8) {
+				return false;
+			}
+			outMip.ldr.resize(numTexels * 4);
+			const uint8* src = source->rawBytes;
+			uint8* dst = outMip.ldr.data();
+			for (uint64 i = 0; i < numTexels; ++i, src += numChannels, dst += 4) {
+				if (numChannels == 1) {
+					dst[0] = dst[1] = dst[2] = src[0];
+					dst[3] = 255;
+				} else if (numChannels == 2) {
+					dst[0] = src[0];
+					dst[1] = src[1];
+					dst[2] = 0;
+					dst[3] = 255;
+				} else {
+					dst[0] = src[bSwapRB ? 2 : 0];
+					dst[1] = src[1];
+					dst[2] = src[bSwapRB ? 0 : 2];
+					dst[3] = (numChannels == 4) ? src[3] : 255;
+				}
+			}
+			return true;
+		} else if (source->glDataType == GL_FLOAT) {
+			uint32 numChannels = 0;
+			if (source->glPixelFormat == GL_RGB) numChannels = 3;
+			else if (source->glPixelFormat == GL_RGBA) numChannels = 4;
+			if (numChannels == 0 || source->bpp != numChannels * 32) {
+				return false;
+			}
+			outMip.hdr.resize(numTexels * 4);
+			const float* src = reinterpret_cast<const float*>(source->rawBytes);
+			float* dst = outMip.hdr.data();
+			for (uint64 i = 0; i < numTexels; ++i, src += numChannels, dst += 4) {
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+				dst[3] = (numChannels == 4) ? src[3] : 1.0f;
+			}
+			return true;
+		}
+		return false;
+	}
+
+	// Each destination texel averages the source texels it covers.
+	// For odd source sizes a destination texel covers 1.5 source texels and the taps are weighted by overlap;
+	// a plain 2x2 box would shift the image and drop the last row or column.
+	struct FilterTaps {
+		uint32 first;
+		uint32 count;
+		float weights[3];
+	};
+	static void buildFilterTaps(uint32 srcSize, uint32 dstSize, std::vector<FilterTaps>& outTaps) {
+		outTaps.resize(dstSize);
+		for (uint32 x = 0; x < dstSize; ++x) {
+			FilterTaps& taps = outTaps[x];
+			if (srcSize == 1) {
+				taps = { 0, 1, { 1.0f, 0.0f, 0.0f } };
+			} else if ((srcSize & 1) == 0) {
+				taps = { 2 * x, 2, { 0.5f, 0.5f, 0.0f } };
+			} else {
+				const float n = (float)(2 * dstSize + 1);
+				taps = { 2 * x, 3, { (float)(dstSize - x) / n, (float)dstSize / n, (float)(x + 1) / n } };
+			}
+		}
+	}
+
+	static void filterNextMip(const CookMip& src, CookMip& dst, const TextureCookSettings& settings, JobSystem* jobSystem) {
+		dst.width = std::max(1u, src.width / 2);
+		dst.height = std::max(1u, src.height / 2);
+		const bool bHDR = src.hdr.size() > 0;
+		if (bHDR) {
+			dst.hdr.resize((size_t)dst.width * dst.height * 4);
+		} else {
+			dst.ldr.resize((size_t)dst.width * dst.height * 4);
+		}
+
+		std::vector<FilterTaps> tapsX, tapsY;
+		buildFilterTaps(src.width, dst.width, tapsX);
+		buildFilterTaps(src.height, dst.height, tapsY);
+
+		const bool bSRGB = settings.bSRGB && !settings.bNormalMap && !bHDR;
+		const bool bNormalMap = settings.bNormalMap;
+		const float* toLinear = getSRGBDecodeTable().toLinear;
+
+		parallelFor(jobSystem, dst.height, FILTER_ROWS_PER_BATCH, [&](uint32 rowBegin, uint32 rowEnd) {
+			for (uint32 y = rowBegin; y < rowEnd; ++y) {
+				const FilterTaps& ty = tapsY[y];
+				for (uint32 x = 0; x < dst.width; ++x) {
+					const FilterTaps& tx = tapsX[x];
+					float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+					for (uint32 j = 0; j < ty.count; ++j) {
+						const size_t rowOffset = (size_t)(ty.first + j) * src.width;
+						for (uint32 i = 0; i < tx.count; ++i) {
+							const float w = ty.weights[j] * tx.weights[i];
+							const size_t texel = (rowOffset + tx.first + i) * 4;
+							if (bHDR) {
+								for (uint32 c = 0; c < 4; ++c) sum[c] += w * src.hdr[texel + c];
+							} else {
+								const uint8* s = &src.ldr[texel];
+								for (uint32 c = 0; c < 3; ++c) {
+									const float v = bSRGB ? toLinear[s[c]] : ((float)s[c] / 255.0f);
+									sum[c] += w * (bNormalMap ? (v * 2.0f - 1.0f) : v);
+								}
+								sum[3] += w * ((float)s[3] / 255.0f);
+							}
+						}
+					}
+
+					if (bNormalMap) {
+						const float len = std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2]);
+						if (len > 1e-6f) {
+							for (uint32 c = 0; c < 3; ++c) sum[c] /= len;
+						}
+						if (!bHDR) {
+							for (uint32 c = 0; c < 3; ++c) sum[c] = sum[c] * 0.5f + 0.5f;
+						}
+					}
+
+					const size_t out = ((size_t)y * dst.width + x) * 4;
+					if (bHDR) {
+						for (uint32 c = 0; c < 4; ++c) dst.hdr[out + c] = sum[c];
+					} else {
+						for (uint32 c = 0; c < 3; ++c) {
+							dst.ldr[out + c] = unormToByte(bSRGB ? linearToSRGB(sum[c]) : sum[c]);
+						}
+						dst.ldr[out + 3] = unormToByte(sum[3]);
+					}
+				}
+			}
+		});
+	}
+
+	// 4x4 texels starting at (blockX * 4, blockY * 4). Texels outside of the mip replicate the edge.
+	static void gatherBlock(const CookMip& mip, uint32 blockX, uint32 blockY, uint8 outRGBA[64]) {
+		for (uint32 y = 0; y < BC_BLOCK_SIZE; ++y) {
+			const uint32 sy = std::min(blockY * BC_BLOCK_SIZE + y, mip.height - 1);
+			for (uint32 x = 0; x < BC_BLOCK_SIZE; ++x) {
+				const uint32 sx = std::min(blockX * BC_BLOCK_SIZE + x, mip.width - 1);
+				::memcpy(outRGBA + (y * BC_BLOCK_SIZE + x) * 4, &mip.ldr[((size_t)sy * mip.width + sx) * 4], 4);
+			}
+		}
+	}
+
+	static void gatherBlockHDR(const CookMip& mip, uint32 blockX, uint32 blockY, float outRGBA[64]) {
+		for (uint32 y = 0; y < BC_BLOCK_SIZE; ++y) {
+			const uint32 sy = std::min(blockY * BC_BLOCK_SIZE + y, mip.height - 1);
+			for (uint32 x = 0; x < BC_BLOCK_SIZE; ++x) {
+				const uint32 sx = std::min(blockX * BC_BLOCK_SIZE + x, mip.width - 1);
+				::memcpy(outRGBA + (y * BC_BLOCK_SIZE + x) * 4, &mip.hdr[((size_t)sy * mip.width + sx) * 4], 4 * sizeof(float));
+			}
+		}
+	}
+
+	uint64 TextureCooker::hashSettings(const TextureCookSettings& settings) {
+		const uint32 desc[4] = {
+			COOKED_TEXTURE_VERSION,
+			(uint32)settings.compression,
+			(settings.bSRGB ? 1u : 0u) | (settings.bNormalMap ? 2u : 0u) | (settings.bGenerateMips ? 4u : 0u),
+			0,
+		};
+		return DerivedDataCache::hashBytes(desc, sizeof(desc));
+	}
+
+	uint32 TextureCooker::getNumMips(uint32 width, uint32 height) {
+		uint32 numMips = 1;
+		for (uint32 size = std::max(width, height); size > 1; size /= 2) {
+			++numMips;
+		}
+		return numMips;
+	}
+
+	GLenum TextureCooker::getStorageFormat(ETextureCompression compression, bool bSRGB, bool bHDR) {
+		switch (compression) {
+			case ETextureCompression::None: return bHDR ? GL_RGBA16F : (bSRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8);
+			case ETextureCompression::BC1:  return bSRGB ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+			case ETextureCompression::BC3:  return bSRGB ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			case ETextureCompression::BC4:  return GL_COMPRESSED_RED_RGTC1;
+			case ETextureCompression::BC5:  return GL_COMPRESSED_RG_RGTC2;
+			case ETextureCompression::BC7:  return bSRGB ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+			case ETextureCompression::BC6H: return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+			default: CHECK_NO_ENTRY();
+		}
+		return GL_RGBA8;
+	}
+
+	uint32 TextureCooker::getBlockBytes(ETextureCompression compression) {
+		switch (compression) {
+			case ETextureCompression::BC1:
+			case ETextureCompression::BC4:
+				return 8;
+			case ETextureCompression::BC3:
+			case ETextureCompression::BC5:
+			case ETextureCompression::BC7:
+			case ETextureCompression::BC6H:
+				return 16;
+			default:
+				return 0;
+		}
+	}
+
+	bool TextureCooker::cook(
+		const ImageBlob* source,
+		const TextureCookSettings& settings,
+		uint64 sourceHash,
+		JobSystem* jobSystem,
+		std::vector<uint8>& outData)
+	{
+		SCOPED_CPU_COUNTER(CookTexture);
+
+		if (source == nullptr || source->rawBytes == nullptr || source->width == 0 || source->height == 0 || source->bCompressed) {
+			return false;
+		}
+
+		std::vector<CookMip> mips(settings.bGenerateMips ? getNumMips(source->width, source->height) : 1);
+		if (!convertSource(source, mips[0])) {
+			LOG(LogError, "[TextureCooker] Unsupported source format (pixelFormat=0x%x, dataType=0x%x, bpp=%u)",
+				source->glPixelFormat, source->glDataType, source->bpp);
+			return false;
+		}
+		const bool bHDR = mips[0].hdr.size() > 0;
+
+		ETextureCompression compression = settings.compression;
+		if (bHDR && compression != ETextureCompression::None) {
+			// Other block formats can't store HDR values.
+			compression = ETextureCompression::BC6H;
+		} else if (!bHDR && compression == ETextureCompression::BC6H) {
+			LOG(LogWarning, "[TextureCooker] BC6H needs a float source; LDR source is cooked as BC7");
+			compression = ETextureCompression::BC7;
+		}
+
+		for (size_t i = 1; i < mips.size(); ++i) {
+			filterNextMip(mips[i - 1], mips[i], settings, jobSystem);
+		}
+
+		// Layout
+		const uint32 blockBytes = getBlockBytes(compression);
+		const uint32 numMips = (uint32)mips.size();
+		const uint64 tableOffset = sizeof(CookedTextureHeader);
+		uint64 offset = alignCookedOffset(tableOffset + numMips * sizeof(CookedTextureMip));
+		std::vector<CookedTextureMip> table(numMips);
+		for (uint32 i = 0; i < numMips; ++i) {
+			const uint64 w = mips[i].width, h = mips[i].height;
+			table[i].width = mips[i].width;
+			table[i].height = mips[i].height;
+			table[i].offset = offset;
+			if (blockBytes != 0) {
+				table[i].bytes = ((w + 3) / 4) * ((h + 3) / 4) * blockBytes;
+			} else {
+				table[i].bytes = w * h * (bHDR ? 8 : 4);
+			}
+			offset = alignCookedOffset(offset + table[i].bytes);
+		}
+
+		outData.assign(offset, 0);
+		CookedTextureHeader header;
+		header.magic = COOKED_TEXTURE_MAGIC;
+		header.version = COOKED_TEXTURE_VERSION;
+		header.sourceHash = sourceHash;
+		header.totalBytes = offset;
+		header.width = source->width;
+		header.height = source->height;
+		header.numMips = numMips;
+		header.compression = (uint32)compression;
+		header.glStorageFormat = getStorageFormat(compression, settings.bSRGB && !settings.bNormalMap, bHDR);
+		header.glPixelFormat = (blockBytes != 0) ? 0 : GL_RGBA;
+		header.glDataType = (blockBytes != 0) ? 0 : (bHDR ? GL_HALF_FLOAT : GL_UNSIGNED_BYTE);
+		header.reserved = 0;
+		::memcpy(outData.data(), &header, sizeof(header));
+		::memcpy(outData.data() + tableOffset, table.data(), numMips * sizeof(CookedTextureMip));
+
+		if (blockBytes == 0) {
+			for (uint32 i = 0; i < numMips; ++i) {
+				uint8* dst = outData.data() + table[i].offset;
+				if (bHDR) {
+					uint16* halfs = reinterpret_cast<uint16*>(dst);
+					for (size_t j = 0; j < mips[i].hdr.size(); ++j) {
+						halfs[j] = (uint16)glm::packHalf1x16(mips[i].hdr[j]);
+					}
+				} else {
+					::memcpy(dst, mips[i].ldr.data(), mips[i].ldr.size());
+				}
+			}
+			return true;
+		}
+
+		// Tiles of every mip go into one parallelFor, so small mips don't serialize at the end.
+		struct CompressTile {
+			uint32 mip;
+			uint32 blockRowBegin;
+			uint32 blockRowEnd;
+		};
+		std::vector<CompressTile> tiles;
+		for (uint32 i = 0; i < numMips; ++i) {
+			const uint32 blockRows = (mips[i].height + 3) / 4;
+			for (uint32 row = 0; row < blockRows; row += BLOCK_ROWS_PER_TILE) {
+				tiles.push_back({ i, row, std::min(row + BLOCK_ROWS_PER_TILE, blockRows) });
+			}
+		}
+
+		parallelFor(jobSystem, (uint32)tiles.size(), 1, [&](uint32 tileBegin, uint32 tileEnd) {
+			uint8 texels[64];
+			float hdrTexels[64];
+			for (uint32 t = tileBegin; t < tileEnd; ++t) {
+				const CompressTile& tile = tiles[t];
+				const CookMip& mip = mips[tile.mip];
+				const uint32 blocksX = (mip.width + 3) / 4;
+				uint8* mipData = outData.data() + table[tile.mip].offset;
+				for (uint32 by = tile.blockRowBegin; by < tile.blockRowEnd; ++by) {
+					for (uint32 bx = 0; bx < blocksX; ++bx) {
+						uint8* block = mipData + ((size_t)by * blocksX + bx) * blockBytes;
+						if (compression == ETextureCompression::BC6H) {
+							gatherBlockHDR(mip, bx, by, hdrTexels);
+							encodeBC6HBlock(hdrTexels, block);
+							continue;
+						}
+						gatherBlock(mip, bx, by, texels);
+						switch (compression) {
+							case ETextureCompression::BC1: encodeBC1Block(texels, block); break;
+							case ETextureCompression::BC3: encodeBC3Block(texels, block); break;
+							case ETextureCompression::BC5: encodeBC5Block(texels, block); break;
+							case ETextureCompression::BC7: encodeBC7Block(texels, block); break;
+							case ETextureCompression::BC4:
+								{
+									uint8 red[16];
+									for (uint32 k = 0; k < 16; ++k) red[k] = texels[k * 4];
+									encodeBC4Block(red, block);
+								}
+								break;
+							default: CHECK_NO_ENTRY();
+						}
+					}
+				}
+			}
+		});
+
+		return true;
+	}
+
+	ImageBlob* TextureCooker::createImageBlob(const uint8* data, uint64 bytes, uint64 expectedSourceHash) {
+		if (data == nullptr || bytes < sizeof(CookedTextureHeader)) {
+			return nullptr;
+		}
+		CookedTextureHeader header;
+		::memcpy(&header, data, sizeof(header));
+		if (header.magic != COOKED_TEXTURE_MAGIC || header.version != COOKED_TEXTURE_VERSION
+			|| header.sourceHash != expectedSourceHash || header.totalBytes != bytes
+			|| header.numMips == 0 || header.numMips > MAX_COOKED_MIPS) {
+			return nullptr;
+		}
+		const uint64 tableOffset = sizeof(CookedTextureHeader);
+		if (!isValidRange(tableOffset, header.numMips * sizeof(CookedTextureMip), bytes)) {
+			return nullptr;
+		}
+		std::vector<CookedTextureMip> table(header.numMips);
+		::memcpy(table.data(), data + tableOffset, header.numMips * sizeof(CookedTextureMip));
+
+		// Don't trust offsets in the file; a truncated or stale entry should be rejected, not crash.
+		const uint64 dataBegin = table[0].offset;
+		uint64 dataEnd = dataBegin;
+		for (const CookedTextureMip& mip : table) {
+			if (!isValidRange(mip.offset, mip.bytes, bytes) || mip.offset < dataBegin) {
+				return nullptr;
+			}
+			dataEnd = std::max(dataEnd, mip.offset + mip.bytes);
+		}
+		if (table[0].width != header.width || table[0].height != header.height) {
+			return nullptr;
+		}
+
+		const ETextureCompression compression = (ETextureCompression)header.compression;
+		const uint32 blockBytes = getBlockBytes(compression);
+
+		ImageBlob* blob = new ImageBlob;
+		blob->rawBytes = new uint8[dataEnd - dataBegin];
+		::memcpy(blob->rawBytes, data + dataBegin, dataEnd - dataBegin);
+		blob->width = header.width;
+		blob->height = header.height;
+		blob->bpp = (blockBytes != 0) ? (blockBytes * 8 / 16) : (header.glDataType == GL_HALF_FLOAT ? 64 : 32);
+		blob->glStorageFormat = header.glStorageFormat;
+		blob->glPixelFormat = header.glPixelFormat;
+		blob->glDataType = header.glDataType;
+		blob->bCompressed = (blockBytes != 0);
+		blob->mips.resize(header.numMips);
+		for (uint32 i = 0; i < header.numMips; ++i) {
+			blob->mips[i] = ImageMip{ table[i].width, table[i].height, table[i].offset - dataBegin, table[i].bytes };
+		}
+		return blob;
+	}
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "pathos/rhi/gl_handles.h"
+
+#include "badger/types/int_types.h"
+
+#include <vector>
+
+// Offline/async texture cooking: mip chain on CPU and block compression.
+// Layout: CookedTextureHeader | CookedTextureMip[numMips] | mip data
+// Every mip is 16-byte aligned, stored in the layout glCompressedTextureSubImage2D() or glTextureSubImage2D() expects.
+
+// sRGB variants of S3TC come from EXT_texture_sRGB, which glcorearb.h does not include.
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       0x8C4C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
+class JobSystem;
+
+namespace pathos {
+
+	struct ImageBlob;
+
+	constexpr uint32 COOKED_TEXTURE_MAGIC = 0x58455450; // "PTEX"
+	constexpr uint32 COOKED_TEXTURE_VERSION = 2;
+
+	enum class ETextureCompression : uint32 {
+		None = 0, // RGBA8, or RGBA16F for HDR sources.
+		BC1  = 1, // RGB, 4 bits per texel.
+		BC3  = 2, // RGBA, 8 bits per texel.
+		BC4  = 3, // R, 4 bits per texel. For masks and roughness.
+		BC5  = 4, // RG, 8 bits per texel. For two-channel normal maps.
+		BC7  = 5, // RGBA, 8 bits per texel. Best quality for color.
+		BC6H = 6, // Unsigned half float RGB, 8 bits per texel. HDR sources always use this if compressed.
+	};
+
+	struct TextureCookSettings {
+		ETextureCompression compression = ETextureCompression::BC7;
+		bool bSRGB = false;         // Source is sRGB. Mips are filtered in linear space and an sRGB format is selected.
+		bool bNormalMap = false;    // Source is a tangent space normal map. Texels of each mip are renormalized.
+		bool bGenerateMips = true;  // Otherwise only mip 0 is cooked.
+	};
+
+	struct CookedTextureHeader {
+		uint32 magic;
+		uint32 version;
+		uint64 sourceHash;
+		uint64 totalBytes;
+		uint32 width;
+		uint32 height;
+		uint32 numMips;
+		uint32 compression;    // ETextureCompression
+		uint32 glStorageFormat;
+		uint32 glPixelFormat;  // 0 if compressed
+		uint32 glDataType;     // 0 if compressed
+		uint32 reserved;
+	};
+
+	struct CookedTextureMip {
+		uint32 width;
+		uint32 height;
+		uint64 offset; // Offset in bytes from the file start.
+		uint64 bytes;
+	};
+
+	class TextureCooker {
+
+	public:
+		// Settings that change the cooked data, to be combined with a hash of the source file.
+		static uint64 hashSettings(const TextureCookSettings& settings);
+
+		// Convert, filter mips, and compress. Mips are filtered row by row in parallel,
+		// and blocks of every mip are compressed in parallel over tiles of block rows.
+		// Supports 8-bit R/RG/RGB/BGR/RGBA/BGRA and float RGB/RGBA sources. Float sources are cooked to BC6H
+		// regardless of the requested block format, or to RGBA16F if uncompressed. BC6H for 8-bit sources falls back to BC7.
+		// @return false if the source format is not supported.
+		static bool cook(
+			const ImageBlob* source,
+			const TextureCookSettings& settings,
+			uint64 sourceHash,
+			JobSystem* jobSystem,
+			std::vector<uint8>& outData);
+
+		// Copy cooked data into an image blob with a prebuilt mip chain.
+		// @return nullptr if the data is corrupted, from another version, or from another source.
+		static ImageBlob* createImageBlob(const uint8* data, uint64 bytes, uint64 expectedSourceHash);
+
+		static uint32 getNumMips(uint32 width, uint32 height);
+		static GLenum getStorageFormat(ETextureCompression compression, bool bSRGB, bool bHDR);
+		// @return 0 if not a block compressed format.
+		static uint32 getBlockBytes(ETextureCompression compression);
+
+	};
+
+}
@@ -0,0 +1,62 @@
+#include "vertex_dedup.h"
+#include "badger/assertion/assertion.h"
+
+#include <cstring>
+
+namespace pathos {
+
+	void VertexDedupTable::reset(uint32 inMaxVertices) {
+		// Keep the load factor at or below 0.5.
+		uint64 numSlots = 16;
+		while (numSlots < inMaxVertices * 2ull) {
+			numSlots *= 2;
+		}
+		CHECKF(numSlots <= 0x80000000ull, "Too many vertices");
+
+		slots.assign((size_t)numSlots, Slot{ 0, EMPTY_SLOT });
+		vertices.clear();
+		vertices.reserve(inMaxVertices);
+		slotMask = (uint32)(numSlots - 1);
+		maxVertices = inMaxVertices;
+	}
+
+	uint32 VertexDedupTable::findOrAdd(const MetaVertex& vertex, uint32 hash) {
+		uint32 slotIx = hash & slotMask;
+		while (true) {
+			Slot& slot = slots[slotIx];
+			if (slot.index == EMPTY_SLOT) {
+				CHECKF(vertices.size() < maxVertices, "Exceeded maxVertices of reset()");
+				slot.hash = hash;
+				slot.index = (uint32)vertices.size();
+				vertices.push_back(vertex);
+				return slot.index;
+			}
+			if (slot.hash == hash && 0 == ::memcmp(&vertices[slot.index], &vertex, sizeof(MetaVertex))) {
+				return slot.index;
+			}
+			// Linear probing
+			slotIx = (slotIx + 1) & slotMask;
+		}
+	}
+
+	uint32 VertexDedupTable::hashVertex(const MetaVertex& vertex) {
+		uint64 words[4];
+		::memcpy(words, &vertex, sizeof(words));
+
+		// Each word goes through a 64-bit finalizer (splitmix64) before it is combined,
+		// so vertices that only differ in a few low mantissa bits still spread over all slots.
+		uint64 h = 0x9e3779b97f4a7c15ull;
+		for (uint64 w : words) {
+			w ^= w >> 30;
+			w *= 0xbf58476d1ce4e5b9ull;
+			w ^= w >> 27;
+			w *= 0x94d049bb133111ebull;
+			w ^= w >> 31;
+			h = (h ^ w) * 0x100000001b3ull;
+			h = (h << 29) | (h >> 35);
+		}
+		h ^= h >> 32;
+		return (uint32)h;
+	}
+
+}
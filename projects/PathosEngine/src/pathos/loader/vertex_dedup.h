@@ -0,0 +1,51 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+
+#include <vector>
+
+namespace pathos {
+
+	// Vertex attributes that decide uniqueness while reconstructing indexed meshes.
+	struct MetaVertex {
+		vector3 position;
+		vector2 texcoord;
+		vector3 normal;
+	};
+	static_assert(sizeof(MetaVertex) == 32, "MetaVertex is hashed as 32 raw bytes");
+
+	/// Open-addressing hash table for vertex deduplication.
+	/// Slots only hold a hash and an index into a flat vertex array, so probes stay within a few cache lines.
+	/// Vertices are compared bitwise; the table never shrinks or removes entries.
+	class VertexDedupTable {
+
+		struct Slot {
+			uint32 hash;
+			uint32 index; // EMPTY_SLOT if not used
+		};
+
+	public:
+		static constexpr uint32 EMPTY_SLOT = 0xffffffff;
+
+		/// Clears the table. Inserting more than maxVertices unique vertices is not allowed.
+		void reset(uint32 maxVertices);
+
+		/// @return Index of the equal vertex if it was already added, otherwise the index of the new vertex.
+		inline uint32 findOrAdd(const MetaVertex& vertex) { return findOrAdd(vertex, hashVertex(vertex)); }
+		uint32 findOrAdd(const MetaVertex& vertex, uint32 hash);
+
+		inline uint32 getNumVertices() const { return (uint32)vertices.size(); }
+		inline const std::vector<MetaVertex>& getVertices() const { return vertices; }
+
+		/// Mixes every bit of the vertex. Can be computed ahead in parallel.
+		static uint32 hashVertex(const MetaVertex& vertex);
+
+	private:
+		std::vector<Slot> slots; // Size is a power of two
+		std::vector<MetaVertex> vertices;
+		uint32 slotMask = 0;
+		uint32 maxVertices = 0;
+	};
+
+}
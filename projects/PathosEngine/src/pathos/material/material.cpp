@@ -7,9 +7,17 @@
 #include "pathos/util/engine_util.h"
 
 #include "badger/math/minmax.h"
+#include <atomic>
 
 namespace pathos {
 
+	static std::atomic<uint32> nextMaterialID(0);
+
+	Material::Material()
+		: materialID(nextMaterialID.fetch_add(1))
+	{
+	}
+
 	Material* Material::createMaterialInstanceRaw(const char* materialName) {
 		const uint32 hash = COMPILE_TIME_CRC32_STR(materialName);
 		MaterialShader* ms = MaterialShaderAssembler::get().findMaterialShaderByHash(hash);
@@ -25,6 +33,14 @@ namespace pathos {
 		return assetPtr<Material>(createMaterialInstanceRaw(materialName));
 	}
 
+	assetPtr<Material> Material::createMaterialInstance(MaterialShader* materialShader) {
+		CHECK(materialShader != nullptr);
+		Material* material = new Material;
+		material->bindMaterialShader(materialShader, materialShader->getNextInstanceID());
+		material->materialName = materialShader->materialName;
+		return assetPtr<Material>(material);
+	}
+
 	void Material::bindMaterialShader(MaterialShader* inMaterialShader, uint32 inInstanceID) {
 		materialShader = inMaterialShader;
 		materialInstanceID = inInstanceID;
@@ -24,14 +24,19 @@ namespace pathos {
 	public:
 		// Use this to create a Material.
 		static assetPtr<Material> createMaterialInstance(const char* materialName);
+		// Create a Material from a material shader that is already resolved.
+		static assetPtr<Material> createMaterialInstance(MaterialShader* materialShader);
 
 	private:
-		Material() = default;
+		Material();
 	public:
 		virtual ~Material() = default;
 
 		const std::string& getMaterialName() const { return materialName; }
 
+		// Unique among all materials created in this process. Never reused, unlike the address of a material.
+		inline uint32 getMaterialID() const { return materialID; }
+
 		template<typename ValueType>
 		void setConstantParameter(const char* name, const ValueType& value) {
 			constexpr bool isFloat = std::is_same<ValueType, float>::value || std::is_same<ValueType, vector2>::value || std::is_same<ValueType, vector3>::value || std::is_same<ValueType, vector4>::value;
@@ -79,6 +84,7 @@ namespace pathos {
 		bool bWireframe = false;
 
 	private:
+		uint32 materialID;
 		MaterialShader* materialShader = nullptr;
 		// Different instances share a same material shader but have different parameters.
 		uint32 materialInstanceID = 0xffffffff;
@@ -1,5 +1,6 @@
 #include "geometry.h"
 #include "pathos/rhi/render_device.h"
+#include "pathos/mesh/mesh_optimizer.h"
 #include "pathos/util/log.h"
 
 #include "badger/assertion/assertion.h"
@@ -41,6 +42,23 @@ namespace pathos {
 		bUseIndexBuffer = useIndexBuffer;
 	}
 
+	void MeshGeometry::setVaryingFormat(EVaryingFormat inVaryingFormat) {
+		CHECKF(uvBuffer.bufferPool == nullptr && normalBuffer.bufferPool == nullptr && tangentBuffer.bufferPool == nullptr && bitangentBuffer.bufferPool == nullptr,
+			"Varying format can't be changed after upload");
+		varyingFormat = inVaryingFormat;
+	}
+
+	uint32 MeshGeometry::getVertexStride() const {
+		const bool bPacked = (varyingFormat == EVaryingFormat::Packed);
+		uint32 stride = 0;
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Position))  stride += 12;
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Uv))        stride += bPacked ? 4 : 8;
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Normal))    stride += bPacked ? 4 : 12;
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Tangent))   stride += bPacked ? 4 : 16;
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Bitangent)) stride += bPacked ? 0 : 12;
+		return stride;
+	}
+
 	void MeshGeometry::dispose() {
 		disposeVAO();
 		releaseBuffer(positionBuffer);
@@ -89,7 +107,13 @@ namespace pathos {
 		uvData.assign(data2, data2 + length / 2);
 		if (bFlipY) { for (vector2& uv : uvData) { uv.y = 1.0f - uv.y; } }
 
-		bufferUploadHelper(uvBuffer, length * sizeof(GLfloat), uvData.data(), gRenderDevice->getVaryingBufferPool());
+		if (varyingFormat == EVaryingFormat::Packed) {
+			std::vector<uint32> packed(uvData.size());
+			for (size_t i = 0; i < uvData.size(); ++i) packed[i] = MeshOptimizer::packHalf2(uvData[i]);
+			bufferUploadHelper(uvBuffer, packed.size() * sizeof(uint32), packed.data(), gRenderDevice->getVaryingBufferPool());
+		} else {
+			bufferUploadHelper(uvBuffer, length * sizeof(GLfloat), uvData.data(), gRenderDevice->getVaryingBufferPool());
+		}
 	}
 
 	void MeshGeometry::updateNormalData(const GLfloat* data, uint32 length) {
@@ -99,7 +123,15 @@ namespace pathos {
 		const vector3* data2 = reinterpret_cast<const vector3*>(data);
 		normalData.assign(data2, data2 + length / 3);
 
-		bufferUploadHelper(normalBuffer, length * sizeof(GLfloat), normalData.data(), gRenderDevice->getVaryingBufferPool());
+		if (varyingFormat == EVaryingFormat::Packed) {
+			std::vector<uint32> packed(normalData.size());
+			for (size_t i = 0; i < normalData.size(); ++i) packed[i] = MeshOptimizer::packSnorm10x3(vector4(normalData[i], 0.0f));
+			bufferUploadHelper(normalBuffer, packed.size() * sizeof(uint32), packed.data(), gRenderDevice->getVaryingBufferPool());
+			// Handedness of tangents depends on normals.
+			uploadPackedTangents();
+		} else {
+			bufferUploadHelper(normalBuffer, length * sizeof(GLfloat), normalData.data(), gRenderDevice->getVaryingBufferPool());
+		}
 	}
 	void MeshGeometry::updateNormalData(const std::vector<vector3>& inNormals)
 	{
@@ -115,7 +147,11 @@ namespace pathos {
 		const vector4* data2 = reinterpret_cast<const vector4*>(data);
 		tangentData.assign(data2, data2 + length / 4);
 
-		bufferUploadHelper(tangentBuffer, length * sizeof(GLfloat), tangentData.data(), gRenderDevice->getVaryingBufferPool());
+		if (varyingFormat == EVaryingFormat::Packed) {
+			uploadPackedTangents();
+		} else {
+			bufferUploadHelper(tangentBuffer, length * sizeof(GLfloat), tangentData.data(), gRenderDevice->getVaryingBufferPool());
+		}
 	}
 	void MeshGeometry::updateBitangentData(const GLfloat* data, uint32 length) {
 		CHECK(ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Bitangent));
@@ -124,7 +160,28 @@ namespace pathos {
 		const vector3* data2 = reinterpret_cast<const vector3*>(data);
 		bitangentData.assign(data2, data2 + length / 3);
 
-		bufferUploadHelper(bitangentBuffer, length * sizeof(GLfloat), bitangentData.data(), gRenderDevice->getVaryingBufferPool());
+		if (varyingFormat == EVaryingFormat::Packed) {
+			// No bitangent stream. Its handedness goes to tangent.w.
+			uploadPackedTangents();
+		} else {
+			bufferUploadHelper(bitangentBuffer, length * sizeof(GLfloat), bitangentData.data(), gRenderDevice->getVaryingBufferPool());
+		}
+	}
+
+	void MeshGeometry::uploadPackedTangents() {
+		if (tangentData.size() == 0) {
+			return;
+		}
+		const bool bHasBasis = (normalData.size() == tangentData.size() && bitangentData.size() == tangentData.size());
+		std::vector<uint32> packed(tangentData.size());
+		for (size_t i = 0; i < tangentData.size(); ++i) {
+			vector4 T = tangentData[i];
+			if (bHasBasis && T.w != 0.0f) {
+				T.w = (glm::dot(glm::cross(normalData[i], vector3(T)), bitangentData[i]) < 0.0f) ? -1.0f : 1.0f;
+			}
+			packed[i] = MeshOptimizer::packSnorm10x3(T);
+		}
+		bufferUploadHelper(tangentBuffer, packed.size() * sizeof(uint32), packed.data(), gRenderDevice->getVaryingBufferPool());
 	}
 
 	void MeshGeometry::updateIndexData(const GLuint* data, uint32 length) {
@@ -234,16 +291,19 @@ namespace pathos {
 		std::vector<GLfloat> tangents(numPos * 4, 0.0f);
 		std::vector<GLfloat> bitangents(numPos * 3, 0.0f);
 
+		const bool bHasNormals = (normalData.size() == (size_t)numPos);
 		for (int32 i = 0; i < numPos; ++i) {
 			vector3 v = glm::normalize(accum[i]);
 			bool invalid = glm::any(glm::isnan(v));
 			if (invalid) {
-				tangents[i * 3 + 0] = tangents[i * 3 + 1] = tangents[i * 3 + 2] = tangents[i * 3 + 3] = 0.0f;
+				tangents[i * 4 + 0] = tangents[i * 4 + 1] = tangents[i * 4 + 2] = tangents[i * 4 + 3] = 0.0f;
 			} else {
-				tangents[i * 3 + 0] = v.x;
-				tangents[i * 3 + 1] = v.y;
-				tangents[i * 3 + 2] = v.z;
-				tangents[i * 3 + 3] = 1.0f; // #todo-geometry: tangent w component
+				tangents[i * 4 + 0] = v.x;
+				tangents[i * 4 + 1] = v.y;
+				tangents[i * 4 + 2] = v.z;
+				// Handedness, so that bitangent = cross(normal, tangent.xyz) * tangent.w
+				const vector3 B = glm::normalize(accum2[i]);
+				tangents[i * 4 + 3] = (bHasNormals && glm::dot(glm::cross(normalData[i], v), B) < 0.0f) ? -1.0f : 1.0f;
 			}
 
 			if (invalid) {
@@ -425,11 +485,17 @@ namespace pathos {
 		const VAOElement tangentDesc  { tangentBufferName,   TANGENT_LOCATION,   4,           GL_FLOAT,    GL_FALSE,   4 * sizeof(GL_FLOAT), (GLsizeiptr)tangentBuffer.offset   };
 		const VAOElement bitangentDesc{ bitangentBufferName, BITANGENT_LOCATION, 3,           GL_FLOAT,    GL_FALSE,   3 * sizeof(GL_FLOAT), (GLsizeiptr)bitangentBuffer.offset };
 
-		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Position))  { descs.push_back(posDesc);       }
-		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Uv))        { descs.push_back(uvDesc);        }
-		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Normal))    { descs.push_back(normalDesc);    }
-		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Tangent))   { descs.push_back(tangentDesc);   }
-		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Bitangent)) { descs.push_back(bitangentDesc); }
+		// Packed format. The bitangent attribute is left disabled, so that shaders derive it.
+		const VAOElement uvPackedDesc     { uvBufferName,      UV_LOCATION,      2, GL_HALF_FLOAT,          GL_FALSE, sizeof(uint32), (GLsizeiptr)uvBuffer.offset      };
+		const VAOElement normalPackedDesc { normalBufferName,  NORMAL_LOCATION,  4, GL_INT_2_10_10_10_REV,  GL_TRUE,  sizeof(uint32), (GLsizeiptr)normalBuffer.offset  };
+		const VAOElement tangentPackedDesc{ tangentBufferName, TANGENT_LOCATION, 4, GL_INT_2_10_10_10_REV,  GL_TRUE,  sizeof(uint32), (GLsizeiptr)tangentBuffer.offset };
+		const bool bPacked = (varyingFormat == EVaryingFormat::Packed);
+
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Position))  { descs.push_back(posDesc);                                   }
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Uv))        { descs.push_back(bPacked ? uvPackedDesc : uvDesc);           }
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Normal))    { descs.push_back(bPacked ? normalPackedDesc : normalDesc);   }
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Tangent))   { descs.push_back(bPacked ? tangentPackedDesc : tangentDesc); }
+		if (ENUM_HAS_FLAG(vertexAttributes, EVertexAttributes::Bitangent) && !bPacked) { descs.push_back(bitangentDesc);                 }
 
 		createVAOHelper(cmdList, indexBufferName, &vaoFullAttributes, descs, "VAO_fullAttributes");
 	}
@@ -24,6 +24,13 @@ namespace pathos {
 			All       = Position | Uv | Normal | Tangent | Bitangent,
 		};
 
+		// How non-position attributes are stored on GPU. Shaders read the same types either way.
+		enum class EVaryingFormat : uint8 {
+			Float,  // uv: float2, normal: float3, tangent: float4, bitangent: float3
+			Packed, // uv: half2, normal and tangent: snorm 10-10-10-2, bitangent: derived in shader from tangent.w
+			        // Texcoords far outside [0, 1] lose sub-texel precision as half floats.
+		};
+
 	private:
 		struct BufferView {
 			uint64 offset = BufferPool::INVALID_OFFSET;
@@ -37,6 +44,11 @@ namespace pathos {
 		virtual ~MeshGeometry();
 
 		void initializeVertexLayout(EVertexAttributes inVertexAttributes, bool useIndexBuffer = true);
+		// Should be called before any varying data is uploaded.
+		void setVaryingFormat(EVaryingFormat inVaryingFormat);
+		inline EVaryingFormat getVaryingFormat() const { return varyingFormat; }
+		// Bytes of vertex data per vertex on GPU, for statistics.
+		uint32 getVertexStride() const;
 
 		void dispose();
 
@@ -87,6 +99,8 @@ namespace pathos {
 		void createFullVAO(RenderCommandList& cmdList);
 		void disposeVAO();
 
+		void uploadPackedTangents();
+
 		void bufferUploadHelper(BufferView& bufferView, uint64 requestedBytes, void* data, BufferPool* bufferPool);
 		void releaseBuffer(BufferView& bufferView);
 	
@@ -107,6 +121,7 @@ namespace pathos {
 	private:
 		// Vertex layout
 		EVertexAttributes vertexAttributes = EVertexAttributes::None;
+		EVaryingFormat varyingFormat = EVaryingFormat::Float;
 		bool bUseIndexBuffer = true;
 		GLuint vaoPositionOnly = 0;
 		GLuint vaoFullAttributes = 0;
@@ -117,7 +132,7 @@ namespace pathos {
 		BufferView uvBuffer;
 		BufferView normalBuffer;
 		BufferView tangentBuffer;
-		BufferView bitangentBuffer; // #todo-geometry: Remove and derive within shader
+		BufferView bitangentBuffer; // Float format only. Packed format derives it in shader.
 		// Index buffer (suballocated from global index buffer pool)
 		BufferView indexBuffer;
 	};
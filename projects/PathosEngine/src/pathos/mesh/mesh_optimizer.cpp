@@ -0,0 +1,363 @@
+#include "mesh_optimizer.h"
+#include "badger/assertion/assertion.h"
+
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+namespace pathos {
+
+	static constexpr uint32 INVALID_INDEX = 0xffffffff;
+
+	// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+	static constexpr uint32 FORSYTH_CACHE_SIZE = 32;
+	static constexpr uint32 FORSYTH_MAX_VALENCE = 32; // Valence scores are clamped beyond this.
+	static constexpr float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+	static constexpr float FORSYTH_LAST_TRIANGLE_SCORE = 0.75f;
+	static constexpr float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+	static constexpr float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+	struct ForsythScoreTable {
+		ForsythScoreTable() {
+			for (uint32 i = 0; i < FORSYTH_CACHE_SIZE; ++i) {
+				if (i < 3) {
+					// The last triangle's vertices get a fixed score, so that strips are not strictly preferred.
+					cache[i] = FORSYTH_LAST_TRIANGLE_SCORE;
+				} else {
+					const float scaler = 1.0f / (float)(FORSYTH_CACHE_SIZE - 3);
+					cache[i] = std::pow(1.0f - (float)(i - 3) * scaler, FORSYTH_CACHE_DECAY_POWER);
+				}
+			}
+			valence[0] = 0.0f;
+			for (uint32 i = 1; i <= FORSYTH_MAX_VALENCE; ++i) {
+				// Boost vertices with few triangles left, to finish them off and avoid isolated triangles.
+				valence[i] = FORSYTH_VALENCE_BOOST_SCALE * std::pow((float)i, -FORSYTH_VALENCE_BOOST_POWER);
+			}
+		}
+		inline float score(int32 cachePosition, uint32 remainingValence) const {
+			if (remainingValence == 0) {
+				return -1.0f;
+			}
+			const float cacheScore = (cachePosition >= 0) ? cache[cachePosition] : 0.0f;
+			return cacheScore + valence[std::min(remainingValence, FORSYTH_MAX_VALENCE)];
+		}
+
+		float cache[FORSYTH_CACHE_SIZE];
+		float valence[FORSYTH_MAX_VALENCE + 1];
+	};
+
+	void MeshOptimizer::optimizeVertexCache(uint32* indices, uint32 numIndices, uint32 numVertices) {
+		static const ForsythScoreTable scoreTable;
+
+		const uint32 numTriangles = numIndices / 3;
+		if (numTriangles == 0) {
+			return;
+		}
+
+		// Triangles adjacent to each vertex. The first remainingValence[v] entries are the ones not emitted yet.
+		std::vector<uint32> adjacencyOffsets(numVertices + 1, 0);
+		for (uint32 i = 0; i < numIndices; ++i) {
+			CHECK(indices[i] < numVertices);
+			adjacencyOffsets[indices[i] + 1] += 1;
+		}
+		for (uint32 v = 0; v < numVertices; ++v) {
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
+		std::vector<uint32> adjacency(numTriangles * 3);
+		std::vector<uint32> remainingValence(numVertices, 0);
+		for (uint32 t = 0; t < numTriangles; ++t) {
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 v = indices[t * 3 + k];
+				adjacency[adjacencyOffsets[v] + remainingValence[v]] = t;
+				remainingValence[v] += 1;
+			}
+		}
+
+		std::vector<int32> cachePositions(numVertices, -1);
+		std::vector<float> vertexScores(numVertices);
+		for (uint32 v = 0; v < numVertices; ++v) {
+			vertexScores[v] = scoreTable.score(-1, remainingValence[v]);
+		}
+		std::vector<float> triangleScores(numTriangles);
+		std::vector<uint8> bEmitted(numTriangles, 0);
+		uint32 bestTriangle = 0;
+		for (uint32 t = 0; t < numTriangles; ++t) {
+			triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+			if (triangleScores[t] > triangleScores[bestTriangle]) {
+				bestTriangle = t;
+			}
+		}
+
+		uint32 cache[FORSYTH_CACHE_SIZE + 3];
+		uint32 cacheCount = 0;
+		uint32 scanCursor = 0;
+		std::vector<uint32> output(numTriangles * 3);
+
+		for (uint32 outTriangle = 0; outTriangle < numTriangles; ++outTriangle) {
+			if (bestTriangle == INVALID_INDEX) {
+				// Nothing left around the cache. Continue from the first triangle that is not emitted yet.
+				while (bEmitted[scanCursor]) ++scanCursor;
+				bestTriangle = scanCursor;
+			}
+			const uint32 tri[3] = { indices[bestTriangle * 3], indices[bestTriangle * 3 + 1], indices[bestTriangle * 3 + 2] };
+			output[outTriangle * 3 + 0] = tri[0];
+			output[outTriangle * 3 + 1] = tri[1];
+			output[outTriangle * 3 + 2] = tri[2];
+			bEmitted[bestTriangle] = 1;
+
+			for (uint32 k = 0; k < 3; ++k) {
+				const uint32 v = tri[k];
+				uint32* adj = adjacency.data() + adjacencyOffsets[v];
+				uint32* adjEnd = adj + remainingValence[v];
+				uint32* it = std::find(adj, adjEnd, bestTriangle);
+				CHECK(it != adjEnd);
+				*it = *(adjEnd - 1);
+				remainingValence[v] -= 1;
+			}
+
+			// The emitted triangle goes to the front of the LRU cache. Entries pushed beyond the size are evicted.
+			uint32 newCache[FORSYTH_CACHE_SIZE + 3];
+			uint32 newCacheCount = 0;
+			for (uint32 k = 0; k < 3; ++k) {
+				if (std::find(newCache, newCache + newCacheCount, tri[k]) == newCache + newCacheCount) {
+					newCache[newCacheCount++] = tri[k];
+				}
+			}
+			for (uint32 i = 0; i < cacheCount; ++i) {
+				const uint32 v = cache[i];
+				if (v != tri[0] && v != tri[1] && v != tri[2]) {
+					newCache[newCacheCount++] = v;
+				}
+			}
+
+			for (uint32 i = 0; i < newCacheCount; ++i) {
+				const uint32 v = newCache[i];
+				cachePositions[v] = (i < FORSYTH_CACHE_SIZE) ? (int32)i : -1;
+				const float newScore = scoreTable.score(cachePositions[v], remainingValence[v]);
+				const float delta = newScore - vertexScores[v];
+				vertexScores[v] = newScore;
+				const uint32* adj = adjacency.data() + adjacencyOffsets[v];
+				for (uint32 j = 0; j < remainingValence[v]; ++j) {
+					triangleScores[adj[j]] += delta;
+				}
+			}
+
+			// Only triangles around the cache changed their scores, so the next one is picked among them.
+			cacheCount = std::min(newCacheCount, FORSYTH_CACHE_SIZE);
+			bestTriangle = INVALID_INDEX;
+			float bestScore = -1.0f;
+			for (uint32 i = 0; i < cacheCount; ++i) {
+				const uint32 v = newCache[i];
+				cache[i] = v;
+				const uint32* adj = adjacency.data() + adjacencyOffsets[v];
+				for (uint32 j = 0; j < remainingValence[v]; ++j) {
+					if (triangleScores[adj[j]] > bestScore) {
+						bestScore = triangleScores[adj[j]];
+						bestTriangle = adj[j];
+					}
+				}
+			}
+		}
+
+		std::copy(output.begin(), output.end(), indices);
+	}
+
+	uint32 MeshOptimizer::optimizeVertexFetch(uint32* indices, uint32 numIndices, uint32 numVertices, std::vector<uint32>& outRemap) {
+		outRemap.assign(numVertices, INVALID_INDEX);
+		uint32 numNewVertices = 0;
+		for (uint32 i = 0; i < numIndices; ++i) {
+			uint32& newIndex = outRemap[indices[i]];
+			if (newIndex == INVALID_INDEX) {
+				newIndex = numNewVertices++;
+			}
+			indices[i] = newIndex;
+		}
+		return numNewVertices;
+	}
+
+	void MeshOptimizer::remapVertexStream(std::vector<float>& stream, uint32 numComponents, const std::vector<uint32>& remap, uint32 numNewVertices) {
+		CHECK(stream.size() == remap.size() * numComponents);
+		std::vector<float> newStream(numNewVertices * numComponents);
+		for (size_t v = 0; v < remap.size(); ++v) {
+			if (remap[v] != INVALID_INDEX) {
+				std::copy_n(stream.data() + v * numComponents, numComponents, newStream.data() + remap[v] * numComponents);
+			}
+		}
+		stream.swap(newStream);
+	}
+
+	VertexCacheStatistics MeshOptimizer::analyzeVertexCache(const uint32* indices, uint32 numIndices, uint32 numVertices, uint32 cacheSize) {
+		// A vertex is in the FIFO if fewer than cacheSize misses happened since its own miss.
+		std::vector<uint32> missTimestamps(numVertices, 0);
+		uint32 time = cacheSize + 1;
+		uint32 numMisses = 0;
+		uint32 numUsedVertices = 0;
+		for (uint32 i = 0; i < numIndices; ++i) {
+			const uint32 v = indices[i];
+			if (missTimestamps[v] == 0) {
+				numUsedVertices += 1;
+			}
+			if (time - missTimestamps[v] > cacheSize) {
+				missTimestamps[v] = time++;
+				numMisses += 1;
+			}
+		}
+
+		VertexCacheStatistics stats;
+		stats.acmr = (numIndices >= 3) ? (float)numMisses / (float)(numIndices / 3) : 0.0f;
+		stats.atvr = (numUsedVertices > 0) ? (float)numMisses / (float)numUsedVertices : 0.0f;
+		return stats;
+	}
+
+	static void finalizeMeshletBounds(
+		Meshlet& meshlet,
+		const float* positions,
+		const std::vector<uint32>& meshletVertices,
+		const std::vector<uint8>& meshletTriangles)
+	{
+		auto getPosition = [&](uint32 localIndex) {
+			const float* p = positions + meshletVertices[meshlet.vertexOffset + localIndex] * 3;
+			return vector3(p[0], p[1], p[2]);
+		};
+
+		vector3 minP(FLT_MAX), maxP(-FLT_MAX);
+		for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+			minP = glm::min(minP, getPosition(i));
+			maxP = glm::max(maxP, getPosition(i));
+		}
+		meshlet.center = 0.5f * (minP + maxP);
+		meshlet.radius = 0.0f;
+		for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+			meshlet.radius = std::max(meshlet.radius, glm::length(getPosition(i) - meshlet.center));
+		}
+
+		std::vector<vector3> normals;
+		normals.reserve(meshlet.triangleCount);
+		vector3 normalSum(0.0f);
+		for (uint32 t = 0; t < meshlet.triangleCount; ++t) {
+			const uint8* tri = meshletTriangles.data() + meshlet.triangleOffset + t * 3;
+			const vector3 p0 = getPosition(tri[0]);
+			const vector3 n = glm::cross(getPosition(tri[1]) - p0, getPosition(tri[2]) - p0);
+			const float area = glm::length(n);
+			if (area > 0.0f) {
+				normals.push_back(n / area);
+				normalSum += n / area;
+			}
+		}
+
+		const float axisLength = glm::length(normalSum);
+		meshlet.coneAxis = (axisLength > 0.0f) ? (normalSum / axisLength) : vector3(0.0f, 0.0f, 1.0f);
+		float minDot = (normals.size() > 0) ? 1.0f : -1.0f;
+		for (const vector3& n : normals) {
+			minDot = std::min(minDot, glm::dot(n, meshlet.coneAxis));
+		}
+		// Wider than ~84 degrees is rarely culled and loses precision, so the cone is disabled.
+		meshlet.coneCutoff = (minDot <= 0.1f) ? 1.0f : std::sqrt(1.0f - minDot * minDot);
+	}
+
+	uint32 MeshOptimizer::buildMeshlets(
+		const uint32* indices, uint32 numIndices,
+		const float* positions, uint32 numVertices,
+		uint32 maxVertices, uint32 maxTriangles,
+		std::vector<Meshlet>& outMeshlets,
+		std::vector<uint32>& outMeshletVertices,
+		std::vector<uint8>& outMeshletTriangles)
+	{
+		CHECK(maxVertices >= 3 && maxVertices <= MAX_MESHLET_VERTICES && maxTriangles >= 1);
+		outMeshlets.clear();
+		outMeshletVertices.clear();
+		outMeshletTriangles.clear();
+
+		std::vector<uint32> localIndices(numVertices, INVALID_INDEX);
+		Meshlet meshlet{};
+
+		auto finishMeshlet = [&]() {
+			if (meshlet.triangleCount == 0) {
+				return;
+			}
+			finalizeMeshletBounds(meshlet, positions, outMeshletVertices, outMeshletTriangles);
+			for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+				localIndices[outMeshletVertices[meshlet.vertexOffset + i]] = INVALID_INDEX;
+			}
+			outMeshlets.push_back(meshlet);
+			meshlet = Meshlet{};
+			meshlet.vertexOffset = (uint32)outMeshletVertices.size();
+			meshlet.triangleOffset = (uint32)outMeshletTriangles.size();
+		};
+
+		for (uint32 i = 0; i + 2 < numIndices; i += 3) {
+			const uint32 a = indices[i], b = indices[i + 1], c = indices[i + 2];
+			const uint32 numNewVertices = (localIndices[a] == INVALID_INDEX ? 1 : 0)
+				+ (localIndices[b] == INVALID_INDEX && b != a ? 1 : 0)
+				+ (localIndices[c] == INVALID_INDEX && c != a && c != b ? 1 : 0);
+			if (meshlet.vertexCount + numNewVertices > maxVertices || meshlet.triangleCount + 1 > maxTriangles) {
+				finishMeshlet();
+			}
+			for (uint32 v : { a, b, c }) {
+				if (localIndices[v] == INVALID_INDEX) {
+					localIndices[v] = meshlet.vertexCount++;
+					outMeshletVertices.push_back(v);
+				}
+				outMeshletTriangles.push_back((uint8)localIndices[v]);
+			}
+			meshlet.triangleCount += 1;
+		}
+		finishMeshlet();
+
+		return (uint32)outMeshlets.size();
+	}
+
+	bool MeshOptimizer::isMeshletBackfacing(const Meshlet& meshlet, const vector3& cameraPosition) {
+		// Every normal is within the cone, so the meshlet is backfacing if every point of the bounding sphere
+		// is seen at less than (90 - cone angle) degrees from the axis.
+		const vector3 toCenter = meshlet.center - cameraPosition;
+		const float distance = glm::length(toCenter);
+		return glm::dot(toCenter, meshlet.coneAxis) > meshlet.coneCutoff * distance + meshlet.radius * (1.0f + meshlet.coneCutoff);
+	}
+
+	void MeshOptimizer::quantizePosition(const vector3& position, const vector3& boundsMin, const vector3& boundsMax, uint16 outXYZW[4]) {
+		const vector3 size = boundsMax - boundsMin;
+		for (int32 i = 0; i < 3; ++i) {
+			const float t = (size[i] > 0.0f) ? ((position[i] - boundsMin[i]) / size[i]) : 0.0f;
+			outXYZW[i] = (uint16)std::lround(glm::clamp(t, 0.0f, 1.0f) * 65535.0f);
+		}
+		outXYZW[3] = 0;
+	}
+
+	vector3 MeshOptimizer::dequantizePosition(const uint16 xyzw[4], const vector3& boundsMin, const vector3& boundsMax) {
+		const vector3 t = vector3(xyzw[0], xyzw[1], xyzw[2]) / 65535.0f;
+		return boundsMin + t * (boundsMax - boundsMin);
+	}
+
+	uint32 MeshOptimizer::encodeOctahedral(const vector3& unitVector) {
+		vector3 n = unitVector / (std::abs(unitVector.x) + std::abs(unitVector.y) + std::abs(unitVector.z));
+		vector2 e(n.x, n.y);
+		if (n.z < 0.0f) {
+			// Fold the lower hemisphere over the diagonals.
+			e.x = (1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f);
+			e.y = (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f);
+		}
+		return glm::packSnorm2x16(e);
+	}
+
+	vector3 MeshOptimizer::decodeOctahedral(uint32 encoded) {
+		const vector2 e = glm::unpackSnorm2x16(encoded);
+		vector3 n(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+		if (n.z < 0.0f) {
+			const float x = n.x;
+			n.x = (1.0f - std::abs(n.y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			n.y = (1.0f - std::abs(x)) * (n.y >= 0.0f ? 1.0f : -1.0f);
+		}
+		return glm::normalize(n);
+	}
+
+	uint32 MeshOptimizer::packSnorm10x3(const vector4& v) {
+		return glm::packSnorm3x10_1x2(v);
+	}
+
+	uint32 MeshOptimizer::packHalf2(const vector2& v) {
+		return glm::packHalf2x16(v);
+	}
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+
+#include <vector>
+
+// CPU mesh optimization for indexed triangle lists.
+// - Triangle order for the post-transform vertex cache (Forsyth's linear-speed algorithm)
+// - Vertex order for fetch locality
+// - Quantized vertex encodings
+// - Meshlets with bounding spheres and normal cones, for cluster culling
+
+namespace pathos {
+
+	struct VertexCacheStatistics {
+		float acmr; // Average cache miss ratio: vertex shader invocations per triangle. Lower is better, 3 is the worst.
+		float atvr; // Average transformed vertex ratio: invocations per unique vertex. 1 is the best.
+	};
+
+	struct Meshlet {
+		uint32 vertexOffset;   // First element in meshletVertices
+		uint32 triangleOffset; // First element in meshletTriangles; 3 local vertex indices per triangle
+		uint32 vertexCount;
+		uint32 triangleCount;
+		// Bounding sphere
+		vector3 center;
+		float radius;
+		// Normal cone. See MeshOptimizer::isMeshletBackfacing().
+		vector3 coneAxis;
+		float coneCutoff;
+	};
+
+	class MeshOptimizer {
+
+	public:
+		static constexpr uint32 MAX_MESHLET_VERTICES = 255;
+
+		// Reorder triangles in place so that consecutive triangles reuse recently transformed vertices.
+		// Triangles are also roughly clustered in space, which reduces overdraw within a draw call.
+		static void optimizeVertexCache(uint32* indices, uint32 numIndices, uint32 numVertices);
+
+		// Renumber vertices in the order of first use, and rewrite indices in place.
+		// outRemap[oldVertex] is the new vertex index, or 0xffffffff if the vertex is not referenced.
+		// @return The number of referenced vertices.
+		static uint32 optimizeVertexFetch(uint32* indices, uint32 numIndices, uint32 numVertices, std::vector<uint32>& outRemap);
+
+		// Apply a remap table from optimizeVertexFetch() to a stream of numComponents floats per vertex.
+		static void remapVertexStream(std::vector<float>& stream, uint32 numComponents, const std::vector<uint32>& remap, uint32 numNewVertices);
+
+		// Simulates a FIFO post-transform cache of the given size.
+		static VertexCacheStatistics analyzeVertexCache(const uint32* indices, uint32 numIndices, uint32 numVertices, uint32 cacheSize = 16);
+
+		// Split triangles into clusters of at most maxVertices (<= MAX_MESHLET_VERTICES) and maxTriangles, in the given triangle order.
+		// positions: numVertices vec3.
+		// outMeshletTriangles stores indices into the meshlet's range of outMeshletVertices.
+		// @return The number of meshlets.
+		static uint32 buildMeshlets(
+			const uint32* indices, uint32 numIndices,
+			const float* positions, uint32 numVertices,
+			uint32 maxVertices, uint32 maxTriangles,
+			std::vector<Meshlet>& outMeshlets,
+			std::vector<uint32>& outMeshletVertices,
+			std::vector<uint8>& outMeshletTriangles);
+
+		// Conservative: true only if every triangle of the meshlet faces away from the camera.
+		static bool isMeshletBackfacing(const Meshlet& meshlet, const vector3& cameraPosition);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Quantization
+
+		// 16-bit unorm per component, relative to the bounds. w is unused.
+		static void quantizePosition(const vector3& position, const vector3& boundsMin, const vector3& boundsMax, uint16 outXYZW[4]);
+		static vector3 dequantizePosition(const uint16 xyzw[4], const vector3& boundsMin, const vector3& boundsMax);
+
+		// Octahedral mapping of a unit vector, two snorm16 values.
+		static uint32 encodeOctahedral(const vector3& unitVector);
+		static vector3 decodeOctahedral(uint32 encoded);
+
+		// GL_INT_2_10_10_10_REV, normalized. w is -1, 0, or 1.
+		static uint32 packSnorm10x3(const vector4& v);
+		// Two GL_HALF_FLOAT values.
+		static uint32 packHalf2(const vector2& v);
+
+	};
+
+}
@@ -1,7 +1,5 @@
 #include "brush.h"
-#include "pathos/rhi/texture.h"
-#include "pathos/render/render_overlay.h"
-#include "pathos/render/overlay/overlaypass.h"
+#include "display_object_proxy.h"
 #include "pathos/util/color_conversion.h"
 
 // SolidColorBrush
@@ -19,14 +17,14 @@ namespace pathos {
 		setColor(colorHex);
 	}
 
-	OverlayPass* SolidColorBrush::configure(OverlayRenderer* renderer, const Transform& transformAccum) {
-		OverlayPass_Standard* program = renderer->getStandardProgram();
-		program->setColor(color);
-		return program;
+	void SolidColorBrush::fillDrawItem(OverlayDrawItem& item) const {
+		item.type = EOverlayItemType::SolidColor;
+		item.color = color;
 	}
 
 	void SolidColorBrush::setColor(float r, float g, float b, float a) {
 		color = vector4(r, g, b, a);
+		markModified();
 	}
 
 	void SolidColorBrush::setColor(uint32 colorHex) {
@@ -50,10 +48,9 @@ namespace pathos {
 		color = vector4(rgb[0], rgb[1], rgb[2], 1.0f);
 	}
 
-	OverlayPass* TextBrush::configure(OverlayRenderer* renderer, const Transform& transformAccum) {
-		OverlayPass_Text* program = renderer->getTextProgram();
-		program->setColor(color);
-		return program;
+	void TextBrush::fillDrawItem(OverlayDrawItem& item) const {
+		item.type = EOverlayItemType::Text;
+		item.color = color;
 	}
 
 }
@@ -61,10 +58,10 @@ namespace pathos {
 // ImageBrush
 namespace pathos {
 
-	OverlayPass* ImageBrush::configure(OverlayRenderer* renderer, const Transform& transformAccum) {
-		OverlayPass_Image* program = renderer->getImageProgram();
-		program->setImageTexture(getTexture()->internal_getGLName());
-		return program;
+	void ImageBrush::fillDrawItem(OverlayDrawItem& item) const {
+		item.type = EOverlayItemType::Image;
+		item.color = vector4(1.0f);
+		item.texture = texture;
 	}
 
 }
@@ -1,19 +1,29 @@
 #pragma once
 
-#include "pathos/util/transform_helper.h"
 #include "badger/types/vector_types.h"
 #include "badger/types/int_types.h"
 
 namespace pathos {
 
-	class OverlayRenderer;
-	class OverlayPass;
 	class Texture;
+	struct OverlayDrawItem;
 
 	// Base class
 	class Brush {
 	public:
-		virtual OverlayPass* configure(OverlayRenderer* renderer, const Transform& transformAccum) = 0;
+		virtual ~Brush() = default;
+
+		// Set the type, color and texture of an overlay item.
+		virtual void fillDrawItem(OverlayDrawItem& item) const = 0;
+
+		// Incremented whenever the brush is modified, so that retained proxies using it are rebuilt.
+		inline uint32 getVersion() const { return version; }
+
+	protected:
+		inline void markModified() { ++version; }
+
+	private:
+		uint32 version = 0;
 	};
 
 	// Fill the object with a solid color
@@ -22,7 +32,7 @@ namespace pathos {
 		SolidColorBrush(float r, float g, float b, float a = 1.0f);
 		SolidColorBrush(vector4 rgba);
 		SolidColorBrush(uint32 rgba);
-		virtual OverlayPass* configure(OverlayRenderer* renderer, const Transform& transformAccum) override;
+		virtual void fillDrawItem(OverlayDrawItem& item) const override;
 		void setColor(float r, float g, float b, float a = 1.0f);
 		void setColor(uint32 colorHex);
 	private:
@@ -36,9 +46,9 @@ namespace pathos {
 		TextBrush(float r, float g, float b);
 		TextBrush(uint32 rgb);
 
-		virtual OverlayPass* configure(OverlayRenderer* renderer, const Transform& transformAccum) override;
+		virtual void fillDrawItem(OverlayDrawItem& item) const override;
 
-		inline void setColor(const vector3& inColor) { color = vector4(inColor, 1.0f); }
+		inline void setColor(const vector3& inColor) { color = vector4(inColor, 1.0f); markModified(); }
 
 	private:
 		vector4 color;
@@ -53,10 +63,10 @@ namespace pathos {
 		{
 		}
 
-		virtual OverlayPass* configure(OverlayRenderer* renderer, const Transform& transformAccum) override;
+		virtual void fillDrawItem(OverlayDrawItem& item) const override;
 
 		inline Texture* getTexture() const { return texture; }
-		inline void setTexture(Texture* inTexture) { texture = inTexture; }
+		inline void setTexture(Texture* inTexture) { texture = inTexture; markModified(); }
 
 	private:
 		Texture* texture;
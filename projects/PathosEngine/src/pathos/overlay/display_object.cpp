@@ -1,5 +1,5 @@
 #include "display_object.h"
-#include "display_object_proxy.h"
+#include "brush.h"
 #include <assert.h>
 
 namespace pathos {
@@ -10,46 +10,56 @@ namespace pathos {
 		return root;
 	}
 
-	DisplayObject2DProxy* DisplayObject2D::createRenderProxyHierarchy(
+	bool DisplayObject2D::updateRenderProxyHierarchy(
 		DisplayObject2D* root,
-		OverlaySceneProxy* overlaySceneProxy)
+		OverlayDrawList& outDrawList,
+		OverlayProxyStats* outStats)
 	{
-		DisplayObject2DProxy* rootProxy = nullptr;
-
-		if (root != nullptr) {
-			rootProxy = root->createRenderProxy(overlaySceneProxy);
-			if (rootProxy != nullptr) {
-				for (DisplayObject2D* child : root->getChildren()) {
-					DisplayObject2DProxy* childProxy = createRenderProxyHierarchy(child, overlaySceneProxy);
-					if (childProxy != nullptr) {
-						rootProxy->children.push_back(childProxy);
-					}
-				}
-			}
+		outDrawList.clear();
+		OverlayProxyStats stats;
+		if (root != nullptr && root->getVisible()) {
+			root->updateRenderProxy_recurse(OverlayTransform2D{}, outDrawList, stats);
+			outDrawList.bRootVisible = true;
 		}
-
-		return rootProxy;
+		stats.numItems = (uint32)outDrawList.items.size();
+		if (outStats != nullptr) {
+			*outStats = stats;
+		}
+		return outDrawList.bRootVisible;
 	}
 
-	DisplayObject2D::DisplayObject2D() {
-		transform.identity();
-	}
+	void DisplayObject2D::updateRenderProxy_recurse(const OverlayTransform2D& parentToScreen, OverlayDrawList& outDrawList, OverlayProxyStats& stats) {
+		if (!bVisible) {
+			// Keep dirty flags until it becomes visible again.
+			return;
+		}
+		stats.numVisited += 1;
+
+		const uint32 flags = dirtyFlags.exchange(0);
+		const bool bBrushModified = (proxy.brush != brush) || (brush != nullptr && proxy.brushVersion != brush->getVersion());
+		if (flags != 0 || bBrushModified) {
+			// Children are scaled including their positions.
+			proxy.childTransform = OverlayTransform2D{ vector2(scaleX * x, scaleY * y), vector2(scaleX, scaleY) };
+			proxy.brush = brush;
+			proxy.brushVersion = (brush != nullptr) ? brush->getVersion() : 0;
+			proxy.bHasItem = updateRenderProxy(proxy);
+			stats.numRebuilt += 1;
+		}
 
-	DisplayObject2D::~DisplayObject2D() {}
+		if (proxy.bHasItem) {
+			outDrawList.addItem(proxy.item, parentToScreen, proxy.text);
+		}
 
-	DisplayObject2DProxy* DisplayObject2D::createRenderProxy(OverlaySceneProxy* sceneProxy) {
-		// Just contains child proxies to makeup the hierarchy.
-		if (getVisible()) {
-			DisplayObject2DProxy* proxy = sceneProxy->allocate<DisplayObject2DProxy>();
-			proxy->x = x;
-			proxy->y = y;
-			proxy->scaleX = scaleX;
-			proxy->scaleY = scaleY;
-			return proxy;
+		const OverlayTransform2D childToScreen = parentToScreen.combine(proxy.childTransform);
+		for (DisplayObject2D* child : children) {
+			child->updateRenderProxy_recurse(childToScreen, outDrawList, stats);
 		}
-		return nullptr;
 	}
 
+	DisplayObject2D::DisplayObject2D() {}
+
+	DisplayObject2D::~DisplayObject2D() {}
+
 	bool DisplayObject2D::addChild(DisplayObject2D* child) {
 		CHECK(child != nullptr && child->isRoot() == false);
 
@@ -1,16 +1,25 @@
 #pragma once
 
+#include "display_object_proxy.h"
 #include "pathos/mesh/geometry.h"
-#include "pathos/util/transform_helper.h"
 
+#include "badger/types/enum.h"
 #include <vector>
 #include <functional>
+#include <atomic>
 
 namespace pathos {
 
 	class Brush;
-	class OverlaySceneProxy;
-	class DisplayObject2DProxy;
+
+	enum class EOverlayDirtyFlags : uint32 {
+		None       = 0,
+		Transform  = 1 << 0,
+		Visibility = 1 << 1,
+		Content    = 1 << 2, // Size, text, font, brush, ...
+		All        = Transform | Visibility | Content,
+	};
+	ENUM_CLASS_FLAGS(EOverlayDirtyFlags);
 
 	namespace overlayInput {
 		using OnMouseClick = std::function<void(int32 mouseX, int32 mouseY)>;
@@ -23,15 +32,20 @@ namespace pathos {
 	public:
 		static DisplayObject2D* createRoot();
 
-		static DisplayObject2DProxy* createRenderProxyHierarchy(
+		// Rebuild the retained proxies of dirty objects and fill the draw list with the visible items.
+		// Clean objects only copy their items, transformed by their parents, to the draw list.
+		// Returns false if root is null or invisible.
+		static bool updateRenderProxyHierarchy(
 			DisplayObject2D* root,
-			OverlaySceneProxy* overlaySceneProxy);
+			OverlayDrawList& outDrawList,
+			OverlayProxyStats* outStats = nullptr);
 
 	public:
 		DisplayObject2D();
 		virtual ~DisplayObject2D();
 
-		virtual DisplayObject2DProxy* createRenderProxy(OverlaySceneProxy* sceneProxy);
+		// Fill the drawable content of the proxy in parent space. Returns false if there is nothing to draw.
+		virtual bool updateRenderProxy(DisplayObject2DProxy& proxy) { return false; }
 
 		bool addChild(DisplayObject2D* child);
 		bool removeChild(DisplayObject2D* child);
@@ -47,17 +61,45 @@ namespace pathos {
 		inline float getScaleX() const { return scaleX; }
 		inline float getScaleY() const { return scaleY; }
 
-		inline void setX(float value) { x = value; }
-		inline void setY(float value) { y = value; }
-		inline void setXY(float newX, float newY) { x = newX; y = newY; }
-		inline void setScaleX(float value) { scaleX = value; }
-		inline void setScaleY(float value) { scaleY = value; }
+		inline void setX(float value) { setXY(value, y); }
+		inline void setY(float value) { setXY(x, value); }
+		inline void setXY(float newX, float newY) {
+			if (x != newX || y != newY) {
+				x = newX;
+				y = newY;
+				markDirty(EOverlayDirtyFlags::Transform);
+			}
+		}
+		inline void setScaleX(float value) { setScaleXY(value, scaleY); }
+		inline void setScaleY(float value) { setScaleXY(scaleX, value); }
+		inline void setScaleXY(float newScaleX, float newScaleY) {
+			if (scaleX != newScaleX || scaleY != newScaleY) {
+				scaleX = newScaleX;
+				scaleY = newScaleY;
+				markDirty(EOverlayDirtyFlags::Transform);
+			}
+		}
+
+		inline bool getVisible() const { return bVisible; }
+		inline void setVisible(bool value) {
+			if (bVisible != value) {
+				bVisible = value;
+				markDirty(EOverlayDirtyFlags::Visibility);
+			}
+		}
 
-		inline bool getVisible() { return bVisible; }
-		inline void setVisible(bool value) { bVisible = value; }
+		inline Brush* getBrush() const { return brush; }
+		inline void setBrush(Brush* newBrush) {
+			if (brush != newBrush) {
+				brush = newBrush;
+				markDirty(EOverlayDirtyFlags::Content);
+			}
+		}
 
-		inline Brush* getBrush() { return brush; }
-		inline void setBrush(Brush* newBrush) { brush = newBrush; }
+		// The CreateOverlayProxy task reads display objects in a worker thread without locks,
+		// so game code must not modify them (including the hierarchy) while that task runs.
+		inline void markDirty(EOverlayDirtyFlags flags) { dirtyFlags.fetch_or((uint32)flags); }
+		inline bool isDirty() const { return dirtyFlags.load() != 0; }
 
 	// User input
 	public:
@@ -76,30 +118,31 @@ namespace pathos {
 		overlayInput::OnMouseDrag onMouseDrag = nullptr;
 
 	public:
-		bool bVisible = true;
 		bool bReceivesMouseInput = true;
 		bool bStopInputPropagation = false;
 
 	protected:
+		bool bVisible = true;
 		float x = 0.0f, y = 0.0f;
 		float scaleX = 1.0f, scaleY = 1.0f;
 
-		Transform transform;
-		bool bTransformDirty = false; // #todo-overlay: Utilize this
-
 		std::string displayName = "displayObject";
 		void setDisplayName(const std::string& newName) { displayName = newName; }
 
 		void setRoot(DisplayObject2D* root);
-		virtual void updateTransform(uint32 viewportWidth, uint32 viewportHeight) {}
 
 	private:
+		void updateRenderProxy_recurse(const OverlayTransform2D& parentToScreen, OverlayDrawList& outDrawList, OverlayProxyStats& stats);
+
 		DisplayObject2D* root = nullptr;
 		DisplayObject2D* parent = nullptr;
 		std::vector<DisplayObject2D*> children;
 
 		Brush* brush = nullptr;
 
+		DisplayObject2DProxy proxy;
+		std::atomic<uint32> dirtyFlags{ (uint32)EOverlayDirtyFlags::All };
+
 	};
 
 }
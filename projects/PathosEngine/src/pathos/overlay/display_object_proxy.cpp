@@ -1,38 +1,34 @@
 #include "display_object_proxy.h"
-#include "pathos/text/text_geometry.h"
 
 // OverlaySceneProxy
 namespace pathos {
 
-	static constexpr uint32 RENDER_PROXY_ALLOCATOR_BYTES = 8 * 1024 * 1024; // 8 MB
-
 	OverlaySceneProxy::OverlaySceneProxy(uint32 inViewportWidth, uint32 inViewportHeight)
-		: renderProxyAllocator(RENDER_PROXY_ALLOCATOR_BYTES)
-		, viewportWidth(inViewportWidth)
+		: viewportWidth(inViewportWidth)
 		, viewportHeight(inViewportHeight)
 	{
 	}
 
 }
 
-// DisplayObject2DProxy
+// OverlayDrawList
 namespace pathos {
 
-	matrix4 DisplayObject2DProxy::getLocalTransform() {
-		matrix4 M = glm::scale(matrix4(1.0f), vector3(scaleX, scaleY, 1.0f));
-		M = glm::translate(M, vector3(x, y, 0.0f));
-		return M;
+	void OverlayDrawList::clear() {
+		items.clear();
+		textPool.clear();
+		bRootVisible = false;
 	}
 
-}
-
-// LabelProxy
-namespace pathos {
-
-	bool LabelProxy::onRender(RenderCommandList* cmdList) {
-		TextGeometry* G = static_cast<TextGeometry*>(geometry);
-		G->configure(*cmdList, *fontDesc.cacheTexture, text);
-		return true;
+	void OverlayDrawList::addItem(const OverlayDrawItem& item, const OverlayTransform2D& parentToScreen, const std::wstring& text) {
+		OverlayDrawItem screenItem = item;
+		screenItem.transform = parentToScreen.combine(item.transform);
+		if (item.type == EOverlayItemType::Text) {
+			screenItem.textOffset = (uint32)textPool.size();
+			screenItem.textLength = (uint32)text.size();
+			textPool.insert(textPool.end(), text.begin(), text.end());
+		}
+		items.push_back(screenItem);
 	}
 
 }
@@ -1,51 +1,77 @@
 #pragma once
 
-#include "pathos/util/transform_helper.h"
-#include "pathos/text/font_mgr.h"
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
 
-#include "badger/system/mem_alloc.h"
 #include <vector>
+#include <string>
 
 namespace pathos {
 
-	class MeshGeometry;
 	class Brush;
-	class RenderCommandList;
-
-	// Render thread version of DisplayObject2D
-	class DisplayObject2DProxy {
-	public:
-		virtual ~DisplayObject2DProxy() = default;
-
-		// #todo-text: Temp callback. Configure anything for this object before rendering.
-		//             Also, this object is skipped for rendering if false is returned.
-		virtual bool onRender(RenderCommandList* cmdList) { return true; }
+	class Texture;
+	class FontTextureCache;
+
+	// Overlay transforms are only made of translation and scale.
+	// In screen space, (0,0) is top left, +x to right, +y to bottom, and the unit is pixel.
+	struct OverlayTransform2D {
+		vector2 offset = vector2(0.0f);
+		vector2 scale = vector2(1.0f);
+
+		inline vector2 transformPoint(const vector2& p) const { return offset + scale * p; }
+		// Apply local first, then this.
+		inline OverlayTransform2D combine(const OverlayTransform2D& local) const {
+			return OverlayTransform2D{ offset + scale * local.offset, scale * local.scale };
+		}
+	};
 
-		matrix4 getLocalTransform();
+	enum class EOverlayItemType : uint8 {
+		SolidColor, // Unit square filled with color
+		Image,      // Unit square with a texture
+		Text,       // Glyph quads laid out by the render thread
+	};
 
-		float x = 0.0f;
-		float y = 0.0f;
-		float scaleX = 1.0f;
-		float scaleY = 1.0f;
+	// Drawable content of a display object.
+	struct OverlayDrawItem {
+		EOverlayItemType  type = EOverlayItemType::SolidColor;
+		OverlayTransform2D transform;           // Item space to parent space (or to screen space in OverlayDrawList)
+		vector4           color = vector4(1.0f);
+		Texture*          texture = nullptr;    // Image only
+		FontTextureCache* fontCache = nullptr;  // Text only
+		uint32            textOffset = 0;       // Text only. Range in OverlayDrawList::textPool.
+		uint32            textLength = 0;
+	};
 
-		MeshGeometry* geometry = nullptr;
-		Brush* brush = nullptr;
-		Transform transform;
-		std::vector<DisplayObject2DProxy*> children;
+	// Retained render data of a DisplayObject2D.
+	// Rebuilt only when the object's transform, visibility or content changes, or its brush is modified.
+	class DisplayObject2DProxy {
+	public:
+		OverlayTransform2D childTransform; // Children space to parent space
+		OverlayDrawItem item;
+		std::wstring text;                 // Text only
+		const Brush* brush = nullptr;
+		uint32 brushVersion = 0;
+		bool bHasItem = false;
 	};
 
-	class LabelProxy : public DisplayObject2DProxy {
+	// Flat list of visible items of a display object hierarchy, in screen space and in drawing order.
+	// Snapshot of retained proxies so that the render thread doesn't touch display objects.
+	class OverlayDrawList {
 	public:
-		bool onRender(RenderCommandList* cmdList) override;
+		void clear();
+		void addItem(const OverlayDrawItem& item, const OverlayTransform2D& parentToScreen, const std::wstring& text);
 
-		std::wstring text;
-		FontDesc fontDesc;
+		inline bool isEmpty() const { return items.size() == 0; }
+
+		std::vector<OverlayDrawItem> items;
+		std::vector<wchar_t> textPool;
+		bool bRootVisible = false;
 	};
 
-	class RectangleProxy : public DisplayObject2DProxy {
-	public:
-		float width;
-		float height;
+	struct OverlayProxyStats {
+		uint32 numVisited = 0; // Visible objects
+		uint32 numRebuilt = 0; // Proxies that were rebuilt
+		uint32 numItems = 0;   // Items added to the draw list
 	};
 
 	// Overlay version of SceneProxy
@@ -54,22 +80,12 @@ namespace pathos {
 	public:
 		OverlaySceneProxy(uint32 inViewportWidth, uint32 inViewportHeight);
 
-		template<typename T>
-		T* allocate() {
-			T* proxy = reinterpret_cast<T*>(renderProxyAllocator.alloc(sizeof(T)));
-			CHECK(proxy != nullptr);
-			new (proxy) T;
-			return proxy;
-		}
-
-		StackAllocator renderProxyAllocator;
-
 		uint32 viewportWidth;
 		uint32 viewportHeight;
 
-		DisplayObject2DProxy* appOverlayRootProxy = nullptr;
-		DisplayObject2DProxy* debugOverlayRootProxy = nullptr;
-		DisplayObject2DProxy* consoleWindowRootProxy = nullptr;
+		OverlayDrawList appOverlay;
+		OverlayDrawList debugOverlay;
+		OverlayDrawList consoleWindow;
 	};
 
 }
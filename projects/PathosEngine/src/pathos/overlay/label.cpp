@@ -1,8 +1,8 @@
 #include "label.h"
 #include "brush.h"
-#include "display_object_proxy.h"
 
 #include "pathos/text/font_mgr.h"
+#include "pathos/text/font_texture_cache.h"
 
 // Fallback font that must exist.
 #define DEFAULT_FONT_TAG    "default"
@@ -15,12 +15,8 @@ namespace pathos {
 
 		bReceivesMouseInput = false;
 
-		geometry = makeAssetPtr<TextGeometry>();
-		geometry->bCalculateLocalBounds = false;
-
 		setBrush(new TextBrush(1.0f, 1.0f, 1.0f));
-		setScaleX(300.0f);
-		setScaleY(300.0f);
+		setScaleXY(300.0f, 300.0f);
 	}
 
 	Label::Label(const wchar_t* text)
@@ -29,31 +25,27 @@ namespace pathos {
 		setText(text);
 	}
 
-	Label::~Label() {
-		geometry.reset();
-	}
-
-	DisplayObject2DProxy* Label::createRenderProxy(OverlaySceneProxy* sceneProxy) {
-		if (getVisible() && text.size() > 0) {
-			updateTransform(sceneProxy->viewportWidth, sceneProxy->viewportHeight);
+	Label::~Label() {}
 
-			LabelProxy* proxy = sceneProxy->allocate<LabelProxy>();
-			proxy->x = x;
-			proxy->y = y;
-			proxy->scaleX = scaleX;
-			proxy->scaleY = scaleY;
-			proxy->geometry = geometry.get();
-			proxy->brush = getBrush();
-			proxy->transform = transform;
-			proxy->text = text;
-			proxy->fontDesc = fontDesc;
-			return proxy;
+	bool Label::updateRenderProxy(DisplayObject2DProxy& proxy) {
+		Brush* brush = getBrush();
+		if (brush == nullptr || text.size() == 0 || fontDesc.cacheTexture == nullptr) {
+			return false;
 		}
-		return nullptr;
+		proxy.item = OverlayDrawItem{};
+		brush->fillDrawItem(proxy.item);
+		proxy.item.type = EOverlayItemType::Text;
+		proxy.item.transform = OverlayTransform2D{ vector2(x, y), vector2(scaleX, scaleY) };
+		proxy.item.fontCache = fontDesc.cacheTexture;
+		proxy.text = text;
+		return true;
 	}
 
 	void Label::setText(const wchar_t* newText) {
-		text = newText;
+		if (text != newText) {
+			text = newText;
+			markDirty(EOverlayDirtyFlags::Content);
+		}
 	}
 
 	void Label::setColor(const vector3& newColor) {
@@ -66,16 +58,13 @@ namespace pathos {
 			validDesc = FontManager::get().getFontDesc(DEFAULT_FONT_TAG, fontDesc);
 		}
 		CHECK(validDesc);
+		markDirty(EOverlayDirtyFlags::Content);
 	}
 
 	uint32 Label::getTextWidth() const {
-		return geometry->getTextWidth(*fontDesc.cacheTexture, text);
-	}
-
-	void Label::updateTransform(uint32 viewportWidth, uint32 viewportHeight) {
-		transform.identity();
-		transform.prependScale(scaleX, scaleY, 1.0f);
-		transform.prependMove(x, y, 0.0f);
+		uint32 width = 0;
+		for (wchar_t ch : text) width += fontDesc.cacheTexture->getCharWidth(ch);
+		return width;
 	}
 
 }
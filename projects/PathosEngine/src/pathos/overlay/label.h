@@ -1,9 +1,7 @@
 #pragma once
 
 #include "display_object.h"
-#include "pathos/text/text_geometry.h"
 #include "pathos/text/font_mgr.h"
-#include "pathos/smart_pointer.h"
 
 #include <string>
 
@@ -16,7 +14,7 @@ namespace pathos {
 		Label(const wchar_t* text);
 		~Label();
 
-		DisplayObject2DProxy* createRenderProxy(OverlaySceneProxy* sceneProxy) override;
+		bool updateRenderProxy(DisplayObject2DProxy& proxy) override;
 
 		void setText(const wchar_t* newText);
 		void setColor(const vector3& newColor);
@@ -27,12 +25,8 @@ namespace pathos {
 		const std::wstring& getText() const { return text; }
 		std::wstring getText() { return text; }
 
-	protected:
-		virtual void updateTransform(uint32 viewportWidth, uint32 viewportHeight) override;
-
 	private:
 		std::wstring text;
-		assetPtr<TextGeometry> geometry;
 		FontDesc fontDesc;
 
 	};
@@ -1,6 +1,5 @@
 #include "rectangle.h"
-#include "display_object_proxy.h"
-#include "pathos/engine.h"
+#include "brush.h"
 
 #include "badger/assertion/assertion.h"
 
@@ -8,26 +7,21 @@ namespace pathos {
 
 	Rectangle::Rectangle(float inWidth, float inHeight) {
 		setSize(inWidth, inHeight);
-		geom = gEngine->getSystemGeometryUnitPlane();
 	}
 
-	DisplayObject2DProxy* Rectangle::createRenderProxy(OverlaySceneProxy* sceneProxy) {
-		if (getVisible()) {
-			updateTransform(sceneProxy->viewportWidth, sceneProxy->viewportHeight);
-
-			RectangleProxy* proxy = sceneProxy->allocate<RectangleProxy>();
-			proxy->x = x;
-			proxy->y = y;
-			proxy->scaleX = scaleX;
-			proxy->scaleY = scaleY;
-			proxy->geometry = geom.get();
-			proxy->brush = getBrush();
-			proxy->transform = transform;
-			proxy->width = width;
-			proxy->height = height;
-			return proxy;
+	bool Rectangle::updateRenderProxy(DisplayObject2DProxy& proxy) {
+		Brush* brush = getBrush();
+		if (brush == nullptr) {
+			return false;
+		}
+		proxy.item = OverlayDrawItem{};
+		brush->fillDrawItem(proxy.item);
+		if (proxy.item.type == EOverlayItemType::Text) {
+			// Text brush is only for labels.
+			return false;
 		}
-		return nullptr;
+		proxy.item.transform = OverlayTransform2D{ vector2(x, y), vector2(width * scaleX, height * scaleY) };
+		return true;
 	}
 
 	bool Rectangle::onMouseHitTest(int32 mouseX, int32 mouseY) const {
@@ -39,19 +33,11 @@ namespace pathos {
 
 	void Rectangle::setSize(float inWidth, float inHeight) {
 		CHECK(inWidth >= 0.0f && inHeight >= 0.0f);
-		width = inWidth;
-		height = inHeight;
-	}
-
-	void Rectangle::updateTransform(uint32 viewportWidth, uint32 viewportHeight) {
-		transform.identity();
-
-		// Bring plane geometry that covers entire NDC to entire viewport
-		transform.prependMove(1.0f, -1.0f, 0.0f);
-		transform.prependScale(0.5f * viewportWidth, -0.5f * viewportHeight, 1.0f);
-
-		transform.prependScale(width * scaleX / viewportWidth, height * scaleY / viewportHeight, 1.0f);
-		transform.prependMove(x, y, 0.0f);
+		if (width != inWidth || height != inHeight) {
+			width = inWidth;
+			height = inHeight;
+			markDirty(EOverlayDirtyFlags::Content);
+		}
 	}
 
 }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "display_object.h"
-#include "pathos/mesh/geometry_primitive.h"
 
 namespace pathos {
 
@@ -10,7 +9,7 @@ namespace pathos {
 	public:
 		Rectangle(float inWidth, float inHeight);
 
-		DisplayObject2DProxy* createRenderProxy(OverlaySceneProxy* sceneProxy) override;
+		bool updateRenderProxy(DisplayObject2DProxy& proxy) override;
 
 		// User input
 		virtual bool onMouseHitTest(int32 mouseX, int32 mouseY) const override;
@@ -23,11 +22,8 @@ namespace pathos {
 		inline float getUnscaledHeight() const { return height; }
 
 	protected:
-		float width;
-		float height;
-		assetPtr<MeshGeometry> geom;
-
-		virtual void updateTransform(uint32 viewportWidth, uint32 viewportHeight) override;
+		float width = 0.0f;
+		float height = 0.0f;
 
 	};
 
@@ -0,0 +1,176 @@
+#include "overlay_batcher.h"
+#include "pathos/overlay/display_object_proxy.h"
+
+#include "badger/math/minmax.h"
+
+namespace pathos {
+
+	// Bounds the cost of finding overlapping quads. If exceeded, the quad is assumed to overlap the last batch.
+	static constexpr uint32 MAX_OVERLAP_TESTS = 1024;
+
+	static vector4 getQuadBounds(const OverlayQuad& quad) {
+		return vector4(
+			badger::min(quad.rect.x, quad.rect.z), badger::min(quad.rect.y, quad.rect.w),
+			badger::max(quad.rect.x, quad.rect.z), badger::max(quad.rect.y, quad.rect.w));
+	}
+
+	// Rects that only share edges don't overlap.
+	static bool boundsOverlap(const vector4& a, const vector4& b) {
+		return a.x < b.z && b.x < a.z && a.y < b.w && b.y < a.w;
+	}
+
+	void OverlayBatcher::clear() {
+		pendingQuads.clear();
+		pendingBounds.clear();
+		pendingBatchIndices.clear();
+		batchFirstPendingQuads.clear();
+		batches.clear();
+		sortedQuads.clear();
+		for (std::vector<uint32>& cell : gridCells) {
+			cell.clear();
+		}
+		largeQuads.clear();
+	}
+
+	void OverlayBatcher::addQuad(const OverlayQuad& quad, Texture* texture) {
+		if (gridCells.size() == 0) {
+			gridCells.resize(GRID_DIMENSION * GRID_DIMENSION);
+		}
+
+		const vector4 bounds = getQuadBounds(quad);
+		const int32 numBatches = (int32)batches.size();
+		const int32 minBatch = findLastOverlappingBatch(bounds);
+
+		int32 targetBatch = -1;
+		if (texture == nullptr) {
+			if (numBatches > 0) {
+				targetBatch = badger::max(minBatch, 0);
+			}
+		} else {
+			for (int32 i = numBatches - 1; i >= badger::max(minBatch, 0); --i) {
+				if (batches[i].texture == texture) {
+					targetBatch = i;
+					break;
+				}
+				if (batches[i].texture == nullptr && targetBatch == -1) {
+					targetBatch = i;
+				}
+			}
+		}
+
+		if (targetBatch == -1) {
+			targetBatch = numBatches;
+			batches.push_back(OverlayBatch{ texture, 0, 0 });
+			batchFirstPendingQuads.push_back((uint32)pendingQuads.size());
+		} else if (batches[targetBatch].texture == nullptr) {
+			batches[targetBatch].texture = texture;
+		}
+		batches[targetBatch].numQuads += 1;
+
+		const uint32 quadIndex = (uint32)pendingQuads.size();
+		pendingQuads.push_back(quad);
+		pendingBounds.push_back(bounds);
+		pendingBatchIndices.push_back((uint32)targetBatch);
+
+		uint32 x0, y0, x1, y1;
+		getCellRange(bounds, x0, y0, x1, y1);
+		if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS_PER_QUAD) {
+			largeQuads.push_back(quadIndex);
+		} else {
+			for (uint32 y = y0; y <= y1; ++y) {
+				for (uint32 x = x0; x <= x1; ++x) {
+					gridCells[y * GRID_DIMENSION + x].push_back(quadIndex);
+				}
+			}
+		}
+	}
+
+	int32 OverlayBatcher::findLastOverlappingBatch(const vector4& bounds) const {
+		const int32 numBatches = (int32)batches.size();
+		int32 lastBatch = -1;
+		uint32 numTests = 0;
+
+		// Quad indices are in increasing order, and quads added before a batch was started are in earlier batches.
+		auto testQuads = [&](const std::vector<uint32>& quadIndices) -> bool {
+			for (auto it = quadIndices.rbegin(); it != quadIndices.rend(); ++it) {
+				if (lastBatch + 1 >= numBatches || *it < batchFirstPendingQuads[lastBatch + 1]) {
+					break;
+				}
+				if (++numTests > MAX_OVERLAP_TESTS) {
+					lastBatch = numBatches - 1;
+					return false;
+				}
+				const int32 batchIndex = (int32)pendingBatchIndices[*it];
+				if (batchIndex > lastBatch && boundsOverlap(pendingBounds[*it], bounds)) {
+					lastBatch = batchIndex;
+				}
+			}
+			return true;
+		};
+
+		if (!testQuads(largeQuads)) {
+			return lastBatch;
+		}
+		uint32 x0, y0, x1, y1;
+		getCellRange(bounds, x0, y0, x1, y1);
+		for (uint32 y = y0; y <= y1; ++y) {
+			for (uint32 x = x0; x <= x1; ++x) {
+				if (!testQuads(gridCells[y * GRID_DIMENSION + x])) {
+					return lastBatch;
+				}
+			}
+		}
+		return lastBatch;
+	}
+
+	void OverlayBatcher::getCellRange(const vector4& bounds, uint32& x0, uint32& y0, uint32& x1, uint32& y1) const {
+		// Quads outside of the grid are put in the border cells.
+		auto toCell = [](float v) -> uint32 {
+			const float cell = v / (float)GRID_CELL_SIZE;
+			return (cell <= 0.0f) ? 0 : badger::min((uint32)cell, GRID_DIMENSION - 1);
+		};
+		x0 = toCell(bounds.x);
+		y0 = toCell(bounds.y);
+		x1 = toCell(bounds.z);
+		y1 = toCell(bounds.w);
+	}
+
+	bool OverlayBatcher::addItem(const OverlayDrawItem& item) {
+		OverlayQuad quad{};
+		quad.rect = vector4(
+			item.transform.transformPoint(vector2(0.0f, 0.0f)),
+			item.transform.transformPoint(vector2(1.0f, 1.0f)));
+		quad.color = item.color;
+		if (item.type == EOverlayItemType::SolidColor) {
+			quad.mode = (uint32)EOverlayQuadMode::SolidColor;
+			addQuad(quad, nullptr);
+			return true;
+		} else if (item.type == EOverlayItemType::Image && item.texture != nullptr) {
+			// Images are stored bottom to top.
+			quad.uvRect = vector4(0.0f, 1.0f, 1.0f, 0.0f);
+			quad.mode = (uint32)EOverlayQuadMode::Image;
+			addQuad(quad, item.texture);
+			return true;
+		}
+		return false;
+	}
+
+	void OverlayBatcher::finalize() {
+		uint32 firstQuad = 0;
+		for (OverlayBatch& batch : batches) {
+			batch.firstQuad = firstQuad;
+			firstQuad += batch.numQuads;
+		}
+
+		// Counting sort. Quads keep their order within a batch.
+		sortedQuads.resize(pendingQuads.size());
+		std::vector<uint32> cursors(batches.size());
+		for (size_t i = 0; i < batches.size(); ++i) {
+			cursors[i] = batches[i].firstQuad;
+		}
+		for (size_t i = 0; i < pendingQuads.size(); ++i) {
+			sortedQuads[cursors[pendingBatchIndices[i]]++] = pendingQuads[i];
+		}
+	}
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+
+#include <vector>
+
+namespace pathos {
+
+	class Texture;
+	struct OverlayDrawItem;
+
+	enum class EOverlayQuadMode : uint32 {
+		SolidColor = 0, // color
+		Image      = 1, // texture * color
+		Text       = 2, // (color.rgb, texture.r * color.a)
+	};
+
+	// Layout of a quad in the storage buffer of overlay_batch.glsl (std430).
+	struct OverlayQuad {
+		vector4 rect;   // (x0, y0, x1, y1) in screen space
+		vector4 uvRect; // UV at (x0, y0) and (x1, y1)
+		vector4 color;
+		uint32  mode;   // EOverlayQuadMode
+		uint32  padding0;
+		uint32  padding1;
+		uint32  padding2;
+	};
+	static_assert(sizeof(OverlayQuad) == 64, "Should match with the struct in overlay_batch.glsl");
+
+	// Quads of a batch are drawn with a single draw call.
+	struct OverlayBatch {
+		Texture* texture;  // nullptr if the batch only has solid color quads
+		uint32   firstQuad;
+		uint32   numQuads;
+	};
+
+	// Merges overlay quads into as few batches as possible while keeping the result of painter's algorithm.
+	// A quad is drawn after the quads it overlaps, so it can join any batch from the last one that has
+	// an overlapping quad. Textured quads look for a batch with the same texture, and solid color quads,
+	// which can join any batch, take the earliest one to leave later batches free for textured quads.
+	class OverlayBatcher {
+
+	public:
+		void clear();
+
+		// Quads must be added in drawing order.
+		void addQuad(const OverlayQuad& quad, Texture* texture);
+
+		// Add the quad of a solid color or image item. Returns false for other items.
+		bool addItem(const OverlayDrawItem& item);
+
+		// Lay out quads of each batch contiguously. Call before getBatches() and getQuads().
+		void finalize();
+
+		inline const std::vector<OverlayBatch>& getBatches() const { return batches; }
+		inline const std::vector<OverlayQuad>& getQuads() const { return sortedQuads; }
+		inline uint32 getNumQuads() const { return (uint32)pendingQuads.size(); }
+
+	private:
+		// Screen is divided into cells to find overlapping quads. Quads that cover too many cells are tested against every quad.
+		static constexpr uint32 GRID_CELL_SIZE = 64;
+		static constexpr uint32 GRID_DIMENSION = 32;
+		static constexpr uint32 MAX_CELLS_PER_QUAD = 16;
+
+		// Returns the last batch that has a quad overlapping the bounds, or -1.
+		int32 findLastOverlappingBatch(const vector4& bounds) const;
+		void getCellRange(const vector4& bounds, uint32& x0, uint32& y0, uint32& x1, uint32& y1) const;
+
+		std::vector<OverlayQuad> pendingQuads;
+		std::vector<vector4> pendingBounds;
+		std::vector<uint32> pendingBatchIndices; // Batch index of each pending quad
+		std::vector<uint32> batchFirstPendingQuads; // Quads added before a batch was started are in earlier batches
+		std::vector<OverlayBatch> batches;
+		std::vector<OverlayQuad> sortedQuads;
+
+		std::vector<std::vector<uint32>> gridCells; // Pending quad indices in each cell
+		std::vector<uint32> largeQuads;
+	};
+
+}
@@ -1,6 +0,0 @@
-#pragma once
-
-#include "overlaypass_base.h"
-#include "overlaypass_standard.h"
-#include "overlaypass_text.h"
-#include "overlaypass_image.h"
@@ -1,6 +0,0 @@
-#include "overlaypass_base.h"
-#include "pathos/rhi/render_device.h"
-
-namespace pathos {
-
-}
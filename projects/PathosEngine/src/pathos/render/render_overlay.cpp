@@ -1,84 +1,167 @@
 #include "render_overlay.h"
-#include "pathos/engine.h"
 #include "pathos/render/scene_render_targets.h"
-#include "pathos/render/overlay/overlaypass.h"
-#include "pathos/overlay/display_object.h"
+#include "pathos/rhi/render_device.h"
+#include "pathos/rhi/upload_ring_buffer.h"
+#include "pathos/rhi/shader_program.h"
+#include "pathos/rhi/buffer.h"
+#include "pathos/rhi/texture.h"
 #include "pathos/overlay/display_object_proxy.h"
-#include "pathos/overlay/brush.h"
+#include "pathos/text/font_texture_cache.h"
 
 #include "badger/assertion/assertion.h"
+#include "badger/math/minmax.h"
+
+namespace pathos {
+
+	static constexpr GLuint UBO_BINDING_POINT = 1;
+	static constexpr GLuint QUAD_BUFFER_BINDING = 0;
+	static constexpr GLuint QUAD_TEXTURE_UNIT = 0;
+	static constexpr uint32 FALLBACK_BUFFER_QUADS = 4096;
+
+	struct UBO_OverlayBatch {
+		vector4 screenToNDC;
+	};
+
+	class OverlayBatchVS : public ShaderStage {
+	public:
+		OverlayBatchVS() : ShaderStage(GL_VERTEX_SHADER, "OverlayBatchVS") {
+			addDefine("VERTEX_SHADER", 1);
+			setFilepath("overlay/overlay_batch.glsl");
+		}
+	};
+
+	class OverlayBatchFS : public ShaderStage {
+	public:
+		OverlayBatchFS() : ShaderStage(GL_FRAGMENT_SHADER, "OverlayBatchFS") {
+			addDefine("FRAGMENT_SHADER", 1);
+			setFilepath("overlay/overlay_batch.glsl");
+		}
+	};
+
+	DEFINE_SHADER_PROGRAM2(Program_OverlayBatch, OverlayBatchVS, OverlayBatchFS);
+
+}
 
 namespace pathos {
 
 	OverlayRenderer::OverlayRenderer() {
-		createShaders();
+		ubo.init<UBO_OverlayBatch>("UBO_OverlayBatch");
+		gRenderDevice->createVertexArrays(1, &dummyVAO);
 	}
+
 	OverlayRenderer::~OverlayRenderer() {
-		destroyShaders();
-	}
-	
-	void OverlayRenderer::createShaders() {
-		renderpass_standard = new OverlayPass_Standard;
-		renderpass_text = new OverlayPass_Text;
-		renderpass_image = new OverlayPass_Image;
-	}
-	void OverlayRenderer::destroyShaders() {
-#define release(x) if(x) delete x
-		release(renderpass_standard);
-		release(renderpass_text);
-		release(renderpass_image);
-#undef release
+		if (fallbackQuadBuffer != nullptr) {
+			delete fallbackQuadBuffer;
+		}
+		gRenderDevice->deleteVertexArrays(1, &dummyVAO);
 	}
 
-	void OverlayRenderer::renderOverlay(RenderCommandList& cmdList, DisplayObject2DProxy* inRootProxy) {
+	void OverlayRenderer::renderOverlay(RenderCommandList& cmdList, const OverlayDrawList& drawList) {
 		SCOPED_DRAW_EVENT(Overlay);
 
 		CHECK(cmdList.sceneRenderTargets);
 		const uint32 sceneWidth = cmdList.sceneRenderTargets->unscaledSceneWidth;
 		const uint32 sceneHeight = cmdList.sceneRenderTargets->unscaledSceneHeight;
 
-		root = inRootProxy;
-		//CHECK(root && root->isRoot());
-
 		cmdList.viewport(0, 0, sceneWidth, sceneHeight);
 		cmdList.disable(GL_CULL_FACE);
 		cmdList.disable(GL_DEPTH_TEST);
 
-		CHECK(cmdList.sceneRenderTargets);
-		calculateTransformNDC(sceneWidth, sceneHeight);
+		// From viewport convention to NDC
+		// Viewport: (0,0) is top left, +x to right, +y to bottom
+		UBO_OverlayBatch uboData;
+		uboData.screenToNDC = vector4(2.0f / sceneWidth, -2.0f / sceneHeight, -1.0f, 1.0f);
+		ubo.update(cmdList, UBO_BINDING_POINT, &uboData);
+
+		numQuads = 0;
+		numDrawCalls = 0;
+		batcher.clear();
 
-		render_recurse(cmdList, root, toNDC);
+		for (const OverlayDrawItem& item : drawList.items) {
+			if (item.type == EOverlayItemType::Text) {
+				if (item.fontCache != nullptr && item.textLength > 0) {
+					addTextQuads(cmdList, item, &drawList.textPool[item.textOffset]);
+				}
+			} else {
+				batcher.addItem(item);
+			}
+		}
+		flushBatches(cmdList);
 
 		cmdList.enable(GL_DEPTH_TEST);
 		cmdList.enable(GL_CULL_FACE);
 
-		root = nullptr;
+		lastNumQuads = numQuads;
+		lastNumDrawCalls = numDrawCalls;
 	}
 
-	void OverlayRenderer::render_recurse(RenderCommandList& cmdList, DisplayObject2DProxy* object, const Transform& accumTransform) {
-		Transform finalTransform = accumTransform;
-		finalTransform.append(object->transform.getMatrix());
+	void OverlayRenderer::addTextQuads(RenderCommandList& cmdList, const OverlayDrawItem& item, const wchar_t* text) {
+		FontTextureCache& cache = *item.fontCache;
+		// Glyphs of pending quads are about to be overwritten in the cache texture. Draw them first.
+		const TextLayout& layout = cache.layoutText(cmdList, text, item.textLength, [this, &cmdList]() {
+			flushBatches(cmdList);
+		});
+		for (const TextLayoutQuad& glyph : layout.quads) {
+			OverlayQuad quad{};
+			quad.rect = vector4(
+				item.transform.transformPoint(vector2(glyph.rect.x, glyph.rect.y)),
+				item.transform.transformPoint(vector2(glyph.rect.z, glyph.rect.w)));
+			quad.uvRect = glyph.uvRect;
+			quad.color = item.color;
+			quad.mode = (uint32)EOverlayQuadMode::Text;
+			batcher.addQuad(quad, cache.getTexture());
+		}
+	}
 
-		if (object->brush != nullptr && object->geometry != nullptr) {
-			OverlayPass* renderpass = object->brush->configure(this, finalTransform);
-			if (object->onRender(&cmdList)) {
-				renderpass->renderOverlay(cmdList, object, finalTransform);
-			}
+	void OverlayRenderer::flushBatches(RenderCommandList& cmdList) {
+		if (batcher.getNumQuads() == 0) {
+			return;
 		}
-		
-		Transform newAccumTransform = accumTransform;
-		newAccumTransform.append(object->getLocalTransform());
-		for (DisplayObject2DProxy* child : object->children) {
-			render_recurse(cmdList, child, newAccumTransform);
+		batcher.finalize();
+		const std::vector<OverlayQuad>& quads = batcher.getQuads();
+		const std::vector<OverlayBatch>& batches = batcher.getBatches();
+
+		ShaderProgram& program = FIND_SHADER_PROGRAM(Program_OverlayBatch);
+		cmdList.useProgram(program.getGLName());
+		cmdList.bindVertexArray(dummyVAO);
+		cmdList.enable(GL_BLEND);
+		cmdList.blendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+
+		UploadRingBuffer* uploadRing = gRenderDevice->getUploadRingBuffer();
+		const uint32 totalBytes = (uint32)(quads.size() * sizeof(OverlayQuad));
+		if (uploadRing != nullptr && uploadRing->bindStorageData(cmdList, QUAD_BUFFER_BINDING, quads.data(), totalBytes)) {
+			for (const OverlayBatch& batch : batches) {
+				if (batch.texture != nullptr) {
+					cmdList.bindTextureUnit(QUAD_TEXTURE_UNIT, batch.texture->internal_getGLName());
+				}
+				cmdList.drawArrays(GL_TRIANGLES, (GLint)(6 * batch.firstQuad), (GLsizei)(6 * batch.numQuads));
+				++numDrawCalls;
+			}
+		} else {
+			if (fallbackQuadBuffer == nullptr) {
+				BufferCreateParams createParams{ EBufferUsage::CpuWrite, FALLBACK_BUFFER_QUADS * sizeof(OverlayQuad), nullptr, "Buffer_OverlayQuads" };
+				fallbackQuadBuffer = new Buffer(createParams);
+				fallbackQuadBuffer->createGPUResource_renderThread(cmdList);
+			}
+			fallbackQuadBuffer->bindAsSSBO(cmdList, QUAD_BUFFER_BINDING);
+			for (const OverlayBatch& batch : batches) {
+				if (batch.texture != nullptr) {
+					cmdList.bindTextureUnit(QUAD_TEXTURE_UNIT, batch.texture->internal_getGLName());
+				}
+				for (uint32 first = 0; first < batch.numQuads; first += FALLBACK_BUFFER_QUADS) {
+					const uint32 count = badger::min(batch.numQuads - first, FALLBACK_BUFFER_QUADS);
+					fallbackQuadBuffer->writeToGPU_renderThread(cmdList, 0, count * sizeof(OverlayQuad), (void*)&quads[batch.firstQuad + first]);
+					cmdList.drawArrays(GL_TRIANGLES, 0, (GLsizei)(6 * count));
+					++numDrawCalls;
+				}
+			}
 		}
-	}
 
-	void OverlayRenderer::calculateTransformNDC(uint32 sceneWidth, uint32 sceneHeight) {
-		// From viewport convention to NDC
-		// Viewport: (0,0) is top left, +x to right, +y to bottom
-		toNDC.identity();
-		toNDC.appendMove(-1.0f, 1.0f, 0.0f);
-		toNDC.appendScale(2.0f / sceneWidth, -2.0f / sceneHeight, 1.0f);
+		cmdList.disable(GL_BLEND);
+		cmdList.bindVertexArray(0);
+
+		numQuads += batcher.getNumQuads();
+		batcher.clear();
 	}
 
 }
@@ -1,49 +1,44 @@
 #pragma once
 
 #include "pathos/rhi/render_command_list.h"
-#include "pathos/util/transform_helper.h"
+#include "pathos/rhi/uniform_buffer.h"
+#include "pathos/render/overlay/overlay_batcher.h"
 
 #include "badger/types/noncopyable.h"
 
 namespace pathos {
 
-	class OverlayPass_Standard;
-	class OverlayPass_Text;
-	class OverlayPass_Image;
-	class DisplayObject2D;
-	class DisplayObject2DProxy;
+	class Buffer;
+	class OverlayDrawList;
+	struct OverlayDrawItem;
 
 	// Renders the overlay (2D display over 3D scene)
+	// Items of a draw list are converted to quads and merged into a few draw calls by OverlayBatcher.
 	class OverlayRenderer : public Noncopyable {
 
 	public:
 		OverlayRenderer();
 		virtual ~OverlayRenderer();
 
-		void renderOverlay(RenderCommandList& cmdList, DisplayObject2DProxy* inRootProxy);
-		void render_recurse(RenderCommandList& cmdList, DisplayObject2DProxy* objectProxy, const Transform& transformAccum);
+		void renderOverlay(RenderCommandList& cmdList, const OverlayDrawList& drawList);
 
-		// Brushes retrieve desired shader programs in the renderer, configure them, and draw the geometry.
-		inline OverlayPass_Standard* getStandardProgram() const { return renderpass_standard; }
-		inline OverlayPass_Text* getTextProgram() const { return renderpass_text; }
-		inline OverlayPass_Image* getImageProgram() const { return renderpass_image; }
-
-	protected:
-		void createShaders();
-		void destroyShaders();
-
-		// Render passes
-		OverlayPass_Standard* renderpass_standard = nullptr;
-		OverlayPass_Text* renderpass_text = nullptr;
-		OverlayPass_Image* renderpass_image = nullptr;
-
-		// Temporary variables (nullified after rendering is done each frame)
-		DisplayObject2DProxy* root = nullptr;
+		// Stats of the last renderOverlay() call
+		inline uint32 getLastNumQuads() const { return lastNumQuads; }
+		inline uint32 getLastNumDrawCalls() const { return lastNumDrawCalls; }
 
 	private:
-		void calculateTransformNDC(uint32 windowWidth, uint32 windowHeight);
-
-		Transform toNDC; // screen coordinates to NDC
+		void addTextQuads(RenderCommandList& cmdList, const OverlayDrawItem& item, const wchar_t* text);
+		void flushBatches(RenderCommandList& cmdList);
+
+		OverlayBatcher batcher;
+		UniformBuffer ubo;
+		Buffer* fallbackQuadBuffer = nullptr; // Used if the upload ring is full
+		GLuint dummyVAO = 0;
+
+		uint32 numQuads = 0;
+		uint32 numDrawCalls = 0;
+		uint32 lastNumQuads = 0;
+		uint32 lastNumDrawCalls = 0;
 
 	};
 
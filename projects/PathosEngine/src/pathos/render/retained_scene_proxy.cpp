@@ -0,0 +1,419 @@
+#include "retained_scene_proxy.h"
+#include "pathos/render/scene_proxy.h"
+#include "pathos/scene/static_mesh_component.h"
+#include "pathos/mesh/static_mesh.h"
+#include "pathos/mesh/geometry.h"
+#include "pathos/material/material.h"
+#include "pathos/material/material_proxy.h"
+#include "pathos/util/cpu_profiler.h"
+
+#include "badger/math/hit_test.h"
+#include "badger/assertion/assertion.h"
+#include <algorithm>
+#include <type_traits>
+
+namespace pathos {
+
+	static_assert(std::is_trivially_copyable<StaticMeshProxy>::value, "StaticMeshProxy is copied as a whole");
+	static_assert(std::is_trivially_copyable<ShadowMeshProxy>::value, "ShadowMeshProxy is copied as a whole");
+
+	// Max number of sections in a leaf of the culling BVH.
+	static constexpr uint32 CULLING_BVH_LEAF_SIZE = 8;
+
+	static bool isSameBounds(const AABB& A, const AABB& B) {
+		return A.minBounds == B.minBounds && A.maxBounds == B.maxBounds;
+	}
+
+	// Key for a material slot whose shader is not ready. Such sections are not drawn.
+	static StaticMeshDrawOrderKey makeMaterialOrderKey(const MaterialProxy* material) {
+		if (material == nullptr || material->materialShader == nullptr) {
+			return StaticMeshDrawOrderKey{ 0, 0xffffffffffffffffull };
+		}
+		return StaticMeshDrawOrderKey::make(material, false, false);
+	}
+
+	RetainedSceneProxy::RetainedSceneProxy() {}
+
+	RetainedSceneProxy::~RetainedSceneProxy() {}
+
+	uint32 RetainedSceneProxy::addStaticMesh(const RetainedStaticMeshDesc& desc) {
+		uint32 handle;
+		if (freeMeshHandles.size() > 0) {
+			handle = freeMeshHandles.back();
+			freeMeshHandles.pop_back();
+		} else {
+			handle = (uint32)meshes.size();
+			meshes.emplace_back();
+		}
+
+		StaticMeshItem& item = meshes[handle];
+		item.modelMatrix     = desc.modelMatrix;
+		item.prevModelMatrix = desc.modelMatrix;
+		item.movedFrame      = INVALID_HANDLE;
+		item.bAlive          = true;
+		item.doubleSided     = desc.doubleSided;
+		item.renderInternal  = desc.renderInternal;
+		item.castsShadow     = desc.castsShadow;
+		addSections(item, handle, desc);
+
+		++numAliveMeshes;
+		return handle;
+	}
+
+	void RetainedSceneProxy::updateStaticMesh(uint32 handle, const RetainedStaticMeshDesc& desc) {
+		CHECK(handle < meshes.size() && meshes[handle].bAlive);
+		StaticMeshItem& item = meshes[handle];
+
+		removeSections(item);
+		item.doubleSided    = desc.doubleSided;
+		item.renderInternal = desc.renderInternal;
+		item.castsShadow    = desc.castsShadow;
+		addSections(item, handle, desc);
+
+		if (item.modelMatrix != desc.modelMatrix) {
+			updateStaticMeshTransform(handle, desc.modelMatrix);
+		}
+	}
+
+	void RetainedSceneProxy::updateStaticMeshTransform(uint32 handle, const matrix4& modelMatrix) {
+		CHECK(handle < meshes.size() && meshes[handle].bAlive);
+		StaticMeshItem& item = meshes[handle];
+
+		// Keep the matrix of the last snapshot as prevModelMatrix, no matter how many times it moves in a frame.
+		if (item.movedFrame != frameCounter) {
+			item.prevModelMatrix = item.modelMatrix;
+			item.movedFrame = frameCounter;
+			movedMeshes.push_back(handle);
+		}
+		item.modelMatrix = modelMatrix;
+		updateSectionTransforms(item);
+	}
+
+	void RetainedSceneProxy::removeStaticMesh(uint32 handle) {
+		CHECK(handle < meshes.size() && meshes[handle].bAlive);
+		StaticMeshItem& item = meshes[handle];
+
+		removeSections(item);
+		item.bAlive = false;
+		freeMeshHandles.push_back(handle);
+		--numAliveMeshes;
+	}
+
+	bool RetainedSceneProxy::isStaticMeshOutdated(uint32 handle, const StaticMesh* mesh, bool castsShadow) const {
+		CHECK(handle < meshes.size() && meshes[handle].bAlive);
+		const StaticMeshItem& item = meshes[handle];
+
+		if (item.doubleSided != mesh->doubleSided || item.renderInternal != mesh->renderInternal || item.castsShadow != castsShadow) {
+			return true;
+		}
+
+		// #todo-lod: Select mesh LOD
+		const StaticMeshLOD& LOD = mesh->getLOD(0);
+		if (item.numSections != (uint32)LOD.geometries.size()) {
+			return true;
+		}
+		for (uint32 i = 0; i < item.numSections; ++i) {
+			const SectionItem& section = sections[item.firstSection + i];
+			const MeshGeometry* G = LOD.geometries[i].get();
+			const Material* M = LOD.materials[i].get();
+			if (section.geometry != G
+				|| M == nullptr
+				|| materialSlots[section.materialSlot].materialID != M->getMaterialID()
+				|| !isSameBounds(section.localBounds, G->getLocalBounds()))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void RetainedSceneProxy::fillSceneProxy(SceneProxy* scene) {
+		SCOPED_CPU_COUNTER(RetainedSceneProxy);
+
+		// Meshes that moved in the last frame but not in this frame are now at rest.
+		for (uint32 handle : settlingMeshes) {
+			StaticMeshItem& item = meshes[handle];
+			if (item.bAlive && item.movedFrame != frameCounter) {
+				item.prevModelMatrix = item.modelMatrix;
+				updateSectionTransforms(item);
+			}
+		}
+
+		// Material parameters can change anytime, so material proxies are always recreated.
+		// But only once per material, not per section.
+		const uint32 numMaterialSlots = (uint32)materialSlots.size();
+		frameMaterialProxies.assign(numMaterialSlots, nullptr);
+		materialOrderKeys.resize(numMaterialSlots, makeMaterialOrderKey(nullptr));
+		for (uint32 slot = 0; slot < numMaterialSlots; ++slot) {
+			if (materialSlots[slot].refCount == 0) {
+				continue;
+			}
+			frameMaterialProxies[slot] = materialSlots[slot].material->createMaterialProxy(scene);
+
+			StaticMeshDrawOrderKey orderKey = makeMaterialOrderKey(frameMaterialProxies[slot]);
+			if (orderKey != materialOrderKeys[slot]) {
+				materialOrderKeys[slot] = orderKey;
+				bDrawOrderDirty = true;
+			}
+		}
+
+		if (numDeadSections > 0 && numDeadSections >= (uint32)sections.size() / 2) {
+			compactSections();
+		}
+		if (bDrawOrderDirty) {
+			rebuildDrawOrder();
+		}
+		cullingBVH.refit(cullingBounds);
+
+		const uint32 numDraws = (uint32)drawMeshProxies.size();
+		const uint32 numShadowDraws = (uint32)drawShadowProxies.size();
+
+		StackAllocator& allocator = scene->renderProxyAllocator;
+		StaticMeshProxy* meshProxies = nullptr;
+		ShadowMeshProxy* shadowProxies = nullptr;
+		if (numDraws > 0) {
+			meshProxies = reinterpret_cast<StaticMeshProxy*>(allocator.alloc(numDraws * sizeof(StaticMeshProxy)));
+			CHECKF(meshProxies != nullptr, "Failed to allocate render proxy!!! Need to increase the allocator size.");
+			memcpy(meshProxies, drawMeshProxies.data(), numDraws * sizeof(StaticMeshProxy));
+		}
+		if (numShadowDraws > 0) {
+			shadowProxies = reinterpret_cast<ShadowMeshProxy*>(allocator.alloc(numShadowDraws * sizeof(ShadowMeshProxy)));
+			CHECKF(shadowProxies != nullptr, "Failed to allocate render proxy!!! Need to increase the allocator size.");
+			memcpy(shadowProxies, drawShadowProxies.data(), numShadowDraws * sizeof(ShadowMeshProxy));
+		}
+
+		scene->proxyList_shadowMesh.reserve(scene->proxyList_shadowMesh.size() + numShadowDraws);
+		for (uint32 i = 0; i < numShadowDraws; ++i) {
+			shadowProxies[i].material = frameMaterialProxies[drawShadowMaterialSlots[i]];
+			scene->addShadowMeshProxy(shadowProxies + i);
+		}
+
+		scene->proxyList_staticMeshOpaque.reserve(scene->proxyList_staticMeshOpaque.size() + numDraws);
+		scene->beginPresortedStaticMeshes();
+		for (uint32 i = 0; i < numDraws; ++i) {
+			meshProxies[i].material = frameMaterialProxies[drawMaterialSlots[i]];
+			scene->addStaticMeshProxy(meshProxies + i);
+		}
+		scene->endPresortedStaticMeshes();
+
+		if (numDraws > 0) {
+			fillCullingData(scene, meshProxies);
+		}
+
+		settlingMeshes.swap(movedMeshes);
+		movedMeshes.clear();
+		++frameCounter;
+	}
+
+	void RetainedSceneProxy::addSections(StaticMeshItem& item, uint32 handle, const RetainedStaticMeshDesc& desc) {
+		item.firstSection = (uint32)sections.size();
+		item.numSections = desc.numSections;
+		for (uint32 i = 0; i < desc.numSections; ++i) {
+			SectionItem section;
+			section.geometry     = desc.sections[i].geometry;
+			section.materialSlot = acquireMaterialSlot(desc.sections[i].material);
+			section.meshHandle   = handle;
+			section.localBounds  = desc.sections[i].localBounds;
+			section.drawIndex    = INVALID_HANDLE;
+			section.shadowDrawIndex = INVALID_HANDLE;
+			section.cullingIndex = INVALID_HANDLE;
+			sections.push_back(section);
+		}
+		updateSectionTransforms(item);
+		bDrawOrderDirty = true;
+	}
+
+	void RetainedSceneProxy::removeSections(StaticMeshItem& item) {
+		for (uint32 i = 0; i < item.numSections; ++i) {
+			SectionItem& section = sections[item.firstSection + i];
+			releaseMaterialSlot(section.materialSlot);
+			section.meshHandle = INVALID_HANDLE;
+		}
+		numDeadSections += item.numSections;
+		item.numSections = 0;
+		bDrawOrderDirty = true;
+	}
+
+	void RetainedSceneProxy::updateSectionTransforms(const StaticMeshItem& item) {
+		for (uint32 i = 0; i < item.numSections; ++i) {
+			SectionItem& section = sections[item.firstSection + i];
+			section.worldBounds = badger::calculateWorldBounds(section.localBounds, item.modelMatrix);
+
+			// Cached proxies will be regenerated anyway if draw order is dirty.
+			if (bDrawOrderDirty) {
+				continue;
+			}
+			if (section.drawIndex != INVALID_HANDLE) {
+				StaticMeshProxy& proxy = drawMeshProxies[section.drawIndex];
+				proxy.modelMatrix     = item.modelMatrix;
+				proxy.prevModelMatrix = item.prevModelMatrix;
+				proxy.worldBounds     = section.worldBounds;
+				cullingBounds.set(section.cullingIndex, section.worldBounds);
+				cullingBVH.markBoxMoved(section.cullingIndex);
+			}
+			if (section.shadowDrawIndex != INVALID_HANDLE) {
+				ShadowMeshProxy& proxy = drawShadowProxies[section.shadowDrawIndex];
+				proxy.modelMatrix     = item.modelMatrix;
+				proxy.worldBounds     = section.worldBounds;
+			}
+		}
+	}
+
+	uint32 RetainedSceneProxy::acquireMaterialSlot(Material* material) {
+		CHECK(material != nullptr);
+		const uint32 materialID = material->getMaterialID();
+		auto it = materialSlotMap.find(materialID);
+		if (it != materialSlotMap.end()) {
+			materialSlots[it->second].refCount += 1;
+			return it->second;
+		}
+
+		uint32 slot;
+		if (freeMaterialSlots.size() > 0) {
+			slot = freeMaterialSlots.back();
+			freeMaterialSlots.pop_back();
+		} else {
+			slot = (uint32)materialSlots.size();
+			materialSlots.emplace_back();
+		}
+		materialSlots[slot].material = material;
+		materialSlots[slot].materialID = materialID;
+		materialSlots[slot].refCount = 1;
+		materialSlotMap.insert(std::make_pair(materialID, slot));
+		return slot;
+	}
+
+	void RetainedSceneProxy::releaseMaterialSlot(uint32 slot) {
+		MaterialSlot& materialSlot = materialSlots[slot];
+		CHECK(materialSlot.refCount > 0);
+		materialSlot.refCount -= 1;
+		if (materialSlot.refCount == 0) {
+			materialSlotMap.erase(materialSlot.materialID);
+			materialSlot.material = nullptr;
+			freeMaterialSlots.push_back(slot);
+		}
+	}
+
+	void RetainedSceneProxy::compactSections() {
+		std::vector<SectionItem> compacted;
+		compacted.reserve(sections.size() - numDeadSections);
+		for (StaticMeshItem& item : meshes) {
+			if (item.bAlive) {
+				uint32 firstSection = (uint32)compacted.size();
+				for (uint32 i = 0; i < item.numSections; ++i) {
+					compacted.push_back(sections[item.firstSection + i]);
+				}
+				item.firstSection = firstSection;
+			}
+		}
+		sections.swap(compacted);
+		numDeadSections = 0;
+		bDrawOrderDirty = true;
+	}
+
+	void RetainedSceneProxy::rebuildDrawOrder() {
+		SCOPED_CPU_COUNTER(RebuildDrawOrder);
+
+		std::vector<std::pair<StaticMeshDrawOrderKey, uint32>> sortItems;
+		sortItems.reserve(sections.size());
+		for (uint32 i = 0; i < (uint32)sections.size(); ++i) {
+			const SectionItem& section = sections[i];
+			if (section.meshHandle == INVALID_HANDLE) {
+				continue;
+			}
+			const MaterialProxy* material = frameMaterialProxies[section.materialSlot];
+			if (material->materialShader == nullptr) {
+				continue;
+			}
+			const StaticMeshItem& item = meshes[section.meshHandle];
+			sortItems.emplace_back(StaticMeshDrawOrderKey::make(material, item.renderInternal, item.doubleSided), i);
+		}
+		std::sort(sortItems.begin(), sortItems.end(),
+			[](const std::pair<StaticMeshDrawOrderKey, uint32>& A, const std::pair<StaticMeshDrawOrderKey, uint32>& B) {
+				return A.first < B.first;
+			}
+		);
+
+		for (SectionItem& section : sections) {
+			section.drawIndex = INVALID_HANDLE;
+			section.shadowDrawIndex = INVALID_HANDLE;
+			section.cullingIndex = INVALID_HANDLE;
+		}
+
+		drawMeshProxies.resize(sortItems.size());
+		drawMaterialSlots.resize(sortItems.size());
+		drawShadowProxies.clear();
+		drawShadowMaterialSlots.clear();
+		for (uint32 i = 0; i < (uint32)sortItems.size(); ++i) {
+			SectionItem& section = sections[sortItems[i].second];
+			const StaticMeshItem& item = meshes[section.meshHandle];
+
+			StaticMeshProxy& proxy = drawMeshProxies[i];
+			proxy = StaticMeshProxy();
+			proxy.doubleSided      = item.doubleSided;
+			proxy.renderInternal   = item.renderInternal;
+			proxy.modelMatrix      = item.modelMatrix;
+			proxy.prevModelMatrix  = item.prevModelMatrix;
+			proxy.geometry         = section.geometry;
+			proxy.material         = nullptr; // Patched every frame
+			proxy.worldBounds      = section.worldBounds;
+			drawMaterialSlots[i]   = section.materialSlot;
+			section.drawIndex      = i;
+
+			if (item.castsShadow) {
+				ShadowMeshProxy shadowProxy;
+				shadowProxy.modelMatrix    = item.modelMatrix;
+				shadowProxy.geometry       = section.geometry;
+				shadowProxy.material       = nullptr; // Patched every frame
+				shadowProxy.worldBounds    = section.worldBounds;
+				shadowProxy.doubleSided    = item.doubleSided;
+				shadowProxy.renderInternal = item.renderInternal;
+				section.shadowDrawIndex = (uint32)drawShadowProxies.size();
+				drawShadowProxies.push_back(shadowProxy);
+				drawShadowMaterialSlots.push_back(section.materialSlot);
+			}
+		}
+
+		const uint32 numDraws = (uint32)sortItems.size();
+		std::vector<AABB> drawBounds(numDraws);
+		for (uint32 i = 0; i < numDraws; ++i) {
+			drawBounds[i] = drawMeshProxies[i].worldBounds;
+		}
+		cullingBVH.build(drawBounds, CULLING_BVH_LEAF_SIZE, cullingToDraw);
+		cullingBounds.resize(numDraws);
+		for (uint32 i = 0; i < numDraws; ++i) {
+			const uint32 drawIndex = cullingToDraw[i];
+			cullingBounds.set(i, drawBounds[drawIndex]);
+			sections[sortItems[drawIndex].second].cullingIndex = i;
+		}
+
+		bDrawOrderDirty = false;
+	}
+
+	void RetainedSceneProxy::fillCullingData(SceneProxy* scene, StaticMeshProxy* meshProxies) {
+		StackAllocator& allocator = scene->renderProxyAllocator;
+		auto copyToAllocator = [&allocator](const void* data, uint32 bytes) -> void* {
+			void* dest = allocator.alloc(bytes);
+			CHECKF(dest != nullptr, "Failed to allocate render proxy!!! Need to increase the allocator size.");
+			memcpy(dest, data, bytes);
+			return dest;
+		};
+
+		RetainedStaticMeshCulling& culling = scene->retainedStaticMeshCulling;
+		culling.proxies       = meshProxies;
+		culling.numProxies    = (uint32)drawMeshProxies.size();
+		culling.numBVHNodes   = cullingBVH.getNumNodes();
+		culling.bvhNodes      = reinterpret_cast<const badger::BVHNode*>(
+			copyToAllocator(cullingBVH.getNodes().data(), culling.numBVHNodes * sizeof(badger::BVHNode)));
+		culling.boundsToProxy = reinterpret_cast<const uint32*>(
+			copyToAllocator(cullingToDraw.data(), (uint32)cullingToDraw.size() * sizeof(uint32)));
+
+		const uint32 componentBytes = cullingBounds.getPaddedSize() * sizeof(float);
+		for (uint32 i = 0; i < (uint32)badger::EAABBComponent::Count; ++i) {
+			culling.worldBounds.components[i] = reinterpret_cast<const float*>(
+				copyToAllocator(cullingBounds.getComponent((badger::EAABBComponent)i), componentBytes));
+		}
+		culling.worldBounds.count = cullingBounds.size();
+	}
+
+}
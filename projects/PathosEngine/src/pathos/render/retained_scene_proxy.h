@@ -0,0 +1,140 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/matrix_types.h"
+#include "badger/types/noncopyable.h"
+#include "badger/math/aabb.h"
+#include "badger/math/frustum_culling.h"
+
+#include <vector>
+#include <unordered_map>
+
+/**
+ * Render data that persists across frames.
+ * Components register their render data once and update it only when it changes.
+ * Each SceneProxy then takes a snapshot of it instead of rebuilding every proxy from scratch.
+ */
+
+namespace pathos {
+
+	class SceneProxy;
+	class StaticMesh;
+	class MeshGeometry;
+	class Material;
+	class MaterialProxy;
+	struct StaticMeshProxy;
+	struct ShadowMeshProxy;
+	struct StaticMeshDrawOrderKey;
+
+	struct RetainedStaticMeshSection {
+		MeshGeometry*   geometry;
+		Material*       material;
+		AABB            localBounds;
+	};
+
+	struct RetainedStaticMeshDesc {
+		const RetainedStaticMeshSection* sections = nullptr;
+		uint32                           numSections = 0;
+		matrix4                          modelMatrix = matrix4(1.0f);
+		bool                             doubleSided = false;
+		bool                             renderInternal = false;
+		bool                             castsShadow = true;
+	};
+
+	class RetainedSceneProxy final : public Noncopyable {
+
+		struct StaticMeshItem {
+			matrix4 modelMatrix;
+			matrix4 prevModelMatrix;
+			uint32  firstSection;
+			uint32  numSections;
+			uint32  movedFrame; // Value of frameCounter when modelMatrix was last changed
+			bool    bAlive;
+			bool    doubleSided;
+			bool    renderInternal;
+			bool    castsShadow;
+		};
+		struct SectionItem {
+			MeshGeometry* geometry;
+			uint32        materialSlot;
+			uint32        meshHandle; // INVALID_HANDLE if the owner mesh was removed
+			AABB          localBounds;
+			AABB          worldBounds;
+			uint32        drawIndex;       // Index in drawMeshProxies
+			uint32        shadowDrawIndex; // Index in drawShadowProxies
+			uint32        cullingIndex;    // Index in cullingBounds
+		};
+		struct MaterialSlot {
+			Material*     material;
+			uint32        materialID; // Material::getMaterialID()
+			uint32        refCount;
+		};
+
+	public:
+		static constexpr uint32 INVALID_HANDLE = 0xffffffff;
+
+		RetainedSceneProxy();
+		~RetainedSceneProxy();
+
+		// Returns a handle to update or remove the static mesh later.
+		uint32 addStaticMesh(const RetainedStaticMeshDesc& desc);
+		// Replace sections and render states. Transform is also updated.
+		void updateStaticMesh(uint32 handle, const RetainedStaticMeshDesc& desc);
+		void updateStaticMeshTransform(uint32 handle, const matrix4& modelMatrix);
+		void removeStaticMesh(uint32 handle);
+
+		// Check if sections or render states of a registered mesh differ from the static mesh asset (LOD 0).
+		bool isStaticMeshOutdated(uint32 handle, const StaticMesh* mesh, bool castsShadow) const;
+
+		// Take a snapshot of registered data into the scene proxy. Call once per scene proxy.
+		void fillSceneProxy(SceneProxy* scene);
+
+		inline uint32 getNumStaticMeshes() const { return numAliveMeshes; }
+		inline uint32 getNumSections() const { return (uint32)sections.size() - numDeadSections; }
+
+	private:
+		void addSections(StaticMeshItem& item, uint32 handle, const RetainedStaticMeshDesc& desc);
+		void removeSections(StaticMeshItem& item);
+		void updateSectionTransforms(const StaticMeshItem& item);
+		uint32 acquireMaterialSlot(Material* material);
+		void releaseMaterialSlot(uint32 slot);
+		void compactSections();
+		void rebuildDrawOrder();
+		void fillCullingData(SceneProxy* scene, StaticMeshProxy* meshProxies);
+
+	private:
+		std::vector<StaticMeshItem> meshes;
+		std::vector<uint32>         freeMeshHandles;
+		uint32                      numAliveMeshes = 0;
+
+		std::vector<SectionItem>    sections;
+		uint32                      numDeadSections = 0;
+
+		std::vector<MaterialSlot>   materialSlots;
+		std::vector<uint32>         freeMaterialSlots;
+		std::unordered_map<uint32, uint32> materialSlotMap; // Material ID -> slot. Addresses might be reused by new materials.
+
+		// Proxies of all sections, sorted by StaticMeshDrawOrderKey.
+		// Each frame copies them as a whole and only patches material proxies.
+		std::vector<StaticMeshProxy> drawMeshProxies;
+		std::vector<ShadowMeshProxy> drawShadowProxies;
+		std::vector<uint32>          drawMaterialSlots;
+		std::vector<uint32>          drawShadowMaterialSlots;
+		bool                         bDrawOrderDirty = false;
+		std::vector<StaticMeshDrawOrderKey> materialOrderKeys; // Per material slot, as of the last sort
+
+		// World bounds of drawMeshProxies in BVH order, for frustum culling in the render thread.
+		badger::AABBStream              cullingBounds;
+		badger::BoundingVolumeHierarchy cullingBVH;
+		std::vector<uint32>             cullingToDraw; // BVH order -> index in drawMeshProxies
+
+		// Meshes that moved in this frame and in the last frame. Needed to settle prevModelMatrix.
+		std::vector<uint32>         movedMeshes;
+		std::vector<uint32>         settlingMeshes;
+		uint32                      frameCounter = 0;
+
+		// Scratch memory for fillSceneProxy()
+		std::vector<MaterialProxy*> frameMaterialProxies;
+	};
+
+}
@@ -9,12 +9,75 @@
 #include "pathos/scene/point_light_component.h"
 #include "pathos/scene/rect_light_component.h"
 #include "pathos/scene/directional_light_component.h"
+#include "pathos/console.h"
 
 #include "badger/math/hit_test.h"
+#include <algorithm>
+#include <mutex>
 
 namespace pathos {
 
-	static constexpr uint32 RENDER_PROXY_ALLOCATOR_BYTES = 32 * 1024 * 1024; // 32 MiB
+	static ConsoleVariable<int32> cvarRenderProxyAllocatorSize("r.sceneProxy.allocatorSize", 32, "Size of render proxy allocator of each scene proxy in MiB");
+
+	static uint32 getRenderProxyAllocatorBytes() {
+		return (uint32)std::max(1, cvarRenderProxyAllocatorSize.getInt()) * 1024 * 1024;
+	}
+
+	// Recycles memory blocks of render proxy allocators.
+	// A fresh block from malloc() page-faults all over again whenever a new frame touches it.
+	class RenderProxyMemoryPool {
+		static constexpr size_t MAX_FREE_BLOCKS = 4;
+		struct Block {
+			void* memory;
+			uint32 bytes;
+		};
+
+	public:
+		~RenderProxyMemoryPool() {
+			for (Block& block : freeBlocks) {
+				::free(block.memory);
+			}
+		}
+
+		void* acquire(uint32 bytes) {
+			std::lock_guard<std::mutex> lockGuard(poolLock);
+			for (size_t i = 0; i < freeBlocks.size(); ++i) {
+				if (freeBlocks[i].bytes == bytes) {
+					void* memory = freeBlocks[i].memory;
+					freeBlocks[i] = freeBlocks.back();
+					freeBlocks.pop_back();
+					return memory;
+				}
+			}
+			return ::malloc(bytes);
+		}
+
+		void release(void* memory, uint32 bytes) {
+			std::lock_guard<std::mutex> lockGuard(poolLock);
+			if (freeBlocks.size() < MAX_FREE_BLOCKS) {
+				freeBlocks.push_back(Block{ memory, bytes });
+			} else {
+				::free(memory);
+			}
+		}
+
+	private:
+		std::mutex poolLock;
+		std::vector<Block> freeBlocks;
+	};
+	static RenderProxyMemoryPool renderProxyMemoryPool;
+
+	StaticMeshDrawOrderKey StaticMeshDrawOrderKey::make(const MaterialProxy* material, bool renderInternal, bool doubleSided) {
+		StaticMeshDrawOrderKey orderKey;
+		// 1. Program
+		orderKey.program = material->materialShader->programHash;
+		// 2. Material instance -> wireframe -> internal -> doubleSided
+		orderKey.key = (uint64)material->materialInstanceID << 32;
+		orderKey.key |= ((uint64)material->bWireframe) << 31;
+		orderKey.key |= ((uint64)renderInternal) << 30;
+		orderKey.key |= ((uint64)doubleSided) << 29;
+		return orderKey;
+	}
 
 	SceneProxy::SceneProxy(const SceneProxyCreateParams& createParams)
 		: sceneProxySource(createParams.proxySource)
@@ -27,7 +90,8 @@ namespace pathos {
 		, lightProbeDepthCubemap(createParams.lightProbeDepthCubemap)
 		, lightProbeDepthAtlasCoordAndSize(createParams.lightProbeDepthAtlasCoordAndSize)
 		, bSceneRenderSettingsOverriden(false)
-		, renderProxyAllocator(RENDER_PROXY_ALLOCATOR_BYTES)
+		, renderProxyAllocatorBytes(getRenderProxyAllocatorBytes())
+		, renderProxyAllocator(renderProxyMemoryPool.acquire(renderProxyAllocatorBytes), renderProxyAllocatorBytes)
 	{
 	}
 
@@ -47,31 +111,25 @@ namespace pathos {
 		cloud = nullptr;
 
 		renderProxyAllocator.clear();
+		renderProxyMemoryPool.release(renderProxyAllocator.getBaseAddress(), renderProxyAllocator.getTotalBytes());
 	}
 
 	void SceneProxy::finalize_mainThread() {
-		auto sortProxyList = [](StaticMeshProxyList& v) {
-			std::sort(v.begin(), v.end(),
-				[](const StaticMeshProxy* A, const StaticMeshProxy* B) -> bool {
-					// 1. Program
-					const uint32 programA = A->material->materialShader->programHash;
-					const uint32 programB = B->material->materialShader->programHash;
-					if (programA != programB) return programA < programB;
-					// 2. Material instance -> wireframe -> internal -> doubleSided
-					uint64 keyA = (uint64)A->material->materialInstanceID << 32;
-					uint64 keyB = (uint64)B->material->materialInstanceID << 32;
-					keyA |= ((uint64)A->material->bWireframe) << 31;
-					keyA |= ((uint64)A->renderInternal) << 30;
-					keyA |= ((uint64)A->doubleSided) << 29;
-					keyB |= ((uint64)B->material->bWireframe) << 31;
-					keyB |= ((uint64)B->renderInternal) << 30;
-					keyB |= ((uint64)B->doubleSided) << 29;
-					return keyA < keyB;
-				}
-			);
+		auto compareProxies = [](const StaticMeshProxy* A, const StaticMeshProxy* B) -> bool {
+			return StaticMeshDrawOrderKey::make(A->material, A->renderInternal, A->doubleSided)
+				< StaticMeshDrawOrderKey::make(B->material, B->renderInternal, B->doubleSided);
+		};
+		auto sortProxyList = [&compareProxies](StaticMeshProxyList& v, size_t presortedBegin, size_t presortedEnd) {
+			if (presortedBegin < presortedEnd && presortedEnd == v.size()) {
+				auto middle = v.begin() + presortedBegin;
+				std::sort(v.begin(), middle, compareProxies);
+				std::inplace_merge(v.begin(), middle, v.end(), compareProxies);
+			} else {
+				std::sort(v.begin(), v.end(), compareProxies);
+			}
 		};
-		sortProxyList(proxyList_staticMeshOpaque);
-		sortProxyList(proxyList_staticMeshTranslucent);
+		sortProxyList(proxyList_staticMeshOpaque, presortedOpaqueBegin, presortedOpaqueEnd);
+		sortProxyList(proxyList_staticMeshTranslucent, presortedTranslucentBegin, presortedTranslucentEnd);
 	}
 
 	void SceneProxy::overrideSceneRenderSettings(const SceneRenderSettings& inSettings) {
@@ -110,26 +168,62 @@ namespace pathos {
 		int32 totalCount = 0;
 		int32 culledCount = 0;
 		const bool bIgnoreFarPlane = (pathos::getReverseZPolicy() == EReverseZPolicy::Reverse);
+		const uint32 numPlanes = bIgnoreFarPlane ? 5 : 6;
+
+		// Retained static meshes: Reject whole subtrees of their BVH first.
+		const RetainedStaticMeshCulling& retained = retainedStaticMeshCulling;
+		if (retained.numProxies > 0) {
+			const uint32 numBounds = retained.worldBounds.count;
+			uint8* visibility = reinterpret_cast<uint8*>(renderProxyAllocator.alloc(numBounds));
+			CHECKF(visibility != nullptr, "Failed to allocate render proxy!!! Need to increase the allocator size.");
 
-		auto checkProxyList = [&](std::vector<StaticMeshProxy*>& proxies) {
-			for (int32 i = 0; i < proxies.size(); ++i) {
-				if (bIgnoreFarPlane) {
-					proxies[i]->bInFrustum = badger::hitTest::AABB_frustum_noFarPlane(proxies[i]->worldBounds, frustum);
-				} else {
-					proxies[i]->bInFrustum = badger::hitTest::AABB_frustum(proxies[i]->worldBounds, frustum);
+			badger::hitTest::BVH_frustum(
+				retained.bvhNodes, retained.numBVHNodes, retained.worldBounds,
+				frustum, numPlanes, visibility);
+			for (uint32 i = 0; i < numBounds; ++i) {
+				StaticMeshProxy& proxy = retained.proxies[retained.boundsToProxy[i]];
+				proxy.bInFrustum = (visibility[i] != 0);
+				// Not in the proxy lists if addStaticMeshProxy() dropped it.
+				if (proxy.material->materialShader != nullptr) {
+					totalCount += 1;
+					culledCount += proxy.bInFrustum ? 0 : 1;
 				}
+			}
+		}
 
-				if (!proxies[i]->bInFrustum) {
-					culledCount++;
+		// Other proxies: Gather their bounds and test 4 at a time.
+		std::vector<StaticMeshProxy*> proxies;
+		auto gatherProxyList = [&](const std::vector<StaticMeshProxy*>& proxyList) {
+			for (StaticMeshProxy* proxy : proxyList) {
+				bool bRetained = (proxy >= retained.proxies && proxy < retained.proxies + retained.numProxies);
+				if (!bRetained) {
+					proxies.push_back(proxy);
 				}
-				totalCount++;
 			}
 		};
-
-		checkProxyList(proxyList_staticMeshOpaque);
-		checkProxyList(proxyList_staticMeshTranslucent);
+		gatherProxyList(proxyList_staticMeshOpaque);
+		gatherProxyList(proxyList_staticMeshTranslucent);
 		// Already flagged when checking proxyList_staticMeshOpaque.
-		//checkProxyList(proxyList_staticMeshTrivialDepthOnly);
+		//gatherProxyList(proxyList_staticMeshTrivialDepthOnly);
+
+		if (proxies.size() > 0) {
+			const uint32 numProxies = (uint32)proxies.size();
+			badger::AABBStream worldBounds;
+			worldBounds.resize(numProxies);
+			for (uint32 i = 0; i < numProxies; ++i) {
+				worldBounds.set(i, proxies[i]->worldBounds);
+			}
+
+			std::vector<uint8> visibility(numProxies);
+			uint32 numVisible = badger::hitTest::AABBStream_frustum(
+				worldBounds.getView(), 0, numProxies,
+				frustum, numPlanes, visibility.data());
+			for (uint32 i = 0; i < numProxies; ++i) {
+				proxies[i]->bInFrustum = (visibility[i] != 0);
+			}
+			totalCount += (int32)numProxies;
+			culledCount += (int32)(numProxies - numVisible);
+		}
 
 		gEngine->internal_updateBasePassCullStat_renderThread(totalCount, culledCount);
 	}
@@ -159,6 +253,16 @@ namespace pathos {
 		}
 	}
 
+	void SceneProxy::beginPresortedStaticMeshes() {
+		presortedOpaqueBegin = proxyList_staticMeshOpaque.size();
+		presortedTranslucentBegin = proxyList_staticMeshTranslucent.size();
+	}
+
+	void SceneProxy::endPresortedStaticMeshes() {
+		presortedOpaqueEnd = proxyList_staticMeshOpaque.size();
+		presortedTranslucentEnd = proxyList_staticMeshTranslucent.size();
+	}
+
 	void SceneProxy::addShadowMeshProxy(ShadowMeshProxy* proxy) {
 		if (proxy->material->materialShader == nullptr) {
 			return;
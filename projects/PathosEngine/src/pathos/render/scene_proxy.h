@@ -10,6 +10,7 @@
 #include "badger/types/vector_types.h"
 #include "badger/types/matrix_types.h"
 #include "badger/system/mem_alloc.h"
+#include "badger/math/frustum_culling.h"
 #include <vector>
 
 /**
@@ -21,6 +22,7 @@ namespace pathos {
 
 	class Fence;
 	class Buffer;
+	class MaterialProxy;
 	class DirectionalLightComponent;
 
 	using DirectionalLightProxyList = std::vector<struct DirectionalLightProxy*>;
@@ -32,6 +34,31 @@ namespace pathos {
 	using ReflectionProbeProxyList  = std::vector<struct ReflectionProbeProxy*>;
 	using IrradianceVolumeProxyList = std::vector<struct IrradianceVolumeProxy*>;
 
+	// Draw order of static meshes: program -> material instance -> wireframe -> internal -> doubleSided
+	struct StaticMeshDrawOrderKey {
+		uint32 program;
+		uint64 key;
+
+		static StaticMeshDrawOrderKey make(const MaterialProxy* material, bool renderInternal, bool doubleSided);
+
+		inline bool operator<(const StaticMeshDrawOrderKey& other) const {
+			return (program != other.program) ? (program < other.program) : (key < other.key);
+		}
+		inline bool operator!=(const StaticMeshDrawOrderKey& other) const {
+			return program != other.program || key != other.key;
+		}
+	};
+
+	// Frustum culling data of static meshes in RetainedSceneProxy. Lives in the scene proxy's allocator.
+	struct RetainedStaticMeshCulling {
+		struct StaticMeshProxy*    proxies = nullptr;       // Contiguous array of all retained static mesh proxies
+		uint32                     numProxies = 0;
+		const badger::BVHNode*     bvhNodes = nullptr;
+		uint32                     numBVHNodes = 0;
+		badger::AABBStreamView     worldBounds;             // In BVH order
+		const uint32*              boundsToProxy = nullptr; // BVH order -> index in proxies
+	};
+
 	class SceneProxy final {
 		
 	public:
@@ -55,6 +82,11 @@ namespace pathos {
 		void checkFrustumCulling(const Camera& camera);
 
 		void addStaticMeshProxy(struct StaticMeshProxy* proxy);
+		// Static mesh proxies added between these calls are already in draw order,
+		// so finalize_mainThread() only merges them instead of sorting again.
+		// They should be the last static mesh proxies added to this scene proxy.
+		void beginPresortedStaticMeshes();
+		void endPresortedStaticMeshes();
 		const StaticMeshProxyList& getOpaqueStaticMeshes() const { return proxyList_staticMeshOpaque; }
 		const StaticMeshProxyList& getTranslucentStaticMeshes() const { return proxyList_staticMeshTranslucent; }
 		const StaticMeshProxyList& getTrivialDepthOnlyStaticMeshes() const { return proxyList_staticMeshTrivialDepthOnly; }
@@ -95,7 +127,9 @@ namespace pathos {
 		SceneRenderSettings                        sceneRenderSettingsOverride;
 		bool                                       bSceneRenderSettingsOverriden;
 
-		// #todo-renderthread: Needs allocator pool.
+		// Memory blocks are recycled across scene proxies.
+		// Size is read once, as the cvar might change while the scene proxy is constructed.
+		const uint32                               renderProxyAllocatorBytes;
 		StackAllocator                             renderProxyAllocator;
 
 		DirectionalLightProxyList                  proxyList_directionalLight; // first is sun
@@ -115,6 +149,9 @@ namespace pathos {
 		// Subset of proxyList_staticMeshOpaque whose depth-only drawcalls can be merged.
 		StaticMeshProxyList                        proxyList_staticMeshTrivialDepthOnly;
 
+		// Filled by RetainedSceneProxy. Proxies there are also in proxyList_staticMeshOpaque or proxyList_staticMeshTranslucent.
+		RetainedStaticMeshCulling                  retainedStaticMeshCulling;
+
 		// Landscape
 		LandscapeProxyList                         proxyList_landscape;
 		
@@ -148,6 +185,12 @@ namespace pathos {
 	private:
 		DirectionalLightComponent*                 tempSunComponent = nullptr;
 
+		// Range of presorted proxies in proxyList_staticMeshOpaque and proxyList_staticMeshTranslucent.
+		size_t                                     presortedOpaqueBegin = 0;
+		size_t                                     presortedOpaqueEnd = 0;
+		size_t                                     presortedTranslucentBegin = 0;
+		size_t                                     presortedTranslucentEnd = 0;
+
 		Fence*                                     fence;
 		uint64                                     fenceValue;
 	};
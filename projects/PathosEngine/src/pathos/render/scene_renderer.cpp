@@ -208,6 +208,7 @@ namespace pathos {
 		}
 
 		if (cvar_frustum_culling.getInt() != 0) {
+			SCOPED_CPU_COUNTER(FrustumCulling);
 			scene->checkFrustumCulling(*camera);
 		}
 
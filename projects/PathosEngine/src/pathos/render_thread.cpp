@@ -11,6 +11,8 @@
 
 #include "pathos/rhi/render_device.h"
 #include "pathos/rhi/gl_context_manager.h"
+#include "pathos/rhi/render_state_cache.h"
+#include "pathos/rhi/upload_ring_buffer.h"
 #include "pathos/rhi/texture.h"
 
 #include "pathos/render/scene_proxy.h"
@@ -76,6 +78,10 @@ namespace pathos {
 			RenderCommandList& immediateContext = gRenderDevice->getImmediateCommandList();
 			RenderCommandList& earlyContext = gRenderDevice->getEarlyCommandList();
 			RenderCommandList& deferredContext = gRenderDevice->getDeferredCommandList();
+			UploadRingBuffer* uploadRingBuffer = gRenderDevice->getUploadRingBuffer();
+
+			// Reclaim per-frame UBO/SSBO data that the GPU has finished reading.
+			uploadRingBuffer->beginFrame();
 
 			const EngineConfig engineConfig(gEngine->getConfig());
 			const int32 screenWidth = engineConfig.windowWidth;
@@ -151,7 +157,14 @@ namespace pathos {
 						sprintf_s(counterMsg, "SubmitCommands (Count=%u)", immediateContext.getNumCommands());
 						SCOPED_CPU_COUNTER_STRING(counterMsg);
 
+						const uint32 numEliminatedBefore = RenderStateCache::get().getNumEliminatedCommands();
 						immediateContext.flushAllCommands();
+						const uint32 numEliminated = RenderStateCache::get().getNumEliminatedCommands() - numEliminatedBefore;
+
+						// Counters are named on entry, so report redundant state commands as an empty child.
+						char eliminatedMsg[64];
+						sprintf_s(eliminatedMsg, "EliminatedCommands (Count=%u)", numEliminated);
+						SCOPED_CPU_COUNTER_STRING(eliminatedMsg);
 					}
 
 					// Update backbuffer only if main scene was actually rendered
@@ -189,24 +202,22 @@ namespace pathos {
 			if (bNewSceneRendered && overlayProxy != nullptr) {
 				SCOPED_CPU_COUNTER(OverlayProxy);
 
-				if (overlayProxy->appOverlayRootProxy != nullptr) {
+				if (overlayProxy->appOverlay.bRootVisible) {
 					SCOPED_CPU_COUNTER(ExecuteApplicationUI);
 					renderThread->getRenderer2D()->renderOverlay(
 						immediateContext,
-						overlayProxy->appOverlayRootProxy);
+						overlayProxy->appOverlay);
 				}
-				if (overlayProxy->debugOverlayRootProxy != nullptr) {
+				if (overlayProxy->debugOverlay.bRootVisible) {
 					SCOPED_CPU_COUNTER(ExecuteDebugOverlay);
 					renderThread->debugOverlay->renderDebugOverlay(
 						immediateContext,
-						overlayProxy->debugOverlayRootProxy,
-						screenWidth,
-						screenHeight);
+						overlayProxy->debugOverlay);
 					immediateContext.flushAllCommands();
 				}
-				if (gConsole && overlayProxy->consoleWindowRootProxy != nullptr) {
+				if (gConsole && overlayProxy->consoleWindow.bRootVisible) {
 					SCOPED_CPU_COUNTER(ExecuteDebugConsole);
-					gConsole->renderConsoleWindow(immediateContext, overlayProxy->consoleWindowRootProxy);
+					gConsole->renderConsoleWindow(immediateContext, overlayProxy->consoleWindow);
 					immediateContext.flushAllCommands();
 				}
 			}
@@ -235,6 +246,15 @@ namespace pathos {
 			}
 			renderThread->elapsed_gpu = (float)gpu_elapsed_ns / 1000000.0f;
 
+			// Every command that reads the upload ring in this frame was submitted.
+			uploadRingBuffer->endFrame();
+			static bool bWarnedUploadRingFull = false;
+			if (uploadRingBuffer->getNumFallbacksInLastFrame() > 0 && !bWarnedUploadRingFull) {
+				bWarnedUploadRingFull = true;
+				LOG(LogWarning, "[RenderThread] Upload ring was full (%u fallbacks, %llu bytes). Consider increasing r.uploadRingBufferSize",
+					uploadRingBuffer->getNumFallbacksInLastFrame(), uploadRingBuffer->getAllocatedBytesInLastFrame());
+			}
+
 			// Get GPU profile for current frame.
 			GpuCounterResult gpuCounterResult = ScopedGpuCounter::flushQueries(&immediateContext);
 			renderThread->lastGpuCounterResult = std::move(gpuCounterResult);
@@ -98,7 +98,7 @@ namespace pathos {
 			BufferCreateParams createParams{ EBufferUsage::CpuWrite, (uint32)totalBytes, nullptr, debugName };
 			internalBuffer = new Buffer(createParams);
 			internalBuffer->createGPUResource(flushGPU);
-			mallocEmulator.initialize(totalBytes, alignment);
+			allocator.initialize(totalBytes, alignment);
 		}
 	}
 
@@ -106,7 +106,7 @@ namespace pathos {
 		if (internalBuffer != nullptr) {
 			internalBuffer->releaseGPUResource();
 			delete internalBuffer;
-			mallocEmulator.cleanup();
+			allocator.cleanup();
 		}
 	}
 
@@ -120,12 +120,12 @@ namespace pathos {
 
 	uint64 BufferPool::suballocate(uint64 bytes) {
 		std::lock_guard<std::mutex> guard(allocMutex);
-		return mallocEmulator.allocate(bytes);
+		return allocator.allocate(bytes);
 	}
 
 	void BufferPool::deallocate(uint64 offset) {
 		std::lock_guard<std::mutex> guard(allocMutex);
-		mallocEmulator.deallocate(offset);
+		allocator.deallocate(offset);
 	}
 
 	GLuint BufferPool::internal_getGLName() const {
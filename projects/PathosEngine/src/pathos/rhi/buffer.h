@@ -2,7 +2,7 @@
 
 #include "pathos/rhi/gl_handles.h"
 #include "pathos/rhi/render_command_list.h"
-#include "pathos/util/malloc_emulator.h"
+#include "pathos/util/tlsf_allocator.h"
 
 #include "badger/types/noncopyable.h"
 #include "badger/types/enum.h"
@@ -64,7 +64,7 @@ namespace pathos {
 	public:
 		// Let suballocate() return a BufferView?
 		//struct BufferView { uint64 offset, bytes; };
-		static constexpr uint64 INVALID_OFFSET = MallocEmulator::INVALID_OFFSET;
+		static constexpr uint64 INVALID_OFFSET = TLSFAllocator::INVALID_OFFSET;
 
 		~BufferPool();
 
@@ -84,7 +84,7 @@ namespace pathos {
 
 	private:
 		Buffer* internalBuffer = nullptr;
-		MallocEmulator mallocEmulator;
+		TLSFAllocator allocator;
 		std::mutex allocMutex; // #todo-performance: Do I need this?
 
 	};
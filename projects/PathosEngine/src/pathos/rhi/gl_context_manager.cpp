@@ -9,6 +9,7 @@ namespace pathos {
 	HDC OpenGLContextManager_Windows::hdc = NULL;
 	HGLRC OpenGLContextManager_Windows::glContext = NULL;
 	DWORD OpenGLContextManager_Windows::contextOwnerThreadId = 0;
+	bool OpenGLContextManager_Windows::bHeadless = false;
 
 	void OpenGLContextManager_Windows::initialize() {
 		static bool bFirst = true;
@@ -25,9 +26,24 @@ namespace pathos {
 		}
 	}
 
+	void OpenGLContextManager_Windows::initializeHeadless() {
+		static bool bFirst = true;
+		CHECK(bFirst);
+		if (bFirst) {
+			bFirst = false;
+			bHeadless = true;
+			contextOwnerThreadId = GetCurrentThreadId();
+		}
+	}
+
 	void OpenGLContextManager_Windows::takeContext() {
 		CHECKF(contextOwnerThreadId == 0, "GL context is already taken");
 
+		if (bHeadless) {
+			contextOwnerThreadId = GetCurrentThreadId();
+			return;
+		}
+
 		// #todo-fatal: Am I doing this wrong or wglMakeCurrent() actually can fail?
 		// When failed, GetLastError() returns 2004 or 6.
 		BOOL result = wglMakeCurrent(hdc, glContext);
@@ -53,6 +69,11 @@ namespace pathos {
 	void OpenGLContextManager_Windows::returnContext() {
 		CHECK(contextOwnerThreadId == GetCurrentThreadId());
 
+		if (bHeadless) {
+			contextOwnerThreadId = 0;
+			return;
+		}
+
 		// https://learn.microsoft.com/en-us/windows/win32/api/wingdi/nf-wingdi-wglmakecurrent
 		// MSDN says if hglrc is NULL then hdc is ignored, but actually it does not?
 		BOOL result = wglMakeCurrent(/*hdc*/NULL, NULL);
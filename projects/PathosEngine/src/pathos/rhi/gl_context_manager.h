@@ -15,6 +15,9 @@ namespace pathos {
 	public:
 		// Call this right after the GL context is created.
 		static void initialize();
+		// Call this instead of initialize() if there is no window. Only the ownership is tracked.
+		static void initializeHeadless();
+		static bool isHeadless() { return bHeadless; }
 
 		// Call this in a thread that needs the GL context.
 		static void takeContext();
@@ -26,6 +29,7 @@ namespace pathos {
 		static HDC hdc;
 		static HGLRC glContext;
 		static DWORD contextOwnerThreadId;
+		static bool bHeadless;
 
 	};
 #endif
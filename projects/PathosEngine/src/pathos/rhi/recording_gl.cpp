@@ -0,0 +1,740 @@
+#include "recording_gl.h"
+#include "pathos/rhi/gl_handles.h"
+#include "pathos/util/log.h"
+
+#include "badger/assertion/assertion.h"
+
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <string.h>
+
+namespace pathos {
+
+	struct RecordingGLProc {
+		const char* name;
+		void** proc;  // gl3w function pointer
+		void* stub;
+	};
+
+	enum class ERecordingGLCategory : uint8 { Other, Draw, Dispatch, StateChange };
+
+	// GL calls are serialized by the context ownership, so only the frame snapshot needs a lock.
+	struct RecordingGLContext {
+		bool bInstalled = false;
+		std::vector<ERecordingGLCategory> categories;
+
+		// Current frame
+		RecordingGLStats stats;
+		std::vector<uint32> callCounts;
+		std::vector<RecordingGLPassStats> passes;
+		std::map<std::pair<int32, std::string>, uint32> passLookup;
+		std::vector<uint32> passStack;
+		std::vector<RecordingGLStats> passStartStats;
+
+		// Fake objects
+		GLuint nextObjectName = 1;
+		uintptr_t nextSync = 1;
+		std::unordered_map<GLuint, GLsizeiptr> bufferSizes;
+		std::unordered_map<GLuint, std::vector<uint8>> mappedBuffers;
+		std::unordered_map<GLenum, GLuint> boundBuffers;
+
+		// Last presented frame
+		std::mutex frameMutex;
+		RecordingGLFrame lastFrame;
+	};
+	static RecordingGLContext recording;
+
+	static void recordGLCall(uint32 functionIndex) {
+		recording.stats.numCalls += 1;
+		recording.callCounts[functionIndex] += 1;
+		switch (recording.categories[functionIndex]) {
+			case ERecordingGLCategory::Draw:        recording.stats.numDrawCalls += 1; break;
+			case ERecordingGLCategory::Dispatch:    recording.stats.numDispatchCalls += 1; break;
+			case ERecordingGLCategory::StateChange: recording.stats.numStateChanges += 1; break;
+			default: break;
+		}
+	}
+
+	// Defines recording_glXXX() and RECORDING_GL_PROCS. Generated by tools/parse_glcorearb.rs
+	#include "recording_gl.generated.h"
+
+	static ERecordingGLCategory classifyGLFunction(const char* name) {
+		auto startsWith = [name](const char* prefix) { return 0 == strncmp(name, prefix, strlen(prefix)); };
+		if (startsWith("glDraw") || startsWith("glMultiDraw")) {
+			return ERecordingGLCategory::Draw;
+		}
+		if (startsWith("glDispatchCompute")) {
+			return ERecordingGLCategory::Dispatch;
+		}
+		// Vertex attribute setup and shader variable locations are not render states.
+		if (strstr(name, "Attrib") != nullptr || strstr(name, "Location") != nullptr) {
+			return ERecordingGLCategory::Other;
+		}
+		const char* statePrefixes[] = {
+			"glEnable", "glDisable", "glBind", "glUseProgram",
+			"glBlend", "glColorMask", "glDepthFunc", "glDepthMask", "glDepthRange",
+			"glStencilFunc", "glStencilOp", "glStencilMask",
+			"glCullFace", "glFrontFace", "glPolygonMode", "glPolygonOffset", "glClipControl",
+			"glViewport", "glScissor", "glLineWidth", "glPointSize", "glPatchParameter",
+		};
+		for (const char* prefix : statePrefixes) {
+			if (startsWith(prefix)) {
+				return ERecordingGLCategory::StateChange;
+			}
+		}
+		return ERecordingGLCategory::Other;
+	}
+
+	static void generateObjectNames(GLsizei n, GLuint* names) {
+		for (GLsizei i = 0; i < n; ++i) {
+			names[i] = recording.nextObjectName++;
+		}
+		recording.stats.numObjectsCreated += n;
+	}
+
+	static void countDeletedObjects(GLsizei n, const GLuint* names) {
+		for (GLsizei i = 0; i < n; ++i) {
+			// Zero is silently ignored by GL.
+			recording.stats.numObjectsDeleted += (names[i] != 0) ? 1 : 0;
+		}
+	}
+
+	static void countUploadedPixels(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) {
+		// #todo-headless: Offsets into GL_PIXEL_UNPACK_BUFFER are not counted if the offset is zero.
+		if (pixels == nullptr) {
+			return;
+		}
+		uint64 bytesPerPixel = 0;
+		switch (type) {
+			case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1:
+				bytesPerPixel = 2; break;
+			case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+			case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+				bytesPerPixel = 4; break;
+			case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+				bytesPerPixel = 8; break;
+			default:
+			{
+				uint64 numComponents = 4;
+				switch (format) {
+					case GL_RED: case GL_RED_INTEGER: case GL_GREEN: case GL_BLUE: case GL_ALPHA:
+					case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+						numComponents = 1; break;
+					case GL_RG: case GL_RG_INTEGER:
+						numComponents = 2; break;
+					case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+						numComponents = 3; break;
+					default:
+						break;
+				}
+				uint64 componentSize = 1;
+				switch (type) {
+					case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT:
+						componentSize = 2; break;
+					case GL_INT: case GL_UNSIGNED_INT: case GL_FLOAT:
+						componentSize = 4; break;
+					default:
+						break;
+				}
+				bytesPerPixel = numComponents * componentSize;
+			}
+		}
+		recording.stats.bytesUploaded += bytesPerPixel * (uint64)width * (uint64)height * (uint64)depth;
+	}
+
+	static void countUploadedBytes(GLsizeiptr size, const void* data) {
+		if (data != nullptr && size > 0) {
+			recording.stats.bytesUploaded += (uint64)size;
+		}
+	}
+
+	static void* mapBufferStorage(GLuint buffer, GLintptr offset, GLsizeiptr length, bool bWrite) {
+		auto it = recording.bufferSizes.find(buffer);
+		if (it == recording.bufferSizes.end() || offset < 0 || length <= 0 || offset + length > it->second) {
+			return nullptr;
+		}
+		std::vector<uint8>& storage = recording.mappedBuffers[buffer];
+		if ((GLsizeiptr)storage.size() != it->second) {
+			storage.resize(it->second);
+		}
+		if (bWrite) {
+			recording.stats.bytesUploaded += (uint64)length;
+		}
+		return storage.data() + offset;
+	}
+
+	static GLsizeiptr getBufferSize(GLuint buffer) {
+		auto it = recording.bufferSizes.find(buffer);
+		return it != recording.bufferSizes.end() ? it->second : 0;
+	}
+
+	// ------------------------------------------------------------------------------
+	// Object creation and deletion
+
+#define RECORDING_GEN_OBJECTS(Fn)                                                     \
+	static void APIENTRY override_gl##Fn(GLsizei n, GLuint* names) {                  \
+		recording_gl##Fn(n, names);                                                   \
+		generateObjectNames(n, names);                                                \
+	}
+#define RECORDING_CREATE_OBJECTS_WITH_TARGET(Fn)                                      \
+	static void APIENTRY override_gl##Fn(GLenum target, GLsizei n, GLuint* names) {   \
+		recording_gl##Fn(target, n, names);                                           \
+		generateObjectNames(n, names);                                                \
+	}
+#define RECORDING_DELETE_OBJECTS(Fn)                                                  \
+	static void APIENTRY override_gl##Fn(GLsizei n, const GLuint* names) {            \
+		recording_gl##Fn(n, names);                                                   \
+		countDeletedObjects(n, names);                                                \
+	}
+
+	RECORDING_GEN_OBJECTS(GenTextures)
+	RECORDING_GEN_OBJECTS(GenQueries)
+	RECORDING_GEN_OBJECTS(GenBuffers)
+	RECORDING_GEN_OBJECTS(GenRenderbuffers)
+	RECORDING_GEN_OBJECTS(GenFramebuffers)
+	RECORDING_GEN_OBJECTS(GenVertexArrays)
+	RECORDING_GEN_OBJECTS(GenSamplers)
+	RECORDING_GEN_OBJECTS(GenTransformFeedbacks)
+	RECORDING_GEN_OBJECTS(GenProgramPipelines)
+	RECORDING_GEN_OBJECTS(CreateBuffers)
+	RECORDING_GEN_OBJECTS(CreateFramebuffers)
+	RECORDING_GEN_OBJECTS(CreateRenderbuffers)
+	RECORDING_GEN_OBJECTS(CreateVertexArrays)
+	RECORDING_GEN_OBJECTS(CreateSamplers)
+	RECORDING_GEN_OBJECTS(CreateTransformFeedbacks)
+	RECORDING_GEN_OBJECTS(CreateProgramPipelines)
+	RECORDING_CREATE_OBJECTS_WITH_TARGET(CreateTextures)
+	RECORDING_CREATE_OBJECTS_WITH_TARGET(CreateQueries)
+	RECORDING_DELETE_OBJECTS(DeleteTextures)
+	RECORDING_DELETE_OBJECTS(DeleteQueries)
+	RECORDING_DELETE_OBJECTS(DeleteRenderbuffers)
+	RECORDING_DELETE_OBJECTS(DeleteFramebuffers)
+	RECORDING_DELETE_OBJECTS(DeleteVertexArrays)
+	RECORDING_DELETE_OBJECTS(DeleteSamplers)
+	RECORDING_DELETE_OBJECTS(DeleteTransformFeedbacks)
+	RECORDING_DELETE_OBJECTS(DeleteProgramPipelines)
+
+#undef RECORDING_GEN_OBJECTS
+#undef RECORDING_CREATE_OBJECTS_WITH_TARGET
+#undef RECORDING_DELETE_OBJECTS
+
+	static void APIENTRY override_glDeleteBuffers(GLsizei n, const GLuint* buffers) {
+		recording_glDeleteBuffers(n, buffers);
+		countDeletedObjects(n, buffers);
+		for (GLsizei i = 0; i < n; ++i) {
+			recording.bufferSizes.erase(buffers[i]);
+			recording.mappedBuffers.erase(buffers[i]);
+		}
+	}
+	static GLuint APIENTRY override_glCreateShader(GLenum type) {
+		recording_glCreateShader(type);
+		recording.stats.numObjectsCreated += 1;
+		return recording.nextObjectName++;
+	}
+	static GLuint APIENTRY override_glCreateProgram(void) {
+		recording_glCreateProgram();
+		recording.stats.numObjectsCreated += 1;
+		return recording.nextObjectName++;
+	}
+	static GLuint APIENTRY override_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const* strings) {
+		recording_glCreateShaderProgramv(type, count, strings);
+		recording.stats.numObjectsCreated += 1;
+		return recording.nextObjectName++;
+	}
+	static void APIENTRY override_glDeleteShader(GLuint shader) {
+		recording_glDeleteShader(shader);
+		countDeletedObjects(1, &shader);
+	}
+	static void APIENTRY override_glDeleteProgram(GLuint program) {
+		recording_glDeleteProgram(program);
+		countDeletedObjects(1, &program);
+	}
+	static GLsync APIENTRY override_glFenceSync(GLenum condition, GLbitfield flags) {
+		recording_glFenceSync(condition, flags);
+		recording.stats.numObjectsCreated += 1;
+		return reinterpret_cast<GLsync>(recording.nextSync++);
+	}
+	static void APIENTRY override_glDeleteSync(GLsync sync) {
+		recording_glDeleteSync(sync);
+		recording.stats.numObjectsDeleted += (sync != nullptr) ? 1 : 0;
+	}
+
+	// ------------------------------------------------------------------------------
+	// Uploads
+
+	static void APIENTRY override_glBindBuffer(GLenum target, GLuint buffer) {
+		recording_glBindBuffer(target, buffer);
+		recording.boundBuffers[target] = buffer;
+	}
+	static void APIENTRY override_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+		recording_glBufferData(target, size, data, usage);
+		recording.bufferSizes[recording.boundBuffers[target]] = size;
+		countUploadedBytes(size, data);
+	}
+	static void APIENTRY override_glBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+		recording_glBufferStorage(target, size, data, flags);
+		recording.bufferSizes[recording.boundBuffers[target]] = size;
+		countUploadedBytes(size, data);
+	}
+	static void APIENTRY override_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+		recording_glBufferSubData(target, offset, size, data);
+		countUploadedBytes(size, data);
+	}
+	static void APIENTRY override_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage) {
+		recording_glNamedBufferData(buffer, size, data, usage);
+		recording.bufferSizes[buffer] = size;
+		countUploadedBytes(size, data);
+	}
+	static void APIENTRY override_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags) {
+		recording_glNamedBufferStorage(buffer, size, data, flags);
+		recording.bufferSizes[buffer] = size;
+		countUploadedBytes(size, data);
+	}
+	static void APIENTRY override_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+		recording_glNamedBufferSubData(buffer, offset, size, data);
+		countUploadedBytes(size, data);
+	}
+
+	static void* APIENTRY override_glMapBuffer(GLenum target, GLenum access) {
+		recording_glMapBuffer(target, access);
+		const GLuint buffer = recording.boundBuffers[target];
+		return mapBufferStorage(buffer, 0, getBufferSize(buffer), access != GL_READ_ONLY);
+	}
+	static void* APIENTRY override_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+		recording_glMapBufferRange(target, offset, length, access);
+		return mapBufferStorage(recording.boundBuffers[target], offset, length, (access & GL_MAP_WRITE_BIT) != 0);
+	}
+	static void* APIENTRY override_glMapNamedBuffer(GLuint buffer, GLenum access) {
+		recording_glMapNamedBuffer(buffer, access);
+		return mapBufferStorage(buffer, 0, getBufferSize(buffer), access != GL_READ_ONLY);
+	}
+	static void* APIENTRY override_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+		recording_glMapNamedBufferRange(buffer, offset, length, access);
+		return mapBufferStorage(buffer, offset, length, (access & GL_MAP_WRITE_BIT) != 0);
+	}
+	static GLboolean APIENTRY override_glUnmapBuffer(GLenum target) {
+		recording_glUnmapBuffer(target);
+		return GL_TRUE;
+	}
+	static GLboolean APIENTRY override_glUnmapNamedBuffer(GLuint buffer) {
+		recording_glUnmapNamedBuffer(buffer);
+		return GL_TRUE;
+	}
+
+	static void APIENTRY override_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+		countUploadedPixels(width, 1, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		countUploadedPixels(width, height, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+		countUploadedPixels(width, height, depth, format, type, pixels);
+	}
+	static void APIENTRY override_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+		countUploadedPixels(width, 1, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		countUploadedPixels(width, height, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) {
+		recording_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		countUploadedPixels(width, height, depth, format, type, pixels);
+	}
+	static void APIENTRY override_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels) {
+		recording_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+		countUploadedPixels(width, 1, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels) {
+		recording_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+		countUploadedPixels(width, height, 1, format, type, pixels);
+	}
+	static void APIENTRY override_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) {
+		recording_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		countUploadedPixels(width, height, depth, format, type, pixels);
+	}
+	static void APIENTRY override_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+	static void APIENTRY override_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data) {
+		recording_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		countUploadedBytes(imageSize, data);
+	}
+
+	// ------------------------------------------------------------------------------
+	// Queries
+
+	// Number of values that glGet*v() writes for the pname.
+	static uint32 getNumGLStateValues(GLenum pname) {
+		switch (pname) {
+			case GL_VIEWPORT:
+			case GL_SCISSOR_BOX:
+			case GL_COLOR_CLEAR_VALUE:
+			case GL_COLOR_WRITEMASK:
+			case GL_BLEND_COLOR:
+				return 4;
+			case GL_MAX_VIEWPORT_DIMS:
+			case GL_DEPTH_RANGE:
+			case GL_VIEWPORT_BOUNDS_RANGE:
+			case GL_ALIASED_LINE_WIDTH_RANGE:
+			case GL_SMOOTH_LINE_WIDTH_RANGE:
+			case GL_POINT_SIZE_RANGE:
+			case GL_POLYGON_MODE:
+				return 2;
+			default:
+				return 1;
+		}
+	}
+	static void APIENTRY override_glGetIntegerv(GLenum pname, GLint* data) {
+		recording_glGetIntegerv(pname, data);
+		const uint32 numValues = getNumGLStateValues(pname);
+		for (uint32 i = 0; i < numValues; ++i) {
+			data[i] = 0;
+		}
+		switch (pname) {
+			case GL_MAX_LABEL_LENGTH:                       *data = 256; break;
+			case GL_MAX_UNIFORM_BLOCK_SIZE:                 *data = 65536; break;
+			case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS:     *data = 1024; break;
+			case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE:         *data = 49152; break;
+			case GL_MAX_TEXTURE_SIZE:                       *data = 32768; break;
+			case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:       *data = 192; break;
+			case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:        *data = 256; break;
+			case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT: *data = 16; break;
+			case GL_MAX_VIEWPORT_DIMS:                      data[0] = data[1] = 32768; break;
+			default:                                        break;
+		}
+	}
+	static void APIENTRY override_glGetIntegeri_v(GLenum target, GLuint index, GLint* data) {
+		recording_glGetIntegeri_v(target, index, data);
+		switch (target) {
+			case GL_MAX_COMPUTE_WORK_GROUP_COUNT:         *data = 65535; break;
+			case GL_MAX_COMPUTE_WORK_GROUP_SIZE:          *data = (index == 2) ? 64 : 1024; break;
+			default:                                      *data = 0; break;
+		}
+	}
+	static const GLubyte* APIENTRY override_glGetString(GLenum name) {
+		recording_glGetString(name);
+		switch (name) {
+			case GL_VENDOR:                   return (const GLubyte*)"pathos";
+			case GL_RENDERER:                 return (const GLubyte*)"Recording GL (headless)";
+			case GL_VERSION:                  return (const GLubyte*)"4.6.0 Recording GL";
+			case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte*)"4.60 Recording GL";
+			default:                          return (const GLubyte*)"";
+		}
+	}
+	static const GLubyte* APIENTRY override_glGetStringi(GLenum name, GLuint index) {
+		recording_glGetStringi(name, index);
+		return (const GLubyte*)""; // No extension as GL_NUM_EXTENSIONS is zero.
+	}
+	static void APIENTRY override_glGetShaderiv(GLuint shader, GLenum pname, GLint* params) {
+		recording_glGetShaderiv(shader, pname, params);
+		*params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+	}
+	static void APIENTRY override_glGetProgramiv(GLuint program, GLenum pname, GLint* params) {
+		recording_glGetProgramiv(program, pname, params);
+		*params = (pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) ? GL_TRUE : 0;
+	}
+	static void APIENTRY override_glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params) {
+		recording_glGetQueryObjectiv(id, pname, params);
+		*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+	}
+	static void APIENTRY override_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params) {
+		recording_glGetQueryObjectuiv(id, pname, params);
+		*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+	}
+	static void APIENTRY override_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64* params) {
+		recording_glGetQueryObjecti64v(id, pname, params);
+		*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+	}
+	static void APIENTRY override_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params) {
+		recording_glGetQueryObjectui64v(id, pname, params);
+		*params = (pname == GL_QUERY_RESULT_AVAILABLE) ? GL_TRUE : 0;
+	}
+	static GLenum APIENTRY override_glCheckFramebufferStatus(GLenum target) {
+		recording_glCheckFramebufferStatus(target);
+		return GL_FRAMEBUFFER_COMPLETE;
+	}
+	static GLenum APIENTRY override_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+		recording_glCheckNamedFramebufferStatus(framebuffer, target);
+		return GL_FRAMEBUFFER_COMPLETE;
+	}
+	static GLboolean APIENTRY override_glIsTexture(GLuint texture) {
+		recording_glIsTexture(texture);
+		return (texture != 0) ? GL_TRUE : GL_FALSE;
+	}
+	static void APIENTRY override_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint* params) {
+		recording_glGetTextureLevelParameteriv(texture, level, pname, params);
+		*params = 0;
+	}
+	static void APIENTRY override_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint* params) {
+		recording_glGetTextureParameteriv(texture, pname, params);
+		*params = 0;
+	}
+	static void APIENTRY override_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64* params) {
+		recording_glGetNamedBufferParameteri64v(buffer, pname, params);
+		*params = (pname == GL_BUFFER_SIZE) ? (GLint64)getBufferSize(buffer) : 0;
+	}
+	static GLenum APIENTRY override_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+		recording_glClientWaitSync(sync, flags, timeout);
+		return GL_ALREADY_SIGNALED;
+	}
+	static void APIENTRY override_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values) {
+		recording_glGetSynciv(sync, pname, bufSize, length, values);
+		if (bufSize > 0) {
+			values[0] = (pname == GL_SYNC_STATUS) ? GL_SIGNALED : 0;
+		}
+		if (length != nullptr) {
+			*length = 1;
+		}
+	}
+
+	// ------------------------------------------------------------------------------
+	// Debug groups
+
+	static void APIENTRY override_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar* message) {
+		recording_glPushDebugGroup(source, id, length, message);
+
+		const int32 parent = recording.passStack.size() > 0 ? (int32)recording.passStack.back() : -1;
+		std::string name = (length < 0) ? std::string(message) : std::string(message, length);
+		auto key = std::make_pair(parent, std::move(name));
+		auto it = recording.passLookup.find(key);
+		uint32 passIndex;
+		if (it == recording.passLookup.end()) {
+			passIndex = (uint32)recording.passes.size();
+			RecordingGLPassStats pass;
+			pass.name = key.second;
+			pass.parent = parent;
+			pass.depth = (uint32)recording.passStack.size();
+			pass.numInvocations = 0;
+			recording.passes.emplace_back(std::move(pass));
+			recording.passLookup.insert(std::make_pair(std::move(key), passIndex));
+		} else {
+			passIndex = it->second;
+		}
+		recording.passes[passIndex].numInvocations += 1;
+		recording.passStack.push_back(passIndex);
+		recording.passStartStats.push_back(recording.stats);
+	}
+	static void APIENTRY override_glPopDebugGroup(void) {
+		recording_glPopDebugGroup();
+
+		if (recording.passStack.size() == 0) {
+			return;
+		}
+		RecordingGLStats delta = recording.stats;
+		delta.subtract(recording.passStartStats.back());
+		recording.passes[recording.passStack.back()].stats.add(delta);
+		recording.passStack.pop_back();
+		recording.passStartStats.pop_back();
+	}
+
+#define RECORDING_GL_OVERRIDE(Fn) { "gl" #Fn, (void**)&gl3w##Fn, (void*)override_gl##Fn }
+	static const RecordingGLProc RECORDING_GL_OVERRIDES[] = {
+		RECORDING_GL_OVERRIDE(GenTextures),
+		RECORDING_GL_OVERRIDE(GenQueries),
+		RECORDING_GL_OVERRIDE(GenBuffers),
+		RECORDING_GL_OVERRIDE(GenRenderbuffers),
+		RECORDING_GL_OVERRIDE(GenFramebuffers),
+		RECORDING_GL_OVERRIDE(GenVertexArrays),
+		RECORDING_GL_OVERRIDE(GenSamplers),
+		RECORDING_GL_OVERRIDE(GenTransformFeedbacks),
+		RECORDING_GL_OVERRIDE(GenProgramPipelines),
+		RECORDING_GL_OVERRIDE(CreateBuffers),
+		RECORDING_GL_OVERRIDE(CreateFramebuffers),
+		RECORDING_GL_OVERRIDE(CreateRenderbuffers),
+		RECORDING_GL_OVERRIDE(CreateVertexArrays),
+		RECORDING_GL_OVERRIDE(CreateSamplers),
+		RECORDING_GL_OVERRIDE(CreateTransformFeedbacks),
+		RECORDING_GL_OVERRIDE(CreateProgramPipelines),
+		RECORDING_GL_OVERRIDE(CreateTextures),
+		RECORDING_GL_OVERRIDE(CreateQueries),
+		RECORDING_GL_OVERRIDE(CreateShader),
+		RECORDING_GL_OVERRIDE(CreateProgram),
+		RECORDING_GL_OVERRIDE(CreateShaderProgramv),
+		RECORDING_GL_OVERRIDE(FenceSync),
+		RECORDING_GL_OVERRIDE(DeleteTextures),
+		RECORDING_GL_OVERRIDE(DeleteQueries),
+		RECORDING_GL_OVERRIDE(DeleteBuffers),
+		RECORDING_GL_OVERRIDE(DeleteRenderbuffers),
+		RECORDING_GL_OVERRIDE(DeleteFramebuffers),
+		RECORDING_GL_OVERRIDE(DeleteVertexArrays),
+		RECORDING_GL_OVERRIDE(DeleteSamplers),
+		RECORDING_GL_OVERRIDE(DeleteTransformFeedbacks),
+		RECORDING_GL_OVERRIDE(DeleteProgramPipelines),
+		RECORDING_GL_OVERRIDE(DeleteShader),
+		RECORDING_GL_OVERRIDE(DeleteProgram),
+		RECORDING_GL_OVERRIDE(DeleteSync),
+		RECORDING_GL_OVERRIDE(BindBuffer),
+		RECORDING_GL_OVERRIDE(BufferData),
+		RECORDING_GL_OVERRIDE(BufferStorage),
+		RECORDING_GL_OVERRIDE(BufferSubData),
+		RECORDING_GL_OVERRIDE(NamedBufferData),
+		RECORDING_GL_OVERRIDE(NamedBufferStorage),
+		RECORDING_GL_OVERRIDE(NamedBufferSubData),
+		RECORDING_GL_OVERRIDE(MapBuffer),
+		RECORDING_GL_OVERRIDE(MapBufferRange),
+		RECORDING_GL_OVERRIDE(MapNamedBuffer),
+		RECORDING_GL_OVERRIDE(MapNamedBufferRange),
+		RECORDING_GL_OVERRIDE(UnmapBuffer),
+		RECORDING_GL_OVERRIDE(UnmapNamedBuffer),
+		RECORDING_GL_OVERRIDE(TexImage1D),
+		RECORDING_GL_OVERRIDE(TexImage2D),
+		RECORDING_GL_OVERRIDE(TexImage3D),
+		RECORDING_GL_OVERRIDE(TexSubImage1D),
+		RECORDING_GL_OVERRIDE(TexSubImage2D),
+		RECORDING_GL_OVERRIDE(TexSubImage3D),
+		RECORDING_GL_OVERRIDE(TextureSubImage1D),
+		RECORDING_GL_OVERRIDE(TextureSubImage2D),
+		RECORDING_GL_OVERRIDE(TextureSubImage3D),
+		RECORDING_GL_OVERRIDE(CompressedTexImage1D),
+		RECORDING_GL_OVERRIDE(CompressedTexImage2D),
+		RECORDING_GL_OVERRIDE(CompressedTexImage3D),
+		RECORDING_GL_OVERRIDE(CompressedTexSubImage1D),
+		RECORDING_GL_OVERRIDE(CompressedTexSubImage2D),
+		RECORDING_GL_OVERRIDE(CompressedTexSubImage3D),
+		RECORDING_GL_OVERRIDE(CompressedTextureSubImage1D),
+		RECORDING_GL_OVERRIDE(CompressedTextureSubImage2D),
+		RECORDING_GL_OVERRIDE(CompressedTextureSubImage3D),
+		RECORDING_GL_OVERRIDE(GetIntegerv),
+		RECORDING_GL_OVERRIDE(GetIntegeri_v),
+		RECORDING_GL_OVERRIDE(GetString),
+		RECORDING_GL_OVERRIDE(GetStringi),
+		RECORDING_GL_OVERRIDE(GetShaderiv),
+		RECORDING_GL_OVERRIDE(GetProgramiv),
+		RECORDING_GL_OVERRIDE(GetQueryObjectiv),
+		RECORDING_GL_OVERRIDE(GetQueryObjectuiv),
+		RECORDING_GL_OVERRIDE(GetQueryObjecti64v),
+		RECORDING_GL_OVERRIDE(GetQueryObjectui64v),
+		RECORDING_GL_OVERRIDE(CheckFramebufferStatus),
+		RECORDING_GL_OVERRIDE(CheckNamedFramebufferStatus),
+		RECORDING_GL_OVERRIDE(IsTexture),
+		RECORDING_GL_OVERRIDE(GetTextureLevelParameteriv),
+		RECORDING_GL_OVERRIDE(GetTextureParameteriv),
+		RECORDING_GL_OVERRIDE(GetNamedBufferParameteri64v),
+		RECORDING_GL_OVERRIDE(ClientWaitSync),
+		RECORDING_GL_OVERRIDE(GetSynciv),
+		RECORDING_GL_OVERRIDE(PushDebugGroup),
+		RECORDING_GL_OVERRIDE(PopDebugGroup),
+	};
+#undef RECORDING_GL_OVERRIDE
+
+	constexpr uint32 NUM_RECORDING_GL_PROCS = (uint32)(sizeof(RECORDING_GL_PROCS) / sizeof(RECORDING_GL_PROCS[0]));
+
+	void RecordingGLStats::add(const RecordingGLStats& other) {
+		numCalls          += other.numCalls;
+		numDrawCalls      += other.numDrawCalls;
+		numDispatchCalls  += other.numDispatchCalls;
+		numStateChanges   += other.numStateChanges;
+		numObjectsCreated += other.numObjectsCreated;
+		numObjectsDeleted += other.numObjectsDeleted;
+		bytesUploaded     += other.bytesUploaded;
+	}
+
+	void RecordingGLStats::subtract(const RecordingGLStats& other) {
+		numCalls          -= other.numCalls;
+		numDrawCalls      -= other.numDrawCalls;
+		numDispatchCalls  -= other.numDispatchCalls;
+		numStateChanges   -= other.numStateChanges;
+		numObjectsCreated -= other.numObjectsCreated;
+		numObjectsDeleted -= other.numObjectsDeleted;
+		bytesUploaded     -= other.bytesUploaded;
+	}
+
+	void installRecordingGL() {
+		if (recording.bInstalled) {
+			return;
+		}
+		recording.bInstalled = true;
+
+		recording.categories.resize(NUM_RECORDING_GL_PROCS);
+		recording.callCounts.resize(NUM_RECORDING_GL_PROCS, 0);
+		for (uint32 i = 0; i < NUM_RECORDING_GL_PROCS; ++i) {
+			*(RECORDING_GL_PROCS[i].proc) = RECORDING_GL_PROCS[i].stub;
+			recording.categories[i] = classifyGLFunction(RECORDING_GL_PROCS[i].name);
+		}
+		for (const RecordingGLProc& proc : RECORDING_GL_OVERRIDES) {
+			*(proc.proc) = proc.stub;
+		}
+
+		LOG(LogInfo, "[RenderDevice] Recording GL is installed (%u functions, %u overrides)",
+			NUM_RECORDING_GL_PROCS, (uint32)(sizeof(RECORDING_GL_OVERRIDES) / sizeof(RECORDING_GL_OVERRIDES[0])));
+	}
+
+	bool isRecordingGLInstalled() {
+		return recording.bInstalled;
+	}
+
+	void presentRecordingGLFrame() {
+		CHECK(recording.bInstalled);
+
+		if (recording.passStack.size() > 0) {
+			LOG(LogWarning, "[RenderDevice] %u debug groups are not popped before present", (uint32)recording.passStack.size());
+			recording.passStack.clear();
+			recording.passStartStats.clear();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(recording.frameMutex);
+			RecordingGLFrame& frame = recording.lastFrame;
+			frame.frameCount += 1;
+			frame.stats = recording.stats;
+			frame.totalStats.add(recording.stats);
+			frame.passes.swap(recording.passes);
+			frame.callCounts.swap(recording.callCounts);
+		}
+
+		recording.stats = RecordingGLStats();
+		recording.passes.clear();
+		recording.passLookup.clear();
+		recording.callCounts.assign(NUM_RECORDING_GL_PROCS, 0);
+	}
+
+	void getLastRecordingGLFrame(RecordingGLFrame& outFrame) {
+		std::lock_guard<std::mutex> lock(recording.frameMutex);
+		outFrame = recording.lastFrame;
+	}
+
+	uint32 getNumRecordingGLFunctions() {
+		return NUM_RECORDING_GL_PROCS;
+	}
+
+	const char* getRecordingGLFunctionName(uint32 functionIndex) {
+		CHECK(functionIndex < NUM_RECORDING_GL_PROCS);
+		return RECORDING_GL_PROCS[functionIndex].name;
+	}
+
+}
@@ -0,0 +1,2531 @@
+static void APIENTRY recording_glCullFace(GLenum mode) { recordGLCall(0); }
+static void APIENTRY recording_glFrontFace(GLenum mode) { recordGLCall(1); }
+static void APIENTRY recording_glHint(GLenum target, GLenum mode) { recordGLCall(2); }
+static void APIENTRY recording_glLineWidth(GLfloat width) { recordGLCall(3); }
+static void APIENTRY recording_glPointSize(GLfloat size) { recordGLCall(4); }
+static void APIENTRY recording_glPolygonMode(GLenum face, GLenum mode) { recordGLCall(5); }
+static void APIENTRY recording_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(6); }
+static void APIENTRY recording_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { recordGLCall(7); }
+static void APIENTRY recording_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { recordGLCall(8); }
+static void APIENTRY recording_glTexParameteri(GLenum target, GLenum pname, GLint param) { recordGLCall(9); }
+static void APIENTRY recording_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { recordGLCall(10); }
+static void APIENTRY recording_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(11); }
+static void APIENTRY recording_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(12); }
+static void APIENTRY recording_glDrawBuffer(GLenum buf) { recordGLCall(13); }
+static void APIENTRY recording_glClear(GLbitfield mask) { recordGLCall(14); }
+static void APIENTRY recording_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { recordGLCall(15); }
+static void APIENTRY recording_glClearStencil(GLint s) { recordGLCall(16); }
+static void APIENTRY recording_glClearDepth(GLdouble depth) { recordGLCall(17); }
+static void APIENTRY recording_glStencilMask(GLuint mask) { recordGLCall(18); }
+static void APIENTRY recording_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { recordGLCall(19); }
+static void APIENTRY recording_glDepthMask(GLboolean flag) { recordGLCall(20); }
+static void APIENTRY recording_glDisable(GLenum cap) { recordGLCall(21); }
+static void APIENTRY recording_glEnable(GLenum cap) { recordGLCall(22); }
+static void APIENTRY recording_glFinish(void) { recordGLCall(23); }
+static void APIENTRY recording_glFlush(void) { recordGLCall(24); }
+static void APIENTRY recording_glBlendFunc(GLenum sfactor, GLenum dfactor) { recordGLCall(25); }
+static void APIENTRY recording_glLogicOp(GLenum opcode) { recordGLCall(26); }
+static void APIENTRY recording_glStencilFunc(GLenum func, GLint ref, GLuint mask) { recordGLCall(27); }
+static void APIENTRY recording_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { recordGLCall(28); }
+static void APIENTRY recording_glDepthFunc(GLenum func) { recordGLCall(29); }
+static void APIENTRY recording_glPixelStoref(GLenum pname, GLfloat param) { recordGLCall(30); }
+static void APIENTRY recording_glPixelStorei(GLenum pname, GLint param) { recordGLCall(31); }
+static void APIENTRY recording_glReadBuffer(GLenum src) { recordGLCall(32); }
+static void APIENTRY recording_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { recordGLCall(33); }
+static void APIENTRY recording_glGetBooleanv(GLenum pname, GLboolean *data) { recordGLCall(34); }
+static void APIENTRY recording_glGetDoublev(GLenum pname, GLdouble *data) { recordGLCall(35); }
+static GLenum APIENTRY recording_glGetError(void) { recordGLCall(36); return {}; }
+static void APIENTRY recording_glGetFloatv(GLenum pname, GLfloat *data) { recordGLCall(37); }
+static void APIENTRY recording_glGetIntegerv(GLenum pname, GLint *data) { recordGLCall(38); }
+static const GLubyte * APIENTRY recording_glGetString(GLenum name) { recordGLCall(39); return {}; }
+static void APIENTRY recording_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { recordGLCall(40); }
+static void APIENTRY recording_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { recordGLCall(41); }
+static void APIENTRY recording_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { recordGLCall(42); }
+static void APIENTRY recording_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { recordGLCall(43); }
+static void APIENTRY recording_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { recordGLCall(44); }
+static GLboolean APIENTRY recording_glIsEnabled(GLenum cap) { recordGLCall(45); return {}; }
+static void APIENTRY recording_glDepthRange(GLdouble n, GLdouble f) { recordGLCall(46); }
+static void APIENTRY recording_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(47); }
+static void APIENTRY recording_glDrawArrays(GLenum mode, GLint first, GLsizei count) { recordGLCall(48); }
+static void APIENTRY recording_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { recordGLCall(49); }
+static void APIENTRY recording_glGetPointerv(GLenum pname, void **params) { recordGLCall(50); }
+static void APIENTRY recording_glPolygonOffset(GLfloat factor, GLfloat units) { recordGLCall(51); }
+static void APIENTRY recording_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { recordGLCall(52); }
+static void APIENTRY recording_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { recordGLCall(53); }
+static void APIENTRY recording_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { recordGLCall(54); }
+static void APIENTRY recording_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(55); }
+static void APIENTRY recording_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { recordGLCall(56); }
+static void APIENTRY recording_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { recordGLCall(57); }
+static void APIENTRY recording_glBindTexture(GLenum target, GLuint texture) { recordGLCall(58); }
+static void APIENTRY recording_glDeleteTextures(GLsizei n, const GLuint *textures) { recordGLCall(59); }
+static void APIENTRY recording_glGenTextures(GLsizei n, GLuint *textures) { recordGLCall(60); }
+static GLboolean APIENTRY recording_glIsTexture(GLuint texture) { recordGLCall(61); return {}; }
+static void APIENTRY recording_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { recordGLCall(62); }
+static void APIENTRY recording_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(63); }
+static void APIENTRY recording_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { recordGLCall(64); }
+static void APIENTRY recording_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(65); }
+static void APIENTRY recording_glActiveTexture(GLenum texture) { recordGLCall(66); }
+static void APIENTRY recording_glSampleCoverage(GLfloat value, GLboolean invert) { recordGLCall(67); }
+static void APIENTRY recording_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { recordGLCall(68); }
+static void APIENTRY recording_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { recordGLCall(69); }
+static void APIENTRY recording_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { recordGLCall(70); }
+static void APIENTRY recording_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(71); }
+static void APIENTRY recording_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(72); }
+static void APIENTRY recording_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(73); }
+static void APIENTRY recording_glGetCompressedTexImage(GLenum target, GLint level, void *img) { recordGLCall(74); }
+static void APIENTRY recording_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { recordGLCall(75); }
+static void APIENTRY recording_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { recordGLCall(76); }
+static void APIENTRY recording_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { recordGLCall(77); }
+static void APIENTRY recording_glPointParameterf(GLenum pname, GLfloat param) { recordGLCall(78); }
+static void APIENTRY recording_glPointParameterfv(GLenum pname, const GLfloat *params) { recordGLCall(79); }
+static void APIENTRY recording_glPointParameteri(GLenum pname, GLint param) { recordGLCall(80); }
+static void APIENTRY recording_glPointParameteriv(GLenum pname, const GLint *params) { recordGLCall(81); }
+static void APIENTRY recording_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { recordGLCall(82); }
+static void APIENTRY recording_glBlendEquation(GLenum mode) { recordGLCall(83); }
+static void APIENTRY recording_glGenQueries(GLsizei n, GLuint *ids) { recordGLCall(84); }
+static void APIENTRY recording_glDeleteQueries(GLsizei n, const GLuint *ids) { recordGLCall(85); }
+static GLboolean APIENTRY recording_glIsQuery(GLuint id) { recordGLCall(86); return {}; }
+static void APIENTRY recording_glBeginQuery(GLenum target, GLuint id) { recordGLCall(87); }
+static void APIENTRY recording_glEndQuery(GLenum target) { recordGLCall(88); }
+static void APIENTRY recording_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { recordGLCall(89); }
+static void APIENTRY recording_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { recordGLCall(90); }
+static void APIENTRY recording_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { recordGLCall(91); }
+static void APIENTRY recording_glBindBuffer(GLenum target, GLuint buffer) { recordGLCall(92); }
+static void APIENTRY recording_glDeleteBuffers(GLsizei n, const GLuint *buffers) { recordGLCall(93); }
+static void APIENTRY recording_glGenBuffers(GLsizei n, GLuint *buffers) { recordGLCall(94); }
+static GLboolean APIENTRY recording_glIsBuffer(GLuint buffer) { recordGLCall(95); return {}; }
+static void APIENTRY recording_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { recordGLCall(96); }
+static void APIENTRY recording_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { recordGLCall(97); }
+static void APIENTRY recording_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { recordGLCall(98); }
+static void * APIENTRY recording_glMapBuffer(GLenum target, GLenum access) { recordGLCall(99); return {}; }
+static GLboolean APIENTRY recording_glUnmapBuffer(GLenum target) { recordGLCall(100); return {}; }
+static void APIENTRY recording_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { recordGLCall(101); }
+static void APIENTRY recording_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { recordGLCall(102); }
+static void APIENTRY recording_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { recordGLCall(103); }
+static void APIENTRY recording_glDrawBuffers(GLsizei n, const GLenum *bufs) { recordGLCall(104); }
+static void APIENTRY recording_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { recordGLCall(105); }
+static void APIENTRY recording_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { recordGLCall(106); }
+static void APIENTRY recording_glStencilMaskSeparate(GLenum face, GLuint mask) { recordGLCall(107); }
+static void APIENTRY recording_glAttachShader(GLuint program, GLuint shader) { recordGLCall(108); }
+static void APIENTRY recording_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { recordGLCall(109); }
+static void APIENTRY recording_glCompileShader(GLuint shader) { recordGLCall(110); }
+static GLuint APIENTRY recording_glCreateProgram(void) { recordGLCall(111); return {}; }
+static GLuint APIENTRY recording_glCreateShader(GLenum type) { recordGLCall(112); return {}; }
+static void APIENTRY recording_glDeleteProgram(GLuint program) { recordGLCall(113); }
+static void APIENTRY recording_glDeleteShader(GLuint shader) { recordGLCall(114); }
+static void APIENTRY recording_glDetachShader(GLuint program, GLuint shader) { recordGLCall(115); }
+static void APIENTRY recording_glDisableVertexAttribArray(GLuint index) { recordGLCall(116); }
+static void APIENTRY recording_glEnableVertexAttribArray(GLuint index) { recordGLCall(117); }
+static void APIENTRY recording_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { recordGLCall(118); }
+static void APIENTRY recording_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { recordGLCall(119); }
+static void APIENTRY recording_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { recordGLCall(120); }
+static GLint APIENTRY recording_glGetAttribLocation(GLuint program, const GLchar *name) { recordGLCall(121); return {}; }
+static void APIENTRY recording_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { recordGLCall(122); }
+static void APIENTRY recording_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { recordGLCall(123); }
+static void APIENTRY recording_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { recordGLCall(124); }
+static void APIENTRY recording_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { recordGLCall(125); }
+static void APIENTRY recording_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { recordGLCall(126); }
+static GLint APIENTRY recording_glGetUniformLocation(GLuint program, const GLchar *name) { recordGLCall(127); return {}; }
+static void APIENTRY recording_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { recordGLCall(128); }
+static void APIENTRY recording_glGetUniformiv(GLuint program, GLint location, GLint *params) { recordGLCall(129); }
+static void APIENTRY recording_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { recordGLCall(130); }
+static void APIENTRY recording_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { recordGLCall(131); }
+static void APIENTRY recording_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { recordGLCall(132); }
+static void APIENTRY recording_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { recordGLCall(133); }
+static GLboolean APIENTRY recording_glIsProgram(GLuint program) { recordGLCall(134); return {}; }
+static GLboolean APIENTRY recording_glIsShader(GLuint shader) { recordGLCall(135); return {}; }
+static void APIENTRY recording_glLinkProgram(GLuint program) { recordGLCall(136); }
+static void APIENTRY recording_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { recordGLCall(137); }
+static void APIENTRY recording_glUseProgram(GLuint program) { recordGLCall(138); }
+static void APIENTRY recording_glUniform1f(GLint location, GLfloat v0) { recordGLCall(139); }
+static void APIENTRY recording_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { recordGLCall(140); }
+static void APIENTRY recording_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { recordGLCall(141); }
+static void APIENTRY recording_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { recordGLCall(142); }
+static void APIENTRY recording_glUniform1i(GLint location, GLint v0) { recordGLCall(143); }
+static void APIENTRY recording_glUniform2i(GLint location, GLint v0, GLint v1) { recordGLCall(144); }
+static void APIENTRY recording_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { recordGLCall(145); }
+static void APIENTRY recording_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { recordGLCall(146); }
+static void APIENTRY recording_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { recordGLCall(147); }
+static void APIENTRY recording_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { recordGLCall(148); }
+static void APIENTRY recording_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { recordGLCall(149); }
+static void APIENTRY recording_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { recordGLCall(150); }
+static void APIENTRY recording_glUniform1iv(GLint location, GLsizei count, const GLint *value) { recordGLCall(151); }
+static void APIENTRY recording_glUniform2iv(GLint location, GLsizei count, const GLint *value) { recordGLCall(152); }
+static void APIENTRY recording_glUniform3iv(GLint location, GLsizei count, const GLint *value) { recordGLCall(153); }
+static void APIENTRY recording_glUniform4iv(GLint location, GLsizei count, const GLint *value) { recordGLCall(154); }
+static void APIENTRY recording_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(155); }
+static void APIENTRY recording_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(156); }
+static void APIENTRY recording_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(157); }
+static void APIENTRY recording_glValidateProgram(GLuint program) { recordGLCall(158); }
+static void APIENTRY recording_glVertexAttrib1d(GLuint index, GLdouble x) { recordGLCall(159); }
+static void APIENTRY recording_glVertexAttrib1dv(GLuint index, const GLdouble *v) { recordGLCall(160); }
+static void APIENTRY recording_glVertexAttrib1f(GLuint index, GLfloat x) { recordGLCall(161); }
+static void APIENTRY recording_glVertexAttrib1fv(GLuint index, const GLfloat *v) { recordGLCall(162); }
+static void APIENTRY recording_glVertexAttrib1s(GLuint index, GLshort x) { recordGLCall(163); }
+static void APIENTRY recording_glVertexAttrib1sv(GLuint index, const GLshort *v) { recordGLCall(164); }
+static void APIENTRY recording_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { recordGLCall(165); }
+static void APIENTRY recording_glVertexAttrib2dv(GLuint index, const GLdouble *v) { recordGLCall(166); }
+static void APIENTRY recording_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { recordGLCall(167); }
+static void APIENTRY recording_glVertexAttrib2fv(GLuint index, const GLfloat *v) { recordGLCall(168); }
+static void APIENTRY recording_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { recordGLCall(169); }
+static void APIENTRY recording_glVertexAttrib2sv(GLuint index, const GLshort *v) { recordGLCall(170); }
+static void APIENTRY recording_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(171); }
+static void APIENTRY recording_glVertexAttrib3dv(GLuint index, const GLdouble *v) { recordGLCall(172); }
+static void APIENTRY recording_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { recordGLCall(173); }
+static void APIENTRY recording_glVertexAttrib3fv(GLuint index, const GLfloat *v) { recordGLCall(174); }
+static void APIENTRY recording_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { recordGLCall(175); }
+static void APIENTRY recording_glVertexAttrib3sv(GLuint index, const GLshort *v) { recordGLCall(176); }
+static void APIENTRY recording_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { recordGLCall(177); }
+static void APIENTRY recording_glVertexAttrib4Niv(GLuint index, const GLint *v) { recordGLCall(178); }
+static void APIENTRY recording_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { recordGLCall(179); }
+static void APIENTRY recording_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { recordGLCall(180); }
+static void APIENTRY recording_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { recordGLCall(181); }
+static void APIENTRY recording_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { recordGLCall(182); }
+static void APIENTRY recording_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { recordGLCall(183); }
+static void APIENTRY recording_glVertexAttrib4bv(GLuint index, const GLbyte *v) { recordGLCall(184); }
+static void APIENTRY recording_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { recordGLCall(185); }
+static void APIENTRY recording_glVertexAttrib4dv(GLuint index, const GLdouble *v) { recordGLCall(186); }
+static void APIENTRY recording_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { recordGLCall(187); }
+static void APIENTRY recording_glVertexAttrib4fv(GLuint index, const GLfloat *v) { recordGLCall(188); }
+static void APIENTRY recording_glVertexAttrib4iv(GLuint index, const GLint *v) { recordGLCall(189); }
+static void APIENTRY recording_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { recordGLCall(190); }
+static void APIENTRY recording_glVertexAttrib4sv(GLuint index, const GLshort *v) { recordGLCall(191); }
+static void APIENTRY recording_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { recordGLCall(192); }
+static void APIENTRY recording_glVertexAttrib4uiv(GLuint index, const GLuint *v) { recordGLCall(193); }
+static void APIENTRY recording_glVertexAttrib4usv(GLuint index, const GLushort *v) { recordGLCall(194); }
+static void APIENTRY recording_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { recordGLCall(195); }
+static void APIENTRY recording_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(196); }
+static void APIENTRY recording_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(197); }
+static void APIENTRY recording_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(198); }
+static void APIENTRY recording_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(199); }
+static void APIENTRY recording_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(200); }
+static void APIENTRY recording_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(201); }
+static void APIENTRY recording_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { recordGLCall(202); }
+static void APIENTRY recording_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { recordGLCall(203); }
+static void APIENTRY recording_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { recordGLCall(204); }
+static void APIENTRY recording_glEnablei(GLenum target, GLuint index) { recordGLCall(205); }
+static void APIENTRY recording_glDisablei(GLenum target, GLuint index) { recordGLCall(206); }
+static GLboolean APIENTRY recording_glIsEnabledi(GLenum target, GLuint index) { recordGLCall(207); return {}; }
+static void APIENTRY recording_glBeginTransformFeedback(GLenum primitiveMode) { recordGLCall(208); }
+static void APIENTRY recording_glEndTransformFeedback(void) { recordGLCall(209); }
+static void APIENTRY recording_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { recordGLCall(210); }
+static void APIENTRY recording_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { recordGLCall(211); }
+static void APIENTRY recording_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { recordGLCall(212); }
+static void APIENTRY recording_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { recordGLCall(213); }
+static void APIENTRY recording_glClampColor(GLenum target, GLenum clamp) { recordGLCall(214); }
+static void APIENTRY recording_glBeginConditionalRender(GLuint id, GLenum mode) { recordGLCall(215); }
+static void APIENTRY recording_glEndConditionalRender(void) { recordGLCall(216); }
+static void APIENTRY recording_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { recordGLCall(217); }
+static void APIENTRY recording_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { recordGLCall(218); }
+static void APIENTRY recording_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { recordGLCall(219); }
+static void APIENTRY recording_glVertexAttribI1i(GLuint index, GLint x) { recordGLCall(220); }
+static void APIENTRY recording_glVertexAttribI2i(GLuint index, GLint x, GLint y) { recordGLCall(221); }
+static void APIENTRY recording_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { recordGLCall(222); }
+static void APIENTRY recording_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { recordGLCall(223); }
+static void APIENTRY recording_glVertexAttribI1ui(GLuint index, GLuint x) { recordGLCall(224); }
+static void APIENTRY recording_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { recordGLCall(225); }
+static void APIENTRY recording_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { recordGLCall(226); }
+static void APIENTRY recording_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { recordGLCall(227); }
+static void APIENTRY recording_glVertexAttribI1iv(GLuint index, const GLint *v) { recordGLCall(228); }
+static void APIENTRY recording_glVertexAttribI2iv(GLuint index, const GLint *v) { recordGLCall(229); }
+static void APIENTRY recording_glVertexAttribI3iv(GLuint index, const GLint *v) { recordGLCall(230); }
+static void APIENTRY recording_glVertexAttribI4iv(GLuint index, const GLint *v) { recordGLCall(231); }
+static void APIENTRY recording_glVertexAttribI1uiv(GLuint index, const GLuint *v) { recordGLCall(232); }
+static void APIENTRY recording_glVertexAttribI2uiv(GLuint index, const GLuint *v) { recordGLCall(233); }
+static void APIENTRY recording_glVertexAttribI3uiv(GLuint index, const GLuint *v) { recordGLCall(234); }
+static void APIENTRY recording_glVertexAttribI4uiv(GLuint index, const GLuint *v) { recordGLCall(235); }
+static void APIENTRY recording_glVertexAttribI4bv(GLuint index, const GLbyte *v) { recordGLCall(236); }
+static void APIENTRY recording_glVertexAttribI4sv(GLuint index, const GLshort *v) { recordGLCall(237); }
+static void APIENTRY recording_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { recordGLCall(238); }
+static void APIENTRY recording_glVertexAttribI4usv(GLuint index, const GLushort *v) { recordGLCall(239); }
+static void APIENTRY recording_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { recordGLCall(240); }
+static void APIENTRY recording_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { recordGLCall(241); }
+static GLint APIENTRY recording_glGetFragDataLocation(GLuint program, const GLchar *name) { recordGLCall(242); return {}; }
+static void APIENTRY recording_glUniform1ui(GLint location, GLuint v0) { recordGLCall(243); }
+static void APIENTRY recording_glUniform2ui(GLint location, GLuint v0, GLuint v1) { recordGLCall(244); }
+static void APIENTRY recording_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { recordGLCall(245); }
+static void APIENTRY recording_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { recordGLCall(246); }
+static void APIENTRY recording_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { recordGLCall(247); }
+static void APIENTRY recording_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { recordGLCall(248); }
+static void APIENTRY recording_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { recordGLCall(249); }
+static void APIENTRY recording_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { recordGLCall(250); }
+static void APIENTRY recording_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { recordGLCall(251); }
+static void APIENTRY recording_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { recordGLCall(252); }
+static void APIENTRY recording_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { recordGLCall(253); }
+static void APIENTRY recording_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { recordGLCall(254); }
+static void APIENTRY recording_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { recordGLCall(255); }
+static void APIENTRY recording_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { recordGLCall(256); }
+static void APIENTRY recording_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { recordGLCall(257); }
+static void APIENTRY recording_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { recordGLCall(258); }
+static const GLubyte * APIENTRY recording_glGetStringi(GLenum name, GLuint index) { recordGLCall(259); return {}; }
+static GLboolean APIENTRY recording_glIsRenderbuffer(GLuint renderbuffer) { recordGLCall(260); return {}; }
+static void APIENTRY recording_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { recordGLCall(261); }
+static void APIENTRY recording_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { recordGLCall(262); }
+static void APIENTRY recording_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { recordGLCall(263); }
+static void APIENTRY recording_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(264); }
+static void APIENTRY recording_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { recordGLCall(265); }
+static GLboolean APIENTRY recording_glIsFramebuffer(GLuint framebuffer) { recordGLCall(266); return {}; }
+static void APIENTRY recording_glBindFramebuffer(GLenum target, GLuint framebuffer) { recordGLCall(267); }
+static void APIENTRY recording_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { recordGLCall(268); }
+static void APIENTRY recording_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { recordGLCall(269); }
+static GLenum APIENTRY recording_glCheckFramebufferStatus(GLenum target) { recordGLCall(270); return {}; }
+static void APIENTRY recording_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { recordGLCall(271); }
+static void APIENTRY recording_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { recordGLCall(272); }
+static void APIENTRY recording_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { recordGLCall(273); }
+static void APIENTRY recording_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { recordGLCall(274); }
+static void APIENTRY recording_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { recordGLCall(275); }
+static void APIENTRY recording_glGenerateMipmap(GLenum target) { recordGLCall(276); }
+static void APIENTRY recording_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { recordGLCall(277); }
+static void APIENTRY recording_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(278); }
+static void APIENTRY recording_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { recordGLCall(279); }
+static void * APIENTRY recording_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { recordGLCall(280); return {}; }
+static void APIENTRY recording_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { recordGLCall(281); }
+static void APIENTRY recording_glBindVertexArray(GLuint array) { recordGLCall(282); }
+static void APIENTRY recording_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { recordGLCall(283); }
+static void APIENTRY recording_glGenVertexArrays(GLsizei n, GLuint *arrays) { recordGLCall(284); }
+static GLboolean APIENTRY recording_glIsVertexArray(GLuint array) { recordGLCall(285); return {}; }
+static void APIENTRY recording_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { recordGLCall(286); }
+static void APIENTRY recording_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { recordGLCall(287); }
+static void APIENTRY recording_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { recordGLCall(288); }
+static void APIENTRY recording_glPrimitiveRestartIndex(GLuint index) { recordGLCall(289); }
+static void APIENTRY recording_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { recordGLCall(290); }
+static void APIENTRY recording_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { recordGLCall(291); }
+static void APIENTRY recording_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { recordGLCall(292); }
+static void APIENTRY recording_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { recordGLCall(293); }
+static GLuint APIENTRY recording_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { recordGLCall(294); return {}; }
+static void APIENTRY recording_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { recordGLCall(295); }
+static void APIENTRY recording_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { recordGLCall(296); }
+static void APIENTRY recording_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { recordGLCall(297); }
+static void APIENTRY recording_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { recordGLCall(298); }
+static void APIENTRY recording_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { recordGLCall(299); }
+static void APIENTRY recording_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { recordGLCall(300); }
+static void APIENTRY recording_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { recordGLCall(301); }
+static void APIENTRY recording_glProvokingVertex(GLenum mode) { recordGLCall(302); }
+static GLsync APIENTRY recording_glFenceSync(GLenum condition, GLbitfield flags) { recordGLCall(303); return {}; }
+static GLboolean APIENTRY recording_glIsSync(GLsync sync) { recordGLCall(304); return {}; }
+static void APIENTRY recording_glDeleteSync(GLsync sync) { recordGLCall(305); }
+static GLenum APIENTRY recording_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { recordGLCall(306); return {}; }
+static void APIENTRY recording_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { recordGLCall(307); }
+static void APIENTRY recording_glGetInteger64v(GLenum pname, GLint64 *data) { recordGLCall(308); }
+static void APIENTRY recording_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { recordGLCall(309); }
+static void APIENTRY recording_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { recordGLCall(310); }
+static void APIENTRY recording_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { recordGLCall(311); }
+static void APIENTRY recording_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { recordGLCall(312); }
+static void APIENTRY recording_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { recordGLCall(313); }
+static void APIENTRY recording_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { recordGLCall(314); }
+static void APIENTRY recording_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { recordGLCall(315); }
+static void APIENTRY recording_glSampleMaski(GLuint maskNumber, GLbitfield mask) { recordGLCall(316); }
+static void APIENTRY recording_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { recordGLCall(317); }
+static GLint APIENTRY recording_glGetFragDataIndex(GLuint program, const GLchar *name) { recordGLCall(318); return {}; }
+static void APIENTRY recording_glGenSamplers(GLsizei count, GLuint *samplers) { recordGLCall(319); }
+static void APIENTRY recording_glDeleteSamplers(GLsizei count, const GLuint *samplers) { recordGLCall(320); }
+static GLboolean APIENTRY recording_glIsSampler(GLuint sampler) { recordGLCall(321); return {}; }
+static void APIENTRY recording_glBindSampler(GLuint unit, GLuint sampler) { recordGLCall(322); }
+static void APIENTRY recording_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { recordGLCall(323); }
+static void APIENTRY recording_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { recordGLCall(324); }
+static void APIENTRY recording_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { recordGLCall(325); }
+static void APIENTRY recording_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { recordGLCall(326); }
+static void APIENTRY recording_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { recordGLCall(327); }
+static void APIENTRY recording_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { recordGLCall(328); }
+static void APIENTRY recording_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { recordGLCall(329); }
+static void APIENTRY recording_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { recordGLCall(330); }
+static void APIENTRY recording_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { recordGLCall(331); }
+static void APIENTRY recording_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { recordGLCall(332); }
+static void APIENTRY recording_glQueryCounter(GLuint id, GLenum target) { recordGLCall(333); }
+static void APIENTRY recording_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { recordGLCall(334); }
+static void APIENTRY recording_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { recordGLCall(335); }
+static void APIENTRY recording_glVertexAttribDivisor(GLuint index, GLuint divisor) { recordGLCall(336); }
+static void APIENTRY recording_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { recordGLCall(337); }
+static void APIENTRY recording_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { recordGLCall(338); }
+static void APIENTRY recording_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { recordGLCall(339); }
+static void APIENTRY recording_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { recordGLCall(340); }
+static void APIENTRY recording_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { recordGLCall(341); }
+static void APIENTRY recording_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { recordGLCall(342); }
+static void APIENTRY recording_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { recordGLCall(343); }
+static void APIENTRY recording_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { recordGLCall(344); }
+static void APIENTRY recording_glMinSampleShading(GLfloat value) { recordGLCall(345); }
+static void APIENTRY recording_glBlendEquationi(GLuint buf, GLenum mode) { recordGLCall(346); }
+static void APIENTRY recording_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) { recordGLCall(347); }
+static void APIENTRY recording_glBlendFunci(GLuint buf, GLenum src, GLenum dst) { recordGLCall(348); }
+static void APIENTRY recording_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) { recordGLCall(349); }
+static void APIENTRY recording_glDrawArraysIndirect(GLenum mode, const void *indirect) { recordGLCall(350); }
+static void APIENTRY recording_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) { recordGLCall(351); }
+static void APIENTRY recording_glUniform1d(GLint location, GLdouble x) { recordGLCall(352); }
+static void APIENTRY recording_glUniform2d(GLint location, GLdouble x, GLdouble y) { recordGLCall(353); }
+static void APIENTRY recording_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(354); }
+static void APIENTRY recording_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { recordGLCall(355); }
+static void APIENTRY recording_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) { recordGLCall(356); }
+static void APIENTRY recording_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) { recordGLCall(357); }
+static void APIENTRY recording_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) { recordGLCall(358); }
+static void APIENTRY recording_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) { recordGLCall(359); }
+static void APIENTRY recording_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(360); }
+static void APIENTRY recording_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(361); }
+static void APIENTRY recording_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(362); }
+static void APIENTRY recording_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(363); }
+static void APIENTRY recording_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(364); }
+static void APIENTRY recording_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(365); }
+static void APIENTRY recording_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(366); }
+static void APIENTRY recording_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(367); }
+static void APIENTRY recording_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(368); }
+static void APIENTRY recording_glGetUniformdv(GLuint program, GLint location, GLdouble *params) { recordGLCall(369); }
+static GLint APIENTRY recording_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) { recordGLCall(370); return {}; }
+static GLuint APIENTRY recording_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) { recordGLCall(371); return {}; }
+static void APIENTRY recording_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) { recordGLCall(372); }
+static void APIENTRY recording_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) { recordGLCall(373); }
+static void APIENTRY recording_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei *length, GLchar *name) { recordGLCall(374); }
+static void APIENTRY recording_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) { recordGLCall(375); }
+static void APIENTRY recording_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) { recordGLCall(376); }
+static void APIENTRY recording_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) { recordGLCall(377); }
+static void APIENTRY recording_glPatchParameteri(GLenum pname, GLint value) { recordGLCall(378); }
+static void APIENTRY recording_glPatchParameterfv(GLenum pname, const GLfloat *values) { recordGLCall(379); }
+static void APIENTRY recording_glBindTransformFeedback(GLenum target, GLuint id) { recordGLCall(380); }
+static void APIENTRY recording_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) { recordGLCall(381); }
+static void APIENTRY recording_glGenTransformFeedbacks(GLsizei n, GLuint *ids) { recordGLCall(382); }
+static GLboolean APIENTRY recording_glIsTransformFeedback(GLuint id) { recordGLCall(383); return {}; }
+static void APIENTRY recording_glPauseTransformFeedback(void) { recordGLCall(384); }
+static void APIENTRY recording_glResumeTransformFeedback(void) { recordGLCall(385); }
+static void APIENTRY recording_glDrawTransformFeedback(GLenum mode, GLuint id) { recordGLCall(386); }
+static void APIENTRY recording_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) { recordGLCall(387); }
+static void APIENTRY recording_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) { recordGLCall(388); }
+static void APIENTRY recording_glEndQueryIndexed(GLenum target, GLuint index) { recordGLCall(389); }
+static void APIENTRY recording_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) { recordGLCall(390); }
+static void APIENTRY recording_glReleaseShaderCompiler(void) { recordGLCall(391); }
+static void APIENTRY recording_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryformat, const void *binary, GLsizei length) { recordGLCall(392); }
+static void APIENTRY recording_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) { recordGLCall(393); }
+static void APIENTRY recording_glDepthRangef(GLfloat n, GLfloat f) { recordGLCall(394); }
+static void APIENTRY recording_glClearDepthf(GLfloat d) { recordGLCall(395); }
+static void APIENTRY recording_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) { recordGLCall(396); }
+static void APIENTRY recording_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) { recordGLCall(397); }
+static void APIENTRY recording_glProgramParameteri(GLuint program, GLenum pname, GLint value) { recordGLCall(398); }
+static void APIENTRY recording_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) { recordGLCall(399); }
+static void APIENTRY recording_glActiveShaderProgram(GLuint pipeline, GLuint program) { recordGLCall(400); }
+static GLuint APIENTRY recording_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) { recordGLCall(401); return {}; }
+static void APIENTRY recording_glBindProgramPipeline(GLuint pipeline) { recordGLCall(402); }
+static void APIENTRY recording_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) { recordGLCall(403); }
+static void APIENTRY recording_glGenProgramPipelines(GLsizei n, GLuint *pipelines) { recordGLCall(404); }
+static GLboolean APIENTRY recording_glIsProgramPipeline(GLuint pipeline) { recordGLCall(405); return {}; }
+static void APIENTRY recording_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) { recordGLCall(406); }
+static void APIENTRY recording_glProgramUniform1i(GLuint program, GLint location, GLint v0) { recordGLCall(407); }
+static void APIENTRY recording_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(408); }
+static void APIENTRY recording_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) { recordGLCall(409); }
+static void APIENTRY recording_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(410); }
+static void APIENTRY recording_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) { recordGLCall(411); }
+static void APIENTRY recording_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(412); }
+static void APIENTRY recording_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) { recordGLCall(413); }
+static void APIENTRY recording_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(414); }
+static void APIENTRY recording_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) { recordGLCall(415); }
+static void APIENTRY recording_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(416); }
+static void APIENTRY recording_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) { recordGLCall(417); }
+static void APIENTRY recording_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(418); }
+static void APIENTRY recording_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) { recordGLCall(419); }
+static void APIENTRY recording_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(420); }
+static void APIENTRY recording_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) { recordGLCall(421); }
+static void APIENTRY recording_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(422); }
+static void APIENTRY recording_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) { recordGLCall(423); }
+static void APIENTRY recording_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(424); }
+static void APIENTRY recording_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { recordGLCall(425); }
+static void APIENTRY recording_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(426); }
+static void APIENTRY recording_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) { recordGLCall(427); }
+static void APIENTRY recording_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(428); }
+static void APIENTRY recording_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) { recordGLCall(429); }
+static void APIENTRY recording_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(430); }
+static void APIENTRY recording_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { recordGLCall(431); }
+static void APIENTRY recording_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(432); }
+static void APIENTRY recording_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { recordGLCall(433); }
+static void APIENTRY recording_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(434); }
+static void APIENTRY recording_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) { recordGLCall(435); }
+static void APIENTRY recording_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(436); }
+static void APIENTRY recording_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { recordGLCall(437); }
+static void APIENTRY recording_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(438); }
+static void APIENTRY recording_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(439); }
+static void APIENTRY recording_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(440); }
+static void APIENTRY recording_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(441); }
+static void APIENTRY recording_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(442); }
+static void APIENTRY recording_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(443); }
+static void APIENTRY recording_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(444); }
+static void APIENTRY recording_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(445); }
+static void APIENTRY recording_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(446); }
+static void APIENTRY recording_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(447); }
+static void APIENTRY recording_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(448); }
+static void APIENTRY recording_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(449); }
+static void APIENTRY recording_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(450); }
+static void APIENTRY recording_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(451); }
+static void APIENTRY recording_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(452); }
+static void APIENTRY recording_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(453); }
+static void APIENTRY recording_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(454); }
+static void APIENTRY recording_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(455); }
+static void APIENTRY recording_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(456); }
+static void APIENTRY recording_glValidateProgramPipeline(GLuint pipeline) { recordGLCall(457); }
+static void APIENTRY recording_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { recordGLCall(458); }
+static void APIENTRY recording_glVertexAttribL1d(GLuint index, GLdouble x) { recordGLCall(459); }
+static void APIENTRY recording_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) { recordGLCall(460); }
+static void APIENTRY recording_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(461); }
+static void APIENTRY recording_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { recordGLCall(462); }
+static void APIENTRY recording_glVertexAttribL1dv(GLuint index, const GLdouble *v) { recordGLCall(463); }
+static void APIENTRY recording_glVertexAttribL2dv(GLuint index, const GLdouble *v) { recordGLCall(464); }
+static void APIENTRY recording_glVertexAttribL3dv(GLuint index, const GLdouble *v) { recordGLCall(465); }
+static void APIENTRY recording_glVertexAttribL4dv(GLuint index, const GLdouble *v) { recordGLCall(466); }
+static void APIENTRY recording_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { recordGLCall(467); }
+static void APIENTRY recording_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) { recordGLCall(468); }
+static void APIENTRY recording_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) { recordGLCall(469); }
+static void APIENTRY recording_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) { recordGLCall(470); }
+static void APIENTRY recording_glViewportIndexedfv(GLuint index, const GLfloat *v) { recordGLCall(471); }
+static void APIENTRY recording_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) { recordGLCall(472); }
+static void APIENTRY recording_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) { recordGLCall(473); }
+static void APIENTRY recording_glScissorIndexedv(GLuint index, const GLint *v) { recordGLCall(474); }
+static void APIENTRY recording_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) { recordGLCall(475); }
+static void APIENTRY recording_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) { recordGLCall(476); }
+static void APIENTRY recording_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) { recordGLCall(477); }
+static void APIENTRY recording_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) { recordGLCall(478); }
+static void APIENTRY recording_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) { recordGLCall(479); }
+static void APIENTRY recording_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) { recordGLCall(480); }
+static void APIENTRY recording_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) { recordGLCall(481); }
+static void APIENTRY recording_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint *params) { recordGLCall(482); }
+static void APIENTRY recording_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) { recordGLCall(483); }
+static void APIENTRY recording_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) { recordGLCall(484); }
+static void APIENTRY recording_glMemoryBarrier(GLbitfield barriers) { recordGLCall(485); }
+static void APIENTRY recording_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) { recordGLCall(486); }
+static void APIENTRY recording_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(487); }
+static void APIENTRY recording_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { recordGLCall(488); }
+static void APIENTRY recording_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) { recordGLCall(489); }
+static void APIENTRY recording_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) { recordGLCall(490); }
+static void APIENTRY recording_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) { recordGLCall(491); }
+static void APIENTRY recording_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { recordGLCall(492); }
+static void APIENTRY recording_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) { recordGLCall(493); }
+static void APIENTRY recording_glDispatchComputeIndirect(GLintptr indirect) { recordGLCall(494); }
+static void APIENTRY recording_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) { recordGLCall(495); }
+static void APIENTRY recording_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) { recordGLCall(496); }
+static void APIENTRY recording_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) { recordGLCall(497); }
+static void APIENTRY recording_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64 *params) { recordGLCall(498); }
+static void APIENTRY recording_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) { recordGLCall(499); }
+static void APIENTRY recording_glInvalidateTexImage(GLuint texture, GLint level) { recordGLCall(500); }
+static void APIENTRY recording_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) { recordGLCall(501); }
+static void APIENTRY recording_glInvalidateBufferData(GLuint buffer) { recordGLCall(502); }
+static void APIENTRY recording_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) { recordGLCall(503); }
+static void APIENTRY recording_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(504); }
+static void APIENTRY recording_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) { recordGLCall(505); }
+static void APIENTRY recording_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) { recordGLCall(506); }
+static void APIENTRY recording_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) { recordGLCall(507); }
+static GLuint APIENTRY recording_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) { recordGLCall(508); return {}; }
+static void APIENTRY recording_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) { recordGLCall(509); }
+static void APIENTRY recording_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLint *params) { recordGLCall(510); }
+static GLint APIENTRY recording_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) { recordGLCall(511); return {}; }
+static GLint APIENTRY recording_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) { recordGLCall(512); return {}; }
+static void APIENTRY recording_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) { recordGLCall(513); }
+static void APIENTRY recording_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { recordGLCall(514); }
+static void APIENTRY recording_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { recordGLCall(515); }
+static void APIENTRY recording_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { recordGLCall(516); }
+static void APIENTRY recording_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) { recordGLCall(517); }
+static void APIENTRY recording_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { recordGLCall(518); }
+static void APIENTRY recording_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { recordGLCall(519); }
+static void APIENTRY recording_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(520); }
+static void APIENTRY recording_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(521); }
+static void APIENTRY recording_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) { recordGLCall(522); }
+static void APIENTRY recording_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) { recordGLCall(523); }
+static void APIENTRY recording_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) { recordGLCall(524); }
+static void APIENTRY recording_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) { recordGLCall(525); }
+static void APIENTRY recording_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) { recordGLCall(526); }
+static GLuint APIENTRY recording_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) { recordGLCall(527); return {}; }
+static void APIENTRY recording_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) { recordGLCall(528); }
+static void APIENTRY recording_glPopDebugGroup(void) { recordGLCall(529); }
+static void APIENTRY recording_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) { recordGLCall(530); }
+static void APIENTRY recording_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) { recordGLCall(531); }
+static void APIENTRY recording_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) { recordGLCall(532); }
+static void APIENTRY recording_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) { recordGLCall(533); }
+static void APIENTRY recording_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) { recordGLCall(534); }
+static void APIENTRY recording_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) { recordGLCall(535); }
+static void APIENTRY recording_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) { recordGLCall(536); }
+static void APIENTRY recording_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) { recordGLCall(537); }
+static void APIENTRY recording_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) { recordGLCall(538); }
+static void APIENTRY recording_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) { recordGLCall(539); }
+static void APIENTRY recording_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) { recordGLCall(540); }
+static void APIENTRY recording_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) { recordGLCall(541); }
+static void APIENTRY recording_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { recordGLCall(542); }
+static void APIENTRY recording_glClipControl(GLenum origin, GLenum depth) { recordGLCall(543); }
+static void APIENTRY recording_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) { recordGLCall(544); }
+static void APIENTRY recording_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) { recordGLCall(545); }
+static void APIENTRY recording_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { recordGLCall(546); }
+static void APIENTRY recording_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) { recordGLCall(547); }
+static void APIENTRY recording_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) { recordGLCall(548); }
+static void APIENTRY recording_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) { recordGLCall(549); }
+static void APIENTRY recording_glCreateBuffers(GLsizei n, GLuint *buffers) { recordGLCall(550); }
+static void APIENTRY recording_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) { recordGLCall(551); }
+static void APIENTRY recording_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) { recordGLCall(552); }
+static void APIENTRY recording_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) { recordGLCall(553); }
+static void APIENTRY recording_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { recordGLCall(554); }
+static void APIENTRY recording_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) { recordGLCall(555); }
+static void APIENTRY recording_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { recordGLCall(556); }
+static void * APIENTRY recording_glMapNamedBuffer(GLuint buffer, GLenum access) { recordGLCall(557); return {}; }
+static void * APIENTRY recording_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) { recordGLCall(558); return {}; }
+static GLboolean APIENTRY recording_glUnmapNamedBuffer(GLuint buffer) { recordGLCall(559); return {}; }
+static void APIENTRY recording_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) { recordGLCall(560); }
+static void APIENTRY recording_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) { recordGLCall(561); }
+static void APIENTRY recording_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) { recordGLCall(562); }
+static void APIENTRY recording_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) { recordGLCall(563); }
+static void APIENTRY recording_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) { recordGLCall(564); }
+static void APIENTRY recording_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) { recordGLCall(565); }
+static void APIENTRY recording_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { recordGLCall(566); }
+static void APIENTRY recording_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) { recordGLCall(567); }
+static void APIENTRY recording_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) { recordGLCall(568); }
+static void APIENTRY recording_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) { recordGLCall(569); }
+static void APIENTRY recording_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) { recordGLCall(570); }
+static void APIENTRY recording_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) { recordGLCall(571); }
+static void APIENTRY recording_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) { recordGLCall(572); }
+static void APIENTRY recording_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) { recordGLCall(573); }
+static void APIENTRY recording_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(574); }
+static void APIENTRY recording_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) { recordGLCall(575); }
+static void APIENTRY recording_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) { recordGLCall(576); }
+static void APIENTRY recording_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) { recordGLCall(577); }
+static void APIENTRY recording_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { recordGLCall(578); }
+static void APIENTRY recording_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { recordGLCall(579); }
+static GLenum APIENTRY recording_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) { recordGLCall(580); return {}; }
+static void APIENTRY recording_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) { recordGLCall(581); }
+static void APIENTRY recording_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) { recordGLCall(582); }
+static void APIENTRY recording_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) { recordGLCall(583); }
+static void APIENTRY recording_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(584); }
+static void APIENTRY recording_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(585); }
+static void APIENTRY recording_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) { recordGLCall(586); }
+static void APIENTRY recording_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) { recordGLCall(587); }
+static void APIENTRY recording_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) { recordGLCall(588); }
+static void APIENTRY recording_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { recordGLCall(589); }
+static void APIENTRY recording_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) { recordGLCall(590); }
+static void APIENTRY recording_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(591); }
+static void APIENTRY recording_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { recordGLCall(592); }
+static void APIENTRY recording_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { recordGLCall(593); }
+static void APIENTRY recording_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { recordGLCall(594); }
+static void APIENTRY recording_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { recordGLCall(595); }
+static void APIENTRY recording_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { recordGLCall(596); }
+static void APIENTRY recording_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { recordGLCall(597); }
+static void APIENTRY recording_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(598); }
+static void APIENTRY recording_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(599); }
+static void APIENTRY recording_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { recordGLCall(600); }
+static void APIENTRY recording_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { recordGLCall(601); }
+static void APIENTRY recording_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(602); }
+static void APIENTRY recording_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(603); }
+static void APIENTRY recording_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) { recordGLCall(604); }
+static void APIENTRY recording_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) { recordGLCall(605); }
+static void APIENTRY recording_glTextureParameteri(GLuint texture, GLenum pname, GLint param) { recordGLCall(606); }
+static void APIENTRY recording_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) { recordGLCall(607); }
+static void APIENTRY recording_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) { recordGLCall(608); }
+static void APIENTRY recording_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) { recordGLCall(609); }
+static void APIENTRY recording_glGenerateTextureMipmap(GLuint texture) { recordGLCall(610); }
+static void APIENTRY recording_glBindTextureUnit(GLuint unit, GLuint texture) { recordGLCall(611); }
+static void APIENTRY recording_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { recordGLCall(612); }
+static void APIENTRY recording_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) { recordGLCall(613); }
+static void APIENTRY recording_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) { recordGLCall(614); }
+static void APIENTRY recording_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) { recordGLCall(615); }
+static void APIENTRY recording_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) { recordGLCall(616); }
+static void APIENTRY recording_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) { recordGLCall(617); }
+static void APIENTRY recording_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) { recordGLCall(618); }
+static void APIENTRY recording_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) { recordGLCall(619); }
+static void APIENTRY recording_glCreateVertexArrays(GLsizei n, GLuint *arrays) { recordGLCall(620); }
+static void APIENTRY recording_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) { recordGLCall(621); }
+static void APIENTRY recording_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) { recordGLCall(622); }
+static void APIENTRY recording_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) { recordGLCall(623); }
+static void APIENTRY recording_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { recordGLCall(624); }
+static void APIENTRY recording_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) { recordGLCall(625); }
+static void APIENTRY recording_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) { recordGLCall(626); }
+static void APIENTRY recording_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { recordGLCall(627); }
+static void APIENTRY recording_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(628); }
+static void APIENTRY recording_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(629); }
+static void APIENTRY recording_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) { recordGLCall(630); }
+static void APIENTRY recording_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) { recordGLCall(631); }
+static void APIENTRY recording_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) { recordGLCall(632); }
+static void APIENTRY recording_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) { recordGLCall(633); }
+static void APIENTRY recording_glCreateSamplers(GLsizei n, GLuint *samplers) { recordGLCall(634); }
+static void APIENTRY recording_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) { recordGLCall(635); }
+static void APIENTRY recording_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) { recordGLCall(636); }
+static void APIENTRY recording_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { recordGLCall(637); }
+static void APIENTRY recording_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { recordGLCall(638); }
+static void APIENTRY recording_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { recordGLCall(639); }
+static void APIENTRY recording_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) { recordGLCall(640); }
+static void APIENTRY recording_glMemoryBarrierByRegion(GLbitfield barriers) { recordGLCall(641); }
+static void APIENTRY recording_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { recordGLCall(642); }
+static void APIENTRY recording_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) { recordGLCall(643); }
+static GLenum APIENTRY recording_glGetGraphicsResetStatus(void) { recordGLCall(644); return {}; }
+static void APIENTRY recording_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) { recordGLCall(645); }
+static void APIENTRY recording_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) { recordGLCall(646); }
+static void APIENTRY recording_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) { recordGLCall(647); }
+static void APIENTRY recording_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) { recordGLCall(648); }
+static void APIENTRY recording_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) { recordGLCall(649); }
+static void APIENTRY recording_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) { recordGLCall(650); }
+static void APIENTRY recording_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) { recordGLCall(651); }
+static void APIENTRY recording_glTextureBarrier(void) { recordGLCall(652); }
+static void APIENTRY recording_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) { recordGLCall(653); }
+static void APIENTRY recording_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { recordGLCall(654); }
+static void APIENTRY recording_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { recordGLCall(655); }
+static void APIENTRY recording_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) { recordGLCall(656); }
+static void APIENTRY recording_glPrimitiveBoundingBoxARB(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW) { recordGLCall(657); }
+static GLuint64 APIENTRY recording_glGetTextureHandleARB(GLuint texture) { recordGLCall(658); return {}; }
+static GLuint64 APIENTRY recording_glGetTextureSamplerHandleARB(GLuint texture, GLuint sampler) { recordGLCall(659); return {}; }
+static void APIENTRY recording_glMakeTextureHandleResidentARB(GLuint64 handle) { recordGLCall(660); }
+static void APIENTRY recording_glMakeTextureHandleNonResidentARB(GLuint64 handle) { recordGLCall(661); }
+static GLuint64 APIENTRY recording_glGetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format) { recordGLCall(662); return {}; }
+static void APIENTRY recording_glMakeImageHandleResidentARB(GLuint64 handle, GLenum access) { recordGLCall(663); }
+static void APIENTRY recording_glMakeImageHandleNonResidentARB(GLuint64 handle) { recordGLCall(664); }
+static void APIENTRY recording_glUniformHandleui64ARB(GLint location, GLuint64 value) { recordGLCall(665); }
+static void APIENTRY recording_glUniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(666); }
+static void APIENTRY recording_glProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint64 value) { recordGLCall(667); }
+static void APIENTRY recording_glProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *values) { recordGLCall(668); }
+static GLboolean APIENTRY recording_glIsTextureHandleResidentARB(GLuint64 handle) { recordGLCall(669); return {}; }
+static GLboolean APIENTRY recording_glIsImageHandleResidentARB(GLuint64 handle) { recordGLCall(670); return {}; }
+static void APIENTRY recording_glVertexAttribL1ui64ARB(GLuint index, GLuint64EXT x) { recordGLCall(671); }
+static void APIENTRY recording_glVertexAttribL1ui64vARB(GLuint index, const GLuint64EXT *v) { recordGLCall(672); }
+static void APIENTRY recording_glGetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT *params) { recordGLCall(673); }
+static GLsync APIENTRY recording_glCreateSyncFromCLeventARB(struct _cl_context *context, struct _cl_event *event, GLbitfield flags) { recordGLCall(674); return {}; }
+static void APIENTRY recording_glDispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z) { recordGLCall(675); }
+static void APIENTRY recording_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) { recordGLCall(676); }
+static void APIENTRY recording_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) { recordGLCall(677); }
+static void APIENTRY recording_glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam) { recordGLCall(678); }
+static GLuint APIENTRY recording_glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) { recordGLCall(679); return {}; }
+static void APIENTRY recording_glBlendEquationiARB(GLuint buf, GLenum mode) { recordGLCall(680); }
+static void APIENTRY recording_glBlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha) { recordGLCall(681); }
+static void APIENTRY recording_glBlendFunciARB(GLuint buf, GLenum src, GLenum dst) { recordGLCall(682); }
+static void APIENTRY recording_glBlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) { recordGLCall(683); }
+static void APIENTRY recording_glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount) { recordGLCall(684); }
+static void APIENTRY recording_glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) { recordGLCall(685); }
+static void APIENTRY recording_glProgramParameteriARB(GLuint program, GLenum pname, GLint value) { recordGLCall(686); }
+static void APIENTRY recording_glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level) { recordGLCall(687); }
+static void APIENTRY recording_glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { recordGLCall(688); }
+static void APIENTRY recording_glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face) { recordGLCall(689); }
+static void APIENTRY recording_glSpecializeShaderARB(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) { recordGLCall(690); }
+static void APIENTRY recording_glUniform1i64ARB(GLint location, GLint64 x) { recordGLCall(691); }
+static void APIENTRY recording_glUniform2i64ARB(GLint location, GLint64 x, GLint64 y) { recordGLCall(692); }
+static void APIENTRY recording_glUniform3i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z) { recordGLCall(693); }
+static void APIENTRY recording_glUniform4i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w) { recordGLCall(694); }
+static void APIENTRY recording_glUniform1i64vARB(GLint location, GLsizei count, const GLint64 *value) { recordGLCall(695); }
+static void APIENTRY recording_glUniform2i64vARB(GLint location, GLsizei count, const GLint64 *value) { recordGLCall(696); }
+static void APIENTRY recording_glUniform3i64vARB(GLint location, GLsizei count, const GLint64 *value) { recordGLCall(697); }
+static void APIENTRY recording_glUniform4i64vARB(GLint location, GLsizei count, const GLint64 *value) { recordGLCall(698); }
+static void APIENTRY recording_glUniform1ui64ARB(GLint location, GLuint64 x) { recordGLCall(699); }
+static void APIENTRY recording_glUniform2ui64ARB(GLint location, GLuint64 x, GLuint64 y) { recordGLCall(700); }
+static void APIENTRY recording_glUniform3ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z) { recordGLCall(701); }
+static void APIENTRY recording_glUniform4ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w) { recordGLCall(702); }
+static void APIENTRY recording_glUniform1ui64vARB(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(703); }
+static void APIENTRY recording_glUniform2ui64vARB(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(704); }
+static void APIENTRY recording_glUniform3ui64vARB(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(705); }
+static void APIENTRY recording_glUniform4ui64vARB(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(706); }
+static void APIENTRY recording_glGetUniformi64vARB(GLuint program, GLint location, GLint64 *params) { recordGLCall(707); }
+static void APIENTRY recording_glGetUniformui64vARB(GLuint program, GLint location, GLuint64 *params) { recordGLCall(708); }
+static void APIENTRY recording_glGetnUniformi64vARB(GLuint program, GLint location, GLsizei bufSize, GLint64 *params) { recordGLCall(709); }
+static void APIENTRY recording_glGetnUniformui64vARB(GLuint program, GLint location, GLsizei bufSize, GLuint64 *params) { recordGLCall(710); }
+static void APIENTRY recording_glProgramUniform1i64ARB(GLuint program, GLint location, GLint64 x) { recordGLCall(711); }
+static void APIENTRY recording_glProgramUniform2i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y) { recordGLCall(712); }
+static void APIENTRY recording_glProgramUniform3i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z) { recordGLCall(713); }
+static void APIENTRY recording_glProgramUniform4i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w) { recordGLCall(714); }
+static void APIENTRY recording_glProgramUniform1i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) { recordGLCall(715); }
+static void APIENTRY recording_glProgramUniform2i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) { recordGLCall(716); }
+static void APIENTRY recording_glProgramUniform3i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) { recordGLCall(717); }
+static void APIENTRY recording_glProgramUniform4i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) { recordGLCall(718); }
+static void APIENTRY recording_glProgramUniform1ui64ARB(GLuint program, GLint location, GLuint64 x) { recordGLCall(719); }
+static void APIENTRY recording_glProgramUniform2ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y) { recordGLCall(720); }
+static void APIENTRY recording_glProgramUniform3ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z) { recordGLCall(721); }
+static void APIENTRY recording_glProgramUniform4ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w) { recordGLCall(722); }
+static void APIENTRY recording_glProgramUniform1ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(723); }
+static void APIENTRY recording_glProgramUniform2ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(724); }
+static void APIENTRY recording_glProgramUniform3ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(725); }
+static void APIENTRY recording_glProgramUniform4ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(726); }
+static void APIENTRY recording_glMultiDrawArraysIndirectCountARB(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { recordGLCall(727); }
+static void APIENTRY recording_glMultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { recordGLCall(728); }
+static void APIENTRY recording_glVertexAttribDivisorARB(GLuint index, GLuint divisor) { recordGLCall(729); }
+static void APIENTRY recording_glMaxShaderCompilerThreadsARB(GLuint count) { recordGLCall(730); }
+static GLenum APIENTRY recording_glGetGraphicsResetStatusARB(void) { recordGLCall(731); return {}; }
+static void APIENTRY recording_glGetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img) { recordGLCall(732); }
+static void APIENTRY recording_glReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) { recordGLCall(733); }
+static void APIENTRY recording_glGetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, void *img) { recordGLCall(734); }
+static void APIENTRY recording_glGetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) { recordGLCall(735); }
+static void APIENTRY recording_glGetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint *params) { recordGLCall(736); }
+static void APIENTRY recording_glGetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint *params) { recordGLCall(737); }
+static void APIENTRY recording_glGetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) { recordGLCall(738); }
+static void APIENTRY recording_glFramebufferSampleLocationsfvARB(GLenum target, GLuint start, GLsizei count, const GLfloat *v) { recordGLCall(739); }
+static void APIENTRY recording_glNamedFramebufferSampleLocationsfvARB(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) { recordGLCall(740); }
+static void APIENTRY recording_glEvaluateDepthValuesARB(void) { recordGLCall(741); }
+static void APIENTRY recording_glMinSampleShadingARB(GLfloat value) { recordGLCall(742); }
+static void APIENTRY recording_glNamedStringARB(GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string) { recordGLCall(743); }
+static void APIENTRY recording_glDeleteNamedStringARB(GLint namelen, const GLchar *name) { recordGLCall(744); }
+static void APIENTRY recording_glCompileShaderIncludeARB(GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length) { recordGLCall(745); }
+static GLboolean APIENTRY recording_glIsNamedStringARB(GLint namelen, const GLchar *name) { recordGLCall(746); return {}; }
+static void APIENTRY recording_glGetNamedStringARB(GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string) { recordGLCall(747); }
+static void APIENTRY recording_glGetNamedStringivARB(GLint namelen, const GLchar *name, GLenum pname, GLint *params) { recordGLCall(748); }
+static void APIENTRY recording_glBufferPageCommitmentARB(GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit) { recordGLCall(749); }
+static void APIENTRY recording_glNamedBufferPageCommitmentEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit) { recordGLCall(750); }
+static void APIENTRY recording_glNamedBufferPageCommitmentARB(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit) { recordGLCall(751); }
+static void APIENTRY recording_glTexPageCommitmentARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit) { recordGLCall(752); }
+static void APIENTRY recording_glTexBufferARB(GLenum target, GLenum internalformat, GLuint buffer) { recordGLCall(753); }
+static void APIENTRY recording_glBlendBarrierKHR(void) { recordGLCall(754); }
+static void APIENTRY recording_glMaxShaderCompilerThreadsKHR(GLuint count) { recordGLCall(755); }
+static void APIENTRY recording_glRenderbufferStorageMultisampleAdvancedAMD(GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(756); }
+static void APIENTRY recording_glNamedRenderbufferStorageMultisampleAdvancedAMD(GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(757); }
+static void APIENTRY recording_glGetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize, GLuint *groups) { recordGLCall(758); }
+static void APIENTRY recording_glGetPerfMonitorCountersAMD(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters) { recordGLCall(759); }
+static void APIENTRY recording_glGetPerfMonitorGroupStringAMD(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString) { recordGLCall(760); }
+static void APIENTRY recording_glGetPerfMonitorCounterStringAMD(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString) { recordGLCall(761); }
+static void APIENTRY recording_glGetPerfMonitorCounterInfoAMD(GLuint group, GLuint counter, GLenum pname, void *data) { recordGLCall(762); }
+static void APIENTRY recording_glGenPerfMonitorsAMD(GLsizei n, GLuint *monitors) { recordGLCall(763); }
+static void APIENTRY recording_glDeletePerfMonitorsAMD(GLsizei n, GLuint *monitors) { recordGLCall(764); }
+static void APIENTRY recording_glSelectPerfMonitorCountersAMD(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList) { recordGLCall(765); }
+static void APIENTRY recording_glBeginPerfMonitorAMD(GLuint monitor) { recordGLCall(766); }
+static void APIENTRY recording_glEndPerfMonitorAMD(GLuint monitor) { recordGLCall(767); }
+static void APIENTRY recording_glGetPerfMonitorCounterDataAMD(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten) { recordGLCall(768); }
+static void APIENTRY recording_glEGLImageTargetTexStorageEXT(GLenum target, GLeglImageOES image, const GLint* attrib_list) { recordGLCall(769); }
+static void APIENTRY recording_glEGLImageTargetTextureStorageEXT(GLuint texture, GLeglImageOES image, const GLint* attrib_list) { recordGLCall(770); }
+static void APIENTRY recording_glLabelObjectEXT(GLenum type, GLuint object, GLsizei length, const GLchar *label) { recordGLCall(771); }
+static void APIENTRY recording_glGetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label) { recordGLCall(772); }
+static void APIENTRY recording_glInsertEventMarkerEXT(GLsizei length, const GLchar *marker) { recordGLCall(773); }
+static void APIENTRY recording_glPushGroupMarkerEXT(GLsizei length, const GLchar *marker) { recordGLCall(774); }
+static void APIENTRY recording_glPopGroupMarkerEXT(void) { recordGLCall(775); }
+static void APIENTRY recording_glMatrixLoadfEXT(GLenum mode, const GLfloat *m) { recordGLCall(776); }
+static void APIENTRY recording_glMatrixLoaddEXT(GLenum mode, const GLdouble *m) { recordGLCall(777); }
+static void APIENTRY recording_glMatrixMultfEXT(GLenum mode, const GLfloat *m) { recordGLCall(778); }
+static void APIENTRY recording_glMatrixMultdEXT(GLenum mode, const GLdouble *m) { recordGLCall(779); }
+static void APIENTRY recording_glMatrixLoadIdentityEXT(GLenum mode) { recordGLCall(780); }
+static void APIENTRY recording_glMatrixRotatefEXT(GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z) { recordGLCall(781); }
+static void APIENTRY recording_glMatrixRotatedEXT(GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(782); }
+static void APIENTRY recording_glMatrixScalefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) { recordGLCall(783); }
+static void APIENTRY recording_glMatrixScaledEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(784); }
+static void APIENTRY recording_glMatrixTranslatefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) { recordGLCall(785); }
+static void APIENTRY recording_glMatrixTranslatedEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(786); }
+static void APIENTRY recording_glMatrixFrustumEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { recordGLCall(787); }
+static void APIENTRY recording_glMatrixOrthoEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) { recordGLCall(788); }
+static void APIENTRY recording_glMatrixPopEXT(GLenum mode) { recordGLCall(789); }
+static void APIENTRY recording_glMatrixPushEXT(GLenum mode) { recordGLCall(790); }
+static void APIENTRY recording_glClientAttribDefaultEXT(GLbitfield mask) { recordGLCall(791); }
+static void APIENTRY recording_glPushClientAttribDefaultEXT(GLbitfield mask) { recordGLCall(792); }
+static void APIENTRY recording_glTextureParameterfEXT(GLuint texture, GLenum target, GLenum pname, GLfloat param) { recordGLCall(793); }
+static void APIENTRY recording_glTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, const GLfloat *params) { recordGLCall(794); }
+static void APIENTRY recording_glTextureParameteriEXT(GLuint texture, GLenum target, GLenum pname, GLint param) { recordGLCall(795); }
+static void APIENTRY recording_glTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params) { recordGLCall(796); }
+static void APIENTRY recording_glTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(797); }
+static void APIENTRY recording_glTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(798); }
+static void APIENTRY recording_glTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { recordGLCall(799); }
+static void APIENTRY recording_glTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { recordGLCall(800); }
+static void APIENTRY recording_glCopyTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { recordGLCall(801); }
+static void APIENTRY recording_glCopyTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { recordGLCall(802); }
+static void APIENTRY recording_glCopyTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { recordGLCall(803); }
+static void APIENTRY recording_glCopyTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(804); }
+static void APIENTRY recording_glGetTextureImageEXT(GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { recordGLCall(805); }
+static void APIENTRY recording_glGetTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, GLfloat *params) { recordGLCall(806); }
+static void APIENTRY recording_glGetTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, GLint *params) { recordGLCall(807); }
+static void APIENTRY recording_glGetTextureLevelParameterfvEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params) { recordGLCall(808); }
+static void APIENTRY recording_glGetTextureLevelParameterivEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params) { recordGLCall(809); }
+static void APIENTRY recording_glTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(810); }
+static void APIENTRY recording_glTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { recordGLCall(811); }
+static void APIENTRY recording_glCopyTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(812); }
+static void APIENTRY recording_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture) { recordGLCall(813); }
+static void APIENTRY recording_glMultiTexCoordPointerEXT(GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer) { recordGLCall(814); }
+static void APIENTRY recording_glMultiTexEnvfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param) { recordGLCall(815); }
+static void APIENTRY recording_glMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params) { recordGLCall(816); }
+static void APIENTRY recording_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLenum pname, GLint param) { recordGLCall(817); }
+static void APIENTRY recording_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) { recordGLCall(818); }
+static void APIENTRY recording_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble param) { recordGLCall(819); }
+static void APIENTRY recording_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params) { recordGLCall(820); }
+static void APIENTRY recording_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat param) { recordGLCall(821); }
+static void APIENTRY recording_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params) { recordGLCall(822); }
+static void APIENTRY recording_glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenum pname, GLint param) { recordGLCall(823); }
+static void APIENTRY recording_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, const GLint *params) { recordGLCall(824); }
+static void APIENTRY recording_glGetMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat *params) { recordGLCall(825); }
+static void APIENTRY recording_glGetMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) { recordGLCall(826); }
+static void APIENTRY recording_glGetMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble *params) { recordGLCall(827); }
+static void APIENTRY recording_glGetMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat *params) { recordGLCall(828); }
+static void APIENTRY recording_glGetMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, GLint *params) { recordGLCall(829); }
+static void APIENTRY recording_glMultiTexParameteriEXT(GLenum texunit, GLenum target, GLenum pname, GLint param) { recordGLCall(830); }
+static void APIENTRY recording_glMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) { recordGLCall(831); }
+static void APIENTRY recording_glMultiTexParameterfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param) { recordGLCall(832); }
+static void APIENTRY recording_glMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params) { recordGLCall(833); }
+static void APIENTRY recording_glMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(834); }
+static void APIENTRY recording_glMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(835); }
+static void APIENTRY recording_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { recordGLCall(836); }
+static void APIENTRY recording_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { recordGLCall(837); }
+static void APIENTRY recording_glCopyMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { recordGLCall(838); }
+static void APIENTRY recording_glCopyMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { recordGLCall(839); }
+static void APIENTRY recording_glCopyMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { recordGLCall(840); }
+static void APIENTRY recording_glCopyMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(841); }
+static void APIENTRY recording_glGetMultiTexImageEXT(GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { recordGLCall(842); }
+static void APIENTRY recording_glGetMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat *params) { recordGLCall(843); }
+static void APIENTRY recording_glGetMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) { recordGLCall(844); }
+static void APIENTRY recording_glGetMultiTexLevelParameterfvEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params) { recordGLCall(845); }
+static void APIENTRY recording_glGetMultiTexLevelParameterivEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params) { recordGLCall(846); }
+static void APIENTRY recording_glMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { recordGLCall(847); }
+static void APIENTRY recording_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { recordGLCall(848); }
+static void APIENTRY recording_glCopyMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(849); }
+static void APIENTRY recording_glEnableClientStateIndexedEXT(GLenum array, GLuint index) { recordGLCall(850); }
+static void APIENTRY recording_glDisableClientStateIndexedEXT(GLenum array, GLuint index) { recordGLCall(851); }
+static void APIENTRY recording_glGetFloatIndexedvEXT(GLenum target, GLuint index, GLfloat *data) { recordGLCall(852); }
+static void APIENTRY recording_glGetDoubleIndexedvEXT(GLenum target, GLuint index, GLdouble *data) { recordGLCall(853); }
+static void APIENTRY recording_glGetPointerIndexedvEXT(GLenum target, GLuint index, void **data) { recordGLCall(854); }
+static void APIENTRY recording_glEnableIndexedEXT(GLenum target, GLuint index) { recordGLCall(855); }
+static void APIENTRY recording_glDisableIndexedEXT(GLenum target, GLuint index) { recordGLCall(856); }
+static GLboolean APIENTRY recording_glIsEnabledIndexedEXT(GLenum target, GLuint index) { recordGLCall(857); return {}; }
+static void APIENTRY recording_glGetIntegerIndexedvEXT(GLenum target, GLuint index, GLint *data) { recordGLCall(858); }
+static void APIENTRY recording_glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean *data) { recordGLCall(859); }
+static void APIENTRY recording_glCompressedTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(860); }
+static void APIENTRY recording_glCompressedTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(861); }
+static void APIENTRY recording_glCompressedTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(862); }
+static void APIENTRY recording_glCompressedTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(863); }
+static void APIENTRY recording_glCompressedTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(864); }
+static void APIENTRY recording_glCompressedTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(865); }
+static void APIENTRY recording_glGetCompressedTextureImageEXT(GLuint texture, GLenum target, GLint lod, void *img) { recordGLCall(866); }
+static void APIENTRY recording_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(867); }
+static void APIENTRY recording_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(868); }
+static void APIENTRY recording_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits) { recordGLCall(869); }
+static void APIENTRY recording_glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(870); }
+static void APIENTRY recording_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(871); }
+static void APIENTRY recording_glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits) { recordGLCall(872); }
+static void APIENTRY recording_glGetCompressedMultiTexImageEXT(GLenum texunit, GLenum target, GLint lod, void *img) { recordGLCall(873); }
+static void APIENTRY recording_glMatrixLoadTransposefEXT(GLenum mode, const GLfloat *m) { recordGLCall(874); }
+static void APIENTRY recording_glMatrixLoadTransposedEXT(GLenum mode, const GLdouble *m) { recordGLCall(875); }
+static void APIENTRY recording_glMatrixMultTransposefEXT(GLenum mode, const GLfloat *m) { recordGLCall(876); }
+static void APIENTRY recording_glMatrixMultTransposedEXT(GLenum mode, const GLdouble *m) { recordGLCall(877); }
+static void APIENTRY recording_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) { recordGLCall(878); }
+static void APIENTRY recording_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) { recordGLCall(879); }
+static void * APIENTRY recording_glMapNamedBufferEXT(GLuint buffer, GLenum access) { recordGLCall(880); return {}; }
+static GLboolean APIENTRY recording_glUnmapNamedBufferEXT(GLuint buffer) { recordGLCall(881); return {}; }
+static void APIENTRY recording_glGetNamedBufferParameterivEXT(GLuint buffer, GLenum pname, GLint *params) { recordGLCall(882); }
+static void APIENTRY recording_glGetNamedBufferPointervEXT(GLuint buffer, GLenum pname, void **params) { recordGLCall(883); }
+static void APIENTRY recording_glGetNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) { recordGLCall(884); }
+static void APIENTRY recording_glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0) { recordGLCall(885); }
+static void APIENTRY recording_glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1) { recordGLCall(886); }
+static void APIENTRY recording_glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { recordGLCall(887); }
+static void APIENTRY recording_glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { recordGLCall(888); }
+static void APIENTRY recording_glProgramUniform1iEXT(GLuint program, GLint location, GLint v0) { recordGLCall(889); }
+static void APIENTRY recording_glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1) { recordGLCall(890); }
+static void APIENTRY recording_glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) { recordGLCall(891); }
+static void APIENTRY recording_glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { recordGLCall(892); }
+static void APIENTRY recording_glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(893); }
+static void APIENTRY recording_glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(894); }
+static void APIENTRY recording_glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(895); }
+static void APIENTRY recording_glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) { recordGLCall(896); }
+static void APIENTRY recording_glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(897); }
+static void APIENTRY recording_glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(898); }
+static void APIENTRY recording_glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(899); }
+static void APIENTRY recording_glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) { recordGLCall(900); }
+static void APIENTRY recording_glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(901); }
+static void APIENTRY recording_glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(902); }
+static void APIENTRY recording_glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(903); }
+static void APIENTRY recording_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(904); }
+static void APIENTRY recording_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(905); }
+static void APIENTRY recording_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(906); }
+static void APIENTRY recording_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(907); }
+static void APIENTRY recording_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(908); }
+static void APIENTRY recording_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { recordGLCall(909); }
+static void APIENTRY recording_glTextureBufferEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer) { recordGLCall(910); }
+static void APIENTRY recording_glMultiTexBufferEXT(GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer) { recordGLCall(911); }
+static void APIENTRY recording_glTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params) { recordGLCall(912); }
+static void APIENTRY recording_glTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, const GLuint *params) { recordGLCall(913); }
+static void APIENTRY recording_glGetTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, GLint *params) { recordGLCall(914); }
+static void APIENTRY recording_glGetTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, GLuint *params) { recordGLCall(915); }
+static void APIENTRY recording_glMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) { recordGLCall(916); }
+static void APIENTRY recording_glMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, const GLuint *params) { recordGLCall(917); }
+static void APIENTRY recording_glGetMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) { recordGLCall(918); }
+static void APIENTRY recording_glGetMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, GLuint *params) { recordGLCall(919); }
+static void APIENTRY recording_glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0) { recordGLCall(920); }
+static void APIENTRY recording_glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1) { recordGLCall(921); }
+static void APIENTRY recording_glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) { recordGLCall(922); }
+static void APIENTRY recording_glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { recordGLCall(923); }
+static void APIENTRY recording_glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(924); }
+static void APIENTRY recording_glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(925); }
+static void APIENTRY recording_glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(926); }
+static void APIENTRY recording_glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) { recordGLCall(927); }
+static void APIENTRY recording_glNamedProgramLocalParameters4fvEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params) { recordGLCall(928); }
+static void APIENTRY recording_glNamedProgramLocalParameterI4iEXT(GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w) { recordGLCall(929); }
+static void APIENTRY recording_glNamedProgramLocalParameterI4ivEXT(GLuint program, GLenum target, GLuint index, const GLint *params) { recordGLCall(930); }
+static void APIENTRY recording_glNamedProgramLocalParametersI4ivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params) { recordGLCall(931); }
+static void APIENTRY recording_glNamedProgramLocalParameterI4uiEXT(GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { recordGLCall(932); }
+static void APIENTRY recording_glNamedProgramLocalParameterI4uivEXT(GLuint program, GLenum target, GLuint index, const GLuint *params) { recordGLCall(933); }
+static void APIENTRY recording_glNamedProgramLocalParametersI4uivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params) { recordGLCall(934); }
+static void APIENTRY recording_glGetNamedProgramLocalParameterIivEXT(GLuint program, GLenum target, GLuint index, GLint *params) { recordGLCall(935); }
+static void APIENTRY recording_glGetNamedProgramLocalParameterIuivEXT(GLuint program, GLenum target, GLuint index, GLuint *params) { recordGLCall(936); }
+static void APIENTRY recording_glEnableClientStateiEXT(GLenum array, GLuint index) { recordGLCall(937); }
+static void APIENTRY recording_glDisableClientStateiEXT(GLenum array, GLuint index) { recordGLCall(938); }
+static void APIENTRY recording_glGetFloati_vEXT(GLenum pname, GLuint index, GLfloat *params) { recordGLCall(939); }
+static void APIENTRY recording_glGetDoublei_vEXT(GLenum pname, GLuint index, GLdouble *params) { recordGLCall(940); }
+static void APIENTRY recording_glGetPointeri_vEXT(GLenum pname, GLuint index, void **params) { recordGLCall(941); }
+static void APIENTRY recording_glNamedProgramStringEXT(GLuint program, GLenum target, GLenum format, GLsizei len, const void *string) { recordGLCall(942); }
+static void APIENTRY recording_glNamedProgramLocalParameter4dEXT(GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { recordGLCall(943); }
+static void APIENTRY recording_glNamedProgramLocalParameter4dvEXT(GLuint program, GLenum target, GLuint index, const GLdouble *params) { recordGLCall(944); }
+static void APIENTRY recording_glNamedProgramLocalParameter4fEXT(GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { recordGLCall(945); }
+static void APIENTRY recording_glNamedProgramLocalParameter4fvEXT(GLuint program, GLenum target, GLuint index, const GLfloat *params) { recordGLCall(946); }
+static void APIENTRY recording_glGetNamedProgramLocalParameterdvEXT(GLuint program, GLenum target, GLuint index, GLdouble *params) { recordGLCall(947); }
+static void APIENTRY recording_glGetNamedProgramLocalParameterfvEXT(GLuint program, GLenum target, GLuint index, GLfloat *params) { recordGLCall(948); }
+static void APIENTRY recording_glGetNamedProgramivEXT(GLuint program, GLenum target, GLenum pname, GLint *params) { recordGLCall(949); }
+static void APIENTRY recording_glGetNamedProgramStringEXT(GLuint program, GLenum target, GLenum pname, void *string) { recordGLCall(950); }
+static void APIENTRY recording_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(951); }
+static void APIENTRY recording_glGetNamedRenderbufferParameterivEXT(GLuint renderbuffer, GLenum pname, GLint *params) { recordGLCall(952); }
+static void APIENTRY recording_glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(953); }
+static void APIENTRY recording_glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(954); }
+static GLenum APIENTRY recording_glCheckNamedFramebufferStatusEXT(GLuint framebuffer, GLenum target) { recordGLCall(955); return {}; }
+static void APIENTRY recording_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { recordGLCall(956); }
+static void APIENTRY recording_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { recordGLCall(957); }
+static void APIENTRY recording_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { recordGLCall(958); }
+static void APIENTRY recording_glNamedFramebufferRenderbufferEXT(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { recordGLCall(959); }
+static void APIENTRY recording_glGetNamedFramebufferAttachmentParameterivEXT(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) { recordGLCall(960); }
+static void APIENTRY recording_glGenerateTextureMipmapEXT(GLuint texture, GLenum target) { recordGLCall(961); }
+static void APIENTRY recording_glGenerateMultiTexMipmapEXT(GLenum texunit, GLenum target) { recordGLCall(962); }
+static void APIENTRY recording_glFramebufferDrawBufferEXT(GLuint framebuffer, GLenum mode) { recordGLCall(963); }
+static void APIENTRY recording_glFramebufferDrawBuffersEXT(GLuint framebuffer, GLsizei n, const GLenum *bufs) { recordGLCall(964); }
+static void APIENTRY recording_glFramebufferReadBufferEXT(GLuint framebuffer, GLenum mode) { recordGLCall(965); }
+static void APIENTRY recording_glGetFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint *params) { recordGLCall(966); }
+static void APIENTRY recording_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { recordGLCall(967); }
+static void APIENTRY recording_glNamedFramebufferTextureEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) { recordGLCall(968); }
+static void APIENTRY recording_glNamedFramebufferTextureLayerEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) { recordGLCall(969); }
+static void APIENTRY recording_glNamedFramebufferTextureFaceEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face) { recordGLCall(970); }
+static void APIENTRY recording_glTextureRenderbufferEXT(GLuint texture, GLenum target, GLuint renderbuffer) { recordGLCall(971); }
+static void APIENTRY recording_glMultiTexRenderbufferEXT(GLenum texunit, GLenum target, GLuint renderbuffer) { recordGLCall(972); }
+static void APIENTRY recording_glVertexArrayVertexOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(973); }
+static void APIENTRY recording_glVertexArrayColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(974); }
+static void APIENTRY recording_glVertexArrayEdgeFlagOffsetEXT(GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset) { recordGLCall(975); }
+static void APIENTRY recording_glVertexArrayIndexOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(976); }
+static void APIENTRY recording_glVertexArrayNormalOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(977); }
+static void APIENTRY recording_glVertexArrayTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(978); }
+static void APIENTRY recording_glVertexArrayMultiTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(979); }
+static void APIENTRY recording_glVertexArrayFogCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(980); }
+static void APIENTRY recording_glVertexArraySecondaryColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(981); }
+static void APIENTRY recording_glVertexArrayVertexAttribOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset) { recordGLCall(982); }
+static void APIENTRY recording_glVertexArrayVertexAttribIOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(983); }
+static void APIENTRY recording_glEnableVertexArrayEXT(GLuint vaobj, GLenum array) { recordGLCall(984); }
+static void APIENTRY recording_glDisableVertexArrayEXT(GLuint vaobj, GLenum array) { recordGLCall(985); }
+static void APIENTRY recording_glEnableVertexArrayAttribEXT(GLuint vaobj, GLuint index) { recordGLCall(986); }
+static void APIENTRY recording_glDisableVertexArrayAttribEXT(GLuint vaobj, GLuint index) { recordGLCall(987); }
+static void APIENTRY recording_glGetVertexArrayIntegervEXT(GLuint vaobj, GLenum pname, GLint *param) { recordGLCall(988); }
+static void APIENTRY recording_glGetVertexArrayPointervEXT(GLuint vaobj, GLenum pname, void **param) { recordGLCall(989); }
+static void APIENTRY recording_glGetVertexArrayIntegeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, GLint *param) { recordGLCall(990); }
+static void APIENTRY recording_glGetVertexArrayPointeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, void **param) { recordGLCall(991); }
+static void * APIENTRY recording_glMapNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) { recordGLCall(992); return {}; }
+static void APIENTRY recording_glFlushMappedNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length) { recordGLCall(993); }
+static void APIENTRY recording_glNamedBufferStorageEXT(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) { recordGLCall(994); }
+static void APIENTRY recording_glClearNamedBufferDataEXT(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) { recordGLCall(995); }
+static void APIENTRY recording_glClearNamedBufferSubDataEXT(GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) { recordGLCall(996); }
+static void APIENTRY recording_glNamedFramebufferParameteriEXT(GLuint framebuffer, GLenum pname, GLint param) { recordGLCall(997); }
+static void APIENTRY recording_glGetNamedFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint *params) { recordGLCall(998); }
+static void APIENTRY recording_glProgramUniform1dEXT(GLuint program, GLint location, GLdouble x) { recordGLCall(999); }
+static void APIENTRY recording_glProgramUniform2dEXT(GLuint program, GLint location, GLdouble x, GLdouble y) { recordGLCall(1000); }
+static void APIENTRY recording_glProgramUniform3dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z) { recordGLCall(1001); }
+static void APIENTRY recording_glProgramUniform4dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { recordGLCall(1002); }
+static void APIENTRY recording_glProgramUniform1dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(1003); }
+static void APIENTRY recording_glProgramUniform2dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(1004); }
+static void APIENTRY recording_glProgramUniform3dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(1005); }
+static void APIENTRY recording_glProgramUniform4dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) { recordGLCall(1006); }
+static void APIENTRY recording_glProgramUniformMatrix2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1007); }
+static void APIENTRY recording_glProgramUniformMatrix3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1008); }
+static void APIENTRY recording_glProgramUniformMatrix4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1009); }
+static void APIENTRY recording_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1010); }
+static void APIENTRY recording_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1011); }
+static void APIENTRY recording_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1012); }
+static void APIENTRY recording_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1013); }
+static void APIENTRY recording_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1014); }
+static void APIENTRY recording_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) { recordGLCall(1015); }
+static void APIENTRY recording_glTextureBufferRangeEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) { recordGLCall(1016); }
+static void APIENTRY recording_glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) { recordGLCall(1017); }
+static void APIENTRY recording_glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(1018); }
+static void APIENTRY recording_glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) { recordGLCall(1019); }
+static void APIENTRY recording_glTextureStorage2DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { recordGLCall(1020); }
+static void APIENTRY recording_glTextureStorage3DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { recordGLCall(1021); }
+static void APIENTRY recording_glVertexArrayBindVertexBufferEXT(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) { recordGLCall(1022); }
+static void APIENTRY recording_glVertexArrayVertexAttribFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) { recordGLCall(1023); }
+static void APIENTRY recording_glVertexArrayVertexAttribIFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(1024); }
+static void APIENTRY recording_glVertexArrayVertexAttribLFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) { recordGLCall(1025); }
+static void APIENTRY recording_glVertexArrayVertexAttribBindingEXT(GLuint vaobj, GLuint attribindex, GLuint bindingindex) { recordGLCall(1026); }
+static void APIENTRY recording_glVertexArrayVertexBindingDivisorEXT(GLuint vaobj, GLuint bindingindex, GLuint divisor) { recordGLCall(1027); }
+static void APIENTRY recording_glVertexArrayVertexAttribLOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset) { recordGLCall(1028); }
+static void APIENTRY recording_glTexturePageCommitmentEXT(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit) { recordGLCall(1029); }
+static void APIENTRY recording_glVertexArrayVertexAttribDivisorEXT(GLuint vaobj, GLuint index, GLuint divisor) { recordGLCall(1030); }
+static void APIENTRY recording_glDrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count, GLsizei primcount) { recordGLCall(1031); }
+static void APIENTRY recording_glDrawElementsInstancedEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) { recordGLCall(1032); }
+static void APIENTRY recording_glPolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp) { recordGLCall(1033); }
+static void APIENTRY recording_glRasterSamplesEXT(GLuint samples, GLboolean fixedsamplelocations) { recordGLCall(1034); }
+static void APIENTRY recording_glUseShaderProgramEXT(GLenum type, GLuint program) { recordGLCall(1035); }
+static void APIENTRY recording_glActiveProgramEXT(GLuint program) { recordGLCall(1036); }
+static GLuint APIENTRY recording_glCreateShaderProgramEXT(GLenum type, const GLchar *string) { recordGLCall(1037); return {}; }
+static void APIENTRY recording_glFramebufferFetchBarrierEXT(void) { recordGLCall(1038); }
+static void APIENTRY recording_glWindowRectanglesEXT(GLenum mode, GLsizei count, const GLint *box) { recordGLCall(1039); }
+static void APIENTRY recording_glApplyFramebufferAttachmentCMAAINTEL(void) { recordGLCall(1040); }
+static void APIENTRY recording_glBeginPerfQueryINTEL(GLuint queryHandle) { recordGLCall(1041); }
+static void APIENTRY recording_glCreatePerfQueryINTEL(GLuint queryId, GLuint *queryHandle) { recordGLCall(1042); }
+static void APIENTRY recording_glDeletePerfQueryINTEL(GLuint queryHandle) { recordGLCall(1043); }
+static void APIENTRY recording_glEndPerfQueryINTEL(GLuint queryHandle) { recordGLCall(1044); }
+static void APIENTRY recording_glGetFirstPerfQueryIdINTEL(GLuint *queryId) { recordGLCall(1045); }
+static void APIENTRY recording_glGetNextPerfQueryIdINTEL(GLuint queryId, GLuint *nextQueryId) { recordGLCall(1046); }
+static void APIENTRY recording_glGetPerfCounterInfoINTEL(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue) { recordGLCall(1047); }
+static void APIENTRY recording_glGetPerfQueryDataINTEL(GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten) { recordGLCall(1048); }
+static void APIENTRY recording_glGetPerfQueryIdByNameINTEL(GLchar *queryName, GLuint *queryId) { recordGLCall(1049); }
+static void APIENTRY recording_glGetPerfQueryInfoINTEL(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask) { recordGLCall(1050); }
+static void APIENTRY recording_glMultiDrawArraysIndirectBindlessNV(GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount) { recordGLCall(1051); }
+static void APIENTRY recording_glMultiDrawElementsIndirectBindlessNV(GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount) { recordGLCall(1052); }
+static void APIENTRY recording_glMultiDrawArraysIndirectBindlessCountNV(GLenum mode, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount) { recordGLCall(1053); }
+static void APIENTRY recording_glMultiDrawElementsIndirectBindlessCountNV(GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount) { recordGLCall(1054); }
+static GLuint64 APIENTRY recording_glGetTextureHandleNV(GLuint texture) { recordGLCall(1055); return {}; }
+static GLuint64 APIENTRY recording_glGetTextureSamplerHandleNV(GLuint texture, GLuint sampler) { recordGLCall(1056); return {}; }
+static void APIENTRY recording_glMakeTextureHandleResidentNV(GLuint64 handle) { recordGLCall(1057); }
+static void APIENTRY recording_glMakeTextureHandleNonResidentNV(GLuint64 handle) { recordGLCall(1058); }
+static GLuint64 APIENTRY recording_glGetImageHandleNV(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format) { recordGLCall(1059); return {}; }
+static void APIENTRY recording_glMakeImageHandleResidentNV(GLuint64 handle, GLenum access) { recordGLCall(1060); }
+static void APIENTRY recording_glMakeImageHandleNonResidentNV(GLuint64 handle) { recordGLCall(1061); }
+static void APIENTRY recording_glUniformHandleui64NV(GLint location, GLuint64 value) { recordGLCall(1062); }
+static void APIENTRY recording_glUniformHandleui64vNV(GLint location, GLsizei count, const GLuint64 *value) { recordGLCall(1063); }
+static void APIENTRY recording_glProgramUniformHandleui64NV(GLuint program, GLint location, GLuint64 value) { recordGLCall(1064); }
+static void APIENTRY recording_glProgramUniformHandleui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64 *values) { recordGLCall(1065); }
+static GLboolean APIENTRY recording_glIsTextureHandleResidentNV(GLuint64 handle) { recordGLCall(1066); return {}; }
+static GLboolean APIENTRY recording_glIsImageHandleResidentNV(GLuint64 handle) { recordGLCall(1067); return {}; }
+static void APIENTRY recording_glBlendParameteriNV(GLenum pname, GLint value) { recordGLCall(1068); }
+static void APIENTRY recording_glBlendBarrierNV(void) { recordGLCall(1069); }
+static void APIENTRY recording_glViewportPositionWScaleNV(GLuint index, GLfloat xcoeff, GLfloat ycoeff) { recordGLCall(1070); }
+static void APIENTRY recording_glCreateStatesNV(GLsizei n, GLuint *states) { recordGLCall(1071); }
+static void APIENTRY recording_glDeleteStatesNV(GLsizei n, const GLuint *states) { recordGLCall(1072); }
+static GLboolean APIENTRY recording_glIsStateNV(GLuint state) { recordGLCall(1073); return {}; }
+static void APIENTRY recording_glStateCaptureNV(GLuint state, GLenum mode) { recordGLCall(1074); }
+static GLuint APIENTRY recording_glGetCommandHeaderNV(GLenum tokenID, GLuint size) { recordGLCall(1075); return {}; }
+static GLushort APIENTRY recording_glGetStageIndexNV(GLenum shadertype) { recordGLCall(1076); return {}; }
+static void APIENTRY recording_glDrawCommandsNV(GLenum primitiveMode, GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, GLuint count) { recordGLCall(1077); }
+static void APIENTRY recording_glDrawCommandsAddressNV(GLenum primitiveMode, const GLuint64 *indirects, const GLsizei *sizes, GLuint count) { recordGLCall(1078); }
+static void APIENTRY recording_glDrawCommandsStatesNV(GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) { recordGLCall(1079); }
+static void APIENTRY recording_glDrawCommandsStatesAddressNV(const GLuint64 *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) { recordGLCall(1080); }
+static void APIENTRY recording_glCreateCommandListsNV(GLsizei n, GLuint *lists) { recordGLCall(1081); }
+static void APIENTRY recording_glDeleteCommandListsNV(GLsizei n, const GLuint *lists) { recordGLCall(1082); }
+static GLboolean APIENTRY recording_glIsCommandListNV(GLuint list) { recordGLCall(1083); return {}; }
+static void APIENTRY recording_glListDrawCommandsStatesClientNV(GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) { recordGLCall(1084); }
+static void APIENTRY recording_glCommandListSegmentsNV(GLuint list, GLuint segments) { recordGLCall(1085); }
+static void APIENTRY recording_glCompileCommandListNV(GLuint list) { recordGLCall(1086); }
+static void APIENTRY recording_glCallCommandListNV(GLuint list) { recordGLCall(1087); }
+static void APIENTRY recording_glBeginConditionalRenderNV(GLuint id, GLenum mode) { recordGLCall(1088); }
+static void APIENTRY recording_glEndConditionalRenderNV(void) { recordGLCall(1089); }
+static void APIENTRY recording_glSubpixelPrecisionBiasNV(GLuint xbits, GLuint ybits) { recordGLCall(1090); }
+static void APIENTRY recording_glConservativeRasterParameterfNV(GLenum pname, GLfloat value) { recordGLCall(1091); }
+static void APIENTRY recording_glConservativeRasterParameteriNV(GLenum pname, GLint param) { recordGLCall(1092); }
+static void APIENTRY recording_glDrawVkImageNV(GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1) { recordGLCall(1093); }
+static GLVULKANPROCNV APIENTRY recording_glGetVkProcAddrNV(const GLchar *name) { recordGLCall(1094); return {}; }
+static void APIENTRY recording_glWaitVkSemaphoreNV(GLuint64 vkSemaphore) { recordGLCall(1095); }
+static void APIENTRY recording_glSignalVkSemaphoreNV(GLuint64 vkSemaphore) { recordGLCall(1096); }
+static void APIENTRY recording_glSignalVkFenceNV(GLuint64 vkFence) { recordGLCall(1097); }
+static void APIENTRY recording_glFragmentCoverageColorNV(GLuint color) { recordGLCall(1098); }
+static void APIENTRY recording_glCoverageModulationTableNV(GLsizei n, const GLfloat *v) { recordGLCall(1099); }
+static void APIENTRY recording_glGetCoverageModulationTableNV(GLsizei bufsize, GLfloat *v) { recordGLCall(1100); }
+static void APIENTRY recording_glCoverageModulationNV(GLenum components) { recordGLCall(1101); }
+static void APIENTRY recording_glRenderbufferStorageMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height) { recordGLCall(1102); }
+static void APIENTRY recording_glUniform1i64NV(GLint location, GLint64EXT x) { recordGLCall(1103); }
+static void APIENTRY recording_glUniform2i64NV(GLint location, GLint64EXT x, GLint64EXT y) { recordGLCall(1104); }
+static void APIENTRY recording_glUniform3i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) { recordGLCall(1105); }
+static void APIENTRY recording_glUniform4i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) { recordGLCall(1106); }
+static void APIENTRY recording_glUniform1i64vNV(GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1107); }
+static void APIENTRY recording_glUniform2i64vNV(GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1108); }
+static void APIENTRY recording_glUniform3i64vNV(GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1109); }
+static void APIENTRY recording_glUniform4i64vNV(GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1110); }
+static void APIENTRY recording_glUniform1ui64NV(GLint location, GLuint64EXT x) { recordGLCall(1111); }
+static void APIENTRY recording_glUniform2ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y) { recordGLCall(1112); }
+static void APIENTRY recording_glUniform3ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) { recordGLCall(1113); }
+static void APIENTRY recording_glUniform4ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) { recordGLCall(1114); }
+static void APIENTRY recording_glUniform1ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1115); }
+static void APIENTRY recording_glUniform2ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1116); }
+static void APIENTRY recording_glUniform3ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1117); }
+static void APIENTRY recording_glUniform4ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1118); }
+static void APIENTRY recording_glGetUniformi64vNV(GLuint program, GLint location, GLint64EXT *params) { recordGLCall(1119); }
+static void APIENTRY recording_glProgramUniform1i64NV(GLuint program, GLint location, GLint64EXT x) { recordGLCall(1120); }
+static void APIENTRY recording_glProgramUniform2i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y) { recordGLCall(1121); }
+static void APIENTRY recording_glProgramUniform3i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) { recordGLCall(1122); }
+static void APIENTRY recording_glProgramUniform4i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) { recordGLCall(1123); }
+static void APIENTRY recording_glProgramUniform1i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1124); }
+static void APIENTRY recording_glProgramUniform2i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1125); }
+static void APIENTRY recording_glProgramUniform3i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1126); }
+static void APIENTRY recording_glProgramUniform4i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) { recordGLCall(1127); }
+static void APIENTRY recording_glProgramUniform1ui64NV(GLuint program, GLint location, GLuint64EXT x) { recordGLCall(1128); }
+static void APIENTRY recording_glProgramUniform2ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y) { recordGLCall(1129); }
+static void APIENTRY recording_glProgramUniform3ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) { recordGLCall(1130); }
+static void APIENTRY recording_glProgramUniform4ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) { recordGLCall(1131); }
+static void APIENTRY recording_glProgramUniform1ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1132); }
+static void APIENTRY recording_glProgramUniform2ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1133); }
+static void APIENTRY recording_glProgramUniform3ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1134); }
+static void APIENTRY recording_glProgramUniform4ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1135); }
+static void APIENTRY recording_glGetInternalformatSampleivNV(GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei bufSize, GLint *params) { recordGLCall(1136); }
+static void APIENTRY recording_glGetMemoryObjectDetachedResourcesuivNV(GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params) { recordGLCall(1137); }
+static void APIENTRY recording_glResetMemoryObjectParameterNV(GLuint memory, GLenum pname) { recordGLCall(1138); }
+static void APIENTRY recording_glTexAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset) { recordGLCall(1139); }
+static void APIENTRY recording_glBufferAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset) { recordGLCall(1140); }
+static void APIENTRY recording_glTextureAttachMemoryNV(GLuint texture, GLuint memory, GLuint64 offset) { recordGLCall(1141); }
+static void APIENTRY recording_glNamedBufferAttachMemoryNV(GLuint buffer, GLuint memory, GLuint64 offset) { recordGLCall(1142); }
+static void APIENTRY recording_glDrawMeshTasksNV(GLuint first, GLuint count) { recordGLCall(1143); }
+static void APIENTRY recording_glDrawMeshTasksIndirectNV(GLintptr indirect) { recordGLCall(1144); }
+static void APIENTRY recording_glMultiDrawMeshTasksIndirectNV(GLintptr indirect, GLsizei drawcount, GLsizei stride) { recordGLCall(1145); }
+static void APIENTRY recording_glMultiDrawMeshTasksIndirectCountNV(GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) { recordGLCall(1146); }
+static GLuint APIENTRY recording_glGenPathsNV(GLsizei range) { recordGLCall(1147); return {}; }
+static void APIENTRY recording_glDeletePathsNV(GLuint path, GLsizei range) { recordGLCall(1148); }
+static GLboolean APIENTRY recording_glIsPathNV(GLuint path) { recordGLCall(1149); return {}; }
+static void APIENTRY recording_glPathCommandsNV(GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) { recordGLCall(1150); }
+static void APIENTRY recording_glPathCoordsNV(GLuint path, GLsizei numCoords, GLenum coordType, const void *coords) { recordGLCall(1151); }
+static void APIENTRY recording_glPathSubCommandsNV(GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) { recordGLCall(1152); }
+static void APIENTRY recording_glPathSubCoordsNV(GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords) { recordGLCall(1153); }
+static void APIENTRY recording_glPathStringNV(GLuint path, GLenum format, GLsizei length, const void *pathString) { recordGLCall(1154); }
+static void APIENTRY recording_glPathGlyphsNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) { recordGLCall(1155); }
+static void APIENTRY recording_glPathGlyphRangeNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) { recordGLCall(1156); }
+static void APIENTRY recording_glWeightPathsNV(GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights) { recordGLCall(1157); }
+static void APIENTRY recording_glCopyPathNV(GLuint resultPath, GLuint srcPath) { recordGLCall(1158); }
+static void APIENTRY recording_glInterpolatePathsNV(GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight) { recordGLCall(1159); }
+static void APIENTRY recording_glTransformPathNV(GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1160); }
+static void APIENTRY recording_glPathParameterivNV(GLuint path, GLenum pname, const GLint *value) { recordGLCall(1161); }
+static void APIENTRY recording_glPathParameteriNV(GLuint path, GLenum pname, GLint value) { recordGLCall(1162); }
+static void APIENTRY recording_glPathParameterfvNV(GLuint path, GLenum pname, const GLfloat *value) { recordGLCall(1163); }
+static void APIENTRY recording_glPathParameterfNV(GLuint path, GLenum pname, GLfloat value) { recordGLCall(1164); }
+static void APIENTRY recording_glPathDashArrayNV(GLuint path, GLsizei dashCount, const GLfloat *dashArray) { recordGLCall(1165); }
+static void APIENTRY recording_glPathStencilFuncNV(GLenum func, GLint ref, GLuint mask) { recordGLCall(1166); }
+static void APIENTRY recording_glPathStencilDepthOffsetNV(GLfloat factor, GLfloat units) { recordGLCall(1167); }
+static void APIENTRY recording_glStencilFillPathNV(GLuint path, GLenum fillMode, GLuint mask) { recordGLCall(1168); }
+static void APIENTRY recording_glStencilStrokePathNV(GLuint path, GLint reference, GLuint mask) { recordGLCall(1169); }
+static void APIENTRY recording_glStencilFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1170); }
+static void APIENTRY recording_glStencilStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1171); }
+static void APIENTRY recording_glPathCoverDepthFuncNV(GLenum func) { recordGLCall(1172); }
+static void APIENTRY recording_glCoverFillPathNV(GLuint path, GLenum coverMode) { recordGLCall(1173); }
+static void APIENTRY recording_glCoverStrokePathNV(GLuint path, GLenum coverMode) { recordGLCall(1174); }
+static void APIENTRY recording_glCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1175); }
+static void APIENTRY recording_glCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1176); }
+static void APIENTRY recording_glGetPathParameterivNV(GLuint path, GLenum pname, GLint *value) { recordGLCall(1177); }
+static void APIENTRY recording_glGetPathParameterfvNV(GLuint path, GLenum pname, GLfloat *value) { recordGLCall(1178); }
+static void APIENTRY recording_glGetPathCommandsNV(GLuint path, GLubyte *commands) { recordGLCall(1179); }
+static void APIENTRY recording_glGetPathCoordsNV(GLuint path, GLfloat *coords) { recordGLCall(1180); }
+static void APIENTRY recording_glGetPathDashArrayNV(GLuint path, GLfloat *dashArray) { recordGLCall(1181); }
+static void APIENTRY recording_glGetPathMetricsNV(GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics) { recordGLCall(1182); }
+static void APIENTRY recording_glGetPathMetricRangeNV(GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics) { recordGLCall(1183); }
+static void APIENTRY recording_glGetPathSpacingNV(GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing) { recordGLCall(1184); }
+static GLboolean APIENTRY recording_glIsPointInFillPathNV(GLuint path, GLuint mask, GLfloat x, GLfloat y) { recordGLCall(1185); return {}; }
+static GLboolean APIENTRY recording_glIsPointInStrokePathNV(GLuint path, GLfloat x, GLfloat y) { recordGLCall(1186); return {}; }
+static GLfloat APIENTRY recording_glGetPathLengthNV(GLuint path, GLsizei startSegment, GLsizei numSegments) { recordGLCall(1187); return {}; }
+static GLboolean APIENTRY recording_glPointAlongPathNV(GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY) { recordGLCall(1188); return {}; }
+static void APIENTRY recording_glMatrixLoad3x2fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1189); }
+static void APIENTRY recording_glMatrixLoad3x3fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1190); }
+static void APIENTRY recording_glMatrixLoadTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1191); }
+static void APIENTRY recording_glMatrixMult3x2fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1192); }
+static void APIENTRY recording_glMatrixMult3x3fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1193); }
+static void APIENTRY recording_glMatrixMultTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) { recordGLCall(1194); }
+static void APIENTRY recording_glStencilThenCoverFillPathNV(GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode) { recordGLCall(1195); }
+static void APIENTRY recording_glStencilThenCoverStrokePathNV(GLuint path, GLint reference, GLuint mask, GLenum coverMode) { recordGLCall(1196); }
+static void APIENTRY recording_glStencilThenCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1197); }
+static void APIENTRY recording_glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) { recordGLCall(1198); }
+static GLenum APIENTRY recording_glPathGlyphIndexRangeNV(GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount[2]) { recordGLCall(1199); return {}; }
+static GLenum APIENTRY recording_glPathGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) { recordGLCall(1200); return {}; }
+static GLenum APIENTRY recording_glPathMemoryGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) { recordGLCall(1201); return {}; }
+static void APIENTRY recording_glProgramPathFragmentInputGenNV(GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs) { recordGLCall(1202); }
+static void APIENTRY recording_glGetProgramResourcefvNV(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLfloat *params) { recordGLCall(1203); }
+static void APIENTRY recording_glFramebufferSampleLocationsfvNV(GLenum target, GLuint start, GLsizei count, const GLfloat *v) { recordGLCall(1204); }
+static void APIENTRY recording_glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) { recordGLCall(1205); }
+static void APIENTRY recording_glResolveDepthValuesNV(void) { recordGLCall(1206); }
+static void APIENTRY recording_glScissorExclusiveNV(GLint x, GLint y, GLsizei width, GLsizei height) { recordGLCall(1207); }
+static void APIENTRY recording_glScissorExclusiveArrayvNV(GLuint first, GLsizei count, const GLint *v) { recordGLCall(1208); }
+static void APIENTRY recording_glMakeBufferResidentNV(GLenum target, GLenum access) { recordGLCall(1209); }
+static void APIENTRY recording_glMakeBufferNonResidentNV(GLenum target) { recordGLCall(1210); }
+static GLboolean APIENTRY recording_glIsBufferResidentNV(GLenum target) { recordGLCall(1211); return {}; }
+static void APIENTRY recording_glMakeNamedBufferResidentNV(GLuint buffer, GLenum access) { recordGLCall(1212); }
+static void APIENTRY recording_glMakeNamedBufferNonResidentNV(GLuint buffer) { recordGLCall(1213); }
+static GLboolean APIENTRY recording_glIsNamedBufferResidentNV(GLuint buffer) { recordGLCall(1214); return {}; }
+static void APIENTRY recording_glGetBufferParameterui64vNV(GLenum target, GLenum pname, GLuint64EXT *params) { recordGLCall(1215); }
+static void APIENTRY recording_glGetNamedBufferParameterui64vNV(GLuint buffer, GLenum pname, GLuint64EXT *params) { recordGLCall(1216); }
+static void APIENTRY recording_glGetIntegerui64vNV(GLenum value, GLuint64EXT *result) { recordGLCall(1217); }
+static void APIENTRY recording_glUniformui64NV(GLint location, GLuint64EXT value) { recordGLCall(1218); }
+static void APIENTRY recording_glUniformui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1219); }
+static void APIENTRY recording_glGetUniformui64vNV(GLuint program, GLint location, GLuint64EXT *params) { recordGLCall(1220); }
+static void APIENTRY recording_glProgramUniformui64NV(GLuint program, GLint location, GLuint64EXT value) { recordGLCall(1221); }
+static void APIENTRY recording_glProgramUniformui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) { recordGLCall(1222); }
+static void APIENTRY recording_glBindShadingRateImageNV(GLuint texture) { recordGLCall(1223); }
+static void APIENTRY recording_glGetShadingRateImagePaletteNV(GLuint viewport, GLuint entry, GLenum *rate) { recordGLCall(1224); }
+static void APIENTRY recording_glGetShadingRateSampleLocationivNV(GLenum rate, GLuint samples, GLuint index, GLint *location) { recordGLCall(1225); }
+static void APIENTRY recording_glShadingRateImageBarrierNV(GLboolean synchronize) { recordGLCall(1226); }
+static void APIENTRY recording_glShadingRateImagePaletteNV(GLuint viewport, GLuint first, GLsizei count, const GLenum *rates) { recordGLCall(1227); }
+static void APIENTRY recording_glShadingRateSampleOrderNV(GLenum order) { recordGLCall(1228); }
+static void APIENTRY recording_glShadingRateSampleOrderCustomNV(GLenum rate, GLuint samples, const GLint *locations) { recordGLCall(1229); }
+static void APIENTRY recording_glTextureBarrierNV(void) { recordGLCall(1230); }
+static void APIENTRY recording_glVertexAttribL1i64NV(GLuint index, GLint64EXT x) { recordGLCall(1231); }
+static void APIENTRY recording_glVertexAttribL2i64NV(GLuint index, GLint64EXT x, GLint64EXT y) { recordGLCall(1232); }
+static void APIENTRY recording_glVertexAttribL3i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z) { recordGLCall(1233); }
+static void APIENTRY recording_glVertexAttribL4i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) { recordGLCall(1234); }
+static void APIENTRY recording_glVertexAttribL1i64vNV(GLuint index, const GLint64EXT *v) { recordGLCall(1235); }
+static void APIENTRY recording_glVertexAttribL2i64vNV(GLuint index, const GLint64EXT *v) { recordGLCall(1236); }
+static void APIENTRY recording_glVertexAttribL3i64vNV(GLuint index, const GLint64EXT *v) { recordGLCall(1237); }
+static void APIENTRY recording_glVertexAttribL4i64vNV(GLuint index, const GLint64EXT *v) { recordGLCall(1238); }
+static void APIENTRY recording_glVertexAttribL1ui64NV(GLuint index, GLuint64EXT x) { recordGLCall(1239); }
+static void APIENTRY recording_glVertexAttribL2ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y) { recordGLCall(1240); }
+static void APIENTRY recording_glVertexAttribL3ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) { recordGLCall(1241); }
+static void APIENTRY recording_glVertexAttribL4ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) { recordGLCall(1242); }
+static void APIENTRY recording_glVertexAttribL1ui64vNV(GLuint index, const GLuint64EXT *v) { recordGLCall(1243); }
+static void APIENTRY recording_glVertexAttribL2ui64vNV(GLuint index, const GLuint64EXT *v) { recordGLCall(1244); }
+static void APIENTRY recording_glVertexAttribL3ui64vNV(GLuint index, const GLuint64EXT *v) { recordGLCall(1245); }
+static void APIENTRY recording_glVertexAttribL4ui64vNV(GLuint index, const GLuint64EXT *v) { recordGLCall(1246); }
+static void APIENTRY recording_glGetVertexAttribLi64vNV(GLuint index, GLenum pname, GLint64EXT *params) { recordGLCall(1247); }
+static void APIENTRY recording_glGetVertexAttribLui64vNV(GLuint index, GLenum pname, GLuint64EXT *params) { recordGLCall(1248); }
+static void APIENTRY recording_glVertexAttribLFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride) { recordGLCall(1249); }
+static void APIENTRY recording_glBufferAddressRangeNV(GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length) { recordGLCall(1250); }
+static void APIENTRY recording_glVertexFormatNV(GLint size, GLenum type, GLsizei stride) { recordGLCall(1251); }
+static void APIENTRY recording_glNormalFormatNV(GLenum type, GLsizei stride) { recordGLCall(1252); }
+static void APIENTRY recording_glColorFormatNV(GLint size, GLenum type, GLsizei stride) { recordGLCall(1253); }
+static void APIENTRY recording_glIndexFormatNV(GLenum type, GLsizei stride) { recordGLCall(1254); }
+static void APIENTRY recording_glTexCoordFormatNV(GLint size, GLenum type, GLsizei stride) { recordGLCall(1255); }
+static void APIENTRY recording_glEdgeFlagFormatNV(GLsizei stride) { recordGLCall(1256); }
+static void APIENTRY recording_glSecondaryColorFormatNV(GLint size, GLenum type, GLsizei stride) { recordGLCall(1257); }
+static void APIENTRY recording_glFogCoordFormatNV(GLenum type, GLsizei stride) { recordGLCall(1258); }
+static void APIENTRY recording_glVertexAttribFormatNV(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride) { recordGLCall(1259); }
+static void APIENTRY recording_glVertexAttribIFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride) { recordGLCall(1260); }
+static void APIENTRY recording_glGetIntegerui64i_vNV(GLenum value, GLuint index, GLuint64EXT *result) { recordGLCall(1261); }
+static void APIENTRY recording_glViewportSwizzleNV(GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew) { recordGLCall(1262); }
+static void APIENTRY recording_glFramebufferTextureMultiviewOVR(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews) { recordGLCall(1263); }
+
+static const RecordingGLProc RECORDING_GL_PROCS[] = {
+	{ "glCullFace", (void**)&gl3wCullFace, (void*)recording_glCullFace },
+	{ "glFrontFace", (void**)&gl3wFrontFace, (void*)recording_glFrontFace },
+	{ "glHint", (void**)&gl3wHint, (void*)recording_glHint },
+	{ "glLineWidth", (void**)&gl3wLineWidth, (void*)recording_glLineWidth },
+	{ "glPointSize", (void**)&gl3wPointSize, (void*)recording_glPointSize },
+	{ "glPolygonMode", (void**)&gl3wPolygonMode, (void*)recording_glPolygonMode },
+	{ "glScissor", (void**)&gl3wScissor, (void*)recording_glScissor },
+	{ "glTexParameterf", (void**)&gl3wTexParameterf, (void*)recording_glTexParameterf },
+	{ "glTexParameterfv", (void**)&gl3wTexParameterfv, (void*)recording_glTexParameterfv },
+	{ "glTexParameteri", (void**)&gl3wTexParameteri, (void*)recording_glTexParameteri },
+	{ "glTexParameteriv", (void**)&gl3wTexParameteriv, (void*)recording_glTexParameteriv },
+	{ "glTexImage1D", (void**)&gl3wTexImage1D, (void*)recording_glTexImage1D },
+	{ "glTexImage2D", (void**)&gl3wTexImage2D, (void*)recording_glTexImage2D },
+	{ "glDrawBuffer", (void**)&gl3wDrawBuffer, (void*)recording_glDrawBuffer },
+	{ "glClear", (void**)&gl3wClear, (void*)recording_glClear },
+	{ "glClearColor", (void**)&gl3wClearColor, (void*)recording_glClearColor },
+	{ "glClearStencil", (void**)&gl3wClearStencil, (void*)recording_glClearStencil },
+	{ "glClearDepth", (void**)&gl3wClearDepth, (void*)recording_glClearDepth },
+	{ "glStencilMask", (void**)&gl3wStencilMask, (void*)recording_glStencilMask },
+	{ "glColorMask", (void**)&gl3wColorMask, (void*)recording_glColorMask },
+	{ "glDepthMask", (void**)&gl3wDepthMask, (void*)recording_glDepthMask },
+	{ "glDisable", (void**)&gl3wDisable, (void*)recording_glDisable },
+	{ "glEnable", (void**)&gl3wEnable, (void*)recording_glEnable },
+	{ "glFinish", (void**)&gl3wFinish, (void*)recording_glFinish },
+	{ "glFlush", (void**)&gl3wFlush, (void*)recording_glFlush },
+	{ "glBlendFunc", (void**)&gl3wBlendFunc, (void*)recording_glBlendFunc },
+	{ "glLogicOp", (void**)&gl3wLogicOp, (void*)recording_glLogicOp },
+	{ "glStencilFunc", (void**)&gl3wStencilFunc, (void*)recording_glStencilFunc },
+	{ "glStencilOp", (void**)&gl3wStencilOp, (void*)recording_glStencilOp },
+	{ "glDepthFunc", (void**)&gl3wDepthFunc, (void*)recording_glDepthFunc },
+	{ "glPixelStoref", (void**)&gl3wPixelStoref, (void*)recording_glPixelStoref },
+	{ "glPixelStorei", (void**)&gl3wPixelStorei, (void*)recording_glPixelStorei },
+	{ "glReadBuffer", (void**)&gl3wReadBuffer, (void*)recording_glReadBuffer },
+	{ "glReadPixels", (void**)&gl3wReadPixels, (void*)recording_glReadPixels },
+	{ "glGetBooleanv", (void**)&gl3wGetBooleanv, (void*)recording_glGetBooleanv },
+	{ "glGetDoublev", (void**)&gl3wGetDoublev, (void*)recording_glGetDoublev },
+	{ "glGetError", (void**)&gl3wGetError, (void*)recording_glGetError },
+	{ "glGetFloatv", (void**)&gl3wGetFloatv, (void*)recording_glGetFloatv },
+	{ "glGetIntegerv", (void**)&gl3wGetIntegerv, (void*)recording_glGetIntegerv },
+	{ "glGetString", (void**)&gl3wGetString, (void*)recording_glGetString },
+	{ "glGetTexImage", (void**)&gl3wGetTexImage, (void*)recording_glGetTexImage },
+	{ "glGetTexParameterfv", (void**)&gl3wGetTexParameterfv, (void*)recording_glGetTexParameterfv },
+	{ "glGetTexParameteriv", (void**)&gl3wGetTexParameteriv, (void*)recording_glGetTexParameteriv },
+	{ "glGetTexLevelParameterfv", (void**)&gl3wGetTexLevelParameterfv, (void*)recording_glGetTexLevelParameterfv },
+	{ "glGetTexLevelParameteriv", (void**)&gl3wGetTexLevelParameteriv, (void*)recording_glGetTexLevelParameteriv },
+	{ "glIsEnabled", (void**)&gl3wIsEnabled, (void*)recording_glIsEnabled },
+	{ "glDepthRange", (void**)&gl3wDepthRange, (void*)recording_glDepthRange },
+	{ "glViewport", (void**)&gl3wViewport, (void*)recording_glViewport },
+	{ "glDrawArrays", (void**)&gl3wDrawArrays, (void*)recording_glDrawArrays },
+	{ "glDrawElements", (void**)&gl3wDrawElements, (void*)recording_glDrawElements },
+	{ "glGetPointerv", (void**)&gl3wGetPointerv, (void*)recording_glGetPointerv },
+	{ "glPolygonOffset", (void**)&gl3wPolygonOffset, (void*)recording_glPolygonOffset },
+	{ "glCopyTexImage1D", (void**)&gl3wCopyTexImage1D, (void*)recording_glCopyTexImage1D },
+	{ "glCopyTexImage2D", (void**)&gl3wCopyTexImage2D, (void*)recording_glCopyTexImage2D },
+	{ "glCopyTexSubImage1D", (void**)&gl3wCopyTexSubImage1D, (void*)recording_glCopyTexSubImage1D },
+	{ "glCopyTexSubImage2D", (void**)&gl3wCopyTexSubImage2D, (void*)recording_glCopyTexSubImage2D },
+	{ "glTexSubImage1D", (void**)&gl3wTexSubImage1D, (void*)recording_glTexSubImage1D },
+	{ "glTexSubImage2D", (void**)&gl3wTexSubImage2D, (void*)recording_glTexSubImage2D },
+	{ "glBindTexture", (void**)&gl3wBindTexture, (void*)recording_glBindTexture },
+	{ "glDeleteTextures", (void**)&gl3wDeleteTextures, (void*)recording_glDeleteTextures },
+	{ "glGenTextures", (void**)&gl3wGenTextures, (void*)recording_glGenTextures },
+	{ "glIsTexture", (void**)&gl3wIsTexture, (void*)recording_glIsTexture },
+	{ "glDrawRangeElements", (void**)&gl3wDrawRangeElements, (void*)recording_glDrawRangeElements },
+	{ "glTexImage3D", (void**)&gl3wTexImage3D, (void*)recording_glTexImage3D },
+	{ "glTexSubImage3D", (void**)&gl3wTexSubImage3D, (void*)recording_glTexSubImage3D },
+	{ "glCopyTexSubImage3D", (void**)&gl3wCopyTexSubImage3D, (void*)recording_glCopyTexSubImage3D },
+	{ "glActiveTexture", (void**)&gl3wActiveTexture, (void*)recording_glActiveTexture },
+	{ "glSampleCoverage", (void**)&gl3wSampleCoverage, (void*)recording_glSampleCoverage },
+	{ "glCompressedTexImage3D", (void**)&gl3wCompressedTexImage3D, (void*)recording_glCompressedTexImage3D },
+	{ "glCompressedTexImage2D", (void**)&gl3wCompressedTexImage2D, (void*)recording_glCompressedTexImage2D },
+	{ "glCompressedTexImage1D", (void**)&gl3wCompressedTexImage1D, (void*)recording_glCompressedTexImage1D },
+	{ "glCompressedTexSubImage3D", (void**)&gl3wCompressedTexSubImage3D, (void*)recording_glCompressedTexSubImage3D },
+	{ "glCompressedTexSubImage2D", (void**)&gl3wCompressedTexSubImage2D, (void*)recording_glCompressedTexSubImage2D },
+	{ "glCompressedTexSubImage1D", (void**)&gl3wCompressedTexSubImage1D, (void*)recording_glCompressedTexSubImage1D },
+	{ "glGetCompressedTexImage", (void**)&gl3wGetCompressedTexImage, (void*)recording_glGetCompressedTexImage },
+	{ "glBlendFuncSeparate", (void**)&gl3wBlendFuncSeparate, (void*)recording_glBlendFuncSeparate },
+	{ "glMultiDrawArrays", (void**)&gl3wMultiDrawArrays, (void*)recording_glMultiDrawArrays },
+	{ "glMultiDrawElements", (void**)&gl3wMultiDrawElements, (void*)recording_glMultiDrawElements },
+	{ "glPointParameterf", (void**)&gl3wPointParameterf, (void*)recording_glPointParameterf },
+	{ "glPointParameterfv", (void**)&gl3wPointParameterfv, (void*)recording_glPointParameterfv },
+	{ "glPointParameteri", (void**)&gl3wPointParameteri, (void*)recording_glPointParameteri },
+	{ "glPointParameteriv", (void**)&gl3wPointParameteriv, (void*)recording_glPointParameteriv },
+	{ "glBlendColor", (void**)&gl3wBlendColor, (void*)recording_glBlendColor },
+	{ "glBlendEquation", (void**)&gl3wBlendEquation, (void*)recording_glBlendEquation },
+	{ "glGenQueries", (void**)&gl3wGenQueries, (void*)recording_glGenQueries },
+	{ "glDeleteQueries", (void**)&gl3wDeleteQueries, (void*)recording_glDeleteQueries },
+	{ "glIsQuery", (void**)&gl3wIsQuery, (void*)recording_glIsQuery },
+	{ "glBeginQuery", (void**)&gl3wBeginQuery, (void*)recording_glBeginQuery },
+	{ "glEndQuery", (void**)&gl3wEndQuery, (void*)recording_glEndQuery },
+	{ "glGetQueryiv", (void**)&gl3wGetQueryiv, (void*)recording_glGetQueryiv },
+	{ "glGetQueryObjectiv", (void**)&gl3wGetQueryObjectiv, (void*)recording_glGetQueryObjectiv },
+	{ "glGetQueryObjectuiv", (void**)&gl3wGetQueryObjectuiv, (void*)recording_glGetQueryObjectuiv },
+	{ "glBindBuffer", (void**)&gl3wBindBuffer, (void*)recording_glBindBuffer },
+	{ "glDeleteBuffers", (void**)&gl3wDeleteBuffers, (void*)recording_glDeleteBuffers },
+	{ "glGenBuffers", (void**)&gl3wGenBuffers, (void*)recording_glGenBuffers },
+	{ "glIsBuffer", (void**)&gl3wIsBuffer, (void*)recording_glIsBuffer },
+	{ "glBufferData", (void**)&gl3wBufferData, (void*)recording_glBufferData },
+	{ "glBufferSubData", (void**)&gl3wBufferSubData, (void*)recording_glBufferSubData },
+	{ "glGetBufferSubData", (void**)&gl3wGetBufferSubData, (void*)recording_glGetBufferSubData },
+	{ "glMapBuffer", (void**)&gl3wMapBuffer, (void*)recording_glMapBuffer },
+	{ "glUnmapBuffer", (void**)&gl3wUnmapBuffer, (void*)recording_glUnmapBuffer },
+	{ "glGetBufferParameteriv", (void**)&gl3wGetBufferParameteriv, (void*)recording_glGetBufferParameteriv },
+	{ "glGetBufferPointerv", (void**)&gl3wGetBufferPointerv, (void*)recording_glGetBufferPointerv },
+	{ "glBlendEquationSeparate", (void**)&gl3wBlendEquationSeparate, (void*)recording_glBlendEquationSeparate },
+	{ "glDrawBuffers", (void**)&gl3wDrawBuffers, (void*)recording_glDrawBuffers },
+	{ "glStencilOpSeparate", (void**)&gl3wStencilOpSeparate, (void*)recording_glStencilOpSeparate },
+	{ "glStencilFuncSeparate", (void**)&gl3wStencilFuncSeparate, (void*)recording_glStencilFuncSeparate },
+	{ "glStencilMaskSeparate", (void**)&gl3wStencilMaskSeparate, (void*)recording_glStencilMaskSeparate },
+	{ "glAttachShader", (void**)&gl3wAttachShader, (void*)recording_glAttachShader },
+	{ "glBindAttribLocation", (void**)&gl3wBindAttribLocation, (void*)recording_glBindAttribLocation },
+	{ "glCompileShader", (void**)&gl3wCompileShader, (void*)recording_glCompileShader },
+	{ "glCreateProgram", (void**)&gl3wCreateProgram, (void*)recording_glCreateProgram },
+	{ "glCreateShader", (void**)&gl3wCreateShader, (void*)recording_glCreateShader },
+	{ "glDeleteProgram", (void**)&gl3wDeleteProgram, (void*)recording_glDeleteProgram },
+	{ "glDeleteShader", (void**)&gl3wDeleteShader, (void*)recording_glDeleteShader },
+	{ "glDetachShader", (void**)&gl3wDetachShader, (void*)recording_glDetachShader },
+	{ "glDisableVertexAttribArray", (void**)&gl3wDisableVertexAttribArray, (void*)recording_glDisableVertexAttribArray },
+	{ "glEnableVertexAttribArray", (void**)&gl3wEnableVertexAttribArray, (void*)recording_glEnableVertexAttribArray },
+	{ "glGetActiveAttrib", (void**)&gl3wGetActiveAttrib, (void*)recording_glGetActiveAttrib },
+	{ "glGetActiveUniform", (void**)&gl3wGetActiveUniform, (void*)recording_glGetActiveUniform },
+	{ "glGetAttachedShaders", (void**)&gl3wGetAttachedShaders, (void*)recording_glGetAttachedShaders },
+	{ "glGetAttribLocation", (void**)&gl3wGetAttribLocation, (void*)recording_glGetAttribLocation },
+	{ "glGetProgramiv", (void**)&gl3wGetProgramiv, (void*)recording_glGetProgramiv },
+	{ "glGetProgramInfoLog", (void**)&gl3wGetProgramInfoLog, (void*)recording_glGetProgramInfoLog },
+	{ "glGetShaderiv", (void**)&gl3wGetShaderiv, (void*)recording_glGetShaderiv },
+	{ "glGetShaderInfoLog", (void**)&gl3wGetShaderInfoLog, (void*)recording_glGetShaderInfoLog },
+	{ "glGetShaderSource", (void**)&gl3wGetShaderSource, (void*)recording_glGetShaderSource },
+	{ "glGetUniformLocation", (void**)&gl3wGetUniformLocation, (void*)recording_glGetUniformLocation },
+	{ "glGetUniformfv", (void**)&gl3wGetUniformfv, (void*)recording_glGetUniformfv },
+	{ "glGetUniformiv", (void**)&gl3wGetUniformiv, (void*)recording_glGetUniformiv },
+	{ "glGetVertexAttribdv", (void**)&gl3wGetVertexAttribdv, (void*)recording_glGetVertexAttribdv },
+	{ "glGetVertexAttribfv", (void**)&gl3wGetVertexAttribfv, (void*)recording_glGetVertexAttribfv },
+	{ "glGetVertexAttribiv", (void**)&gl3wGetVertexAttribiv, (void*)recording_glGetVertexAttribiv },
+	{ "glGetVertexAttribPointerv", (void**)&gl3wGetVertexAttribPointerv, (void*)recording_glGetVertexAttribPointerv },
+	{ "glIsProgram", (void**)&gl3wIsProgram, (void*)recording_glIsProgram },
+	{ "glIsShader", (void**)&gl3wIsShader, (void*)recording_glIsShader },
+	{ "glLinkProgram", (void**)&gl3wLinkProgram, (void*)recording_glLinkProgram },
+	{ "glShaderSource", (void**)&gl3wShaderSource, (void*)recording_glShaderSource },
+	{ "glUseProgram", (void**)&gl3wUseProgram, (void*)recording_glUseProgram },
+	{ "glUniform1f", (void**)&gl3wUniform1f, (void*)recording_glUniform1f },
+	{ "glUniform2f", (void**)&gl3wUniform2f, (void*)recording_glUniform2f },
+	{ "glUniform3f", (void**)&gl3wUniform3f, (void*)recording_glUniform3f },
+	{ "glUniform4f", (void**)&gl3wUniform4f, (void*)recording_glUniform4f },
+	{ "glUniform1i", (void**)&gl3wUniform1i, (void*)recording_glUniform1i },
+	{ "glUniform2i", (void**)&gl3wUniform2i, (void*)recording_glUniform2i },
+	{ "glUniform3i", (void**)&gl3wUniform3i, (void*)recording_glUniform3i },
+	{ "glUniform4i", (void**)&gl3wUniform4i, (void*)recording_glUniform4i },
+	{ "glUniform1fv", (void**)&gl3wUniform1fv, (void*)recording_glUniform1fv },
+	{ "glUniform2fv", (void**)&gl3wUniform2fv, (void*)recording_glUniform2fv },
+	{ "glUniform3fv", (void**)&gl3wUniform3fv, (void*)recording_glUniform3fv },
+	{ "glUniform4fv", (void**)&gl3wUniform4fv, (void*)recording_glUniform4fv },
+	{ "glUniform1iv", (void**)&gl3wUniform1iv, (void*)recording_glUniform1iv },
+	{ "glUniform2iv", (void**)&gl3wUniform2iv, (void*)recording_glUniform2iv },
+	{ "glUniform3iv", (void**)&gl3wUniform3iv, (void*)recording_glUniform3iv },
+	{ "glUniform4iv", (void**)&gl3wUniform4iv, (void*)recording_glUniform4iv },
+	{ "glUniformMatrix2fv", (void**)&gl3wUniformMatrix2fv, (void*)recording_glUniformMatrix2fv },
+	{ "glUniformMatrix3fv", (void**)&gl3wUniformMatrix3fv, (void*)recording_glUniformMatrix3fv },
+	{ "glUniformMatrix4fv", (void**)&gl3wUniformMatrix4fv, (void*)recording_glUniformMatrix4fv },
+	{ "glValidateProgram", (void**)&gl3wValidateProgram, (void*)recording_glValidateProgram },
+	{ "glVertexAttrib1d", (void**)&gl3wVertexAttrib1d, (void*)recording_glVertexAttrib1d },
+	{ "glVertexAttrib1dv", (void**)&gl3wVertexAttrib1dv, (void*)recording_glVertexAttrib1dv },
+	{ "glVertexAttrib1f", (void**)&gl3wVertexAttrib1f, (void*)recording_glVertexAttrib1f },
+	{ "glVertexAttrib1fv", (void**)&gl3wVertexAttrib1fv, (void*)recording_glVertexAttrib1fv },
+	{ "glVertexAttrib1s", (void**)&gl3wVertexAttrib1s, (void*)recording_glVertexAttrib1s },
+	{ "glVertexAttrib1sv", (void**)&gl3wVertexAttrib1sv, (void*)recording_glVertexAttrib1sv },
+	{ "glVertexAttrib2d", (void**)&gl3wVertexAttrib2d, (void*)recording_glVertexAttrib2d },
+	{ "glVertexAttrib2dv", (void**)&gl3wVertexAttrib2dv, (void*)recording_glVertexAttrib2dv },
+	{ "glVertexAttrib2f", (void**)&gl3wVertexAttrib2f, (void*)recording_glVertexAttrib2f },
+	{ "glVertexAttrib2fv", (void**)&gl3wVertexAttrib2fv, (void*)recording_glVertexAttrib2fv },
+	{ "glVertexAttrib2s", (void**)&gl3wVertexAttrib2s, (void*)recording_glVertexAttrib2s },
+	{ "glVertexAttrib2sv", (void**)&gl3wVertexAttrib2sv, (void*)recording_glVertexAttrib2sv },
+	{ "glVertexAttrib3d", (void**)&gl3wVertexAttrib3d, (void*)recording_glVertexAttrib3d },
+	{ "glVertexAttrib3dv", (void**)&gl3wVertexAttrib3dv, (void*)recording_glVertexAttrib3dv },
+	{ "glVertexAttrib3f", (void**)&gl3wVertexAttrib3f, (void*)recording_glVertexAttrib3f },
+	{ "glVertexAttrib3fv", (void**)&gl3wVertexAttrib3fv, (void*)recording_glVertexAttrib3fv },
+	{ "glVertexAttrib3s", (void**)&gl3wVertexAttrib3s, (void*)recording_glVertexAttrib3s },
+	{ "glVertexAttrib3sv", (void**)&gl3wVertexAttrib3sv, (void*)recording_glVertexAttrib3sv },
+	{ "glVertexAttrib4Nbv", (void**)&gl3wVertexAttrib4Nbv, (void*)recording_glVertexAttrib4Nbv },
+	{ "glVertexAttrib4Niv", (void**)&gl3wVertexAttrib4Niv, (void*)recording_glVertexAttrib4Niv },
+	{ "glVertexAttrib4Nsv", (void**)&gl3wVertexAttrib4Nsv, (void*)recording_glVertexAttrib4Nsv },
+	{ "glVertexAttrib4Nub", (void**)&gl3wVertexAttrib4Nub, (void*)recording_glVertexAttrib4Nub },
+	{ "glVertexAttrib4Nubv", (void**)&gl3wVertexAttrib4Nubv, (void*)recording_glVertexAttrib4Nubv },
+	{ "glVertexAttrib4Nuiv", (void**)&gl3wVertexAttrib4Nuiv, (void*)recording_glVertexAttrib4Nuiv },
+	{ "glVertexAttrib4Nusv", (void**)&gl3wVertexAttrib4Nusv, (void*)recording_glVertexAttrib4Nusv },
+	{ "glVertexAttrib4bv", (void**)&gl3wVertexAttrib4bv, (void*)recording_glVertexAttrib4bv },
+	{ "glVertexAttrib4d", (void**)&gl3wVertexAttrib4d, (void*)recording_glVertexAttrib4d },
+	{ "glVertexAttrib4dv", (void**)&gl3wVertexAttrib4dv, (void*)recording_glVertexAttrib4dv },
+	{ "glVertexAttrib4f", (void**)&gl3wVertexAttrib4f, (void*)recording_glVertexAttrib4f },
+	{ "glVertexAttrib4fv", (void**)&gl3wVertexAttrib4fv, (void*)recording_glVertexAttrib4fv },
+	{ "glVertexAttrib4iv", (void**)&gl3wVertexAttrib4iv, (void*)recording_glVertexAttrib4iv },
+	{ "glVertexAttrib4s", (void**)&gl3wVertexAttrib4s, (void*)recording_glVertexAttrib4s },
+	{ "glVertexAttrib4sv", (void**)&gl3wVertexAttrib4sv, (void*)recording_glVertexAttrib4sv },
+	{ "glVertexAttrib4ubv", (void**)&gl3wVertexAttrib4ubv, (void*)recording_glVertexAttrib4ubv },
+	{ "glVertexAttrib4uiv", (void**)&gl3wVertexAttrib4uiv, (void*)recording_glVertexAttrib4uiv },
+	{ "glVertexAttrib4usv", (void**)&gl3wVertexAttrib4usv, (void*)recording_glVertexAttrib4usv },
+	{ "glVertexAttribPointer", (void**)&gl3wVertexAttribPointer, (void*)recording_glVertexAttribPointer },
+	{ "glUniformMatrix2x3fv", (void**)&gl3wUniformMatrix2x3fv, (void*)recording_glUniformMatrix2x3fv },
+	{ "glUniformMatrix3x2fv", (void**)&gl3wUniformMatrix3x2fv, (void*)recording_glUniformMatrix3x2fv },
+	{ "glUniformMatrix2x4fv", (void**)&gl3wUniformMatrix2x4fv, (void*)recording_glUniformMatrix2x4fv },
+	{ "glUniformMatrix4x2fv", (void**)&gl3wUniformMatrix4x2fv, (void*)recording_glUniformMatrix4x2fv },
+	{ "glUniformMatrix3x4fv", (void**)&gl3wUniformMatrix3x4fv, (void*)recording_glUniformMatrix3x4fv },
+	{ "glUniformMatrix4x3fv", (void**)&gl3wUniformMatrix4x3fv, (void*)recording_glUniformMatrix4x3fv },
+	{ "glColorMaski", (void**)&gl3wColorMaski, (void*)recording_glColorMaski },
+	{ "glGetBooleani_v", (void**)&gl3wGetBooleani_v, (void*)recording_glGetBooleani_v },
+	{ "glGetIntegeri_v", (void**)&gl3wGetIntegeri_v, (void*)recording_glGetIntegeri_v },
+	{ "glEnablei", (void**)&gl3wEnablei, (void*)recording_glEnablei },
+	{ "glDisablei", (void**)&gl3wDisablei, (void*)recording_glDisablei },
+	{ "glIsEnabledi", (void**)&gl3wIsEnabledi, (void*)recording_glIsEnabledi },
+	{ "glBeginTransformFeedback", (void**)&gl3wBeginTransformFeedback, (void*)recording_glBeginTransformFeedback },
+	{ "glEndTransformFeedback", (void**)&gl3wEndTransformFeedback, (void*)recording_glEndTransformFeedback },
+	{ "glBindBufferRange", (void**)&gl3wBindBufferRange, (void*)recording_glBindBufferRange },
+	{ "glBindBufferBase", (void**)&gl3wBindBufferBase, (void*)recording_glBindBufferBase },
+	{ "glTransformFeedbackVaryings", (void**)&gl3wTransformFeedbackVaryings, (void*)recording_glTransformFeedbackVaryings },
+	{ "glGetTransformFeedbackVarying", (void**)&gl3wGetTransformFeedbackVarying, (void*)recording_glGetTransformFeedbackVarying },
+	{ "glClampColor", (void**)&gl3wClampColor, (void*)recording_glClampColor },
+	{ "glBeginConditionalRender", (void**)&gl3wBeginConditionalRender, (void*)recording_glBeginConditionalRender },
+	{ "glEndConditionalRender", (void**)&gl3wEndConditionalRender, (void*)recording_glEndConditionalRender },
+	{ "glVertexAttribIPointer", (void**)&gl3wVertexAttribIPointer, (void*)recording_glVertexAttribIPointer },
+	{ "glGetVertexAttribIiv", (void**)&gl3wGetVertexAttribIiv, (void*)recording_glGetVertexAttribIiv },
+	{ "glGetVertexAttribIuiv", (void**)&gl3wGetVertexAttribIuiv, (void*)recording_glGetVertexAttribIuiv },
+	{ "glVertexAttribI1i", (void**)&gl3wVertexAttribI1i, (void*)recording_glVertexAttribI1i },
+	{ "glVertexAttribI2i", (void**)&gl3wVertexAttribI2i, (void*)recording_glVertexAttribI2i },
+	{ "glVertexAttribI3i", (void**)&gl3wVertexAttribI3i, (void*)recording_glVertexAttribI3i },
+	{ "glVertexAttribI4i", (void**)&gl3wVertexAttribI4i, (void*)recording_glVertexAttribI4i },
+	{ "glVertexAttribI1ui", (void**)&gl3wVertexAttribI1ui, (void*)recording_glVertexAttribI1ui },
+	{ "glVertexAttribI2ui", (void**)&gl3wVertexAttribI2ui, (void*)recording_glVertexAttribI2ui },
+	{ "glVertexAttribI3ui", (void**)&gl3wVertexAttribI3ui, (void*)recording_glVertexAttribI3ui },
+	{ "glVertexAttribI4ui", (void**)&gl3wVertexAttribI4ui, (void*)recording_glVertexAttribI4ui },
+	{ "glVertexAttribI1iv", (void**)&gl3wVertexAttribI1iv, (void*)recording_glVertexAttribI1iv },
+	{ "glVertexAttribI2iv", (void**)&gl3wVertexAttribI2iv, (void*)recording_glVertexAttribI2iv },
+	{ "glVertexAttribI3iv", (void**)&gl3wVertexAttribI3iv, (void*)recording_glVertexAttribI3iv },
+	{ "glVertexAttribI4iv", (void**)&gl3wVertexAttribI4iv, (void*)recording_glVertexAttribI4iv },
+	{ "glVertexAttribI1uiv", (void**)&gl3wVertexAttribI1uiv, (void*)recording_glVertexAttribI1uiv },
+	{ "glVertexAttribI2uiv", (void**)&gl3wVertexAttribI2uiv, (void*)recording_glVertexAttribI2uiv },
+	{ "glVertexAttribI3uiv", (void**)&gl3wVertexAttribI3uiv, (void*)recording_glVertexAttribI3uiv },
+	{ "glVertexAttribI4uiv", (void**)&gl3wVertexAttribI4uiv, (void*)recording_glVertexAttribI4uiv },
+	{ "glVertexAttribI4bv", (void**)&gl3wVertexAttribI4bv, (void*)recording_glVertexAttribI4bv },
+	{ "glVertexAttribI4sv", (void**)&gl3wVertexAttribI4sv, (void*)recording_glVertexAttribI4sv },
+	{ "glVertexAttribI4ubv", (void**)&gl3wVertexAttribI4ubv, (void*)recording_glVertexAttribI4ubv },
+	{ "glVertexAttribI4usv", (void**)&gl3wVertexAttribI4usv, (void*)recording_glVertexAttribI4usv },
+	{ "glGetUniformuiv", (void**)&gl3wGetUniformuiv, (void*)recording_glGetUniformuiv },
+	{ "glBindFragDataLocation", (void**)&gl3wBindFragDataLocation, (void*)recording_glBindFragDataLocation },
+	{ "glGetFragDataLocation", (void**)&gl3wGetFragDataLocation, (void*)recording_glGetFragDataLocation },
+	{ "glUniform1ui", (void**)&gl3wUniform1ui, (void*)recording_glUniform1ui },
+	{ "glUniform2ui", (void**)&gl3wUniform2ui, (void*)recording_glUniform2ui },
+	{ "glUniform3ui", (void**)&gl3wUniform3ui, (void*)recording_glUniform3ui },
+	{ "glUniform4ui", (void**)&gl3wUniform4ui, (void*)recording_glUniform4ui },
+	{ "glUniform1uiv", (void**)&gl3wUniform1uiv, (void*)recording_glUniform1uiv },
+	{ "glUniform2uiv", (void**)&gl3wUniform2uiv, (void*)recording_glUniform2uiv },
+	{ "glUniform3uiv", (void**)&gl3wUniform3uiv, (void*)recording_glUniform3uiv },
+	{ "glUniform4uiv", (void**)&gl3wUniform4uiv, (void*)recording_glUniform4uiv },
+	{ "glTexParameterIiv", (void**)&gl3wTexParameterIiv, (void*)recording_glTexParameterIiv },
+	{ "glTexParameterIuiv", (void**)&gl3wTexParameterIuiv, (void*)recording_glTexParameterIuiv },
+	{ "glGetTexParameterIiv", (void**)&gl3wGetTexParameterIiv, (void*)recording_glGetTexParameterIiv },
+	{ "glGetTexParameterIuiv", (void**)&gl3wGetTexParameterIuiv, (void*)recording_glGetTexParameterIuiv },
+	{ "glClearBufferiv", (void**)&gl3wClearBufferiv, (void*)recording_glClearBufferiv },
+	{ "glClearBufferuiv", (void**)&gl3wClearBufferuiv, (void*)recording_glClearBufferuiv },
+	{ "glClearBufferfv", (void**)&gl3wClearBufferfv, (void*)recording_glClearBufferfv },
+	{ "glClearBufferfi", (void**)&gl3wClearBufferfi, (void*)recording_glClearBufferfi },
+	{ "glGetStringi", (void**)&gl3wGetStringi, (void*)recording_glGetStringi },
+	{ "glIsRenderbuffer", (void**)&gl3wIsRenderbuffer, (void*)recording_glIsRenderbuffer },
+	{ "glBindRenderbuffer", (void**)&gl3wBindRenderbuffer, (void*)recording_glBindRenderbuffer },
+	{ "glDeleteRenderbuffers", (void**)&gl3wDeleteRenderbuffers, (void*)recording_glDeleteRenderbuffers },
+	{ "glGenRenderbuffers", (void**)&gl3wGenRenderbuffers, (void*)recording_glGenRenderbuffers },
+	{ "glRenderbufferStorage", (void**)&gl3wRenderbufferStorage, (void*)recording_glRenderbufferStorage },
+	{ "glGetRenderbufferParameteriv", (void**)&gl3wGetRenderbufferParameteriv, (void*)recording_glGetRenderbufferParameteriv },
+	{ "glIsFramebuffer", (void**)&gl3wIsFramebuffer, (void*)recording_glIsFramebuffer },
+	{ "glBindFramebuffer", (void**)&gl3wBindFramebuffer, (void*)recording_glBindFramebuffer },
+	{ "glDeleteFramebuffers", (void**)&gl3wDeleteFramebuffers, (void*)recording_glDeleteFramebuffers },
+	{ "glGenFramebuffers", (void**)&gl3wGenFramebuffers, (void*)recording_glGenFramebuffers },
+	{ "glCheckFramebufferStatus", (void**)&gl3wCheckFramebufferStatus, (void*)recording_glCheckFramebufferStatus },
+	{ "glFramebufferTexture1D", (void**)&gl3wFramebufferTexture1D, (void*)recording_glFramebufferTexture1D },
+	{ "glFramebufferTexture2D", (void**)&gl3wFramebufferTexture2D, (void*)recording_glFramebufferTexture2D },
+	{ "glFramebufferTexture3D", (void**)&gl3wFramebufferTexture3D, (void*)recording_glFramebufferTexture3D },
+	{ "glFramebufferRenderbuffer", (void**)&gl3wFramebufferRenderbuffer, (void*)recording_glFramebufferRenderbuffer },
+	{ "glGetFramebufferAttachmentParameteriv", (void**)&gl3wGetFramebufferAttachmentParameteriv, (void*)recording_glGetFramebufferAttachmentParameteriv },
+	{ "glGenerateMipmap", (void**)&gl3wGenerateMipmap, (void*)recording_glGenerateMipmap },
+	{ "glBlitFramebuffer", (void**)&gl3wBlitFramebuffer, (void*)recording_glBlitFramebuffer },
+	{ "glRenderbufferStorageMultisample", (void**)&gl3wRenderbufferStorageMultisample, (void*)recording_glRenderbufferStorageMultisample },
+	{ "glFramebufferTextureLayer", (void**)&gl3wFramebufferTextureLayer, (void*)recording_glFramebufferTextureLayer },
+	{ "glMapBufferRange", (void**)&gl3wMapBufferRange, (void*)recording_glMapBufferRange },
+	{ "glFlushMappedBufferRange", (void**)&gl3wFlushMappedBufferRange, (void*)recording_glFlushMappedBufferRange },
+	{ "glBindVertexArray", (void**)&gl3wBindVertexArray, (void*)recording_glBindVertexArray },
+	{ "glDeleteVertexArrays", (void**)&gl3wDeleteVertexArrays, (void*)recording_glDeleteVertexArrays },
+	{ "glGenVertexArrays", (void**)&gl3wGenVertexArrays, (void*)recording_glGenVertexArrays },
+	{ "glIsVertexArray", (void**)&gl3wIsVertexArray, (void*)recording_glIsVertexArray },
+	{ "glDrawArraysInstanced", (void**)&gl3wDrawArraysInstanced, (void*)recording_glDrawArraysInstanced },
+	{ "glDrawElementsInstanced", (void**)&gl3wDrawElementsInstanced, (void*)recording_glDrawElementsInstanced },
+	{ "glTexBuffer", (void**)&gl3wTexBuffer, (void*)recording_glTexBuffer },
+	{ "glPrimitiveRestartIndex", (void**)&gl3wPrimitiveRestartIndex, (void*)recording_glPrimitiveRestartIndex },
+	{ "glCopyBufferSubData", (void**)&gl3wCopyBufferSubData, (void*)recording_glCopyBufferSubData },
+	{ "glGetUniformIndices", (void**)&gl3wGetUniformIndices, (void*)recording_glGetUniformIndices },
+	{ "glGetActiveUniformsiv", (void**)&gl3wGetActiveUniformsiv, (void*)recording_glGetActiveUniformsiv },
+	{ "glGetActiveUniformName", (void**)&gl3wGetActiveUniformName, (void*)recording_glGetActiveUniformName },
+	{ "glGetUniformBlockIndex", (void**)&gl3wGetUniformBlockIndex, (void*)recording_glGetUniformBlockIndex },
+	{ "glGetActiveUniformBlockiv", (void**)&gl3wGetActiveUniformBlockiv, (void*)recording_glGetActiveUniformBlockiv },
+	{ "glGetActiveUniformBlockName", (void**)&gl3wGetActiveUniformBlockName, (void*)recording_glGetActiveUniformBlockName },
+	{ "glUniformBlockBinding", (void**)&gl3wUniformBlockBinding, (void*)recording_glUniformBlockBinding },
+	{ "glDrawElementsBaseVertex", (void**)&gl3wDrawElementsBaseVertex, (void*)recording_glDrawElementsBaseVertex },
+	{ "glDrawRangeElementsBaseVertex", (void**)&gl3wDrawRangeElementsBaseVertex, (void*)recording_glDrawRangeElementsBaseVertex },
+	{ "glDrawElementsInstancedBaseVertex", (void**)&gl3wDrawElementsInstancedBaseVertex, (void*)recording_glDrawElementsInstancedBaseVertex },
+	{ "glMultiDrawElementsBaseVertex", (void**)&gl3wMultiDrawElementsBaseVertex, (void*)recording_glMultiDrawElementsBaseVertex },
+	{ "glProvokingVertex", (void**)&gl3wProvokingVertex, (void*)recording_glProvokingVertex },
+	{ "glFenceSync", (void**)&gl3wFenceSync, (void*)recording_glFenceSync },
+	{ "glIsSync", (void**)&gl3wIsSync, (void*)recording_glIsSync },
+	{ "glDeleteSync", (void**)&gl3wDeleteSync, (void*)recording_glDeleteSync },
+	{ "glClientWaitSync", (void**)&gl3wClientWaitSync, (void*)recording_glClientWaitSync },
+	{ "glWaitSync", (void**)&gl3wWaitSync, (void*)recording_glWaitSync },
+	{ "glGetInteger64v", (void**)&gl3wGetInteger64v, (void*)recording_glGetInteger64v },
+	{ "glGetSynciv", (void**)&gl3wGetSynciv, (void*)recording_glGetSynciv },
+	{ "glGetInteger64i_v", (void**)&gl3wGetInteger64i_v, (void*)recording_glGetInteger64i_v },
+	{ "glGetBufferParameteri64v", (void**)&gl3wGetBufferParameteri64v, (void*)recording_glGetBufferParameteri64v },
+	{ "glFramebufferTexture", (void**)&gl3wFramebufferTexture, (void*)recording_glFramebufferTexture },
+	{ "glTexImage2DMultisample", (void**)&gl3wTexImage2DMultisample, (void*)recording_glTexImage2DMultisample },
+	{ "glTexImage3DMultisample", (void**)&gl3wTexImage3DMultisample, (void*)recording_glTexImage3DMultisample },
+	{ "glGetMultisamplefv", (void**)&gl3wGetMultisamplefv, (void*)recording_glGetMultisamplefv },
+	{ "glSampleMaski", (void**)&gl3wSampleMaski, (void*)recording_glSampleMaski },
+	{ "glBindFragDataLocationIndexed", (void**)&gl3wBindFragDataLocationIndexed, (void*)recording_glBindFragDataLocationIndexed },
+	{ "glGetFragDataIndex", (void**)&gl3wGetFragDataIndex, (void*)recording_glGetFragDataIndex },
+	{ "glGenSamplers", (void**)&gl3wGenSamplers, (void*)recording_glGenSamplers },
+	{ "glDeleteSamplers", (void**)&gl3wDeleteSamplers, (void*)recording_glDeleteSamplers },
+	{ "glIsSampler", (void**)&gl3wIsSampler, (void*)recording_glIsSampler },
+	{ "glBindSampler", (void**)&gl3wBindSampler, (void*)recording_glBindSampler },
+	{ "glSamplerParameteri", (void**)&gl3wSamplerParameteri, (void*)recording_glSamplerParameteri },
+	{ "glSamplerParameteriv", (void**)&gl3wSamplerParameteriv, (void*)recording_glSamplerParameteriv },
+	{ "glSamplerParameterf", (void**)&gl3wSamplerParameterf, (void*)recording_glSamplerParameterf },
+	{ "glSamplerParameterfv", (void**)&gl3wSamplerParameterfv, (void*)recording_glSamplerParameterfv },
+	{ "glSamplerParameterIiv", (void**)&gl3wSamplerParameterIiv, (void*)recording_glSamplerParameterIiv },
+	{ "glSamplerParameterIuiv", (void**)&gl3wSamplerParameterIuiv, (void*)recording_glSamplerParameterIuiv },
+	{ "glGetSamplerParameteriv", (void**)&gl3wGetSamplerParameteriv, (void*)recording_glGetSamplerParameteriv },
+	{ "glGetSamplerParameterIiv", (void**)&gl3wGetSamplerParameterIiv, (void*)recording_glGetSamplerParameterIiv },
+	{ "glGetSamplerParameterfv", (void**)&gl3wGetSamplerParameterfv, (void*)recording_glGetSamplerParameterfv },
+	{ "glGetSamplerParameterIuiv", (void**)&gl3wGetSamplerParameterIuiv, (void*)recording_glGetSamplerParameterIuiv },
+	{ "glQueryCounter", (void**)&gl3wQueryCounter, (void*)recording_glQueryCounter },
+	{ "glGetQueryObjecti64v", (void**)&gl3wGetQueryObjecti64v, (void*)recording_glGetQueryObjecti64v },
+	{ "glGetQueryObjectui64v", (void**)&gl3wGetQueryObjectui64v, (void*)recording_glGetQueryObjectui64v },
+	{ "glVertexAttribDivisor", (void**)&gl3wVertexAttribDivisor, (void*)recording_glVertexAttribDivisor },
+	{ "glVertexAttribP1ui", (void**)&gl3wVertexAttribP1ui, (void*)recording_glVertexAttribP1ui },
+	{ "glVertexAttribP1uiv", (void**)&gl3wVertexAttribP1uiv, (void*)recording_glVertexAttribP1uiv },
+	{ "glVertexAttribP2ui", (void**)&gl3wVertexAttribP2ui, (void*)recording_glVertexAttribP2ui },
+	{ "glVertexAttribP2uiv", (void**)&gl3wVertexAttribP2uiv, (void*)recording_glVertexAttribP2uiv },
+	{ "glVertexAttribP3ui", (void**)&gl3wVertexAttribP3ui, (void*)recording_glVertexAttribP3ui },
+	{ "glVertexAttribP3uiv", (void**)&gl3wVertexAttribP3uiv, (void*)recording_glVertexAttribP3uiv },
+	{ "glVertexAttribP4ui", (void**)&gl3wVertexAttribP4ui, (void*)recording_glVertexAttribP4ui },
+	{ "glVertexAttribP4uiv", (void**)&gl3wVertexAttribP4uiv, (void*)recording_glVertexAttribP4uiv },
+	{ "glMinSampleShading", (void**)&gl3wMinSampleShading, (void*)recording_glMinSampleShading },
+	{ "glBlendEquationi", (void**)&gl3wBlendEquationi, (void*)recording_glBlendEquationi },
+	{ "glBlendEquationSeparatei", (void**)&gl3wBlendEquationSeparatei, (void*)recording_glBlendEquationSeparatei },
+	{ "glBlendFunci", (void**)&gl3wBlendFunci, (void*)recording_glBlendFunci },
+	{ "glBlendFuncSeparatei", (void**)&gl3wBlendFuncSeparatei, (void*)recording_glBlendFuncSeparatei },
+	{ "glDrawArraysIndirect", (void**)&gl3wDrawArraysIndirect, (void*)recording_glDrawArraysIndirect },
+	{ "glDrawElementsIndirect", (void**)&gl3wDrawElementsIndirect, (void*)recording_glDrawElementsIndirect },
+	{ "glUniform1d", (void**)&gl3wUniform1d, (void*)recording_glUniform1d },
+	{ "glUniform2d", (void**)&gl3wUniform2d, (void*)recording_glUniform2d },
+	{ "glUniform3d", (void**)&gl3wUniform3d, (void*)recording_glUniform3d },
+	{ "glUniform4d", (void**)&gl3wUniform4d, (void*)recording_glUniform4d },
+	{ "glUniform1dv", (void**)&gl3wUniform1dv, (void*)recording_glUniform1dv },
+	{ "glUniform2dv", (void**)&gl3wUniform2dv, (void*)recording_glUniform2dv },
+	{ "glUniform3dv", (void**)&gl3wUniform3dv, (void*)recording_glUniform3dv },
+	{ "glUniform4dv", (void**)&gl3wUniform4dv, (void*)recording_glUniform4dv },
+	{ "glUniformMatrix2dv", (void**)&gl3wUniformMatrix2dv, (void*)recording_glUniformMatrix2dv },
+	{ "glUniformMatrix3dv", (void**)&gl3wUniformMatrix3dv, (void*)recording_glUniformMatrix3dv },
+	{ "glUniformMatrix4dv", (void**)&gl3wUniformMatrix4dv, (void*)recording_glUniformMatrix4dv },
+	{ "glUniformMatrix2x3dv", (void**)&gl3wUniformMatrix2x3dv, (void*)recording_glUniformMatrix2x3dv },
+	{ "glUniformMatrix2x4dv", (void**)&gl3wUniformMatrix2x4dv, (void*)recording_glUniformMatrix2x4dv },
+	{ "glUniformMatrix3x2dv", (void**)&gl3wUniformMatrix3x2dv, (void*)recording_glUniformMatrix3x2dv },
+	{ "glUniformMatrix3x4dv", (void**)&gl3wUniformMatrix3x4dv, (void*)recording_glUniformMatrix3x4dv },
+	{ "glUniformMatrix4x2dv", (void**)&gl3wUniformMatrix4x2dv, (void*)recording_glUniformMatrix4x2dv },
+	{ "glUniformMatrix4x3dv", (void**)&gl3wUniformMatrix4x3dv, (void*)recording_glUniformMatrix4x3dv },
+	{ "glGetUniformdv", (void**)&gl3wGetUniformdv, (void*)recording_glGetUniformdv },
+	{ "glGetSubroutineUniformLocation", (void**)&gl3wGetSubroutineUniformLocation, (void*)recording_glGetSubroutineUniformLocation },
+	{ "glGetSubroutineIndex", (void**)&gl3wGetSubroutineIndex, (void*)recording_glGetSubroutineIndex },
+	{ "glGetActiveSubroutineUniformiv", (void**)&gl3wGetActiveSubroutineUniformiv, (void*)recording_glGetActiveSubroutineUniformiv },
+	{ "glGetActiveSubroutineUniformName", (void**)&gl3wGetActiveSubroutineUniformName, (void*)recording_glGetActiveSubroutineUniformName },
+	{ "glGetActiveSubroutineName", (void**)&gl3wGetActiveSubroutineName, (void*)recording_glGetActiveSubroutineName },
+	{ "glUniformSubroutinesuiv", (void**)&gl3wUniformSubroutinesuiv, (void*)recording_glUniformSubroutinesuiv },
+	{ "glGetUniformSubroutineuiv", (void**)&gl3wGetUniformSubroutineuiv, (void*)recording_glGetUniformSubroutineuiv },
+	{ "glGetProgramStageiv", (void**)&gl3wGetProgramStageiv, (void*)recording_glGetProgramStageiv },
+	{ "glPatchParameteri", (void**)&gl3wPatchParameteri, (void*)recording_glPatchParameteri },
+	{ "glPatchParameterfv", (void**)&gl3wPatchParameterfv, (void*)recording_glPatchParameterfv },
+	{ "glBindTransformFeedback", (void**)&gl3wBindTransformFeedback, (void*)recording_glBindTransformFeedback },
+	{ "glDeleteTransformFeedbacks", (void**)&gl3wDeleteTransformFeedbacks, (void*)recording_glDeleteTransformFeedbacks },
+	{ "glGenTransformFeedbacks", (void**)&gl3wGenTransformFeedbacks, (void*)recording_glGenTransformFeedbacks },
+	{ "glIsTransformFeedback", (void**)&gl3wIsTransformFeedback, (void*)recording_glIsTransformFeedback },
+	{ "glPauseTransformFeedback", (void**)&gl3wPauseTransformFeedback, (void*)recording_glPauseTransformFeedback },
+	{ "glResumeTransformFeedback", (void**)&gl3wResumeTransformFeedback, (void*)recording_glResumeTransformFeedback },
+	{ "glDrawTransformFeedback", (void**)&gl3wDrawTransformFeedback, (void*)recording_glDrawTransformFeedback },
+	{ "glDrawTransformFeedbackStream", (void**)&gl3wDrawTransformFeedbackStream, (void*)recording_glDrawTransformFeedbackStream },
+	{ "glBeginQueryIndexed", (void**)&gl3wBeginQueryIndexed, (void*)recording_glBeginQueryIndexed },
+	{ "glEndQueryIndexed", (void**)&gl3wEndQueryIndexed, (void*)recording_glEndQueryIndexed },
+	{ "glGetQueryIndexediv", (void**)&gl3wGetQueryIndexediv, (void*)recording_glGetQueryIndexediv },
+	{ "glReleaseShaderCompiler", (void**)&gl3wReleaseShaderCompiler, (void*)recording_glReleaseShaderCompiler },
+	{ "glShaderBinary", (void**)&gl3wShaderBinary, (void*)recording_glShaderBinary },
+	{ "glGetShaderPrecisionFormat", (void**)&gl3wGetShaderPrecisionFormat, (void*)recording_glGetShaderPrecisionFormat },
+	{ "glDepthRangef", (void**)&gl3wDepthRangef, (void*)recording_glDepthRangef },
+	{ "glClearDepthf", (void**)&gl3wClearDepthf, (void*)recording_glClearDepthf },
+	{ "glGetProgramBinary", (void**)&gl3wGetProgramBinary, (void*)recording_glGetProgramBinary },
+	{ "glProgramBinary", (void**)&gl3wProgramBinary, (void*)recording_glProgramBinary },
+	{ "glProgramParameteri", (void**)&gl3wProgramParameteri, (void*)recording_glProgramParameteri },
+	{ "glUseProgramStages", (void**)&gl3wUseProgramStages, (void*)recording_glUseProgramStages },
+	{ "glActiveShaderProgram", (void**)&gl3wActiveShaderProgram, (void*)recording_glActiveShaderProgram },
+	{ "glCreateShaderProgramv", (void**)&gl3wCreateShaderProgramv, (void*)recording_glCreateShaderProgramv },
+	{ "glBindProgramPipeline", (void**)&gl3wBindProgramPipeline, (void*)recording_glBindProgramPipeline },
+	{ "glDeleteProgramPipelines", (void**)&gl3wDeleteProgramPipelines, (void*)recording_glDeleteProgramPipelines },
+	{ "glGenProgramPipelines", (void**)&gl3wGenProgramPipelines, (void*)recording_glGenProgramPipelines },
+	{ "glIsProgramPipeline", (void**)&gl3wIsProgramPipeline, (void*)recording_glIsProgramPipeline },
+	{ "glGetProgramPipelineiv", (void**)&gl3wGetProgramPipelineiv, (void*)recording_glGetProgramPipelineiv },
+	{ "glProgramUniform1i", (void**)&gl3wProgramUniform1i, (void*)recording_glProgramUniform1i },
+	{ "glProgramUniform1iv", (void**)&gl3wProgramUniform1iv, (void*)recording_glProgramUniform1iv },
+	{ "glProgramUniform1f", (void**)&gl3wProgramUniform1f, (void*)recording_glProgramUniform1f },
+	{ "glProgramUniform1fv", (void**)&gl3wProgramUniform1fv, (void*)recording_glProgramUniform1fv },
+	{ "glProgramUniform1d", (void**)&gl3wProgramUniform1d, (void*)recording_glProgramUniform1d },
+	{ "glProgramUniform1dv", (void**)&gl3wProgramUniform1dv, (void*)recording_glProgramUniform1dv },
+	{ "glProgramUniform1ui", (void**)&gl3wProgramUniform1ui, (void*)recording_glProgramUniform1ui },
+	{ "glProgramUniform1uiv", (void**)&gl3wProgramUniform1uiv, (void*)recording_glProgramUniform1uiv },
+	{ "glProgramUniform2i", (void**)&gl3wProgramUniform2i, (void*)recording_glProgramUniform2i },
+	{ "glProgramUniform2iv", (void**)&gl3wProgramUniform2iv, (void*)recording_glProgramUniform2iv },
+	{ "glProgramUniform2f", (void**)&gl3wProgramUniform2f, (void*)recording_glProgramUniform2f },
+	{ "glProgramUniform2fv", (void**)&gl3wProgramUniform2fv, (void*)recording_glProgramUniform2fv },
+	{ "glProgramUniform2d", (void**)&gl3wProgramUniform2d, (void*)recording_glProgramUniform2d },
+	{ "glProgramUniform2dv", (void**)&gl3wProgramUniform2dv, (void*)recording_glProgramUniform2dv },
+	{ "glProgramUniform2ui", (void**)&gl3wProgramUniform2ui, (void*)recording_glProgramUniform2ui },
+	{ "glProgramUniform2uiv", (void**)&gl3wProgramUniform2uiv, (void*)recording_glProgramUniform2uiv },
+	{ "glProgramUniform3i", (void**)&gl3wProgramUniform3i, (void*)recording_glProgramUniform3i },
+	{ "glProgramUniform3iv", (void**)&gl3wProgramUniform3iv, (void*)recording_glProgramUniform3iv },
+	{ "glProgramUniform3f", (void**)&gl3wProgramUniform3f, (void*)recording_glProgramUniform3f },
+	{ "glProgramUniform3fv", (void**)&gl3wProgramUniform3fv, (void*)recording_glProgramUniform3fv },
+	{ "glProgramUniform3d", (void**)&gl3wProgramUniform3d, (void*)recording_glProgramUniform3d },
+	{ "glProgramUniform3dv", (void**)&gl3wProgramUniform3dv, (void*)recording_glProgramUniform3dv },
+	{ "glProgramUniform3ui", (void**)&gl3wProgramUniform3ui, (void*)recording_glProgramUniform3ui },
+	{ "glProgramUniform3uiv", (void**)&gl3wProgramUniform3uiv, (void*)recording_glProgramUniform3uiv },
+	{ "glProgramUniform4i", (void**)&gl3wProgramUniform4i, (void*)recording_glProgramUniform4i },
+	{ "glProgramUniform4iv", (void**)&gl3wProgramUniform4iv, (void*)recording_glProgramUniform4iv },
+	{ "glProgramUniform4f", (void**)&gl3wProgramUniform4f, (void*)recording_glProgramUniform4f },
+	{ "glProgramUniform4fv", (void**)&gl3wProgramUniform4fv, (void*)recording_glProgramUniform4fv },
+	{ "glProgramUniform4d", (void**)&gl3wProgramUniform4d, (void*)recording_glProgramUniform4d },
+	{ "glProgramUniform4dv", (void**)&gl3wProgramUniform4dv, (void*)recording_glProgramUniform4dv },
+	{ "glProgramUniform4ui", (void**)&gl3wProgramUniform4ui, (void*)recording_glProgramUniform4ui },
+	{ "glProgramUniform4uiv", (void**)&gl3wProgramUniform4uiv, (void*)recording_glProgramUniform4uiv },
+	{ "glProgramUniformMatrix2fv", (void**)&gl3wProgramUniformMatrix2fv, (void*)recording_glProgramUniformMatrix2fv },
+	{ "glProgramUniformMatrix3fv", (void**)&gl3wProgramUniformMatrix3fv, (void*)recording_glProgramUniformMatrix3fv },
+	{ "glProgramUniformMatrix4fv", (void**)&gl3wProgramUniformMatrix4fv, (void*)recording_glProgramUniformMatrix4fv },
+	{ "glProgramUniformMatrix2dv", (void**)&gl3wProgramUniformMatrix2dv, (void*)recording_glProgramUniformMatrix2dv },
+	{ "glProgramUniformMatrix3dv", (void**)&gl3wProgramUniformMatrix3dv, (void*)recording_glProgramUniformMatrix3dv },
+	{ "glProgramUniformMatrix4dv", (void**)&gl3wProgramUniformMatrix4dv, (void*)recording_glProgramUniformMatrix4dv },
+	{ "glProgramUniformMatrix2x3fv", (void**)&gl3wProgramUniformMatrix2x3fv, (void*)recording_glProgramUniformMatrix2x3fv },
+	{ "glProgramUniformMatrix3x2fv", (void**)&gl3wProgramUniformMatrix3x2fv, (void*)recording_glProgramUniformMatrix3x2fv },
+	{ "glProgramUniformMatrix2x4fv", (void**)&gl3wProgramUniformMatrix2x4fv, (void*)recording_glProgramUniformMatrix2x4fv },
+	{ "glProgramUniformMatrix4x2fv", (void**)&gl3wProgramUniformMatrix4x2fv, (void*)recording_glProgramUniformMatrix4x2fv },
+	{ "glProgramUniformMatrix3x4fv", (void**)&gl3wProgramUniformMatrix3x4fv, (void*)recording_glProgramUniformMatrix3x4fv },
+	{ "glProgramUniformMatrix4x3fv", (void**)&gl3wProgramUniformMatrix4x3fv, (void*)recording_glProgramUniformMatrix4x3fv },
+	{ "glProgramUniformMatrix2x3dv", (void**)&gl3wProgramUniformMatrix2x3dv, (void*)recording_glProgramUniformMatrix2x3dv },
+	{ "glProgramUniformMatrix3x2dv", (void**)&gl3wProgramUniformMatrix3x2dv, (void*)recording_glProgramUniformMatrix3x2dv },
+	{ "glProgramUniformMatrix2x4dv", (void**)&gl3wProgramUniformMatrix2x4dv, (void*)recording_glProgramUniformMatrix2x4dv },
+	{ "glProgramUniformMatrix4x2dv", (void**)&gl3wProgramUniformMatrix4x2dv, (void*)recording_glProgramUniformMatrix4x2dv },
+	{ "glProgramUniformMatrix3x4dv", (void**)&gl3wProgramUniformMatrix3x4dv, (void*)recording_glProgramUniformMatrix3x4dv },
+	{ "glProgramUniformMatrix4x3dv", (void**)&gl3wProgramUniformMatrix4x3dv, (void*)recording_glProgramUniformMatrix4x3dv },
+	{ "glValidateProgramPipeline", (void**)&gl3wValidateProgramPipeline, (void*)recording_glValidateProgramPipeline },
+	{ "glGetProgramPipelineInfoLog", (void**)&gl3wGetProgramPipelineInfoLog, (void*)recording_glGetProgramPipelineInfoLog },
+	{ "glVertexAttribL1d", (void**)&gl3wVertexAttribL1d, (void*)recording_glVertexAttribL1d },
+	{ "glVertexAttribL2d", (void**)&gl3wVertexAttribL2d, (void*)recording_glVertexAttribL2d },
+	{ "glVertexAttribL3d", (void**)&gl3wVertexAttribL3d, (void*)recording_glVertexAttribL3d },
+	{ "glVertexAttribL4d", (void**)&gl3wVertexAttribL4d, (void*)recording_glVertexAttribL4d },
+	{ "glVertexAttribL1dv", (void**)&gl3wVertexAttribL1dv, (void*)recording_glVertexAttribL1dv },
+	{ "glVertexAttribL2dv", (void**)&gl3wVertexAttribL2dv, (void*)recording_glVertexAttribL2dv },
+	{ "glVertexAttribL3dv", (void**)&gl3wVertexAttribL3dv, (void*)recording_glVertexAttribL3dv },
+	{ "glVertexAttribL4dv", (void**)&gl3wVertexAttribL4dv, (void*)recording_glVertexAttribL4dv },
+	{ "glVertexAttribLPointer", (void**)&gl3wVertexAttribLPointer, (void*)recording_glVertexAttribLPointer },
+	{ "glGetVertexAttribLdv", (void**)&gl3wGetVertexAttribLdv, (void*)recording_glGetVertexAttribLdv },
+	{ "glViewportArrayv", (void**)&gl3wViewportArrayv, (void*)recording_glViewportArrayv },
+	{ "glViewportIndexedf", (void**)&gl3wViewportIndexedf, (void*)recording_glViewportIndexedf },
+	{ "glViewportIndexedfv", (void**)&gl3wViewportIndexedfv, (void*)recording_glViewportIndexedfv },
+	{ "glScissorArrayv", (void**)&gl3wScissorArrayv, (void*)recording_glScissorArrayv },
+	{ "glScissorIndexed", (void**)&gl3wScissorIndexed, (void*)recording_glScissorIndexed },
+	{ "glScissorIndexedv", (void**)&gl3wScissorIndexedv, (void*)recording_glScissorIndexedv },
+	{ "glDepthRangeArrayv", (void**)&gl3wDepthRangeArrayv, (void*)recording_glDepthRangeArrayv },
+	{ "glDepthRangeIndexed", (void**)&gl3wDepthRangeIndexed, (void*)recording_glDepthRangeIndexed },
+	{ "glGetFloati_v", (void**)&gl3wGetFloati_v, (void*)recording_glGetFloati_v },
+	{ "glGetDoublei_v", (void**)&gl3wGetDoublei_v, (void*)recording_glGetDoublei_v },
+	{ "glDrawArraysInstancedBaseInstance", (void**)&gl3wDrawArraysInstancedBaseInstance, (void*)recording_glDrawArraysInstancedBaseInstance },
+	{ "glDrawElementsInstancedBaseInstance", (void**)&gl3wDrawElementsInstancedBaseInstance, (void*)recording_glDrawElementsInstancedBaseInstance },
+	{ "glDrawElementsInstancedBaseVertexBaseInstance", (void**)&gl3wDrawElementsInstancedBaseVertexBaseInstance, (void*)recording_glDrawElementsInstancedBaseVertexBaseInstance },
+	{ "glGetInternalformativ", (void**)&gl3wGetInternalformativ, (void*)recording_glGetInternalformativ },
+	{ "glGetActiveAtomicCounterBufferiv", (void**)&gl3wGetActiveAtomicCounterBufferiv, (void*)recording_glGetActiveAtomicCounterBufferiv },
+	{ "glBindImageTexture", (void**)&gl3wBindImageTexture, (void*)recording_glBindImageTexture },
+	{ "glMemoryBarrier", (void**)&gl3wMemoryBarrier, (void*)recording_glMemoryBarrier },
+	{ "glTexStorage1D", (void**)&gl3wTexStorage1D, (void*)recording_glTexStorage1D },
+	{ "glTexStorage2D", (void**)&gl3wTexStorage2D, (void*)recording_glTexStorage2D },
+	{ "glTexStorage3D", (void**)&gl3wTexStorage3D, (void*)recording_glTexStorage3D },
+	{ "glDrawTransformFeedbackInstanced", (void**)&gl3wDrawTransformFeedbackInstanced, (void*)recording_glDrawTransformFeedbackInstanced },
+	{ "glDrawTransformFeedbackStreamInstanced", (void**)&gl3wDrawTransformFeedbackStreamInstanced, (void*)recording_glDrawTransformFeedbackStreamInstanced },
+	{ "glClearBufferData", (void**)&gl3wClearBufferData, (void*)recording_glClearBufferData },
+	{ "glClearBufferSubData", (void**)&gl3wClearBufferSubData, (void*)recording_glClearBufferSubData },
+	{ "glDispatchCompute", (void**)&gl3wDispatchCompute, (void*)recording_glDispatchCompute },
+	{ "glDispatchComputeIndirect", (void**)&gl3wDispatchComputeIndirect, (void*)recording_glDispatchComputeIndirect },
+	{ "glCopyImageSubData", (void**)&gl3wCopyImageSubData, (void*)recording_glCopyImageSubData },
+	{ "glFramebufferParameteri", (void**)&gl3wFramebufferParameteri, (void*)recording_glFramebufferParameteri },
+	{ "glGetFramebufferParameteriv", (void**)&gl3wGetFramebufferParameteriv, (void*)recording_glGetFramebufferParameteriv },
+	{ "glGetInternalformati64v", (void**)&gl3wGetInternalformati64v, (void*)recording_glGetInternalformati64v },
+	{ "glInvalidateTexSubImage", (void**)&gl3wInvalidateTexSubImage, (void*)recording_glInvalidateTexSubImage },
+	{ "glInvalidateTexImage", (void**)&gl3wInvalidateTexImage, (void*)recording_glInvalidateTexImage },
+	{ "glInvalidateBufferSubData", (void**)&gl3wInvalidateBufferSubData, (void*)recording_glInvalidateBufferSubData },
+	{ "glInvalidateBufferData", (void**)&gl3wInvalidateBufferData, (void*)recording_glInvalidateBufferData },
+	{ "glInvalidateFramebuffer", (void**)&gl3wInvalidateFramebuffer, (void*)recording_glInvalidateFramebuffer },
+	{ "glInvalidateSubFramebuffer", (void**)&gl3wInvalidateSubFramebuffer, (void*)recording_glInvalidateSubFramebuffer },
+	{ "glMultiDrawArraysIndirect", (void**)&gl3wMultiDrawArraysIndirect, (void*)recording_glMultiDrawArraysIndirect },
+	{ "glMultiDrawElementsIndirect", (void**)&gl3wMultiDrawElementsIndirect, (void*)recording_glMultiDrawElementsIndirect },
+	{ "glGetProgramInterfaceiv", (void**)&gl3wGetProgramInterfaceiv, (void*)recording_glGetProgramInterfaceiv },
+	{ "glGetProgramResourceIndex", (void**)&gl3wGetProgramResourceIndex, (void*)recording_glGetProgramResourceIndex },
+	{ "glGetProgramResourceName", (void**)&gl3wGetProgramResourceName, (void*)recording_glGetProgramResourceName },
+	{ "glGetProgramResourceiv", (void**)&gl3wGetProgramResourceiv, (void*)recording_glGetProgramResourceiv },
+	{ "glGetProgramResourceLocation", (void**)&gl3wGetProgramResourceLocation, (void*)recording_glGetProgramResourceLocation },
+	{ "glGetProgramResourceLocationIndex", (void**)&gl3wGetProgramResourceLocationIndex, (void*)recording_glGetProgramResourceLocationIndex },
+	{ "glShaderStorageBlockBinding", (void**)&gl3wShaderStorageBlockBinding, (void*)recording_glShaderStorageBlockBinding },
+	{ "glTexBufferRange", (void**)&gl3wTexBufferRange, (void*)recording_glTexBufferRange },
+	{ "glTexStorage2DMultisample", (void**)&gl3wTexStorage2DMultisample, (void*)recording_glTexStorage2DMultisample },
+	{ "glTexStorage3DMultisample", (void**)&gl3wTexStorage3DMultisample, (void*)recording_glTexStorage3DMultisample },
+	{ "glTextureView", (void**)&gl3wTextureView, (void*)recording_glTextureView },
+	{ "glBindVertexBuffer", (void**)&gl3wBindVertexBuffer, (void*)recording_glBindVertexBuffer },
+	{ "glVertexAttribFormat", (void**)&gl3wVertexAttribFormat, (void*)recording_glVertexAttribFormat },
+	{ "glVertexAttribIFormat", (void**)&gl3wVertexAttribIFormat, (void*)recording_glVertexAttribIFormat },
+	{ "glVertexAttribLFormat", (void**)&gl3wVertexAttribLFormat, (void*)recording_glVertexAttribLFormat },
+	{ "glVertexAttribBinding", (void**)&gl3wVertexAttribBinding, (void*)recording_glVertexAttribBinding },
+	{ "glVertexBindingDivisor", (void**)&gl3wVertexBindingDivisor, (void*)recording_glVertexBindingDivisor },
+	{ "glDebugMessageControl", (void**)&gl3wDebugMessageControl, (void*)recording_glDebugMessageControl },
+	{ "glDebugMessageInsert", (void**)&gl3wDebugMessageInsert, (void*)recording_glDebugMessageInsert },
+	{ "glDebugMessageCallback", (void**)&gl3wDebugMessageCallback, (void*)recording_glDebugMessageCallback },
+	{ "glGetDebugMessageLog", (void**)&gl3wGetDebugMessageLog, (void*)recording_glGetDebugMessageLog },
+	{ "glPushDebugGroup", (void**)&gl3wPushDebugGroup, (void*)recording_glPushDebugGroup },
+	{ "glPopDebugGroup", (void**)&gl3wPopDebugGroup, (void*)recording_glPopDebugGroup },
+	{ "glObjectLabel", (void**)&gl3wObjectLabel, (void*)recording_glObjectLabel },
+	{ "glGetObjectLabel", (void**)&gl3wGetObjectLabel, (void*)recording_glGetObjectLabel },
+	{ "glObjectPtrLabel", (void**)&gl3wObjectPtrLabel, (void*)recording_glObjectPtrLabel },
+	{ "glGetObjectPtrLabel", (void**)&gl3wGetObjectPtrLabel, (void*)recording_glGetObjectPtrLabel },
+	{ "glBufferStorage", (void**)&gl3wBufferStorage, (void*)recording_glBufferStorage },
+	{ "glClearTexImage", (void**)&gl3wClearTexImage, (void*)recording_glClearTexImage },
+	{ "glClearTexSubImage", (void**)&gl3wClearTexSubImage, (void*)recording_glClearTexSubImage },
+	{ "glBindBuffersBase", (void**)&gl3wBindBuffersBase, (void*)recording_glBindBuffersBase },
+	{ "glBindBuffersRange", (void**)&gl3wBindBuffersRange, (void*)recording_glBindBuffersRange },
+	{ "glBindTextures", (void**)&gl3wBindTextures, (void*)recording_glBindTextures },
+	{ "glBindSamplers", (void**)&gl3wBindSamplers, (void*)recording_glBindSamplers },
+	{ "glBindImageTextures", (void**)&gl3wBindImageTextures, (void*)recording_glBindImageTextures },
+	{ "glBindVertexBuffers", (void**)&gl3wBindVertexBuffers, (void*)recording_glBindVertexBuffers },
+	{ "glClipControl", (void**)&gl3wClipControl, (void*)recording_glClipControl },
+	{ "glCreateTransformFeedbacks", (void**)&gl3wCreateTransformFeedbacks, (void*)recording_glCreateTransformFeedbacks },
+	{ "glTransformFeedbackBufferBase", (void**)&gl3wTransformFeedbackBufferBase, (void*)recording_glTransformFeedbackBufferBase },
+	{ "glTransformFeedbackBufferRange", (void**)&gl3wTransformFeedbackBufferRange, (void*)recording_glTransformFeedbackBufferRange },
+	{ "glGetTransformFeedbackiv", (void**)&gl3wGetTransformFeedbackiv, (void*)recording_glGetTransformFeedbackiv },
+	{ "glGetTransformFeedbacki_v", (void**)&gl3wGetTransformFeedbacki_v, (void*)recording_glGetTransformFeedbacki_v },
+	{ "glGetTransformFeedbacki64_v", (void**)&gl3wGetTransformFeedbacki64_v, (void*)recording_glGetTransformFeedbacki64_v },
+	{ "glCreateBuffers", (void**)&gl3wCreateBuffers, (void*)recording_glCreateBuffers },
+	{ "glNamedBufferStorage", (void**)&gl3wNamedBufferStorage, (void*)recording_glNamedBufferStorage },
+	{ "glNamedBufferData", (void**)&gl3wNamedBufferData, (void*)recording_glNamedBufferData },
+	{ "glNamedBufferSubData", (void**)&gl3wNamedBufferSubData, (void*)recording_glNamedBufferSubData },
+	{ "glCopyNamedBufferSubData", (void**)&gl3wCopyNamedBufferSubData, (void*)recording_glCopyNamedBufferSubData },
+	{ "glClearNamedBufferData", (void**)&gl3wClearNamedBufferData, (void*)recording_glClearNamedBufferData },
+	{ "glClearNamedBufferSubData", (void**)&gl3wClearNamedBufferSubData, (void*)recording_glClearNamedBufferSubData },
+	{ "glMapNamedBuffer", (void**)&gl3wMapNamedBuffer, (void*)recording_glMapNamedBuffer },
+	{ "glMapNamedBufferRange", (void**)&gl3wMapNamedBufferRange, (void*)recording_glMapNamedBufferRange },
+	{ "glUnmapNamedBuffer", (void**)&gl3wUnmapNamedBuffer, (void*)recording_glUnmapNamedBuffer },
+	{ "glFlushMappedNamedBufferRange", (void**)&gl3wFlushMappedNamedBufferRange, (void*)recording_glFlushMappedNamedBufferRange },
+	{ "glGetNamedBufferParameteriv", (void**)&gl3wGetNamedBufferParameteriv, (void*)recording_glGetNamedBufferParameteriv },
+	{ "glGetNamedBufferParameteri64v", (void**)&gl3wGetNamedBufferParameteri64v, (void*)recording_glGetNamedBufferParameteri64v },
+	{ "glGetNamedBufferPointerv", (void**)&gl3wGetNamedBufferPointerv, (void*)recording_glGetNamedBufferPointerv },
+	{ "glGetNamedBufferSubData", (void**)&gl3wGetNamedBufferSubData, (void*)recording_glGetNamedBufferSubData },
+	{ "glCreateFramebuffers", (void**)&gl3wCreateFramebuffers, (void*)recording_glCreateFramebuffers },
+	{ "glNamedFramebufferRenderbuffer", (void**)&gl3wNamedFramebufferRenderbuffer, (void*)recording_glNamedFramebufferRenderbuffer },
+	{ "glNamedFramebufferParameteri", (void**)&gl3wNamedFramebufferParameteri, (void*)recording_glNamedFramebufferParameteri },
+	{ "glNamedFramebufferTexture", (void**)&gl3wNamedFramebufferTexture, (void*)recording_glNamedFramebufferTexture },
+	{ "glNamedFramebufferTextureLayer", (void**)&gl3wNamedFramebufferTextureLayer, (void*)recording_glNamedFramebufferTextureLayer },
+	{ "glNamedFramebufferDrawBuffer", (void**)&gl3wNamedFramebufferDrawBuffer, (void*)recording_glNamedFramebufferDrawBuffer },
+	{ "glNamedFramebufferDrawBuffers", (void**)&gl3wNamedFramebufferDrawBuffers, (void*)recording_glNamedFramebufferDrawBuffers },
+	{ "glNamedFramebufferReadBuffer", (void**)&gl3wNamedFramebufferReadBuffer, (void*)recording_glNamedFramebufferReadBuffer },
+	{ "glInvalidateNamedFramebufferData", (void**)&gl3wInvalidateNamedFramebufferData, (void*)recording_glInvalidateNamedFramebufferData },
+	{ "glInvalidateNamedFramebufferSubData", (void**)&gl3wInvalidateNamedFramebufferSubData, (void*)recording_glInvalidateNamedFramebufferSubData },
+	{ "glClearNamedFramebufferiv", (void**)&gl3wClearNamedFramebufferiv, (void*)recording_glClearNamedFramebufferiv },
+	{ "glClearNamedFramebufferuiv", (void**)&gl3wClearNamedFramebufferuiv, (void*)recording_glClearNamedFramebufferuiv },
+	{ "glClearNamedFramebufferfv", (void**)&gl3wClearNamedFramebufferfv, (void*)recording_glClearNamedFramebufferfv },
+	{ "glClearNamedFramebufferfi", (void**)&gl3wClearNamedFramebufferfi, (void*)recording_glClearNamedFramebufferfi },
+	{ "glBlitNamedFramebuffer", (void**)&gl3wBlitNamedFramebuffer, (void*)recording_glBlitNamedFramebuffer },
+	{ "glCheckNamedFramebufferStatus", (void**)&gl3wCheckNamedFramebufferStatus, (void*)recording_glCheckNamedFramebufferStatus },
+	{ "glGetNamedFramebufferParameteriv", (void**)&gl3wGetNamedFramebufferParameteriv, (void*)recording_glGetNamedFramebufferParameteriv },
+	{ "glGetNamedFramebufferAttachmentParameteriv", (void**)&gl3wGetNamedFramebufferAttachmentParameteriv, (void*)recording_glGetNamedFramebufferAttachmentParameteriv },
+	{ "glCreateRenderbuffers", (void**)&gl3wCreateRenderbuffers, (void*)recording_glCreateRenderbuffers },
+	{ "glNamedRenderbufferStorage", (void**)&gl3wNamedRenderbufferStorage, (void*)recording_glNamedRenderbufferStorage },
+	{ "glNamedRenderbufferStorageMultisample", (void**)&gl3wNamedRenderbufferStorageMultisample, (void*)recording_glNamedRenderbufferStorageMultisample },
+	{ "glGetNamedRenderbufferParameteriv", (void**)&gl3wGetNamedRenderbufferParameteriv, (void*)recording_glGetNamedRenderbufferParameteriv },
+	{ "glCreateTextures", (void**)&gl3wCreateTextures, (void*)recording_glCreateTextures },
+	{ "glTextureBuffer", (void**)&gl3wTextureBuffer, (void*)recording_glTextureBuffer },
+	{ "glTextureBufferRange", (void**)&gl3wTextureBufferRange, (void*)recording_glTextureBufferRange },
+	{ "glTextureStorage1D", (void**)&gl3wTextureStorage1D, (void*)recording_glTextureStorage1D },
+	{ "glTextureStorage2D", (void**)&gl3wTextureStorage2D, (void*)recording_glTextureStorage2D },
+	{ "glTextureStorage3D", (void**)&gl3wTextureStorage3D, (void*)recording_glTextureStorage3D },
+	{ "glTextureStorage2DMultisample", (void**)&gl3wTextureStorage2DMultisample, (void*)recording_glTextureStorage2DMultisample },
+	{ "glTextureStorage3DMultisample", (void**)&gl3wTextureStorage3DMultisample, (void*)recording_glTextureStorage3DMultisample },
+	{ "glTextureSubImage1D", (void**)&gl3wTextureSubImage1D, (void*)recording_glTextureSubImage1D },
+	{ "glTextureSubImage2D", (void**)&gl3wTextureSubImage2D, (void*)recording_glTextureSubImage2D },
+	{ "glTextureSubImage3D", (void**)&gl3wTextureSubImage3D, (void*)recording_glTextureSubImage3D },
+	{ "glCompressedTextureSubImage1D", (void**)&gl3wCompressedTextureSubImage1D, (void*)recording_glCompressedTextureSubImage1D },
+	{ "glCompressedTextureSubImage2D", (void**)&gl3wCompressedTextureSubImage2D, (void*)recording_glCompressedTextureSubImage2D },
+	{ "glCompressedTextureSubImage3D", (void**)&gl3wCompressedTextureSubImage3D, (void*)recording_glCompressedTextureSubImage3D },
+	{ "glCopyTextureSubImage1D", (void**)&gl3wCopyTextureSubImage1D, (void*)recording_glCopyTextureSubImage1D },
+	{ "glCopyTextureSubImage2D", (void**)&gl3wCopyTextureSubImage2D, (void*)recording_glCopyTextureSubImage2D },
+	{ "glCopyTextureSubImage3D", (void**)&gl3wCopyTextureSubImage3D, (void*)recording_glCopyTextureSubImage3D },
+	{ "glTextureParameterf", (void**)&gl3wTextureParameterf, (void*)recording_glTextureParameterf },
+	{ "glTextureParameterfv", (void**)&gl3wTextureParameterfv, (void*)recording_glTextureParameterfv },
+	{ "glTextureParameteri", (void**)&gl3wTextureParameteri, (void*)recording_glTextureParameteri },
+	{ "glTextureParameterIiv", (void**)&gl3wTextureParameterIiv, (void*)recording_glTextureParameterIiv },
+	{ "glTextureParameterIuiv", (void**)&gl3wTextureParameterIuiv, (void*)recording_glTextureParameterIuiv },
+	{ "glTextureParameteriv", (void**)&gl3wTextureParameteriv, (void*)recording_glTextureParameteriv },
+	{ "glGenerateTextureMipmap", (void**)&gl3wGenerateTextureMipmap, (void*)recording_glGenerateTextureMipmap },
+	{ "glBindTextureUnit", (void**)&gl3wBindTextureUnit, (void*)recording_glBindTextureUnit },
+	{ "glGetTextureImage", (void**)&gl3wGetTextureImage, (void*)recording_glGetTextureImage },
+	{ "glGetCompressedTextureImage", (void**)&gl3wGetCompressedTextureImage, (void*)recording_glGetCompressedTextureImage },
+	{ "glGetTextureLevelParameterfv", (void**)&gl3wGetTextureLevelParameterfv, (void*)recording_glGetTextureLevelParameterfv },
+	{ "glGetTextureLevelParameteriv", (void**)&gl3wGetTextureLevelParameteriv, (void*)recording_glGetTextureLevelParameteriv },
+	{ "glGetTextureParameterfv", (void**)&gl3wGetTextureParameterfv, (void*)recording_glGetTextureParameterfv },
+	{ "glGetTextureParameterIiv", (void**)&gl3wGetTextureParameterIiv, (void*)recording_glGetTextureParameterIiv },
+	{ "glGetTextureParameterIuiv", (void**)&gl3wGetTextureParameterIuiv, (void*)recording_glGetTextureParameterIuiv },
+	{ "glGetTextureParameteriv", (void**)&gl3wGetTextureParameteriv, (void*)recording_glGetTextureParameteriv },
+	{ "glCreateVertexArrays", (void**)&gl3wCreateVertexArrays, (void*)recording_glCreateVertexArrays },
+	{ "glDisableVertexArrayAttrib", (void**)&gl3wDisableVertexArrayAttrib, (void*)recording_glDisableVertexArrayAttrib },
+	{ "glEnableVertexArrayAttrib", (void**)&gl3wEnableVertexArrayAttrib, (void*)recording_glEnableVertexArrayAttrib },
+	{ "glVertexArrayElementBuffer", (void**)&gl3wVertexArrayElementBuffer, (void*)recording_glVertexArrayElementBuffer },
+	{ "glVertexArrayVertexBuffer", (void**)&gl3wVertexArrayVertexBuffer, (void*)recording_glVertexArrayVertexBuffer },
+	{ "glVertexArrayVertexBuffers", (void**)&gl3wVertexArrayVertexBuffers, (void*)recording_glVertexArrayVertexBuffers },
+	{ "glVertexArrayAttribBinding", (void**)&gl3wVertexArrayAttribBinding, (void*)recording_glVertexArrayAttribBinding },
+	{ "glVertexArrayAttribFormat", (void**)&gl3wVertexArrayAttribFormat, (void*)recording_glVertexArrayAttribFormat },
+	{ "glVertexArrayAttribIFormat", (void**)&gl3wVertexArrayAttribIFormat, (void*)recording_glVertexArrayAttribIFormat },
+	{ "glVertexArrayAttribLFormat", (void**)&gl3wVertexArrayAttribLFormat, (void*)recording_glVertexArrayAttribLFormat },
+	{ "glVertexArrayBindingDivisor", (void**)&gl3wVertexArrayBindingDivisor, (void*)recording_glVertexArrayBindingDivisor },
+	{ "glGetVertexArrayiv", (void**)&gl3wGetVertexArrayiv, (void*)recording_glGetVertexArrayiv },
+	{ "glGetVertexArrayIndexediv", (void**)&gl3wGetVertexArrayIndexediv, (void*)recording_glGetVertexArrayIndexediv },
+	{ "glGetVertexArrayIndexed64iv", (void**)&gl3wGetVertexArrayIndexed64iv, (void*)recording_glGetVertexArrayIndexed64iv },
+	{ "glCreateSamplers", (void**)&gl3wCreateSamplers, (void*)recording_glCreateSamplers },
+	{ "glCreateProgramPipelines", (void**)&gl3wCreateProgramPipelines, (void*)recording_glCreateProgramPipelines },
+	{ "glCreateQueries", (void**)&gl3wCreateQueries, (void*)recording_glCreateQueries },
+	{ "glGetQueryBufferObjecti64v", (void**)&gl3wGetQueryBufferObjecti64v, (void*)recording_glGetQueryBufferObjecti64v },
+	{ "glGetQueryBufferObjectiv", (void**)&gl3wGetQueryBufferObjectiv, (void*)recording_glGetQueryBufferObjectiv },
+	{ "glGetQueryBufferObjectui64v", (void**)&gl3wGetQueryBufferObjectui64v, (void*)recording_glGetQueryBufferObjectui64v },
+	{ "glGetQueryBufferObjectuiv", (void**)&gl3wGetQueryBufferObjectuiv, (void*)recording_glGetQueryBufferObjectuiv },
+	{ "glMemoryBarrierByRegion", (void**)&gl3wMemoryBarrierByRegion, (void*)recording_glMemoryBarrierByRegion },
+	{ "glGetTextureSubImage", (void**)&gl3wGetTextureSubImage, (void*)recording_glGetTextureSubImage },
+	{ "glGetCompressedTextureSubImage", (void**)&gl3wGetCompressedTextureSubImage, (void*)recording_glGetCompressedTextureSubImage },
+	{ "glGetGraphicsResetStatus", (void**)&gl3wGetGraphicsResetStatus, (void*)recording_glGetGraphicsResetStatus },
+	{ "glGetnCompressedTexImage", (void**)&gl3wGetnCompressedTexImage, (void*)recording_glGetnCompressedTexImage },
+	{ "glGetnTexImage", (void**)&gl3wGetnTexImage, (void*)recording_glGetnTexImage },
+	{ "glGetnUniformdv", (void**)&gl3wGetnUniformdv, (void*)recording_glGetnUniformdv },
+	{ "glGetnUniformfv", (void**)&gl3wGetnUniformfv, (void*)recording_glGetnUniformfv },
+	{ "glGetnUniformiv", (void**)&gl3wGetnUniformiv, (void*)recording_glGetnUniformiv },
+	{ "glGetnUniformuiv", (void**)&gl3wGetnUniformuiv, (void*)recording_glGetnUniformuiv },
+	{ "glReadnPixels", (void**)&gl3wReadnPixels, (void*)recording_glReadnPixels },
+	{ "glTextureBarrier", (void**)&gl3wTextureBarrier, (void*)recording_glTextureBarrier },
+	{ "glSpecializeShader", (void**)&gl3wSpecializeShader, (void*)recording_glSpecializeShader },
+	{ "glMultiDrawArraysIndirectCount", (void**)&gl3wMultiDrawArraysIndirectCount, (void*)recording_glMultiDrawArraysIndirectCount },
+	{ "glMultiDrawElementsIndirectCount", (void**)&gl3wMultiDrawElementsIndirectCount, (void*)recording_glMultiDrawElementsIndirectCount },
+	{ "glPolygonOffsetClamp", (void**)&gl3wPolygonOffsetClamp, (void*)recording_glPolygonOffsetClamp },
+	{ "glPrimitiveBoundingBoxARB", (void**)&gl3wPrimitiveBoundingBoxARB, (void*)recording_glPrimitiveBoundingBoxARB },
+	{ "glGetTextureHandleARB", (void**)&gl3wGetTextureHandleARB, (void*)recording_glGetTextureHandleARB },
+	{ "glGetTextureSamplerHandleARB", (void**)&gl3wGetTextureSamplerHandleARB, (void*)recording_glGetTextureSamplerHandleARB },
+	{ "glMakeTextureHandleResidentARB", (void**)&gl3wMakeTextureHandleResidentARB, (void*)recording_glMakeTextureHandleResidentARB },
+	{ "glMakeTextureHandleNonResidentARB", (void**)&gl3wMakeTextureHandleNonResidentARB, (void*)recording_glMakeTextureHandleNonResidentARB },
+	{ "glGetImageHandleARB", (void**)&gl3wGetImageHandleARB, (void*)recording_glGetImageHandleARB },
+	{ "glMakeImageHandleResidentARB", (void**)&gl3wMakeImageHandleResidentARB, (void*)recording_glMakeImageHandleResidentARB },
+	{ "glMakeImageHandleNonResidentARB", (void**)&gl3wMakeImageHandleNonResidentARB, (void*)recording_glMakeImageHandleNonResidentARB },
+	{ "glUniformHandleui64ARB", (void**)&gl3wUniformHandleui64ARB, (void*)recording_glUniformHandleui64ARB },
+	{ "glUniformHandleui64vARB", (void**)&gl3wUniformHandleui64vARB, (void*)recording_glUniformHandleui64vARB },
+	{ "glProgramUniformHandleui64ARB", (void**)&gl3wProgramUniformHandleui64ARB, (void*)recording_glProgramUniformHandleui64ARB },
+	{ "glProgramUniformHandleui64vARB", (void**)&gl3wProgramUniformHandleui64vARB, (void*)recording_glProgramUniformHandleui64vARB },
+	{ "glIsTextureHandleResidentARB", (void**)&gl3wIsTextureHandleResidentARB, (void*)recording_glIsTextureHandleResidentARB },
+	{ "glIsImageHandleResidentARB", (void**)&gl3wIsImageHandleResidentARB, (void*)recording_glIsImageHandleResidentARB },
+	{ "glVertexAttribL1ui64ARB", (void**)&gl3wVertexAttribL1ui64ARB, (void*)recording_glVertexAttribL1ui64ARB },
+	{ "glVertexAttribL1ui64vARB", (void**)&gl3wVertexAttribL1ui64vARB, (void*)recording_glVertexAttribL1ui64vARB },
+	{ "glGetVertexAttribLui64vARB", (void**)&gl3wGetVertexAttribLui64vARB, (void*)recording_glGetVertexAttribLui64vARB },
+	{ "glCreateSyncFromCLeventARB", (void**)&gl3wCreateSyncFromCLeventARB, (void*)recording_glCreateSyncFromCLeventARB },
+	{ "glDispatchComputeGroupSizeARB", (void**)&gl3wDispatchComputeGroupSizeARB, (void*)recording_glDispatchComputeGroupSizeARB },
+	{ "glDebugMessageControlARB", (void**)&gl3wDebugMessageControlARB, (void*)recording_glDebugMessageControlARB },
+	{ "glDebugMessageInsertARB", (void**)&gl3wDebugMessageInsertARB, (void*)recording_glDebugMessageInsertARB },
+	{ "glDebugMessageCallbackARB", (void**)&gl3wDebugMessageCallbackARB, (void*)recording_glDebugMessageCallbackARB },
+	{ "glGetDebugMessageLogARB", (void**)&gl3wGetDebugMessageLogARB, (void*)recording_glGetDebugMessageLogARB },
+	{ "glBlendEquationiARB", (void**)&gl3wBlendEquationiARB, (void*)recording_glBlendEquationiARB },
+	{ "glBlendEquationSeparateiARB", (void**)&gl3wBlendEquationSeparateiARB, (void*)recording_glBlendEquationSeparateiARB },
+	{ "glBlendFunciARB", (void**)&gl3wBlendFunciARB, (void*)recording_glBlendFunciARB },
+	{ "glBlendFuncSeparateiARB", (void**)&gl3wBlendFuncSeparateiARB, (void*)recording_glBlendFuncSeparateiARB },
+	{ "glDrawArraysInstancedARB", (void**)&gl3wDrawArraysInstancedARB, (void*)recording_glDrawArraysInstancedARB },
+	{ "glDrawElementsInstancedARB", (void**)&gl3wDrawElementsInstancedARB, (void*)recording_glDrawElementsInstancedARB },
+	{ "glProgramParameteriARB", (void**)&gl3wProgramParameteriARB, (void*)recording_glProgramParameteriARB },
+	{ "glFramebufferTextureARB", (void**)&gl3wFramebufferTextureARB, (void*)recording_glFramebufferTextureARB },
+	{ "glFramebufferTextureLayerARB", (void**)&gl3wFramebufferTextureLayerARB, (void*)recording_glFramebufferTextureLayerARB },
+	{ "glFramebufferTextureFaceARB", (void**)&gl3wFramebufferTextureFaceARB, (void*)recording_glFramebufferTextureFaceARB },
+	{ "glSpecializeShaderARB", (void**)&gl3wSpecializeShaderARB, (void*)recording_glSpecializeShaderARB },
+	{ "glUniform1i64ARB", (void**)&gl3wUniform1i64ARB, (void*)recording_glUniform1i64ARB },
+	{ "glUniform2i64ARB", (void**)&gl3wUniform2i64ARB, (void*)recording_glUniform2i64ARB },
+	{ "glUniform3i64ARB", (void**)&gl3wUniform3i64ARB, (void*)recording_glUniform3i64ARB },
+	{ "glUniform4i64ARB", (void**)&gl3wUniform4i64ARB, (void*)recording_glUniform4i64ARB },
+	{ "glUniform1i64vARB", (void**)&gl3wUniform1i64vARB, (void*)recording_glUniform1i64vARB },
+	{ "glUniform2i64vARB", (void**)&gl3wUniform2i64vARB, (void*)recording_glUniform2i64vARB },
+	{ "glUniform3i64vARB", (void**)&gl3wUniform3i64vARB, (void*)recording_glUniform3i64vARB },
+	{ "glUniform4i64vARB", (void**)&gl3wUniform4i64vARB, (void*)recording_glUniform4i64vARB },
+	{ "glUniform1ui64ARB", (void**)&gl3wUniform1ui64ARB, (void*)recording_glUniform1ui64ARB },
+	{ "glUniform2ui64ARB", (void**)&gl3wUniform2ui64ARB, (void*)recording_glUniform2ui64ARB },
+	{ "glUniform3ui64ARB", (void**)&gl3wUniform3ui64ARB, (void*)recording_glUniform3ui64ARB },
+	{ "glUniform4ui64ARB", (void**)&gl3wUniform4ui64ARB, (void*)recording_glUniform4ui64ARB },
+	{ "glUniform1ui64vARB", (void**)&gl3wUniform1ui64vARB, (void*)recording_glUniform1ui64vARB },
+	{ "glUniform2ui64vARB", (void**)&gl3wUniform2ui64vARB, (void*)recording_glUniform2ui64vARB },
+	{ "glUniform3ui64vARB", (void**)&gl3wUniform3ui64vARB, (void*)recording_glUniform3ui64vARB },
+	{ "glUniform4ui64vARB", (void**)&gl3wUniform4ui64vARB, (void*)recording_glUniform4ui64vARB },
+	{ "glGetUniformi64vARB", (void**)&gl3wGetUniformi64vARB, (void*)recording_glGetUniformi64vARB },
+	{ "glGetUniformui64vARB", (void**)&gl3wGetUniformui64vARB, (void*)recording_glGetUniformui64vARB },
+	{ "glGetnUniformi64vARB", (void**)&gl3wGetnUniformi64vARB, (void*)recording_glGetnUniformi64vARB },
+	{ "glGetnUniformui64vARB", (void**)&gl3wGetnUniformui64vARB, (void*)recording_glGetnUniformui64vARB },
+	{ "glProgramUniform1i64ARB", (void**)&gl3wProgramUniform1i64ARB, (void*)recording_glProgramUniform1i64ARB },
+	{ "glProgramUniform2i64ARB", (void**)&gl3wProgramUniform2i64ARB, (void*)recording_glProgramUniform2i64ARB },
+	{ "glProgramUniform3i64ARB", (void**)&gl3wProgramUniform3i64ARB, (void*)recording_glProgramUniform3i64ARB },
+	{ "glProgramUniform4i64ARB", (void**)&gl3wProgramUniform4i64ARB, (void*)recording_glProgramUniform4i64ARB },
+	{ "glProgramUniform1i64vARB", (void**)&gl3wProgramUniform1i64vARB, (void*)recording_glProgramUniform1i64vARB },
+	{ "glProgramUniform2i64vARB", (void**)&gl3wProgramUniform2i64vARB, (void*)recording_glProgramUniform2i64vARB },
+	{ "glProgramUniform3i64vARB", (void**)&gl3wProgramUniform3i64vARB, (void*)recording_glProgramUniform3i64vARB },
+	{ "glProgramUniform4i64vARB", (void**)&gl3wProgramUniform4i64vARB, (void*)recording_glProgramUniform4i64vARB },
+	{ "glProgramUniform1ui64ARB", (void**)&gl3wProgramUniform1ui64ARB, (void*)recording_glProgramUniform1ui64ARB },
+	{ "glProgramUniform2ui64ARB", (void**)&gl3wProgramUniform2ui64ARB, (void*)recording_glProgramUniform2ui64ARB },
+	{ "glProgramUniform3ui64ARB", (void**)&gl3wProgramUniform3ui64ARB, (void*)recording_glProgramUniform3ui64ARB },
+	{ "glProgramUniform4ui64ARB", (void**)&gl3wProgramUniform4ui64ARB, (void*)recording_glProgramUniform4ui64ARB },
+	{ "glProgramUniform1ui64vARB", (void**)&gl3wProgramUniform1ui64vARB, (void*)recording_glProgramUniform1ui64vARB },
+	{ "glProgramUniform2ui64vARB", (void**)&gl3wProgramUniform2ui64vARB, (void*)recording_glProgramUniform2ui64vARB },
+	{ "glProgramUniform3ui64vARB", (void**)&gl3wProgramUniform3ui64vARB, (void*)recording_glProgramUniform3ui64vARB },
+	{ "glProgramUniform4ui64vARB", (void**)&gl3wProgramUniform4ui64vARB, (void*)recording_glProgramUniform4ui64vARB },
+	{ "glMultiDrawArraysIndirectCountARB", (void**)&gl3wMultiDrawArraysIndirectCountARB, (void*)recording_glMultiDrawArraysIndirectCountARB },
+	{ "glMultiDrawElementsIndirectCountARB", (void**)&gl3wMultiDrawElementsIndirectCountARB, (void*)recording_glMultiDrawElementsIndirectCountARB },
+	{ "glVertexAttribDivisorARB", (void**)&gl3wVertexAttribDivisorARB, (void*)recording_glVertexAttribDivisorARB },
+	{ "glMaxShaderCompilerThreadsARB", (void**)&gl3wMaxShaderCompilerThreadsARB, (void*)recording_glMaxShaderCompilerThreadsARB },
+	{ "glGetGraphicsResetStatusARB", (void**)&gl3wGetGraphicsResetStatusARB, (void*)recording_glGetGraphicsResetStatusARB },
+	{ "glGetnTexImageARB", (void**)&gl3wGetnTexImageARB, (void*)recording_glGetnTexImageARB },
+	{ "glReadnPixelsARB", (void**)&gl3wReadnPixelsARB, (void*)recording_glReadnPixelsARB },
+	{ "glGetnCompressedTexImageARB", (void**)&gl3wGetnCompressedTexImageARB, (void*)recording_glGetnCompressedTexImageARB },
+	{ "glGetnUniformfvARB", (void**)&gl3wGetnUniformfvARB, (void*)recording_glGetnUniformfvARB },
+	{ "glGetnUniformivARB", (void**)&gl3wGetnUniformivARB, (void*)recording_glGetnUniformivARB },
+	{ "glGetnUniformuivARB", (void**)&gl3wGetnUniformuivARB, (void*)recording_glGetnUniformuivARB },
+	{ "glGetnUniformdvARB", (void**)&gl3wGetnUniformdvARB, (void*)recording_glGetnUniformdvARB },
+	{ "glFramebufferSampleLocationsfvARB", (void**)&gl3wFramebufferSampleLocationsfvARB, (void*)recording_glFramebufferSampleLocationsfvARB },
+	{ "glNamedFramebufferSampleLocationsfvARB", (void**)&gl3wNamedFramebufferSampleLocationsfvARB, (void*)recording_glNamedFramebufferSampleLocationsfvARB },
+	{ "glEvaluateDepthValuesARB", (void**)&gl3wEvaluateDepthValuesARB, (void*)recording_glEvaluateDepthValuesARB },
+	{ "glMinSampleShadingARB", (void**)&gl3wMinSampleShadingARB, (void*)recording_glMinSampleShadingARB },
+	{ "glNamedStringARB", (void**)&gl3wNamedStringARB, (void*)recording_glNamedStringARB },
+	{ "glDeleteNamedStringARB", (void**)&gl3wDeleteNamedStringARB, (void*)recording_glDeleteNamedStringARB },
+	{ "glCompileShaderIncludeARB", (void**)&gl3wCompileShaderIncludeARB, (void*)recording_glCompileShaderIncludeARB },
+	{ "glIsNamedStringARB", (void**)&gl3wIsNamedStringARB, (void*)recording_glIsNamedStringARB },
+	{ "glGetNamedStringARB", (void**)&gl3wGetNamedStringARB, (void*)recording_glGetNamedStringARB },
+	{ "glGetNamedStringivARB", (void**)&gl3wGetNamedStringivARB, (void*)recording_glGetNamedStringivARB },
+	{ "glBufferPageCommitmentARB", (void**)&gl3wBufferPageCommitmentARB, (void*)recording_glBufferPageCommitmentARB },
+	{ "glNamedBufferPageCommitmentEXT", (void**)&gl3wNamedBufferPageCommitmentEXT, (void*)recording_glNamedBufferPageCommitmentEXT },
+	{ "glNamedBufferPageCommitmentARB", (void**)&gl3wNamedBufferPageCommitmentARB, (void*)recording_glNamedBufferPageCommitmentARB },
+	{ "glTexPageCommitmentARB", (void**)&gl3wTexPageCommitmentARB, (void*)recording_glTexPageCommitmentARB },
+	{ "glTexBufferARB", (void**)&gl3wTexBufferARB, (void*)recording_glTexBufferARB },
+	{ "glBlendBarrierKHR", (void**)&gl3wBlendBarrierKHR, (void*)recording_glBlendBarrierKHR },
+	{ "glMaxShaderCompilerThreadsKHR", (void**)&gl3wMaxShaderCompilerThreadsKHR, (void*)recording_glMaxShaderCompilerThreadsKHR },
+	{ "glRenderbufferStorageMultisampleAdvancedAMD", (void**)&gl3wRenderbufferStorageMultisampleAdvancedAMD, (void*)recording_glRenderbufferStorageMultisampleAdvancedAMD },
+	{ "glNamedRenderbufferStorageMultisampleAdvancedAMD", (void**)&gl3wNamedRenderbufferStorageMultisampleAdvancedAMD, (void*)recording_glNamedRenderbufferStorageMultisampleAdvancedAMD },
+	{ "glGetPerfMonitorGroupsAMD", (void**)&gl3wGetPerfMonitorGroupsAMD, (void*)recording_glGetPerfMonitorGroupsAMD },
+	{ "glGetPerfMonitorCountersAMD", (void**)&gl3wGetPerfMonitorCountersAMD, (void*)recording_glGetPerfMonitorCountersAMD },
+	{ "glGetPerfMonitorGroupStringAMD", (void**)&gl3wGetPerfMonitorGroupStringAMD, (void*)recording_glGetPerfMonitorGroupStringAMD },
+	{ "glGetPerfMonitorCounterStringAMD", (void**)&gl3wGetPerfMonitorCounterStringAMD, (void*)recording_glGetPerfMonitorCounterStringAMD },
+	{ "glGetPerfMonitorCounterInfoAMD", (void**)&gl3wGetPerfMonitorCounterInfoAMD, (void*)recording_glGetPerfMonitorCounterInfoAMD },
+	{ "glGenPerfMonitorsAMD", (void**)&gl3wGenPerfMonitorsAMD, (void*)recording_glGenPerfMonitorsAMD },
+	{ "glDeletePerfMonitorsAMD", (void**)&gl3wDeletePerfMonitorsAMD, (void*)recording_glDeletePerfMonitorsAMD },
+	{ "glSelectPerfMonitorCountersAMD", (void**)&gl3wSelectPerfMonitorCountersAMD, (void*)recording_glSelectPerfMonitorCountersAMD },
+	{ "glBeginPerfMonitorAMD", (void**)&gl3wBeginPerfMonitorAMD, (void*)recording_glBeginPerfMonitorAMD },
+	{ "glEndPerfMonitorAMD", (void**)&gl3wEndPerfMonitorAMD, (void*)recording_glEndPerfMonitorAMD },
+	{ "glGetPerfMonitorCounterDataAMD", (void**)&gl3wGetPerfMonitorCounterDataAMD, (void*)recording_glGetPerfMonitorCounterDataAMD },
+	{ "glEGLImageTargetTexStorageEXT", (void**)&gl3wEGLImageTargetTexStorageEXT, (void*)recording_glEGLImageTargetTexStorageEXT },
+	{ "glEGLImageTargetTextureStorageEXT", (void**)&gl3wEGLImageTargetTextureStorageEXT, (void*)recording_glEGLImageTargetTextureStorageEXT },
+	{ "glLabelObjectEXT", (void**)&gl3wLabelObjectEXT, (void*)recording_glLabelObjectEXT },
+	{ "glGetObjectLabelEXT", (void**)&gl3wGetObjectLabelEXT, (void*)recording_glGetObjectLabelEXT },
+	{ "glInsertEventMarkerEXT", (void**)&gl3wInsertEventMarkerEXT, (void*)recording_glInsertEventMarkerEXT },
+	{ "glPushGroupMarkerEXT", (void**)&gl3wPushGroupMarkerEXT, (void*)recording_glPushGroupMarkerEXT },
+	{ "glPopGroupMarkerEXT", (void**)&gl3wPopGroupMarkerEXT, (void*)recording_glPopGroupMarkerEXT },
+	{ "glMatrixLoadfEXT", (void**)&gl3wMatrixLoadfEXT, (void*)recording_glMatrixLoadfEXT },
+	{ "glMatrixLoaddEXT", (void**)&gl3wMatrixLoaddEXT, (void*)recording_glMatrixLoaddEXT },
+	{ "glMatrixMultfEXT", (void**)&gl3wMatrixMultfEXT, (void*)recording_glMatrixMultfEXT },
+	{ "glMatrixMultdEXT", (void**)&gl3wMatrixMultdEXT, (void*)recording_glMatrixMultdEXT },
+	{ "glMatrixLoadIdentityEXT", (void**)&gl3wMatrixLoadIdentityEXT, (void*)recording_glMatrixLoadIdentityEXT },
+	{ "glMatrixRotatefEXT", (void**)&gl3wMatrixRotatefEXT, (void*)recording_glMatrixRotatefEXT },
+	{ "glMatrixRotatedEXT", (void**)&gl3wMatrixRotatedEXT, (void*)recording_glMatrixRotatedEXT },
+	{ "glMatrixScalefEXT", (void**)&gl3wMatrixScalefEXT, (void*)recording_glMatrixScalefEXT },
+	{ "glMatrixScaledEXT", (void**)&gl3wMatrixScaledEXT, (void*)recording_glMatrixScaledEXT },
+	{ "glMatrixTranslatefEXT", (void**)&gl3wMatrixTranslatefEXT, (void*)recording_glMatrixTranslatefEXT },
+	{ "glMatrixTranslatedEXT", (void**)&gl3wMatrixTranslatedEXT, (void*)recording_glMatrixTranslatedEXT },
+	{ "glMatrixFrustumEXT", (void**)&gl3wMatrixFrustumEXT, (void*)recording_glMatrixFrustumEXT },
+	{ "glMatrixOrthoEXT", (void**)&gl3wMatrixOrthoEXT, (void*)recording_glMatrixOrthoEXT },
+	{ "glMatrixPopEXT", (void**)&gl3wMatrixPopEXT, (void*)recording_glMatrixPopEXT },
+	{ "glMatrixPushEXT", (void**)&gl3wMatrixPushEXT, (void*)recording_glMatrixPushEXT },
+	{ "glClientAttribDefaultEXT", (void**)&gl3wClientAttribDefaultEXT, (void*)recording_glClientAttribDefaultEXT },
+	{ "glPushClientAttribDefaultEXT", (void**)&gl3wPushClientAttribDefaultEXT, (void*)recording_glPushClientAttribDefaultEXT },
+	{ "glTextureParameterfEXT", (void**)&gl3wTextureParameterfEXT, (void*)recording_glTextureParameterfEXT },
+	{ "glTextureParameterfvEXT", (void**)&gl3wTextureParameterfvEXT, (void*)recording_glTextureParameterfvEXT },
+	{ "glTextureParameteriEXT", (void**)&gl3wTextureParameteriEXT, (void*)recording_glTextureParameteriEXT },
+	{ "glTextureParameterivEXT", (void**)&gl3wTextureParameterivEXT, (void*)recording_glTextureParameterivEXT },
+	{ "glTextureImage1DEXT", (void**)&gl3wTextureImage1DEXT, (void*)recording_glTextureImage1DEXT },
+	{ "glTextureImage2DEXT", (void**)&gl3wTextureImage2DEXT, (void*)recording_glTextureImage2DEXT },
+	{ "glTextureSubImage1DEXT", (void**)&gl3wTextureSubImage1DEXT, (void*)recording_glTextureSubImage1DEXT },
+	{ "glTextureSubImage2DEXT", (void**)&gl3wTextureSubImage2DEXT, (void*)recording_glTextureSubImage2DEXT },
+	{ "glCopyTextureImage1DEXT", (void**)&gl3wCopyTextureImage1DEXT, (void*)recording_glCopyTextureImage1DEXT },
+	{ "glCopyTextureImage2DEXT", (void**)&gl3wCopyTextureImage2DEXT, (void*)recording_glCopyTextureImage2DEXT },
+	{ "glCopyTextureSubImage1DEXT", (void**)&gl3wCopyTextureSubImage1DEXT, (void*)recording_glCopyTextureSubImage1DEXT },
+	{ "glCopyTextureSubImage2DEXT", (void**)&gl3wCopyTextureSubImage2DEXT, (void*)recording_glCopyTextureSubImage2DEXT },
+	{ "glGetTextureImageEXT", (void**)&gl3wGetTextureImageEXT, (void*)recording_glGetTextureImageEXT },
+	{ "glGetTextureParameterfvEXT", (void**)&gl3wGetTextureParameterfvEXT, (void*)recording_glGetTextureParameterfvEXT },
+	{ "glGetTextureParameterivEXT", (void**)&gl3wGetTextureParameterivEXT, (void*)recording_glGetTextureParameterivEXT },
+	{ "glGetTextureLevelParameterfvEXT", (void**)&gl3wGetTextureLevelParameterfvEXT, (void*)recording_glGetTextureLevelParameterfvEXT },
+	{ "glGetTextureLevelParameterivEXT", (void**)&gl3wGetTextureLevelParameterivEXT, (void*)recording_glGetTextureLevelParameterivEXT },
+	{ "glTextureImage3DEXT", (void**)&gl3wTextureImage3DEXT, (void*)recording_glTextureImage3DEXT },
+	{ "glTextureSubImage3DEXT", (void**)&gl3wTextureSubImage3DEXT, (void*)recording_glTextureSubImage3DEXT },
+	{ "glCopyTextureSubImage3DEXT", (void**)&gl3wCopyTextureSubImage3DEXT, (void*)recording_glCopyTextureSubImage3DEXT },
+	{ "glBindMultiTextureEXT", (void**)&gl3wBindMultiTextureEXT, (void*)recording_glBindMultiTextureEXT },
+	{ "glMultiTexCoordPointerEXT", (void**)&gl3wMultiTexCoordPointerEXT, (void*)recording_glMultiTexCoordPointerEXT },
+	{ "glMultiTexEnvfEXT", (void**)&gl3wMultiTexEnvfEXT, (void*)recording_glMultiTexEnvfEXT },
+	{ "glMultiTexEnvfvEXT", (void**)&gl3wMultiTexEnvfvEXT, (void*)recording_glMultiTexEnvfvEXT },
+	{ "glMultiTexEnviEXT", (void**)&gl3wMultiTexEnviEXT, (void*)recording_glMultiTexEnviEXT },
+	{ "glMultiTexEnvivEXT", (void**)&gl3wMultiTexEnvivEXT, (void*)recording_glMultiTexEnvivEXT },
+	{ "glMultiTexGendEXT", (void**)&gl3wMultiTexGendEXT, (void*)recording_glMultiTexGendEXT },
+	{ "glMultiTexGendvEXT", (void**)&gl3wMultiTexGendvEXT, (void*)recording_glMultiTexGendvEXT },
+	{ "glMultiTexGenfEXT", (void**)&gl3wMultiTexGenfEXT, (void*)recording_glMultiTexGenfEXT },
+	{ "glMultiTexGenfvEXT", (void**)&gl3wMultiTexGenfvEXT, (void*)recording_glMultiTexGenfvEXT },
+	{ "glMultiTexGeniEXT", (void**)&gl3wMultiTexGeniEXT, (void*)recording_glMultiTexGeniEXT },
+	{ "glMultiTexGenivEXT", (void**)&gl3wMultiTexGenivEXT, (void*)recording_glMultiTexGenivEXT },
+	{ "glGetMultiTexEnvfvEXT", (void**)&gl3wGetMultiTexEnvfvEXT, (void*)recording_glGetMultiTexEnvfvEXT },
+	{ "glGetMultiTexEnvivEXT", (void**)&gl3wGetMultiTexEnvivEXT, (void*)recording_glGetMultiTexEnvivEXT },
+	{ "glGetMultiTexGendvEXT", (void**)&gl3wGetMultiTexGendvEXT, (void*)recording_glGetMultiTexGendvEXT },
+	{ "glGetMultiTexGenfvEXT", (void**)&gl3wGetMultiTexGenfvEXT, (void*)recording_glGetMultiTexGenfvEXT },
+	{ "glGetMultiTexGenivEXT", (void**)&gl3wGetMultiTexGenivEXT, (void*)recording_glGetMultiTexGenivEXT },
+	{ "glMultiTexParameteriEXT", (void**)&gl3wMultiTexParameteriEXT, (void*)recording_glMultiTexParameteriEXT },
+	{ "glMultiTexParameterivEXT", (void**)&gl3wMultiTexParameterivEXT, (void*)recording_glMultiTexParameterivEXT },
+	{ "glMultiTexParameterfEXT", (void**)&gl3wMultiTexParameterfEXT, (void*)recording_glMultiTexParameterfEXT },
+	{ "glMultiTexParameterfvEXT", (void**)&gl3wMultiTexParameterfvEXT, (void*)recording_glMultiTexParameterfvEXT },
+	{ "glMultiTexImage1DEXT", (void**)&gl3wMultiTexImage1DEXT, (void*)recording_glMultiTexImage1DEXT },
+	{ "glMultiTexImage2DEXT", (void**)&gl3wMultiTexImage2DEXT, (void*)recording_glMultiTexImage2DEXT },
+	{ "glMultiTexSubImage1DEXT", (void**)&gl3wMultiTexSubImage1DEXT, (void*)recording_glMultiTexSubImage1DEXT },
+	{ "glMultiTexSubImage2DEXT", (void**)&gl3wMultiTexSubImage2DEXT, (void*)recording_glMultiTexSubImage2DEXT },
+	{ "glCopyMultiTexImage1DEXT", (void**)&gl3wCopyMultiTexImage1DEXT, (void*)recording_glCopyMultiTexImage1DEXT },
+	{ "glCopyMultiTexImage2DEXT", (void**)&gl3wCopyMultiTexImage2DEXT, (void*)recording_glCopyMultiTexImage2DEXT },
+	{ "glCopyMultiTexSubImage1DEXT", (void**)&gl3wCopyMultiTexSubImage1DEXT, (void*)recording_glCopyMultiTexSubImage1DEXT },
+	{ "glCopyMultiTexSubImage2DEXT", (void**)&gl3wCopyMultiTexSubImage2DEXT, (void*)recording_glCopyMultiTexSubImage2DEXT },
+	{ "glGetMultiTexImageEXT", (void**)&gl3wGetMultiTexImageEXT, (void*)recording_glGetMultiTexImageEXT },
+	{ "glGetMultiTexParameterfvEXT", (void**)&gl3wGetMultiTexParameterfvEXT, (void*)recording_glGetMultiTexParameterfvEXT },
+	{ "glGetMultiTexParameterivEXT", (void**)&gl3wGetMultiTexParameterivEXT, (void*)recording_glGetMultiTexParameterivEXT },
+	{ "glGetMultiTexLevelParameterfvEXT", (void**)&gl3wGetMultiTexLevelParameterfvEXT, (void*)recording_glGetMultiTexLevelParameterfvEXT },
+	{ "glGetMultiTexLevelParameterivEXT", (void**)&gl3wGetMultiTexLevelParameterivEXT, (void*)recording_glGetMultiTexLevelParameterivEXT },
+	{ "glMultiTexImage3DEXT", (void**)&gl3wMultiTexImage3DEXT, (void*)recording_glMultiTexImage3DEXT },
+	{ "glMultiTexSubImage3DEXT", (void**)&gl3wMultiTexSubImage3DEXT, (void*)recording_glMultiTexSubImage3DEXT },
+	{ "glCopyMultiTexSubImage3DEXT", (void**)&gl3wCopyMultiTexSubImage3DEXT, (void*)recording_glCopyMultiTexSubImage3DEXT },
+	{ "glEnableClientStateIndexedEXT", (void**)&gl3wEnableClientStateIndexedEXT, (void*)recording_glEnableClientStateIndexedEXT },
+	{ "glDisableClientStateIndexedEXT", (void**)&gl3wDisableClientStateIndexedEXT, (void*)recording_glDisableClientStateIndexedEXT },
+	{ "glGetFloatIndexedvEXT", (void**)&gl3wGetFloatIndexedvEXT, (void*)recording_glGetFloatIndexedvEXT },
+	{ "glGetDoubleIndexedvEXT", (void**)&gl3wGetDoubleIndexedvEXT, (void*)recording_glGetDoubleIndexedvEXT },
+	{ "glGetPointerIndexedvEXT", (void**)&gl3wGetPointerIndexedvEXT, (void*)recording_glGetPointerIndexedvEXT },
+	{ "glEnableIndexedEXT", (void**)&gl3wEnableIndexedEXT, (void*)recording_glEnableIndexedEXT },
+	{ "glDisableIndexedEXT", (void**)&gl3wDisableIndexedEXT, (void*)recording_glDisableIndexedEXT },
+	{ "glIsEnabledIndexedEXT", (void**)&gl3wIsEnabledIndexedEXT, (void*)recording_glIsEnabledIndexedEXT },
+	{ "glGetIntegerIndexedvEXT", (void**)&gl3wGetIntegerIndexedvEXT, (void*)recording_glGetIntegerIndexedvEXT },
+	{ "glGetBooleanIndexedvEXT", (void**)&gl3wGetBooleanIndexedvEXT, (void*)recording_glGetBooleanIndexedvEXT },
+	{ "glCompressedTextureImage3DEXT", (void**)&gl3wCompressedTextureImage3DEXT, (void*)recording_glCompressedTextureImage3DEXT },
+	{ "glCompressedTextureImage2DEXT", (void**)&gl3wCompressedTextureImage2DEXT, (void*)recording_glCompressedTextureImage2DEXT },
+	{ "glCompressedTextureImage1DEXT", (void**)&gl3wCompressedTextureImage1DEXT, (void*)recording_glCompressedTextureImage1DEXT },
+	{ "glCompressedTextureSubImage3DEXT", (void**)&gl3wCompressedTextureSubImage3DEXT, (void*)recording_glCompressedTextureSubImage3DEXT },
+	{ "glCompressedTextureSubImage2DEXT", (void**)&gl3wCompressedTextureSubImage2DEXT, (void*)recording_glCompressedTextureSubImage2DEXT },
+	{ "glCompressedTextureSubImage1DEXT", (void**)&gl3wCompressedTextureSubImage1DEXT, (void*)recording_glCompressedTextureSubImage1DEXT },
+	{ "glGetCompressedTextureImageEXT", (void**)&gl3wGetCompressedTextureImageEXT, (void*)recording_glGetCompressedTextureImageEXT },
+	{ "glCompressedMultiTexImage3DEXT", (void**)&gl3wCompressedMultiTexImage3DEXT, (void*)recording_glCompressedMultiTexImage3DEXT },
+	{ "glCompressedMultiTexImage2DEXT", (void**)&gl3wCompressedMultiTexImage2DEXT, (void*)recording_glCompressedMultiTexImage2DEXT },
+	{ "glCompressedMultiTexImage1DEXT", (void**)&gl3wCompressedMultiTexImage1DEXT, (void*)recording_glCompressedMultiTexImage1DEXT },
+	{ "glCompressedMultiTexSubImage3DEXT", (void**)&gl3wCompressedMultiTexSubImage3DEXT, (void*)recording_glCompressedMultiTexSubImage3DEXT },
+	{ "glCompressedMultiTexSubImage2DEXT", (void**)&gl3wCompressedMultiTexSubImage2DEXT, (void*)recording_glCompressedMultiTexSubImage2DEXT },
+	{ "glCompressedMultiTexSubImage1DEXT", (void**)&gl3wCompressedMultiTexSubImage1DEXT, (void*)recording_glCompressedMultiTexSubImage1DEXT },
+	{ "glGetCompressedMultiTexImageEXT", (void**)&gl3wGetCompressedMultiTexImageEXT, (void*)recording_glGetCompressedMultiTexImageEXT },
+	{ "glMatrixLoadTransposefEXT", (void**)&gl3wMatrixLoadTransposefEXT, (void*)recording_glMatrixLoadTransposefEXT },
+	{ "glMatrixLoadTransposedEXT", (void**)&gl3wMatrixLoadTransposedEXT, (void*)recording_glMatrixLoadTransposedEXT },
+	{ "glMatrixMultTransposefEXT", (void**)&gl3wMatrixMultTransposefEXT, (void*)recording_glMatrixMultTransposefEXT },
+	{ "glMatrixMultTransposedEXT", (void**)&gl3wMatrixMultTransposedEXT, (void*)recording_glMatrixMultTransposedEXT },
+	{ "glNamedBufferDataEXT", (void**)&gl3wNamedBufferDataEXT, (void*)recording_glNamedBufferDataEXT },
+	{ "glNamedBufferSubDataEXT", (void**)&gl3wNamedBufferSubDataEXT, (void*)recording_glNamedBufferSubDataEXT },
+	{ "glMapNamedBufferEXT", (void**)&gl3wMapNamedBufferEXT, (void*)recording_glMapNamedBufferEXT },
+	{ "glUnmapNamedBufferEXT", (void**)&gl3wUnmapNamedBufferEXT, (void*)recording_glUnmapNamedBufferEXT },
+	{ "glGetNamedBufferParameterivEXT", (void**)&gl3wGetNamedBufferParameterivEXT, (void*)recording_glGetNamedBufferParameterivEXT },
+	{ "glGetNamedBufferPointervEXT", (void**)&gl3wGetNamedBufferPointervEXT, (void*)recording_glGetNamedBufferPointervEXT },
+	{ "glGetNamedBufferSubDataEXT", (void**)&gl3wGetNamedBufferSubDataEXT, (void*)recording_glGetNamedBufferSubDataEXT },
+	{ "glProgramUniform1fEXT", (void**)&gl3wProgramUniform1fEXT, (void*)recording_glProgramUniform1fEXT },
+	{ "glProgramUniform2fEXT", (void**)&gl3wProgramUniform2fEXT, (void*)recording_glProgramUniform2fEXT },
+	{ "glProgramUniform3fEXT", (void**)&gl3wProgramUniform3fEXT, (void*)recording_glProgramUniform3fEXT },
+	{ "glProgramUniform4fEXT", (void**)&gl3wProgramUniform4fEXT, (void*)recording_glProgramUniform4fEXT },
+	{ "glProgramUniform1iEXT", (void**)&gl3wProgramUniform1iEXT, (void*)recording_glProgramUniform1iEXT },
+	{ "glProgramUniform2iEXT", (void**)&gl3wProgramUniform2iEXT, (void*)recording_glProgramUniform2iEXT },
+	{ "glProgramUniform3iEXT", (void**)&gl3wProgramUniform3iEXT, (void*)recording_glProgramUniform3iEXT },
+	{ "glProgramUniform4iEXT", (void**)&gl3wProgramUniform4iEXT, (void*)recording_glProgramUniform4iEXT },
+	{ "glProgramUniform1fvEXT", (void**)&gl3wProgramUniform1fvEXT, (void*)recording_glProgramUniform1fvEXT },
+	{ "glProgramUniform2fvEXT", (void**)&gl3wProgramUniform2fvEXT, (void*)recording_glProgramUniform2fvEXT },
+	{ "glProgramUniform3fvEXT", (void**)&gl3wProgramUniform3fvEXT, (void*)recording_glProgramUniform3fvEXT },
+	{ "glProgramUniform4fvEXT", (void**)&gl3wProgramUniform4fvEXT, (void*)recording_glProgramUniform4fvEXT },
+	{ "glProgramUniform1ivEXT", (void**)&gl3wProgramUniform1ivEXT, (void*)recording_glProgramUniform1ivEXT },
+	{ "glProgramUniform2ivEXT", (void**)&gl3wProgramUniform2ivEXT, (void*)recording_glProgramUniform2ivEXT },
+	{ "glProgramUniform3ivEXT", (void**)&gl3wProgramUniform3ivEXT, (void*)recording_glProgramUniform3ivEXT },
+	{ "glProgramUniform4ivEXT", (void**)&gl3wProgramUniform4ivEXT, (void*)recording_glProgramUniform4ivEXT },
+	{ "glProgramUniformMatrix2fvEXT", (void**)&gl3wProgramUniformMatrix2fvEXT, (void*)recording_glProgramUniformMatrix2fvEXT },
+	{ "glProgramUniformMatrix3fvEXT", (void**)&gl3wProgramUniformMatrix3fvEXT, (void*)recording_glProgramUniformMatrix3fvEXT },
+	{ "glProgramUniformMatrix4fvEXT", (void**)&gl3wProgramUniformMatrix4fvEXT, (void*)recording_glProgramUniformMatrix4fvEXT },
+	{ "glProgramUniformMatrix2x3fvEXT", (void**)&gl3wProgramUniformMatrix2x3fvEXT, (void*)recording_glProgramUniformMatrix2x3fvEXT },
+	{ "glProgramUniformMatrix3x2fvEXT", (void**)&gl3wProgramUniformMatrix3x2fvEXT, (void*)recording_glProgramUniformMatrix3x2fvEXT },
+	{ "glProgramUniformMatrix2x4fvEXT", (void**)&gl3wProgramUniformMatrix2x4fvEXT, (void*)recording_glProgramUniformMatrix2x4fvEXT },
+	{ "glProgramUniformMatrix4x2fvEXT", (void**)&gl3wProgramUniformMatrix4x2fvEXT, (void*)recording_glProgramUniformMatrix4x2fvEXT },
+	{ "glProgramUniformMatrix3x4fvEXT", (void**)&gl3wProgramUniformMatrix3x4fvEXT, (void*)recording_glProgramUniformMatrix3x4fvEXT },
+	{ "glProgramUniformMatrix4x3fvEXT", (void**)&gl3wProgramUniformMatrix4x3fvEXT, (void*)recording_glProgramUniformMatrix4x3fvEXT },
+	{ "glTextureBufferEXT", (void**)&gl3wTextureBufferEXT, (void*)recording_glTextureBufferEXT },
+	{ "glMultiTexBufferEXT", (void**)&gl3wMultiTexBufferEXT, (void*)recording_glMultiTexBufferEXT },
+	{ "glTextureParameterIivEXT", (void**)&gl3wTextureParameterIivEXT, (void*)recording_glTextureParameterIivEXT },
+	{ "glTextureParameterIuivEXT", (void**)&gl3wTextureParameterIuivEXT, (void*)recording_glTextureParameterIuivEXT },
+	{ "glGetTextureParameterIivEXT", (void**)&gl3wGetTextureParameterIivEXT, (void*)recording_glGetTextureParameterIivEXT },
+	{ "glGetTextureParameterIuivEXT", (void**)&gl3wGetTextureParameterIuivEXT, (void*)recording_glGetTextureParameterIuivEXT },
+	{ "glMultiTexParameterIivEXT", (void**)&gl3wMultiTexParameterIivEXT, (void*)recording_glMultiTexParameterIivEXT },
+	{ "glMultiTexParameterIuivEXT", (void**)&gl3wMultiTexParameterIuivEXT, (void*)recording_glMultiTexParameterIuivEXT },
+	{ "glGetMultiTexParameterIivEXT", (void**)&gl3wGetMultiTexParameterIivEXT, (void*)recording_glGetMultiTexParameterIivEXT },
+	{ "glGetMultiTexParameterIuivEXT", (void**)&gl3wGetMultiTexParameterIuivEXT, (void*)recording_glGetMultiTexParameterIuivEXT },
+	{ "glProgramUniform1uiEXT", (void**)&gl3wProgramUniform1uiEXT, (void*)recording_glProgramUniform1uiEXT },
+	{ "glProgramUniform2uiEXT", (void**)&gl3wProgramUniform2uiEXT, (void*)recording_glProgramUniform2uiEXT },
+	{ "glProgramUniform3uiEXT", (void**)&gl3wProgramUniform3uiEXT, (void*)recording_glProgramUniform3uiEXT },
+	{ "glProgramUniform4uiEXT", (void**)&gl3wProgramUniform4uiEXT, (void*)recording_glProgramUniform4uiEXT },
+	{ "glProgramUniform1uivEXT", (void**)&gl3wProgramUniform1uivEXT, (void*)recording_glProgramUniform1uivEXT },
+	{ "glProgramUniform2uivEXT", (void**)&gl3wProgramUniform2uivEXT, (void*)recording_glProgramUniform2uivEXT },
+	{ "glProgramUniform3uivEXT", (void**)&gl3wProgramUniform3uivEXT, (void*)recording_glProgramUniform3uivEXT },
+	{ "glProgramUniform4uivEXT", (void**)&gl3wProgramUniform4uivEXT, (void*)recording_glProgramUniform4uivEXT },
+	{ "glNamedProgramLocalParameters4fvEXT", (void**)&gl3wNamedProgramLocalParameters4fvEXT, (void*)recording_glNamedProgramLocalParameters4fvEXT },
+	{ "glNamedProgramLocalParameterI4iEXT", (void**)&gl3wNamedProgramLocalParameterI4iEXT, (void*)recording_glNamedProgramLocalParameterI4iEXT },
+	{ "glNamedProgramLocalParameterI4ivEXT", (void**)&gl3wNamedProgramLocalParameterI4ivEXT, (void*)recording_glNamedProgramLocalParameterI4ivEXT },
+	{ "glNamedProgramLocalParametersI4ivEXT", (void**)&gl3wNamedProgramLocalParametersI4ivEXT, (void*)recording_glNamedProgramLocalParametersI4ivEXT },
+	{ "glNamedProgramLocalParameterI4uiEXT", (void**)&gl3wNamedProgramLocalParameterI4uiEXT, (void*)recording_glNamedProgramLocalParameterI4uiEXT },
+	{ "glNamedProgramLocalParameterI4uivEXT", (void**)&gl3wNamedProgramLocalParameterI4uivEXT, (void*)recording_glNamedProgramLocalParameterI4uivEXT },
+	{ "glNamedProgramLocalParametersI4uivEXT", (void**)&gl3wNamedProgramLocalParametersI4uivEXT, (void*)recording_glNamedProgramLocalParametersI4uivEXT },
+	{ "glGetNamedProgramLocalParameterIivEXT", (void**)&gl3wGetNamedProgramLocalParameterIivEXT, (void*)recording_glGetNamedProgramLocalParameterIivEXT },
+	{ "glGetNamedProgramLocalParameterIuivEXT", (void**)&gl3wGetNamedProgramLocalParameterIuivEXT, (void*)recording_glGetNamedProgramLocalParameterIuivEXT },
+	{ "glEnableClientStateiEXT", (void**)&gl3wEnableClientStateiEXT, (void*)recording_glEnableClientStateiEXT },
+	{ "glDisableClientStateiEXT", (void**)&gl3wDisableClientStateiEXT, (void*)recording_glDisableClientStateiEXT },
+	{ "glGetFloati_vEXT", (void**)&gl3wGetFloati_vEXT, (void*)recording_glGetFloati_vEXT },
+	{ "glGetDoublei_vEXT", (void**)&gl3wGetDoublei_vEXT, (void*)recording_glGetDoublei_vEXT },
+	{ "glGetPointeri_vEXT", (void**)&gl3wGetPointeri_vEXT, (void*)recording_glGetPointeri_vEXT },
+	{ "glNamedProgramStringEXT", (void**)&gl3wNamedProgramStringEXT, (void*)recording_glNamedProgramStringEXT },
+	{ "glNamedProgramLocalParameter4dEXT", (void**)&gl3wNamedProgramLocalParameter4dEXT, (void*)recording_glNamedProgramLocalParameter4dEXT },
+	{ "glNamedProgramLocalParameter4dvEXT", (void**)&gl3wNamedProgramLocalParameter4dvEXT, (void*)recording_glNamedProgramLocalParameter4dvEXT },
+	{ "glNamedProgramLocalParameter4fEXT", (void**)&gl3wNamedProgramLocalParameter4fEXT, (void*)recording_glNamedProgramLocalParameter4fEXT },
+	{ "glNamedProgramLocalParameter4fvEXT", (void**)&gl3wNamedProgramLocalParameter4fvEXT, (void*)recording_glNamedProgramLocalParameter4fvEXT },
+	{ "glGetNamedProgramLocalParameterdvEXT", (void**)&gl3wGetNamedProgramLocalParameterdvEXT, (void*)recording_glGetNamedProgramLocalParameterdvEXT },
+	{ "glGetNamedProgramLocalParameterfvEXT", (void**)&gl3wGetNamedProgramLocalParameterfvEXT, (void*)recording_glGetNamedProgramLocalParameterfvEXT },
+	{ "glGetNamedProgramivEXT", (void**)&gl3wGetNamedProgramivEXT, (void*)recording_glGetNamedProgramivEXT },
+	{ "glGetNamedProgramStringEXT", (void**)&gl3wGetNamedProgramStringEXT, (void*)recording_glGetNamedProgramStringEXT },
+	{ "glNamedRenderbufferStorageEXT", (void**)&gl3wNamedRenderbufferStorageEXT, (void*)recording_glNamedRenderbufferStorageEXT },
+	{ "glGetNamedRenderbufferParameterivEXT", (void**)&gl3wGetNamedRenderbufferParameterivEXT, (void*)recording_glGetNamedRenderbufferParameterivEXT },
+	{ "glNamedRenderbufferStorageMultisampleEXT", (void**)&gl3wNamedRenderbufferStorageMultisampleEXT, (void*)recording_glNamedRenderbufferStorageMultisampleEXT },
+	{ "glNamedRenderbufferStorageMultisampleCoverageEXT", (void**)&gl3wNamedRenderbufferStorageMultisampleCoverageEXT, (void*)recording_glNamedRenderbufferStorageMultisampleCoverageEXT },
+	{ "glCheckNamedFramebufferStatusEXT", (void**)&gl3wCheckNamedFramebufferStatusEXT, (void*)recording_glCheckNamedFramebufferStatusEXT },
+	{ "glNamedFramebufferTexture1DEXT", (void**)&gl3wNamedFramebufferTexture1DEXT, (void*)recording_glNamedFramebufferTexture1DEXT },
+	{ "glNamedFramebufferTexture2DEXT", (void**)&gl3wNamedFramebufferTexture2DEXT, (void*)recording_glNamedFramebufferTexture2DEXT },
+	{ "glNamedFramebufferTexture3DEXT", (void**)&gl3wNamedFramebufferTexture3DEXT, (void*)recording_glNamedFramebufferTexture3DEXT },
+	{ "glNamedFramebufferRenderbufferEXT", (void**)&gl3wNamedFramebufferRenderbufferEXT, (void*)recording_glNamedFramebufferRenderbufferEXT },
+	{ "glGetNamedFramebufferAttachmentParameterivEXT", (void**)&gl3wGetNamedFramebufferAttachmentParameterivEXT, (void*)recording_glGetNamedFramebufferAttachmentParameterivEXT },
+	{ "glGenerateTextureMipmapEXT", (void**)&gl3wGenerateTextureMipmapEXT, (void*)recording_glGenerateTextureMipmapEXT },
+	{ "glGenerateMultiTexMipmapEXT", (void**)&gl3wGenerateMultiTexMipmapEXT, (void*)recording_glGenerateMultiTexMipmapEXT },
+	{ "glFramebufferDrawBufferEXT", (void**)&gl3wFramebufferDrawBufferEXT, (void*)recording_glFramebufferDrawBufferEXT },
+	{ "glFramebufferDrawBuffersEXT", (void**)&gl3wFramebufferDrawBuffersEXT, (void*)recording_glFramebufferDrawBuffersEXT },
+	{ "glFramebufferReadBufferEXT", (void**)&gl3wFramebufferReadBufferEXT, (void*)recording_glFramebufferReadBufferEXT },
+	{ "glGetFramebufferParameterivEXT", (void**)&gl3wGetFramebufferParameterivEXT, (void*)recording_glGetFramebufferParameterivEXT },
+	{ "glNamedCopyBufferSubDataEXT", (void**)&gl3wNamedCopyBufferSubDataEXT, (void*)recording_glNamedCopyBufferSubDataEXT },
+	{ "glNamedFramebufferTextureEXT", (void**)&gl3wNamedFramebufferTextureEXT, (void*)recording_glNamedFramebufferTextureEXT },
+	{ "glNamedFramebufferTextureLayerEXT", (void**)&gl3wNamedFramebufferTextureLayerEXT, (void*)recording_glNamedFramebufferTextureLayerEXT },
+	{ "glNamedFramebufferTextureFaceEXT", (void**)&gl3wNamedFramebufferTextureFaceEXT, (void*)recording_glNamedFramebufferTextureFaceEXT },
+	{ "glTextureRenderbufferEXT", (void**)&gl3wTextureRenderbufferEXT, (void*)recording_glTextureRenderbufferEXT },
+	{ "glMultiTexRenderbufferEXT", (void**)&gl3wMultiTexRenderbufferEXT, (void*)recording_glMultiTexRenderbufferEXT },
+	{ "glVertexArrayVertexOffsetEXT", (void**)&gl3wVertexArrayVertexOffsetEXT, (void*)recording_glVertexArrayVertexOffsetEXT },
+	{ "glVertexArrayColorOffsetEXT", (void**)&gl3wVertexArrayColorOffsetEXT, (void*)recording_glVertexArrayColorOffsetEXT },
+	{ "glVertexArrayEdgeFlagOffsetEXT", (void**)&gl3wVertexArrayEdgeFlagOffsetEXT, (void*)recording_glVertexArrayEdgeFlagOffsetEXT },
+	{ "glVertexArrayIndexOffsetEXT", (void**)&gl3wVertexArrayIndexOffsetEXT, (void*)recording_glVertexArrayIndexOffsetEXT },
+	{ "glVertexArrayNormalOffsetEXT", (void**)&gl3wVertexArrayNormalOffsetEXT, (void*)recording_glVertexArrayNormalOffsetEXT },
+	{ "glVertexArrayTexCoordOffsetEXT", (void**)&gl3wVertexArrayTexCoordOffsetEXT, (void*)recording_glVertexArrayTexCoordOffsetEXT },
+	{ "glVertexArrayMultiTexCoordOffsetEXT", (void**)&gl3wVertexArrayMultiTexCoordOffsetEXT, (void*)recording_glVertexArrayMultiTexCoordOffsetEXT },
+	{ "glVertexArrayFogCoordOffsetEXT", (void**)&gl3wVertexArrayFogCoordOffsetEXT, (void*)recording_glVertexArrayFogCoordOffsetEXT },
+	{ "glVertexArraySecondaryColorOffsetEXT", (void**)&gl3wVertexArraySecondaryColorOffsetEXT, (void*)recording_glVertexArraySecondaryColorOffsetEXT },
+	{ "glVertexArrayVertexAttribOffsetEXT", (void**)&gl3wVertexArrayVertexAttribOffsetEXT, (void*)recording_glVertexArrayVertexAttribOffsetEXT },
+	{ "glVertexArrayVertexAttribIOffsetEXT", (void**)&gl3wVertexArrayVertexAttribIOffsetEXT, (void*)recording_glVertexArrayVertexAttribIOffsetEXT },
+	{ "glEnableVertexArrayEXT", (void**)&gl3wEnableVertexArrayEXT, (void*)recording_glEnableVertexArrayEXT },
+	{ "glDisableVertexArrayEXT", (void**)&gl3wDisableVertexArrayEXT, (void*)recording_glDisableVertexArrayEXT },
+	{ "glEnableVertexArrayAttribEXT", (void**)&gl3wEnableVertexArrayAttribEXT, (void*)recording_glEnableVertexArrayAttribEXT },
+	{ "glDisableVertexArrayAttribEXT", (void**)&gl3wDisableVertexArrayAttribEXT, (void*)recording_glDisableVertexArrayAttribEXT },
+	{ "glGetVertexArrayIntegervEXT", (void**)&gl3wGetVertexArrayIntegervEXT, (void*)recording_glGetVertexArrayIntegervEXT },
+	{ "glGetVertexArrayPointervEXT", (void**)&gl3wGetVertexArrayPointervEXT, (void*)recording_glGetVertexArrayPointervEXT },
+	{ "glGetVertexArrayIntegeri_vEXT", (void**)&gl3wGetVertexArrayIntegeri_vEXT, (void*)recording_glGetVertexArrayIntegeri_vEXT },
+	{ "glGetVertexArrayPointeri_vEXT", (void**)&gl3wGetVertexArrayPointeri_vEXT, (void*)recording_glGetVertexArrayPointeri_vEXT },
+	{ "glMapNamedBufferRangeEXT", (void**)&gl3wMapNamedBufferRangeEXT, (void*)recording_glMapNamedBufferRangeEXT },
+	{ "glFlushMappedNamedBufferRangeEXT", (void**)&gl3wFlushMappedNamedBufferRangeEXT, (void*)recording_glFlushMappedNamedBufferRangeEXT },
+	{ "glNamedBufferStorageEXT", (void**)&gl3wNamedBufferStorageEXT, (void*)recording_glNamedBufferStorageEXT },
+	{ "glClearNamedBufferDataEXT", (void**)&gl3wClearNamedBufferDataEXT, (void*)recording_glClearNamedBufferDataEXT },
+	{ "glClearNamedBufferSubDataEXT", (void**)&gl3wClearNamedBufferSubDataEXT, (void*)recording_glClearNamedBufferSubDataEXT },
+	{ "glNamedFramebufferParameteriEXT", (void**)&gl3wNamedFramebufferParameteriEXT, (void*)recording_glNamedFramebufferParameteriEXT },
+	{ "glGetNamedFramebufferParameterivEXT", (void**)&gl3wGetNamedFramebufferParameterivEXT, (void*)recording_glGetNamedFramebufferParameterivEXT },
+	{ "glProgramUniform1dEXT", (void**)&gl3wProgramUniform1dEXT, (void*)recording_glProgramUniform1dEXT },
+	{ "glProgramUniform2dEXT", (void**)&gl3wProgramUniform2dEXT, (void*)recording_glProgramUniform2dEXT },
+	{ "glProgramUniform3dEXT", (void**)&gl3wProgramUniform3dEXT, (void*)recording_glProgramUniform3dEXT },
+	{ "glProgramUniform4dEXT", (void**)&gl3wProgramUniform4dEXT, (void*)recording_glProgramUniform4dEXT },
+	{ "glProgramUniform1dvEXT", (void**)&gl3wProgramUniform1dvEXT, (void*)recording_glProgramUniform1dvEXT },
+	{ "glProgramUniform2dvEXT", (void**)&gl3wProgramUniform2dvEXT, (void*)recording_glProgramUniform2dvEXT },
+	{ "glProgramUniform3dvEXT", (void**)&gl3wProgramUniform3dvEXT, (void*)recording_glProgramUniform3dvEXT },
+	{ "glProgramUniform4dvEXT", (void**)&gl3wProgramUniform4dvEXT, (void*)recording_glProgramUniform4dvEXT },
+	{ "glProgramUniformMatrix2dvEXT", (void**)&gl3wProgramUniformMatrix2dvEXT, (void*)recording_glProgramUniformMatrix2dvEXT },
+	{ "glProgramUniformMatrix3dvEXT", (void**)&gl3wProgramUniformMatrix3dvEXT, (void*)recording_glProgramUniformMatrix3dvEXT },
+	{ "glProgramUniformMatrix4dvEXT", (void**)&gl3wProgramUniformMatrix4dvEXT, (void*)recording_glProgramUniformMatrix4dvEXT },
+	{ "glProgramUniformMatrix2x3dvEXT", (void**)&gl3wProgramUniformMatrix2x3dvEXT, (void*)recording_glProgramUniformMatrix2x3dvEXT },
+	{ "glProgramUniformMatrix2x4dvEXT", (void**)&gl3wProgramUniformMatrix2x4dvEXT, (void*)recording_glProgramUniformMatrix2x4dvEXT },
+	{ "glProgramUniformMatrix3x2dvEXT", (void**)&gl3wProgramUniformMatrix3x2dvEXT, (void*)recording_glProgramUniformMatrix3x2dvEXT },
+	{ "glProgramUniformMatrix3x4dvEXT", (void**)&gl3wProgramUniformMatrix3x4dvEXT, (void*)recording_glProgramUniformMatrix3x4dvEXT },
+	{ "glProgramUniformMatrix4x2dvEXT", (void**)&gl3wProgramUniformMatrix4x2dvEXT, (void*)recording_glProgramUniformMatrix4x2dvEXT },
+	{ "glProgramUniformMatrix4x3dvEXT", (void**)&gl3wProgramUniformMatrix4x3dvEXT, (void*)recording_glProgramUniformMatrix4x3dvEXT },
+	{ "glTextureBufferRangeEXT", (void**)&gl3wTextureBufferRangeEXT, (void*)recording_glTextureBufferRangeEXT },
+	{ "glTextureStorage1DEXT", (void**)&gl3wTextureStorage1DEXT, (void*)recording_glTextureStorage1DEXT },
+	{ "glTextureStorage2DEXT", (void**)&gl3wTextureStorage2DEXT, (void*)recording_glTextureStorage2DEXT },
+	{ "glTextureStorage3DEXT", (void**)&gl3wTextureStorage3DEXT, (void*)recording_glTextureStorage3DEXT },
+	{ "glTextureStorage2DMultisampleEXT", (void**)&gl3wTextureStorage2DMultisampleEXT, (void*)recording_glTextureStorage2DMultisampleEXT },
+	{ "glTextureStorage3DMultisampleEXT", (void**)&gl3wTextureStorage3DMultisampleEXT, (void*)recording_glTextureStorage3DMultisampleEXT },
+	{ "glVertexArrayBindVertexBufferEXT", (void**)&gl3wVertexArrayBindVertexBufferEXT, (void*)recording_glVertexArrayBindVertexBufferEXT },
+	{ "glVertexArrayVertexAttribFormatEXT", (void**)&gl3wVertexArrayVertexAttribFormatEXT, (void*)recording_glVertexArrayVertexAttribFormatEXT },
+	{ "glVertexArrayVertexAttribIFormatEXT", (void**)&gl3wVertexArrayVertexAttribIFormatEXT, (void*)recording_glVertexArrayVertexAttribIFormatEXT },
+	{ "glVertexArrayVertexAttribLFormatEXT", (void**)&gl3wVertexArrayVertexAttribLFormatEXT, (void*)recording_glVertexArrayVertexAttribLFormatEXT },
+	{ "glVertexArrayVertexAttribBindingEXT", (void**)&gl3wVertexArrayVertexAttribBindingEXT, (void*)recording_glVertexArrayVertexAttribBindingEXT },
+	{ "glVertexArrayVertexBindingDivisorEXT", (void**)&gl3wVertexArrayVertexBindingDivisorEXT, (void*)recording_glVertexArrayVertexBindingDivisorEXT },
+	{ "glVertexArrayVertexAttribLOffsetEXT", (void**)&gl3wVertexArrayVertexAttribLOffsetEXT, (void*)recording_glVertexArrayVertexAttribLOffsetEXT },
+	{ "glTexturePageCommitmentEXT", (void**)&gl3wTexturePageCommitmentEXT, (void*)recording_glTexturePageCommitmentEXT },
+	{ "glVertexArrayVertexAttribDivisorEXT", (void**)&gl3wVertexArrayVertexAttribDivisorEXT, (void*)recording_glVertexArrayVertexAttribDivisorEXT },
+	{ "glDrawArraysInstancedEXT", (void**)&gl3wDrawArraysInstancedEXT, (void*)recording_glDrawArraysInstancedEXT },
+	{ "glDrawElementsInstancedEXT", (void**)&gl3wDrawElementsInstancedEXT, (void*)recording_glDrawElementsInstancedEXT },
+	{ "glPolygonOffsetClampEXT", (void**)&gl3wPolygonOffsetClampEXT, (void*)recording_glPolygonOffsetClampEXT },
+	{ "glRasterSamplesEXT", (void**)&gl3wRasterSamplesEXT, (void*)recording_glRasterSamplesEXT },
+	{ "glUseShaderProgramEXT", (void**)&gl3wUseShaderProgramEXT, (void*)recording_glUseShaderProgramEXT },
+	{ "glActiveProgramEXT", (void**)&gl3wActiveProgramEXT, (void*)recording_glActiveProgramEXT },
+	{ "glCreateShaderProgramEXT", (void**)&gl3wCreateShaderProgramEXT, (void*)recording_glCreateShaderProgramEXT },
+	{ "glFramebufferFetchBarrierEXT", (void**)&gl3wFramebufferFetchBarrierEXT, (void*)recording_glFramebufferFetchBarrierEXT },
+	{ "glWindowRectanglesEXT", (void**)&gl3wWindowRectanglesEXT, (void*)recording_glWindowRectanglesEXT },
+	{ "glApplyFramebufferAttachmentCMAAINTEL", (void**)&gl3wApplyFramebufferAttachmentCMAAINTEL, (void*)recording_glApplyFramebufferAttachmentCMAAINTEL },
+	{ "glBeginPerfQueryINTEL", (void**)&gl3wBeginPerfQueryINTEL, (void*)recording_glBeginPerfQueryINTEL },
+	{ "glCreatePerfQueryINTEL", (void**)&gl3wCreatePerfQueryINTEL, (void*)recording_glCreatePerfQueryINTEL },
+	{ "glDeletePerfQueryINTEL", (void**)&gl3wDeletePerfQueryINTEL, (void*)recording_glDeletePerfQueryINTEL },
+	{ "glEndPerfQueryINTEL", (void**)&gl3wEndPerfQueryINTEL, (void*)recording_glEndPerfQueryINTEL },
+	{ "glGetFirstPerfQueryIdINTEL", (void**)&gl3wGetFirstPerfQueryIdINTEL, (void*)recording_glGetFirstPerfQueryIdINTEL },
+	{ "glGetNextPerfQueryIdINTEL", (void**)&gl3wGetNextPerfQueryIdINTEL, (void*)recording_glGetNextPerfQueryIdINTEL },
+	{ "glGetPerfCounterInfoINTEL", (void**)&gl3wGetPerfCounterInfoINTEL, (void*)recording_glGetPerfCounterInfoINTEL },
+	{ "glGetPerfQueryDataINTEL", (void**)&gl3wGetPerfQueryDataINTEL, (void*)recording_glGetPerfQueryDataINTEL },
+	{ "glGetPerfQueryIdByNameINTEL", (void**)&gl3wGetPerfQueryIdByNameINTEL, (void*)recording_glGetPerfQueryIdByNameINTEL },
+	{ "glGetPerfQueryInfoINTEL", (void**)&gl3wGetPerfQueryInfoINTEL, (void*)recording_glGetPerfQueryInfoINTEL },
+	{ "glMultiDrawArraysIndirectBindlessNV", (void**)&gl3wMultiDrawArraysIndirectBindlessNV, (void*)recording_glMultiDrawArraysIndirectBindlessNV },
+	{ "glMultiDrawElementsIndirectBindlessNV", (void**)&gl3wMultiDrawElementsIndirectBindlessNV, (void*)recording_glMultiDrawElementsIndirectBindlessNV },
+	{ "glMultiDrawArraysIndirectBindlessCountNV", (void**)&gl3wMultiDrawArraysIndirectBindlessCountNV, (void*)recording_glMultiDrawArraysIndirectBindlessCountNV },
+	{ "glMultiDrawElementsIndirectBindlessCountNV", (void**)&gl3wMultiDrawElementsIndirectBindlessCountNV, (void*)recording_glMultiDrawElementsIndirectBindlessCountNV },
+	{ "glGetTextureHandleNV", (void**)&gl3wGetTextureHandleNV, (void*)recording_glGetTextureHandleNV },
+	{ "glGetTextureSamplerHandleNV", (void**)&gl3wGetTextureSamplerHandleNV, (void*)recording_glGetTextureSamplerHandleNV },
+	{ "glMakeTextureHandleResidentNV", (void**)&gl3wMakeTextureHandleResidentNV, (void*)recording_glMakeTextureHandleResidentNV },
+	{ "glMakeTextureHandleNonResidentNV", (void**)&gl3wMakeTextureHandleNonResidentNV, (void*)recording_glMakeTextureHandleNonResidentNV },
+	{ "glGetImageHandleNV", (void**)&gl3wGetImageHandleNV, (void*)recording_glGetImageHandleNV },
+	{ "glMakeImageHandleResidentNV", (void**)&gl3wMakeImageHandleResidentNV, (void*)recording_glMakeImageHandleResidentNV },
+	{ "glMakeImageHandleNonResidentNV", (void**)&gl3wMakeImageHandleNonResidentNV, (void*)recording_glMakeImageHandleNonResidentNV },
+	{ "glUniformHandleui64NV", (void**)&gl3wUniformHandleui64NV, (void*)recording_glUniformHandleui64NV },
+	{ "glUniformHandleui64vNV", (void**)&gl3wUniformHandleui64vNV, (void*)recording_glUniformHandleui64vNV },
+	{ "glProgramUniformHandleui64NV", (void**)&gl3wProgramUniformHandleui64NV, (void*)recording_glProgramUniformHandleui64NV },
+	{ "glProgramUniformHandleui64vNV", (void**)&gl3wProgramUniformHandleui64vNV, (void*)recording_glProgramUniformHandleui64vNV },
+	{ "glIsTextureHandleResidentNV", (void**)&gl3wIsTextureHandleResidentNV, (void*)recording_glIsTextureHandleResidentNV },
+	{ "glIsImageHandleResidentNV", (void**)&gl3wIsImageHandleResidentNV, (void*)recording_glIsImageHandleResidentNV },
+	{ "glBlendParameteriNV", (void**)&gl3wBlendParameteriNV, (void*)recording_glBlendParameteriNV },
+	{ "glBlendBarrierNV", (void**)&gl3wBlendBarrierNV, (void*)recording_glBlendBarrierNV },
+	{ "glViewportPositionWScaleNV", (void**)&gl3wViewportPositionWScaleNV, (void*)recording_glViewportPositionWScaleNV },
+	{ "glCreateStatesNV", (void**)&gl3wCreateStatesNV, (void*)recording_glCreateStatesNV },
+	{ "glDeleteStatesNV", (void**)&gl3wDeleteStatesNV, (void*)recording_glDeleteStatesNV },
+	{ "glIsStateNV", (void**)&gl3wIsStateNV, (void*)recording_glIsStateNV },
+	{ "glStateCaptureNV", (void**)&gl3wStateCaptureNV, (void*)recording_glStateCaptureNV },
+	{ "glGetCommandHeaderNV", (void**)&gl3wGetCommandHeaderNV, (void*)recording_glGetCommandHeaderNV },
+	{ "glGetStageIndexNV", (void**)&gl3wGetStageIndexNV, (void*)recording_glGetStageIndexNV },
+	{ "glDrawCommandsNV", (void**)&gl3wDrawCommandsNV, (void*)recording_glDrawCommandsNV },
+	{ "glDrawCommandsAddressNV", (void**)&gl3wDrawCommandsAddressNV, (void*)recording_glDrawCommandsAddressNV },
+	{ "glDrawCommandsStatesNV", (void**)&gl3wDrawCommandsStatesNV, (void*)recording_glDrawCommandsStatesNV },
+	{ "glDrawCommandsStatesAddressNV", (void**)&gl3wDrawCommandsStatesAddressNV, (void*)recording_glDrawCommandsStatesAddressNV },
+	{ "glCreateCommandListsNV", (void**)&gl3wCreateCommandListsNV, (void*)recording_glCreateCommandListsNV },
+	{ "glDeleteCommandListsNV", (void**)&gl3wDeleteCommandListsNV, (void*)recording_glDeleteCommandListsNV },
+	{ "glIsCommandListNV", (void**)&gl3wIsCommandListNV, (void*)recording_glIsCommandListNV },
+	{ "glListDrawCommandsStatesClientNV", (void**)&gl3wListDrawCommandsStatesClientNV, (void*)recording_glListDrawCommandsStatesClientNV },
+	{ "glCommandListSegmentsNV", (void**)&gl3wCommandListSegmentsNV, (void*)recording_glCommandListSegmentsNV },
+	{ "glCompileCommandListNV", (void**)&gl3wCompileCommandListNV, (void*)recording_glCompileCommandListNV },
+	{ "glCallCommandListNV", (void**)&gl3wCallCommandListNV, (void*)recording_glCallCommandListNV },
+	{ "glBeginConditionalRenderNV", (void**)&gl3wBeginConditionalRenderNV, (void*)recording_glBeginConditionalRenderNV },
+	{ "glEndConditionalRenderNV", (void**)&gl3wEndConditionalRenderNV, (void*)recording_glEndConditionalRenderNV },
+	{ "glSubpixelPrecisionBiasNV", (void**)&gl3wSubpixelPrecisionBiasNV, (void*)recording_glSubpixelPrecisionBiasNV },
+	{ "glConservativeRasterParameterfNV", (void**)&gl3wConservativeRasterParameterfNV, (void*)recording_glConservativeRasterParameterfNV },
+	{ "glConservativeRasterParameteriNV", (void**)&gl3wConservativeRasterParameteriNV, (void*)recording_glConservativeRasterParameteriNV },
+	{ "glDrawVkImageNV", (void**)&gl3wDrawVkImageNV, (void*)recording_glDrawVkImageNV },
+	{ "glGetVkProcAddrNV", (void**)&gl3wGetVkProcAddrNV, (void*)recording_glGetVkProcAddrNV },
+	{ "glWaitVkSemaphoreNV", (void**)&gl3wWaitVkSemaphoreNV, (void*)recording_glWaitVkSemaphoreNV },
+	{ "glSignalVkSemaphoreNV", (void**)&gl3wSignalVkSemaphoreNV, (void*)recording_glSignalVkSemaphoreNV },
+	{ "glSignalVkFenceNV", (void**)&gl3wSignalVkFenceNV, (void*)recording_glSignalVkFenceNV },
+	{ "glFragmentCoverageColorNV", (void**)&gl3wFragmentCoverageColorNV, (void*)recording_glFragmentCoverageColorNV },
+	{ "glCoverageModulationTableNV", (void**)&gl3wCoverageModulationTableNV, (void*)recording_glCoverageModulationTableNV },
+	{ "glGetCoverageModulationTableNV", (void**)&gl3wGetCoverageModulationTableNV, (void*)recording_glGetCoverageModulationTableNV },
+	{ "glCoverageModulationNV", (void**)&gl3wCoverageModulationNV, (void*)recording_glCoverageModulationNV },
+	{ "glRenderbufferStorageMultisampleCoverageNV", (void**)&gl3wRenderbufferStorageMultisampleCoverageNV, (void*)recording_glRenderbufferStorageMultisampleCoverageNV },
+	{ "glUniform1i64NV", (void**)&gl3wUniform1i64NV, (void*)recording_glUniform1i64NV },
+	{ "glUniform2i64NV", (void**)&gl3wUniform2i64NV, (void*)recording_glUniform2i64NV },
+	{ "glUniform3i64NV", (void**)&gl3wUniform3i64NV, (void*)recording_glUniform3i64NV },
+	{ "glUniform4i64NV", (void**)&gl3wUniform4i64NV, (void*)recording_glUniform4i64NV },
+	{ "glUniform1i64vNV", (void**)&gl3wUniform1i64vNV, (void*)recording_glUniform1i64vNV },
+	{ "glUniform2i64vNV", (void**)&gl3wUniform2i64vNV, (void*)recording_glUniform2i64vNV },
+	{ "glUniform3i64vNV", (void**)&gl3wUniform3i64vNV, (void*)recording_glUniform3i64vNV },
+	{ "glUniform4i64vNV", (void**)&gl3wUniform4i64vNV, (void*)recording_glUniform4i64vNV },
+	{ "glUniform1ui64NV", (void**)&gl3wUniform1ui64NV, (void*)recording_glUniform1ui64NV },
+	{ "glUniform2ui64NV", (void**)&gl3wUniform2ui64NV, (void*)recording_glUniform2ui64NV },
+	{ "glUniform3ui64NV", (void**)&gl3wUniform3ui64NV, (void*)recording_glUniform3ui64NV },
+	{ "glUniform4ui64NV", (void**)&gl3wUniform4ui64NV, (void*)recording_glUniform4ui64NV },
+	{ "glUniform1ui64vNV", (void**)&gl3wUniform1ui64vNV, (void*)recording_glUniform1ui64vNV },
+	{ "glUniform2ui64vNV", (void**)&gl3wUniform2ui64vNV, (void*)recording_glUniform2ui64vNV },
+	{ "glUniform3ui64vNV", (void**)&gl3wUniform3ui64vNV, (void*)recording_glUniform3ui64vNV },
+	{ "glUniform4ui64vNV", (void**)&gl3wUniform4ui64vNV, (void*)recording_glUniform4ui64vNV },
+	{ "glGetUniformi64vNV", (void**)&gl3wGetUniformi64vNV, (void*)recording_glGetUniformi64vNV },
+	{ "glProgramUniform1i64NV", (void**)&gl3wProgramUniform1i64NV, (void*)recording_glProgramUniform1i64NV },
+	{ "glProgramUniform2i64NV", (void**)&gl3wProgramUniform2i64NV, (void*)recording_glProgramUniform2i64NV },
+	{ "glProgramUniform3i64NV", (void**)&gl3wProgramUniform3i64NV, (void*)recording_glProgramUniform3i64NV },
+	{ "glProgramUniform4i64NV", (void**)&gl3wProgramUniform4i64NV, (void*)recording_glProgramUniform4i64NV },
+	{ "glProgramUniform1i64vNV", (void**)&gl3wProgramUniform1i64vNV, (void*)recording_glProgramUniform1i64vNV },
+	{ "glProgramUniform2i64vNV", (void**)&gl3wProgramUniform2i64vNV, (void*)recording_glProgramUniform2i64vNV },
+	{ "glProgramUniform3i64vNV", (void**)&gl3wProgramUniform3i64vNV, (void*)recording_glProgramUniform3i64vNV },
+	{ "glProgramUniform4i64vNV", (void**)&gl3wProgramUniform4i64vNV, (void*)recording_glProgramUniform4i64vNV },
+	{ "glProgramUniform1ui64NV", (void**)&gl3wProgramUniform1ui64NV, (void*)recording_glProgramUniform1ui64NV },
+	{ "glProgramUniform2ui64NV", (void**)&gl3wProgramUniform2ui64NV, (void*)recording_glProgramUniform2ui64NV },
+	{ "glProgramUniform3ui64NV", (void**)&gl3wProgramUniform3ui64NV, (void*)recording_glProgramUniform3ui64NV },
+	{ "glProgramUniform4ui64NV", (void**)&gl3wProgramUniform4ui64NV, (void*)recording_glProgramUniform4ui64NV },
+	{ "glProgramUniform1ui64vNV", (void**)&gl3wProgramUniform1ui64vNV, (void*)recording_glProgramUniform1ui64vNV },
+	{ "glProgramUniform2ui64vNV", (void**)&gl3wProgramUniform2ui64vNV, (void*)recording_glProgramUniform2ui64vNV },
+	{ "glProgramUniform3ui64vNV", (void**)&gl3wProgramUniform3ui64vNV, (void*)recording_glProgramUniform3ui64vNV },
+	{ "glProgramUniform4ui64vNV", (void**)&gl3wProgramUniform4ui64vNV, (void*)recording_glProgramUniform4ui64vNV },
+	{ "glGetInternalformatSampleivNV", (void**)&gl3wGetInternalformatSampleivNV, (void*)recording_glGetInternalformatSampleivNV },
+	{ "glGetMemoryObjectDetachedResourcesuivNV", (void**)&gl3wGetMemoryObjectDetachedResourcesuivNV, (void*)recording_glGetMemoryObjectDetachedResourcesuivNV },
+	{ "glResetMemoryObjectParameterNV", (void**)&gl3wResetMemoryObjectParameterNV, (void*)recording_glResetMemoryObjectParameterNV },
+	{ "glTexAttachMemoryNV", (void**)&gl3wTexAttachMemoryNV, (void*)recording_glTexAttachMemoryNV },
+	{ "glBufferAttachMemoryNV", (void**)&gl3wBufferAttachMemoryNV, (void*)recording_glBufferAttachMemoryNV },
+	{ "glTextureAttachMemoryNV", (void**)&gl3wTextureAttachMemoryNV, (void*)recording_glTextureAttachMemoryNV },
+	{ "glNamedBufferAttachMemoryNV", (void**)&gl3wNamedBufferAttachMemoryNV, (void*)recording_glNamedBufferAttachMemoryNV },
+	{ "glDrawMeshTasksNV", (void**)&gl3wDrawMeshTasksNV, (void*)recording_glDrawMeshTasksNV },
+	{ "glDrawMeshTasksIndirectNV", (void**)&gl3wDrawMeshTasksIndirectNV, (void*)recording_glDrawMeshTasksIndirectNV },
+	{ "glMultiDrawMeshTasksIndirectNV", (void**)&gl3wMultiDrawMeshTasksIndirectNV, (void*)recording_glMultiDrawMeshTasksIndirectNV },
+	{ "glMultiDrawMeshTasksIndirectCountNV", (void**)&gl3wMultiDrawMeshTasksIndirectCountNV, (void*)recording_glMultiDrawMeshTasksIndirectCountNV },
+	{ "glGenPathsNV", (void**)&gl3wGenPathsNV, (void*)recording_glGenPathsNV },
+	{ "glDeletePathsNV", (void**)&gl3wDeletePathsNV, (void*)recording_glDeletePathsNV },
+	{ "glIsPathNV", (void**)&gl3wIsPathNV, (void*)recording_glIsPathNV },
+	{ "glPathCommandsNV", (void**)&gl3wPathCommandsNV, (void*)recording_glPathCommandsNV },
+	{ "glPathCoordsNV", (void**)&gl3wPathCoordsNV, (void*)recording_glPathCoordsNV },
+	{ "glPathSubCommandsNV", (void**)&gl3wPathSubCommandsNV, (void*)recording_glPathSubCommandsNV },
+	{ "glPathSubCoordsNV", (void**)&gl3wPathSubCoordsNV, (void*)recording_glPathSubCoordsNV },
+	{ "glPathStringNV", (void**)&gl3wPathStringNV, (void*)recording_glPathStringNV },
+	{ "glPathGlyphsNV", (void**)&gl3wPathGlyphsNV, (void*)recording_glPathGlyphsNV },
+	{ "glPathGlyphRangeNV", (void**)&gl3wPathGlyphRangeNV, (void*)recording_glPathGlyphRangeNV },
+	{ "glWeightPathsNV", (void**)&gl3wWeightPathsNV, (void*)recording_glWeightPathsNV },
+	{ "glCopyPathNV", (void**)&gl3wCopyPathNV, (void*)recording_glCopyPathNV },
+	{ "glInterpolatePathsNV", (void**)&gl3wInterpolatePathsNV, (void*)recording_glInterpolatePathsNV },
+	{ "glTransformPathNV", (void**)&gl3wTransformPathNV, (void*)recording_glTransformPathNV },
+	{ "glPathParameterivNV", (void**)&gl3wPathParameterivNV, (void*)recording_glPathParameterivNV },
+	{ "glPathParameteriNV", (void**)&gl3wPathParameteriNV, (void*)recording_glPathParameteriNV },
+	{ "glPathParameterfvNV", (void**)&gl3wPathParameterfvNV, (void*)recording_glPathParameterfvNV },
+	{ "glPathParameterfNV", (void**)&gl3wPathParameterfNV, (void*)recording_glPathParameterfNV },
+	{ "glPathDashArrayNV", (void**)&gl3wPathDashArrayNV, (void*)recording_glPathDashArrayNV },
+	{ "glPathStencilFuncNV", (void**)&gl3wPathStencilFuncNV, (void*)recording_glPathStencilFuncNV },
+	{ "glPathStencilDepthOffsetNV", (void**)&gl3wPathStencilDepthOffsetNV, (void*)recording_glPathStencilDepthOffsetNV },
+	{ "glStencilFillPathNV", (void**)&gl3wStencilFillPathNV, (void*)recording_glStencilFillPathNV },
+	{ "glStencilStrokePathNV", (void**)&gl3wStencilStrokePathNV, (void*)recording_glStencilStrokePathNV },
+	{ "glStencilFillPathInstancedNV", (void**)&gl3wStencilFillPathInstancedNV, (void*)recording_glStencilFillPathInstancedNV },
+	{ "glStencilStrokePathInstancedNV", (void**)&gl3wStencilStrokePathInstancedNV, (void*)recording_glStencilStrokePathInstancedNV },
+	{ "glPathCoverDepthFuncNV", (void**)&gl3wPathCoverDepthFuncNV, (void*)recording_glPathCoverDepthFuncNV },
+	{ "glCoverFillPathNV", (void**)&gl3wCoverFillPathNV, (void*)recording_glCoverFillPathNV },
+	{ "glCoverStrokePathNV", (void**)&gl3wCoverStrokePathNV, (void*)recording_glCoverStrokePathNV },
+	{ "glCoverFillPathInstancedNV", (void**)&gl3wCoverFillPathInstancedNV, (void*)recording_glCoverFillPathInstancedNV },
+	{ "glCoverStrokePathInstancedNV", (void**)&gl3wCoverStrokePathInstancedNV, (void*)recording_glCoverStrokePathInstancedNV },
+	{ "glGetPathParameterivNV", (void**)&gl3wGetPathParameterivNV, (void*)recording_glGetPathParameterivNV },
+	{ "glGetPathParameterfvNV", (void**)&gl3wGetPathParameterfvNV, (void*)recording_glGetPathParameterfvNV },
+	{ "glGetPathCommandsNV", (void**)&gl3wGetPathCommandsNV, (void*)recording_glGetPathCommandsNV },
+	{ "glGetPathCoordsNV", (void**)&gl3wGetPathCoordsNV, (void*)recording_glGetPathCoordsNV },
+	{ "glGetPathDashArrayNV", (void**)&gl3wGetPathDashArrayNV, (void*)recording_glGetPathDashArrayNV },
+	{ "glGetPathMetricsNV", (void**)&gl3wGetPathMetricsNV, (void*)recording_glGetPathMetricsNV },
+	{ "glGetPathMetricRangeNV", (void**)&gl3wGetPathMetricRangeNV, (void*)recording_glGetPathMetricRangeNV },
+	{ "glGetPathSpacingNV", (void**)&gl3wGetPathSpacingNV, (void*)recording_glGetPathSpacingNV },
+	{ "glIsPointInFillPathNV", (void**)&gl3wIsPointInFillPathNV, (void*)recording_glIsPointInFillPathNV },
+	{ "glIsPointInStrokePathNV", (void**)&gl3wIsPointInStrokePathNV, (void*)recording_glIsPointInStrokePathNV },
+	{ "glGetPathLengthNV", (void**)&gl3wGetPathLengthNV, (void*)recording_glGetPathLengthNV },
+	{ "glPointAlongPathNV", (void**)&gl3wPointAlongPathNV, (void*)recording_glPointAlongPathNV },
+	{ "glMatrixLoad3x2fNV", (void**)&gl3wMatrixLoad3x2fNV, (void*)recording_glMatrixLoad3x2fNV },
+	{ "glMatrixLoad3x3fNV", (void**)&gl3wMatrixLoad3x3fNV, (void*)recording_glMatrixLoad3x3fNV },
+	{ "glMatrixLoadTranspose3x3fNV", (void**)&gl3wMatrixLoadTranspose3x3fNV, (void*)recording_glMatrixLoadTranspose3x3fNV },
+	{ "glMatrixMult3x2fNV", (void**)&gl3wMatrixMult3x2fNV, (void*)recording_glMatrixMult3x2fNV },
+	{ "glMatrixMult3x3fNV", (void**)&gl3wMatrixMult3x3fNV, (void*)recording_glMatrixMult3x3fNV },
+	{ "glMatrixMultTranspose3x3fNV", (void**)&gl3wMatrixMultTranspose3x3fNV, (void*)recording_glMatrixMultTranspose3x3fNV },
+	{ "glStencilThenCoverFillPathNV", (void**)&gl3wStencilThenCoverFillPathNV, (void*)recording_glStencilThenCoverFillPathNV },
+	{ "glStencilThenCoverStrokePathNV", (void**)&gl3wStencilThenCoverStrokePathNV, (void*)recording_glStencilThenCoverStrokePathNV },
+	{ "glStencilThenCoverFillPathInstancedNV", (void**)&gl3wStencilThenCoverFillPathInstancedNV, (void*)recording_glStencilThenCoverFillPathInstancedNV },
+	{ "glStencilThenCoverStrokePathInstancedNV", (void**)&gl3wStencilThenCoverStrokePathInstancedNV, (void*)recording_glStencilThenCoverStrokePathInstancedNV },
+	{ "glPathGlyphIndexRangeNV", (void**)&gl3wPathGlyphIndexRangeNV, (void*)recording_glPathGlyphIndexRangeNV },
+	{ "glPathGlyphIndexArrayNV", (void**)&gl3wPathGlyphIndexArrayNV, (void*)recording_glPathGlyphIndexArrayNV },
+	{ "glPathMemoryGlyphIndexArrayNV", (void**)&gl3wPathMemoryGlyphIndexArrayNV, (void*)recording_glPathMemoryGlyphIndexArrayNV },
+	{ "glProgramPathFragmentInputGenNV", (void**)&gl3wProgramPathFragmentInputGenNV, (void*)recording_glProgramPathFragmentInputGenNV },
+	{ "glGetProgramResourcefvNV", (void**)&gl3wGetProgramResourcefvNV, (void*)recording_glGetProgramResourcefvNV },
+	{ "glFramebufferSampleLocationsfvNV", (void**)&gl3wFramebufferSampleLocationsfvNV, (void*)recording_glFramebufferSampleLocationsfvNV },
+	{ "glNamedFramebufferSampleLocationsfvNV", (void**)&gl3wNamedFramebufferSampleLocationsfvNV, (void*)recording_glNamedFramebufferSampleLocationsfvNV },
+	{ "glResolveDepthValuesNV", (void**)&gl3wResolveDepthValuesNV, (void*)recording_glResolveDepthValuesNV },
+	{ "glScissorExclusiveNV", (void**)&gl3wScissorExclusiveNV, (void*)recording_glScissorExclusiveNV },
+	{ "glScissorExclusiveArrayvNV", (void**)&gl3wScissorExclusiveArrayvNV, (void*)recording_glScissorExclusiveArrayvNV },
+	{ "glMakeBufferResidentNV", (void**)&gl3wMakeBufferResidentNV, (void*)recording_glMakeBufferResidentNV },
+	{ "glMakeBufferNonResidentNV", (void**)&gl3wMakeBufferNonResidentNV, (void*)recording_glMakeBufferNonResidentNV },
+	{ "glIsBufferResidentNV", (void**)&gl3wIsBufferResidentNV, (void*)recording_glIsBufferResidentNV },
+	{ "glMakeNamedBufferResidentNV", (void**)&gl3wMakeNamedBufferResidentNV, (void*)recording_glMakeNamedBufferResidentNV },
+	{ "glMakeNamedBufferNonResidentNV", (void**)&gl3wMakeNamedBufferNonResidentNV, (void*)recording_glMakeNamedBufferNonResidentNV },
+	{ "glIsNamedBufferResidentNV", (void**)&gl3wIsNamedBufferResidentNV, (void*)recording_glIsNamedBufferResidentNV },
+	{ "glGetBufferParameterui64vNV", (void**)&gl3wGetBufferParameterui64vNV, (void*)recording_glGetBufferParameterui64vNV },
+	{ "glGetNamedBufferParameterui64vNV", (void**)&gl3wGetNamedBufferParameterui64vNV, (void*)recording_glGetNamedBufferParameterui64vNV },
+	{ "glGetIntegerui64vNV", (void**)&gl3wGetIntegerui64vNV, (void*)recording_glGetIntegerui64vNV },
+	{ "glUniformui64NV", (void**)&gl3wUniformui64NV, (void*)recording_glUniformui64NV },
+	{ "glUniformui64vNV", (void**)&gl3wUniformui64vNV, (void*)recording_glUniformui64vNV },
+	{ "glGetUniformui64vNV", (void**)&gl3wGetUniformui64vNV, (void*)recording_glGetUniformui64vNV },
+	{ "glProgramUniformui64NV", (void**)&gl3wProgramUniformui64NV, (void*)recording_glProgramUniformui64NV },
+	{ "glProgramUniformui64vNV", (void**)&gl3wProgramUniformui64vNV, (void*)recording_glProgramUniformui64vNV },
+	{ "glBindShadingRateImageNV", (void**)&gl3wBindShadingRateImageNV, (void*)recording_glBindShadingRateImageNV },
+	{ "glGetShadingRateImagePaletteNV", (void**)&gl3wGetShadingRateImagePaletteNV, (void*)recording_glGetShadingRateImagePaletteNV },
+	{ "glGetShadingRateSampleLocationivNV", (void**)&gl3wGetShadingRateSampleLocationivNV, (void*)recording_glGetShadingRateSampleLocationivNV },
+	{ "glShadingRateImageBarrierNV", (void**)&gl3wShadingRateImageBarrierNV, (void*)recording_glShadingRateImageBarrierNV },
+	{ "glShadingRateImagePaletteNV", (void**)&gl3wShadingRateImagePaletteNV, (void*)recording_glShadingRateImagePaletteNV },
+	{ "glShadingRateSampleOrderNV", (void**)&gl3wShadingRateSampleOrderNV, (void*)recording_glShadingRateSampleOrderNV },
+	{ "glShadingRateSampleOrderCustomNV", (void**)&gl3wShadingRateSampleOrderCustomNV, (void*)recording_glShadingRateSampleOrderCustomNV },
+	{ "glTextureBarrierNV", (void**)&gl3wTextureBarrierNV, (void*)recording_glTextureBarrierNV },
+	{ "glVertexAttribL1i64NV", (void**)&gl3wVertexAttribL1i64NV, (void*)recording_glVertexAttribL1i64NV },
+	{ "glVertexAttribL2i64NV", (void**)&gl3wVertexAttribL2i64NV, (void*)recording_glVertexAttribL2i64NV },
+	{ "glVertexAttribL3i64NV", (void**)&gl3wVertexAttribL3i64NV, (void*)recording_glVertexAttribL3i64NV },
+	{ "glVertexAttribL4i64NV", (void**)&gl3wVertexAttribL4i64NV, (void*)recording_glVertexAttribL4i64NV },
+	{ "glVertexAttribL1i64vNV", (void**)&gl3wVertexAttribL1i64vNV, (void*)recording_glVertexAttribL1i64vNV },
+	{ "glVertexAttribL2i64vNV", (void**)&gl3wVertexAttribL2i64vNV, (void*)recording_glVertexAttribL2i64vNV },
+	{ "glVertexAttribL3i64vNV", (void**)&gl3wVertexAttribL3i64vNV, (void*)recording_glVertexAttribL3i64vNV },
+	{ "glVertexAttribL4i64vNV", (void**)&gl3wVertexAttribL4i64vNV, (void*)recording_glVertexAttribL4i64vNV },
+	{ "glVertexAttribL1ui64NV", (void**)&gl3wVertexAttribL1ui64NV, (void*)recording_glVertexAttribL1ui64NV },
+	{ "glVertexAttribL2ui64NV", (void**)&gl3wVertexAttribL2ui64NV, (void*)recording_glVertexAttribL2ui64NV },
+	{ "glVertexAttribL3ui64NV", (void**)&gl3wVertexAttribL3ui64NV, (void*)recording_glVertexAttribL3ui64NV },
+	{ "glVertexAttribL4ui64NV", (void**)&gl3wVertexAttribL4ui64NV, (void*)recording_glVertexAttribL4ui64NV },
+	{ "glVertexAttribL1ui64vNV", (void**)&gl3wVertexAttribL1ui64vNV, (void*)recording_glVertexAttribL1ui64vNV },
+	{ "glVertexAttribL2ui64vNV", (void**)&gl3wVertexAttribL2ui64vNV, (void*)recording_glVertexAttribL2ui64vNV },
+	{ "glVertexAttribL3ui64vNV", (void**)&gl3wVertexAttribL3ui64vNV, (void*)recording_glVertexAttribL3ui64vNV },
+	{ "glVertexAttribL4ui64vNV", (void**)&gl3wVertexAttribL4ui64vNV, (void*)recording_glVertexAttribL4ui64vNV },
+	{ "glGetVertexAttribLi64vNV", (void**)&gl3wGetVertexAttribLi64vNV, (void*)recording_glGetVertexAttribLi64vNV },
+	{ "glGetVertexAttribLui64vNV", (void**)&gl3wGetVertexAttribLui64vNV, (void*)recording_glGetVertexAttribLui64vNV },
+	{ "glVertexAttribLFormatNV", (void**)&gl3wVertexAttribLFormatNV, (void*)recording_glVertexAttribLFormatNV },
+	{ "glBufferAddressRangeNV", (void**)&gl3wBufferAddressRangeNV, (void*)recording_glBufferAddressRangeNV },
+	{ "glVertexFormatNV", (void**)&gl3wVertexFormatNV, (void*)recording_glVertexFormatNV },
+	{ "glNormalFormatNV", (void**)&gl3wNormalFormatNV, (void*)recording_glNormalFormatNV },
+	{ "glColorFormatNV", (void**)&gl3wColorFormatNV, (void*)recording_glColorFormatNV },
+	{ "glIndexFormatNV", (void**)&gl3wIndexFormatNV, (void*)recording_glIndexFormatNV },
+	{ "glTexCoordFormatNV", (void**)&gl3wTexCoordFormatNV, (void*)recording_glTexCoordFormatNV },
+	{ "glEdgeFlagFormatNV", (void**)&gl3wEdgeFlagFormatNV, (void*)recording_glEdgeFlagFormatNV },
+	{ "glSecondaryColorFormatNV", (void**)&gl3wSecondaryColorFormatNV, (void*)recording_glSecondaryColorFormatNV },
+	{ "glFogCoordFormatNV", (void**)&gl3wFogCoordFormatNV, (void*)recording_glFogCoordFormatNV },
+	{ "glVertexAttribFormatNV", (void**)&gl3wVertexAttribFormatNV, (void*)recording_glVertexAttribFormatNV },
+	{ "glVertexAttribIFormatNV", (void**)&gl3wVertexAttribIFormatNV, (void*)recording_glVertexAttribIFormatNV },
+	{ "glGetIntegerui64i_vNV", (void**)&gl3wGetIntegerui64i_vNV, (void*)recording_glGetIntegerui64i_vNV },
+	{ "glViewportSwizzleNV", (void**)&gl3wViewportSwizzleNV, (void*)recording_glViewportSwizzleNV },
+	{ "glFramebufferTextureMultiviewOVR", (void**)&gl3wFramebufferTextureMultiviewOVR, (void*)recording_glFramebufferTextureMultiviewOVR },
+};
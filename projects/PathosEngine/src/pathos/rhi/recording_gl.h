@@ -0,0 +1,61 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+
+#include <vector>
+#include <string>
+
+// Recording GL backend for headless runs (see EngineConfig::headless).
+// Every gl3w function pointer is replaced with a stub that records the call and does nothing,
+// so the whole renderer runs on CPU without a GPU or a window. Most stubs only count the call,
+// but some are overridden to return new object names, complete framebuffers, linked programs,
+// signaled fences, mappable memory, and plausible driver limits.
+
+namespace pathos {
+
+	struct RecordingGLStats {
+		uint64 numCalls          = 0;
+		uint64 numDrawCalls      = 0; // glDraw* and glMultiDraw*
+		uint64 numDispatchCalls  = 0; // glDispatchCompute*
+		uint64 numStateChanges   = 0; // glEnable, glBind*, glUseProgram, blend/depth/stencil/raster state...
+		uint64 numObjectsCreated = 0;
+		uint64 numObjectsDeleted = 0;
+		uint64 bytesUploaded     = 0; // Buffer data, texture images, and mapped ranges with write access
+
+		void add(const RecordingGLStats& other);
+		void subtract(const RecordingGLStats& other);
+	};
+
+	// Calls between glPushDebugGroup() and glPopDebugGroup(), including nested groups.
+	// Groups with the same name under the same parent are merged.
+	struct RecordingGLPassStats {
+		std::string name;
+		int32 parent; // Index of the parent pass or -1
+		uint32 depth;
+		uint32 numInvocations;
+		RecordingGLStats stats;
+	};
+
+	// Everything recorded between two presents.
+	struct RecordingGLFrame {
+		uint64 frameCount = 0; // Number of frames presented since installRecordingGL()
+		RecordingGLStats stats;
+		RecordingGLStats totalStats; // Sum of all presented frames
+		std::vector<RecordingGLPassStats> passes; // In order of first push
+		std::vector<uint32> callCounts; // Indexed by GL function index
+	};
+
+	// Call instead of gl3wInit() to start recording.
+	void installRecordingGL();
+	bool isRecordingGLInstalled();
+
+	// Call instead of SwapBuffers() in the GL thread. Publishes the current frame and starts a new one.
+	void presentRecordingGLFrame();
+
+	// Copy of the last presented frame. Safe to call in any thread.
+	void getLastRecordingGLFrame(RecordingGLFrame& outFrame);
+
+	uint32 getNumRecordingGLFunctions();
+	const char* getRecordingGLFunctionName(uint32 functionIndex);
+
+}
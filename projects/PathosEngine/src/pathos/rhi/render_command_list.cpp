@@ -1,16 +1,21 @@
 #include "render_command_list.h"
 #include "render_commands.h"
 #include "render_device.h"
+#include "render_state_cache.h"
 #include "texture.h"
+#include "pathos/console.h"
 #include "pathos/util/engine_thread.h"
 
 #include "badger/assertion/assertion.h"
+#include "badger/system/job_system.h"
 
 
 #define ASSERT_GL_NO_ERROR 0
 
 namespace pathos {
 
+	static ConsoleVariable<int32> cvarEliminateRedundantState("r.eliminateRedundantState", 1, "Skip render commands that would not change GL states (0 = disable, 1 = enable)");
+
 	const uint32 RenderCommandList::RENDER_COMMAND_LIST_MAX_MEMORY = 32 * 1024 * 1024; // 32 MB
 	const uint32 RenderCommandList::COMMAND_PARAMETERS_MAX_MEMORY = 16 * 1024 * 1024; // 16 MB
 
@@ -23,7 +28,8 @@ namespace pathos {
 	{
 		commands_alloc.clear();
 		parameters_alloc.clear();
-		commands.clear();
+		numCommands = 0;
+		secondaryCommandLists.clear();
 	}
 
 	void RenderCommandList::executeAllCommands()
@@ -34,14 +40,28 @@ namespace pathos {
 
 		static constexpr bool bAllowAppendWhileExecuting = false;
 
-		uint32 p = 0;
+		RenderStateCache& stateCache = RenderStateCache::get();
+		const bool bEliminateRedundantState = cvarEliminateRedundantState.getInt() != 0;
+		const PFN_EXECUTE hookExecute = PFN_EXECUTE(RenderCommand_registerHook::execute);
+
+		uint8* base = commands_alloc.getBaseAddress();
+		uint32 offset = 0;
+		debugCurrentCommandIx = 0;
 		while (true) {
-			uint32 n = (uint32)commands.size();
-			for (; p < n; ++p) {
-				debugCurrentCommandIx = p;
-				commands[p]->pfn_execute(commands[p]);
+			const uint32 endOffset = commands_alloc.getUsedBytes();
+			while (offset < endOffset) {
+				const RenderCommandBase* packet = reinterpret_cast<const RenderCommandBase*>(base + offset);
+				if (!bEliminateRedundantState || !stateCache.isRedundant(packet)) {
+					packet->pfn_execute(packet);
+					if (packet->pfn_execute == hookExecute) {
+						// Hooks may call GL directly.
+						stateCache.invalidate();
+					}
+				}
+				offset += packet->packetBytes;
+				++debugCurrentCommandIx;
 			}
-			if (n == commands.size()) {
+			if (endOffset == commands_alloc.getUsedBytes()) {
 				break;
 			}
 			if (!bAllowAppendWhileExecuting) {
@@ -60,9 +80,11 @@ namespace pathos {
 
 		++flushDepth;
 		if (flushDepth == 1) {
+			RenderStateCache::get().beginFlush();
 			executeAllCommands();
 			clearAllCommands();
 			performDeferredCleanup();
+			RenderStateCache::get().endFlush();
 		} else {
 			CHECKF(0, "You must not nest flushAllCommands() calls");
 		}
@@ -78,13 +100,56 @@ namespace pathos {
 		// #todo-renderthread: Needs rework if multiple non-render threads use the deferred command list.
 		// For now, it will be OK as only the main thread use it.
 
-		RenderCommand_registerHook* __restrict packet = (RenderCommand_registerHook*)getNextPacket();
-		memset(packet, 0, sizeof(RenderCommandPacketUnion));
+		void* mem = allocatePacket<RenderCommand_registerHook>();
+		const uint32 packetBytes = reinterpret_cast<RenderCommandBase*>(mem)->packetBytes;
+		RenderCommand_registerHook* __restrict packet = new (mem) RenderCommand_registerHook;
 		packet->pfn_execute = PFN_EXECUTE(RenderCommand_registerHook::execute);
+		packet->packetBytes = packetBytes;
 		packet->hook = hook;
 		packet->hookCommandList = hookCommandList;
 	}
 
+	void RenderCommandList::appendSecondaryCommandList(RenderCommandList* secondaryCommandList)
+	{
+		CHECK(secondaryCommandList != nullptr && secondaryCommandList != this);
+
+		// Always splice, even if the secondary list is empty now. It might be recorded later.
+		RenderCommand_executeSecondary* __restrict packet = allocatePacket<RenderCommand_executeSecondary>();
+		packet->pfn_execute = PFN_EXECUTE(RenderCommand_executeSecondary::execute);
+		packet->secondaryCommandList = secondaryCommandList;
+
+		secondaryCommandLists.push_back(secondaryCommandList);
+	}
+
+	uint32 RenderCommandList::getNumCommands() const
+	{
+		// The splice packets themselves are not meaningful commands.
+		uint32 count = numCommands - (uint32)secondaryCommandLists.size();
+		for (const RenderCommandList* secondaryCommandList : secondaryCommandLists) {
+			count += secondaryCommandList->getNumCommands();
+		}
+		return count;
+	}
+
+	void RenderCommandList::recordSecondaryCommandLists(
+		JobSystem* jobSystem,
+		RenderCommandList* const* secondaryCommandLists,
+		uint32 numSecondaryCommandLists,
+		const std::function<void(RenderCommandList& cmdList, uint32 index)>& recordRoutine)
+	{
+		parallelFor(jobSystem, numSecondaryCommandLists, 1,
+			[secondaryCommandLists, &recordRoutine](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					recordRoutine(*(secondaryCommandLists[i]), i);
+				}
+			}
+		);
+
+		for (uint32 i = 0; i < numSecondaryCommandLists; ++i) {
+			appendSecondaryCommandList(secondaryCommandLists[i]);
+		}
+	}
+
 	void RenderCommandList::registerDeferredCleanup(void* dynamicMemory) {
 		std::lock_guard<std::mutex> lockGuard(deferredCleanupLock);
 		deferredMemoryCleanups.push_back(dynamicMemory);
@@ -109,22 +174,22 @@ namespace pathos {
 		std::lock_guard<std::mutex> lockGuard(deferredCleanupLock);
 		for (void* memory : deferredMemoryCleanups) delete memory;
 		deferredMemoryCleanups.clear();
-		gRenderDevice->deleteBuffers((GLsizei)deferredBufferCleanups.size(), deferredBufferCleanups.data());
-		deferredBufferCleanups.clear();
-		gRenderDevice->deleteTextures((GLsizei)deferredTextureCleanups.size(), deferredTextureCleanups.data());
-		deferredTextureCleanups.clear();
-		gRenderDevice->deleteSamplers((GLsizei)deferredSamplerCleanups.size(), deferredSamplerCleanups.data());
-		deferredSamplerCleanups.clear();
-	}
-
-	RenderCommandBase* RenderCommandList::getNextPacket()
-	{
-		//std::lock_guard<std::mutex> lockGuard(commandListLock);
-
-		RenderCommandBase* packet = (RenderCommandBase*)commands_alloc.alloc(sizeof(RenderCommandPacketUnion));
-		CHECKF(packet != nullptr, "Not enough memory for render command list");
-		commands.push_back(packet);
-		return packet;
+		if (deferredBufferCleanups.size() > 0 || deferredTextureCleanups.size() > 0 || deferredSamplerCleanups.size() > 0) {
+			// Deleted names can be reused while the outer list is still executing.
+			RenderStateCache::get().invalidate();
+		}
+		if (deferredBufferCleanups.size() > 0) {
+			gRenderDevice->deleteBuffers((GLsizei)deferredBufferCleanups.size(), deferredBufferCleanups.data());
+			deferredBufferCleanups.clear();
+		}
+		if (deferredTextureCleanups.size() > 0) {
+			gRenderDevice->deleteTextures((GLsizei)deferredTextureCleanups.size(), deferredTextureCleanups.data());
+			deferredTextureCleanups.clear();
+		}
+		if (deferredSamplerCleanups.size() > 0) {
+			gRenderDevice->deleteSamplers((GLsizei)deferredSamplerCleanups.size(), deferredSamplerCleanups.data());
+			deferredSamplerCleanups.clear();
+		}
 	}
 
 }
@@ -1,14 +1,14 @@
 void cullFace(
 	GLenum mode)
 {
-	RenderCommand_cullFace* __restrict packet = (RenderCommand_cullFace*)getNextPacket();
+	RenderCommand_cullFace* __restrict packet = allocatePacket<RenderCommand_cullFace>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_cullFace::execute);
 	packet->mode = mode;
 }
 void frontFace(
 	GLenum mode)
 {
-	RenderCommand_frontFace* __restrict packet = (RenderCommand_frontFace*)getNextPacket();
+	RenderCommand_frontFace* __restrict packet = allocatePacket<RenderCommand_frontFace>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_frontFace::execute);
 	packet->mode = mode;
 }
@@ -16,7 +16,7 @@ void hint(
 	GLenum target,
 	GLenum mode)
 {
-	RenderCommand_hint* __restrict packet = (RenderCommand_hint*)getNextPacket();
+	RenderCommand_hint* __restrict packet = allocatePacket<RenderCommand_hint>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_hint::execute);
 	packet->target = target;
 	packet->mode = mode;
@@ -24,14 +24,14 @@ void hint(
 void lineWidth(
 	GLfloat width)
 {
-	RenderCommand_lineWidth* __restrict packet = (RenderCommand_lineWidth*)getNextPacket();
+	RenderCommand_lineWidth* __restrict packet = allocatePacket<RenderCommand_lineWidth>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_lineWidth::execute);
 	packet->width = width;
 }
 void pointSize(
 	GLfloat size)
 {
-	RenderCommand_pointSize* __restrict packet = (RenderCommand_pointSize*)getNextPacket();
+	RenderCommand_pointSize* __restrict packet = allocatePacket<RenderCommand_pointSize>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointSize::execute);
 	packet->size = size;
 }
@@ -39,7 +39,7 @@ void polygonMode(
 	GLenum face,
 	GLenum mode)
 {
-	RenderCommand_polygonMode* __restrict packet = (RenderCommand_polygonMode*)getNextPacket();
+	RenderCommand_polygonMode* __restrict packet = allocatePacket<RenderCommand_polygonMode>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_polygonMode::execute);
 	packet->face = face;
 	packet->mode = mode;
@@ -50,7 +50,7 @@ void scissor(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_scissor* __restrict packet = (RenderCommand_scissor*)getNextPacket();
+	RenderCommand_scissor* __restrict packet = allocatePacket<RenderCommand_scissor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissor::execute);
 	packet->x = x;
 	packet->y = y;
@@ -62,7 +62,7 @@ void texParameterf(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_texParameterf* __restrict packet = (RenderCommand_texParameterf*)getNextPacket();
+	RenderCommand_texParameterf* __restrict packet = allocatePacket<RenderCommand_texParameterf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameterf::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -73,7 +73,7 @@ void texParameterfv(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_texParameterfv* __restrict packet = (RenderCommand_texParameterfv*)getNextPacket();
+	RenderCommand_texParameterfv* __restrict packet = allocatePacket<RenderCommand_texParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameterfv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -84,7 +84,7 @@ void texParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_texParameteri* __restrict packet = (RenderCommand_texParameteri*)getNextPacket();
+	RenderCommand_texParameteri* __restrict packet = allocatePacket<RenderCommand_texParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameteri::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -95,7 +95,7 @@ void texParameteriv(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_texParameteriv* __restrict packet = (RenderCommand_texParameteriv*)getNextPacket();
+	RenderCommand_texParameteriv* __restrict packet = allocatePacket<RenderCommand_texParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameteriv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -111,7 +111,7 @@ void texImage1D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texImage1D* __restrict packet = (RenderCommand_texImage1D*)getNextPacket();
+	RenderCommand_texImage1D* __restrict packet = allocatePacket<RenderCommand_texImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -133,7 +133,7 @@ void texImage2D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texImage2D* __restrict packet = (RenderCommand_texImage2D*)getNextPacket();
+	RenderCommand_texImage2D* __restrict packet = allocatePacket<RenderCommand_texImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -148,14 +148,14 @@ void texImage2D(
 void drawBuffer(
 	GLenum buf)
 {
-	RenderCommand_drawBuffer* __restrict packet = (RenderCommand_drawBuffer*)getNextPacket();
+	RenderCommand_drawBuffer* __restrict packet = allocatePacket<RenderCommand_drawBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawBuffer::execute);
 	packet->buf = buf;
 }
 void clear(
 	GLbitfield mask)
 {
-	RenderCommand_clear* __restrict packet = (RenderCommand_clear*)getNextPacket();
+	RenderCommand_clear* __restrict packet = allocatePacket<RenderCommand_clear>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clear::execute);
 	packet->mask = mask;
 }
@@ -165,7 +165,7 @@ void clearColor(
 	GLfloat blue,
 	GLfloat alpha)
 {
-	RenderCommand_clearColor* __restrict packet = (RenderCommand_clearColor*)getNextPacket();
+	RenderCommand_clearColor* __restrict packet = allocatePacket<RenderCommand_clearColor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearColor::execute);
 	packet->red = red;
 	packet->green = green;
@@ -175,21 +175,21 @@ void clearColor(
 void clearStencil(
 	GLint s)
 {
-	RenderCommand_clearStencil* __restrict packet = (RenderCommand_clearStencil*)getNextPacket();
+	RenderCommand_clearStencil* __restrict packet = allocatePacket<RenderCommand_clearStencil>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearStencil::execute);
 	packet->s = s;
 }
 void clearDepth(
 	GLdouble depth)
 {
-	RenderCommand_clearDepth* __restrict packet = (RenderCommand_clearDepth*)getNextPacket();
+	RenderCommand_clearDepth* __restrict packet = allocatePacket<RenderCommand_clearDepth>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearDepth::execute);
 	packet->depth = depth;
 }
 void stencilMask(
 	GLuint mask)
 {
-	RenderCommand_stencilMask* __restrict packet = (RenderCommand_stencilMask*)getNextPacket();
+	RenderCommand_stencilMask* __restrict packet = allocatePacket<RenderCommand_stencilMask>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilMask::execute);
 	packet->mask = mask;
 }
@@ -199,7 +199,7 @@ void colorMask(
 	GLboolean blue,
 	GLboolean alpha)
 {
-	RenderCommand_colorMask* __restrict packet = (RenderCommand_colorMask*)getNextPacket();
+	RenderCommand_colorMask* __restrict packet = allocatePacket<RenderCommand_colorMask>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_colorMask::execute);
 	packet->red = red;
 	packet->green = green;
@@ -209,41 +209,41 @@ void colorMask(
 void depthMask(
 	GLboolean flag)
 {
-	RenderCommand_depthMask* __restrict packet = (RenderCommand_depthMask*)getNextPacket();
+	RenderCommand_depthMask* __restrict packet = allocatePacket<RenderCommand_depthMask>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthMask::execute);
 	packet->flag = flag;
 }
 void disable(
 	GLenum cap)
 {
-	RenderCommand_disable* __restrict packet = (RenderCommand_disable*)getNextPacket();
+	RenderCommand_disable* __restrict packet = allocatePacket<RenderCommand_disable>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disable::execute);
 	packet->cap = cap;
 }
 void enable(
 	GLenum cap)
 {
-	RenderCommand_enable* __restrict packet = (RenderCommand_enable*)getNextPacket();
+	RenderCommand_enable* __restrict packet = allocatePacket<RenderCommand_enable>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enable::execute);
 	packet->cap = cap;
 }
 void finish(
 	void)
 {
-	RenderCommand_finish* __restrict packet = (RenderCommand_finish*)getNextPacket();
+	RenderCommand_finish* __restrict packet = allocatePacket<RenderCommand_finish>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_finish::execute);
 }
 void flush(
 	void)
 {
-	RenderCommand_flush* __restrict packet = (RenderCommand_flush*)getNextPacket();
+	RenderCommand_flush* __restrict packet = allocatePacket<RenderCommand_flush>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_flush::execute);
 }
 void blendFunc(
 	GLenum sfactor,
 	GLenum dfactor)
 {
-	RenderCommand_blendFunc* __restrict packet = (RenderCommand_blendFunc*)getNextPacket();
+	RenderCommand_blendFunc* __restrict packet = allocatePacket<RenderCommand_blendFunc>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFunc::execute);
 	packet->sfactor = sfactor;
 	packet->dfactor = dfactor;
@@ -251,7 +251,7 @@ void blendFunc(
 void logicOp(
 	GLenum opcode)
 {
-	RenderCommand_logicOp* __restrict packet = (RenderCommand_logicOp*)getNextPacket();
+	RenderCommand_logicOp* __restrict packet = allocatePacket<RenderCommand_logicOp>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_logicOp::execute);
 	packet->opcode = opcode;
 }
@@ -260,7 +260,7 @@ void stencilFunc(
 	GLint ref,
 	GLuint mask)
 {
-	RenderCommand_stencilFunc* __restrict packet = (RenderCommand_stencilFunc*)getNextPacket();
+	RenderCommand_stencilFunc* __restrict packet = allocatePacket<RenderCommand_stencilFunc>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilFunc::execute);
 	packet->func = func;
 	packet->ref = ref;
@@ -271,7 +271,7 @@ void stencilOp(
 	GLenum zfail,
 	GLenum zpass)
 {
-	RenderCommand_stencilOp* __restrict packet = (RenderCommand_stencilOp*)getNextPacket();
+	RenderCommand_stencilOp* __restrict packet = allocatePacket<RenderCommand_stencilOp>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilOp::execute);
 	packet->fail = fail;
 	packet->zfail = zfail;
@@ -280,7 +280,7 @@ void stencilOp(
 void depthFunc(
 	GLenum func)
 {
-	RenderCommand_depthFunc* __restrict packet = (RenderCommand_depthFunc*)getNextPacket();
+	RenderCommand_depthFunc* __restrict packet = allocatePacket<RenderCommand_depthFunc>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthFunc::execute);
 	packet->func = func;
 }
@@ -288,7 +288,7 @@ void pixelStoref(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_pixelStoref* __restrict packet = (RenderCommand_pixelStoref*)getNextPacket();
+	RenderCommand_pixelStoref* __restrict packet = allocatePacket<RenderCommand_pixelStoref>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pixelStoref::execute);
 	packet->pname = pname;
 	packet->param = param;
@@ -297,7 +297,7 @@ void pixelStorei(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_pixelStorei* __restrict packet = (RenderCommand_pixelStorei*)getNextPacket();
+	RenderCommand_pixelStorei* __restrict packet = allocatePacket<RenderCommand_pixelStorei>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pixelStorei::execute);
 	packet->pname = pname;
 	packet->param = param;
@@ -305,7 +305,7 @@ void pixelStorei(
 void readBuffer(
 	GLenum src)
 {
-	RenderCommand_readBuffer* __restrict packet = (RenderCommand_readBuffer*)getNextPacket();
+	RenderCommand_readBuffer* __restrict packet = allocatePacket<RenderCommand_readBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_readBuffer::execute);
 	packet->src = src;
 }
@@ -318,7 +318,7 @@ void readPixels(
 	GLenum type,
 	void *pixels)
 {
-	RenderCommand_readPixels* __restrict packet = (RenderCommand_readPixels*)getNextPacket();
+	RenderCommand_readPixels* __restrict packet = allocatePacket<RenderCommand_readPixels>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_readPixels::execute);
 	packet->x = x;
 	packet->y = y;
@@ -332,7 +332,7 @@ void getBooleanv(
 	GLenum pname,
 	GLboolean *data)
 {
-	RenderCommand_getBooleanv* __restrict packet = (RenderCommand_getBooleanv*)getNextPacket();
+	RenderCommand_getBooleanv* __restrict packet = allocatePacket<RenderCommand_getBooleanv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBooleanv::execute);
 	packet->pname = pname;
 	packet->data = data;
@@ -341,7 +341,7 @@ void getDoublev(
 	GLenum pname,
 	GLdouble *data)
 {
-	RenderCommand_getDoublev* __restrict packet = (RenderCommand_getDoublev*)getNextPacket();
+	RenderCommand_getDoublev* __restrict packet = allocatePacket<RenderCommand_getDoublev>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDoublev::execute);
 	packet->pname = pname;
 	packet->data = data;
@@ -349,14 +349,14 @@ void getDoublev(
 GLenum getError(
 	void)
 {
-	RenderCommand_getError* __restrict packet = (RenderCommand_getError*)getNextPacket();
+	RenderCommand_getError* __restrict packet = allocatePacket<RenderCommand_getError>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getError::execute);
 }
 void getFloatv(
 	GLenum pname,
 	GLfloat *data)
 {
-	RenderCommand_getFloatv* __restrict packet = (RenderCommand_getFloatv*)getNextPacket();
+	RenderCommand_getFloatv* __restrict packet = allocatePacket<RenderCommand_getFloatv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFloatv::execute);
 	packet->pname = pname;
 	packet->data = data;
@@ -365,7 +365,7 @@ void getIntegerv(
 	GLenum pname,
 	GLint *data)
 {
-	RenderCommand_getIntegerv* __restrict packet = (RenderCommand_getIntegerv*)getNextPacket();
+	RenderCommand_getIntegerv* __restrict packet = allocatePacket<RenderCommand_getIntegerv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getIntegerv::execute);
 	packet->pname = pname;
 	packet->data = data;
@@ -373,7 +373,7 @@ void getIntegerv(
 const GLubyte* getString(
 	GLenum name)
 {
-	RenderCommand_getString* __restrict packet = (RenderCommand_getString*)getNextPacket();
+	RenderCommand_getString* __restrict packet = allocatePacket<RenderCommand_getString>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getString::execute);
 	packet->name = name;
 }
@@ -384,7 +384,7 @@ void getTexImage(
 	GLenum type,
 	void *pixels)
 {
-	RenderCommand_getTexImage* __restrict packet = (RenderCommand_getTexImage*)getNextPacket();
+	RenderCommand_getTexImage* __restrict packet = allocatePacket<RenderCommand_getTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexImage::execute);
 	packet->target = target;
 	packet->level = level;
@@ -397,7 +397,7 @@ void getTexParameterfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTexParameterfv* __restrict packet = (RenderCommand_getTexParameterfv*)getNextPacket();
+	RenderCommand_getTexParameterfv* __restrict packet = allocatePacket<RenderCommand_getTexParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexParameterfv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -408,7 +408,7 @@ void getTexParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTexParameteriv* __restrict packet = (RenderCommand_getTexParameteriv*)getNextPacket();
+	RenderCommand_getTexParameteriv* __restrict packet = allocatePacket<RenderCommand_getTexParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexParameteriv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -420,7 +420,7 @@ void getTexLevelParameterfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTexLevelParameterfv* __restrict packet = (RenderCommand_getTexLevelParameterfv*)getNextPacket();
+	RenderCommand_getTexLevelParameterfv* __restrict packet = allocatePacket<RenderCommand_getTexLevelParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexLevelParameterfv::execute);
 	packet->target = target;
 	packet->level = level;
@@ -433,7 +433,7 @@ void getTexLevelParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTexLevelParameteriv* __restrict packet = (RenderCommand_getTexLevelParameteriv*)getNextPacket();
+	RenderCommand_getTexLevelParameteriv* __restrict packet = allocatePacket<RenderCommand_getTexLevelParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexLevelParameteriv::execute);
 	packet->target = target;
 	packet->level = level;
@@ -443,7 +443,7 @@ void getTexLevelParameteriv(
 GLboolean isEnabled(
 	GLenum cap)
 {
-	RenderCommand_isEnabled* __restrict packet = (RenderCommand_isEnabled*)getNextPacket();
+	RenderCommand_isEnabled* __restrict packet = allocatePacket<RenderCommand_isEnabled>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isEnabled::execute);
 	packet->cap = cap;
 }
@@ -451,7 +451,7 @@ void depthRange(
 	GLdouble n,
 	GLdouble f)
 {
-	RenderCommand_depthRange* __restrict packet = (RenderCommand_depthRange*)getNextPacket();
+	RenderCommand_depthRange* __restrict packet = allocatePacket<RenderCommand_depthRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthRange::execute);
 	packet->n = n;
 	packet->f = f;
@@ -462,7 +462,7 @@ void viewport(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_viewport* __restrict packet = (RenderCommand_viewport*)getNextPacket();
+	RenderCommand_viewport* __restrict packet = allocatePacket<RenderCommand_viewport>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewport::execute);
 	packet->x = x;
 	packet->y = y;
@@ -474,7 +474,7 @@ void drawArrays(
 	GLint first,
 	GLsizei count)
 {
-	RenderCommand_drawArrays* __restrict packet = (RenderCommand_drawArrays*)getNextPacket();
+	RenderCommand_drawArrays* __restrict packet = allocatePacket<RenderCommand_drawArrays>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArrays::execute);
 	packet->mode = mode;
 	packet->first = first;
@@ -486,7 +486,7 @@ void drawElements(
 	GLenum type,
 	const void *indices)
 {
-	RenderCommand_drawElements* __restrict packet = (RenderCommand_drawElements*)getNextPacket();
+	RenderCommand_drawElements* __restrict packet = allocatePacket<RenderCommand_drawElements>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElements::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -497,7 +497,7 @@ void getPointerv(
 	GLenum pname,
 	void **params)
 {
-	RenderCommand_getPointerv* __restrict packet = (RenderCommand_getPointerv*)getNextPacket();
+	RenderCommand_getPointerv* __restrict packet = allocatePacket<RenderCommand_getPointerv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPointerv::execute);
 	packet->pname = pname;
 	packet->params = params;
@@ -506,7 +506,7 @@ void polygonOffset(
 	GLfloat factor,
 	GLfloat units)
 {
-	RenderCommand_polygonOffset* __restrict packet = (RenderCommand_polygonOffset*)getNextPacket();
+	RenderCommand_polygonOffset* __restrict packet = allocatePacket<RenderCommand_polygonOffset>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_polygonOffset::execute);
 	packet->factor = factor;
 	packet->units = units;
@@ -520,7 +520,7 @@ void copyTexImage1D(
 	GLsizei width,
 	GLint border)
 {
-	RenderCommand_copyTexImage1D* __restrict packet = (RenderCommand_copyTexImage1D*)getNextPacket();
+	RenderCommand_copyTexImage1D* __restrict packet = allocatePacket<RenderCommand_copyTexImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTexImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -540,7 +540,7 @@ void copyTexImage2D(
 	GLsizei height,
 	GLint border)
 {
-	RenderCommand_copyTexImage2D* __restrict packet = (RenderCommand_copyTexImage2D*)getNextPacket();
+	RenderCommand_copyTexImage2D* __restrict packet = allocatePacket<RenderCommand_copyTexImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTexImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -559,7 +559,7 @@ void copyTexSubImage1D(
 	GLint y,
 	GLsizei width)
 {
-	RenderCommand_copyTexSubImage1D* __restrict packet = (RenderCommand_copyTexSubImage1D*)getNextPacket();
+	RenderCommand_copyTexSubImage1D* __restrict packet = allocatePacket<RenderCommand_copyTexSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTexSubImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -578,7 +578,7 @@ void copyTexSubImage2D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTexSubImage2D* __restrict packet = (RenderCommand_copyTexSubImage2D*)getNextPacket();
+	RenderCommand_copyTexSubImage2D* __restrict packet = allocatePacket<RenderCommand_copyTexSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTexSubImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -598,7 +598,7 @@ void texSubImage1D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texSubImage1D* __restrict packet = (RenderCommand_texSubImage1D*)getNextPacket();
+	RenderCommand_texSubImage1D* __restrict packet = allocatePacket<RenderCommand_texSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texSubImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -619,7 +619,7 @@ void texSubImage2D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texSubImage2D* __restrict packet = (RenderCommand_texSubImage2D*)getNextPacket();
+	RenderCommand_texSubImage2D* __restrict packet = allocatePacket<RenderCommand_texSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texSubImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -635,7 +635,7 @@ void bindTexture(
 	GLenum target,
 	GLuint texture)
 {
-	RenderCommand_bindTexture* __restrict packet = (RenderCommand_bindTexture*)getNextPacket();
+	RenderCommand_bindTexture* __restrict packet = allocatePacket<RenderCommand_bindTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindTexture::execute);
 	packet->target = target;
 	packet->texture = texture;
@@ -644,7 +644,7 @@ void deleteTextures(
 	GLsizei n,
 	const GLuint *textures)
 {
-	RenderCommand_deleteTextures* __restrict packet = (RenderCommand_deleteTextures*)getNextPacket();
+	RenderCommand_deleteTextures* __restrict packet = allocatePacket<RenderCommand_deleteTextures>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteTextures::execute);
 	packet->n = n;
 	packet->textures = storeParameter(n * sizeof(GLuint), textures);
@@ -653,7 +653,7 @@ void genTextures(
 	GLsizei n,
 	GLuint *textures)
 {
-	RenderCommand_genTextures* __restrict packet = (RenderCommand_genTextures*)getNextPacket();
+	RenderCommand_genTextures* __restrict packet = allocatePacket<RenderCommand_genTextures>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genTextures::execute);
 	packet->n = n;
 	packet->textures = textures;
@@ -661,7 +661,7 @@ void genTextures(
 GLboolean isTexture(
 	GLuint texture)
 {
-	RenderCommand_isTexture* __restrict packet = (RenderCommand_isTexture*)getNextPacket();
+	RenderCommand_isTexture* __restrict packet = allocatePacket<RenderCommand_isTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isTexture::execute);
 	packet->texture = texture;
 }
@@ -673,7 +673,7 @@ void drawRangeElements(
 	GLenum type,
 	const void *indices)
 {
-	RenderCommand_drawRangeElements* __restrict packet = (RenderCommand_drawRangeElements*)getNextPacket();
+	RenderCommand_drawRangeElements* __restrict packet = allocatePacket<RenderCommand_drawRangeElements>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawRangeElements::execute);
 	packet->mode = mode;
 	packet->start = start;
@@ -694,7 +694,7 @@ void texImage3D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texImage3D* __restrict packet = (RenderCommand_texImage3D*)getNextPacket();
+	RenderCommand_texImage3D* __restrict packet = allocatePacket<RenderCommand_texImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texImage3D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -720,7 +720,7 @@ void texSubImage3D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_texSubImage3D* __restrict packet = (RenderCommand_texSubImage3D*)getNextPacket();
+	RenderCommand_texSubImage3D* __restrict packet = allocatePacket<RenderCommand_texSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texSubImage3D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -745,7 +745,7 @@ void copyTexSubImage3D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTexSubImage3D* __restrict packet = (RenderCommand_copyTexSubImage3D*)getNextPacket();
+	RenderCommand_copyTexSubImage3D* __restrict packet = allocatePacket<RenderCommand_copyTexSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTexSubImage3D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -760,7 +760,7 @@ void copyTexSubImage3D(
 void activeTexture(
 	GLenum texture)
 {
-	RenderCommand_activeTexture* __restrict packet = (RenderCommand_activeTexture*)getNextPacket();
+	RenderCommand_activeTexture* __restrict packet = allocatePacket<RenderCommand_activeTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_activeTexture::execute);
 	packet->texture = texture;
 }
@@ -768,7 +768,7 @@ void sampleCoverage(
 	GLfloat value,
 	GLboolean invert)
 {
-	RenderCommand_sampleCoverage* __restrict packet = (RenderCommand_sampleCoverage*)getNextPacket();
+	RenderCommand_sampleCoverage* __restrict packet = allocatePacket<RenderCommand_sampleCoverage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_sampleCoverage::execute);
 	packet->value = value;
 	packet->invert = invert;
@@ -784,7 +784,7 @@ void compressedTexImage3D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexImage3D* __restrict packet = (RenderCommand_compressedTexImage3D*)getNextPacket();
+	RenderCommand_compressedTexImage3D* __restrict packet = allocatePacket<RenderCommand_compressedTexImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexImage3D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -806,7 +806,7 @@ void compressedTexImage2D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexImage2D* __restrict packet = (RenderCommand_compressedTexImage2D*)getNextPacket();
+	RenderCommand_compressedTexImage2D* __restrict packet = allocatePacket<RenderCommand_compressedTexImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -826,7 +826,7 @@ void compressedTexImage1D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexImage1D* __restrict packet = (RenderCommand_compressedTexImage1D*)getNextPacket();
+	RenderCommand_compressedTexImage1D* __restrict packet = allocatePacket<RenderCommand_compressedTexImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -849,7 +849,7 @@ void compressedTexSubImage3D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexSubImage3D* __restrict packet = (RenderCommand_compressedTexSubImage3D*)getNextPacket();
+	RenderCommand_compressedTexSubImage3D* __restrict packet = allocatePacket<RenderCommand_compressedTexSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexSubImage3D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -874,7 +874,7 @@ void compressedTexSubImage2D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexSubImage2D* __restrict packet = (RenderCommand_compressedTexSubImage2D*)getNextPacket();
+	RenderCommand_compressedTexSubImage2D* __restrict packet = allocatePacket<RenderCommand_compressedTexSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexSubImage2D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -895,7 +895,7 @@ void compressedTexSubImage1D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTexSubImage1D* __restrict packet = (RenderCommand_compressedTexSubImage1D*)getNextPacket();
+	RenderCommand_compressedTexSubImage1D* __restrict packet = allocatePacket<RenderCommand_compressedTexSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTexSubImage1D::execute);
 	packet->target = target;
 	packet->level = level;
@@ -910,7 +910,7 @@ void getCompressedTexImage(
 	GLint level,
 	void *img)
 {
-	RenderCommand_getCompressedTexImage* __restrict packet = (RenderCommand_getCompressedTexImage*)getNextPacket();
+	RenderCommand_getCompressedTexImage* __restrict packet = allocatePacket<RenderCommand_getCompressedTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCompressedTexImage::execute);
 	packet->target = target;
 	packet->level = level;
@@ -922,7 +922,7 @@ void blendFuncSeparate(
 	GLenum sfactorAlpha,
 	GLenum dfactorAlpha)
 {
-	RenderCommand_blendFuncSeparate* __restrict packet = (RenderCommand_blendFuncSeparate*)getNextPacket();
+	RenderCommand_blendFuncSeparate* __restrict packet = allocatePacket<RenderCommand_blendFuncSeparate>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFuncSeparate::execute);
 	packet->sfactorRGB = sfactorRGB;
 	packet->dfactorRGB = dfactorRGB;
@@ -935,7 +935,7 @@ void multiDrawArrays(
 	const GLsizei *count,
 	GLsizei drawcount)
 {
-	RenderCommand_multiDrawArrays* __restrict packet = (RenderCommand_multiDrawArrays*)getNextPacket();
+	RenderCommand_multiDrawArrays* __restrict packet = allocatePacket<RenderCommand_multiDrawArrays>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArrays::execute);
 	packet->mode = mode;
 	packet->first = first;
@@ -949,7 +949,7 @@ void multiDrawElements(
 	const void *const*indices,
 	GLsizei drawcount)
 {
-	RenderCommand_multiDrawElements* __restrict packet = (RenderCommand_multiDrawElements*)getNextPacket();
+	RenderCommand_multiDrawElements* __restrict packet = allocatePacket<RenderCommand_multiDrawElements>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElements::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -961,7 +961,7 @@ void pointParameterf(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_pointParameterf* __restrict packet = (RenderCommand_pointParameterf*)getNextPacket();
+	RenderCommand_pointParameterf* __restrict packet = allocatePacket<RenderCommand_pointParameterf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointParameterf::execute);
 	packet->pname = pname;
 	packet->param = param;
@@ -970,7 +970,7 @@ void pointParameterfv(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_pointParameterfv* __restrict packet = (RenderCommand_pointParameterfv*)getNextPacket();
+	RenderCommand_pointParameterfv* __restrict packet = allocatePacket<RenderCommand_pointParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointParameterfv::execute);
 	packet->pname = pname;
 	packet->params = params;
@@ -979,7 +979,7 @@ void pointParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_pointParameteri* __restrict packet = (RenderCommand_pointParameteri*)getNextPacket();
+	RenderCommand_pointParameteri* __restrict packet = allocatePacket<RenderCommand_pointParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointParameteri::execute);
 	packet->pname = pname;
 	packet->param = param;
@@ -988,7 +988,7 @@ void pointParameteriv(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_pointParameteriv* __restrict packet = (RenderCommand_pointParameteriv*)getNextPacket();
+	RenderCommand_pointParameteriv* __restrict packet = allocatePacket<RenderCommand_pointParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointParameteriv::execute);
 	packet->pname = pname;
 	packet->params = params;
@@ -999,7 +999,7 @@ void blendColor(
 	GLfloat blue,
 	GLfloat alpha)
 {
-	RenderCommand_blendColor* __restrict packet = (RenderCommand_blendColor*)getNextPacket();
+	RenderCommand_blendColor* __restrict packet = allocatePacket<RenderCommand_blendColor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendColor::execute);
 	packet->red = red;
 	packet->green = green;
@@ -1009,7 +1009,7 @@ void blendColor(
 void blendEquation(
 	GLenum mode)
 {
-	RenderCommand_blendEquation* __restrict packet = (RenderCommand_blendEquation*)getNextPacket();
+	RenderCommand_blendEquation* __restrict packet = allocatePacket<RenderCommand_blendEquation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquation::execute);
 	packet->mode = mode;
 }
@@ -1017,7 +1017,7 @@ void genQueries(
 	GLsizei n,
 	GLuint *ids)
 {
-	RenderCommand_genQueries* __restrict packet = (RenderCommand_genQueries*)getNextPacket();
+	RenderCommand_genQueries* __restrict packet = allocatePacket<RenderCommand_genQueries>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genQueries::execute);
 	packet->n = n;
 	packet->ids = ids;
@@ -1026,7 +1026,7 @@ void deleteQueries(
 	GLsizei n,
 	const GLuint *ids)
 {
-	RenderCommand_deleteQueries* __restrict packet = (RenderCommand_deleteQueries*)getNextPacket();
+	RenderCommand_deleteQueries* __restrict packet = allocatePacket<RenderCommand_deleteQueries>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteQueries::execute);
 	packet->n = n;
 	packet->ids = ids;
@@ -1034,7 +1034,7 @@ void deleteQueries(
 GLboolean isQuery(
 	GLuint id)
 {
-	RenderCommand_isQuery* __restrict packet = (RenderCommand_isQuery*)getNextPacket();
+	RenderCommand_isQuery* __restrict packet = allocatePacket<RenderCommand_isQuery>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isQuery::execute);
 	packet->id = id;
 }
@@ -1042,7 +1042,7 @@ void beginQuery(
 	GLenum target,
 	GLuint id)
 {
-	RenderCommand_beginQuery* __restrict packet = (RenderCommand_beginQuery*)getNextPacket();
+	RenderCommand_beginQuery* __restrict packet = allocatePacket<RenderCommand_beginQuery>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginQuery::execute);
 	packet->target = target;
 	packet->id = id;
@@ -1050,7 +1050,7 @@ void beginQuery(
 void endQuery(
 	GLenum target)
 {
-	RenderCommand_endQuery* __restrict packet = (RenderCommand_endQuery*)getNextPacket();
+	RenderCommand_endQuery* __restrict packet = allocatePacket<RenderCommand_endQuery>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endQuery::execute);
 	packet->target = target;
 }
@@ -1059,7 +1059,7 @@ void getQueryiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getQueryiv* __restrict packet = (RenderCommand_getQueryiv*)getNextPacket();
+	RenderCommand_getQueryiv* __restrict packet = allocatePacket<RenderCommand_getQueryiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryiv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -1070,7 +1070,7 @@ void getQueryObjectiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getQueryObjectiv* __restrict packet = (RenderCommand_getQueryObjectiv*)getNextPacket();
+	RenderCommand_getQueryObjectiv* __restrict packet = allocatePacket<RenderCommand_getQueryObjectiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryObjectiv::execute);
 	packet->id = id;
 	packet->pname = pname;
@@ -1081,7 +1081,7 @@ void getQueryObjectuiv(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getQueryObjectuiv* __restrict packet = (RenderCommand_getQueryObjectuiv*)getNextPacket();
+	RenderCommand_getQueryObjectuiv* __restrict packet = allocatePacket<RenderCommand_getQueryObjectuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryObjectuiv::execute);
 	packet->id = id;
 	packet->pname = pname;
@@ -1091,7 +1091,7 @@ void bindBuffer(
 	GLenum target,
 	GLuint buffer)
 {
-	RenderCommand_bindBuffer* __restrict packet = (RenderCommand_bindBuffer*)getNextPacket();
+	RenderCommand_bindBuffer* __restrict packet = allocatePacket<RenderCommand_bindBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindBuffer::execute);
 	packet->target = target;
 	packet->buffer = buffer;
@@ -1100,7 +1100,7 @@ void deleteBuffers(
 	GLsizei n,
 	const GLuint *buffers)
 {
-	RenderCommand_deleteBuffers* __restrict packet = (RenderCommand_deleteBuffers*)getNextPacket();
+	RenderCommand_deleteBuffers* __restrict packet = allocatePacket<RenderCommand_deleteBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteBuffers::execute);
 	packet->n = n;
 	packet->buffers = buffers;
@@ -1109,7 +1109,7 @@ void genBuffers(
 	GLsizei n,
 	GLuint *buffers)
 {
-	RenderCommand_genBuffers* __restrict packet = (RenderCommand_genBuffers*)getNextPacket();
+	RenderCommand_genBuffers* __restrict packet = allocatePacket<RenderCommand_genBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genBuffers::execute);
 	packet->n = n;
 	packet->buffers = buffers;
@@ -1117,7 +1117,7 @@ void genBuffers(
 GLboolean isBuffer(
 	GLuint buffer)
 {
-	RenderCommand_isBuffer* __restrict packet = (RenderCommand_isBuffer*)getNextPacket();
+	RenderCommand_isBuffer* __restrict packet = allocatePacket<RenderCommand_isBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isBuffer::execute);
 	packet->buffer = buffer;
 }
@@ -1127,7 +1127,7 @@ void bufferData(
 	const void *data,
 	GLenum usage)
 {
-	RenderCommand_bufferData* __restrict packet = (RenderCommand_bufferData*)getNextPacket();
+	RenderCommand_bufferData* __restrict packet = allocatePacket<RenderCommand_bufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferData::execute);
 	packet->target = target;
 	packet->size = size;
@@ -1140,7 +1140,7 @@ void bufferSubData(
 	GLsizeiptr size,
 	const void *data)
 {
-	RenderCommand_bufferSubData* __restrict packet = (RenderCommand_bufferSubData*)getNextPacket();
+	RenderCommand_bufferSubData* __restrict packet = allocatePacket<RenderCommand_bufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferSubData::execute);
 	packet->target = target;
 	packet->offset = offset;
@@ -1153,7 +1153,7 @@ void getBufferSubData(
 	GLsizeiptr size,
 	void *data)
 {
-	RenderCommand_getBufferSubData* __restrict packet = (RenderCommand_getBufferSubData*)getNextPacket();
+	RenderCommand_getBufferSubData* __restrict packet = allocatePacket<RenderCommand_getBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBufferSubData::execute);
 	packet->target = target;
 	packet->offset = offset;
@@ -1164,7 +1164,7 @@ void* mapBuffer(
 	GLenum target,
 	GLenum access)
 {
-	RenderCommand_mapBuffer* __restrict packet = (RenderCommand_mapBuffer*)getNextPacket();
+	RenderCommand_mapBuffer* __restrict packet = allocatePacket<RenderCommand_mapBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapBuffer::execute);
 	packet->target = target;
 	packet->access = access;
@@ -1172,7 +1172,7 @@ void* mapBuffer(
 GLboolean unmapBuffer(
 	GLenum target)
 {
-	RenderCommand_unmapBuffer* __restrict packet = (RenderCommand_unmapBuffer*)getNextPacket();
+	RenderCommand_unmapBuffer* __restrict packet = allocatePacket<RenderCommand_unmapBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_unmapBuffer::execute);
 	packet->target = target;
 }
@@ -1181,7 +1181,7 @@ void getBufferParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getBufferParameteriv* __restrict packet = (RenderCommand_getBufferParameteriv*)getNextPacket();
+	RenderCommand_getBufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getBufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBufferParameteriv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -1192,7 +1192,7 @@ void getBufferPointerv(
 	GLenum pname,
 	void **params)
 {
-	RenderCommand_getBufferPointerv* __restrict packet = (RenderCommand_getBufferPointerv*)getNextPacket();
+	RenderCommand_getBufferPointerv* __restrict packet = allocatePacket<RenderCommand_getBufferPointerv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBufferPointerv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -1202,7 +1202,7 @@ void blendEquationSeparate(
 	GLenum modeRGB,
 	GLenum modeAlpha)
 {
-	RenderCommand_blendEquationSeparate* __restrict packet = (RenderCommand_blendEquationSeparate*)getNextPacket();
+	RenderCommand_blendEquationSeparate* __restrict packet = allocatePacket<RenderCommand_blendEquationSeparate>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquationSeparate::execute);
 	packet->modeRGB = modeRGB;
 	packet->modeAlpha = modeAlpha;
@@ -1211,7 +1211,7 @@ void drawBuffers(
 	GLsizei n,
 	const GLenum *bufs)
 {
-	RenderCommand_drawBuffers* __restrict packet = (RenderCommand_drawBuffers*)getNextPacket();
+	RenderCommand_drawBuffers* __restrict packet = allocatePacket<RenderCommand_drawBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawBuffers::execute);
 	packet->n = n;
 	packet->bufs = bufs;
@@ -1222,7 +1222,7 @@ void stencilOpSeparate(
 	GLenum dpfail,
 	GLenum dppass)
 {
-	RenderCommand_stencilOpSeparate* __restrict packet = (RenderCommand_stencilOpSeparate*)getNextPacket();
+	RenderCommand_stencilOpSeparate* __restrict packet = allocatePacket<RenderCommand_stencilOpSeparate>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilOpSeparate::execute);
 	packet->face = face;
 	packet->sfail = sfail;
@@ -1235,7 +1235,7 @@ void stencilFuncSeparate(
 	GLint ref,
 	GLuint mask)
 {
-	RenderCommand_stencilFuncSeparate* __restrict packet = (RenderCommand_stencilFuncSeparate*)getNextPacket();
+	RenderCommand_stencilFuncSeparate* __restrict packet = allocatePacket<RenderCommand_stencilFuncSeparate>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilFuncSeparate::execute);
 	packet->face = face;
 	packet->func = func;
@@ -1246,7 +1246,7 @@ void stencilMaskSeparate(
 	GLenum face,
 	GLuint mask)
 {
-	RenderCommand_stencilMaskSeparate* __restrict packet = (RenderCommand_stencilMaskSeparate*)getNextPacket();
+	RenderCommand_stencilMaskSeparate* __restrict packet = allocatePacket<RenderCommand_stencilMaskSeparate>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilMaskSeparate::execute);
 	packet->face = face;
 	packet->mask = mask;
@@ -1255,7 +1255,7 @@ void attachShader(
 	GLuint program,
 	GLuint shader)
 {
-	RenderCommand_attachShader* __restrict packet = (RenderCommand_attachShader*)getNextPacket();
+	RenderCommand_attachShader* __restrict packet = allocatePacket<RenderCommand_attachShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_attachShader::execute);
 	packet->program = program;
 	packet->shader = shader;
@@ -1265,7 +1265,7 @@ void bindAttribLocation(
 	GLuint index,
 	const GLchar *name)
 {
-	RenderCommand_bindAttribLocation* __restrict packet = (RenderCommand_bindAttribLocation*)getNextPacket();
+	RenderCommand_bindAttribLocation* __restrict packet = allocatePacket<RenderCommand_bindAttribLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindAttribLocation::execute);
 	packet->program = program;
 	packet->index = index;
@@ -1274,34 +1274,34 @@ void bindAttribLocation(
 void compileShader(
 	GLuint shader)
 {
-	RenderCommand_compileShader* __restrict packet = (RenderCommand_compileShader*)getNextPacket();
+	RenderCommand_compileShader* __restrict packet = allocatePacket<RenderCommand_compileShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compileShader::execute);
 	packet->shader = shader;
 }
 GLuint createProgram(
 	void)
 {
-	RenderCommand_createProgram* __restrict packet = (RenderCommand_createProgram*)getNextPacket();
+	RenderCommand_createProgram* __restrict packet = allocatePacket<RenderCommand_createProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createProgram::execute);
 }
 GLuint createShader(
 	GLenum type)
 {
-	RenderCommand_createShader* __restrict packet = (RenderCommand_createShader*)getNextPacket();
+	RenderCommand_createShader* __restrict packet = allocatePacket<RenderCommand_createShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createShader::execute);
 	packet->type = type;
 }
 void deleteProgram(
 	GLuint program)
 {
-	RenderCommand_deleteProgram* __restrict packet = (RenderCommand_deleteProgram*)getNextPacket();
+	RenderCommand_deleteProgram* __restrict packet = allocatePacket<RenderCommand_deleteProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteProgram::execute);
 	packet->program = program;
 }
 void deleteShader(
 	GLuint shader)
 {
-	RenderCommand_deleteShader* __restrict packet = (RenderCommand_deleteShader*)getNextPacket();
+	RenderCommand_deleteShader* __restrict packet = allocatePacket<RenderCommand_deleteShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteShader::execute);
 	packet->shader = shader;
 }
@@ -1309,7 +1309,7 @@ void detachShader(
 	GLuint program,
 	GLuint shader)
 {
-	RenderCommand_detachShader* __restrict packet = (RenderCommand_detachShader*)getNextPacket();
+	RenderCommand_detachShader* __restrict packet = allocatePacket<RenderCommand_detachShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_detachShader::execute);
 	packet->program = program;
 	packet->shader = shader;
@@ -1317,14 +1317,14 @@ void detachShader(
 void disableVertexAttribArray(
 	GLuint index)
 {
-	RenderCommand_disableVertexAttribArray* __restrict packet = (RenderCommand_disableVertexAttribArray*)getNextPacket();
+	RenderCommand_disableVertexAttribArray* __restrict packet = allocatePacket<RenderCommand_disableVertexAttribArray>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableVertexAttribArray::execute);
 	packet->index = index;
 }
 void enableVertexAttribArray(
 	GLuint index)
 {
-	RenderCommand_enableVertexAttribArray* __restrict packet = (RenderCommand_enableVertexAttribArray*)getNextPacket();
+	RenderCommand_enableVertexAttribArray* __restrict packet = allocatePacket<RenderCommand_enableVertexAttribArray>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableVertexAttribArray::execute);
 	packet->index = index;
 }
@@ -1337,7 +1337,7 @@ void getActiveAttrib(
 	GLenum *type,
 	GLchar *name)
 {
-	RenderCommand_getActiveAttrib* __restrict packet = (RenderCommand_getActiveAttrib*)getNextPacket();
+	RenderCommand_getActiveAttrib* __restrict packet = allocatePacket<RenderCommand_getActiveAttrib>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveAttrib::execute);
 	packet->program = program;
 	packet->index = index;
@@ -1356,7 +1356,7 @@ void getActiveUniform(
 	GLenum *type,
 	GLchar *name)
 {
-	RenderCommand_getActiveUniform* __restrict packet = (RenderCommand_getActiveUniform*)getNextPacket();
+	RenderCommand_getActiveUniform* __restrict packet = allocatePacket<RenderCommand_getActiveUniform>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveUniform::execute);
 	packet->program = program;
 	packet->index = index;
@@ -1372,7 +1372,7 @@ void getAttachedShaders(
 	GLsizei *count,
 	GLuint *shaders)
 {
-	RenderCommand_getAttachedShaders* __restrict packet = (RenderCommand_getAttachedShaders*)getNextPacket();
+	RenderCommand_getAttachedShaders* __restrict packet = allocatePacket<RenderCommand_getAttachedShaders>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getAttachedShaders::execute);
 	packet->program = program;
 	packet->maxCount = maxCount;
@@ -1383,7 +1383,7 @@ GLint getAttribLocation(
 	GLuint program,
 	const GLchar *name)
 {
-	RenderCommand_getAttribLocation* __restrict packet = (RenderCommand_getAttribLocation*)getNextPacket();
+	RenderCommand_getAttribLocation* __restrict packet = allocatePacket<RenderCommand_getAttribLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getAttribLocation::execute);
 	packet->program = program;
 	packet->name = name;
@@ -1393,7 +1393,7 @@ void getProgramiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getProgramiv* __restrict packet = (RenderCommand_getProgramiv*)getNextPacket();
+	RenderCommand_getProgramiv* __restrict packet = allocatePacket<RenderCommand_getProgramiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramiv::execute);
 	packet->program = program;
 	packet->pname = pname;
@@ -1405,7 +1405,7 @@ void getProgramInfoLog(
 	GLsizei *length,
 	GLchar *infoLog)
 {
-	RenderCommand_getProgramInfoLog* __restrict packet = (RenderCommand_getProgramInfoLog*)getNextPacket();
+	RenderCommand_getProgramInfoLog* __restrict packet = allocatePacket<RenderCommand_getProgramInfoLog>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramInfoLog::execute);
 	packet->program = program;
 	packet->bufSize = bufSize;
@@ -1417,7 +1417,7 @@ void getShaderiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getShaderiv* __restrict packet = (RenderCommand_getShaderiv*)getNextPacket();
+	RenderCommand_getShaderiv* __restrict packet = allocatePacket<RenderCommand_getShaderiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShaderiv::execute);
 	packet->shader = shader;
 	packet->pname = pname;
@@ -1429,7 +1429,7 @@ void getShaderInfoLog(
 	GLsizei *length,
 	GLchar *infoLog)
 {
-	RenderCommand_getShaderInfoLog* __restrict packet = (RenderCommand_getShaderInfoLog*)getNextPacket();
+	RenderCommand_getShaderInfoLog* __restrict packet = allocatePacket<RenderCommand_getShaderInfoLog>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShaderInfoLog::execute);
 	packet->shader = shader;
 	packet->bufSize = bufSize;
@@ -1442,7 +1442,7 @@ void getShaderSource(
 	GLsizei *length,
 	GLchar *source)
 {
-	RenderCommand_getShaderSource* __restrict packet = (RenderCommand_getShaderSource*)getNextPacket();
+	RenderCommand_getShaderSource* __restrict packet = allocatePacket<RenderCommand_getShaderSource>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShaderSource::execute);
 	packet->shader = shader;
 	packet->bufSize = bufSize;
@@ -1455,7 +1455,7 @@ GLint getUniformLocation(
 {
 	CHECKF(0, "This is auto-generated but ill-formed API. Don't use!!!");
 
-	RenderCommand_getUniformLocation* __restrict packet = (RenderCommand_getUniformLocation*)getNextPacket();
+	RenderCommand_getUniformLocation* __restrict packet = allocatePacket<RenderCommand_getUniformLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformLocation::execute);
 	packet->program = program;
 	packet->name = name;
@@ -1465,7 +1465,7 @@ void getUniformfv(
 	GLint location,
 	GLfloat *params)
 {
-	RenderCommand_getUniformfv* __restrict packet = (RenderCommand_getUniformfv*)getNextPacket();
+	RenderCommand_getUniformfv* __restrict packet = allocatePacket<RenderCommand_getUniformfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformfv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -1476,7 +1476,7 @@ void getUniformiv(
 	GLint location,
 	GLint *params)
 {
-	RenderCommand_getUniformiv* __restrict packet = (RenderCommand_getUniformiv*)getNextPacket();
+	RenderCommand_getUniformiv* __restrict packet = allocatePacket<RenderCommand_getUniformiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -1487,7 +1487,7 @@ void getVertexAttribdv(
 	GLenum pname,
 	GLdouble *params)
 {
-	RenderCommand_getVertexAttribdv* __restrict packet = (RenderCommand_getVertexAttribdv*)getNextPacket();
+	RenderCommand_getVertexAttribdv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribdv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribdv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -1498,7 +1498,7 @@ void getVertexAttribfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getVertexAttribfv* __restrict packet = (RenderCommand_getVertexAttribfv*)getNextPacket();
+	RenderCommand_getVertexAttribfv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribfv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -1509,7 +1509,7 @@ void getVertexAttribiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getVertexAttribiv* __restrict packet = (RenderCommand_getVertexAttribiv*)getNextPacket();
+	RenderCommand_getVertexAttribiv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribiv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -1520,7 +1520,7 @@ void getVertexAttribPointerv(
 	GLenum pname,
 	void **pointer)
 {
-	RenderCommand_getVertexAttribPointerv* __restrict packet = (RenderCommand_getVertexAttribPointerv*)getNextPacket();
+	RenderCommand_getVertexAttribPointerv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribPointerv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribPointerv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -1529,21 +1529,21 @@ void getVertexAttribPointerv(
 GLboolean isProgram(
 	GLuint program)
 {
-	RenderCommand_isProgram* __restrict packet = (RenderCommand_isProgram*)getNextPacket();
+	RenderCommand_isProgram* __restrict packet = allocatePacket<RenderCommand_isProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isProgram::execute);
 	packet->program = program;
 }
 GLboolean isShader(
 	GLuint shader)
 {
-	RenderCommand_isShader* __restrict packet = (RenderCommand_isShader*)getNextPacket();
+	RenderCommand_isShader* __restrict packet = allocatePacket<RenderCommand_isShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isShader::execute);
 	packet->shader = shader;
 }
 void linkProgram(
 	GLuint program)
 {
-	RenderCommand_linkProgram* __restrict packet = (RenderCommand_linkProgram*)getNextPacket();
+	RenderCommand_linkProgram* __restrict packet = allocatePacket<RenderCommand_linkProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_linkProgram::execute);
 	packet->program = program;
 }
@@ -1553,7 +1553,7 @@ void shaderSource(
 	const GLchar *const*string,
 	const GLint *length)
 {
-	RenderCommand_shaderSource* __restrict packet = (RenderCommand_shaderSource*)getNextPacket();
+	RenderCommand_shaderSource* __restrict packet = allocatePacket<RenderCommand_shaderSource>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shaderSource::execute);
 	packet->shader = shader;
 	packet->count = count;
@@ -1563,7 +1563,7 @@ void shaderSource(
 void useProgram(
 	GLuint program)
 {
-	RenderCommand_useProgram* __restrict packet = (RenderCommand_useProgram*)getNextPacket();
+	RenderCommand_useProgram* __restrict packet = allocatePacket<RenderCommand_useProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_useProgram::execute);
 	packet->program = program;
 }
@@ -1571,7 +1571,7 @@ void uniform1f(
 	GLint location,
 	GLfloat v0)
 {
-	RenderCommand_uniform1f* __restrict packet = (RenderCommand_uniform1f*)getNextPacket();
+	RenderCommand_uniform1f* __restrict packet = allocatePacket<RenderCommand_uniform1f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1f::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1581,7 +1581,7 @@ void uniform2f(
 	GLfloat v0,
 	GLfloat v1)
 {
-	RenderCommand_uniform2f* __restrict packet = (RenderCommand_uniform2f*)getNextPacket();
+	RenderCommand_uniform2f* __restrict packet = allocatePacket<RenderCommand_uniform2f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2f::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1593,7 +1593,7 @@ void uniform3f(
 	GLfloat v1,
 	GLfloat v2)
 {
-	RenderCommand_uniform3f* __restrict packet = (RenderCommand_uniform3f*)getNextPacket();
+	RenderCommand_uniform3f* __restrict packet = allocatePacket<RenderCommand_uniform3f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3f::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1607,7 +1607,7 @@ void uniform4f(
 	GLfloat v2,
 	GLfloat v3)
 {
-	RenderCommand_uniform4f* __restrict packet = (RenderCommand_uniform4f*)getNextPacket();
+	RenderCommand_uniform4f* __restrict packet = allocatePacket<RenderCommand_uniform4f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4f::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1619,7 +1619,7 @@ void uniform1i(
 	GLint location,
 	GLint v0)
 {
-	RenderCommand_uniform1i* __restrict packet = (RenderCommand_uniform1i*)getNextPacket();
+	RenderCommand_uniform1i* __restrict packet = allocatePacket<RenderCommand_uniform1i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1i::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1629,7 +1629,7 @@ void uniform2i(
 	GLint v0,
 	GLint v1)
 {
-	RenderCommand_uniform2i* __restrict packet = (RenderCommand_uniform2i*)getNextPacket();
+	RenderCommand_uniform2i* __restrict packet = allocatePacket<RenderCommand_uniform2i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2i::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1641,7 +1641,7 @@ void uniform3i(
 	GLint v1,
 	GLint v2)
 {
-	RenderCommand_uniform3i* __restrict packet = (RenderCommand_uniform3i*)getNextPacket();
+	RenderCommand_uniform3i* __restrict packet = allocatePacket<RenderCommand_uniform3i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3i::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1655,7 +1655,7 @@ void uniform4i(
 	GLint v2,
 	GLint v3)
 {
-	RenderCommand_uniform4i* __restrict packet = (RenderCommand_uniform4i*)getNextPacket();
+	RenderCommand_uniform4i* __restrict packet = allocatePacket<RenderCommand_uniform4i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4i::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -1668,7 +1668,7 @@ void uniform1fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_uniform1fv* __restrict packet = (RenderCommand_uniform1fv*)getNextPacket();
+	RenderCommand_uniform1fv* __restrict packet = allocatePacket<RenderCommand_uniform1fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1679,7 +1679,7 @@ void uniform2fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_uniform2fv* __restrict packet = (RenderCommand_uniform2fv*)getNextPacket();
+	RenderCommand_uniform2fv* __restrict packet = allocatePacket<RenderCommand_uniform2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1690,7 +1690,7 @@ void uniform3fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_uniform3fv* __restrict packet = (RenderCommand_uniform3fv*)getNextPacket();
+	RenderCommand_uniform3fv* __restrict packet = allocatePacket<RenderCommand_uniform3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1701,7 +1701,7 @@ void uniform4fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_uniform4fv* __restrict packet = (RenderCommand_uniform4fv*)getNextPacket();
+	RenderCommand_uniform4fv* __restrict packet = allocatePacket<RenderCommand_uniform4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1712,7 +1712,7 @@ void uniform1iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_uniform1iv* __restrict packet = (RenderCommand_uniform1iv*)getNextPacket();
+	RenderCommand_uniform1iv* __restrict packet = allocatePacket<RenderCommand_uniform1iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1iv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1723,7 +1723,7 @@ void uniform2iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_uniform2iv* __restrict packet = (RenderCommand_uniform2iv*)getNextPacket();
+	RenderCommand_uniform2iv* __restrict packet = allocatePacket<RenderCommand_uniform2iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2iv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1734,7 +1734,7 @@ void uniform3iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_uniform3iv* __restrict packet = (RenderCommand_uniform3iv*)getNextPacket();
+	RenderCommand_uniform3iv* __restrict packet = allocatePacket<RenderCommand_uniform3iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3iv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1745,7 +1745,7 @@ void uniform4iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_uniform4iv* __restrict packet = (RenderCommand_uniform4iv*)getNextPacket();
+	RenderCommand_uniform4iv* __restrict packet = allocatePacket<RenderCommand_uniform4iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4iv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1757,7 +1757,7 @@ void uniformMatrix2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix2fv* __restrict packet = (RenderCommand_uniformMatrix2fv*)getNextPacket();
+	RenderCommand_uniformMatrix2fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1770,7 +1770,7 @@ void uniformMatrix3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix3fv* __restrict packet = (RenderCommand_uniformMatrix3fv*)getNextPacket();
+	RenderCommand_uniformMatrix3fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1783,7 +1783,7 @@ void uniformMatrix4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix4fv* __restrict packet = (RenderCommand_uniformMatrix4fv*)getNextPacket();
+	RenderCommand_uniformMatrix4fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -1793,7 +1793,7 @@ void uniformMatrix4fv(
 void validateProgram(
 	GLuint program)
 {
-	RenderCommand_validateProgram* __restrict packet = (RenderCommand_validateProgram*)getNextPacket();
+	RenderCommand_validateProgram* __restrict packet = allocatePacket<RenderCommand_validateProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_validateProgram::execute);
 	packet->program = program;
 }
@@ -1801,7 +1801,7 @@ void vertexAttrib1d(
 	GLuint index,
 	GLdouble x)
 {
-	RenderCommand_vertexAttrib1d* __restrict packet = (RenderCommand_vertexAttrib1d*)getNextPacket();
+	RenderCommand_vertexAttrib1d* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1810,7 +1810,7 @@ void vertexAttrib1dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttrib1dv* __restrict packet = (RenderCommand_vertexAttrib1dv*)getNextPacket();
+	RenderCommand_vertexAttrib1dv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1819,7 +1819,7 @@ void vertexAttrib1f(
 	GLuint index,
 	GLfloat x)
 {
-	RenderCommand_vertexAttrib1f* __restrict packet = (RenderCommand_vertexAttrib1f*)getNextPacket();
+	RenderCommand_vertexAttrib1f* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1f::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1828,7 +1828,7 @@ void vertexAttrib1fv(
 	GLuint index,
 	const GLfloat *v)
 {
-	RenderCommand_vertexAttrib1fv* __restrict packet = (RenderCommand_vertexAttrib1fv*)getNextPacket();
+	RenderCommand_vertexAttrib1fv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1fv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1837,7 +1837,7 @@ void vertexAttrib1s(
 	GLuint index,
 	GLshort x)
 {
-	RenderCommand_vertexAttrib1s* __restrict packet = (RenderCommand_vertexAttrib1s*)getNextPacket();
+	RenderCommand_vertexAttrib1s* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1s>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1s::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1846,7 +1846,7 @@ void vertexAttrib1sv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttrib1sv* __restrict packet = (RenderCommand_vertexAttrib1sv*)getNextPacket();
+	RenderCommand_vertexAttrib1sv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib1sv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib1sv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1856,7 +1856,7 @@ void vertexAttrib2d(
 	GLdouble x,
 	GLdouble y)
 {
-	RenderCommand_vertexAttrib2d* __restrict packet = (RenderCommand_vertexAttrib2d*)getNextPacket();
+	RenderCommand_vertexAttrib2d* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1866,7 +1866,7 @@ void vertexAttrib2dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttrib2dv* __restrict packet = (RenderCommand_vertexAttrib2dv*)getNextPacket();
+	RenderCommand_vertexAttrib2dv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1876,7 +1876,7 @@ void vertexAttrib2f(
 	GLfloat x,
 	GLfloat y)
 {
-	RenderCommand_vertexAttrib2f* __restrict packet = (RenderCommand_vertexAttrib2f*)getNextPacket();
+	RenderCommand_vertexAttrib2f* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2f::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1886,7 +1886,7 @@ void vertexAttrib2fv(
 	GLuint index,
 	const GLfloat *v)
 {
-	RenderCommand_vertexAttrib2fv* __restrict packet = (RenderCommand_vertexAttrib2fv*)getNextPacket();
+	RenderCommand_vertexAttrib2fv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2fv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1896,7 +1896,7 @@ void vertexAttrib2s(
 	GLshort x,
 	GLshort y)
 {
-	RenderCommand_vertexAttrib2s* __restrict packet = (RenderCommand_vertexAttrib2s*)getNextPacket();
+	RenderCommand_vertexAttrib2s* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2s>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2s::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1906,7 +1906,7 @@ void vertexAttrib2sv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttrib2sv* __restrict packet = (RenderCommand_vertexAttrib2sv*)getNextPacket();
+	RenderCommand_vertexAttrib2sv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib2sv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib2sv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1917,7 +1917,7 @@ void vertexAttrib3d(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_vertexAttrib3d* __restrict packet = (RenderCommand_vertexAttrib3d*)getNextPacket();
+	RenderCommand_vertexAttrib3d* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1928,7 +1928,7 @@ void vertexAttrib3dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttrib3dv* __restrict packet = (RenderCommand_vertexAttrib3dv*)getNextPacket();
+	RenderCommand_vertexAttrib3dv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1939,7 +1939,7 @@ void vertexAttrib3f(
 	GLfloat y,
 	GLfloat z)
 {
-	RenderCommand_vertexAttrib3f* __restrict packet = (RenderCommand_vertexAttrib3f*)getNextPacket();
+	RenderCommand_vertexAttrib3f* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3f::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1950,7 +1950,7 @@ void vertexAttrib3fv(
 	GLuint index,
 	const GLfloat *v)
 {
-	RenderCommand_vertexAttrib3fv* __restrict packet = (RenderCommand_vertexAttrib3fv*)getNextPacket();
+	RenderCommand_vertexAttrib3fv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3fv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1961,7 +1961,7 @@ void vertexAttrib3s(
 	GLshort y,
 	GLshort z)
 {
-	RenderCommand_vertexAttrib3s* __restrict packet = (RenderCommand_vertexAttrib3s*)getNextPacket();
+	RenderCommand_vertexAttrib3s* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3s>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3s::execute);
 	packet->index = index;
 	packet->x = x;
@@ -1972,7 +1972,7 @@ void vertexAttrib3sv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttrib3sv* __restrict packet = (RenderCommand_vertexAttrib3sv*)getNextPacket();
+	RenderCommand_vertexAttrib3sv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib3sv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib3sv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1981,7 +1981,7 @@ void vertexAttrib4Nbv(
 	GLuint index,
 	const GLbyte *v)
 {
-	RenderCommand_vertexAttrib4Nbv* __restrict packet = (RenderCommand_vertexAttrib4Nbv*)getNextPacket();
+	RenderCommand_vertexAttrib4Nbv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nbv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nbv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1990,7 +1990,7 @@ void vertexAttrib4Niv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttrib4Niv* __restrict packet = (RenderCommand_vertexAttrib4Niv*)getNextPacket();
+	RenderCommand_vertexAttrib4Niv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Niv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Niv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -1999,7 +1999,7 @@ void vertexAttrib4Nsv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttrib4Nsv* __restrict packet = (RenderCommand_vertexAttrib4Nsv*)getNextPacket();
+	RenderCommand_vertexAttrib4Nsv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nsv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nsv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2011,7 +2011,7 @@ void vertexAttrib4Nub(
 	GLubyte z,
 	GLubyte w)
 {
-	RenderCommand_vertexAttrib4Nub* __restrict packet = (RenderCommand_vertexAttrib4Nub*)getNextPacket();
+	RenderCommand_vertexAttrib4Nub* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nub>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nub::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2023,7 +2023,7 @@ void vertexAttrib4Nubv(
 	GLuint index,
 	const GLubyte *v)
 {
-	RenderCommand_vertexAttrib4Nubv* __restrict packet = (RenderCommand_vertexAttrib4Nubv*)getNextPacket();
+	RenderCommand_vertexAttrib4Nubv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nubv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nubv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2032,7 +2032,7 @@ void vertexAttrib4Nuiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttrib4Nuiv* __restrict packet = (RenderCommand_vertexAttrib4Nuiv*)getNextPacket();
+	RenderCommand_vertexAttrib4Nuiv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nuiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2041,7 +2041,7 @@ void vertexAttrib4Nusv(
 	GLuint index,
 	const GLushort *v)
 {
-	RenderCommand_vertexAttrib4Nusv* __restrict packet = (RenderCommand_vertexAttrib4Nusv*)getNextPacket();
+	RenderCommand_vertexAttrib4Nusv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4Nusv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4Nusv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2050,7 +2050,7 @@ void vertexAttrib4bv(
 	GLuint index,
 	const GLbyte *v)
 {
-	RenderCommand_vertexAttrib4bv* __restrict packet = (RenderCommand_vertexAttrib4bv*)getNextPacket();
+	RenderCommand_vertexAttrib4bv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4bv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4bv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2062,7 +2062,7 @@ void vertexAttrib4d(
 	GLdouble z,
 	GLdouble w)
 {
-	RenderCommand_vertexAttrib4d* __restrict packet = (RenderCommand_vertexAttrib4d*)getNextPacket();
+	RenderCommand_vertexAttrib4d* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2074,7 +2074,7 @@ void vertexAttrib4dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttrib4dv* __restrict packet = (RenderCommand_vertexAttrib4dv*)getNextPacket();
+	RenderCommand_vertexAttrib4dv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2086,7 +2086,7 @@ void vertexAttrib4f(
 	GLfloat z,
 	GLfloat w)
 {
-	RenderCommand_vertexAttrib4f* __restrict packet = (RenderCommand_vertexAttrib4f*)getNextPacket();
+	RenderCommand_vertexAttrib4f* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4f::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2098,7 +2098,7 @@ void vertexAttrib4fv(
 	GLuint index,
 	const GLfloat *v)
 {
-	RenderCommand_vertexAttrib4fv* __restrict packet = (RenderCommand_vertexAttrib4fv*)getNextPacket();
+	RenderCommand_vertexAttrib4fv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4fv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2107,7 +2107,7 @@ void vertexAttrib4iv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttrib4iv* __restrict packet = (RenderCommand_vertexAttrib4iv*)getNextPacket();
+	RenderCommand_vertexAttrib4iv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4iv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2119,7 +2119,7 @@ void vertexAttrib4s(
 	GLshort z,
 	GLshort w)
 {
-	RenderCommand_vertexAttrib4s* __restrict packet = (RenderCommand_vertexAttrib4s*)getNextPacket();
+	RenderCommand_vertexAttrib4s* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4s>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4s::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2131,7 +2131,7 @@ void vertexAttrib4sv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttrib4sv* __restrict packet = (RenderCommand_vertexAttrib4sv*)getNextPacket();
+	RenderCommand_vertexAttrib4sv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4sv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4sv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2140,7 +2140,7 @@ void vertexAttrib4ubv(
 	GLuint index,
 	const GLubyte *v)
 {
-	RenderCommand_vertexAttrib4ubv* __restrict packet = (RenderCommand_vertexAttrib4ubv*)getNextPacket();
+	RenderCommand_vertexAttrib4ubv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4ubv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4ubv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2149,7 +2149,7 @@ void vertexAttrib4uiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttrib4uiv* __restrict packet = (RenderCommand_vertexAttrib4uiv*)getNextPacket();
+	RenderCommand_vertexAttrib4uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4uiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2158,7 +2158,7 @@ void vertexAttrib4usv(
 	GLuint index,
 	const GLushort *v)
 {
-	RenderCommand_vertexAttrib4usv* __restrict packet = (RenderCommand_vertexAttrib4usv*)getNextPacket();
+	RenderCommand_vertexAttrib4usv* __restrict packet = allocatePacket<RenderCommand_vertexAttrib4usv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttrib4usv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2171,7 +2171,7 @@ void vertexAttribPointer(
 	GLsizei stride,
 	const void *pointer)
 {
-	RenderCommand_vertexAttribPointer* __restrict packet = (RenderCommand_vertexAttribPointer*)getNextPacket();
+	RenderCommand_vertexAttribPointer* __restrict packet = allocatePacket<RenderCommand_vertexAttribPointer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribPointer::execute);
 	packet->index = index;
 	packet->size = size;
@@ -2186,7 +2186,7 @@ void uniformMatrix2x3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix2x3fv* __restrict packet = (RenderCommand_uniformMatrix2x3fv*)getNextPacket();
+	RenderCommand_uniformMatrix2x3fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2x3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2x3fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2199,7 +2199,7 @@ void uniformMatrix3x2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix3x2fv* __restrict packet = (RenderCommand_uniformMatrix3x2fv*)getNextPacket();
+	RenderCommand_uniformMatrix3x2fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3x2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3x2fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2212,7 +2212,7 @@ void uniformMatrix2x4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix2x4fv* __restrict packet = (RenderCommand_uniformMatrix2x4fv*)getNextPacket();
+	RenderCommand_uniformMatrix2x4fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2x4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2x4fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2225,7 +2225,7 @@ void uniformMatrix4x2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix4x2fv* __restrict packet = (RenderCommand_uniformMatrix4x2fv*)getNextPacket();
+	RenderCommand_uniformMatrix4x2fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4x2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4x2fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2238,7 +2238,7 @@ void uniformMatrix3x4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix3x4fv* __restrict packet = (RenderCommand_uniformMatrix3x4fv*)getNextPacket();
+	RenderCommand_uniformMatrix3x4fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3x4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3x4fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2251,7 +2251,7 @@ void uniformMatrix4x3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_uniformMatrix4x3fv* __restrict packet = (RenderCommand_uniformMatrix4x3fv*)getNextPacket();
+	RenderCommand_uniformMatrix4x3fv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4x3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4x3fv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2265,7 +2265,7 @@ void colorMaski(
 	GLboolean b,
 	GLboolean a)
 {
-	RenderCommand_colorMaski* __restrict packet = (RenderCommand_colorMaski*)getNextPacket();
+	RenderCommand_colorMaski* __restrict packet = allocatePacket<RenderCommand_colorMaski>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_colorMaski::execute);
 	packet->index = index;
 	packet->r = r;
@@ -2278,7 +2278,7 @@ void getBooleani_v(
 	GLuint index,
 	GLboolean *data)
 {
-	RenderCommand_getBooleani_v* __restrict packet = (RenderCommand_getBooleani_v*)getNextPacket();
+	RenderCommand_getBooleani_v* __restrict packet = allocatePacket<RenderCommand_getBooleani_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBooleani_v::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2289,7 +2289,7 @@ void getIntegeri_v(
 	GLuint index,
 	GLint *data)
 {
-	RenderCommand_getIntegeri_v* __restrict packet = (RenderCommand_getIntegeri_v*)getNextPacket();
+	RenderCommand_getIntegeri_v* __restrict packet = allocatePacket<RenderCommand_getIntegeri_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getIntegeri_v::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2299,7 +2299,7 @@ void enablei(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_enablei* __restrict packet = (RenderCommand_enablei*)getNextPacket();
+	RenderCommand_enablei* __restrict packet = allocatePacket<RenderCommand_enablei>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enablei::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2308,7 +2308,7 @@ void disablei(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_disablei* __restrict packet = (RenderCommand_disablei*)getNextPacket();
+	RenderCommand_disablei* __restrict packet = allocatePacket<RenderCommand_disablei>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disablei::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2317,7 +2317,7 @@ GLboolean isEnabledi(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_isEnabledi* __restrict packet = (RenderCommand_isEnabledi*)getNextPacket();
+	RenderCommand_isEnabledi* __restrict packet = allocatePacket<RenderCommand_isEnabledi>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isEnabledi::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2325,14 +2325,14 @@ GLboolean isEnabledi(
 void beginTransformFeedback(
 	GLenum primitiveMode)
 {
-	RenderCommand_beginTransformFeedback* __restrict packet = (RenderCommand_beginTransformFeedback*)getNextPacket();
+	RenderCommand_beginTransformFeedback* __restrict packet = allocatePacket<RenderCommand_beginTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginTransformFeedback::execute);
 	packet->primitiveMode = primitiveMode;
 }
 void endTransformFeedback(
 	void)
 {
-	RenderCommand_endTransformFeedback* __restrict packet = (RenderCommand_endTransformFeedback*)getNextPacket();
+	RenderCommand_endTransformFeedback* __restrict packet = allocatePacket<RenderCommand_endTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endTransformFeedback::execute);
 }
 void bindBufferRange(
@@ -2342,7 +2342,7 @@ void bindBufferRange(
 	GLintptr offset,
 	GLsizeiptr size)
 {
-	RenderCommand_bindBufferRange* __restrict packet = (RenderCommand_bindBufferRange*)getNextPacket();
+	RenderCommand_bindBufferRange* __restrict packet = allocatePacket<RenderCommand_bindBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindBufferRange::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2355,7 +2355,7 @@ void bindBufferBase(
 	GLuint index,
 	GLuint buffer)
 {
-	RenderCommand_bindBufferBase* __restrict packet = (RenderCommand_bindBufferBase*)getNextPacket();
+	RenderCommand_bindBufferBase* __restrict packet = allocatePacket<RenderCommand_bindBufferBase>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindBufferBase::execute);
 	packet->target = target;
 	packet->index = index;
@@ -2367,7 +2367,7 @@ void transformFeedbackVaryings(
 	const GLchar *const*varyings,
 	GLenum bufferMode)
 {
-	RenderCommand_transformFeedbackVaryings* __restrict packet = (RenderCommand_transformFeedbackVaryings*)getNextPacket();
+	RenderCommand_transformFeedbackVaryings* __restrict packet = allocatePacket<RenderCommand_transformFeedbackVaryings>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_transformFeedbackVaryings::execute);
 	packet->program = program;
 	packet->count = count;
@@ -2383,7 +2383,7 @@ void getTransformFeedbackVarying(
 	GLenum *type,
 	GLchar *name)
 {
-	RenderCommand_getTransformFeedbackVarying* __restrict packet = (RenderCommand_getTransformFeedbackVarying*)getNextPacket();
+	RenderCommand_getTransformFeedbackVarying* __restrict packet = allocatePacket<RenderCommand_getTransformFeedbackVarying>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTransformFeedbackVarying::execute);
 	packet->program = program;
 	packet->index = index;
@@ -2397,7 +2397,7 @@ void clampColor(
 	GLenum target,
 	GLenum clamp)
 {
-	RenderCommand_clampColor* __restrict packet = (RenderCommand_clampColor*)getNextPacket();
+	RenderCommand_clampColor* __restrict packet = allocatePacket<RenderCommand_clampColor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clampColor::execute);
 	packet->target = target;
 	packet->clamp = clamp;
@@ -2406,7 +2406,7 @@ void beginConditionalRender(
 	GLuint id,
 	GLenum mode)
 {
-	RenderCommand_beginConditionalRender* __restrict packet = (RenderCommand_beginConditionalRender*)getNextPacket();
+	RenderCommand_beginConditionalRender* __restrict packet = allocatePacket<RenderCommand_beginConditionalRender>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginConditionalRender::execute);
 	packet->id = id;
 	packet->mode = mode;
@@ -2414,7 +2414,7 @@ void beginConditionalRender(
 void endConditionalRender(
 	void)
 {
-	RenderCommand_endConditionalRender* __restrict packet = (RenderCommand_endConditionalRender*)getNextPacket();
+	RenderCommand_endConditionalRender* __restrict packet = allocatePacket<RenderCommand_endConditionalRender>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endConditionalRender::execute);
 }
 void vertexAttribIPointer(
@@ -2424,7 +2424,7 @@ void vertexAttribIPointer(
 	GLsizei stride,
 	const void *pointer)
 {
-	RenderCommand_vertexAttribIPointer* __restrict packet = (RenderCommand_vertexAttribIPointer*)getNextPacket();
+	RenderCommand_vertexAttribIPointer* __restrict packet = allocatePacket<RenderCommand_vertexAttribIPointer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribIPointer::execute);
 	packet->index = index;
 	packet->size = size;
@@ -2437,7 +2437,7 @@ void getVertexAttribIiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getVertexAttribIiv* __restrict packet = (RenderCommand_getVertexAttribIiv*)getNextPacket();
+	RenderCommand_getVertexAttribIiv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribIiv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -2448,7 +2448,7 @@ void getVertexAttribIuiv(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getVertexAttribIuiv* __restrict packet = (RenderCommand_getVertexAttribIuiv*)getNextPacket();
+	RenderCommand_getVertexAttribIuiv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribIuiv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -2458,7 +2458,7 @@ void vertexAttribI1i(
 	GLuint index,
 	GLint x)
 {
-	RenderCommand_vertexAttribI1i* __restrict packet = (RenderCommand_vertexAttribI1i*)getNextPacket();
+	RenderCommand_vertexAttribI1i* __restrict packet = allocatePacket<RenderCommand_vertexAttribI1i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI1i::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2468,7 +2468,7 @@ void vertexAttribI2i(
 	GLint x,
 	GLint y)
 {
-	RenderCommand_vertexAttribI2i* __restrict packet = (RenderCommand_vertexAttribI2i*)getNextPacket();
+	RenderCommand_vertexAttribI2i* __restrict packet = allocatePacket<RenderCommand_vertexAttribI2i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI2i::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2480,7 +2480,7 @@ void vertexAttribI3i(
 	GLint y,
 	GLint z)
 {
-	RenderCommand_vertexAttribI3i* __restrict packet = (RenderCommand_vertexAttribI3i*)getNextPacket();
+	RenderCommand_vertexAttribI3i* __restrict packet = allocatePacket<RenderCommand_vertexAttribI3i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI3i::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2494,7 +2494,7 @@ void vertexAttribI4i(
 	GLint z,
 	GLint w)
 {
-	RenderCommand_vertexAttribI4i* __restrict packet = (RenderCommand_vertexAttribI4i*)getNextPacket();
+	RenderCommand_vertexAttribI4i* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4i::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2506,7 +2506,7 @@ void vertexAttribI1ui(
 	GLuint index,
 	GLuint x)
 {
-	RenderCommand_vertexAttribI1ui* __restrict packet = (RenderCommand_vertexAttribI1ui*)getNextPacket();
+	RenderCommand_vertexAttribI1ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribI1ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI1ui::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2516,7 +2516,7 @@ void vertexAttribI2ui(
 	GLuint x,
 	GLuint y)
 {
-	RenderCommand_vertexAttribI2ui* __restrict packet = (RenderCommand_vertexAttribI2ui*)getNextPacket();
+	RenderCommand_vertexAttribI2ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribI2ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI2ui::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2528,7 +2528,7 @@ void vertexAttribI3ui(
 	GLuint y,
 	GLuint z)
 {
-	RenderCommand_vertexAttribI3ui* __restrict packet = (RenderCommand_vertexAttribI3ui*)getNextPacket();
+	RenderCommand_vertexAttribI3ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribI3ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI3ui::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2542,7 +2542,7 @@ void vertexAttribI4ui(
 	GLuint z,
 	GLuint w)
 {
-	RenderCommand_vertexAttribI4ui* __restrict packet = (RenderCommand_vertexAttribI4ui*)getNextPacket();
+	RenderCommand_vertexAttribI4ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4ui::execute);
 	packet->index = index;
 	packet->x = x;
@@ -2554,7 +2554,7 @@ void vertexAttribI1iv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttribI1iv* __restrict packet = (RenderCommand_vertexAttribI1iv*)getNextPacket();
+	RenderCommand_vertexAttribI1iv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI1iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI1iv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2563,7 +2563,7 @@ void vertexAttribI2iv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttribI2iv* __restrict packet = (RenderCommand_vertexAttribI2iv*)getNextPacket();
+	RenderCommand_vertexAttribI2iv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI2iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI2iv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2572,7 +2572,7 @@ void vertexAttribI3iv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttribI3iv* __restrict packet = (RenderCommand_vertexAttribI3iv*)getNextPacket();
+	RenderCommand_vertexAttribI3iv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI3iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI3iv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2581,7 +2581,7 @@ void vertexAttribI4iv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_vertexAttribI4iv* __restrict packet = (RenderCommand_vertexAttribI4iv*)getNextPacket();
+	RenderCommand_vertexAttribI4iv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4iv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2590,7 +2590,7 @@ void vertexAttribI1uiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttribI1uiv* __restrict packet = (RenderCommand_vertexAttribI1uiv*)getNextPacket();
+	RenderCommand_vertexAttribI1uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI1uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI1uiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2599,7 +2599,7 @@ void vertexAttribI2uiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttribI2uiv* __restrict packet = (RenderCommand_vertexAttribI2uiv*)getNextPacket();
+	RenderCommand_vertexAttribI2uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI2uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI2uiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2608,7 +2608,7 @@ void vertexAttribI3uiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttribI3uiv* __restrict packet = (RenderCommand_vertexAttribI3uiv*)getNextPacket();
+	RenderCommand_vertexAttribI3uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI3uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI3uiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2617,7 +2617,7 @@ void vertexAttribI4uiv(
 	GLuint index,
 	const GLuint *v)
 {
-	RenderCommand_vertexAttribI4uiv* __restrict packet = (RenderCommand_vertexAttribI4uiv*)getNextPacket();
+	RenderCommand_vertexAttribI4uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4uiv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2626,7 +2626,7 @@ void vertexAttribI4bv(
 	GLuint index,
 	const GLbyte *v)
 {
-	RenderCommand_vertexAttribI4bv* __restrict packet = (RenderCommand_vertexAttribI4bv*)getNextPacket();
+	RenderCommand_vertexAttribI4bv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4bv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4bv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2635,7 +2635,7 @@ void vertexAttribI4sv(
 	GLuint index,
 	const GLshort *v)
 {
-	RenderCommand_vertexAttribI4sv* __restrict packet = (RenderCommand_vertexAttribI4sv*)getNextPacket();
+	RenderCommand_vertexAttribI4sv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4sv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4sv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2644,7 +2644,7 @@ void vertexAttribI4ubv(
 	GLuint index,
 	const GLubyte *v)
 {
-	RenderCommand_vertexAttribI4ubv* __restrict packet = (RenderCommand_vertexAttribI4ubv*)getNextPacket();
+	RenderCommand_vertexAttribI4ubv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4ubv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4ubv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2653,7 +2653,7 @@ void vertexAttribI4usv(
 	GLuint index,
 	const GLushort *v)
 {
-	RenderCommand_vertexAttribI4usv* __restrict packet = (RenderCommand_vertexAttribI4usv*)getNextPacket();
+	RenderCommand_vertexAttribI4usv* __restrict packet = allocatePacket<RenderCommand_vertexAttribI4usv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribI4usv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -2663,7 +2663,7 @@ void getUniformuiv(
 	GLint location,
 	GLuint *params)
 {
-	RenderCommand_getUniformuiv* __restrict packet = (RenderCommand_getUniformuiv*)getNextPacket();
+	RenderCommand_getUniformuiv* __restrict packet = allocatePacket<RenderCommand_getUniformuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformuiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -2674,7 +2674,7 @@ void bindFragDataLocation(
 	GLuint color,
 	const GLchar *name)
 {
-	RenderCommand_bindFragDataLocation* __restrict packet = (RenderCommand_bindFragDataLocation*)getNextPacket();
+	RenderCommand_bindFragDataLocation* __restrict packet = allocatePacket<RenderCommand_bindFragDataLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindFragDataLocation::execute);
 	packet->program = program;
 	packet->color = color;
@@ -2684,7 +2684,7 @@ GLint getFragDataLocation(
 	GLuint program,
 	const GLchar *name)
 {
-	RenderCommand_getFragDataLocation* __restrict packet = (RenderCommand_getFragDataLocation*)getNextPacket();
+	RenderCommand_getFragDataLocation* __restrict packet = allocatePacket<RenderCommand_getFragDataLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFragDataLocation::execute);
 	packet->program = program;
 	packet->name = name;
@@ -2693,7 +2693,7 @@ void uniform1ui(
 	GLint location,
 	GLuint v0)
 {
-	RenderCommand_uniform1ui* __restrict packet = (RenderCommand_uniform1ui*)getNextPacket();
+	RenderCommand_uniform1ui* __restrict packet = allocatePacket<RenderCommand_uniform1ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1ui::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -2703,7 +2703,7 @@ void uniform2ui(
 	GLuint v0,
 	GLuint v1)
 {
-	RenderCommand_uniform2ui* __restrict packet = (RenderCommand_uniform2ui*)getNextPacket();
+	RenderCommand_uniform2ui* __restrict packet = allocatePacket<RenderCommand_uniform2ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2ui::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -2715,7 +2715,7 @@ void uniform3ui(
 	GLuint v1,
 	GLuint v2)
 {
-	RenderCommand_uniform3ui* __restrict packet = (RenderCommand_uniform3ui*)getNextPacket();
+	RenderCommand_uniform3ui* __restrict packet = allocatePacket<RenderCommand_uniform3ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3ui::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -2729,7 +2729,7 @@ void uniform4ui(
 	GLuint v2,
 	GLuint v3)
 {
-	RenderCommand_uniform4ui* __restrict packet = (RenderCommand_uniform4ui*)getNextPacket();
+	RenderCommand_uniform4ui* __restrict packet = allocatePacket<RenderCommand_uniform4ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4ui::execute);
 	packet->location = location;
 	packet->v0 = v0;
@@ -2742,7 +2742,7 @@ void uniform1uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_uniform1uiv* __restrict packet = (RenderCommand_uniform1uiv*)getNextPacket();
+	RenderCommand_uniform1uiv* __restrict packet = allocatePacket<RenderCommand_uniform1uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1uiv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2753,7 +2753,7 @@ void uniform2uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_uniform2uiv* __restrict packet = (RenderCommand_uniform2uiv*)getNextPacket();
+	RenderCommand_uniform2uiv* __restrict packet = allocatePacket<RenderCommand_uniform2uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2uiv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2764,7 +2764,7 @@ void uniform3uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_uniform3uiv* __restrict packet = (RenderCommand_uniform3uiv*)getNextPacket();
+	RenderCommand_uniform3uiv* __restrict packet = allocatePacket<RenderCommand_uniform3uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3uiv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2775,7 +2775,7 @@ void uniform4uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_uniform4uiv* __restrict packet = (RenderCommand_uniform4uiv*)getNextPacket();
+	RenderCommand_uniform4uiv* __restrict packet = allocatePacket<RenderCommand_uniform4uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4uiv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -2786,7 +2786,7 @@ void texParameterIiv(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_texParameterIiv* __restrict packet = (RenderCommand_texParameterIiv*)getNextPacket();
+	RenderCommand_texParameterIiv* __restrict packet = allocatePacket<RenderCommand_texParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameterIiv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -2797,7 +2797,7 @@ void texParameterIuiv(
 	GLenum pname,
 	const GLuint *params)
 {
-	RenderCommand_texParameterIuiv* __restrict packet = (RenderCommand_texParameterIuiv*)getNextPacket();
+	RenderCommand_texParameterIuiv* __restrict packet = allocatePacket<RenderCommand_texParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texParameterIuiv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -2808,7 +2808,7 @@ void getTexParameterIiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTexParameterIiv* __restrict packet = (RenderCommand_getTexParameterIiv*)getNextPacket();
+	RenderCommand_getTexParameterIiv* __restrict packet = allocatePacket<RenderCommand_getTexParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexParameterIiv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -2819,7 +2819,7 @@ void getTexParameterIuiv(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getTexParameterIuiv* __restrict packet = (RenderCommand_getTexParameterIuiv*)getNextPacket();
+	RenderCommand_getTexParameterIuiv* __restrict packet = allocatePacket<RenderCommand_getTexParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTexParameterIuiv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -2830,7 +2830,7 @@ void clearBufferiv(
 	GLint drawbuffer,
 	const GLint *value)
 {
-	RenderCommand_clearBufferiv* __restrict packet = (RenderCommand_clearBufferiv*)getNextPacket();
+	RenderCommand_clearBufferiv* __restrict packet = allocatePacket<RenderCommand_clearBufferiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferiv::execute);
 	packet->buffer = buffer;
 	packet->drawbuffer = drawbuffer;
@@ -2841,7 +2841,7 @@ void clearBufferuiv(
 	GLint drawbuffer,
 	const GLuint *value)
 {
-	RenderCommand_clearBufferuiv* __restrict packet = (RenderCommand_clearBufferuiv*)getNextPacket();
+	RenderCommand_clearBufferuiv* __restrict packet = allocatePacket<RenderCommand_clearBufferuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferuiv::execute);
 	packet->buffer = buffer;
 	packet->drawbuffer = drawbuffer;
@@ -2852,7 +2852,7 @@ void clearBufferfv(
 	GLint drawbuffer,
 	const GLfloat *value)
 {
-	RenderCommand_clearBufferfv* __restrict packet = (RenderCommand_clearBufferfv*)getNextPacket();
+	RenderCommand_clearBufferfv* __restrict packet = allocatePacket<RenderCommand_clearBufferfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferfv::execute);
 	packet->buffer = buffer;
 	packet->drawbuffer = drawbuffer;
@@ -2864,7 +2864,7 @@ void clearBufferfi(
 	GLfloat depth,
 	GLint stencil)
 {
-	RenderCommand_clearBufferfi* __restrict packet = (RenderCommand_clearBufferfi*)getNextPacket();
+	RenderCommand_clearBufferfi* __restrict packet = allocatePacket<RenderCommand_clearBufferfi>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferfi::execute);
 	packet->buffer = buffer;
 	packet->drawbuffer = drawbuffer;
@@ -2875,7 +2875,7 @@ const GLubyte* getStringi(
 	GLenum name,
 	GLuint index)
 {
-	RenderCommand_getStringi* __restrict packet = (RenderCommand_getStringi*)getNextPacket();
+	RenderCommand_getStringi* __restrict packet = allocatePacket<RenderCommand_getStringi>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getStringi::execute);
 	packet->name = name;
 	packet->index = index;
@@ -2883,7 +2883,7 @@ const GLubyte* getStringi(
 GLboolean isRenderbuffer(
 	GLuint renderbuffer)
 {
-	RenderCommand_isRenderbuffer* __restrict packet = (RenderCommand_isRenderbuffer*)getNextPacket();
+	RenderCommand_isRenderbuffer* __restrict packet = allocatePacket<RenderCommand_isRenderbuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isRenderbuffer::execute);
 	packet->renderbuffer = renderbuffer;
 }
@@ -2891,7 +2891,7 @@ void bindRenderbuffer(
 	GLenum target,
 	GLuint renderbuffer)
 {
-	RenderCommand_bindRenderbuffer* __restrict packet = (RenderCommand_bindRenderbuffer*)getNextPacket();
+	RenderCommand_bindRenderbuffer* __restrict packet = allocatePacket<RenderCommand_bindRenderbuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindRenderbuffer::execute);
 	packet->target = target;
 	packet->renderbuffer = renderbuffer;
@@ -2900,7 +2900,7 @@ void deleteRenderbuffers(
 	GLsizei n,
 	const GLuint *renderbuffers)
 {
-	RenderCommand_deleteRenderbuffers* __restrict packet = (RenderCommand_deleteRenderbuffers*)getNextPacket();
+	RenderCommand_deleteRenderbuffers* __restrict packet = allocatePacket<RenderCommand_deleteRenderbuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteRenderbuffers::execute);
 	packet->n = n;
 	packet->renderbuffers = renderbuffers;
@@ -2909,7 +2909,7 @@ void genRenderbuffers(
 	GLsizei n,
 	GLuint *renderbuffers)
 {
-	RenderCommand_genRenderbuffers* __restrict packet = (RenderCommand_genRenderbuffers*)getNextPacket();
+	RenderCommand_genRenderbuffers* __restrict packet = allocatePacket<RenderCommand_genRenderbuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genRenderbuffers::execute);
 	packet->n = n;
 	packet->renderbuffers = renderbuffers;
@@ -2920,7 +2920,7 @@ void renderbufferStorage(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_renderbufferStorage* __restrict packet = (RenderCommand_renderbufferStorage*)getNextPacket();
+	RenderCommand_renderbufferStorage* __restrict packet = allocatePacket<RenderCommand_renderbufferStorage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_renderbufferStorage::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -2932,7 +2932,7 @@ void getRenderbufferParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getRenderbufferParameteriv* __restrict packet = (RenderCommand_getRenderbufferParameteriv*)getNextPacket();
+	RenderCommand_getRenderbufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getRenderbufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getRenderbufferParameteriv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -2941,7 +2941,7 @@ void getRenderbufferParameteriv(
 GLboolean isFramebuffer(
 	GLuint framebuffer)
 {
-	RenderCommand_isFramebuffer* __restrict packet = (RenderCommand_isFramebuffer*)getNextPacket();
+	RenderCommand_isFramebuffer* __restrict packet = allocatePacket<RenderCommand_isFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isFramebuffer::execute);
 	packet->framebuffer = framebuffer;
 }
@@ -2949,7 +2949,7 @@ void bindFramebuffer(
 	GLenum target,
 	GLuint framebuffer)
 {
-	RenderCommand_bindFramebuffer* __restrict packet = (RenderCommand_bindFramebuffer*)getNextPacket();
+	RenderCommand_bindFramebuffer* __restrict packet = allocatePacket<RenderCommand_bindFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindFramebuffer::execute);
 	packet->target = target;
 	packet->framebuffer = framebuffer;
@@ -2958,7 +2958,7 @@ void deleteFramebuffers(
 	GLsizei n,
 	const GLuint *framebuffers)
 {
-	RenderCommand_deleteFramebuffers* __restrict packet = (RenderCommand_deleteFramebuffers*)getNextPacket();
+	RenderCommand_deleteFramebuffers* __restrict packet = allocatePacket<RenderCommand_deleteFramebuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteFramebuffers::execute);
 	packet->n = n;
 	packet->framebuffers = framebuffers;
@@ -2967,7 +2967,7 @@ void genFramebuffers(
 	GLsizei n,
 	GLuint *framebuffers)
 {
-	RenderCommand_genFramebuffers* __restrict packet = (RenderCommand_genFramebuffers*)getNextPacket();
+	RenderCommand_genFramebuffers* __restrict packet = allocatePacket<RenderCommand_genFramebuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genFramebuffers::execute);
 	packet->n = n;
 	packet->framebuffers = framebuffers;
@@ -2975,7 +2975,7 @@ void genFramebuffers(
 GLenum checkFramebufferStatus(
 	GLenum target)
 {
-	RenderCommand_checkFramebufferStatus* __restrict packet = (RenderCommand_checkFramebufferStatus*)getNextPacket();
+	RenderCommand_checkFramebufferStatus* __restrict packet = allocatePacket<RenderCommand_checkFramebufferStatus>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_checkFramebufferStatus::execute);
 	packet->target = target;
 }
@@ -2986,7 +2986,7 @@ void framebufferTexture1D(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_framebufferTexture1D* __restrict packet = (RenderCommand_framebufferTexture1D*)getNextPacket();
+	RenderCommand_framebufferTexture1D* __restrict packet = allocatePacket<RenderCommand_framebufferTexture1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTexture1D::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3001,7 +3001,7 @@ void framebufferTexture2D(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_framebufferTexture2D* __restrict packet = (RenderCommand_framebufferTexture2D*)getNextPacket();
+	RenderCommand_framebufferTexture2D* __restrict packet = allocatePacket<RenderCommand_framebufferTexture2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTexture2D::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3017,7 +3017,7 @@ void framebufferTexture3D(
 	GLint level,
 	GLint zoffset)
 {
-	RenderCommand_framebufferTexture3D* __restrict packet = (RenderCommand_framebufferTexture3D*)getNextPacket();
+	RenderCommand_framebufferTexture3D* __restrict packet = allocatePacket<RenderCommand_framebufferTexture3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTexture3D::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3032,7 +3032,7 @@ void framebufferRenderbuffer(
 	GLenum renderbuffertarget,
 	GLuint renderbuffer)
 {
-	RenderCommand_framebufferRenderbuffer* __restrict packet = (RenderCommand_framebufferRenderbuffer*)getNextPacket();
+	RenderCommand_framebufferRenderbuffer* __restrict packet = allocatePacket<RenderCommand_framebufferRenderbuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferRenderbuffer::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3045,7 +3045,7 @@ void getFramebufferAttachmentParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getFramebufferAttachmentParameteriv* __restrict packet = (RenderCommand_getFramebufferAttachmentParameteriv*)getNextPacket();
+	RenderCommand_getFramebufferAttachmentParameteriv* __restrict packet = allocatePacket<RenderCommand_getFramebufferAttachmentParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFramebufferAttachmentParameteriv::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3055,7 +3055,7 @@ void getFramebufferAttachmentParameteriv(
 void generateMipmap(
 	GLenum target)
 {
-	RenderCommand_generateMipmap* __restrict packet = (RenderCommand_generateMipmap*)getNextPacket();
+	RenderCommand_generateMipmap* __restrict packet = allocatePacket<RenderCommand_generateMipmap>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_generateMipmap::execute);
 	packet->target = target;
 }
@@ -3071,7 +3071,7 @@ void blitFramebuffer(
 	GLbitfield mask,
 	GLenum filter)
 {
-	RenderCommand_blitFramebuffer* __restrict packet = (RenderCommand_blitFramebuffer*)getNextPacket();
+	RenderCommand_blitFramebuffer* __restrict packet = allocatePacket<RenderCommand_blitFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blitFramebuffer::execute);
 	packet->srcX0 = srcX0;
 	packet->srcY0 = srcY0;
@@ -3091,7 +3091,7 @@ void renderbufferStorageMultisample(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_renderbufferStorageMultisample* __restrict packet = (RenderCommand_renderbufferStorageMultisample*)getNextPacket();
+	RenderCommand_renderbufferStorageMultisample* __restrict packet = allocatePacket<RenderCommand_renderbufferStorageMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_renderbufferStorageMultisample::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -3106,7 +3106,7 @@ void framebufferTextureLayer(
 	GLint level,
 	GLint layer)
 {
-	RenderCommand_framebufferTextureLayer* __restrict packet = (RenderCommand_framebufferTextureLayer*)getNextPacket();
+	RenderCommand_framebufferTextureLayer* __restrict packet = allocatePacket<RenderCommand_framebufferTextureLayer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTextureLayer::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3120,7 +3120,7 @@ void* mapBufferRange(
 	GLsizeiptr length,
 	GLbitfield access)
 {
-	RenderCommand_mapBufferRange* __restrict packet = (RenderCommand_mapBufferRange*)getNextPacket();
+	RenderCommand_mapBufferRange* __restrict packet = allocatePacket<RenderCommand_mapBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapBufferRange::execute);
 	packet->target = target;
 	packet->offset = offset;
@@ -3132,7 +3132,7 @@ void flushMappedBufferRange(
 	GLintptr offset,
 	GLsizeiptr length)
 {
-	RenderCommand_flushMappedBufferRange* __restrict packet = (RenderCommand_flushMappedBufferRange*)getNextPacket();
+	RenderCommand_flushMappedBufferRange* __restrict packet = allocatePacket<RenderCommand_flushMappedBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_flushMappedBufferRange::execute);
 	packet->target = target;
 	packet->offset = offset;
@@ -3141,7 +3141,7 @@ void flushMappedBufferRange(
 void bindVertexArray(
 	GLuint array)
 {
-	RenderCommand_bindVertexArray* __restrict packet = (RenderCommand_bindVertexArray*)getNextPacket();
+	RenderCommand_bindVertexArray* __restrict packet = allocatePacket<RenderCommand_bindVertexArray>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindVertexArray::execute);
 	packet->array = array;
 }
@@ -3149,7 +3149,7 @@ void deleteVertexArrays(
 	GLsizei n,
 	const GLuint *arrays)
 {
-	RenderCommand_deleteVertexArrays* __restrict packet = (RenderCommand_deleteVertexArrays*)getNextPacket();
+	RenderCommand_deleteVertexArrays* __restrict packet = allocatePacket<RenderCommand_deleteVertexArrays>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteVertexArrays::execute);
 	packet->n = n;
 	packet->arrays = arrays;
@@ -3158,7 +3158,7 @@ void genVertexArrays(
 	GLsizei n,
 	GLuint *arrays)
 {
-	RenderCommand_genVertexArrays* __restrict packet = (RenderCommand_genVertexArrays*)getNextPacket();
+	RenderCommand_genVertexArrays* __restrict packet = allocatePacket<RenderCommand_genVertexArrays>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genVertexArrays::execute);
 	packet->n = n;
 	packet->arrays = arrays;
@@ -3166,7 +3166,7 @@ void genVertexArrays(
 GLboolean isVertexArray(
 	GLuint array)
 {
-	RenderCommand_isVertexArray* __restrict packet = (RenderCommand_isVertexArray*)getNextPacket();
+	RenderCommand_isVertexArray* __restrict packet = allocatePacket<RenderCommand_isVertexArray>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isVertexArray::execute);
 	packet->array = array;
 }
@@ -3176,7 +3176,7 @@ void drawArraysInstanced(
 	GLsizei count,
 	GLsizei instancecount)
 {
-	RenderCommand_drawArraysInstanced* __restrict packet = (RenderCommand_drawArraysInstanced*)getNextPacket();
+	RenderCommand_drawArraysInstanced* __restrict packet = allocatePacket<RenderCommand_drawArraysInstanced>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArraysInstanced::execute);
 	packet->mode = mode;
 	packet->first = first;
@@ -3190,7 +3190,7 @@ void drawElementsInstanced(
 	const void *indices,
 	GLsizei instancecount)
 {
-	RenderCommand_drawElementsInstanced* __restrict packet = (RenderCommand_drawElementsInstanced*)getNextPacket();
+	RenderCommand_drawElementsInstanced* __restrict packet = allocatePacket<RenderCommand_drawElementsInstanced>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstanced::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -3203,7 +3203,7 @@ void texBuffer(
 	GLenum internalformat,
 	GLuint buffer)
 {
-	RenderCommand_texBuffer* __restrict packet = (RenderCommand_texBuffer*)getNextPacket();
+	RenderCommand_texBuffer* __restrict packet = allocatePacket<RenderCommand_texBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texBuffer::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -3212,7 +3212,7 @@ void texBuffer(
 void primitiveRestartIndex(
 	GLuint index)
 {
-	RenderCommand_primitiveRestartIndex* __restrict packet = (RenderCommand_primitiveRestartIndex*)getNextPacket();
+	RenderCommand_primitiveRestartIndex* __restrict packet = allocatePacket<RenderCommand_primitiveRestartIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_primitiveRestartIndex::execute);
 	packet->index = index;
 }
@@ -3223,7 +3223,7 @@ void copyBufferSubData(
 	GLintptr writeOffset,
 	GLsizeiptr size)
 {
-	RenderCommand_copyBufferSubData* __restrict packet = (RenderCommand_copyBufferSubData*)getNextPacket();
+	RenderCommand_copyBufferSubData* __restrict packet = allocatePacket<RenderCommand_copyBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyBufferSubData::execute);
 	packet->readTarget = readTarget;
 	packet->writeTarget = writeTarget;
@@ -3237,7 +3237,7 @@ void getUniformIndices(
 	const GLchar *const*uniformNames,
 	GLuint *uniformIndices)
 {
-	RenderCommand_getUniformIndices* __restrict packet = (RenderCommand_getUniformIndices*)getNextPacket();
+	RenderCommand_getUniformIndices* __restrict packet = allocatePacket<RenderCommand_getUniformIndices>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformIndices::execute);
 	packet->program = program;
 	packet->uniformCount = uniformCount;
@@ -3251,7 +3251,7 @@ void getActiveUniformsiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getActiveUniformsiv* __restrict packet = (RenderCommand_getActiveUniformsiv*)getNextPacket();
+	RenderCommand_getActiveUniformsiv* __restrict packet = allocatePacket<RenderCommand_getActiveUniformsiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveUniformsiv::execute);
 	packet->program = program;
 	packet->uniformCount = uniformCount;
@@ -3266,7 +3266,7 @@ void getActiveUniformName(
 	GLsizei *length,
 	GLchar *uniformName)
 {
-	RenderCommand_getActiveUniformName* __restrict packet = (RenderCommand_getActiveUniformName*)getNextPacket();
+	RenderCommand_getActiveUniformName* __restrict packet = allocatePacket<RenderCommand_getActiveUniformName>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveUniformName::execute);
 	packet->program = program;
 	packet->uniformIndex = uniformIndex;
@@ -3278,7 +3278,7 @@ GLuint getUniformBlockIndex(
 	GLuint program,
 	const GLchar *uniformBlockName)
 {
-	RenderCommand_getUniformBlockIndex* __restrict packet = (RenderCommand_getUniformBlockIndex*)getNextPacket();
+	RenderCommand_getUniformBlockIndex* __restrict packet = allocatePacket<RenderCommand_getUniformBlockIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformBlockIndex::execute);
 	packet->program = program;
 	packet->uniformBlockName = uniformBlockName;
@@ -3289,7 +3289,7 @@ void getActiveUniformBlockiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getActiveUniformBlockiv* __restrict packet = (RenderCommand_getActiveUniformBlockiv*)getNextPacket();
+	RenderCommand_getActiveUniformBlockiv* __restrict packet = allocatePacket<RenderCommand_getActiveUniformBlockiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveUniformBlockiv::execute);
 	packet->program = program;
 	packet->uniformBlockIndex = uniformBlockIndex;
@@ -3303,7 +3303,7 @@ void getActiveUniformBlockName(
 	GLsizei *length,
 	GLchar *uniformBlockName)
 {
-	RenderCommand_getActiveUniformBlockName* __restrict packet = (RenderCommand_getActiveUniformBlockName*)getNextPacket();
+	RenderCommand_getActiveUniformBlockName* __restrict packet = allocatePacket<RenderCommand_getActiveUniformBlockName>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveUniformBlockName::execute);
 	packet->program = program;
 	packet->uniformBlockIndex = uniformBlockIndex;
@@ -3316,7 +3316,7 @@ void uniformBlockBinding(
 	GLuint uniformBlockIndex,
 	GLuint uniformBlockBinding)
 {
-	RenderCommand_uniformBlockBinding* __restrict packet = (RenderCommand_uniformBlockBinding*)getNextPacket();
+	RenderCommand_uniformBlockBinding* __restrict packet = allocatePacket<RenderCommand_uniformBlockBinding>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformBlockBinding::execute);
 	packet->program = program;
 	packet->uniformBlockIndex = uniformBlockIndex;
@@ -3329,7 +3329,7 @@ void drawElementsBaseVertex(
 	const void *indices,
 	GLint basevertex)
 {
-	RenderCommand_drawElementsBaseVertex* __restrict packet = (RenderCommand_drawElementsBaseVertex*)getNextPacket();
+	RenderCommand_drawElementsBaseVertex* __restrict packet = allocatePacket<RenderCommand_drawElementsBaseVertex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsBaseVertex::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -3346,7 +3346,7 @@ void drawRangeElementsBaseVertex(
 	const void *indices,
 	GLint basevertex)
 {
-	RenderCommand_drawRangeElementsBaseVertex* __restrict packet = (RenderCommand_drawRangeElementsBaseVertex*)getNextPacket();
+	RenderCommand_drawRangeElementsBaseVertex* __restrict packet = allocatePacket<RenderCommand_drawRangeElementsBaseVertex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawRangeElementsBaseVertex::execute);
 	packet->mode = mode;
 	packet->start = start;
@@ -3364,7 +3364,7 @@ void drawElementsInstancedBaseVertex(
 	GLsizei instancecount,
 	GLint basevertex)
 {
-	RenderCommand_drawElementsInstancedBaseVertex* __restrict packet = (RenderCommand_drawElementsInstancedBaseVertex*)getNextPacket();
+	RenderCommand_drawElementsInstancedBaseVertex* __restrict packet = allocatePacket<RenderCommand_drawElementsInstancedBaseVertex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstancedBaseVertex::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -3381,7 +3381,7 @@ void multiDrawElementsBaseVertex(
 	GLsizei drawcount,
 	const GLint *basevertex)
 {
-	RenderCommand_multiDrawElementsBaseVertex* __restrict packet = (RenderCommand_multiDrawElementsBaseVertex*)getNextPacket();
+	RenderCommand_multiDrawElementsBaseVertex* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsBaseVertex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsBaseVertex::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -3393,7 +3393,7 @@ void multiDrawElementsBaseVertex(
 void provokingVertex(
 	GLenum mode)
 {
-	RenderCommand_provokingVertex* __restrict packet = (RenderCommand_provokingVertex*)getNextPacket();
+	RenderCommand_provokingVertex* __restrict packet = allocatePacket<RenderCommand_provokingVertex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_provokingVertex::execute);
 	packet->mode = mode;
 }
@@ -3401,7 +3401,7 @@ GLsync fenceSync(
 	GLenum condition,
 	GLbitfield flags)
 {
-	RenderCommand_fenceSync* __restrict packet = (RenderCommand_fenceSync*)getNextPacket();
+	RenderCommand_fenceSync* __restrict packet = allocatePacket<RenderCommand_fenceSync>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_fenceSync::execute);
 	packet->condition = condition;
 	packet->flags = flags;
@@ -3409,14 +3409,14 @@ GLsync fenceSync(
 GLboolean isSync(
 	GLsync sync)
 {
-	RenderCommand_isSync* __restrict packet = (RenderCommand_isSync*)getNextPacket();
+	RenderCommand_isSync* __restrict packet = allocatePacket<RenderCommand_isSync>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isSync::execute);
 	packet->sync = sync;
 }
 void deleteSync(
 	GLsync sync)
 {
-	RenderCommand_deleteSync* __restrict packet = (RenderCommand_deleteSync*)getNextPacket();
+	RenderCommand_deleteSync* __restrict packet = allocatePacket<RenderCommand_deleteSync>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteSync::execute);
 	packet->sync = sync;
 }
@@ -3425,7 +3425,7 @@ GLenum clientWaitSync(
 	GLbitfield flags,
 	GLuint64 timeout)
 {
-	RenderCommand_clientWaitSync* __restrict packet = (RenderCommand_clientWaitSync*)getNextPacket();
+	RenderCommand_clientWaitSync* __restrict packet = allocatePacket<RenderCommand_clientWaitSync>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clientWaitSync::execute);
 	packet->sync = sync;
 	packet->flags = flags;
@@ -3436,7 +3436,7 @@ void waitSync(
 	GLbitfield flags,
 	GLuint64 timeout)
 {
-	RenderCommand_waitSync* __restrict packet = (RenderCommand_waitSync*)getNextPacket();
+	RenderCommand_waitSync* __restrict packet = allocatePacket<RenderCommand_waitSync>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_waitSync::execute);
 	packet->sync = sync;
 	packet->flags = flags;
@@ -3446,7 +3446,7 @@ void getInteger64v(
 	GLenum pname,
 	GLint64 *data)
 {
-	RenderCommand_getInteger64v* __restrict packet = (RenderCommand_getInteger64v*)getNextPacket();
+	RenderCommand_getInteger64v* __restrict packet = allocatePacket<RenderCommand_getInteger64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getInteger64v::execute);
 	packet->pname = pname;
 	packet->data = data;
@@ -3458,7 +3458,7 @@ void getSynciv(
 	GLsizei *length,
 	GLint *values)
 {
-	RenderCommand_getSynciv* __restrict packet = (RenderCommand_getSynciv*)getNextPacket();
+	RenderCommand_getSynciv* __restrict packet = allocatePacket<RenderCommand_getSynciv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSynciv::execute);
 	packet->sync = sync;
 	packet->pname = pname;
@@ -3471,7 +3471,7 @@ void getInteger64i_v(
 	GLuint index,
 	GLint64 *data)
 {
-	RenderCommand_getInteger64i_v* __restrict packet = (RenderCommand_getInteger64i_v*)getNextPacket();
+	RenderCommand_getInteger64i_v* __restrict packet = allocatePacket<RenderCommand_getInteger64i_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getInteger64i_v::execute);
 	packet->target = target;
 	packet->index = index;
@@ -3482,7 +3482,7 @@ void getBufferParameteri64v(
 	GLenum pname,
 	GLint64 *params)
 {
-	RenderCommand_getBufferParameteri64v* __restrict packet = (RenderCommand_getBufferParameteri64v*)getNextPacket();
+	RenderCommand_getBufferParameteri64v* __restrict packet = allocatePacket<RenderCommand_getBufferParameteri64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBufferParameteri64v::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -3494,7 +3494,7 @@ void framebufferTexture(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_framebufferTexture* __restrict packet = (RenderCommand_framebufferTexture*)getNextPacket();
+	RenderCommand_framebufferTexture* __restrict packet = allocatePacket<RenderCommand_framebufferTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTexture::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -3509,7 +3509,7 @@ void texImage2DMultisample(
 	GLsizei height,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_texImage2DMultisample* __restrict packet = (RenderCommand_texImage2DMultisample*)getNextPacket();
+	RenderCommand_texImage2DMultisample* __restrict packet = allocatePacket<RenderCommand_texImage2DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texImage2DMultisample::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -3527,7 +3527,7 @@ void texImage3DMultisample(
 	GLsizei depth,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_texImage3DMultisample* __restrict packet = (RenderCommand_texImage3DMultisample*)getNextPacket();
+	RenderCommand_texImage3DMultisample* __restrict packet = allocatePacket<RenderCommand_texImage3DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texImage3DMultisample::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -3542,7 +3542,7 @@ void getMultisamplefv(
 	GLuint index,
 	GLfloat *val)
 {
-	RenderCommand_getMultisamplefv* __restrict packet = (RenderCommand_getMultisamplefv*)getNextPacket();
+	RenderCommand_getMultisamplefv* __restrict packet = allocatePacket<RenderCommand_getMultisamplefv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultisamplefv::execute);
 	packet->pname = pname;
 	packet->index = index;
@@ -3552,7 +3552,7 @@ void sampleMaski(
 	GLuint maskNumber,
 	GLbitfield mask)
 {
-	RenderCommand_sampleMaski* __restrict packet = (RenderCommand_sampleMaski*)getNextPacket();
+	RenderCommand_sampleMaski* __restrict packet = allocatePacket<RenderCommand_sampleMaski>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_sampleMaski::execute);
 	packet->maskNumber = maskNumber;
 	packet->mask = mask;
@@ -3563,7 +3563,7 @@ void bindFragDataLocationIndexed(
 	GLuint index,
 	const GLchar *name)
 {
-	RenderCommand_bindFragDataLocationIndexed* __restrict packet = (RenderCommand_bindFragDataLocationIndexed*)getNextPacket();
+	RenderCommand_bindFragDataLocationIndexed* __restrict packet = allocatePacket<RenderCommand_bindFragDataLocationIndexed>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindFragDataLocationIndexed::execute);
 	packet->program = program;
 	packet->colorNumber = colorNumber;
@@ -3574,7 +3574,7 @@ GLint getFragDataIndex(
 	GLuint program,
 	const GLchar *name)
 {
-	RenderCommand_getFragDataIndex* __restrict packet = (RenderCommand_getFragDataIndex*)getNextPacket();
+	RenderCommand_getFragDataIndex* __restrict packet = allocatePacket<RenderCommand_getFragDataIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFragDataIndex::execute);
 	packet->program = program;
 	packet->name = name;
@@ -3583,7 +3583,7 @@ void genSamplers(
 	GLsizei count,
 	GLuint *samplers)
 {
-	RenderCommand_genSamplers* __restrict packet = (RenderCommand_genSamplers*)getNextPacket();
+	RenderCommand_genSamplers* __restrict packet = allocatePacket<RenderCommand_genSamplers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genSamplers::execute);
 	packet->count = count;
 	packet->samplers = samplers;
@@ -3592,7 +3592,7 @@ void deleteSamplers(
 	GLsizei count,
 	const GLuint *samplers)
 {
-	RenderCommand_deleteSamplers* __restrict packet = (RenderCommand_deleteSamplers*)getNextPacket();
+	RenderCommand_deleteSamplers* __restrict packet = allocatePacket<RenderCommand_deleteSamplers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteSamplers::execute);
 	packet->count = count;
 	packet->samplers = samplers;
@@ -3600,7 +3600,7 @@ void deleteSamplers(
 GLboolean isSampler(
 	GLuint sampler)
 {
-	RenderCommand_isSampler* __restrict packet = (RenderCommand_isSampler*)getNextPacket();
+	RenderCommand_isSampler* __restrict packet = allocatePacket<RenderCommand_isSampler>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isSampler::execute);
 	packet->sampler = sampler;
 }
@@ -3608,7 +3608,7 @@ void bindSampler(
 	GLuint unit,
 	GLuint sampler)
 {
-	RenderCommand_bindSampler* __restrict packet = (RenderCommand_bindSampler*)getNextPacket();
+	RenderCommand_bindSampler* __restrict packet = allocatePacket<RenderCommand_bindSampler>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindSampler::execute);
 	packet->unit = unit;
 	packet->sampler = sampler;
@@ -3618,7 +3618,7 @@ void samplerParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_samplerParameteri* __restrict packet = (RenderCommand_samplerParameteri*)getNextPacket();
+	RenderCommand_samplerParameteri* __restrict packet = allocatePacket<RenderCommand_samplerParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameteri::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3629,7 +3629,7 @@ void samplerParameteriv(
 	GLenum pname,
 	const GLint *param)
 {
-	RenderCommand_samplerParameteriv* __restrict packet = (RenderCommand_samplerParameteriv*)getNextPacket();
+	RenderCommand_samplerParameteriv* __restrict packet = allocatePacket<RenderCommand_samplerParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameteriv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3640,7 +3640,7 @@ void samplerParameterf(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_samplerParameterf* __restrict packet = (RenderCommand_samplerParameterf*)getNextPacket();
+	RenderCommand_samplerParameterf* __restrict packet = allocatePacket<RenderCommand_samplerParameterf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameterf::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3651,7 +3651,7 @@ void samplerParameterfv(
 	GLenum pname,
 	const GLfloat *param)
 {
-	RenderCommand_samplerParameterfv* __restrict packet = (RenderCommand_samplerParameterfv*)getNextPacket();
+	RenderCommand_samplerParameterfv* __restrict packet = allocatePacket<RenderCommand_samplerParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameterfv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3662,7 +3662,7 @@ void samplerParameterIiv(
 	GLenum pname,
 	const GLint *param)
 {
-	RenderCommand_samplerParameterIiv* __restrict packet = (RenderCommand_samplerParameterIiv*)getNextPacket();
+	RenderCommand_samplerParameterIiv* __restrict packet = allocatePacket<RenderCommand_samplerParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameterIiv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3673,7 +3673,7 @@ void samplerParameterIuiv(
 	GLenum pname,
 	const GLuint *param)
 {
-	RenderCommand_samplerParameterIuiv* __restrict packet = (RenderCommand_samplerParameterIuiv*)getNextPacket();
+	RenderCommand_samplerParameterIuiv* __restrict packet = allocatePacket<RenderCommand_samplerParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_samplerParameterIuiv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3684,7 +3684,7 @@ void getSamplerParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getSamplerParameteriv* __restrict packet = (RenderCommand_getSamplerParameteriv*)getNextPacket();
+	RenderCommand_getSamplerParameteriv* __restrict packet = allocatePacket<RenderCommand_getSamplerParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSamplerParameteriv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3695,7 +3695,7 @@ void getSamplerParameterIiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getSamplerParameterIiv* __restrict packet = (RenderCommand_getSamplerParameterIiv*)getNextPacket();
+	RenderCommand_getSamplerParameterIiv* __restrict packet = allocatePacket<RenderCommand_getSamplerParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSamplerParameterIiv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3706,7 +3706,7 @@ void getSamplerParameterfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getSamplerParameterfv* __restrict packet = (RenderCommand_getSamplerParameterfv*)getNextPacket();
+	RenderCommand_getSamplerParameterfv* __restrict packet = allocatePacket<RenderCommand_getSamplerParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSamplerParameterfv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3717,7 +3717,7 @@ void getSamplerParameterIuiv(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getSamplerParameterIuiv* __restrict packet = (RenderCommand_getSamplerParameterIuiv*)getNextPacket();
+	RenderCommand_getSamplerParameterIuiv* __restrict packet = allocatePacket<RenderCommand_getSamplerParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSamplerParameterIuiv::execute);
 	packet->sampler = sampler;
 	packet->pname = pname;
@@ -3727,7 +3727,7 @@ void queryCounter(
 	GLuint id,
 	GLenum target)
 {
-	RenderCommand_queryCounter* __restrict packet = (RenderCommand_queryCounter*)getNextPacket();
+	RenderCommand_queryCounter* __restrict packet = allocatePacket<RenderCommand_queryCounter>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_queryCounter::execute);
 	packet->id = id;
 	packet->target = target;
@@ -3737,7 +3737,7 @@ void getQueryObjecti64v(
 	GLenum pname,
 	GLint64 *params)
 {
-	RenderCommand_getQueryObjecti64v* __restrict packet = (RenderCommand_getQueryObjecti64v*)getNextPacket();
+	RenderCommand_getQueryObjecti64v* __restrict packet = allocatePacket<RenderCommand_getQueryObjecti64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryObjecti64v::execute);
 	packet->id = id;
 	packet->pname = pname;
@@ -3748,7 +3748,7 @@ void getQueryObjectui64v(
 	GLenum pname,
 	GLuint64 *params)
 {
-	RenderCommand_getQueryObjectui64v* __restrict packet = (RenderCommand_getQueryObjectui64v*)getNextPacket();
+	RenderCommand_getQueryObjectui64v* __restrict packet = allocatePacket<RenderCommand_getQueryObjectui64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryObjectui64v::execute);
 	packet->id = id;
 	packet->pname = pname;
@@ -3758,7 +3758,7 @@ void vertexAttribDivisor(
 	GLuint index,
 	GLuint divisor)
 {
-	RenderCommand_vertexAttribDivisor* __restrict packet = (RenderCommand_vertexAttribDivisor*)getNextPacket();
+	RenderCommand_vertexAttribDivisor* __restrict packet = allocatePacket<RenderCommand_vertexAttribDivisor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribDivisor::execute);
 	packet->index = index;
 	packet->divisor = divisor;
@@ -3769,7 +3769,7 @@ void vertexAttribP1ui(
 	GLboolean normalized,
 	GLuint value)
 {
-	RenderCommand_vertexAttribP1ui* __restrict packet = (RenderCommand_vertexAttribP1ui*)getNextPacket();
+	RenderCommand_vertexAttribP1ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribP1ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP1ui::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3782,7 +3782,7 @@ void vertexAttribP1uiv(
 	GLboolean normalized,
 	const GLuint *value)
 {
-	RenderCommand_vertexAttribP1uiv* __restrict packet = (RenderCommand_vertexAttribP1uiv*)getNextPacket();
+	RenderCommand_vertexAttribP1uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribP1uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP1uiv::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3795,7 +3795,7 @@ void vertexAttribP2ui(
 	GLboolean normalized,
 	GLuint value)
 {
-	RenderCommand_vertexAttribP2ui* __restrict packet = (RenderCommand_vertexAttribP2ui*)getNextPacket();
+	RenderCommand_vertexAttribP2ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribP2ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP2ui::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3808,7 +3808,7 @@ void vertexAttribP2uiv(
 	GLboolean normalized,
 	const GLuint *value)
 {
-	RenderCommand_vertexAttribP2uiv* __restrict packet = (RenderCommand_vertexAttribP2uiv*)getNextPacket();
+	RenderCommand_vertexAttribP2uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribP2uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP2uiv::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3821,7 +3821,7 @@ void vertexAttribP3ui(
 	GLboolean normalized,
 	GLuint value)
 {
-	RenderCommand_vertexAttribP3ui* __restrict packet = (RenderCommand_vertexAttribP3ui*)getNextPacket();
+	RenderCommand_vertexAttribP3ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribP3ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP3ui::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3834,7 +3834,7 @@ void vertexAttribP3uiv(
 	GLboolean normalized,
 	const GLuint *value)
 {
-	RenderCommand_vertexAttribP3uiv* __restrict packet = (RenderCommand_vertexAttribP3uiv*)getNextPacket();
+	RenderCommand_vertexAttribP3uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribP3uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP3uiv::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3847,7 +3847,7 @@ void vertexAttribP4ui(
 	GLboolean normalized,
 	GLuint value)
 {
-	RenderCommand_vertexAttribP4ui* __restrict packet = (RenderCommand_vertexAttribP4ui*)getNextPacket();
+	RenderCommand_vertexAttribP4ui* __restrict packet = allocatePacket<RenderCommand_vertexAttribP4ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP4ui::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3860,7 +3860,7 @@ void vertexAttribP4uiv(
 	GLboolean normalized,
 	const GLuint *value)
 {
-	RenderCommand_vertexAttribP4uiv* __restrict packet = (RenderCommand_vertexAttribP4uiv*)getNextPacket();
+	RenderCommand_vertexAttribP4uiv* __restrict packet = allocatePacket<RenderCommand_vertexAttribP4uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribP4uiv::execute);
 	packet->index = index;
 	packet->type = type;
@@ -3870,7 +3870,7 @@ void vertexAttribP4uiv(
 void minSampleShading(
 	GLfloat value)
 {
-	RenderCommand_minSampleShading* __restrict packet = (RenderCommand_minSampleShading*)getNextPacket();
+	RenderCommand_minSampleShading* __restrict packet = allocatePacket<RenderCommand_minSampleShading>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_minSampleShading::execute);
 	packet->value = value;
 }
@@ -3878,7 +3878,7 @@ void blendEquationi(
 	GLuint buf,
 	GLenum mode)
 {
-	RenderCommand_blendEquationi* __restrict packet = (RenderCommand_blendEquationi*)getNextPacket();
+	RenderCommand_blendEquationi* __restrict packet = allocatePacket<RenderCommand_blendEquationi>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquationi::execute);
 	packet->buf = buf;
 	packet->mode = mode;
@@ -3888,7 +3888,7 @@ void blendEquationSeparatei(
 	GLenum modeRGB,
 	GLenum modeAlpha)
 {
-	RenderCommand_blendEquationSeparatei* __restrict packet = (RenderCommand_blendEquationSeparatei*)getNextPacket();
+	RenderCommand_blendEquationSeparatei* __restrict packet = allocatePacket<RenderCommand_blendEquationSeparatei>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquationSeparatei::execute);
 	packet->buf = buf;
 	packet->modeRGB = modeRGB;
@@ -3899,7 +3899,7 @@ void blendFunci(
 	GLenum src,
 	GLenum dst)
 {
-	RenderCommand_blendFunci* __restrict packet = (RenderCommand_blendFunci*)getNextPacket();
+	RenderCommand_blendFunci* __restrict packet = allocatePacket<RenderCommand_blendFunci>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFunci::execute);
 	packet->buf = buf;
 	packet->src = src;
@@ -3912,7 +3912,7 @@ void blendFuncSeparatei(
 	GLenum srcAlpha,
 	GLenum dstAlpha)
 {
-	RenderCommand_blendFuncSeparatei* __restrict packet = (RenderCommand_blendFuncSeparatei*)getNextPacket();
+	RenderCommand_blendFuncSeparatei* __restrict packet = allocatePacket<RenderCommand_blendFuncSeparatei>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFuncSeparatei::execute);
 	packet->buf = buf;
 	packet->srcRGB = srcRGB;
@@ -3924,7 +3924,7 @@ void drawArraysIndirect(
 	GLenum mode,
 	const void *indirect)
 {
-	RenderCommand_drawArraysIndirect* __restrict packet = (RenderCommand_drawArraysIndirect*)getNextPacket();
+	RenderCommand_drawArraysIndirect* __restrict packet = allocatePacket<RenderCommand_drawArraysIndirect>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArraysIndirect::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -3934,7 +3934,7 @@ void drawElementsIndirect(
 	GLenum type,
 	const void *indirect)
 {
-	RenderCommand_drawElementsIndirect* __restrict packet = (RenderCommand_drawElementsIndirect*)getNextPacket();
+	RenderCommand_drawElementsIndirect* __restrict packet = allocatePacket<RenderCommand_drawElementsIndirect>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsIndirect::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -3944,7 +3944,7 @@ void uniform1d(
 	GLint location,
 	GLdouble x)
 {
-	RenderCommand_uniform1d* __restrict packet = (RenderCommand_uniform1d*)getNextPacket();
+	RenderCommand_uniform1d* __restrict packet = allocatePacket<RenderCommand_uniform1d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1d::execute);
 	packet->location = location;
 	packet->x = x;
@@ -3954,7 +3954,7 @@ void uniform2d(
 	GLdouble x,
 	GLdouble y)
 {
-	RenderCommand_uniform2d* __restrict packet = (RenderCommand_uniform2d*)getNextPacket();
+	RenderCommand_uniform2d* __restrict packet = allocatePacket<RenderCommand_uniform2d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2d::execute);
 	packet->location = location;
 	packet->x = x;
@@ -3966,7 +3966,7 @@ void uniform3d(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_uniform3d* __restrict packet = (RenderCommand_uniform3d*)getNextPacket();
+	RenderCommand_uniform3d* __restrict packet = allocatePacket<RenderCommand_uniform3d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3d::execute);
 	packet->location = location;
 	packet->x = x;
@@ -3980,7 +3980,7 @@ void uniform4d(
 	GLdouble z,
 	GLdouble w)
 {
-	RenderCommand_uniform4d* __restrict packet = (RenderCommand_uniform4d*)getNextPacket();
+	RenderCommand_uniform4d* __restrict packet = allocatePacket<RenderCommand_uniform4d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4d::execute);
 	packet->location = location;
 	packet->x = x;
@@ -3993,7 +3993,7 @@ void uniform1dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_uniform1dv* __restrict packet = (RenderCommand_uniform1dv*)getNextPacket();
+	RenderCommand_uniform1dv* __restrict packet = allocatePacket<RenderCommand_uniform1dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4004,7 +4004,7 @@ void uniform2dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_uniform2dv* __restrict packet = (RenderCommand_uniform2dv*)getNextPacket();
+	RenderCommand_uniform2dv* __restrict packet = allocatePacket<RenderCommand_uniform2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4015,7 +4015,7 @@ void uniform3dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_uniform3dv* __restrict packet = (RenderCommand_uniform3dv*)getNextPacket();
+	RenderCommand_uniform3dv* __restrict packet = allocatePacket<RenderCommand_uniform3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4026,7 +4026,7 @@ void uniform4dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_uniform4dv* __restrict packet = (RenderCommand_uniform4dv*)getNextPacket();
+	RenderCommand_uniform4dv* __restrict packet = allocatePacket<RenderCommand_uniform4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4038,7 +4038,7 @@ void uniformMatrix2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix2dv* __restrict packet = (RenderCommand_uniformMatrix2dv*)getNextPacket();
+	RenderCommand_uniformMatrix2dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4051,7 +4051,7 @@ void uniformMatrix3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix3dv* __restrict packet = (RenderCommand_uniformMatrix3dv*)getNextPacket();
+	RenderCommand_uniformMatrix3dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4064,7 +4064,7 @@ void uniformMatrix4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix4dv* __restrict packet = (RenderCommand_uniformMatrix4dv*)getNextPacket();
+	RenderCommand_uniformMatrix4dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4077,7 +4077,7 @@ void uniformMatrix2x3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix2x3dv* __restrict packet = (RenderCommand_uniformMatrix2x3dv*)getNextPacket();
+	RenderCommand_uniformMatrix2x3dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2x3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2x3dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4090,7 +4090,7 @@ void uniformMatrix2x4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix2x4dv* __restrict packet = (RenderCommand_uniformMatrix2x4dv*)getNextPacket();
+	RenderCommand_uniformMatrix2x4dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix2x4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix2x4dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4103,7 +4103,7 @@ void uniformMatrix3x2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix3x2dv* __restrict packet = (RenderCommand_uniformMatrix3x2dv*)getNextPacket();
+	RenderCommand_uniformMatrix3x2dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3x2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3x2dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4116,7 +4116,7 @@ void uniformMatrix3x4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix3x4dv* __restrict packet = (RenderCommand_uniformMatrix3x4dv*)getNextPacket();
+	RenderCommand_uniformMatrix3x4dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix3x4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix3x4dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4129,7 +4129,7 @@ void uniformMatrix4x2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix4x2dv* __restrict packet = (RenderCommand_uniformMatrix4x2dv*)getNextPacket();
+	RenderCommand_uniformMatrix4x2dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4x2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4x2dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4142,7 +4142,7 @@ void uniformMatrix4x3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_uniformMatrix4x3dv* __restrict packet = (RenderCommand_uniformMatrix4x3dv*)getNextPacket();
+	RenderCommand_uniformMatrix4x3dv* __restrict packet = allocatePacket<RenderCommand_uniformMatrix4x3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformMatrix4x3dv::execute);
 	packet->location = location;
 	packet->count = count;
@@ -4154,7 +4154,7 @@ void getUniformdv(
 	GLint location,
 	GLdouble *params)
 {
-	RenderCommand_getUniformdv* __restrict packet = (RenderCommand_getUniformdv*)getNextPacket();
+	RenderCommand_getUniformdv* __restrict packet = allocatePacket<RenderCommand_getUniformdv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformdv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4165,7 +4165,7 @@ GLint getSubroutineUniformLocation(
 	GLenum shadertype,
 	const GLchar *name)
 {
-	RenderCommand_getSubroutineUniformLocation* __restrict packet = (RenderCommand_getSubroutineUniformLocation*)getNextPacket();
+	RenderCommand_getSubroutineUniformLocation* __restrict packet = allocatePacket<RenderCommand_getSubroutineUniformLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSubroutineUniformLocation::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4176,7 +4176,7 @@ GLuint getSubroutineIndex(
 	GLenum shadertype,
 	const GLchar *name)
 {
-	RenderCommand_getSubroutineIndex* __restrict packet = (RenderCommand_getSubroutineIndex*)getNextPacket();
+	RenderCommand_getSubroutineIndex* __restrict packet = allocatePacket<RenderCommand_getSubroutineIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getSubroutineIndex::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4189,7 +4189,7 @@ void getActiveSubroutineUniformiv(
 	GLenum pname,
 	GLint *values)
 {
-	RenderCommand_getActiveSubroutineUniformiv* __restrict packet = (RenderCommand_getActiveSubroutineUniformiv*)getNextPacket();
+	RenderCommand_getActiveSubroutineUniformiv* __restrict packet = allocatePacket<RenderCommand_getActiveSubroutineUniformiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveSubroutineUniformiv::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4205,7 +4205,7 @@ void getActiveSubroutineUniformName(
 	GLsizei *length,
 	GLchar *name)
 {
-	RenderCommand_getActiveSubroutineUniformName* __restrict packet = (RenderCommand_getActiveSubroutineUniformName*)getNextPacket();
+	RenderCommand_getActiveSubroutineUniformName* __restrict packet = allocatePacket<RenderCommand_getActiveSubroutineUniformName>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveSubroutineUniformName::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4222,7 +4222,7 @@ void getActiveSubroutineName(
 	GLsizei *length,
 	GLchar *name)
 {
-	RenderCommand_getActiveSubroutineName* __restrict packet = (RenderCommand_getActiveSubroutineName*)getNextPacket();
+	RenderCommand_getActiveSubroutineName* __restrict packet = allocatePacket<RenderCommand_getActiveSubroutineName>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveSubroutineName::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4236,7 +4236,7 @@ void uniformSubroutinesuiv(
 	GLsizei count,
 	const GLuint *indices)
 {
-	RenderCommand_uniformSubroutinesuiv* __restrict packet = (RenderCommand_uniformSubroutinesuiv*)getNextPacket();
+	RenderCommand_uniformSubroutinesuiv* __restrict packet = allocatePacket<RenderCommand_uniformSubroutinesuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformSubroutinesuiv::execute);
 	packet->shadertype = shadertype;
 	packet->count = count;
@@ -4247,7 +4247,7 @@ void getUniformSubroutineuiv(
 	GLint location,
 	GLuint *params)
 {
-	RenderCommand_getUniformSubroutineuiv* __restrict packet = (RenderCommand_getUniformSubroutineuiv*)getNextPacket();
+	RenderCommand_getUniformSubroutineuiv* __restrict packet = allocatePacket<RenderCommand_getUniformSubroutineuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformSubroutineuiv::execute);
 	packet->shadertype = shadertype;
 	packet->location = location;
@@ -4259,7 +4259,7 @@ void getProgramStageiv(
 	GLenum pname,
 	GLint *values)
 {
-	RenderCommand_getProgramStageiv* __restrict packet = (RenderCommand_getProgramStageiv*)getNextPacket();
+	RenderCommand_getProgramStageiv* __restrict packet = allocatePacket<RenderCommand_getProgramStageiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramStageiv::execute);
 	packet->program = program;
 	packet->shadertype = shadertype;
@@ -4270,7 +4270,7 @@ void patchParameteri(
 	GLenum pname,
 	GLint value)
 {
-	RenderCommand_patchParameteri* __restrict packet = (RenderCommand_patchParameteri*)getNextPacket();
+	RenderCommand_patchParameteri* __restrict packet = allocatePacket<RenderCommand_patchParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_patchParameteri::execute);
 	packet->pname = pname;
 	packet->value = value;
@@ -4279,7 +4279,7 @@ void patchParameterfv(
 	GLenum pname,
 	const GLfloat *values)
 {
-	RenderCommand_patchParameterfv* __restrict packet = (RenderCommand_patchParameterfv*)getNextPacket();
+	RenderCommand_patchParameterfv* __restrict packet = allocatePacket<RenderCommand_patchParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_patchParameterfv::execute);
 	packet->pname = pname;
 	packet->values = values;
@@ -4288,7 +4288,7 @@ void bindTransformFeedback(
 	GLenum target,
 	GLuint id)
 {
-	RenderCommand_bindTransformFeedback* __restrict packet = (RenderCommand_bindTransformFeedback*)getNextPacket();
+	RenderCommand_bindTransformFeedback* __restrict packet = allocatePacket<RenderCommand_bindTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindTransformFeedback::execute);
 	packet->target = target;
 	packet->id = id;
@@ -4297,7 +4297,7 @@ void deleteTransformFeedbacks(
 	GLsizei n,
 	const GLuint *ids)
 {
-	RenderCommand_deleteTransformFeedbacks* __restrict packet = (RenderCommand_deleteTransformFeedbacks*)getNextPacket();
+	RenderCommand_deleteTransformFeedbacks* __restrict packet = allocatePacket<RenderCommand_deleteTransformFeedbacks>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteTransformFeedbacks::execute);
 	packet->n = n;
 	packet->ids = ids;
@@ -4306,7 +4306,7 @@ void genTransformFeedbacks(
 	GLsizei n,
 	GLuint *ids)
 {
-	RenderCommand_genTransformFeedbacks* __restrict packet = (RenderCommand_genTransformFeedbacks*)getNextPacket();
+	RenderCommand_genTransformFeedbacks* __restrict packet = allocatePacket<RenderCommand_genTransformFeedbacks>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genTransformFeedbacks::execute);
 	packet->n = n;
 	packet->ids = ids;
@@ -4314,27 +4314,27 @@ void genTransformFeedbacks(
 GLboolean isTransformFeedback(
 	GLuint id)
 {
-	RenderCommand_isTransformFeedback* __restrict packet = (RenderCommand_isTransformFeedback*)getNextPacket();
+	RenderCommand_isTransformFeedback* __restrict packet = allocatePacket<RenderCommand_isTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isTransformFeedback::execute);
 	packet->id = id;
 }
 void pauseTransformFeedback(
 	void)
 {
-	RenderCommand_pauseTransformFeedback* __restrict packet = (RenderCommand_pauseTransformFeedback*)getNextPacket();
+	RenderCommand_pauseTransformFeedback* __restrict packet = allocatePacket<RenderCommand_pauseTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pauseTransformFeedback::execute);
 }
 void resumeTransformFeedback(
 	void)
 {
-	RenderCommand_resumeTransformFeedback* __restrict packet = (RenderCommand_resumeTransformFeedback*)getNextPacket();
+	RenderCommand_resumeTransformFeedback* __restrict packet = allocatePacket<RenderCommand_resumeTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_resumeTransformFeedback::execute);
 }
 void drawTransformFeedback(
 	GLenum mode,
 	GLuint id)
 {
-	RenderCommand_drawTransformFeedback* __restrict packet = (RenderCommand_drawTransformFeedback*)getNextPacket();
+	RenderCommand_drawTransformFeedback* __restrict packet = allocatePacket<RenderCommand_drawTransformFeedback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawTransformFeedback::execute);
 	packet->mode = mode;
 	packet->id = id;
@@ -4344,7 +4344,7 @@ void drawTransformFeedbackStream(
 	GLuint id,
 	GLuint stream)
 {
-	RenderCommand_drawTransformFeedbackStream* __restrict packet = (RenderCommand_drawTransformFeedbackStream*)getNextPacket();
+	RenderCommand_drawTransformFeedbackStream* __restrict packet = allocatePacket<RenderCommand_drawTransformFeedbackStream>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawTransformFeedbackStream::execute);
 	packet->mode = mode;
 	packet->id = id;
@@ -4355,7 +4355,7 @@ void beginQueryIndexed(
 	GLuint index,
 	GLuint id)
 {
-	RenderCommand_beginQueryIndexed* __restrict packet = (RenderCommand_beginQueryIndexed*)getNextPacket();
+	RenderCommand_beginQueryIndexed* __restrict packet = allocatePacket<RenderCommand_beginQueryIndexed>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginQueryIndexed::execute);
 	packet->target = target;
 	packet->index = index;
@@ -4365,7 +4365,7 @@ void endQueryIndexed(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_endQueryIndexed* __restrict packet = (RenderCommand_endQueryIndexed*)getNextPacket();
+	RenderCommand_endQueryIndexed* __restrict packet = allocatePacket<RenderCommand_endQueryIndexed>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endQueryIndexed::execute);
 	packet->target = target;
 	packet->index = index;
@@ -4376,7 +4376,7 @@ void getQueryIndexediv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getQueryIndexediv* __restrict packet = (RenderCommand_getQueryIndexediv*)getNextPacket();
+	RenderCommand_getQueryIndexediv* __restrict packet = allocatePacket<RenderCommand_getQueryIndexediv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryIndexediv::execute);
 	packet->target = target;
 	packet->index = index;
@@ -4386,7 +4386,7 @@ void getQueryIndexediv(
 void releaseShaderCompiler(
 	void)
 {
-	RenderCommand_releaseShaderCompiler* __restrict packet = (RenderCommand_releaseShaderCompiler*)getNextPacket();
+	RenderCommand_releaseShaderCompiler* __restrict packet = allocatePacket<RenderCommand_releaseShaderCompiler>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_releaseShaderCompiler::execute);
 }
 void shaderBinary(
@@ -4396,7 +4396,7 @@ void shaderBinary(
 	const void *binary,
 	GLsizei length)
 {
-	RenderCommand_shaderBinary* __restrict packet = (RenderCommand_shaderBinary*)getNextPacket();
+	RenderCommand_shaderBinary* __restrict packet = allocatePacket<RenderCommand_shaderBinary>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shaderBinary::execute);
 	packet->count = count;
 	packet->shaders = shaders;
@@ -4410,7 +4410,7 @@ void getShaderPrecisionFormat(
 	GLint *range,
 	GLint *precision)
 {
-	RenderCommand_getShaderPrecisionFormat* __restrict packet = (RenderCommand_getShaderPrecisionFormat*)getNextPacket();
+	RenderCommand_getShaderPrecisionFormat* __restrict packet = allocatePacket<RenderCommand_getShaderPrecisionFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShaderPrecisionFormat::execute);
 	packet->shadertype = shadertype;
 	packet->precisiontype = precisiontype;
@@ -4421,7 +4421,7 @@ void depthRangef(
 	GLfloat n,
 	GLfloat f)
 {
-	RenderCommand_depthRangef* __restrict packet = (RenderCommand_depthRangef*)getNextPacket();
+	RenderCommand_depthRangef* __restrict packet = allocatePacket<RenderCommand_depthRangef>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthRangef::execute);
 	packet->n = n;
 	packet->f = f;
@@ -4429,7 +4429,7 @@ void depthRangef(
 void clearDepthf(
 	GLfloat d)
 {
-	RenderCommand_clearDepthf* __restrict packet = (RenderCommand_clearDepthf*)getNextPacket();
+	RenderCommand_clearDepthf* __restrict packet = allocatePacket<RenderCommand_clearDepthf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearDepthf::execute);
 	packet->d = d;
 }
@@ -4440,7 +4440,7 @@ void getProgramBinary(
 	GLenum *binaryFormat,
 	void *binary)
 {
-	RenderCommand_getProgramBinary* __restrict packet = (RenderCommand_getProgramBinary*)getNextPacket();
+	RenderCommand_getProgramBinary* __restrict packet = allocatePacket<RenderCommand_getProgramBinary>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramBinary::execute);
 	packet->program = program;
 	packet->bufSize = bufSize;
@@ -4454,7 +4454,7 @@ void programBinary(
 	const void *binary,
 	GLsizei length)
 {
-	RenderCommand_programBinary* __restrict packet = (RenderCommand_programBinary*)getNextPacket();
+	RenderCommand_programBinary* __restrict packet = allocatePacket<RenderCommand_programBinary>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programBinary::execute);
 	packet->program = program;
 	packet->binaryFormat = binaryFormat;
@@ -4466,7 +4466,7 @@ void programParameteri(
 	GLenum pname,
 	GLint value)
 {
-	RenderCommand_programParameteri* __restrict packet = (RenderCommand_programParameteri*)getNextPacket();
+	RenderCommand_programParameteri* __restrict packet = allocatePacket<RenderCommand_programParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programParameteri::execute);
 	packet->program = program;
 	packet->pname = pname;
@@ -4477,7 +4477,7 @@ void useProgramStages(
 	GLbitfield stages,
 	GLuint program)
 {
-	RenderCommand_useProgramStages* __restrict packet = (RenderCommand_useProgramStages*)getNextPacket();
+	RenderCommand_useProgramStages* __restrict packet = allocatePacket<RenderCommand_useProgramStages>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_useProgramStages::execute);
 	packet->pipeline = pipeline;
 	packet->stages = stages;
@@ -4487,7 +4487,7 @@ void activeShaderProgram(
 	GLuint pipeline,
 	GLuint program)
 {
-	RenderCommand_activeShaderProgram* __restrict packet = (RenderCommand_activeShaderProgram*)getNextPacket();
+	RenderCommand_activeShaderProgram* __restrict packet = allocatePacket<RenderCommand_activeShaderProgram>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_activeShaderProgram::execute);
 	packet->pipeline = pipeline;
 	packet->program = program;
@@ -4497,7 +4497,7 @@ GLuint createShaderProgramv(
 	GLsizei count,
 	const GLchar *const*strings)
 {
-	RenderCommand_createShaderProgramv* __restrict packet = (RenderCommand_createShaderProgramv*)getNextPacket();
+	RenderCommand_createShaderProgramv* __restrict packet = allocatePacket<RenderCommand_createShaderProgramv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createShaderProgramv::execute);
 	packet->type = type;
 	packet->count = count;
@@ -4506,7 +4506,7 @@ GLuint createShaderProgramv(
 void bindProgramPipeline(
 	GLuint pipeline)
 {
-	RenderCommand_bindProgramPipeline* __restrict packet = (RenderCommand_bindProgramPipeline*)getNextPacket();
+	RenderCommand_bindProgramPipeline* __restrict packet = allocatePacket<RenderCommand_bindProgramPipeline>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindProgramPipeline::execute);
 	packet->pipeline = pipeline;
 }
@@ -4514,7 +4514,7 @@ void deleteProgramPipelines(
 	GLsizei n,
 	const GLuint *pipelines)
 {
-	RenderCommand_deleteProgramPipelines* __restrict packet = (RenderCommand_deleteProgramPipelines*)getNextPacket();
+	RenderCommand_deleteProgramPipelines* __restrict packet = allocatePacket<RenderCommand_deleteProgramPipelines>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteProgramPipelines::execute);
 	packet->n = n;
 	packet->pipelines = pipelines;
@@ -4523,7 +4523,7 @@ void genProgramPipelines(
 	GLsizei n,
 	GLuint *pipelines)
 {
-	RenderCommand_genProgramPipelines* __restrict packet = (RenderCommand_genProgramPipelines*)getNextPacket();
+	RenderCommand_genProgramPipelines* __restrict packet = allocatePacket<RenderCommand_genProgramPipelines>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genProgramPipelines::execute);
 	packet->n = n;
 	packet->pipelines = pipelines;
@@ -4531,7 +4531,7 @@ void genProgramPipelines(
 GLboolean isProgramPipeline(
 	GLuint pipeline)
 {
-	RenderCommand_isProgramPipeline* __restrict packet = (RenderCommand_isProgramPipeline*)getNextPacket();
+	RenderCommand_isProgramPipeline* __restrict packet = allocatePacket<RenderCommand_isProgramPipeline>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isProgramPipeline::execute);
 	packet->pipeline = pipeline;
 }
@@ -4540,7 +4540,7 @@ void getProgramPipelineiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getProgramPipelineiv* __restrict packet = (RenderCommand_getProgramPipelineiv*)getNextPacket();
+	RenderCommand_getProgramPipelineiv* __restrict packet = allocatePacket<RenderCommand_getProgramPipelineiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramPipelineiv::execute);
 	packet->pipeline = pipeline;
 	packet->pname = pname;
@@ -4551,7 +4551,7 @@ void programUniform1i(
 	GLint location,
 	GLint v0)
 {
-	RenderCommand_programUniform1i* __restrict packet = (RenderCommand_programUniform1i*)getNextPacket();
+	RenderCommand_programUniform1i* __restrict packet = allocatePacket<RenderCommand_programUniform1i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1i::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4563,7 +4563,7 @@ void programUniform1iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform1iv* __restrict packet = (RenderCommand_programUniform1iv*)getNextPacket();
+	RenderCommand_programUniform1iv* __restrict packet = allocatePacket<RenderCommand_programUniform1iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1iv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4575,7 +4575,7 @@ void programUniform1f(
 	GLint location,
 	GLfloat v0)
 {
-	RenderCommand_programUniform1f* __restrict packet = (RenderCommand_programUniform1f*)getNextPacket();
+	RenderCommand_programUniform1f* __restrict packet = allocatePacket<RenderCommand_programUniform1f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1f::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4587,7 +4587,7 @@ void programUniform1fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform1fv* __restrict packet = (RenderCommand_programUniform1fv*)getNextPacket();
+	RenderCommand_programUniform1fv* __restrict packet = allocatePacket<RenderCommand_programUniform1fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4599,7 +4599,7 @@ void programUniform1d(
 	GLint location,
 	GLdouble v0)
 {
-	RenderCommand_programUniform1d* __restrict packet = (RenderCommand_programUniform1d*)getNextPacket();
+	RenderCommand_programUniform1d* __restrict packet = allocatePacket<RenderCommand_programUniform1d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1d::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4611,7 +4611,7 @@ void programUniform1dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform1dv* __restrict packet = (RenderCommand_programUniform1dv*)getNextPacket();
+	RenderCommand_programUniform1dv* __restrict packet = allocatePacket<RenderCommand_programUniform1dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4623,7 +4623,7 @@ void programUniform1ui(
 	GLint location,
 	GLuint v0)
 {
-	RenderCommand_programUniform1ui* __restrict packet = (RenderCommand_programUniform1ui*)getNextPacket();
+	RenderCommand_programUniform1ui* __restrict packet = allocatePacket<RenderCommand_programUniform1ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ui::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4635,7 +4635,7 @@ void programUniform1uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform1uiv* __restrict packet = (RenderCommand_programUniform1uiv*)getNextPacket();
+	RenderCommand_programUniform1uiv* __restrict packet = allocatePacket<RenderCommand_programUniform1uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1uiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4648,7 +4648,7 @@ void programUniform2i(
 	GLint v0,
 	GLint v1)
 {
-	RenderCommand_programUniform2i* __restrict packet = (RenderCommand_programUniform2i*)getNextPacket();
+	RenderCommand_programUniform2i* __restrict packet = allocatePacket<RenderCommand_programUniform2i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2i::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4661,7 +4661,7 @@ void programUniform2iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform2iv* __restrict packet = (RenderCommand_programUniform2iv*)getNextPacket();
+	RenderCommand_programUniform2iv* __restrict packet = allocatePacket<RenderCommand_programUniform2iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2iv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4674,7 +4674,7 @@ void programUniform2f(
 	GLfloat v0,
 	GLfloat v1)
 {
-	RenderCommand_programUniform2f* __restrict packet = (RenderCommand_programUniform2f*)getNextPacket();
+	RenderCommand_programUniform2f* __restrict packet = allocatePacket<RenderCommand_programUniform2f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2f::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4687,7 +4687,7 @@ void programUniform2fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform2fv* __restrict packet = (RenderCommand_programUniform2fv*)getNextPacket();
+	RenderCommand_programUniform2fv* __restrict packet = allocatePacket<RenderCommand_programUniform2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4700,7 +4700,7 @@ void programUniform2d(
 	GLdouble v0,
 	GLdouble v1)
 {
-	RenderCommand_programUniform2d* __restrict packet = (RenderCommand_programUniform2d*)getNextPacket();
+	RenderCommand_programUniform2d* __restrict packet = allocatePacket<RenderCommand_programUniform2d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2d::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4713,7 +4713,7 @@ void programUniform2dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform2dv* __restrict packet = (RenderCommand_programUniform2dv*)getNextPacket();
+	RenderCommand_programUniform2dv* __restrict packet = allocatePacket<RenderCommand_programUniform2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4726,7 +4726,7 @@ void programUniform2ui(
 	GLuint v0,
 	GLuint v1)
 {
-	RenderCommand_programUniform2ui* __restrict packet = (RenderCommand_programUniform2ui*)getNextPacket();
+	RenderCommand_programUniform2ui* __restrict packet = allocatePacket<RenderCommand_programUniform2ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ui::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4739,7 +4739,7 @@ void programUniform2uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform2uiv* __restrict packet = (RenderCommand_programUniform2uiv*)getNextPacket();
+	RenderCommand_programUniform2uiv* __restrict packet = allocatePacket<RenderCommand_programUniform2uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2uiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4753,7 +4753,7 @@ void programUniform3i(
 	GLint v1,
 	GLint v2)
 {
-	RenderCommand_programUniform3i* __restrict packet = (RenderCommand_programUniform3i*)getNextPacket();
+	RenderCommand_programUniform3i* __restrict packet = allocatePacket<RenderCommand_programUniform3i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3i::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4767,7 +4767,7 @@ void programUniform3iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform3iv* __restrict packet = (RenderCommand_programUniform3iv*)getNextPacket();
+	RenderCommand_programUniform3iv* __restrict packet = allocatePacket<RenderCommand_programUniform3iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3iv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4781,7 +4781,7 @@ void programUniform3f(
 	GLfloat v1,
 	GLfloat v2)
 {
-	RenderCommand_programUniform3f* __restrict packet = (RenderCommand_programUniform3f*)getNextPacket();
+	RenderCommand_programUniform3f* __restrict packet = allocatePacket<RenderCommand_programUniform3f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3f::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4795,7 +4795,7 @@ void programUniform3fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform3fv* __restrict packet = (RenderCommand_programUniform3fv*)getNextPacket();
+	RenderCommand_programUniform3fv* __restrict packet = allocatePacket<RenderCommand_programUniform3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4809,7 +4809,7 @@ void programUniform3d(
 	GLdouble v1,
 	GLdouble v2)
 {
-	RenderCommand_programUniform3d* __restrict packet = (RenderCommand_programUniform3d*)getNextPacket();
+	RenderCommand_programUniform3d* __restrict packet = allocatePacket<RenderCommand_programUniform3d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3d::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4823,7 +4823,7 @@ void programUniform3dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform3dv* __restrict packet = (RenderCommand_programUniform3dv*)getNextPacket();
+	RenderCommand_programUniform3dv* __restrict packet = allocatePacket<RenderCommand_programUniform3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4837,7 +4837,7 @@ void programUniform3ui(
 	GLuint v1,
 	GLuint v2)
 {
-	RenderCommand_programUniform3ui* __restrict packet = (RenderCommand_programUniform3ui*)getNextPacket();
+	RenderCommand_programUniform3ui* __restrict packet = allocatePacket<RenderCommand_programUniform3ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ui::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4851,7 +4851,7 @@ void programUniform3uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform3uiv* __restrict packet = (RenderCommand_programUniform3uiv*)getNextPacket();
+	RenderCommand_programUniform3uiv* __restrict packet = allocatePacket<RenderCommand_programUniform3uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3uiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4866,7 +4866,7 @@ void programUniform4i(
 	GLint v2,
 	GLint v3)
 {
-	RenderCommand_programUniform4i* __restrict packet = (RenderCommand_programUniform4i*)getNextPacket();
+	RenderCommand_programUniform4i* __restrict packet = allocatePacket<RenderCommand_programUniform4i>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4i::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4881,7 +4881,7 @@ void programUniform4iv(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform4iv* __restrict packet = (RenderCommand_programUniform4iv*)getNextPacket();
+	RenderCommand_programUniform4iv* __restrict packet = allocatePacket<RenderCommand_programUniform4iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4iv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4896,7 +4896,7 @@ void programUniform4f(
 	GLfloat v2,
 	GLfloat v3)
 {
-	RenderCommand_programUniform4f* __restrict packet = (RenderCommand_programUniform4f*)getNextPacket();
+	RenderCommand_programUniform4f* __restrict packet = allocatePacket<RenderCommand_programUniform4f>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4f::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4911,7 +4911,7 @@ void programUniform4fv(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform4fv* __restrict packet = (RenderCommand_programUniform4fv*)getNextPacket();
+	RenderCommand_programUniform4fv* __restrict packet = allocatePacket<RenderCommand_programUniform4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4926,7 +4926,7 @@ void programUniform4d(
 	GLdouble v2,
 	GLdouble v3)
 {
-	RenderCommand_programUniform4d* __restrict packet = (RenderCommand_programUniform4d*)getNextPacket();
+	RenderCommand_programUniform4d* __restrict packet = allocatePacket<RenderCommand_programUniform4d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4d::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4941,7 +4941,7 @@ void programUniform4dv(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform4dv* __restrict packet = (RenderCommand_programUniform4dv*)getNextPacket();
+	RenderCommand_programUniform4dv* __restrict packet = allocatePacket<RenderCommand_programUniform4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4956,7 +4956,7 @@ void programUniform4ui(
 	GLuint v2,
 	GLuint v3)
 {
-	RenderCommand_programUniform4ui* __restrict packet = (RenderCommand_programUniform4ui*)getNextPacket();
+	RenderCommand_programUniform4ui* __restrict packet = allocatePacket<RenderCommand_programUniform4ui>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ui::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4971,7 +4971,7 @@ void programUniform4uiv(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform4uiv* __restrict packet = (RenderCommand_programUniform4uiv*)getNextPacket();
+	RenderCommand_programUniform4uiv* __restrict packet = allocatePacket<RenderCommand_programUniform4uiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4uiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -4985,7 +4985,7 @@ void programUniformMatrix2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2fv* __restrict packet = (RenderCommand_programUniformMatrix2fv*)getNextPacket();
+	RenderCommand_programUniformMatrix2fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5000,7 +5000,7 @@ void programUniformMatrix3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3fv* __restrict packet = (RenderCommand_programUniformMatrix3fv*)getNextPacket();
+	RenderCommand_programUniformMatrix3fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5015,7 +5015,7 @@ void programUniformMatrix4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4fv* __restrict packet = (RenderCommand_programUniformMatrix4fv*)getNextPacket();
+	RenderCommand_programUniformMatrix4fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5030,7 +5030,7 @@ void programUniformMatrix2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2dv* __restrict packet = (RenderCommand_programUniformMatrix2dv*)getNextPacket();
+	RenderCommand_programUniformMatrix2dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5045,7 +5045,7 @@ void programUniformMatrix3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3dv* __restrict packet = (RenderCommand_programUniformMatrix3dv*)getNextPacket();
+	RenderCommand_programUniformMatrix3dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5060,7 +5060,7 @@ void programUniformMatrix4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4dv* __restrict packet = (RenderCommand_programUniformMatrix4dv*)getNextPacket();
+	RenderCommand_programUniformMatrix4dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5075,7 +5075,7 @@ void programUniformMatrix2x3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2x3fv* __restrict packet = (RenderCommand_programUniformMatrix2x3fv*)getNextPacket();
+	RenderCommand_programUniformMatrix2x3fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x3fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5090,7 +5090,7 @@ void programUniformMatrix3x2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3x2fv* __restrict packet = (RenderCommand_programUniformMatrix3x2fv*)getNextPacket();
+	RenderCommand_programUniformMatrix3x2fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x2fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5105,7 +5105,7 @@ void programUniformMatrix2x4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2x4fv* __restrict packet = (RenderCommand_programUniformMatrix2x4fv*)getNextPacket();
+	RenderCommand_programUniformMatrix2x4fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x4fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5120,7 +5120,7 @@ void programUniformMatrix4x2fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4x2fv* __restrict packet = (RenderCommand_programUniformMatrix4x2fv*)getNextPacket();
+	RenderCommand_programUniformMatrix4x2fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x2fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x2fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5135,7 +5135,7 @@ void programUniformMatrix3x4fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3x4fv* __restrict packet = (RenderCommand_programUniformMatrix3x4fv*)getNextPacket();
+	RenderCommand_programUniformMatrix3x4fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x4fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x4fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5150,7 +5150,7 @@ void programUniformMatrix4x3fv(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4x3fv* __restrict packet = (RenderCommand_programUniformMatrix4x3fv*)getNextPacket();
+	RenderCommand_programUniformMatrix4x3fv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x3fv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x3fv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5165,7 +5165,7 @@ void programUniformMatrix2x3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2x3dv* __restrict packet = (RenderCommand_programUniformMatrix2x3dv*)getNextPacket();
+	RenderCommand_programUniformMatrix2x3dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x3dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5180,7 +5180,7 @@ void programUniformMatrix3x2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3x2dv* __restrict packet = (RenderCommand_programUniformMatrix3x2dv*)getNextPacket();
+	RenderCommand_programUniformMatrix3x2dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x2dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5195,7 +5195,7 @@ void programUniformMatrix2x4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2x4dv* __restrict packet = (RenderCommand_programUniformMatrix2x4dv*)getNextPacket();
+	RenderCommand_programUniformMatrix2x4dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x4dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5210,7 +5210,7 @@ void programUniformMatrix4x2dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4x2dv* __restrict packet = (RenderCommand_programUniformMatrix4x2dv*)getNextPacket();
+	RenderCommand_programUniformMatrix4x2dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x2dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5225,7 +5225,7 @@ void programUniformMatrix3x4dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3x4dv* __restrict packet = (RenderCommand_programUniformMatrix3x4dv*)getNextPacket();
+	RenderCommand_programUniformMatrix3x4dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x4dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5240,7 +5240,7 @@ void programUniformMatrix4x3dv(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4x3dv* __restrict packet = (RenderCommand_programUniformMatrix4x3dv*)getNextPacket();
+	RenderCommand_programUniformMatrix4x3dv* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x3dv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -5251,7 +5251,7 @@ void programUniformMatrix4x3dv(
 void validateProgramPipeline(
 	GLuint pipeline)
 {
-	RenderCommand_validateProgramPipeline* __restrict packet = (RenderCommand_validateProgramPipeline*)getNextPacket();
+	RenderCommand_validateProgramPipeline* __restrict packet = allocatePacket<RenderCommand_validateProgramPipeline>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_validateProgramPipeline::execute);
 	packet->pipeline = pipeline;
 }
@@ -5261,7 +5261,7 @@ void getProgramPipelineInfoLog(
 	GLsizei *length,
 	GLchar *infoLog)
 {
-	RenderCommand_getProgramPipelineInfoLog* __restrict packet = (RenderCommand_getProgramPipelineInfoLog*)getNextPacket();
+	RenderCommand_getProgramPipelineInfoLog* __restrict packet = allocatePacket<RenderCommand_getProgramPipelineInfoLog>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramPipelineInfoLog::execute);
 	packet->pipeline = pipeline;
 	packet->bufSize = bufSize;
@@ -5272,7 +5272,7 @@ void vertexAttribL1d(
 	GLuint index,
 	GLdouble x)
 {
-	RenderCommand_vertexAttribL1d* __restrict packet = (RenderCommand_vertexAttribL1d*)getNextPacket();
+	RenderCommand_vertexAttribL1d* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -5282,7 +5282,7 @@ void vertexAttribL2d(
 	GLdouble x,
 	GLdouble y)
 {
-	RenderCommand_vertexAttribL2d* __restrict packet = (RenderCommand_vertexAttribL2d*)getNextPacket();
+	RenderCommand_vertexAttribL2d* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -5294,7 +5294,7 @@ void vertexAttribL3d(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_vertexAttribL3d* __restrict packet = (RenderCommand_vertexAttribL3d*)getNextPacket();
+	RenderCommand_vertexAttribL3d* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -5308,7 +5308,7 @@ void vertexAttribL4d(
 	GLdouble z,
 	GLdouble w)
 {
-	RenderCommand_vertexAttribL4d* __restrict packet = (RenderCommand_vertexAttribL4d*)getNextPacket();
+	RenderCommand_vertexAttribL4d* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4d>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4d::execute);
 	packet->index = index;
 	packet->x = x;
@@ -5320,7 +5320,7 @@ void vertexAttribL1dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttribL1dv* __restrict packet = (RenderCommand_vertexAttribL1dv*)getNextPacket();
+	RenderCommand_vertexAttribL1dv* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5329,7 +5329,7 @@ void vertexAttribL2dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttribL2dv* __restrict packet = (RenderCommand_vertexAttribL2dv*)getNextPacket();
+	RenderCommand_vertexAttribL2dv* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5338,7 +5338,7 @@ void vertexAttribL3dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttribL3dv* __restrict packet = (RenderCommand_vertexAttribL3dv*)getNextPacket();
+	RenderCommand_vertexAttribL3dv* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5347,7 +5347,7 @@ void vertexAttribL4dv(
 	GLuint index,
 	const GLdouble *v)
 {
-	RenderCommand_vertexAttribL4dv* __restrict packet = (RenderCommand_vertexAttribL4dv*)getNextPacket();
+	RenderCommand_vertexAttribL4dv* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4dv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4dv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5359,7 +5359,7 @@ void vertexAttribLPointer(
 	GLsizei stride,
 	const void *pointer)
 {
-	RenderCommand_vertexAttribLPointer* __restrict packet = (RenderCommand_vertexAttribLPointer*)getNextPacket();
+	RenderCommand_vertexAttribLPointer* __restrict packet = allocatePacket<RenderCommand_vertexAttribLPointer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribLPointer::execute);
 	packet->index = index;
 	packet->size = size;
@@ -5372,7 +5372,7 @@ void getVertexAttribLdv(
 	GLenum pname,
 	GLdouble *params)
 {
-	RenderCommand_getVertexAttribLdv* __restrict packet = (RenderCommand_getVertexAttribLdv*)getNextPacket();
+	RenderCommand_getVertexAttribLdv* __restrict packet = allocatePacket<RenderCommand_getVertexAttribLdv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribLdv::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -5383,7 +5383,7 @@ void viewportArrayv(
 	GLsizei count,
 	const GLfloat *v)
 {
-	RenderCommand_viewportArrayv* __restrict packet = (RenderCommand_viewportArrayv*)getNextPacket();
+	RenderCommand_viewportArrayv* __restrict packet = allocatePacket<RenderCommand_viewportArrayv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewportArrayv::execute);
 	packet->first = first;
 	packet->count = count;
@@ -5396,7 +5396,7 @@ void viewportIndexedf(
 	GLfloat w,
 	GLfloat h)
 {
-	RenderCommand_viewportIndexedf* __restrict packet = (RenderCommand_viewportIndexedf*)getNextPacket();
+	RenderCommand_viewportIndexedf* __restrict packet = allocatePacket<RenderCommand_viewportIndexedf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewportIndexedf::execute);
 	packet->index = index;
 	packet->x = x;
@@ -5408,7 +5408,7 @@ void viewportIndexedfv(
 	GLuint index,
 	const GLfloat *v)
 {
-	RenderCommand_viewportIndexedfv* __restrict packet = (RenderCommand_viewportIndexedfv*)getNextPacket();
+	RenderCommand_viewportIndexedfv* __restrict packet = allocatePacket<RenderCommand_viewportIndexedfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewportIndexedfv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5418,7 +5418,7 @@ void scissorArrayv(
 	GLsizei count,
 	const GLint *v)
 {
-	RenderCommand_scissorArrayv* __restrict packet = (RenderCommand_scissorArrayv*)getNextPacket();
+	RenderCommand_scissorArrayv* __restrict packet = allocatePacket<RenderCommand_scissorArrayv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissorArrayv::execute);
 	packet->first = first;
 	packet->count = count;
@@ -5431,7 +5431,7 @@ void scissorIndexed(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_scissorIndexed* __restrict packet = (RenderCommand_scissorIndexed*)getNextPacket();
+	RenderCommand_scissorIndexed* __restrict packet = allocatePacket<RenderCommand_scissorIndexed>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissorIndexed::execute);
 	packet->index = index;
 	packet->left = left;
@@ -5443,7 +5443,7 @@ void scissorIndexedv(
 	GLuint index,
 	const GLint *v)
 {
-	RenderCommand_scissorIndexedv* __restrict packet = (RenderCommand_scissorIndexedv*)getNextPacket();
+	RenderCommand_scissorIndexedv* __restrict packet = allocatePacket<RenderCommand_scissorIndexedv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissorIndexedv::execute);
 	packet->index = index;
 	packet->v = v;
@@ -5453,7 +5453,7 @@ void depthRangeArrayv(
 	GLsizei count,
 	const GLdouble *v)
 {
-	RenderCommand_depthRangeArrayv* __restrict packet = (RenderCommand_depthRangeArrayv*)getNextPacket();
+	RenderCommand_depthRangeArrayv* __restrict packet = allocatePacket<RenderCommand_depthRangeArrayv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthRangeArrayv::execute);
 	packet->first = first;
 	packet->count = count;
@@ -5464,7 +5464,7 @@ void depthRangeIndexed(
 	GLdouble n,
 	GLdouble f)
 {
-	RenderCommand_depthRangeIndexed* __restrict packet = (RenderCommand_depthRangeIndexed*)getNextPacket();
+	RenderCommand_depthRangeIndexed* __restrict packet = allocatePacket<RenderCommand_depthRangeIndexed>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_depthRangeIndexed::execute);
 	packet->index = index;
 	packet->n = n;
@@ -5475,7 +5475,7 @@ void getFloati_v(
 	GLuint index,
 	GLfloat *data)
 {
-	RenderCommand_getFloati_v* __restrict packet = (RenderCommand_getFloati_v*)getNextPacket();
+	RenderCommand_getFloati_v* __restrict packet = allocatePacket<RenderCommand_getFloati_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFloati_v::execute);
 	packet->target = target;
 	packet->index = index;
@@ -5486,7 +5486,7 @@ void getDoublei_v(
 	GLuint index,
 	GLdouble *data)
 {
-	RenderCommand_getDoublei_v* __restrict packet = (RenderCommand_getDoublei_v*)getNextPacket();
+	RenderCommand_getDoublei_v* __restrict packet = allocatePacket<RenderCommand_getDoublei_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDoublei_v::execute);
 	packet->target = target;
 	packet->index = index;
@@ -5499,7 +5499,7 @@ void drawArraysInstancedBaseInstance(
 	GLsizei instancecount,
 	GLuint baseinstance)
 {
-	RenderCommand_drawArraysInstancedBaseInstance* __restrict packet = (RenderCommand_drawArraysInstancedBaseInstance*)getNextPacket();
+	RenderCommand_drawArraysInstancedBaseInstance* __restrict packet = allocatePacket<RenderCommand_drawArraysInstancedBaseInstance>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArraysInstancedBaseInstance::execute);
 	packet->mode = mode;
 	packet->first = first;
@@ -5515,7 +5515,7 @@ void drawElementsInstancedBaseInstance(
 	GLsizei instancecount,
 	GLuint baseinstance)
 {
-	RenderCommand_drawElementsInstancedBaseInstance* __restrict packet = (RenderCommand_drawElementsInstancedBaseInstance*)getNextPacket();
+	RenderCommand_drawElementsInstancedBaseInstance* __restrict packet = allocatePacket<RenderCommand_drawElementsInstancedBaseInstance>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstancedBaseInstance::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -5533,7 +5533,7 @@ void drawElementsInstancedBaseVertexBaseInstance(
 	GLint basevertex,
 	GLuint baseinstance)
 {
-	RenderCommand_drawElementsInstancedBaseVertexBaseInstance* __restrict packet = (RenderCommand_drawElementsInstancedBaseVertexBaseInstance*)getNextPacket();
+	RenderCommand_drawElementsInstancedBaseVertexBaseInstance* __restrict packet = allocatePacket<RenderCommand_drawElementsInstancedBaseVertexBaseInstance>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstancedBaseVertexBaseInstance::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -5550,7 +5550,7 @@ void getInternalformativ(
 	GLsizei bufSize,
 	GLint *params)
 {
-	RenderCommand_getInternalformativ* __restrict packet = (RenderCommand_getInternalformativ*)getNextPacket();
+	RenderCommand_getInternalformativ* __restrict packet = allocatePacket<RenderCommand_getInternalformativ>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getInternalformativ::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -5564,7 +5564,7 @@ void getActiveAtomicCounterBufferiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getActiveAtomicCounterBufferiv* __restrict packet = (RenderCommand_getActiveAtomicCounterBufferiv*)getNextPacket();
+	RenderCommand_getActiveAtomicCounterBufferiv* __restrict packet = allocatePacket<RenderCommand_getActiveAtomicCounterBufferiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getActiveAtomicCounterBufferiv::execute);
 	packet->program = program;
 	packet->bufferIndex = bufferIndex;
@@ -5580,7 +5580,7 @@ void bindImageTexture(
 	GLenum access,
 	GLenum format)
 {
-	RenderCommand_bindImageTexture* __restrict packet = (RenderCommand_bindImageTexture*)getNextPacket();
+	RenderCommand_bindImageTexture* __restrict packet = allocatePacket<RenderCommand_bindImageTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindImageTexture::execute);
 	packet->unit = unit;
 	packet->texture = texture;
@@ -5593,7 +5593,7 @@ void bindImageTexture(
 void memoryBarrier(
 	GLbitfield barriers)
 {
-	RenderCommand_memoryBarrier* __restrict packet = (RenderCommand_memoryBarrier*)getNextPacket();
+	RenderCommand_memoryBarrier* __restrict packet = allocatePacket<RenderCommand_memoryBarrier>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_memoryBarrier::execute);
 	packet->barriers = barriers;
 }
@@ -5603,7 +5603,7 @@ void texStorage1D(
 	GLenum internalformat,
 	GLsizei width)
 {
-	RenderCommand_texStorage1D* __restrict packet = (RenderCommand_texStorage1D*)getNextPacket();
+	RenderCommand_texStorage1D* __restrict packet = allocatePacket<RenderCommand_texStorage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texStorage1D::execute);
 	packet->target = target;
 	packet->levels = levels;
@@ -5617,7 +5617,7 @@ void texStorage2D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_texStorage2D* __restrict packet = (RenderCommand_texStorage2D*)getNextPacket();
+	RenderCommand_texStorage2D* __restrict packet = allocatePacket<RenderCommand_texStorage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texStorage2D::execute);
 	packet->target = target;
 	packet->levels = levels;
@@ -5633,7 +5633,7 @@ void texStorage3D(
 	GLsizei height,
 	GLsizei depth)
 {
-	RenderCommand_texStorage3D* __restrict packet = (RenderCommand_texStorage3D*)getNextPacket();
+	RenderCommand_texStorage3D* __restrict packet = allocatePacket<RenderCommand_texStorage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texStorage3D::execute);
 	packet->target = target;
 	packet->levels = levels;
@@ -5647,7 +5647,7 @@ void drawTransformFeedbackInstanced(
 	GLuint id,
 	GLsizei instancecount)
 {
-	RenderCommand_drawTransformFeedbackInstanced* __restrict packet = (RenderCommand_drawTransformFeedbackInstanced*)getNextPacket();
+	RenderCommand_drawTransformFeedbackInstanced* __restrict packet = allocatePacket<RenderCommand_drawTransformFeedbackInstanced>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawTransformFeedbackInstanced::execute);
 	packet->mode = mode;
 	packet->id = id;
@@ -5659,7 +5659,7 @@ void drawTransformFeedbackStreamInstanced(
 	GLuint stream,
 	GLsizei instancecount)
 {
-	RenderCommand_drawTransformFeedbackStreamInstanced* __restrict packet = (RenderCommand_drawTransformFeedbackStreamInstanced*)getNextPacket();
+	RenderCommand_drawTransformFeedbackStreamInstanced* __restrict packet = allocatePacket<RenderCommand_drawTransformFeedbackStreamInstanced>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawTransformFeedbackStreamInstanced::execute);
 	packet->mode = mode;
 	packet->id = id;
@@ -5673,7 +5673,7 @@ void clearBufferData(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearBufferData* __restrict packet = (RenderCommand_clearBufferData*)getNextPacket();
+	RenderCommand_clearBufferData* __restrict packet = allocatePacket<RenderCommand_clearBufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferData::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -5690,7 +5690,7 @@ void clearBufferSubData(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearBufferSubData* __restrict packet = (RenderCommand_clearBufferSubData*)getNextPacket();
+	RenderCommand_clearBufferSubData* __restrict packet = allocatePacket<RenderCommand_clearBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearBufferSubData::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -5705,7 +5705,7 @@ void dispatchCompute(
 	GLuint num_groups_y,
 	GLuint num_groups_z)
 {
-	RenderCommand_dispatchCompute* __restrict packet = (RenderCommand_dispatchCompute*)getNextPacket();
+	RenderCommand_dispatchCompute* __restrict packet = allocatePacket<RenderCommand_dispatchCompute>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_dispatchCompute::execute);
 	packet->num_groups_x = num_groups_x;
 	packet->num_groups_y = num_groups_y;
@@ -5714,7 +5714,7 @@ void dispatchCompute(
 void dispatchComputeIndirect(
 	GLintptr indirect)
 {
-	RenderCommand_dispatchComputeIndirect* __restrict packet = (RenderCommand_dispatchComputeIndirect*)getNextPacket();
+	RenderCommand_dispatchComputeIndirect* __restrict packet = allocatePacket<RenderCommand_dispatchComputeIndirect>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_dispatchComputeIndirect::execute);
 	packet->indirect = indirect;
 }
@@ -5735,7 +5735,7 @@ void copyImageSubData(
 	GLsizei srcHeight,
 	GLsizei srcDepth)
 {
-	RenderCommand_copyImageSubData* __restrict packet = (RenderCommand_copyImageSubData*)getNextPacket();
+	RenderCommand_copyImageSubData* __restrict packet = allocatePacket<RenderCommand_copyImageSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyImageSubData::execute);
 	packet->srcName = srcName;
 	packet->srcTarget = srcTarget;
@@ -5758,7 +5758,7 @@ void framebufferParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_framebufferParameteri* __restrict packet = (RenderCommand_framebufferParameteri*)getNextPacket();
+	RenderCommand_framebufferParameteri* __restrict packet = allocatePacket<RenderCommand_framebufferParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferParameteri::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -5769,7 +5769,7 @@ void getFramebufferParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getFramebufferParameteriv* __restrict packet = (RenderCommand_getFramebufferParameteriv*)getNextPacket();
+	RenderCommand_getFramebufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getFramebufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFramebufferParameteriv::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -5782,7 +5782,7 @@ void getInternalformati64v(
 	GLsizei bufSize,
 	GLint64 *params)
 {
-	RenderCommand_getInternalformati64v* __restrict packet = (RenderCommand_getInternalformati64v*)getNextPacket();
+	RenderCommand_getInternalformati64v* __restrict packet = allocatePacket<RenderCommand_getInternalformati64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getInternalformati64v::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -5800,7 +5800,7 @@ void invalidateTexSubImage(
 	GLsizei height,
 	GLsizei depth)
 {
-	RenderCommand_invalidateTexSubImage* __restrict packet = (RenderCommand_invalidateTexSubImage*)getNextPacket();
+	RenderCommand_invalidateTexSubImage* __restrict packet = allocatePacket<RenderCommand_invalidateTexSubImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateTexSubImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -5815,7 +5815,7 @@ void invalidateTexImage(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_invalidateTexImage* __restrict packet = (RenderCommand_invalidateTexImage*)getNextPacket();
+	RenderCommand_invalidateTexImage* __restrict packet = allocatePacket<RenderCommand_invalidateTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateTexImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -5825,7 +5825,7 @@ void invalidateBufferSubData(
 	GLintptr offset,
 	GLsizeiptr length)
 {
-	RenderCommand_invalidateBufferSubData* __restrict packet = (RenderCommand_invalidateBufferSubData*)getNextPacket();
+	RenderCommand_invalidateBufferSubData* __restrict packet = allocatePacket<RenderCommand_invalidateBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateBufferSubData::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -5834,7 +5834,7 @@ void invalidateBufferSubData(
 void invalidateBufferData(
 	GLuint buffer)
 {
-	RenderCommand_invalidateBufferData* __restrict packet = (RenderCommand_invalidateBufferData*)getNextPacket();
+	RenderCommand_invalidateBufferData* __restrict packet = allocatePacket<RenderCommand_invalidateBufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateBufferData::execute);
 	packet->buffer = buffer;
 }
@@ -5843,7 +5843,7 @@ void invalidateFramebuffer(
 	GLsizei numAttachments,
 	const GLenum *attachments)
 {
-	RenderCommand_invalidateFramebuffer* __restrict packet = (RenderCommand_invalidateFramebuffer*)getNextPacket();
+	RenderCommand_invalidateFramebuffer* __restrict packet = allocatePacket<RenderCommand_invalidateFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateFramebuffer::execute);
 	packet->target = target;
 	packet->numAttachments = numAttachments;
@@ -5858,7 +5858,7 @@ void invalidateSubFramebuffer(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_invalidateSubFramebuffer* __restrict packet = (RenderCommand_invalidateSubFramebuffer*)getNextPacket();
+	RenderCommand_invalidateSubFramebuffer* __restrict packet = allocatePacket<RenderCommand_invalidateSubFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateSubFramebuffer::execute);
 	packet->target = target;
 	packet->numAttachments = numAttachments;
@@ -5874,7 +5874,7 @@ void multiDrawArraysIndirect(
 	GLsizei drawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawArraysIndirect* __restrict packet = (RenderCommand_multiDrawArraysIndirect*)getNextPacket();
+	RenderCommand_multiDrawArraysIndirect* __restrict packet = allocatePacket<RenderCommand_multiDrawArraysIndirect>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArraysIndirect::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -5888,7 +5888,7 @@ void multiDrawElementsIndirect(
 	GLsizei drawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawElementsIndirect* __restrict packet = (RenderCommand_multiDrawElementsIndirect*)getNextPacket();
+	RenderCommand_multiDrawElementsIndirect* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsIndirect>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsIndirect::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -5902,7 +5902,7 @@ void getProgramInterfaceiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getProgramInterfaceiv* __restrict packet = (RenderCommand_getProgramInterfaceiv*)getNextPacket();
+	RenderCommand_getProgramInterfaceiv* __restrict packet = allocatePacket<RenderCommand_getProgramInterfaceiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramInterfaceiv::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5914,7 +5914,7 @@ GLuint getProgramResourceIndex(
 	GLenum programInterface,
 	const GLchar *name)
 {
-	RenderCommand_getProgramResourceIndex* __restrict packet = (RenderCommand_getProgramResourceIndex*)getNextPacket();
+	RenderCommand_getProgramResourceIndex* __restrict packet = allocatePacket<RenderCommand_getProgramResourceIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourceIndex::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5928,7 +5928,7 @@ void getProgramResourceName(
 	GLsizei *length,
 	GLchar *name)
 {
-	RenderCommand_getProgramResourceName* __restrict packet = (RenderCommand_getProgramResourceName*)getNextPacket();
+	RenderCommand_getProgramResourceName* __restrict packet = allocatePacket<RenderCommand_getProgramResourceName>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourceName::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5947,7 +5947,7 @@ void getProgramResourceiv(
 	GLsizei *length,
 	GLint *params)
 {
-	RenderCommand_getProgramResourceiv* __restrict packet = (RenderCommand_getProgramResourceiv*)getNextPacket();
+	RenderCommand_getProgramResourceiv* __restrict packet = allocatePacket<RenderCommand_getProgramResourceiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourceiv::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5963,7 +5963,7 @@ GLint getProgramResourceLocation(
 	GLenum programInterface,
 	const GLchar *name)
 {
-	RenderCommand_getProgramResourceLocation* __restrict packet = (RenderCommand_getProgramResourceLocation*)getNextPacket();
+	RenderCommand_getProgramResourceLocation* __restrict packet = allocatePacket<RenderCommand_getProgramResourceLocation>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourceLocation::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5974,7 +5974,7 @@ GLint getProgramResourceLocationIndex(
 	GLenum programInterface,
 	const GLchar *name)
 {
-	RenderCommand_getProgramResourceLocationIndex* __restrict packet = (RenderCommand_getProgramResourceLocationIndex*)getNextPacket();
+	RenderCommand_getProgramResourceLocationIndex* __restrict packet = allocatePacket<RenderCommand_getProgramResourceLocationIndex>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourceLocationIndex::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -5985,7 +5985,7 @@ void shaderStorageBlockBinding(
 	GLuint storageBlockIndex,
 	GLuint storageBlockBinding)
 {
-	RenderCommand_shaderStorageBlockBinding* __restrict packet = (RenderCommand_shaderStorageBlockBinding*)getNextPacket();
+	RenderCommand_shaderStorageBlockBinding* __restrict packet = allocatePacket<RenderCommand_shaderStorageBlockBinding>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shaderStorageBlockBinding::execute);
 	packet->program = program;
 	packet->storageBlockIndex = storageBlockIndex;
@@ -5998,7 +5998,7 @@ void texBufferRange(
 	GLintptr offset,
 	GLsizeiptr size)
 {
-	RenderCommand_texBufferRange* __restrict packet = (RenderCommand_texBufferRange*)getNextPacket();
+	RenderCommand_texBufferRange* __restrict packet = allocatePacket<RenderCommand_texBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texBufferRange::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -6014,7 +6014,7 @@ void texStorage2DMultisample(
 	GLsizei height,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_texStorage2DMultisample* __restrict packet = (RenderCommand_texStorage2DMultisample*)getNextPacket();
+	RenderCommand_texStorage2DMultisample* __restrict packet = allocatePacket<RenderCommand_texStorage2DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texStorage2DMultisample::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -6032,7 +6032,7 @@ void texStorage3DMultisample(
 	GLsizei depth,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_texStorage3DMultisample* __restrict packet = (RenderCommand_texStorage3DMultisample*)getNextPacket();
+	RenderCommand_texStorage3DMultisample* __restrict packet = allocatePacket<RenderCommand_texStorage3DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texStorage3DMultisample::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -6052,7 +6052,7 @@ void textureView(
 	GLuint minlayer,
 	GLuint numlayers)
 {
-	RenderCommand_textureView* __restrict packet = (RenderCommand_textureView*)getNextPacket();
+	RenderCommand_textureView* __restrict packet = allocatePacket<RenderCommand_textureView>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureView::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -6069,7 +6069,7 @@ void bindVertexBuffer(
 	GLintptr offset,
 	GLsizei stride)
 {
-	RenderCommand_bindVertexBuffer* __restrict packet = (RenderCommand_bindVertexBuffer*)getNextPacket();
+	RenderCommand_bindVertexBuffer* __restrict packet = allocatePacket<RenderCommand_bindVertexBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindVertexBuffer::execute);
 	packet->bindingindex = bindingindex;
 	packet->buffer = buffer;
@@ -6083,7 +6083,7 @@ void vertexAttribFormat(
 	GLboolean normalized,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexAttribFormat* __restrict packet = (RenderCommand_vertexAttribFormat*)getNextPacket();
+	RenderCommand_vertexAttribFormat* __restrict packet = allocatePacket<RenderCommand_vertexAttribFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribFormat::execute);
 	packet->attribindex = attribindex;
 	packet->size = size;
@@ -6097,7 +6097,7 @@ void vertexAttribIFormat(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexAttribIFormat* __restrict packet = (RenderCommand_vertexAttribIFormat*)getNextPacket();
+	RenderCommand_vertexAttribIFormat* __restrict packet = allocatePacket<RenderCommand_vertexAttribIFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribIFormat::execute);
 	packet->attribindex = attribindex;
 	packet->size = size;
@@ -6110,7 +6110,7 @@ void vertexAttribLFormat(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexAttribLFormat* __restrict packet = (RenderCommand_vertexAttribLFormat*)getNextPacket();
+	RenderCommand_vertexAttribLFormat* __restrict packet = allocatePacket<RenderCommand_vertexAttribLFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribLFormat::execute);
 	packet->attribindex = attribindex;
 	packet->size = size;
@@ -6121,7 +6121,7 @@ void vertexAttribBinding(
 	GLuint attribindex,
 	GLuint bindingindex)
 {
-	RenderCommand_vertexAttribBinding* __restrict packet = (RenderCommand_vertexAttribBinding*)getNextPacket();
+	RenderCommand_vertexAttribBinding* __restrict packet = allocatePacket<RenderCommand_vertexAttribBinding>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribBinding::execute);
 	packet->attribindex = attribindex;
 	packet->bindingindex = bindingindex;
@@ -6130,7 +6130,7 @@ void vertexBindingDivisor(
 	GLuint bindingindex,
 	GLuint divisor)
 {
-	RenderCommand_vertexBindingDivisor* __restrict packet = (RenderCommand_vertexBindingDivisor*)getNextPacket();
+	RenderCommand_vertexBindingDivisor* __restrict packet = allocatePacket<RenderCommand_vertexBindingDivisor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexBindingDivisor::execute);
 	packet->bindingindex = bindingindex;
 	packet->divisor = divisor;
@@ -6143,7 +6143,7 @@ void debugMessageControl(
 	const GLuint *ids,
 	GLboolean enabled)
 {
-	RenderCommand_debugMessageControl* __restrict packet = (RenderCommand_debugMessageControl*)getNextPacket();
+	RenderCommand_debugMessageControl* __restrict packet = allocatePacket<RenderCommand_debugMessageControl>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageControl::execute);
 	packet->source = source;
 	packet->type = type;
@@ -6160,7 +6160,7 @@ void debugMessageInsert(
 	GLsizei length,
 	const GLchar *buf)
 {
-	RenderCommand_debugMessageInsert* __restrict packet = (RenderCommand_debugMessageInsert*)getNextPacket();
+	RenderCommand_debugMessageInsert* __restrict packet = allocatePacket<RenderCommand_debugMessageInsert>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageInsert::execute);
 	packet->source = source;
 	packet->type = type;
@@ -6173,7 +6173,7 @@ void debugMessageCallback(
 	GLDEBUGPROC callback,
 	const void *userParam)
 {
-	RenderCommand_debugMessageCallback* __restrict packet = (RenderCommand_debugMessageCallback*)getNextPacket();
+	RenderCommand_debugMessageCallback* __restrict packet = allocatePacket<RenderCommand_debugMessageCallback>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageCallback::execute);
 	packet->callback = callback;
 	packet->userParam = userParam;
@@ -6188,7 +6188,7 @@ GLuint getDebugMessageLog(
 	GLsizei *lengths,
 	GLchar *messageLog)
 {
-	RenderCommand_getDebugMessageLog* __restrict packet = (RenderCommand_getDebugMessageLog*)getNextPacket();
+	RenderCommand_getDebugMessageLog* __restrict packet = allocatePacket<RenderCommand_getDebugMessageLog>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDebugMessageLog::execute);
 	packet->count = count;
 	packet->bufSize = bufSize;
@@ -6205,7 +6205,7 @@ void pushDebugGroup(
 	GLsizei length,
 	const GLchar *message)
 {
-	RenderCommand_pushDebugGroup* __restrict packet = (RenderCommand_pushDebugGroup*)getNextPacket();
+	RenderCommand_pushDebugGroup* __restrict packet = allocatePacket<RenderCommand_pushDebugGroup>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pushDebugGroup::execute);
 	packet->source = source;
 	packet->id = id;
@@ -6215,7 +6215,7 @@ void pushDebugGroup(
 void popDebugGroup(
 	void)
 {
-	RenderCommand_popDebugGroup* __restrict packet = (RenderCommand_popDebugGroup*)getNextPacket();
+	RenderCommand_popDebugGroup* __restrict packet = allocatePacket<RenderCommand_popDebugGroup>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_popDebugGroup::execute);
 }
 void objectLabel(
@@ -6224,7 +6224,7 @@ void objectLabel(
 	GLsizei length,
 	const GLchar *label)
 {
-	RenderCommand_objectLabel* __restrict packet = (RenderCommand_objectLabel*)getNextPacket();
+	RenderCommand_objectLabel* __restrict packet = allocatePacket<RenderCommand_objectLabel>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_objectLabel::execute);
 	packet->identifier = identifier;
 	packet->name = name;
@@ -6238,7 +6238,7 @@ void getObjectLabel(
 	GLsizei *length,
 	GLchar *label)
 {
-	RenderCommand_getObjectLabel* __restrict packet = (RenderCommand_getObjectLabel*)getNextPacket();
+	RenderCommand_getObjectLabel* __restrict packet = allocatePacket<RenderCommand_getObjectLabel>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getObjectLabel::execute);
 	packet->identifier = identifier;
 	packet->name = name;
@@ -6251,7 +6251,7 @@ void objectPtrLabel(
 	GLsizei length,
 	const GLchar *label)
 {
-	RenderCommand_objectPtrLabel* __restrict packet = (RenderCommand_objectPtrLabel*)getNextPacket();
+	RenderCommand_objectPtrLabel* __restrict packet = allocatePacket<RenderCommand_objectPtrLabel>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_objectPtrLabel::execute);
 	packet->ptr = ptr;
 	packet->length = length;
@@ -6263,7 +6263,7 @@ void getObjectPtrLabel(
 	GLsizei *length,
 	GLchar *label)
 {
-	RenderCommand_getObjectPtrLabel* __restrict packet = (RenderCommand_getObjectPtrLabel*)getNextPacket();
+	RenderCommand_getObjectPtrLabel* __restrict packet = allocatePacket<RenderCommand_getObjectPtrLabel>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getObjectPtrLabel::execute);
 	packet->ptr = ptr;
 	packet->bufSize = bufSize;
@@ -6276,7 +6276,7 @@ void bufferStorage(
 	const void *data,
 	GLbitfield flags)
 {
-	RenderCommand_bufferStorage* __restrict packet = (RenderCommand_bufferStorage*)getNextPacket();
+	RenderCommand_bufferStorage* __restrict packet = allocatePacket<RenderCommand_bufferStorage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferStorage::execute);
 	packet->target = target;
 	packet->size = size;
@@ -6290,7 +6290,7 @@ void clearTexImage(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearTexImage* __restrict packet = (RenderCommand_clearTexImage*)getNextPacket();
+	RenderCommand_clearTexImage* __restrict packet = allocatePacket<RenderCommand_clearTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearTexImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -6311,7 +6311,7 @@ void clearTexSubImage(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearTexSubImage* __restrict packet = (RenderCommand_clearTexSubImage*)getNextPacket();
+	RenderCommand_clearTexSubImage* __restrict packet = allocatePacket<RenderCommand_clearTexSubImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearTexSubImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -6331,7 +6331,7 @@ void bindBuffersBase(
 	GLsizei count,
 	const GLuint *buffers)
 {
-	RenderCommand_bindBuffersBase* __restrict packet = (RenderCommand_bindBuffersBase*)getNextPacket();
+	RenderCommand_bindBuffersBase* __restrict packet = allocatePacket<RenderCommand_bindBuffersBase>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindBuffersBase::execute);
 	packet->target = target;
 	packet->first = first;
@@ -6350,7 +6350,7 @@ void bindBuffersRange(
 	const GLintptr *offsets,
 	const GLsizeiptr *sizes)
 {
-	RenderCommand_bindBuffersRange* __restrict packet = (RenderCommand_bindBuffersRange*)getNextPacket();
+	RenderCommand_bindBuffersRange* __restrict packet = allocatePacket<RenderCommand_bindBuffersRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindBuffersRange::execute);
 	packet->target = target;
 	packet->first = first;
@@ -6364,7 +6364,7 @@ void bindTextures(
 	GLsizei count,
 	const GLuint *textures)
 {
-	RenderCommand_bindTextures* __restrict packet = (RenderCommand_bindTextures*)getNextPacket();
+	RenderCommand_bindTextures* __restrict packet = allocatePacket<RenderCommand_bindTextures>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindTextures::execute);
 	packet->first = first;
 	packet->count = count;
@@ -6379,7 +6379,7 @@ void bindSamplers(
 	GLsizei count,
 	const GLuint *samplers)
 {
-	RenderCommand_bindSamplers* __restrict packet = (RenderCommand_bindSamplers*)getNextPacket();
+	RenderCommand_bindSamplers* __restrict packet = allocatePacket<RenderCommand_bindSamplers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindSamplers::execute);
 	packet->first = first;
 	packet->count = count;
@@ -6394,7 +6394,7 @@ void bindImageTextures(
 	GLsizei count,
 	const GLuint *textures)
 {
-	RenderCommand_bindImageTextures* __restrict packet = (RenderCommand_bindImageTextures*)getNextPacket();
+	RenderCommand_bindImageTextures* __restrict packet = allocatePacket<RenderCommand_bindImageTextures>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindImageTextures::execute);
 	packet->first = first;
 	packet->count = count;
@@ -6407,7 +6407,7 @@ void bindVertexBuffers(
 	const GLintptr *offsets,
 	const GLsizei *strides)
 {
-	RenderCommand_bindVertexBuffers* __restrict packet = (RenderCommand_bindVertexBuffers*)getNextPacket();
+	RenderCommand_bindVertexBuffers* __restrict packet = allocatePacket<RenderCommand_bindVertexBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindVertexBuffers::execute);
 	packet->first = first;
 	packet->count = count;
@@ -6419,7 +6419,7 @@ void clipControl(
 	GLenum origin,
 	GLenum depth)
 {
-	RenderCommand_clipControl* __restrict packet = (RenderCommand_clipControl*)getNextPacket();
+	RenderCommand_clipControl* __restrict packet = allocatePacket<RenderCommand_clipControl>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clipControl::execute);
 	packet->origin = origin;
 	packet->depth = depth;
@@ -6428,7 +6428,7 @@ void createTransformFeedbacks(
 	GLsizei n,
 	GLuint *ids)
 {
-	RenderCommand_createTransformFeedbacks* __restrict packet = (RenderCommand_createTransformFeedbacks*)getNextPacket();
+	RenderCommand_createTransformFeedbacks* __restrict packet = allocatePacket<RenderCommand_createTransformFeedbacks>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createTransformFeedbacks::execute);
 	packet->n = n;
 	packet->ids = ids;
@@ -6438,7 +6438,7 @@ void transformFeedbackBufferBase(
 	GLuint index,
 	GLuint buffer)
 {
-	RenderCommand_transformFeedbackBufferBase* __restrict packet = (RenderCommand_transformFeedbackBufferBase*)getNextPacket();
+	RenderCommand_transformFeedbackBufferBase* __restrict packet = allocatePacket<RenderCommand_transformFeedbackBufferBase>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_transformFeedbackBufferBase::execute);
 	packet->xfb = xfb;
 	packet->index = index;
@@ -6451,7 +6451,7 @@ void transformFeedbackBufferRange(
 	GLintptr offset,
 	GLsizeiptr size)
 {
-	RenderCommand_transformFeedbackBufferRange* __restrict packet = (RenderCommand_transformFeedbackBufferRange*)getNextPacket();
+	RenderCommand_transformFeedbackBufferRange* __restrict packet = allocatePacket<RenderCommand_transformFeedbackBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_transformFeedbackBufferRange::execute);
 	packet->xfb = xfb;
 	packet->index = index;
@@ -6464,7 +6464,7 @@ void getTransformFeedbackiv(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getTransformFeedbackiv* __restrict packet = (RenderCommand_getTransformFeedbackiv*)getNextPacket();
+	RenderCommand_getTransformFeedbackiv* __restrict packet = allocatePacket<RenderCommand_getTransformFeedbackiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTransformFeedbackiv::execute);
 	packet->xfb = xfb;
 	packet->pname = pname;
@@ -6476,7 +6476,7 @@ void getTransformFeedbacki_v(
 	GLuint index,
 	GLint *param)
 {
-	RenderCommand_getTransformFeedbacki_v* __restrict packet = (RenderCommand_getTransformFeedbacki_v*)getNextPacket();
+	RenderCommand_getTransformFeedbacki_v* __restrict packet = allocatePacket<RenderCommand_getTransformFeedbacki_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTransformFeedbacki_v::execute);
 	packet->xfb = xfb;
 	packet->pname = pname;
@@ -6489,7 +6489,7 @@ void getTransformFeedbacki64_v(
 	GLuint index,
 	GLint64 *param)
 {
-	RenderCommand_getTransformFeedbacki64_v* __restrict packet = (RenderCommand_getTransformFeedbacki64_v*)getNextPacket();
+	RenderCommand_getTransformFeedbacki64_v* __restrict packet = allocatePacket<RenderCommand_getTransformFeedbacki64_v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTransformFeedbacki64_v::execute);
 	packet->xfb = xfb;
 	packet->pname = pname;
@@ -6500,7 +6500,7 @@ void createBuffers(
 	GLsizei n,
 	GLuint *buffers)
 {
-	RenderCommand_createBuffers* __restrict packet = (RenderCommand_createBuffers*)getNextPacket();
+	RenderCommand_createBuffers* __restrict packet = allocatePacket<RenderCommand_createBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createBuffers::execute);
 	packet->n = n;
 	packet->buffers = buffers;
@@ -6511,7 +6511,7 @@ void namedBufferStorage(
 	const void *data,
 	GLbitfield flags)
 {
-	RenderCommand_namedBufferStorage* __restrict packet = (RenderCommand_namedBufferStorage*)getNextPacket();
+	RenderCommand_namedBufferStorage* __restrict packet = allocatePacket<RenderCommand_namedBufferStorage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferStorage::execute);
 	packet->buffer = buffer;
 	packet->size = size;
@@ -6524,7 +6524,7 @@ void namedBufferData(
 	const void *data,
 	GLenum usage)
 {
-	RenderCommand_namedBufferData* __restrict packet = (RenderCommand_namedBufferData*)getNextPacket();
+	RenderCommand_namedBufferData* __restrict packet = allocatePacket<RenderCommand_namedBufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferData::execute);
 	packet->buffer = buffer;
 	packet->size = size;
@@ -6537,7 +6537,7 @@ void namedBufferSubData(
 	GLsizeiptr size,
 	const void *data)
 {
-	RenderCommand_namedBufferSubData* __restrict packet = (RenderCommand_namedBufferSubData*)getNextPacket();
+	RenderCommand_namedBufferSubData* __restrict packet = allocatePacket<RenderCommand_namedBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferSubData::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -6551,7 +6551,7 @@ void copyNamedBufferSubData(
 	GLintptr writeOffset,
 	GLsizeiptr size)
 {
-	RenderCommand_copyNamedBufferSubData* __restrict packet = (RenderCommand_copyNamedBufferSubData*)getNextPacket();
+	RenderCommand_copyNamedBufferSubData* __restrict packet = allocatePacket<RenderCommand_copyNamedBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyNamedBufferSubData::execute);
 	packet->readBuffer = readBuffer;
 	packet->writeBuffer = writeBuffer;
@@ -6566,7 +6566,7 @@ void clearNamedBufferData(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearNamedBufferData* __restrict packet = (RenderCommand_clearNamedBufferData*)getNextPacket();
+	RenderCommand_clearNamedBufferData* __restrict packet = allocatePacket<RenderCommand_clearNamedBufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedBufferData::execute);
 	packet->buffer = buffer;
 	packet->internalformat = internalformat;
@@ -6583,7 +6583,7 @@ void clearNamedBufferSubData(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearNamedBufferSubData* __restrict packet = (RenderCommand_clearNamedBufferSubData*)getNextPacket();
+	RenderCommand_clearNamedBufferSubData* __restrict packet = allocatePacket<RenderCommand_clearNamedBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedBufferSubData::execute);
 	packet->buffer = buffer;
 	packet->internalformat = internalformat;
@@ -6597,7 +6597,7 @@ void* mapNamedBuffer(
 	GLuint buffer,
 	GLenum access)
 {
-	RenderCommand_mapNamedBuffer* __restrict packet = (RenderCommand_mapNamedBuffer*)getNextPacket();
+	RenderCommand_mapNamedBuffer* __restrict packet = allocatePacket<RenderCommand_mapNamedBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapNamedBuffer::execute);
 	packet->buffer = buffer;
 	packet->access = access;
@@ -6608,7 +6608,7 @@ void* mapNamedBufferRange(
 	GLsizeiptr length,
 	GLbitfield access)
 {
-	RenderCommand_mapNamedBufferRange* __restrict packet = (RenderCommand_mapNamedBufferRange*)getNextPacket();
+	RenderCommand_mapNamedBufferRange* __restrict packet = allocatePacket<RenderCommand_mapNamedBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapNamedBufferRange::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -6618,7 +6618,7 @@ void* mapNamedBufferRange(
 GLboolean unmapNamedBuffer(
 	GLuint buffer)
 {
-	RenderCommand_unmapNamedBuffer* __restrict packet = (RenderCommand_unmapNamedBuffer*)getNextPacket();
+	RenderCommand_unmapNamedBuffer* __restrict packet = allocatePacket<RenderCommand_unmapNamedBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_unmapNamedBuffer::execute);
 	packet->buffer = buffer;
 }
@@ -6627,7 +6627,7 @@ void flushMappedNamedBufferRange(
 	GLintptr offset,
 	GLsizeiptr length)
 {
-	RenderCommand_flushMappedNamedBufferRange* __restrict packet = (RenderCommand_flushMappedNamedBufferRange*)getNextPacket();
+	RenderCommand_flushMappedNamedBufferRange* __restrict packet = allocatePacket<RenderCommand_flushMappedNamedBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_flushMappedNamedBufferRange::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -6638,7 +6638,7 @@ void getNamedBufferParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedBufferParameteriv* __restrict packet = (RenderCommand_getNamedBufferParameteriv*)getNextPacket();
+	RenderCommand_getNamedBufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getNamedBufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferParameteriv::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -6649,7 +6649,7 @@ void getNamedBufferParameteri64v(
 	GLenum pname,
 	GLint64 *params)
 {
-	RenderCommand_getNamedBufferParameteri64v* __restrict packet = (RenderCommand_getNamedBufferParameteri64v*)getNextPacket();
+	RenderCommand_getNamedBufferParameteri64v* __restrict packet = allocatePacket<RenderCommand_getNamedBufferParameteri64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferParameteri64v::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -6660,7 +6660,7 @@ void getNamedBufferPointerv(
 	GLenum pname,
 	void **params)
 {
-	RenderCommand_getNamedBufferPointerv* __restrict packet = (RenderCommand_getNamedBufferPointerv*)getNextPacket();
+	RenderCommand_getNamedBufferPointerv* __restrict packet = allocatePacket<RenderCommand_getNamedBufferPointerv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferPointerv::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -6672,7 +6672,7 @@ void getNamedBufferSubData(
 	GLsizeiptr size,
 	void *data)
 {
-	RenderCommand_getNamedBufferSubData* __restrict packet = (RenderCommand_getNamedBufferSubData*)getNextPacket();
+	RenderCommand_getNamedBufferSubData* __restrict packet = allocatePacket<RenderCommand_getNamedBufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferSubData::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -6684,7 +6684,7 @@ void createFramebuffers(
 	GLsizei n,
 	GLuint *framebuffers)
 {
-	RenderCommand_createFramebuffers* __restrict packet = (RenderCommand_createFramebuffers*)getNextPacket();
+	RenderCommand_createFramebuffers* __restrict packet = allocatePacket<RenderCommand_createFramebuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createFramebuffers::execute);
 	packet->n = n;
 	packet->framebuffers = framebuffers;
@@ -6695,7 +6695,7 @@ void namedFramebufferRenderbuffer(
 	GLenum renderbuffertarget,
 	GLuint renderbuffer)
 {
-	RenderCommand_namedFramebufferRenderbuffer* __restrict packet = (RenderCommand_namedFramebufferRenderbuffer*)getNextPacket();
+	RenderCommand_namedFramebufferRenderbuffer* __restrict packet = allocatePacket<RenderCommand_namedFramebufferRenderbuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferRenderbuffer::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -6707,7 +6707,7 @@ void namedFramebufferParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_namedFramebufferParameteri* __restrict packet = (RenderCommand_namedFramebufferParameteri*)getNextPacket();
+	RenderCommand_namedFramebufferParameteri* __restrict packet = allocatePacket<RenderCommand_namedFramebufferParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferParameteri::execute);
 	packet->framebuffer = framebuffer;
 	packet->pname = pname;
@@ -6719,7 +6719,7 @@ void namedFramebufferTexture(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_namedFramebufferTexture* __restrict packet = (RenderCommand_namedFramebufferTexture*)getNextPacket();
+	RenderCommand_namedFramebufferTexture* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTexture>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTexture::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -6733,7 +6733,7 @@ void namedFramebufferTextureLayer(
 	GLint level,
 	GLint layer)
 {
-	RenderCommand_namedFramebufferTextureLayer* __restrict packet = (RenderCommand_namedFramebufferTextureLayer*)getNextPacket();
+	RenderCommand_namedFramebufferTextureLayer* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTextureLayer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTextureLayer::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -6745,7 +6745,7 @@ void namedFramebufferDrawBuffer(
 	GLuint framebuffer,
 	GLenum buf)
 {
-	RenderCommand_namedFramebufferDrawBuffer* __restrict packet = (RenderCommand_namedFramebufferDrawBuffer*)getNextPacket();
+	RenderCommand_namedFramebufferDrawBuffer* __restrict packet = allocatePacket<RenderCommand_namedFramebufferDrawBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferDrawBuffer::execute);
 	packet->framebuffer = framebuffer;
 	packet->buf = buf;
@@ -6755,7 +6755,7 @@ void namedFramebufferDrawBuffers(
 	GLsizei n,
 	const GLenum *bufs)
 {
-	RenderCommand_namedFramebufferDrawBuffers* __restrict packet = (RenderCommand_namedFramebufferDrawBuffers*)getNextPacket();
+	RenderCommand_namedFramebufferDrawBuffers* __restrict packet = allocatePacket<RenderCommand_namedFramebufferDrawBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferDrawBuffers::execute);
 	packet->framebuffer = framebuffer;
 	packet->n = n;
@@ -6765,7 +6765,7 @@ void namedFramebufferReadBuffer(
 	GLuint framebuffer,
 	GLenum src)
 {
-	RenderCommand_namedFramebufferReadBuffer* __restrict packet = (RenderCommand_namedFramebufferReadBuffer*)getNextPacket();
+	RenderCommand_namedFramebufferReadBuffer* __restrict packet = allocatePacket<RenderCommand_namedFramebufferReadBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferReadBuffer::execute);
 	packet->framebuffer = framebuffer;
 	packet->src = src;
@@ -6775,7 +6775,7 @@ void invalidateNamedFramebufferData(
 	GLsizei numAttachments,
 	const GLenum *attachments)
 {
-	RenderCommand_invalidateNamedFramebufferData* __restrict packet = (RenderCommand_invalidateNamedFramebufferData*)getNextPacket();
+	RenderCommand_invalidateNamedFramebufferData* __restrict packet = allocatePacket<RenderCommand_invalidateNamedFramebufferData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateNamedFramebufferData::execute);
 	packet->framebuffer = framebuffer;
 	packet->numAttachments = numAttachments;
@@ -6790,7 +6790,7 @@ void invalidateNamedFramebufferSubData(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_invalidateNamedFramebufferSubData* __restrict packet = (RenderCommand_invalidateNamedFramebufferSubData*)getNextPacket();
+	RenderCommand_invalidateNamedFramebufferSubData* __restrict packet = allocatePacket<RenderCommand_invalidateNamedFramebufferSubData>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_invalidateNamedFramebufferSubData::execute);
 	packet->framebuffer = framebuffer;
 	packet->numAttachments = numAttachments;
@@ -6808,7 +6808,7 @@ void clearNamedFramebufferiv(
 {
 	GLint numComponents = (buffer == GL_STENCIL) ? 1 : 4;
 
-	RenderCommand_clearNamedFramebufferiv* __restrict packet = (RenderCommand_clearNamedFramebufferiv*)getNextPacket();
+	RenderCommand_clearNamedFramebufferiv* __restrict packet = allocatePacket<RenderCommand_clearNamedFramebufferiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedFramebufferiv::execute);
 	packet->framebuffer = framebuffer;
 	packet->buffer = buffer;
@@ -6821,7 +6821,7 @@ void clearNamedFramebufferuiv(
 	GLint drawbuffer,
 	const GLuint *value)
 {
-	RenderCommand_clearNamedFramebufferuiv* __restrict packet = (RenderCommand_clearNamedFramebufferuiv*)getNextPacket();
+	RenderCommand_clearNamedFramebufferuiv* __restrict packet = allocatePacket<RenderCommand_clearNamedFramebufferuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedFramebufferuiv::execute);
 	packet->framebuffer = framebuffer;
 	packet->buffer = buffer;
@@ -6836,7 +6836,7 @@ void clearNamedFramebufferfv(
 {
 	GLuint numComponents = (buffer == GL_DEPTH) ? 1 : 4;
 
-	RenderCommand_clearNamedFramebufferfv* __restrict packet = (RenderCommand_clearNamedFramebufferfv*)getNextPacket();
+	RenderCommand_clearNamedFramebufferfv* __restrict packet = allocatePacket<RenderCommand_clearNamedFramebufferfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedFramebufferfv::execute);
 	packet->framebuffer = framebuffer;
 	packet->buffer = buffer;
@@ -6850,7 +6850,7 @@ void clearNamedFramebufferfi(
 	GLfloat depth,
 	GLint stencil)
 {
-	RenderCommand_clearNamedFramebufferfi* __restrict packet = (RenderCommand_clearNamedFramebufferfi*)getNextPacket();
+	RenderCommand_clearNamedFramebufferfi* __restrict packet = allocatePacket<RenderCommand_clearNamedFramebufferfi>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedFramebufferfi::execute);
 	packet->framebuffer = framebuffer;
 	packet->buffer = buffer;
@@ -6872,7 +6872,7 @@ void blitNamedFramebuffer(
 	GLbitfield mask,
 	GLenum filter)
 {
-	RenderCommand_blitNamedFramebuffer* __restrict packet = (RenderCommand_blitNamedFramebuffer*)getNextPacket();
+	RenderCommand_blitNamedFramebuffer* __restrict packet = allocatePacket<RenderCommand_blitNamedFramebuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blitNamedFramebuffer::execute);
 	packet->readFramebuffer = readFramebuffer;
 	packet->drawFramebuffer = drawFramebuffer;
@@ -6892,7 +6892,7 @@ void checkNamedFramebufferStatus(
 	GLenum target,
 	GLenum* glReturnValue)
 {
-	RenderCommand_checkNamedFramebufferStatus* __restrict packet = (RenderCommand_checkNamedFramebufferStatus*)getNextPacket();
+	RenderCommand_checkNamedFramebufferStatus* __restrict packet = allocatePacket<RenderCommand_checkNamedFramebufferStatus>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_checkNamedFramebufferStatus::execute);
 	packet->framebuffer = framebuffer;
 	packet->target = target;
@@ -6903,7 +6903,7 @@ void getNamedFramebufferParameteriv(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getNamedFramebufferParameteriv* __restrict packet = (RenderCommand_getNamedFramebufferParameteriv*)getNextPacket();
+	RenderCommand_getNamedFramebufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getNamedFramebufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedFramebufferParameteriv::execute);
 	packet->framebuffer = framebuffer;
 	packet->pname = pname;
@@ -6915,7 +6915,7 @@ void getNamedFramebufferAttachmentParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedFramebufferAttachmentParameteriv* __restrict packet = (RenderCommand_getNamedFramebufferAttachmentParameteriv*)getNextPacket();
+	RenderCommand_getNamedFramebufferAttachmentParameteriv* __restrict packet = allocatePacket<RenderCommand_getNamedFramebufferAttachmentParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedFramebufferAttachmentParameteriv::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -6926,7 +6926,7 @@ void createRenderbuffers(
 	GLsizei n,
 	GLuint *renderbuffers)
 {
-	RenderCommand_createRenderbuffers* __restrict packet = (RenderCommand_createRenderbuffers*)getNextPacket();
+	RenderCommand_createRenderbuffers* __restrict packet = allocatePacket<RenderCommand_createRenderbuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createRenderbuffers::execute);
 	packet->n = n;
 	packet->renderbuffers = renderbuffers;
@@ -6937,7 +6937,7 @@ void namedRenderbufferStorage(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorage* __restrict packet = (RenderCommand_namedRenderbufferStorage*)getNextPacket();
+	RenderCommand_namedRenderbufferStorage* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorage::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->internalformat = internalformat;
@@ -6951,7 +6951,7 @@ void namedRenderbufferStorageMultisample(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorageMultisample* __restrict packet = (RenderCommand_namedRenderbufferStorageMultisample*)getNextPacket();
+	RenderCommand_namedRenderbufferStorageMultisample* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorageMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorageMultisample::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->samples = samples;
@@ -6964,7 +6964,7 @@ void getNamedRenderbufferParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedRenderbufferParameteriv* __restrict packet = (RenderCommand_getNamedRenderbufferParameteriv*)getNextPacket();
+	RenderCommand_getNamedRenderbufferParameteriv* __restrict packet = allocatePacket<RenderCommand_getNamedRenderbufferParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedRenderbufferParameteriv::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->pname = pname;
@@ -6975,7 +6975,7 @@ void createTextures(
 	GLsizei n,
 	GLuint *textures)
 {
-	RenderCommand_createTextures* __restrict packet = (RenderCommand_createTextures*)getNextPacket();
+	RenderCommand_createTextures* __restrict packet = allocatePacket<RenderCommand_createTextures>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createTextures::execute);
 	packet->target = target;
 	packet->n = n;
@@ -6986,7 +6986,7 @@ void textureBuffer(
 	GLenum internalformat,
 	GLuint buffer)
 {
-	RenderCommand_textureBuffer* __restrict packet = (RenderCommand_textureBuffer*)getNextPacket();
+	RenderCommand_textureBuffer* __restrict packet = allocatePacket<RenderCommand_textureBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBuffer::execute);
 	packet->texture = texture;
 	packet->internalformat = internalformat;
@@ -6999,7 +6999,7 @@ void textureBufferRange(
 	GLintptr offset,
 	GLsizeiptr size)
 {
-	RenderCommand_textureBufferRange* __restrict packet = (RenderCommand_textureBufferRange*)getNextPacket();
+	RenderCommand_textureBufferRange* __restrict packet = allocatePacket<RenderCommand_textureBufferRange>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBufferRange::execute);
 	packet->texture = texture;
 	packet->internalformat = internalformat;
@@ -7013,7 +7013,7 @@ void textureStorage1D(
 	GLenum internalformat,
 	GLsizei width)
 {
-	RenderCommand_textureStorage1D* __restrict packet = (RenderCommand_textureStorage1D*)getNextPacket();
+	RenderCommand_textureStorage1D* __restrict packet = allocatePacket<RenderCommand_textureStorage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage1D::execute);
 	packet->texture = texture;
 	packet->levels = levels;
@@ -7027,7 +7027,7 @@ void textureStorage2D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_textureStorage2D* __restrict packet = (RenderCommand_textureStorage2D*)getNextPacket();
+	RenderCommand_textureStorage2D* __restrict packet = allocatePacket<RenderCommand_textureStorage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage2D::execute);
 	packet->texture = texture;
 	packet->levels = levels;
@@ -7043,7 +7043,7 @@ void textureStorage3D(
 	GLsizei height,
 	GLsizei depth)
 {
-	RenderCommand_textureStorage3D* __restrict packet = (RenderCommand_textureStorage3D*)getNextPacket();
+	RenderCommand_textureStorage3D* __restrict packet = allocatePacket<RenderCommand_textureStorage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage3D::execute);
 	packet->texture = texture;
 	packet->levels = levels;
@@ -7060,7 +7060,7 @@ void textureStorage2DMultisample(
 	GLsizei height,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_textureStorage2DMultisample* __restrict packet = (RenderCommand_textureStorage2DMultisample*)getNextPacket();
+	RenderCommand_textureStorage2DMultisample* __restrict packet = allocatePacket<RenderCommand_textureStorage2DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage2DMultisample::execute);
 	packet->texture = texture;
 	packet->samples = samples;
@@ -7078,7 +7078,7 @@ void textureStorage3DMultisample(
 	GLsizei depth,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_textureStorage3DMultisample* __restrict packet = (RenderCommand_textureStorage3DMultisample*)getNextPacket();
+	RenderCommand_textureStorage3DMultisample* __restrict packet = allocatePacket<RenderCommand_textureStorage3DMultisample>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage3DMultisample::execute);
 	packet->texture = texture;
 	packet->samples = samples;
@@ -7097,7 +7097,7 @@ void textureSubImage1D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage1D* __restrict packet = (RenderCommand_textureSubImage1D*)getNextPacket();
+	RenderCommand_textureSubImage1D* __restrict packet = allocatePacket<RenderCommand_textureSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage1D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7118,7 +7118,7 @@ void textureSubImage2D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage2D* __restrict packet = (RenderCommand_textureSubImage2D*)getNextPacket();
+	RenderCommand_textureSubImage2D* __restrict packet = allocatePacket<RenderCommand_textureSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage2D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7143,7 +7143,7 @@ void textureSubImage3D(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage3D* __restrict packet = (RenderCommand_textureSubImage3D*)getNextPacket();
+	RenderCommand_textureSubImage3D* __restrict packet = allocatePacket<RenderCommand_textureSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage3D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7166,7 +7166,7 @@ void compressedTextureSubImage1D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTextureSubImage1D* __restrict packet = (RenderCommand_compressedTextureSubImage1D*)getNextPacket();
+	RenderCommand_compressedTextureSubImage1D* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage1D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7187,7 +7187,7 @@ void compressedTextureSubImage2D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTextureSubImage2D* __restrict packet = (RenderCommand_compressedTextureSubImage2D*)getNextPacket();
+	RenderCommand_compressedTextureSubImage2D* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage2D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7212,7 +7212,7 @@ void compressedTextureSubImage3D(
 	GLsizei imageSize,
 	const void *data)
 {
-	RenderCommand_compressedTextureSubImage3D* __restrict packet = (RenderCommand_compressedTextureSubImage3D*)getNextPacket();
+	RenderCommand_compressedTextureSubImage3D* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage3D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7234,7 +7234,7 @@ void copyTextureSubImage1D(
 	GLint y,
 	GLsizei width)
 {
-	RenderCommand_copyTextureSubImage1D* __restrict packet = (RenderCommand_copyTextureSubImage1D*)getNextPacket();
+	RenderCommand_copyTextureSubImage1D* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage1D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage1D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7253,7 +7253,7 @@ void copyTextureSubImage2D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTextureSubImage2D* __restrict packet = (RenderCommand_copyTextureSubImage2D*)getNextPacket();
+	RenderCommand_copyTextureSubImage2D* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage2D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage2D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7275,7 +7275,7 @@ void copyTextureSubImage3D(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTextureSubImage3D* __restrict packet = (RenderCommand_copyTextureSubImage3D*)getNextPacket();
+	RenderCommand_copyTextureSubImage3D* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage3D>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage3D::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7292,7 +7292,7 @@ void textureParameterf(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_textureParameterf* __restrict packet = (RenderCommand_textureParameterf*)getNextPacket();
+	RenderCommand_textureParameterf* __restrict packet = allocatePacket<RenderCommand_textureParameterf>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterf::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7304,7 +7304,7 @@ void textureParameterfv(
 	GLenum pname,
 	const GLfloat (&param)[n])
 {
-	RenderCommand_textureParameterfv* __restrict packet = (RenderCommand_textureParameterfv*)getNextPacket();
+	RenderCommand_textureParameterfv* __restrict packet = allocatePacket<RenderCommand_textureParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterfv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7315,7 +7315,7 @@ void textureParameteri(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_textureParameteri* __restrict packet = (RenderCommand_textureParameteri*)getNextPacket();
+	RenderCommand_textureParameteri* __restrict packet = allocatePacket<RenderCommand_textureParameteri>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameteri::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7326,7 +7326,7 @@ void textureParameterIiv(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_textureParameterIiv* __restrict packet = (RenderCommand_textureParameterIiv*)getNextPacket();
+	RenderCommand_textureParameterIiv* __restrict packet = allocatePacket<RenderCommand_textureParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterIiv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7337,7 +7337,7 @@ void textureParameterIuiv(
 	GLenum pname,
 	const GLuint *params)
 {
-	RenderCommand_textureParameterIuiv* __restrict packet = (RenderCommand_textureParameterIuiv*)getNextPacket();
+	RenderCommand_textureParameterIuiv* __restrict packet = allocatePacket<RenderCommand_textureParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterIuiv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7348,7 +7348,7 @@ void textureParameteriv(
 	GLenum pname,
 	const GLint *param)
 {
-	RenderCommand_textureParameteriv* __restrict packet = (RenderCommand_textureParameteriv*)getNextPacket();
+	RenderCommand_textureParameteriv* __restrict packet = allocatePacket<RenderCommand_textureParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameteriv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7357,7 +7357,7 @@ void textureParameteriv(
 void generateTextureMipmap(
 	GLuint texture)
 {
-	RenderCommand_generateTextureMipmap* __restrict packet = (RenderCommand_generateTextureMipmap*)getNextPacket();
+	RenderCommand_generateTextureMipmap* __restrict packet = allocatePacket<RenderCommand_generateTextureMipmap>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_generateTextureMipmap::execute);
 	packet->texture = texture;
 }
@@ -7365,7 +7365,7 @@ void bindTextureUnit(
 	GLuint unit,
 	GLuint texture)
 {
-	RenderCommand_bindTextureUnit* __restrict packet = (RenderCommand_bindTextureUnit*)getNextPacket();
+	RenderCommand_bindTextureUnit* __restrict packet = allocatePacket<RenderCommand_bindTextureUnit>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindTextureUnit::execute);
 	packet->unit = unit;
 	packet->texture = texture;
@@ -7378,7 +7378,7 @@ void getTextureImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getTextureImage* __restrict packet = (RenderCommand_getTextureImage*)getNextPacket();
+	RenderCommand_getTextureImage* __restrict packet = allocatePacket<RenderCommand_getTextureImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7393,7 +7393,7 @@ void getCompressedTextureImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getCompressedTextureImage* __restrict packet = (RenderCommand_getCompressedTextureImage*)getNextPacket();
+	RenderCommand_getCompressedTextureImage* __restrict packet = allocatePacket<RenderCommand_getCompressedTextureImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCompressedTextureImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7406,7 +7406,7 @@ void getTextureLevelParameterfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTextureLevelParameterfv* __restrict packet = (RenderCommand_getTextureLevelParameterfv*)getNextPacket();
+	RenderCommand_getTextureLevelParameterfv* __restrict packet = allocatePacket<RenderCommand_getTextureLevelParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureLevelParameterfv::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7419,7 +7419,7 @@ void getTextureLevelParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureLevelParameteriv* __restrict packet = (RenderCommand_getTextureLevelParameteriv*)getNextPacket();
+	RenderCommand_getTextureLevelParameteriv* __restrict packet = allocatePacket<RenderCommand_getTextureLevelParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureLevelParameteriv::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7431,7 +7431,7 @@ void getTextureParameterfv(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTextureParameterfv* __restrict packet = (RenderCommand_getTextureParameterfv*)getNextPacket();
+	RenderCommand_getTextureParameterfv* __restrict packet = allocatePacket<RenderCommand_getTextureParameterfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterfv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7442,7 +7442,7 @@ void getTextureParameterIiv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureParameterIiv* __restrict packet = (RenderCommand_getTextureParameterIiv*)getNextPacket();
+	RenderCommand_getTextureParameterIiv* __restrict packet = allocatePacket<RenderCommand_getTextureParameterIiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterIiv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7453,7 +7453,7 @@ void getTextureParameterIuiv(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getTextureParameterIuiv* __restrict packet = (RenderCommand_getTextureParameterIuiv*)getNextPacket();
+	RenderCommand_getTextureParameterIuiv* __restrict packet = allocatePacket<RenderCommand_getTextureParameterIuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterIuiv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7464,7 +7464,7 @@ void getTextureParameteriv(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureParameteriv* __restrict packet = (RenderCommand_getTextureParameteriv*)getNextPacket();
+	RenderCommand_getTextureParameteriv* __restrict packet = allocatePacket<RenderCommand_getTextureParameteriv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameteriv::execute);
 	packet->texture = texture;
 	packet->pname = pname;
@@ -7474,7 +7474,7 @@ void createVertexArrays(
 	GLsizei n,
 	GLuint *arrays)
 {
-	RenderCommand_createVertexArrays* __restrict packet = (RenderCommand_createVertexArrays*)getNextPacket();
+	RenderCommand_createVertexArrays* __restrict packet = allocatePacket<RenderCommand_createVertexArrays>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createVertexArrays::execute);
 	packet->n = n;
 	packet->arrays = arrays;
@@ -7483,7 +7483,7 @@ void disableVertexArrayAttrib(
 	GLuint vaobj,
 	GLuint index)
 {
-	RenderCommand_disableVertexArrayAttrib* __restrict packet = (RenderCommand_disableVertexArrayAttrib*)getNextPacket();
+	RenderCommand_disableVertexArrayAttrib* __restrict packet = allocatePacket<RenderCommand_disableVertexArrayAttrib>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableVertexArrayAttrib::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -7492,7 +7492,7 @@ void enableVertexArrayAttrib(
 	GLuint vaobj,
 	GLuint index)
 {
-	RenderCommand_enableVertexArrayAttrib* __restrict packet = (RenderCommand_enableVertexArrayAttrib*)getNextPacket();
+	RenderCommand_enableVertexArrayAttrib* __restrict packet = allocatePacket<RenderCommand_enableVertexArrayAttrib>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableVertexArrayAttrib::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -7501,7 +7501,7 @@ void vertexArrayElementBuffer(
 	GLuint vaobj,
 	GLuint buffer)
 {
-	RenderCommand_vertexArrayElementBuffer* __restrict packet = (RenderCommand_vertexArrayElementBuffer*)getNextPacket();
+	RenderCommand_vertexArrayElementBuffer* __restrict packet = allocatePacket<RenderCommand_vertexArrayElementBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayElementBuffer::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -7513,7 +7513,7 @@ void vertexArrayVertexBuffer(
 	GLintptr offset,
 	GLsizei stride)
 {
-	RenderCommand_vertexArrayVertexBuffer* __restrict packet = (RenderCommand_vertexArrayVertexBuffer*)getNextPacket();
+	RenderCommand_vertexArrayVertexBuffer* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexBuffer>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexBuffer::execute);
 	packet->vaobj = vaobj;
 	packet->bindingindex = bindingindex;
@@ -7529,7 +7529,7 @@ void vertexArrayVertexBuffers(
 	const GLintptr *offsets,
 	const GLsizei *strides)
 {
-	RenderCommand_vertexArrayVertexBuffers* __restrict packet = (RenderCommand_vertexArrayVertexBuffers*)getNextPacket();
+	RenderCommand_vertexArrayVertexBuffers* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexBuffers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexBuffers::execute);
 	packet->vaobj = vaobj;
 	packet->first = first;
@@ -7543,7 +7543,7 @@ void vertexArrayAttribBinding(
 	GLuint attribindex,
 	GLuint bindingindex)
 {
-	RenderCommand_vertexArrayAttribBinding* __restrict packet = (RenderCommand_vertexArrayAttribBinding*)getNextPacket();
+	RenderCommand_vertexArrayAttribBinding* __restrict packet = allocatePacket<RenderCommand_vertexArrayAttribBinding>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayAttribBinding::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -7557,7 +7557,7 @@ void vertexArrayAttribFormat(
 	GLboolean normalized,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayAttribFormat* __restrict packet = (RenderCommand_vertexArrayAttribFormat*)getNextPacket();
+	RenderCommand_vertexArrayAttribFormat* __restrict packet = allocatePacket<RenderCommand_vertexArrayAttribFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayAttribFormat::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -7573,7 +7573,7 @@ void vertexArrayAttribIFormat(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayAttribIFormat* __restrict packet = (RenderCommand_vertexArrayAttribIFormat*)getNextPacket();
+	RenderCommand_vertexArrayAttribIFormat* __restrict packet = allocatePacket<RenderCommand_vertexArrayAttribIFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayAttribIFormat::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -7588,7 +7588,7 @@ void vertexArrayAttribLFormat(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayAttribLFormat* __restrict packet = (RenderCommand_vertexArrayAttribLFormat*)getNextPacket();
+	RenderCommand_vertexArrayAttribLFormat* __restrict packet = allocatePacket<RenderCommand_vertexArrayAttribLFormat>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayAttribLFormat::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -7601,7 +7601,7 @@ void vertexArrayBindingDivisor(
 	GLuint bindingindex,
 	GLuint divisor)
 {
-	RenderCommand_vertexArrayBindingDivisor* __restrict packet = (RenderCommand_vertexArrayBindingDivisor*)getNextPacket();
+	RenderCommand_vertexArrayBindingDivisor* __restrict packet = allocatePacket<RenderCommand_vertexArrayBindingDivisor>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayBindingDivisor::execute);
 	packet->vaobj = vaobj;
 	packet->bindingindex = bindingindex;
@@ -7612,7 +7612,7 @@ void getVertexArrayiv(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getVertexArrayiv* __restrict packet = (RenderCommand_getVertexArrayiv*)getNextPacket();
+	RenderCommand_getVertexArrayiv* __restrict packet = allocatePacket<RenderCommand_getVertexArrayiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayiv::execute);
 	packet->vaobj = vaobj;
 	packet->pname = pname;
@@ -7624,7 +7624,7 @@ void getVertexArrayIndexediv(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getVertexArrayIndexediv* __restrict packet = (RenderCommand_getVertexArrayIndexediv*)getNextPacket();
+	RenderCommand_getVertexArrayIndexediv* __restrict packet = allocatePacket<RenderCommand_getVertexArrayIndexediv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayIndexediv::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -7637,7 +7637,7 @@ void getVertexArrayIndexed64iv(
 	GLenum pname,
 	GLint64 *param)
 {
-	RenderCommand_getVertexArrayIndexed64iv* __restrict packet = (RenderCommand_getVertexArrayIndexed64iv*)getNextPacket();
+	RenderCommand_getVertexArrayIndexed64iv* __restrict packet = allocatePacket<RenderCommand_getVertexArrayIndexed64iv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayIndexed64iv::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -7648,7 +7648,7 @@ void createSamplers(
 	GLsizei n,
 	GLuint *samplers)
 {
-	RenderCommand_createSamplers* __restrict packet = (RenderCommand_createSamplers*)getNextPacket();
+	RenderCommand_createSamplers* __restrict packet = allocatePacket<RenderCommand_createSamplers>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createSamplers::execute);
 	packet->n = n;
 	packet->samplers = samplers;
@@ -7657,7 +7657,7 @@ void createProgramPipelines(
 	GLsizei n,
 	GLuint *pipelines)
 {
-	RenderCommand_createProgramPipelines* __restrict packet = (RenderCommand_createProgramPipelines*)getNextPacket();
+	RenderCommand_createProgramPipelines* __restrict packet = allocatePacket<RenderCommand_createProgramPipelines>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createProgramPipelines::execute);
 	packet->n = n;
 	packet->pipelines = pipelines;
@@ -7667,7 +7667,7 @@ void createQueries(
 	GLsizei n,
 	GLuint *ids)
 {
-	RenderCommand_createQueries* __restrict packet = (RenderCommand_createQueries*)getNextPacket();
+	RenderCommand_createQueries* __restrict packet = allocatePacket<RenderCommand_createQueries>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createQueries::execute);
 	packet->target = target;
 	packet->n = n;
@@ -7679,7 +7679,7 @@ void getQueryBufferObjecti64v(
 	GLenum pname,
 	GLintptr offset)
 {
-	RenderCommand_getQueryBufferObjecti64v* __restrict packet = (RenderCommand_getQueryBufferObjecti64v*)getNextPacket();
+	RenderCommand_getQueryBufferObjecti64v* __restrict packet = allocatePacket<RenderCommand_getQueryBufferObjecti64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryBufferObjecti64v::execute);
 	packet->id = id;
 	packet->buffer = buffer;
@@ -7692,7 +7692,7 @@ void getQueryBufferObjectiv(
 	GLenum pname,
 	GLintptr offset)
 {
-	RenderCommand_getQueryBufferObjectiv* __restrict packet = (RenderCommand_getQueryBufferObjectiv*)getNextPacket();
+	RenderCommand_getQueryBufferObjectiv* __restrict packet = allocatePacket<RenderCommand_getQueryBufferObjectiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryBufferObjectiv::execute);
 	packet->id = id;
 	packet->buffer = buffer;
@@ -7705,7 +7705,7 @@ void getQueryBufferObjectui64v(
 	GLenum pname,
 	GLintptr offset)
 {
-	RenderCommand_getQueryBufferObjectui64v* __restrict packet = (RenderCommand_getQueryBufferObjectui64v*)getNextPacket();
+	RenderCommand_getQueryBufferObjectui64v* __restrict packet = allocatePacket<RenderCommand_getQueryBufferObjectui64v>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryBufferObjectui64v::execute);
 	packet->id = id;
 	packet->buffer = buffer;
@@ -7718,7 +7718,7 @@ void getQueryBufferObjectuiv(
 	GLenum pname,
 	GLintptr offset)
 {
-	RenderCommand_getQueryBufferObjectuiv* __restrict packet = (RenderCommand_getQueryBufferObjectuiv*)getNextPacket();
+	RenderCommand_getQueryBufferObjectuiv* __restrict packet = allocatePacket<RenderCommand_getQueryBufferObjectuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getQueryBufferObjectuiv::execute);
 	packet->id = id;
 	packet->buffer = buffer;
@@ -7728,7 +7728,7 @@ void getQueryBufferObjectuiv(
 void memoryBarrierByRegion(
 	GLbitfield barriers)
 {
-	RenderCommand_memoryBarrierByRegion* __restrict packet = (RenderCommand_memoryBarrierByRegion*)getNextPacket();
+	RenderCommand_memoryBarrierByRegion* __restrict packet = allocatePacket<RenderCommand_memoryBarrierByRegion>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_memoryBarrierByRegion::execute);
 	packet->barriers = barriers;
 }
@@ -7746,7 +7746,7 @@ void getTextureSubImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getTextureSubImage* __restrict packet = (RenderCommand_getTextureSubImage*)getNextPacket();
+	RenderCommand_getTextureSubImage* __restrict packet = allocatePacket<RenderCommand_getTextureSubImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureSubImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7773,7 +7773,7 @@ void getCompressedTextureSubImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getCompressedTextureSubImage* __restrict packet = (RenderCommand_getCompressedTextureSubImage*)getNextPacket();
+	RenderCommand_getCompressedTextureSubImage* __restrict packet = allocatePacket<RenderCommand_getCompressedTextureSubImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCompressedTextureSubImage::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -7789,7 +7789,7 @@ void getCompressedTextureSubImage(
 GLenum getGraphicsResetStatus(
 	void)
 {
-	RenderCommand_getGraphicsResetStatus* __restrict packet = (RenderCommand_getGraphicsResetStatus*)getNextPacket();
+	RenderCommand_getGraphicsResetStatus* __restrict packet = allocatePacket<RenderCommand_getGraphicsResetStatus>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getGraphicsResetStatus::execute);
 }
 void getnCompressedTexImage(
@@ -7798,7 +7798,7 @@ void getnCompressedTexImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getnCompressedTexImage* __restrict packet = (RenderCommand_getnCompressedTexImage*)getNextPacket();
+	RenderCommand_getnCompressedTexImage* __restrict packet = allocatePacket<RenderCommand_getnCompressedTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnCompressedTexImage::execute);
 	packet->target = target;
 	packet->lod = lod;
@@ -7813,7 +7813,7 @@ void getnTexImage(
 	GLsizei bufSize,
 	void *pixels)
 {
-	RenderCommand_getnTexImage* __restrict packet = (RenderCommand_getnTexImage*)getNextPacket();
+	RenderCommand_getnTexImage* __restrict packet = allocatePacket<RenderCommand_getnTexImage>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnTexImage::execute);
 	packet->target = target;
 	packet->level = level;
@@ -7828,7 +7828,7 @@ void getnUniformdv(
 	GLsizei bufSize,
 	GLdouble *params)
 {
-	RenderCommand_getnUniformdv* __restrict packet = (RenderCommand_getnUniformdv*)getNextPacket();
+	RenderCommand_getnUniformdv* __restrict packet = allocatePacket<RenderCommand_getnUniformdv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformdv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -7841,7 +7841,7 @@ void getnUniformfv(
 	GLsizei bufSize,
 	GLfloat *params)
 {
-	RenderCommand_getnUniformfv* __restrict packet = (RenderCommand_getnUniformfv*)getNextPacket();
+	RenderCommand_getnUniformfv* __restrict packet = allocatePacket<RenderCommand_getnUniformfv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformfv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -7854,7 +7854,7 @@ void getnUniformiv(
 	GLsizei bufSize,
 	GLint *params)
 {
-	RenderCommand_getnUniformiv* __restrict packet = (RenderCommand_getnUniformiv*)getNextPacket();
+	RenderCommand_getnUniformiv* __restrict packet = allocatePacket<RenderCommand_getnUniformiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -7867,7 +7867,7 @@ void getnUniformuiv(
 	GLsizei bufSize,
 	GLuint *params)
 {
-	RenderCommand_getnUniformuiv* __restrict packet = (RenderCommand_getnUniformuiv*)getNextPacket();
+	RenderCommand_getnUniformuiv* __restrict packet = allocatePacket<RenderCommand_getnUniformuiv>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformuiv::execute);
 	packet->program = program;
 	packet->location = location;
@@ -7884,7 +7884,7 @@ void readnPixels(
 	GLsizei bufSize,
 	void *data)
 {
-	RenderCommand_readnPixels* __restrict packet = (RenderCommand_readnPixels*)getNextPacket();
+	RenderCommand_readnPixels* __restrict packet = allocatePacket<RenderCommand_readnPixels>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_readnPixels::execute);
 	packet->x = x;
 	packet->y = y;
@@ -7898,7 +7898,7 @@ void readnPixels(
 void textureBarrier(
 	void)
 {
-	RenderCommand_textureBarrier* __restrict packet = (RenderCommand_textureBarrier*)getNextPacket();
+	RenderCommand_textureBarrier* __restrict packet = allocatePacket<RenderCommand_textureBarrier>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBarrier::execute);
 }
 void specializeShader(
@@ -7908,7 +7908,7 @@ void specializeShader(
 	const GLuint *pConstantIndex,
 	const GLuint *pConstantValue)
 {
-	RenderCommand_specializeShader* __restrict packet = (RenderCommand_specializeShader*)getNextPacket();
+	RenderCommand_specializeShader* __restrict packet = allocatePacket<RenderCommand_specializeShader>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_specializeShader::execute);
 	packet->shader = shader;
 	packet->pEntryPoint = pEntryPoint;
@@ -7923,7 +7923,7 @@ void multiDrawArraysIndirectCount(
 	GLsizei maxdrawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawArraysIndirectCount* __restrict packet = (RenderCommand_multiDrawArraysIndirectCount*)getNextPacket();
+	RenderCommand_multiDrawArraysIndirectCount* __restrict packet = allocatePacket<RenderCommand_multiDrawArraysIndirectCount>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArraysIndirectCount::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -7939,7 +7939,7 @@ void multiDrawElementsIndirectCount(
 	GLsizei maxdrawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawElementsIndirectCount* __restrict packet = (RenderCommand_multiDrawElementsIndirectCount*)getNextPacket();
+	RenderCommand_multiDrawElementsIndirectCount* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsIndirectCount>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsIndirectCount::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -7953,7 +7953,7 @@ void polygonOffsetClamp(
 	GLfloat units,
 	GLfloat clamp)
 {
-	RenderCommand_polygonOffsetClamp* __restrict packet = (RenderCommand_polygonOffsetClamp*)getNextPacket();
+	RenderCommand_polygonOffsetClamp* __restrict packet = allocatePacket<RenderCommand_polygonOffsetClamp>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_polygonOffsetClamp::execute);
 	packet->factor = factor;
 	packet->units = units;
@@ -7969,7 +7969,7 @@ void primitiveBoundingBoxARB(
 	GLfloat maxZ,
 	GLfloat maxW)
 {
-	RenderCommand_primitiveBoundingBoxARB* __restrict packet = (RenderCommand_primitiveBoundingBoxARB*)getNextPacket();
+	RenderCommand_primitiveBoundingBoxARB* __restrict packet = allocatePacket<RenderCommand_primitiveBoundingBoxARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_primitiveBoundingBoxARB::execute);
 	packet->minX = minX;
 	packet->minY = minY;
@@ -7983,7 +7983,7 @@ void primitiveBoundingBoxARB(
 GLuint64 getTextureHandleARB(
 	GLuint texture)
 {
-	RenderCommand_getTextureHandleARB* __restrict packet = (RenderCommand_getTextureHandleARB*)getNextPacket();
+	RenderCommand_getTextureHandleARB* __restrict packet = allocatePacket<RenderCommand_getTextureHandleARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureHandleARB::execute);
 	packet->texture = texture;
 }
@@ -7991,7 +7991,7 @@ GLuint64 getTextureSamplerHandleARB(
 	GLuint texture,
 	GLuint sampler)
 {
-	RenderCommand_getTextureSamplerHandleARB* __restrict packet = (RenderCommand_getTextureSamplerHandleARB*)getNextPacket();
+	RenderCommand_getTextureSamplerHandleARB* __restrict packet = allocatePacket<RenderCommand_getTextureSamplerHandleARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureSamplerHandleARB::execute);
 	packet->texture = texture;
 	packet->sampler = sampler;
@@ -7999,14 +7999,14 @@ GLuint64 getTextureSamplerHandleARB(
 void makeTextureHandleResidentARB(
 	GLuint64 handle)
 {
-	RenderCommand_makeTextureHandleResidentARB* __restrict packet = (RenderCommand_makeTextureHandleResidentARB*)getNextPacket();
+	RenderCommand_makeTextureHandleResidentARB* __restrict packet = allocatePacket<RenderCommand_makeTextureHandleResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeTextureHandleResidentARB::execute);
 	packet->handle = handle;
 }
 void makeTextureHandleNonResidentARB(
 	GLuint64 handle)
 {
-	RenderCommand_makeTextureHandleNonResidentARB* __restrict packet = (RenderCommand_makeTextureHandleNonResidentARB*)getNextPacket();
+	RenderCommand_makeTextureHandleNonResidentARB* __restrict packet = allocatePacket<RenderCommand_makeTextureHandleNonResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeTextureHandleNonResidentARB::execute);
 	packet->handle = handle;
 }
@@ -8017,7 +8017,7 @@ GLuint64 getImageHandleARB(
 	GLint layer,
 	GLenum format)
 {
-	RenderCommand_getImageHandleARB* __restrict packet = (RenderCommand_getImageHandleARB*)getNextPacket();
+	RenderCommand_getImageHandleARB* __restrict packet = allocatePacket<RenderCommand_getImageHandleARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getImageHandleARB::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -8029,7 +8029,7 @@ void makeImageHandleResidentARB(
 	GLuint64 handle,
 	GLenum access)
 {
-	RenderCommand_makeImageHandleResidentARB* __restrict packet = (RenderCommand_makeImageHandleResidentARB*)getNextPacket();
+	RenderCommand_makeImageHandleResidentARB* __restrict packet = allocatePacket<RenderCommand_makeImageHandleResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeImageHandleResidentARB::execute);
 	packet->handle = handle;
 	packet->access = access;
@@ -8037,7 +8037,7 @@ void makeImageHandleResidentARB(
 void makeImageHandleNonResidentARB(
 	GLuint64 handle)
 {
-	RenderCommand_makeImageHandleNonResidentARB* __restrict packet = (RenderCommand_makeImageHandleNonResidentARB*)getNextPacket();
+	RenderCommand_makeImageHandleNonResidentARB* __restrict packet = allocatePacket<RenderCommand_makeImageHandleNonResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeImageHandleNonResidentARB::execute);
 	packet->handle = handle;
 }
@@ -8045,7 +8045,7 @@ void uniformHandleui64ARB(
 	GLint location,
 	GLuint64 value)
 {
-	RenderCommand_uniformHandleui64ARB* __restrict packet = (RenderCommand_uniformHandleui64ARB*)getNextPacket();
+	RenderCommand_uniformHandleui64ARB* __restrict packet = allocatePacket<RenderCommand_uniformHandleui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformHandleui64ARB::execute);
 	packet->location = location;
 	packet->value = value;
@@ -8055,7 +8055,7 @@ void uniformHandleui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniformHandleui64vARB* __restrict packet = (RenderCommand_uniformHandleui64vARB*)getNextPacket();
+	RenderCommand_uniformHandleui64vARB* __restrict packet = allocatePacket<RenderCommand_uniformHandleui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformHandleui64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8066,7 +8066,7 @@ void programUniformHandleui64ARB(
 	GLint location,
 	GLuint64 value)
 {
-	RenderCommand_programUniformHandleui64ARB* __restrict packet = (RenderCommand_programUniformHandleui64ARB*)getNextPacket();
+	RenderCommand_programUniformHandleui64ARB* __restrict packet = allocatePacket<RenderCommand_programUniformHandleui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformHandleui64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8078,7 +8078,7 @@ void programUniformHandleui64vARB(
 	GLsizei count,
 	const GLuint64 *values)
 {
-	RenderCommand_programUniformHandleui64vARB* __restrict packet = (RenderCommand_programUniformHandleui64vARB*)getNextPacket();
+	RenderCommand_programUniformHandleui64vARB* __restrict packet = allocatePacket<RenderCommand_programUniformHandleui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformHandleui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8088,14 +8088,14 @@ void programUniformHandleui64vARB(
 GLboolean isTextureHandleResidentARB(
 	GLuint64 handle)
 {
-	RenderCommand_isTextureHandleResidentARB* __restrict packet = (RenderCommand_isTextureHandleResidentARB*)getNextPacket();
+	RenderCommand_isTextureHandleResidentARB* __restrict packet = allocatePacket<RenderCommand_isTextureHandleResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isTextureHandleResidentARB::execute);
 	packet->handle = handle;
 }
 GLboolean isImageHandleResidentARB(
 	GLuint64 handle)
 {
-	RenderCommand_isImageHandleResidentARB* __restrict packet = (RenderCommand_isImageHandleResidentARB*)getNextPacket();
+	RenderCommand_isImageHandleResidentARB* __restrict packet = allocatePacket<RenderCommand_isImageHandleResidentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isImageHandleResidentARB::execute);
 	packet->handle = handle;
 }
@@ -8103,7 +8103,7 @@ void vertexAttribL1ui64ARB(
 	GLuint index,
 	GLuint64EXT x)
 {
-	RenderCommand_vertexAttribL1ui64ARB* __restrict packet = (RenderCommand_vertexAttribL1ui64ARB*)getNextPacket();
+	RenderCommand_vertexAttribL1ui64ARB* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1ui64ARB::execute);
 	packet->index = index;
 	packet->x = x;
@@ -8112,7 +8112,7 @@ void vertexAttribL1ui64vARB(
 	GLuint index,
 	const GLuint64EXT *v)
 {
-	RenderCommand_vertexAttribL1ui64vARB* __restrict packet = (RenderCommand_vertexAttribL1ui64vARB*)getNextPacket();
+	RenderCommand_vertexAttribL1ui64vARB* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1ui64vARB::execute);
 	packet->index = index;
 	packet->v = v;
@@ -8122,7 +8122,7 @@ void getVertexAttribLui64vARB(
 	GLenum pname,
 	GLuint64EXT *params)
 {
-	RenderCommand_getVertexAttribLui64vARB* __restrict packet = (RenderCommand_getVertexAttribLui64vARB*)getNextPacket();
+	RenderCommand_getVertexAttribLui64vARB* __restrict packet = allocatePacket<RenderCommand_getVertexAttribLui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribLui64vARB::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -8133,7 +8133,7 @@ GLsync createSyncFromCLeventARB(
 	struct _cl_event *event,
 	GLbitfield flags)
 {
-	RenderCommand_createSyncFromCLeventARB* __restrict packet = (RenderCommand_createSyncFromCLeventARB*)getNextPacket();
+	RenderCommand_createSyncFromCLeventARB* __restrict packet = allocatePacket<RenderCommand_createSyncFromCLeventARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createSyncFromCLeventARB::execute);
 	packet->context = context;
 	packet->event = event;
@@ -8147,7 +8147,7 @@ void dispatchComputeGroupSizeARB(
 	GLuint group_size_y,
 	GLuint group_size_z)
 {
-	RenderCommand_dispatchComputeGroupSizeARB* __restrict packet = (RenderCommand_dispatchComputeGroupSizeARB*)getNextPacket();
+	RenderCommand_dispatchComputeGroupSizeARB* __restrict packet = allocatePacket<RenderCommand_dispatchComputeGroupSizeARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_dispatchComputeGroupSizeARB::execute);
 	packet->num_groups_x = num_groups_x;
 	packet->num_groups_y = num_groups_y;
@@ -8164,7 +8164,7 @@ void debugMessageControlARB(
 	const GLuint *ids,
 	GLboolean enabled)
 {
-	RenderCommand_debugMessageControlARB* __restrict packet = (RenderCommand_debugMessageControlARB*)getNextPacket();
+	RenderCommand_debugMessageControlARB* __restrict packet = allocatePacket<RenderCommand_debugMessageControlARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageControlARB::execute);
 	packet->source = source;
 	packet->type = type;
@@ -8181,7 +8181,7 @@ void debugMessageInsertARB(
 	GLsizei length,
 	const GLchar *buf)
 {
-	RenderCommand_debugMessageInsertARB* __restrict packet = (RenderCommand_debugMessageInsertARB*)getNextPacket();
+	RenderCommand_debugMessageInsertARB* __restrict packet = allocatePacket<RenderCommand_debugMessageInsertARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageInsertARB::execute);
 	packet->source = source;
 	packet->type = type;
@@ -8194,7 +8194,7 @@ void debugMessageCallbackARB(
 	GLDEBUGPROCARB callback,
 	const void *userParam)
 {
-	RenderCommand_debugMessageCallbackARB* __restrict packet = (RenderCommand_debugMessageCallbackARB*)getNextPacket();
+	RenderCommand_debugMessageCallbackARB* __restrict packet = allocatePacket<RenderCommand_debugMessageCallbackARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_debugMessageCallbackARB::execute);
 	packet->callback = callback;
 	packet->userParam = userParam;
@@ -8209,7 +8209,7 @@ GLuint getDebugMessageLogARB(
 	GLsizei *lengths,
 	GLchar *messageLog)
 {
-	RenderCommand_getDebugMessageLogARB* __restrict packet = (RenderCommand_getDebugMessageLogARB*)getNextPacket();
+	RenderCommand_getDebugMessageLogARB* __restrict packet = allocatePacket<RenderCommand_getDebugMessageLogARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDebugMessageLogARB::execute);
 	packet->count = count;
 	packet->bufSize = bufSize;
@@ -8224,7 +8224,7 @@ void blendEquationiARB(
 	GLuint buf,
 	GLenum mode)
 {
-	RenderCommand_blendEquationiARB* __restrict packet = (RenderCommand_blendEquationiARB*)getNextPacket();
+	RenderCommand_blendEquationiARB* __restrict packet = allocatePacket<RenderCommand_blendEquationiARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquationiARB::execute);
 	packet->buf = buf;
 	packet->mode = mode;
@@ -8234,7 +8234,7 @@ void blendEquationSeparateiARB(
 	GLenum modeRGB,
 	GLenum modeAlpha)
 {
-	RenderCommand_blendEquationSeparateiARB* __restrict packet = (RenderCommand_blendEquationSeparateiARB*)getNextPacket();
+	RenderCommand_blendEquationSeparateiARB* __restrict packet = allocatePacket<RenderCommand_blendEquationSeparateiARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendEquationSeparateiARB::execute);
 	packet->buf = buf;
 	packet->modeRGB = modeRGB;
@@ -8245,7 +8245,7 @@ void blendFunciARB(
 	GLenum src,
 	GLenum dst)
 {
-	RenderCommand_blendFunciARB* __restrict packet = (RenderCommand_blendFunciARB*)getNextPacket();
+	RenderCommand_blendFunciARB* __restrict packet = allocatePacket<RenderCommand_blendFunciARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFunciARB::execute);
 	packet->buf = buf;
 	packet->src = src;
@@ -8258,7 +8258,7 @@ void blendFuncSeparateiARB(
 	GLenum srcAlpha,
 	GLenum dstAlpha)
 {
-	RenderCommand_blendFuncSeparateiARB* __restrict packet = (RenderCommand_blendFuncSeparateiARB*)getNextPacket();
+	RenderCommand_blendFuncSeparateiARB* __restrict packet = allocatePacket<RenderCommand_blendFuncSeparateiARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendFuncSeparateiARB::execute);
 	packet->buf = buf;
 	packet->srcRGB = srcRGB;
@@ -8272,7 +8272,7 @@ void drawArraysInstancedARB(
 	GLsizei count,
 	GLsizei primcount)
 {
-	RenderCommand_drawArraysInstancedARB* __restrict packet = (RenderCommand_drawArraysInstancedARB*)getNextPacket();
+	RenderCommand_drawArraysInstancedARB* __restrict packet = allocatePacket<RenderCommand_drawArraysInstancedARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArraysInstancedARB::execute);
 	packet->mode = mode;
 	packet->first = first;
@@ -8286,7 +8286,7 @@ void drawElementsInstancedARB(
 	const void *indices,
 	GLsizei primcount)
 {
-	RenderCommand_drawElementsInstancedARB* __restrict packet = (RenderCommand_drawElementsInstancedARB*)getNextPacket();
+	RenderCommand_drawElementsInstancedARB* __restrict packet = allocatePacket<RenderCommand_drawElementsInstancedARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstancedARB::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -8299,7 +8299,7 @@ void programParameteriARB(
 	GLenum pname,
 	GLint value)
 {
-	RenderCommand_programParameteriARB* __restrict packet = (RenderCommand_programParameteriARB*)getNextPacket();
+	RenderCommand_programParameteriARB* __restrict packet = allocatePacket<RenderCommand_programParameteriARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programParameteriARB::execute);
 	packet->program = program;
 	packet->pname = pname;
@@ -8311,7 +8311,7 @@ void framebufferTextureARB(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_framebufferTextureARB* __restrict packet = (RenderCommand_framebufferTextureARB*)getNextPacket();
+	RenderCommand_framebufferTextureARB* __restrict packet = allocatePacket<RenderCommand_framebufferTextureARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTextureARB::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -8325,7 +8325,7 @@ void framebufferTextureLayerARB(
 	GLint level,
 	GLint layer)
 {
-	RenderCommand_framebufferTextureLayerARB* __restrict packet = (RenderCommand_framebufferTextureLayerARB*)getNextPacket();
+	RenderCommand_framebufferTextureLayerARB* __restrict packet = allocatePacket<RenderCommand_framebufferTextureLayerARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTextureLayerARB::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -8340,7 +8340,7 @@ void framebufferTextureFaceARB(
 	GLint level,
 	GLenum face)
 {
-	RenderCommand_framebufferTextureFaceARB* __restrict packet = (RenderCommand_framebufferTextureFaceARB*)getNextPacket();
+	RenderCommand_framebufferTextureFaceARB* __restrict packet = allocatePacket<RenderCommand_framebufferTextureFaceARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTextureFaceARB::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -8355,7 +8355,7 @@ void specializeShaderARB(
 	const GLuint *pConstantIndex,
 	const GLuint *pConstantValue)
 {
-	RenderCommand_specializeShaderARB* __restrict packet = (RenderCommand_specializeShaderARB*)getNextPacket();
+	RenderCommand_specializeShaderARB* __restrict packet = allocatePacket<RenderCommand_specializeShaderARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_specializeShaderARB::execute);
 	packet->shader = shader;
 	packet->pEntryPoint = pEntryPoint;
@@ -8367,7 +8367,7 @@ void uniform1i64ARB(
 	GLint location,
 	GLint64 x)
 {
-	RenderCommand_uniform1i64ARB* __restrict packet = (RenderCommand_uniform1i64ARB*)getNextPacket();
+	RenderCommand_uniform1i64ARB* __restrict packet = allocatePacket<RenderCommand_uniform1i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1i64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8377,7 +8377,7 @@ void uniform2i64ARB(
 	GLint64 x,
 	GLint64 y)
 {
-	RenderCommand_uniform2i64ARB* __restrict packet = (RenderCommand_uniform2i64ARB*)getNextPacket();
+	RenderCommand_uniform2i64ARB* __restrict packet = allocatePacket<RenderCommand_uniform2i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2i64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8389,7 +8389,7 @@ void uniform3i64ARB(
 	GLint64 y,
 	GLint64 z)
 {
-	RenderCommand_uniform3i64ARB* __restrict packet = (RenderCommand_uniform3i64ARB*)getNextPacket();
+	RenderCommand_uniform3i64ARB* __restrict packet = allocatePacket<RenderCommand_uniform3i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3i64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8403,7 +8403,7 @@ void uniform4i64ARB(
 	GLint64 z,
 	GLint64 w)
 {
-	RenderCommand_uniform4i64ARB* __restrict packet = (RenderCommand_uniform4i64ARB*)getNextPacket();
+	RenderCommand_uniform4i64ARB* __restrict packet = allocatePacket<RenderCommand_uniform4i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4i64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8416,7 +8416,7 @@ void uniform1i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_uniform1i64vARB* __restrict packet = (RenderCommand_uniform1i64vARB*)getNextPacket();
+	RenderCommand_uniform1i64vARB* __restrict packet = allocatePacket<RenderCommand_uniform1i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1i64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8427,7 +8427,7 @@ void uniform2i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_uniform2i64vARB* __restrict packet = (RenderCommand_uniform2i64vARB*)getNextPacket();
+	RenderCommand_uniform2i64vARB* __restrict packet = allocatePacket<RenderCommand_uniform2i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2i64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8438,7 +8438,7 @@ void uniform3i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_uniform3i64vARB* __restrict packet = (RenderCommand_uniform3i64vARB*)getNextPacket();
+	RenderCommand_uniform3i64vARB* __restrict packet = allocatePacket<RenderCommand_uniform3i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3i64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8449,7 +8449,7 @@ void uniform4i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_uniform4i64vARB* __restrict packet = (RenderCommand_uniform4i64vARB*)getNextPacket();
+	RenderCommand_uniform4i64vARB* __restrict packet = allocatePacket<RenderCommand_uniform4i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4i64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8459,7 +8459,7 @@ void uniform1ui64ARB(
 	GLint location,
 	GLuint64 x)
 {
-	RenderCommand_uniform1ui64ARB* __restrict packet = (RenderCommand_uniform1ui64ARB*)getNextPacket();
+	RenderCommand_uniform1ui64ARB* __restrict packet = allocatePacket<RenderCommand_uniform1ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1ui64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8469,7 +8469,7 @@ void uniform2ui64ARB(
 	GLuint64 x,
 	GLuint64 y)
 {
-	RenderCommand_uniform2ui64ARB* __restrict packet = (RenderCommand_uniform2ui64ARB*)getNextPacket();
+	RenderCommand_uniform2ui64ARB* __restrict packet = allocatePacket<RenderCommand_uniform2ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2ui64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8481,7 +8481,7 @@ void uniform3ui64ARB(
 	GLuint64 y,
 	GLuint64 z)
 {
-	RenderCommand_uniform3ui64ARB* __restrict packet = (RenderCommand_uniform3ui64ARB*)getNextPacket();
+	RenderCommand_uniform3ui64ARB* __restrict packet = allocatePacket<RenderCommand_uniform3ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3ui64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8495,7 +8495,7 @@ void uniform4ui64ARB(
 	GLuint64 z,
 	GLuint64 w)
 {
-	RenderCommand_uniform4ui64ARB* __restrict packet = (RenderCommand_uniform4ui64ARB*)getNextPacket();
+	RenderCommand_uniform4ui64ARB* __restrict packet = allocatePacket<RenderCommand_uniform4ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4ui64ARB::execute);
 	packet->location = location;
 	packet->x = x;
@@ -8508,7 +8508,7 @@ void uniform1ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniform1ui64vARB* __restrict packet = (RenderCommand_uniform1ui64vARB*)getNextPacket();
+	RenderCommand_uniform1ui64vARB* __restrict packet = allocatePacket<RenderCommand_uniform1ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1ui64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8519,7 +8519,7 @@ void uniform2ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniform2ui64vARB* __restrict packet = (RenderCommand_uniform2ui64vARB*)getNextPacket();
+	RenderCommand_uniform2ui64vARB* __restrict packet = allocatePacket<RenderCommand_uniform2ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2ui64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8530,7 +8530,7 @@ void uniform3ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniform3ui64vARB* __restrict packet = (RenderCommand_uniform3ui64vARB*)getNextPacket();
+	RenderCommand_uniform3ui64vARB* __restrict packet = allocatePacket<RenderCommand_uniform3ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3ui64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8541,7 +8541,7 @@ void uniform4ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniform4ui64vARB* __restrict packet = (RenderCommand_uniform4ui64vARB*)getNextPacket();
+	RenderCommand_uniform4ui64vARB* __restrict packet = allocatePacket<RenderCommand_uniform4ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4ui64vARB::execute);
 	packet->location = location;
 	packet->count = count;
@@ -8552,7 +8552,7 @@ void getUniformi64vARB(
 	GLint location,
 	GLint64 *params)
 {
-	RenderCommand_getUniformi64vARB* __restrict packet = (RenderCommand_getUniformi64vARB*)getNextPacket();
+	RenderCommand_getUniformi64vARB* __restrict packet = allocatePacket<RenderCommand_getUniformi64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformi64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8563,7 +8563,7 @@ void getUniformui64vARB(
 	GLint location,
 	GLuint64 *params)
 {
-	RenderCommand_getUniformui64vARB* __restrict packet = (RenderCommand_getUniformui64vARB*)getNextPacket();
+	RenderCommand_getUniformui64vARB* __restrict packet = allocatePacket<RenderCommand_getUniformui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8575,7 +8575,7 @@ void getnUniformi64vARB(
 	GLsizei bufSize,
 	GLint64 *params)
 {
-	RenderCommand_getnUniformi64vARB* __restrict packet = (RenderCommand_getnUniformi64vARB*)getNextPacket();
+	RenderCommand_getnUniformi64vARB* __restrict packet = allocatePacket<RenderCommand_getnUniformi64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformi64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8588,7 +8588,7 @@ void getnUniformui64vARB(
 	GLsizei bufSize,
 	GLuint64 *params)
 {
-	RenderCommand_getnUniformui64vARB* __restrict packet = (RenderCommand_getnUniformui64vARB*)getNextPacket();
+	RenderCommand_getnUniformui64vARB* __restrict packet = allocatePacket<RenderCommand_getnUniformui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8600,7 +8600,7 @@ void programUniform1i64ARB(
 	GLint location,
 	GLint64 x)
 {
-	RenderCommand_programUniform1i64ARB* __restrict packet = (RenderCommand_programUniform1i64ARB*)getNextPacket();
+	RenderCommand_programUniform1i64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform1i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1i64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8612,7 +8612,7 @@ void programUniform2i64ARB(
 	GLint64 x,
 	GLint64 y)
 {
-	RenderCommand_programUniform2i64ARB* __restrict packet = (RenderCommand_programUniform2i64ARB*)getNextPacket();
+	RenderCommand_programUniform2i64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform2i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2i64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8626,7 +8626,7 @@ void programUniform3i64ARB(
 	GLint64 y,
 	GLint64 z)
 {
-	RenderCommand_programUniform3i64ARB* __restrict packet = (RenderCommand_programUniform3i64ARB*)getNextPacket();
+	RenderCommand_programUniform3i64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform3i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3i64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8642,7 +8642,7 @@ void programUniform4i64ARB(
 	GLint64 z,
 	GLint64 w)
 {
-	RenderCommand_programUniform4i64ARB* __restrict packet = (RenderCommand_programUniform4i64ARB*)getNextPacket();
+	RenderCommand_programUniform4i64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform4i64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4i64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8657,7 +8657,7 @@ void programUniform1i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_programUniform1i64vARB* __restrict packet = (RenderCommand_programUniform1i64vARB*)getNextPacket();
+	RenderCommand_programUniform1i64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform1i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1i64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8670,7 +8670,7 @@ void programUniform2i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_programUniform2i64vARB* __restrict packet = (RenderCommand_programUniform2i64vARB*)getNextPacket();
+	RenderCommand_programUniform2i64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform2i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2i64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8683,7 +8683,7 @@ void programUniform3i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_programUniform3i64vARB* __restrict packet = (RenderCommand_programUniform3i64vARB*)getNextPacket();
+	RenderCommand_programUniform3i64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform3i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3i64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8696,7 +8696,7 @@ void programUniform4i64vARB(
 	GLsizei count,
 	const GLint64 *value)
 {
-	RenderCommand_programUniform4i64vARB* __restrict packet = (RenderCommand_programUniform4i64vARB*)getNextPacket();
+	RenderCommand_programUniform4i64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform4i64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4i64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8708,7 +8708,7 @@ void programUniform1ui64ARB(
 	GLint location,
 	GLuint64 x)
 {
-	RenderCommand_programUniform1ui64ARB* __restrict packet = (RenderCommand_programUniform1ui64ARB*)getNextPacket();
+	RenderCommand_programUniform1ui64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform1ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ui64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8720,7 +8720,7 @@ void programUniform2ui64ARB(
 	GLuint64 x,
 	GLuint64 y)
 {
-	RenderCommand_programUniform2ui64ARB* __restrict packet = (RenderCommand_programUniform2ui64ARB*)getNextPacket();
+	RenderCommand_programUniform2ui64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform2ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ui64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8734,7 +8734,7 @@ void programUniform3ui64ARB(
 	GLuint64 y,
 	GLuint64 z)
 {
-	RenderCommand_programUniform3ui64ARB* __restrict packet = (RenderCommand_programUniform3ui64ARB*)getNextPacket();
+	RenderCommand_programUniform3ui64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform3ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ui64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8750,7 +8750,7 @@ void programUniform4ui64ARB(
 	GLuint64 z,
 	GLuint64 w)
 {
-	RenderCommand_programUniform4ui64ARB* __restrict packet = (RenderCommand_programUniform4ui64ARB*)getNextPacket();
+	RenderCommand_programUniform4ui64ARB* __restrict packet = allocatePacket<RenderCommand_programUniform4ui64ARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ui64ARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8765,7 +8765,7 @@ void programUniform1ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_programUniform1ui64vARB* __restrict packet = (RenderCommand_programUniform1ui64vARB*)getNextPacket();
+	RenderCommand_programUniform1ui64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform1ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8778,7 +8778,7 @@ void programUniform2ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_programUniform2ui64vARB* __restrict packet = (RenderCommand_programUniform2ui64vARB*)getNextPacket();
+	RenderCommand_programUniform2ui64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform2ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8791,7 +8791,7 @@ void programUniform3ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_programUniform3ui64vARB* __restrict packet = (RenderCommand_programUniform3ui64vARB*)getNextPacket();
+	RenderCommand_programUniform3ui64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform3ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8804,7 +8804,7 @@ void programUniform4ui64vARB(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_programUniform4ui64vARB* __restrict packet = (RenderCommand_programUniform4ui64vARB*)getNextPacket();
+	RenderCommand_programUniform4ui64vARB* __restrict packet = allocatePacket<RenderCommand_programUniform4ui64vARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ui64vARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8818,7 +8818,7 @@ void multiDrawArraysIndirectCountARB(
 	GLsizei maxdrawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawArraysIndirectCountARB* __restrict packet = (RenderCommand_multiDrawArraysIndirectCountARB*)getNextPacket();
+	RenderCommand_multiDrawArraysIndirectCountARB* __restrict packet = allocatePacket<RenderCommand_multiDrawArraysIndirectCountARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArraysIndirectCountARB::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -8834,7 +8834,7 @@ void multiDrawElementsIndirectCountARB(
 	GLsizei maxdrawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawElementsIndirectCountARB* __restrict packet = (RenderCommand_multiDrawElementsIndirectCountARB*)getNextPacket();
+	RenderCommand_multiDrawElementsIndirectCountARB* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsIndirectCountARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsIndirectCountARB::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -8847,7 +8847,7 @@ void vertexAttribDivisorARB(
 	GLuint index,
 	GLuint divisor)
 {
-	RenderCommand_vertexAttribDivisorARB* __restrict packet = (RenderCommand_vertexAttribDivisorARB*)getNextPacket();
+	RenderCommand_vertexAttribDivisorARB* __restrict packet = allocatePacket<RenderCommand_vertexAttribDivisorARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribDivisorARB::execute);
 	packet->index = index;
 	packet->divisor = divisor;
@@ -8855,14 +8855,14 @@ void vertexAttribDivisorARB(
 void maxShaderCompilerThreadsARB(
 	GLuint count)
 {
-	RenderCommand_maxShaderCompilerThreadsARB* __restrict packet = (RenderCommand_maxShaderCompilerThreadsARB*)getNextPacket();
+	RenderCommand_maxShaderCompilerThreadsARB* __restrict packet = allocatePacket<RenderCommand_maxShaderCompilerThreadsARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_maxShaderCompilerThreadsARB::execute);
 	packet->count = count;
 }
 GLenum getGraphicsResetStatusARB(
 	void)
 {
-	RenderCommand_getGraphicsResetStatusARB* __restrict packet = (RenderCommand_getGraphicsResetStatusARB*)getNextPacket();
+	RenderCommand_getGraphicsResetStatusARB* __restrict packet = allocatePacket<RenderCommand_getGraphicsResetStatusARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getGraphicsResetStatusARB::execute);
 }
 void getnTexImageARB(
@@ -8873,7 +8873,7 @@ void getnTexImageARB(
 	GLsizei bufSize,
 	void *img)
 {
-	RenderCommand_getnTexImageARB* __restrict packet = (RenderCommand_getnTexImageARB*)getNextPacket();
+	RenderCommand_getnTexImageARB* __restrict packet = allocatePacket<RenderCommand_getnTexImageARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnTexImageARB::execute);
 	packet->target = target;
 	packet->level = level;
@@ -8892,7 +8892,7 @@ void readnPixelsARB(
 	GLsizei bufSize,
 	void *data)
 {
-	RenderCommand_readnPixelsARB* __restrict packet = (RenderCommand_readnPixelsARB*)getNextPacket();
+	RenderCommand_readnPixelsARB* __restrict packet = allocatePacket<RenderCommand_readnPixelsARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_readnPixelsARB::execute);
 	packet->x = x;
 	packet->y = y;
@@ -8909,7 +8909,7 @@ void getnCompressedTexImageARB(
 	GLsizei bufSize,
 	void *img)
 {
-	RenderCommand_getnCompressedTexImageARB* __restrict packet = (RenderCommand_getnCompressedTexImageARB*)getNextPacket();
+	RenderCommand_getnCompressedTexImageARB* __restrict packet = allocatePacket<RenderCommand_getnCompressedTexImageARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnCompressedTexImageARB::execute);
 	packet->target = target;
 	packet->lod = lod;
@@ -8922,7 +8922,7 @@ void getnUniformfvARB(
 	GLsizei bufSize,
 	GLfloat *params)
 {
-	RenderCommand_getnUniformfvARB* __restrict packet = (RenderCommand_getnUniformfvARB*)getNextPacket();
+	RenderCommand_getnUniformfvARB* __restrict packet = allocatePacket<RenderCommand_getnUniformfvARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformfvARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8935,7 +8935,7 @@ void getnUniformivARB(
 	GLsizei bufSize,
 	GLint *params)
 {
-	RenderCommand_getnUniformivARB* __restrict packet = (RenderCommand_getnUniformivARB*)getNextPacket();
+	RenderCommand_getnUniformivARB* __restrict packet = allocatePacket<RenderCommand_getnUniformivARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformivARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8948,7 +8948,7 @@ void getnUniformuivARB(
 	GLsizei bufSize,
 	GLuint *params)
 {
-	RenderCommand_getnUniformuivARB* __restrict packet = (RenderCommand_getnUniformuivARB*)getNextPacket();
+	RenderCommand_getnUniformuivARB* __restrict packet = allocatePacket<RenderCommand_getnUniformuivARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformuivARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8961,7 +8961,7 @@ void getnUniformdvARB(
 	GLsizei bufSize,
 	GLdouble *params)
 {
-	RenderCommand_getnUniformdvARB* __restrict packet = (RenderCommand_getnUniformdvARB*)getNextPacket();
+	RenderCommand_getnUniformdvARB* __restrict packet = allocatePacket<RenderCommand_getnUniformdvARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getnUniformdvARB::execute);
 	packet->program = program;
 	packet->location = location;
@@ -8974,7 +8974,7 @@ void framebufferSampleLocationsfvARB(
 	GLsizei count,
 	const GLfloat *v)
 {
-	RenderCommand_framebufferSampleLocationsfvARB* __restrict packet = (RenderCommand_framebufferSampleLocationsfvARB*)getNextPacket();
+	RenderCommand_framebufferSampleLocationsfvARB* __restrict packet = allocatePacket<RenderCommand_framebufferSampleLocationsfvARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferSampleLocationsfvARB::execute);
 	packet->target = target;
 	packet->start = start;
@@ -8987,7 +8987,7 @@ void namedFramebufferSampleLocationsfvARB(
 	GLsizei count,
 	const GLfloat *v)
 {
-	RenderCommand_namedFramebufferSampleLocationsfvARB* __restrict packet = (RenderCommand_namedFramebufferSampleLocationsfvARB*)getNextPacket();
+	RenderCommand_namedFramebufferSampleLocationsfvARB* __restrict packet = allocatePacket<RenderCommand_namedFramebufferSampleLocationsfvARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferSampleLocationsfvARB::execute);
 	packet->framebuffer = framebuffer;
 	packet->start = start;
@@ -8997,13 +8997,13 @@ void namedFramebufferSampleLocationsfvARB(
 void evaluateDepthValuesARB(
 	void)
 {
-	RenderCommand_evaluateDepthValuesARB* __restrict packet = (RenderCommand_evaluateDepthValuesARB*)getNextPacket();
+	RenderCommand_evaluateDepthValuesARB* __restrict packet = allocatePacket<RenderCommand_evaluateDepthValuesARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_evaluateDepthValuesARB::execute);
 }
 void minSampleShadingARB(
 	GLfloat value)
 {
-	RenderCommand_minSampleShadingARB* __restrict packet = (RenderCommand_minSampleShadingARB*)getNextPacket();
+	RenderCommand_minSampleShadingARB* __restrict packet = allocatePacket<RenderCommand_minSampleShadingARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_minSampleShadingARB::execute);
 	packet->value = value;
 }
@@ -9014,7 +9014,7 @@ void namedStringARB(
 	GLint stringlen,
 	const GLchar *string)
 {
-	RenderCommand_namedStringARB* __restrict packet = (RenderCommand_namedStringARB*)getNextPacket();
+	RenderCommand_namedStringARB* __restrict packet = allocatePacket<RenderCommand_namedStringARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedStringARB::execute);
 	packet->type = type;
 	packet->namelen = namelen;
@@ -9026,7 +9026,7 @@ void deleteNamedStringARB(
 	GLint namelen,
 	const GLchar *name)
 {
-	RenderCommand_deleteNamedStringARB* __restrict packet = (RenderCommand_deleteNamedStringARB*)getNextPacket();
+	RenderCommand_deleteNamedStringARB* __restrict packet = allocatePacket<RenderCommand_deleteNamedStringARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteNamedStringARB::execute);
 	packet->namelen = namelen;
 	packet->name = name;
@@ -9037,7 +9037,7 @@ void compileShaderIncludeARB(
 	const GLchar *const*path,
 	const GLint *length)
 {
-	RenderCommand_compileShaderIncludeARB* __restrict packet = (RenderCommand_compileShaderIncludeARB*)getNextPacket();
+	RenderCommand_compileShaderIncludeARB* __restrict packet = allocatePacket<RenderCommand_compileShaderIncludeARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compileShaderIncludeARB::execute);
 	packet->shader = shader;
 	packet->count = count;
@@ -9048,7 +9048,7 @@ GLboolean isNamedStringARB(
 	GLint namelen,
 	const GLchar *name)
 {
-	RenderCommand_isNamedStringARB* __restrict packet = (RenderCommand_isNamedStringARB*)getNextPacket();
+	RenderCommand_isNamedStringARB* __restrict packet = allocatePacket<RenderCommand_isNamedStringARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isNamedStringARB::execute);
 	packet->namelen = namelen;
 	packet->name = name;
@@ -9060,7 +9060,7 @@ void getNamedStringARB(
 	GLint *stringlen,
 	GLchar *string)
 {
-	RenderCommand_getNamedStringARB* __restrict packet = (RenderCommand_getNamedStringARB*)getNextPacket();
+	RenderCommand_getNamedStringARB* __restrict packet = allocatePacket<RenderCommand_getNamedStringARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedStringARB::execute);
 	packet->namelen = namelen;
 	packet->name = name;
@@ -9074,7 +9074,7 @@ void getNamedStringivARB(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedStringivARB* __restrict packet = (RenderCommand_getNamedStringivARB*)getNextPacket();
+	RenderCommand_getNamedStringivARB* __restrict packet = allocatePacket<RenderCommand_getNamedStringivARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedStringivARB::execute);
 	packet->namelen = namelen;
 	packet->name = name;
@@ -9087,7 +9087,7 @@ void bufferPageCommitmentARB(
 	GLsizeiptr size,
 	GLboolean commit)
 {
-	RenderCommand_bufferPageCommitmentARB* __restrict packet = (RenderCommand_bufferPageCommitmentARB*)getNextPacket();
+	RenderCommand_bufferPageCommitmentARB* __restrict packet = allocatePacket<RenderCommand_bufferPageCommitmentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferPageCommitmentARB::execute);
 	packet->target = target;
 	packet->offset = offset;
@@ -9100,7 +9100,7 @@ void namedBufferPageCommitmentEXT(
 	GLsizeiptr size,
 	GLboolean commit)
 {
-	RenderCommand_namedBufferPageCommitmentEXT* __restrict packet = (RenderCommand_namedBufferPageCommitmentEXT*)getNextPacket();
+	RenderCommand_namedBufferPageCommitmentEXT* __restrict packet = allocatePacket<RenderCommand_namedBufferPageCommitmentEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferPageCommitmentEXT::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -9113,7 +9113,7 @@ void namedBufferPageCommitmentARB(
 	GLsizeiptr size,
 	GLboolean commit)
 {
-	RenderCommand_namedBufferPageCommitmentARB* __restrict packet = (RenderCommand_namedBufferPageCommitmentARB*)getNextPacket();
+	RenderCommand_namedBufferPageCommitmentARB* __restrict packet = allocatePacket<RenderCommand_namedBufferPageCommitmentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferPageCommitmentARB::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -9131,7 +9131,7 @@ void texPageCommitmentARB(
 	GLsizei depth,
 	GLboolean commit)
 {
-	RenderCommand_texPageCommitmentARB* __restrict packet = (RenderCommand_texPageCommitmentARB*)getNextPacket();
+	RenderCommand_texPageCommitmentARB* __restrict packet = allocatePacket<RenderCommand_texPageCommitmentARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texPageCommitmentARB::execute);
 	packet->target = target;
 	packet->level = level;
@@ -9148,7 +9148,7 @@ void texBufferARB(
 	GLenum internalformat,
 	GLuint buffer)
 {
-	RenderCommand_texBufferARB* __restrict packet = (RenderCommand_texBufferARB*)getNextPacket();
+	RenderCommand_texBufferARB* __restrict packet = allocatePacket<RenderCommand_texBufferARB>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texBufferARB::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -9157,13 +9157,13 @@ void texBufferARB(
 void blendBarrierKHR(
 	void)
 {
-	RenderCommand_blendBarrierKHR* __restrict packet = (RenderCommand_blendBarrierKHR*)getNextPacket();
+	RenderCommand_blendBarrierKHR* __restrict packet = allocatePacket<RenderCommand_blendBarrierKHR>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendBarrierKHR::execute);
 }
 void maxShaderCompilerThreadsKHR(
 	GLuint count)
 {
-	RenderCommand_maxShaderCompilerThreadsKHR* __restrict packet = (RenderCommand_maxShaderCompilerThreadsKHR*)getNextPacket();
+	RenderCommand_maxShaderCompilerThreadsKHR* __restrict packet = allocatePacket<RenderCommand_maxShaderCompilerThreadsKHR>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_maxShaderCompilerThreadsKHR::execute);
 	packet->count = count;
 }
@@ -9175,7 +9175,7 @@ void renderbufferStorageMultisampleAdvancedAMD(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_renderbufferStorageMultisampleAdvancedAMD* __restrict packet = (RenderCommand_renderbufferStorageMultisampleAdvancedAMD*)getNextPacket();
+	RenderCommand_renderbufferStorageMultisampleAdvancedAMD* __restrict packet = allocatePacket<RenderCommand_renderbufferStorageMultisampleAdvancedAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_renderbufferStorageMultisampleAdvancedAMD::execute);
 	packet->target = target;
 	packet->samples = samples;
@@ -9192,7 +9192,7 @@ void namedRenderbufferStorageMultisampleAdvancedAMD(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD* __restrict packet = (RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD*)getNextPacket();
+	RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->samples = samples;
@@ -9206,7 +9206,7 @@ void getPerfMonitorGroupsAMD(
 	GLsizei groupsSize,
 	GLuint *groups)
 {
-	RenderCommand_getPerfMonitorGroupsAMD* __restrict packet = (RenderCommand_getPerfMonitorGroupsAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorGroupsAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorGroupsAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorGroupsAMD::execute);
 	packet->numGroups = numGroups;
 	packet->groupsSize = groupsSize;
@@ -9219,7 +9219,7 @@ void getPerfMonitorCountersAMD(
 	GLsizei counterSize,
 	GLuint *counters)
 {
-	RenderCommand_getPerfMonitorCountersAMD* __restrict packet = (RenderCommand_getPerfMonitorCountersAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorCountersAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorCountersAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorCountersAMD::execute);
 	packet->group = group;
 	packet->numCounters = numCounters;
@@ -9233,7 +9233,7 @@ void getPerfMonitorGroupStringAMD(
 	GLsizei *length,
 	GLchar *groupString)
 {
-	RenderCommand_getPerfMonitorGroupStringAMD* __restrict packet = (RenderCommand_getPerfMonitorGroupStringAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorGroupStringAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorGroupStringAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorGroupStringAMD::execute);
 	packet->group = group;
 	packet->bufSize = bufSize;
@@ -9247,7 +9247,7 @@ void getPerfMonitorCounterStringAMD(
 	GLsizei *length,
 	GLchar *counterString)
 {
-	RenderCommand_getPerfMonitorCounterStringAMD* __restrict packet = (RenderCommand_getPerfMonitorCounterStringAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorCounterStringAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorCounterStringAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorCounterStringAMD::execute);
 	packet->group = group;
 	packet->counter = counter;
@@ -9261,7 +9261,7 @@ void getPerfMonitorCounterInfoAMD(
 	GLenum pname,
 	void *data)
 {
-	RenderCommand_getPerfMonitorCounterInfoAMD* __restrict packet = (RenderCommand_getPerfMonitorCounterInfoAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorCounterInfoAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorCounterInfoAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorCounterInfoAMD::execute);
 	packet->group = group;
 	packet->counter = counter;
@@ -9272,7 +9272,7 @@ void genPerfMonitorsAMD(
 	GLsizei n,
 	GLuint *monitors)
 {
-	RenderCommand_genPerfMonitorsAMD* __restrict packet = (RenderCommand_genPerfMonitorsAMD*)getNextPacket();
+	RenderCommand_genPerfMonitorsAMD* __restrict packet = allocatePacket<RenderCommand_genPerfMonitorsAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genPerfMonitorsAMD::execute);
 	packet->n = n;
 	packet->monitors = monitors;
@@ -9281,7 +9281,7 @@ void deletePerfMonitorsAMD(
 	GLsizei n,
 	GLuint *monitors)
 {
-	RenderCommand_deletePerfMonitorsAMD* __restrict packet = (RenderCommand_deletePerfMonitorsAMD*)getNextPacket();
+	RenderCommand_deletePerfMonitorsAMD* __restrict packet = allocatePacket<RenderCommand_deletePerfMonitorsAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deletePerfMonitorsAMD::execute);
 	packet->n = n;
 	packet->monitors = monitors;
@@ -9293,7 +9293,7 @@ void selectPerfMonitorCountersAMD(
 	GLint numCounters,
 	GLuint *counterList)
 {
-	RenderCommand_selectPerfMonitorCountersAMD* __restrict packet = (RenderCommand_selectPerfMonitorCountersAMD*)getNextPacket();
+	RenderCommand_selectPerfMonitorCountersAMD* __restrict packet = allocatePacket<RenderCommand_selectPerfMonitorCountersAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_selectPerfMonitorCountersAMD::execute);
 	packet->monitor = monitor;
 	packet->enable = enable;
@@ -9304,14 +9304,14 @@ void selectPerfMonitorCountersAMD(
 void beginPerfMonitorAMD(
 	GLuint monitor)
 {
-	RenderCommand_beginPerfMonitorAMD* __restrict packet = (RenderCommand_beginPerfMonitorAMD*)getNextPacket();
+	RenderCommand_beginPerfMonitorAMD* __restrict packet = allocatePacket<RenderCommand_beginPerfMonitorAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginPerfMonitorAMD::execute);
 	packet->monitor = monitor;
 }
 void endPerfMonitorAMD(
 	GLuint monitor)
 {
-	RenderCommand_endPerfMonitorAMD* __restrict packet = (RenderCommand_endPerfMonitorAMD*)getNextPacket();
+	RenderCommand_endPerfMonitorAMD* __restrict packet = allocatePacket<RenderCommand_endPerfMonitorAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endPerfMonitorAMD::execute);
 	packet->monitor = monitor;
 }
@@ -9322,7 +9322,7 @@ void getPerfMonitorCounterDataAMD(
 	GLuint *data,
 	GLint *bytesWritten)
 {
-	RenderCommand_getPerfMonitorCounterDataAMD* __restrict packet = (RenderCommand_getPerfMonitorCounterDataAMD*)getNextPacket();
+	RenderCommand_getPerfMonitorCounterDataAMD* __restrict packet = allocatePacket<RenderCommand_getPerfMonitorCounterDataAMD>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfMonitorCounterDataAMD::execute);
 	packet->monitor = monitor;
 	packet->pname = pname;
@@ -9335,7 +9335,7 @@ void eGLImageTargetTexStorageEXT(
 	GLeglImageOES image,
 	const GLint* attrib_list)
 {
-	RenderCommand_eGLImageTargetTexStorageEXT* __restrict packet = (RenderCommand_eGLImageTargetTexStorageEXT*)getNextPacket();
+	RenderCommand_eGLImageTargetTexStorageEXT* __restrict packet = allocatePacket<RenderCommand_eGLImageTargetTexStorageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_eGLImageTargetTexStorageEXT::execute);
 	packet->target = target;
 	packet->image = image;
@@ -9346,7 +9346,7 @@ void eGLImageTargetTextureStorageEXT(
 	GLeglImageOES image,
 	const GLint* attrib_list)
 {
-	RenderCommand_eGLImageTargetTextureStorageEXT* __restrict packet = (RenderCommand_eGLImageTargetTextureStorageEXT*)getNextPacket();
+	RenderCommand_eGLImageTargetTextureStorageEXT* __restrict packet = allocatePacket<RenderCommand_eGLImageTargetTextureStorageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_eGLImageTargetTextureStorageEXT::execute);
 	packet->texture = texture;
 	packet->image = image;
@@ -9358,7 +9358,7 @@ void labelObjectEXT(
 	GLsizei length,
 	const GLchar *label)
 {
-	RenderCommand_labelObjectEXT* __restrict packet = (RenderCommand_labelObjectEXT*)getNextPacket();
+	RenderCommand_labelObjectEXT* __restrict packet = allocatePacket<RenderCommand_labelObjectEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_labelObjectEXT::execute);
 	packet->type = type;
 	packet->object = object;
@@ -9372,7 +9372,7 @@ void getObjectLabelEXT(
 	GLsizei *length,
 	GLchar *label)
 {
-	RenderCommand_getObjectLabelEXT* __restrict packet = (RenderCommand_getObjectLabelEXT*)getNextPacket();
+	RenderCommand_getObjectLabelEXT* __restrict packet = allocatePacket<RenderCommand_getObjectLabelEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getObjectLabelEXT::execute);
 	packet->type = type;
 	packet->object = object;
@@ -9384,7 +9384,7 @@ void insertEventMarkerEXT(
 	GLsizei length,
 	const GLchar *marker)
 {
-	RenderCommand_insertEventMarkerEXT* __restrict packet = (RenderCommand_insertEventMarkerEXT*)getNextPacket();
+	RenderCommand_insertEventMarkerEXT* __restrict packet = allocatePacket<RenderCommand_insertEventMarkerEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_insertEventMarkerEXT::execute);
 	packet->length = length;
 	packet->marker = marker;
@@ -9393,7 +9393,7 @@ void pushGroupMarkerEXT(
 	GLsizei length,
 	const GLchar *marker)
 {
-	RenderCommand_pushGroupMarkerEXT* __restrict packet = (RenderCommand_pushGroupMarkerEXT*)getNextPacket();
+	RenderCommand_pushGroupMarkerEXT* __restrict packet = allocatePacket<RenderCommand_pushGroupMarkerEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pushGroupMarkerEXT::execute);
 	packet->length = length;
 	packet->marker = marker;
@@ -9401,14 +9401,14 @@ void pushGroupMarkerEXT(
 void popGroupMarkerEXT(
 	void)
 {
-	RenderCommand_popGroupMarkerEXT* __restrict packet = (RenderCommand_popGroupMarkerEXT*)getNextPacket();
+	RenderCommand_popGroupMarkerEXT* __restrict packet = allocatePacket<RenderCommand_popGroupMarkerEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_popGroupMarkerEXT::execute);
 }
 void matrixLoadfEXT(
 	GLenum mode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixLoadfEXT* __restrict packet = (RenderCommand_matrixLoadfEXT*)getNextPacket();
+	RenderCommand_matrixLoadfEXT* __restrict packet = allocatePacket<RenderCommand_matrixLoadfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoadfEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -9417,7 +9417,7 @@ void matrixLoaddEXT(
 	GLenum mode,
 	const GLdouble *m)
 {
-	RenderCommand_matrixLoaddEXT* __restrict packet = (RenderCommand_matrixLoaddEXT*)getNextPacket();
+	RenderCommand_matrixLoaddEXT* __restrict packet = allocatePacket<RenderCommand_matrixLoaddEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoaddEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -9426,7 +9426,7 @@ void matrixMultfEXT(
 	GLenum mode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixMultfEXT* __restrict packet = (RenderCommand_matrixMultfEXT*)getNextPacket();
+	RenderCommand_matrixMultfEXT* __restrict packet = allocatePacket<RenderCommand_matrixMultfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMultfEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -9435,7 +9435,7 @@ void matrixMultdEXT(
 	GLenum mode,
 	const GLdouble *m)
 {
-	RenderCommand_matrixMultdEXT* __restrict packet = (RenderCommand_matrixMultdEXT*)getNextPacket();
+	RenderCommand_matrixMultdEXT* __restrict packet = allocatePacket<RenderCommand_matrixMultdEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMultdEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -9443,7 +9443,7 @@ void matrixMultdEXT(
 void matrixLoadIdentityEXT(
 	GLenum mode)
 {
-	RenderCommand_matrixLoadIdentityEXT* __restrict packet = (RenderCommand_matrixLoadIdentityEXT*)getNextPacket();
+	RenderCommand_matrixLoadIdentityEXT* __restrict packet = allocatePacket<RenderCommand_matrixLoadIdentityEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoadIdentityEXT::execute);
 	packet->mode = mode;
 }
@@ -9454,7 +9454,7 @@ void matrixRotatefEXT(
 	GLfloat y,
 	GLfloat z)
 {
-	RenderCommand_matrixRotatefEXT* __restrict packet = (RenderCommand_matrixRotatefEXT*)getNextPacket();
+	RenderCommand_matrixRotatefEXT* __restrict packet = allocatePacket<RenderCommand_matrixRotatefEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixRotatefEXT::execute);
 	packet->mode = mode;
 	packet->angle = angle;
@@ -9469,7 +9469,7 @@ void matrixRotatedEXT(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_matrixRotatedEXT* __restrict packet = (RenderCommand_matrixRotatedEXT*)getNextPacket();
+	RenderCommand_matrixRotatedEXT* __restrict packet = allocatePacket<RenderCommand_matrixRotatedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixRotatedEXT::execute);
 	packet->mode = mode;
 	packet->angle = angle;
@@ -9483,7 +9483,7 @@ void matrixScalefEXT(
 	GLfloat y,
 	GLfloat z)
 {
-	RenderCommand_matrixScalefEXT* __restrict packet = (RenderCommand_matrixScalefEXT*)getNextPacket();
+	RenderCommand_matrixScalefEXT* __restrict packet = allocatePacket<RenderCommand_matrixScalefEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixScalefEXT::execute);
 	packet->mode = mode;
 	packet->x = x;
@@ -9496,7 +9496,7 @@ void matrixScaledEXT(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_matrixScaledEXT* __restrict packet = (RenderCommand_matrixScaledEXT*)getNextPacket();
+	RenderCommand_matrixScaledEXT* __restrict packet = allocatePacket<RenderCommand_matrixScaledEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixScaledEXT::execute);
 	packet->mode = mode;
 	packet->x = x;
@@ -9509,7 +9509,7 @@ void matrixTranslatefEXT(
 	GLfloat y,
 	GLfloat z)
 {
-	RenderCommand_matrixTranslatefEXT* __restrict packet = (RenderCommand_matrixTranslatefEXT*)getNextPacket();
+	RenderCommand_matrixTranslatefEXT* __restrict packet = allocatePacket<RenderCommand_matrixTranslatefEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixTranslatefEXT::execute);
 	packet->mode = mode;
 	packet->x = x;
@@ -9522,7 +9522,7 @@ void matrixTranslatedEXT(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_matrixTranslatedEXT* __restrict packet = (RenderCommand_matrixTranslatedEXT*)getNextPacket();
+	RenderCommand_matrixTranslatedEXT* __restrict packet = allocatePacket<RenderCommand_matrixTranslatedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixTranslatedEXT::execute);
 	packet->mode = mode;
 	packet->x = x;
@@ -9538,7 +9538,7 @@ void matrixFrustumEXT(
 	GLdouble zNear,
 	GLdouble zFar)
 {
-	RenderCommand_matrixFrustumEXT* __restrict packet = (RenderCommand_matrixFrustumEXT*)getNextPacket();
+	RenderCommand_matrixFrustumEXT* __restrict packet = allocatePacket<RenderCommand_matrixFrustumEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixFrustumEXT::execute);
 	packet->mode = mode;
 	packet->left = left;
@@ -9557,7 +9557,7 @@ void matrixOrthoEXT(
 	GLdouble zNear,
 	GLdouble zFar)
 {
-	RenderCommand_matrixOrthoEXT* __restrict packet = (RenderCommand_matrixOrthoEXT*)getNextPacket();
+	RenderCommand_matrixOrthoEXT* __restrict packet = allocatePacket<RenderCommand_matrixOrthoEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixOrthoEXT::execute);
 	packet->mode = mode;
 	packet->left = left;
@@ -9570,28 +9570,28 @@ void matrixOrthoEXT(
 void matrixPopEXT(
 	GLenum mode)
 {
-	RenderCommand_matrixPopEXT* __restrict packet = (RenderCommand_matrixPopEXT*)getNextPacket();
+	RenderCommand_matrixPopEXT* __restrict packet = allocatePacket<RenderCommand_matrixPopEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixPopEXT::execute);
 	packet->mode = mode;
 }
 void matrixPushEXT(
 	GLenum mode)
 {
-	RenderCommand_matrixPushEXT* __restrict packet = (RenderCommand_matrixPushEXT*)getNextPacket();
+	RenderCommand_matrixPushEXT* __restrict packet = allocatePacket<RenderCommand_matrixPushEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixPushEXT::execute);
 	packet->mode = mode;
 }
 void clientAttribDefaultEXT(
 	GLbitfield mask)
 {
-	RenderCommand_clientAttribDefaultEXT* __restrict packet = (RenderCommand_clientAttribDefaultEXT*)getNextPacket();
+	RenderCommand_clientAttribDefaultEXT* __restrict packet = allocatePacket<RenderCommand_clientAttribDefaultEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clientAttribDefaultEXT::execute);
 	packet->mask = mask;
 }
 void pushClientAttribDefaultEXT(
 	GLbitfield mask)
 {
-	RenderCommand_pushClientAttribDefaultEXT* __restrict packet = (RenderCommand_pushClientAttribDefaultEXT*)getNextPacket();
+	RenderCommand_pushClientAttribDefaultEXT* __restrict packet = allocatePacket<RenderCommand_pushClientAttribDefaultEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pushClientAttribDefaultEXT::execute);
 	packet->mask = mask;
 }
@@ -9601,7 +9601,7 @@ void textureParameterfEXT(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_textureParameterfEXT* __restrict packet = (RenderCommand_textureParameterfEXT*)getNextPacket();
+	RenderCommand_textureParameterfEXT* __restrict packet = allocatePacket<RenderCommand_textureParameterfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterfEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9614,7 +9614,7 @@ void textureParameterfvEXT(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_textureParameterfvEXT* __restrict packet = (RenderCommand_textureParameterfvEXT*)getNextPacket();
+	RenderCommand_textureParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_textureParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterfvEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9627,7 +9627,7 @@ void textureParameteriEXT(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_textureParameteriEXT* __restrict packet = (RenderCommand_textureParameteriEXT*)getNextPacket();
+	RenderCommand_textureParameteriEXT* __restrict packet = allocatePacket<RenderCommand_textureParameteriEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameteriEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9640,7 +9640,7 @@ void textureParameterivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_textureParameterivEXT* __restrict packet = (RenderCommand_textureParameterivEXT*)getNextPacket();
+	RenderCommand_textureParameterivEXT* __restrict packet = allocatePacket<RenderCommand_textureParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9658,7 +9658,7 @@ void textureImage1DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureImage1DEXT* __restrict packet = (RenderCommand_textureImage1DEXT*)getNextPacket();
+	RenderCommand_textureImage1DEXT* __restrict packet = allocatePacket<RenderCommand_textureImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9682,7 +9682,7 @@ void textureImage2DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureImage2DEXT* __restrict packet = (RenderCommand_textureImage2DEXT*)getNextPacket();
+	RenderCommand_textureImage2DEXT* __restrict packet = allocatePacket<RenderCommand_textureImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9705,7 +9705,7 @@ void textureSubImage1DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage1DEXT* __restrict packet = (RenderCommand_textureSubImage1DEXT*)getNextPacket();
+	RenderCommand_textureSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_textureSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9728,7 +9728,7 @@ void textureSubImage2DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage2DEXT* __restrict packet = (RenderCommand_textureSubImage2DEXT*)getNextPacket();
+	RenderCommand_textureSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_textureSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9751,7 +9751,7 @@ void copyTextureImage1DEXT(
 	GLsizei width,
 	GLint border)
 {
-	RenderCommand_copyTextureImage1DEXT* __restrict packet = (RenderCommand_copyTextureImage1DEXT*)getNextPacket();
+	RenderCommand_copyTextureImage1DEXT* __restrict packet = allocatePacket<RenderCommand_copyTextureImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9773,7 +9773,7 @@ void copyTextureImage2DEXT(
 	GLsizei height,
 	GLint border)
 {
-	RenderCommand_copyTextureImage2DEXT* __restrict packet = (RenderCommand_copyTextureImage2DEXT*)getNextPacket();
+	RenderCommand_copyTextureImage2DEXT* __restrict packet = allocatePacket<RenderCommand_copyTextureImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9794,7 +9794,7 @@ void copyTextureSubImage1DEXT(
 	GLint y,
 	GLsizei width)
 {
-	RenderCommand_copyTextureSubImage1DEXT* __restrict packet = (RenderCommand_copyTextureSubImage1DEXT*)getNextPacket();
+	RenderCommand_copyTextureSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9815,7 +9815,7 @@ void copyTextureSubImage2DEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTextureSubImage2DEXT* __restrict packet = (RenderCommand_copyTextureSubImage2DEXT*)getNextPacket();
+	RenderCommand_copyTextureSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9835,7 +9835,7 @@ void getTextureImageEXT(
 	GLenum type,
 	void *pixels)
 {
-	RenderCommand_getTextureImageEXT* __restrict packet = (RenderCommand_getTextureImageEXT*)getNextPacket();
+	RenderCommand_getTextureImageEXT* __restrict packet = allocatePacket<RenderCommand_getTextureImageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureImageEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9850,7 +9850,7 @@ void getTextureParameterfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTextureParameterfvEXT* __restrict packet = (RenderCommand_getTextureParameterfvEXT*)getNextPacket();
+	RenderCommand_getTextureParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_getTextureParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterfvEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9863,7 +9863,7 @@ void getTextureParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureParameterivEXT* __restrict packet = (RenderCommand_getTextureParameterivEXT*)getNextPacket();
+	RenderCommand_getTextureParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getTextureParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9877,7 +9877,7 @@ void getTextureLevelParameterfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getTextureLevelParameterfvEXT* __restrict packet = (RenderCommand_getTextureLevelParameterfvEXT*)getNextPacket();
+	RenderCommand_getTextureLevelParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_getTextureLevelParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureLevelParameterfvEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9892,7 +9892,7 @@ void getTextureLevelParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureLevelParameterivEXT* __restrict packet = (RenderCommand_getTextureLevelParameterivEXT*)getNextPacket();
+	RenderCommand_getTextureLevelParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getTextureLevelParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureLevelParameterivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9913,7 +9913,7 @@ void textureImage3DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureImage3DEXT* __restrict packet = (RenderCommand_textureImage3DEXT*)getNextPacket();
+	RenderCommand_textureImage3DEXT* __restrict packet = allocatePacket<RenderCommand_textureImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureImage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9941,7 +9941,7 @@ void textureSubImage3DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_textureSubImage3DEXT* __restrict packet = (RenderCommand_textureSubImage3DEXT*)getNextPacket();
+	RenderCommand_textureSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_textureSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureSubImage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9968,7 +9968,7 @@ void copyTextureSubImage3DEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyTextureSubImage3DEXT* __restrict packet = (RenderCommand_copyTextureSubImage3DEXT*)getNextPacket();
+	RenderCommand_copyTextureSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_copyTextureSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyTextureSubImage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -9986,7 +9986,7 @@ void bindMultiTextureEXT(
 	GLenum target,
 	GLuint texture)
 {
-	RenderCommand_bindMultiTextureEXT* __restrict packet = (RenderCommand_bindMultiTextureEXT*)getNextPacket();
+	RenderCommand_bindMultiTextureEXT* __restrict packet = allocatePacket<RenderCommand_bindMultiTextureEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindMultiTextureEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -9999,7 +9999,7 @@ void multiTexCoordPointerEXT(
 	GLsizei stride,
 	const void *pointer)
 {
-	RenderCommand_multiTexCoordPointerEXT* __restrict packet = (RenderCommand_multiTexCoordPointerEXT*)getNextPacket();
+	RenderCommand_multiTexCoordPointerEXT* __restrict packet = allocatePacket<RenderCommand_multiTexCoordPointerEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexCoordPointerEXT::execute);
 	packet->texunit = texunit;
 	packet->size = size;
@@ -10013,7 +10013,7 @@ void multiTexEnvfEXT(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_multiTexEnvfEXT* __restrict packet = (RenderCommand_multiTexEnvfEXT*)getNextPacket();
+	RenderCommand_multiTexEnvfEXT* __restrict packet = allocatePacket<RenderCommand_multiTexEnvfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexEnvfEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10026,7 +10026,7 @@ void multiTexEnvfvEXT(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_multiTexEnvfvEXT* __restrict packet = (RenderCommand_multiTexEnvfvEXT*)getNextPacket();
+	RenderCommand_multiTexEnvfvEXT* __restrict packet = allocatePacket<RenderCommand_multiTexEnvfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexEnvfvEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10039,7 +10039,7 @@ void multiTexEnviEXT(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_multiTexEnviEXT* __restrict packet = (RenderCommand_multiTexEnviEXT*)getNextPacket();
+	RenderCommand_multiTexEnviEXT* __restrict packet = allocatePacket<RenderCommand_multiTexEnviEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexEnviEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10052,7 +10052,7 @@ void multiTexEnvivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_multiTexEnvivEXT* __restrict packet = (RenderCommand_multiTexEnvivEXT*)getNextPacket();
+	RenderCommand_multiTexEnvivEXT* __restrict packet = allocatePacket<RenderCommand_multiTexEnvivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexEnvivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10065,7 +10065,7 @@ void multiTexGendEXT(
 	GLenum pname,
 	GLdouble param)
 {
-	RenderCommand_multiTexGendEXT* __restrict packet = (RenderCommand_multiTexGendEXT*)getNextPacket();
+	RenderCommand_multiTexGendEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGendEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGendEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10078,7 +10078,7 @@ void multiTexGendvEXT(
 	GLenum pname,
 	const GLdouble *params)
 {
-	RenderCommand_multiTexGendvEXT* __restrict packet = (RenderCommand_multiTexGendvEXT*)getNextPacket();
+	RenderCommand_multiTexGendvEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGendvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGendvEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10091,7 +10091,7 @@ void multiTexGenfEXT(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_multiTexGenfEXT* __restrict packet = (RenderCommand_multiTexGenfEXT*)getNextPacket();
+	RenderCommand_multiTexGenfEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGenfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGenfEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10104,7 +10104,7 @@ void multiTexGenfvEXT(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_multiTexGenfvEXT* __restrict packet = (RenderCommand_multiTexGenfvEXT*)getNextPacket();
+	RenderCommand_multiTexGenfvEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGenfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGenfvEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10117,7 +10117,7 @@ void multiTexGeniEXT(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_multiTexGeniEXT* __restrict packet = (RenderCommand_multiTexGeniEXT*)getNextPacket();
+	RenderCommand_multiTexGeniEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGeniEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGeniEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10130,7 +10130,7 @@ void multiTexGenivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_multiTexGenivEXT* __restrict packet = (RenderCommand_multiTexGenivEXT*)getNextPacket();
+	RenderCommand_multiTexGenivEXT* __restrict packet = allocatePacket<RenderCommand_multiTexGenivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexGenivEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10143,7 +10143,7 @@ void getMultiTexEnvfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getMultiTexEnvfvEXT* __restrict packet = (RenderCommand_getMultiTexEnvfvEXT*)getNextPacket();
+	RenderCommand_getMultiTexEnvfvEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexEnvfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexEnvfvEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10156,7 +10156,7 @@ void getMultiTexEnvivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getMultiTexEnvivEXT* __restrict packet = (RenderCommand_getMultiTexEnvivEXT*)getNextPacket();
+	RenderCommand_getMultiTexEnvivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexEnvivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexEnvivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10169,7 +10169,7 @@ void getMultiTexGendvEXT(
 	GLenum pname,
 	GLdouble *params)
 {
-	RenderCommand_getMultiTexGendvEXT* __restrict packet = (RenderCommand_getMultiTexGendvEXT*)getNextPacket();
+	RenderCommand_getMultiTexGendvEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexGendvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexGendvEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10182,7 +10182,7 @@ void getMultiTexGenfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getMultiTexGenfvEXT* __restrict packet = (RenderCommand_getMultiTexGenfvEXT*)getNextPacket();
+	RenderCommand_getMultiTexGenfvEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexGenfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexGenfvEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10195,7 +10195,7 @@ void getMultiTexGenivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getMultiTexGenivEXT* __restrict packet = (RenderCommand_getMultiTexGenivEXT*)getNextPacket();
+	RenderCommand_getMultiTexGenivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexGenivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexGenivEXT::execute);
 	packet->texunit = texunit;
 	packet->coord = coord;
@@ -10208,7 +10208,7 @@ void multiTexParameteriEXT(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_multiTexParameteriEXT* __restrict packet = (RenderCommand_multiTexParameteriEXT*)getNextPacket();
+	RenderCommand_multiTexParameteriEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameteriEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameteriEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10221,7 +10221,7 @@ void multiTexParameterivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_multiTexParameterivEXT* __restrict packet = (RenderCommand_multiTexParameterivEXT*)getNextPacket();
+	RenderCommand_multiTexParameterivEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameterivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10234,7 +10234,7 @@ void multiTexParameterfEXT(
 	GLenum pname,
 	GLfloat param)
 {
-	RenderCommand_multiTexParameterfEXT* __restrict packet = (RenderCommand_multiTexParameterfEXT*)getNextPacket();
+	RenderCommand_multiTexParameterfEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameterfEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameterfEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10247,7 +10247,7 @@ void multiTexParameterfvEXT(
 	GLenum pname,
 	const GLfloat *params)
 {
-	RenderCommand_multiTexParameterfvEXT* __restrict packet = (RenderCommand_multiTexParameterfvEXT*)getNextPacket();
+	RenderCommand_multiTexParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameterfvEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10265,7 +10265,7 @@ void multiTexImage1DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexImage1DEXT* __restrict packet = (RenderCommand_multiTexImage1DEXT*)getNextPacket();
+	RenderCommand_multiTexImage1DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10289,7 +10289,7 @@ void multiTexImage2DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexImage2DEXT* __restrict packet = (RenderCommand_multiTexImage2DEXT*)getNextPacket();
+	RenderCommand_multiTexImage2DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10312,7 +10312,7 @@ void multiTexSubImage1DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexSubImage1DEXT* __restrict packet = (RenderCommand_multiTexSubImage1DEXT*)getNextPacket();
+	RenderCommand_multiTexSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexSubImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10335,7 +10335,7 @@ void multiTexSubImage2DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexSubImage2DEXT* __restrict packet = (RenderCommand_multiTexSubImage2DEXT*)getNextPacket();
+	RenderCommand_multiTexSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexSubImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10358,7 +10358,7 @@ void copyMultiTexImage1DEXT(
 	GLsizei width,
 	GLint border)
 {
-	RenderCommand_copyMultiTexImage1DEXT* __restrict packet = (RenderCommand_copyMultiTexImage1DEXT*)getNextPacket();
+	RenderCommand_copyMultiTexImage1DEXT* __restrict packet = allocatePacket<RenderCommand_copyMultiTexImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyMultiTexImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10380,7 +10380,7 @@ void copyMultiTexImage2DEXT(
 	GLsizei height,
 	GLint border)
 {
-	RenderCommand_copyMultiTexImage2DEXT* __restrict packet = (RenderCommand_copyMultiTexImage2DEXT*)getNextPacket();
+	RenderCommand_copyMultiTexImage2DEXT* __restrict packet = allocatePacket<RenderCommand_copyMultiTexImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyMultiTexImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10401,7 +10401,7 @@ void copyMultiTexSubImage1DEXT(
 	GLint y,
 	GLsizei width)
 {
-	RenderCommand_copyMultiTexSubImage1DEXT* __restrict packet = (RenderCommand_copyMultiTexSubImage1DEXT*)getNextPacket();
+	RenderCommand_copyMultiTexSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_copyMultiTexSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyMultiTexSubImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10422,7 +10422,7 @@ void copyMultiTexSubImage2DEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyMultiTexSubImage2DEXT* __restrict packet = (RenderCommand_copyMultiTexSubImage2DEXT*)getNextPacket();
+	RenderCommand_copyMultiTexSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_copyMultiTexSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyMultiTexSubImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10442,7 +10442,7 @@ void getMultiTexImageEXT(
 	GLenum type,
 	void *pixels)
 {
-	RenderCommand_getMultiTexImageEXT* __restrict packet = (RenderCommand_getMultiTexImageEXT*)getNextPacket();
+	RenderCommand_getMultiTexImageEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexImageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexImageEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10457,7 +10457,7 @@ void getMultiTexParameterfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getMultiTexParameterfvEXT* __restrict packet = (RenderCommand_getMultiTexParameterfvEXT*)getNextPacket();
+	RenderCommand_getMultiTexParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexParameterfvEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10470,7 +10470,7 @@ void getMultiTexParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getMultiTexParameterivEXT* __restrict packet = (RenderCommand_getMultiTexParameterivEXT*)getNextPacket();
+	RenderCommand_getMultiTexParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexParameterivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10484,7 +10484,7 @@ void getMultiTexLevelParameterfvEXT(
 	GLenum pname,
 	GLfloat *params)
 {
-	RenderCommand_getMultiTexLevelParameterfvEXT* __restrict packet = (RenderCommand_getMultiTexLevelParameterfvEXT*)getNextPacket();
+	RenderCommand_getMultiTexLevelParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexLevelParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexLevelParameterfvEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10499,7 +10499,7 @@ void getMultiTexLevelParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getMultiTexLevelParameterivEXT* __restrict packet = (RenderCommand_getMultiTexLevelParameterivEXT*)getNextPacket();
+	RenderCommand_getMultiTexLevelParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexLevelParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexLevelParameterivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10520,7 +10520,7 @@ void multiTexImage3DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexImage3DEXT* __restrict packet = (RenderCommand_multiTexImage3DEXT*)getNextPacket();
+	RenderCommand_multiTexImage3DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexImage3DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10548,7 +10548,7 @@ void multiTexSubImage3DEXT(
 	GLenum type,
 	const void *pixels)
 {
-	RenderCommand_multiTexSubImage3DEXT* __restrict packet = (RenderCommand_multiTexSubImage3DEXT*)getNextPacket();
+	RenderCommand_multiTexSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_multiTexSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexSubImage3DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10575,7 +10575,7 @@ void copyMultiTexSubImage3DEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_copyMultiTexSubImage3DEXT* __restrict packet = (RenderCommand_copyMultiTexSubImage3DEXT*)getNextPacket();
+	RenderCommand_copyMultiTexSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_copyMultiTexSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyMultiTexSubImage3DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10592,7 +10592,7 @@ void enableClientStateIndexedEXT(
 	GLenum array,
 	GLuint index)
 {
-	RenderCommand_enableClientStateIndexedEXT* __restrict packet = (RenderCommand_enableClientStateIndexedEXT*)getNextPacket();
+	RenderCommand_enableClientStateIndexedEXT* __restrict packet = allocatePacket<RenderCommand_enableClientStateIndexedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableClientStateIndexedEXT::execute);
 	packet->array = array;
 	packet->index = index;
@@ -10601,7 +10601,7 @@ void disableClientStateIndexedEXT(
 	GLenum array,
 	GLuint index)
 {
-	RenderCommand_disableClientStateIndexedEXT* __restrict packet = (RenderCommand_disableClientStateIndexedEXT*)getNextPacket();
+	RenderCommand_disableClientStateIndexedEXT* __restrict packet = allocatePacket<RenderCommand_disableClientStateIndexedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableClientStateIndexedEXT::execute);
 	packet->array = array;
 	packet->index = index;
@@ -10611,7 +10611,7 @@ void getFloatIndexedvEXT(
 	GLuint index,
 	GLfloat *data)
 {
-	RenderCommand_getFloatIndexedvEXT* __restrict packet = (RenderCommand_getFloatIndexedvEXT*)getNextPacket();
+	RenderCommand_getFloatIndexedvEXT* __restrict packet = allocatePacket<RenderCommand_getFloatIndexedvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFloatIndexedvEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10622,7 +10622,7 @@ void getDoubleIndexedvEXT(
 	GLuint index,
 	GLdouble *data)
 {
-	RenderCommand_getDoubleIndexedvEXT* __restrict packet = (RenderCommand_getDoubleIndexedvEXT*)getNextPacket();
+	RenderCommand_getDoubleIndexedvEXT* __restrict packet = allocatePacket<RenderCommand_getDoubleIndexedvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDoubleIndexedvEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10633,7 +10633,7 @@ void getPointerIndexedvEXT(
 	GLuint index,
 	void **data)
 {
-	RenderCommand_getPointerIndexedvEXT* __restrict packet = (RenderCommand_getPointerIndexedvEXT*)getNextPacket();
+	RenderCommand_getPointerIndexedvEXT* __restrict packet = allocatePacket<RenderCommand_getPointerIndexedvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPointerIndexedvEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10643,7 +10643,7 @@ void enableIndexedEXT(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_enableIndexedEXT* __restrict packet = (RenderCommand_enableIndexedEXT*)getNextPacket();
+	RenderCommand_enableIndexedEXT* __restrict packet = allocatePacket<RenderCommand_enableIndexedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableIndexedEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10652,7 +10652,7 @@ void disableIndexedEXT(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_disableIndexedEXT* __restrict packet = (RenderCommand_disableIndexedEXT*)getNextPacket();
+	RenderCommand_disableIndexedEXT* __restrict packet = allocatePacket<RenderCommand_disableIndexedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableIndexedEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10661,7 +10661,7 @@ GLboolean isEnabledIndexedEXT(
 	GLenum target,
 	GLuint index)
 {
-	RenderCommand_isEnabledIndexedEXT* __restrict packet = (RenderCommand_isEnabledIndexedEXT*)getNextPacket();
+	RenderCommand_isEnabledIndexedEXT* __restrict packet = allocatePacket<RenderCommand_isEnabledIndexedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isEnabledIndexedEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10671,7 +10671,7 @@ void getIntegerIndexedvEXT(
 	GLuint index,
 	GLint *data)
 {
-	RenderCommand_getIntegerIndexedvEXT* __restrict packet = (RenderCommand_getIntegerIndexedvEXT*)getNextPacket();
+	RenderCommand_getIntegerIndexedvEXT* __restrict packet = allocatePacket<RenderCommand_getIntegerIndexedvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getIntegerIndexedvEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10682,7 +10682,7 @@ void getBooleanIndexedvEXT(
 	GLuint index,
 	GLboolean *data)
 {
-	RenderCommand_getBooleanIndexedvEXT* __restrict packet = (RenderCommand_getBooleanIndexedvEXT*)getNextPacket();
+	RenderCommand_getBooleanIndexedvEXT* __restrict packet = allocatePacket<RenderCommand_getBooleanIndexedvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBooleanIndexedvEXT::execute);
 	packet->target = target;
 	packet->index = index;
@@ -10700,7 +10700,7 @@ void compressedTextureImage3DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureImage3DEXT* __restrict packet = (RenderCommand_compressedTextureImage3DEXT*)getNextPacket();
+	RenderCommand_compressedTextureImage3DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureImage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10724,7 +10724,7 @@ void compressedTextureImage2DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureImage2DEXT* __restrict packet = (RenderCommand_compressedTextureImage2DEXT*)getNextPacket();
+	RenderCommand_compressedTextureImage2DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10746,7 +10746,7 @@ void compressedTextureImage1DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureImage1DEXT* __restrict packet = (RenderCommand_compressedTextureImage1DEXT*)getNextPacket();
+	RenderCommand_compressedTextureImage1DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10771,7 +10771,7 @@ void compressedTextureSubImage3DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureSubImage3DEXT* __restrict packet = (RenderCommand_compressedTextureSubImage3DEXT*)getNextPacket();
+	RenderCommand_compressedTextureSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10798,7 +10798,7 @@ void compressedTextureSubImage2DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureSubImage2DEXT* __restrict packet = (RenderCommand_compressedTextureSubImage2DEXT*)getNextPacket();
+	RenderCommand_compressedTextureSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10821,7 +10821,7 @@ void compressedTextureSubImage1DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedTextureSubImage1DEXT* __restrict packet = (RenderCommand_compressedTextureSubImage1DEXT*)getNextPacket();
+	RenderCommand_compressedTextureSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_compressedTextureSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedTextureSubImage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10838,7 +10838,7 @@ void getCompressedTextureImageEXT(
 	GLint lod,
 	void *img)
 {
-	RenderCommand_getCompressedTextureImageEXT* __restrict packet = (RenderCommand_getCompressedTextureImageEXT*)getNextPacket();
+	RenderCommand_getCompressedTextureImageEXT* __restrict packet = allocatePacket<RenderCommand_getCompressedTextureImageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCompressedTextureImageEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -10857,7 +10857,7 @@ void compressedMultiTexImage3DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexImage3DEXT* __restrict packet = (RenderCommand_compressedMultiTexImage3DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexImage3DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexImage3DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10881,7 +10881,7 @@ void compressedMultiTexImage2DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexImage2DEXT* __restrict packet = (RenderCommand_compressedMultiTexImage2DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexImage2DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10903,7 +10903,7 @@ void compressedMultiTexImage1DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexImage1DEXT* __restrict packet = (RenderCommand_compressedMultiTexImage1DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexImage1DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10928,7 +10928,7 @@ void compressedMultiTexSubImage3DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexSubImage3DEXT* __restrict packet = (RenderCommand_compressedMultiTexSubImage3DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexSubImage3DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexSubImage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexSubImage3DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10955,7 +10955,7 @@ void compressedMultiTexSubImage2DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexSubImage2DEXT* __restrict packet = (RenderCommand_compressedMultiTexSubImage2DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexSubImage2DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexSubImage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexSubImage2DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10978,7 +10978,7 @@ void compressedMultiTexSubImage1DEXT(
 	GLsizei imageSize,
 	const void *bits)
 {
-	RenderCommand_compressedMultiTexSubImage1DEXT* __restrict packet = (RenderCommand_compressedMultiTexSubImage1DEXT*)getNextPacket();
+	RenderCommand_compressedMultiTexSubImage1DEXT* __restrict packet = allocatePacket<RenderCommand_compressedMultiTexSubImage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compressedMultiTexSubImage1DEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -10995,7 +10995,7 @@ void getCompressedMultiTexImageEXT(
 	GLint lod,
 	void *img)
 {
-	RenderCommand_getCompressedMultiTexImageEXT* __restrict packet = (RenderCommand_getCompressedMultiTexImageEXT*)getNextPacket();
+	RenderCommand_getCompressedMultiTexImageEXT* __restrict packet = allocatePacket<RenderCommand_getCompressedMultiTexImageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCompressedMultiTexImageEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11006,7 +11006,7 @@ void matrixLoadTransposefEXT(
 	GLenum mode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixLoadTransposefEXT* __restrict packet = (RenderCommand_matrixLoadTransposefEXT*)getNextPacket();
+	RenderCommand_matrixLoadTransposefEXT* __restrict packet = allocatePacket<RenderCommand_matrixLoadTransposefEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoadTransposefEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -11015,7 +11015,7 @@ void matrixLoadTransposedEXT(
 	GLenum mode,
 	const GLdouble *m)
 {
-	RenderCommand_matrixLoadTransposedEXT* __restrict packet = (RenderCommand_matrixLoadTransposedEXT*)getNextPacket();
+	RenderCommand_matrixLoadTransposedEXT* __restrict packet = allocatePacket<RenderCommand_matrixLoadTransposedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoadTransposedEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -11024,7 +11024,7 @@ void matrixMultTransposefEXT(
 	GLenum mode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixMultTransposefEXT* __restrict packet = (RenderCommand_matrixMultTransposefEXT*)getNextPacket();
+	RenderCommand_matrixMultTransposefEXT* __restrict packet = allocatePacket<RenderCommand_matrixMultTransposefEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMultTransposefEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -11033,7 +11033,7 @@ void matrixMultTransposedEXT(
 	GLenum mode,
 	const GLdouble *m)
 {
-	RenderCommand_matrixMultTransposedEXT* __restrict packet = (RenderCommand_matrixMultTransposedEXT*)getNextPacket();
+	RenderCommand_matrixMultTransposedEXT* __restrict packet = allocatePacket<RenderCommand_matrixMultTransposedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMultTransposedEXT::execute);
 	packet->mode = mode;
 	packet->m = m;
@@ -11044,7 +11044,7 @@ void namedBufferDataEXT(
 	const void *data,
 	GLenum usage)
 {
-	RenderCommand_namedBufferDataEXT* __restrict packet = (RenderCommand_namedBufferDataEXT*)getNextPacket();
+	RenderCommand_namedBufferDataEXT* __restrict packet = allocatePacket<RenderCommand_namedBufferDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferDataEXT::execute);
 	packet->buffer = buffer;
 	packet->size = size;
@@ -11057,7 +11057,7 @@ void namedBufferSubDataEXT(
 	GLsizeiptr size,
 	const void *data)
 {
-	RenderCommand_namedBufferSubDataEXT* __restrict packet = (RenderCommand_namedBufferSubDataEXT*)getNextPacket();
+	RenderCommand_namedBufferSubDataEXT* __restrict packet = allocatePacket<RenderCommand_namedBufferSubDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferSubDataEXT::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -11068,7 +11068,7 @@ void* mapNamedBufferEXT(
 	GLuint buffer,
 	GLenum access)
 {
-	RenderCommand_mapNamedBufferEXT* __restrict packet = (RenderCommand_mapNamedBufferEXT*)getNextPacket();
+	RenderCommand_mapNamedBufferEXT* __restrict packet = allocatePacket<RenderCommand_mapNamedBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapNamedBufferEXT::execute);
 	packet->buffer = buffer;
 	packet->access = access;
@@ -11076,7 +11076,7 @@ void* mapNamedBufferEXT(
 GLboolean unmapNamedBufferEXT(
 	GLuint buffer)
 {
-	RenderCommand_unmapNamedBufferEXT* __restrict packet = (RenderCommand_unmapNamedBufferEXT*)getNextPacket();
+	RenderCommand_unmapNamedBufferEXT* __restrict packet = allocatePacket<RenderCommand_unmapNamedBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_unmapNamedBufferEXT::execute);
 	packet->buffer = buffer;
 }
@@ -11085,7 +11085,7 @@ void getNamedBufferParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedBufferParameterivEXT* __restrict packet = (RenderCommand_getNamedBufferParameterivEXT*)getNextPacket();
+	RenderCommand_getNamedBufferParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedBufferParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferParameterivEXT::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -11096,7 +11096,7 @@ void getNamedBufferPointervEXT(
 	GLenum pname,
 	void **params)
 {
-	RenderCommand_getNamedBufferPointervEXT* __restrict packet = (RenderCommand_getNamedBufferPointervEXT*)getNextPacket();
+	RenderCommand_getNamedBufferPointervEXT* __restrict packet = allocatePacket<RenderCommand_getNamedBufferPointervEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferPointervEXT::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -11108,7 +11108,7 @@ void getNamedBufferSubDataEXT(
 	GLsizeiptr size,
 	void *data)
 {
-	RenderCommand_getNamedBufferSubDataEXT* __restrict packet = (RenderCommand_getNamedBufferSubDataEXT*)getNextPacket();
+	RenderCommand_getNamedBufferSubDataEXT* __restrict packet = allocatePacket<RenderCommand_getNamedBufferSubDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferSubDataEXT::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -11120,7 +11120,7 @@ void programUniform1fEXT(
 	GLint location,
 	GLfloat v0)
 {
-	RenderCommand_programUniform1fEXT* __restrict packet = (RenderCommand_programUniform1fEXT*)getNextPacket();
+	RenderCommand_programUniform1fEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1fEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1fEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11132,7 +11132,7 @@ void programUniform2fEXT(
 	GLfloat v0,
 	GLfloat v1)
 {
-	RenderCommand_programUniform2fEXT* __restrict packet = (RenderCommand_programUniform2fEXT*)getNextPacket();
+	RenderCommand_programUniform2fEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2fEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2fEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11146,7 +11146,7 @@ void programUniform3fEXT(
 	GLfloat v1,
 	GLfloat v2)
 {
-	RenderCommand_programUniform3fEXT* __restrict packet = (RenderCommand_programUniform3fEXT*)getNextPacket();
+	RenderCommand_programUniform3fEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3fEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3fEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11162,7 +11162,7 @@ void programUniform4fEXT(
 	GLfloat v2,
 	GLfloat v3)
 {
-	RenderCommand_programUniform4fEXT* __restrict packet = (RenderCommand_programUniform4fEXT*)getNextPacket();
+	RenderCommand_programUniform4fEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4fEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4fEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11176,7 +11176,7 @@ void programUniform1iEXT(
 	GLint location,
 	GLint v0)
 {
-	RenderCommand_programUniform1iEXT* __restrict packet = (RenderCommand_programUniform1iEXT*)getNextPacket();
+	RenderCommand_programUniform1iEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1iEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1iEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11188,7 +11188,7 @@ void programUniform2iEXT(
 	GLint v0,
 	GLint v1)
 {
-	RenderCommand_programUniform2iEXT* __restrict packet = (RenderCommand_programUniform2iEXT*)getNextPacket();
+	RenderCommand_programUniform2iEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2iEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2iEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11202,7 +11202,7 @@ void programUniform3iEXT(
 	GLint v1,
 	GLint v2)
 {
-	RenderCommand_programUniform3iEXT* __restrict packet = (RenderCommand_programUniform3iEXT*)getNextPacket();
+	RenderCommand_programUniform3iEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3iEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3iEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11218,7 +11218,7 @@ void programUniform4iEXT(
 	GLint v2,
 	GLint v3)
 {
-	RenderCommand_programUniform4iEXT* __restrict packet = (RenderCommand_programUniform4iEXT*)getNextPacket();
+	RenderCommand_programUniform4iEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4iEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4iEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11233,7 +11233,7 @@ void programUniform1fvEXT(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform1fvEXT* __restrict packet = (RenderCommand_programUniform1fvEXT*)getNextPacket();
+	RenderCommand_programUniform1fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11246,7 +11246,7 @@ void programUniform2fvEXT(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform2fvEXT* __restrict packet = (RenderCommand_programUniform2fvEXT*)getNextPacket();
+	RenderCommand_programUniform2fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11259,7 +11259,7 @@ void programUniform3fvEXT(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform3fvEXT* __restrict packet = (RenderCommand_programUniform3fvEXT*)getNextPacket();
+	RenderCommand_programUniform3fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11272,7 +11272,7 @@ void programUniform4fvEXT(
 	GLsizei count,
 	const GLfloat *value)
 {
-	RenderCommand_programUniform4fvEXT* __restrict packet = (RenderCommand_programUniform4fvEXT*)getNextPacket();
+	RenderCommand_programUniform4fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11285,7 +11285,7 @@ void programUniform1ivEXT(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform1ivEXT* __restrict packet = (RenderCommand_programUniform1ivEXT*)getNextPacket();
+	RenderCommand_programUniform1ivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11298,7 +11298,7 @@ void programUniform2ivEXT(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform2ivEXT* __restrict packet = (RenderCommand_programUniform2ivEXT*)getNextPacket();
+	RenderCommand_programUniform2ivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11311,7 +11311,7 @@ void programUniform3ivEXT(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform3ivEXT* __restrict packet = (RenderCommand_programUniform3ivEXT*)getNextPacket();
+	RenderCommand_programUniform3ivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11324,7 +11324,7 @@ void programUniform4ivEXT(
 	GLsizei count,
 	const GLint *value)
 {
-	RenderCommand_programUniform4ivEXT* __restrict packet = (RenderCommand_programUniform4ivEXT*)getNextPacket();
+	RenderCommand_programUniform4ivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11338,7 +11338,7 @@ void programUniformMatrix2fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2fvEXT* __restrict packet = (RenderCommand_programUniformMatrix2fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11353,7 +11353,7 @@ void programUniformMatrix3fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3fvEXT* __restrict packet = (RenderCommand_programUniformMatrix3fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11368,7 +11368,7 @@ void programUniformMatrix4fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4fvEXT* __restrict packet = (RenderCommand_programUniformMatrix4fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11383,7 +11383,7 @@ void programUniformMatrix2x3fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2x3fvEXT* __restrict packet = (RenderCommand_programUniformMatrix2x3fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2x3fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x3fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x3fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11398,7 +11398,7 @@ void programUniformMatrix3x2fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3x2fvEXT* __restrict packet = (RenderCommand_programUniformMatrix3x2fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3x2fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x2fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x2fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11413,7 +11413,7 @@ void programUniformMatrix2x4fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix2x4fvEXT* __restrict packet = (RenderCommand_programUniformMatrix2x4fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2x4fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x4fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11428,7 +11428,7 @@ void programUniformMatrix4x2fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4x2fvEXT* __restrict packet = (RenderCommand_programUniformMatrix4x2fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4x2fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x2fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x2fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11443,7 +11443,7 @@ void programUniformMatrix3x4fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix3x4fvEXT* __restrict packet = (RenderCommand_programUniformMatrix3x4fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3x4fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x4fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11458,7 +11458,7 @@ void programUniformMatrix4x3fvEXT(
 	GLboolean transpose,
 	const GLfloat *value)
 {
-	RenderCommand_programUniformMatrix4x3fvEXT* __restrict packet = (RenderCommand_programUniformMatrix4x3fvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4x3fvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x3fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x3fvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11472,7 +11472,7 @@ void textureBufferEXT(
 	GLenum internalformat,
 	GLuint buffer)
 {
-	RenderCommand_textureBufferEXT* __restrict packet = (RenderCommand_textureBufferEXT*)getNextPacket();
+	RenderCommand_textureBufferEXT* __restrict packet = allocatePacket<RenderCommand_textureBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBufferEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -11485,7 +11485,7 @@ void multiTexBufferEXT(
 	GLenum internalformat,
 	GLuint buffer)
 {
-	RenderCommand_multiTexBufferEXT* __restrict packet = (RenderCommand_multiTexBufferEXT*)getNextPacket();
+	RenderCommand_multiTexBufferEXT* __restrict packet = allocatePacket<RenderCommand_multiTexBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexBufferEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11498,7 +11498,7 @@ void textureParameterIivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_textureParameterIivEXT* __restrict packet = (RenderCommand_textureParameterIivEXT*)getNextPacket();
+	RenderCommand_textureParameterIivEXT* __restrict packet = allocatePacket<RenderCommand_textureParameterIivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterIivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -11511,7 +11511,7 @@ void textureParameterIuivEXT(
 	GLenum pname,
 	const GLuint *params)
 {
-	RenderCommand_textureParameterIuivEXT* __restrict packet = (RenderCommand_textureParameterIuivEXT*)getNextPacket();
+	RenderCommand_textureParameterIuivEXT* __restrict packet = allocatePacket<RenderCommand_textureParameterIuivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureParameterIuivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -11524,7 +11524,7 @@ void getTextureParameterIivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getTextureParameterIivEXT* __restrict packet = (RenderCommand_getTextureParameterIivEXT*)getNextPacket();
+	RenderCommand_getTextureParameterIivEXT* __restrict packet = allocatePacket<RenderCommand_getTextureParameterIivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterIivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -11537,7 +11537,7 @@ void getTextureParameterIuivEXT(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getTextureParameterIuivEXT* __restrict packet = (RenderCommand_getTextureParameterIuivEXT*)getNextPacket();
+	RenderCommand_getTextureParameterIuivEXT* __restrict packet = allocatePacket<RenderCommand_getTextureParameterIuivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureParameterIuivEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -11550,7 +11550,7 @@ void multiTexParameterIivEXT(
 	GLenum pname,
 	const GLint *params)
 {
-	RenderCommand_multiTexParameterIivEXT* __restrict packet = (RenderCommand_multiTexParameterIivEXT*)getNextPacket();
+	RenderCommand_multiTexParameterIivEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameterIivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameterIivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11563,7 +11563,7 @@ void multiTexParameterIuivEXT(
 	GLenum pname,
 	const GLuint *params)
 {
-	RenderCommand_multiTexParameterIuivEXT* __restrict packet = (RenderCommand_multiTexParameterIuivEXT*)getNextPacket();
+	RenderCommand_multiTexParameterIuivEXT* __restrict packet = allocatePacket<RenderCommand_multiTexParameterIuivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexParameterIuivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11576,7 +11576,7 @@ void getMultiTexParameterIivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getMultiTexParameterIivEXT* __restrict packet = (RenderCommand_getMultiTexParameterIivEXT*)getNextPacket();
+	RenderCommand_getMultiTexParameterIivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexParameterIivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexParameterIivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11589,7 +11589,7 @@ void getMultiTexParameterIuivEXT(
 	GLenum pname,
 	GLuint *params)
 {
-	RenderCommand_getMultiTexParameterIuivEXT* __restrict packet = (RenderCommand_getMultiTexParameterIuivEXT*)getNextPacket();
+	RenderCommand_getMultiTexParameterIuivEXT* __restrict packet = allocatePacket<RenderCommand_getMultiTexParameterIuivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMultiTexParameterIuivEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -11601,7 +11601,7 @@ void programUniform1uiEXT(
 	GLint location,
 	GLuint v0)
 {
-	RenderCommand_programUniform1uiEXT* __restrict packet = (RenderCommand_programUniform1uiEXT*)getNextPacket();
+	RenderCommand_programUniform1uiEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1uiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1uiEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11613,7 +11613,7 @@ void programUniform2uiEXT(
 	GLuint v0,
 	GLuint v1)
 {
-	RenderCommand_programUniform2uiEXT* __restrict packet = (RenderCommand_programUniform2uiEXT*)getNextPacket();
+	RenderCommand_programUniform2uiEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2uiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2uiEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11627,7 +11627,7 @@ void programUniform3uiEXT(
 	GLuint v1,
 	GLuint v2)
 {
-	RenderCommand_programUniform3uiEXT* __restrict packet = (RenderCommand_programUniform3uiEXT*)getNextPacket();
+	RenderCommand_programUniform3uiEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3uiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3uiEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11643,7 +11643,7 @@ void programUniform4uiEXT(
 	GLuint v2,
 	GLuint v3)
 {
-	RenderCommand_programUniform4uiEXT* __restrict packet = (RenderCommand_programUniform4uiEXT*)getNextPacket();
+	RenderCommand_programUniform4uiEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4uiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4uiEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11658,7 +11658,7 @@ void programUniform1uivEXT(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform1uivEXT* __restrict packet = (RenderCommand_programUniform1uivEXT*)getNextPacket();
+	RenderCommand_programUniform1uivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1uivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11671,7 +11671,7 @@ void programUniform2uivEXT(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform2uivEXT* __restrict packet = (RenderCommand_programUniform2uivEXT*)getNextPacket();
+	RenderCommand_programUniform2uivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2uivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11684,7 +11684,7 @@ void programUniform3uivEXT(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform3uivEXT* __restrict packet = (RenderCommand_programUniform3uivEXT*)getNextPacket();
+	RenderCommand_programUniform3uivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3uivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11697,7 +11697,7 @@ void programUniform4uivEXT(
 	GLsizei count,
 	const GLuint *value)
 {
-	RenderCommand_programUniform4uivEXT* __restrict packet = (RenderCommand_programUniform4uivEXT*)getNextPacket();
+	RenderCommand_programUniform4uivEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4uivEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -11711,7 +11711,7 @@ void namedProgramLocalParameters4fvEXT(
 	GLsizei count,
 	const GLfloat *params)
 {
-	RenderCommand_namedProgramLocalParameters4fvEXT* __restrict packet = (RenderCommand_namedProgramLocalParameters4fvEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameters4fvEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameters4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameters4fvEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11728,7 +11728,7 @@ void namedProgramLocalParameterI4iEXT(
 	GLint z,
 	GLint w)
 {
-	RenderCommand_namedProgramLocalParameterI4iEXT* __restrict packet = (RenderCommand_namedProgramLocalParameterI4iEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameterI4iEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameterI4iEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameterI4iEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11744,7 +11744,7 @@ void namedProgramLocalParameterI4ivEXT(
 	GLuint index,
 	const GLint *params)
 {
-	RenderCommand_namedProgramLocalParameterI4ivEXT* __restrict packet = (RenderCommand_namedProgramLocalParameterI4ivEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameterI4ivEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameterI4ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameterI4ivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11758,7 +11758,7 @@ void namedProgramLocalParametersI4ivEXT(
 	GLsizei count,
 	const GLint *params)
 {
-	RenderCommand_namedProgramLocalParametersI4ivEXT* __restrict packet = (RenderCommand_namedProgramLocalParametersI4ivEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParametersI4ivEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParametersI4ivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParametersI4ivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11775,7 +11775,7 @@ void namedProgramLocalParameterI4uiEXT(
 	GLuint z,
 	GLuint w)
 {
-	RenderCommand_namedProgramLocalParameterI4uiEXT* __restrict packet = (RenderCommand_namedProgramLocalParameterI4uiEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameterI4uiEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameterI4uiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameterI4uiEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11791,7 +11791,7 @@ void namedProgramLocalParameterI4uivEXT(
 	GLuint index,
 	const GLuint *params)
 {
-	RenderCommand_namedProgramLocalParameterI4uivEXT* __restrict packet = (RenderCommand_namedProgramLocalParameterI4uivEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameterI4uivEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameterI4uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameterI4uivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11805,7 +11805,7 @@ void namedProgramLocalParametersI4uivEXT(
 	GLsizei count,
 	const GLuint *params)
 {
-	RenderCommand_namedProgramLocalParametersI4uivEXT* __restrict packet = (RenderCommand_namedProgramLocalParametersI4uivEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParametersI4uivEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParametersI4uivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParametersI4uivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11819,7 +11819,7 @@ void getNamedProgramLocalParameterIivEXT(
 	GLuint index,
 	GLint *params)
 {
-	RenderCommand_getNamedProgramLocalParameterIivEXT* __restrict packet = (RenderCommand_getNamedProgramLocalParameterIivEXT*)getNextPacket();
+	RenderCommand_getNamedProgramLocalParameterIivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramLocalParameterIivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramLocalParameterIivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11832,7 +11832,7 @@ void getNamedProgramLocalParameterIuivEXT(
 	GLuint index,
 	GLuint *params)
 {
-	RenderCommand_getNamedProgramLocalParameterIuivEXT* __restrict packet = (RenderCommand_getNamedProgramLocalParameterIuivEXT*)getNextPacket();
+	RenderCommand_getNamedProgramLocalParameterIuivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramLocalParameterIuivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramLocalParameterIuivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11843,7 +11843,7 @@ void enableClientStateiEXT(
 	GLenum array,
 	GLuint index)
 {
-	RenderCommand_enableClientStateiEXT* __restrict packet = (RenderCommand_enableClientStateiEXT*)getNextPacket();
+	RenderCommand_enableClientStateiEXT* __restrict packet = allocatePacket<RenderCommand_enableClientStateiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableClientStateiEXT::execute);
 	packet->array = array;
 	packet->index = index;
@@ -11852,7 +11852,7 @@ void disableClientStateiEXT(
 	GLenum array,
 	GLuint index)
 {
-	RenderCommand_disableClientStateiEXT* __restrict packet = (RenderCommand_disableClientStateiEXT*)getNextPacket();
+	RenderCommand_disableClientStateiEXT* __restrict packet = allocatePacket<RenderCommand_disableClientStateiEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableClientStateiEXT::execute);
 	packet->array = array;
 	packet->index = index;
@@ -11862,7 +11862,7 @@ void getFloati_vEXT(
 	GLuint index,
 	GLfloat *params)
 {
-	RenderCommand_getFloati_vEXT* __restrict packet = (RenderCommand_getFloati_vEXT*)getNextPacket();
+	RenderCommand_getFloati_vEXT* __restrict packet = allocatePacket<RenderCommand_getFloati_vEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFloati_vEXT::execute);
 	packet->pname = pname;
 	packet->index = index;
@@ -11873,7 +11873,7 @@ void getDoublei_vEXT(
 	GLuint index,
 	GLdouble *params)
 {
-	RenderCommand_getDoublei_vEXT* __restrict packet = (RenderCommand_getDoublei_vEXT*)getNextPacket();
+	RenderCommand_getDoublei_vEXT* __restrict packet = allocatePacket<RenderCommand_getDoublei_vEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getDoublei_vEXT::execute);
 	packet->pname = pname;
 	packet->index = index;
@@ -11884,7 +11884,7 @@ void getPointeri_vEXT(
 	GLuint index,
 	void **params)
 {
-	RenderCommand_getPointeri_vEXT* __restrict packet = (RenderCommand_getPointeri_vEXT*)getNextPacket();
+	RenderCommand_getPointeri_vEXT* __restrict packet = allocatePacket<RenderCommand_getPointeri_vEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPointeri_vEXT::execute);
 	packet->pname = pname;
 	packet->index = index;
@@ -11897,7 +11897,7 @@ void namedProgramStringEXT(
 	GLsizei len,
 	const void *string)
 {
-	RenderCommand_namedProgramStringEXT* __restrict packet = (RenderCommand_namedProgramStringEXT*)getNextPacket();
+	RenderCommand_namedProgramStringEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramStringEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramStringEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11914,7 +11914,7 @@ void namedProgramLocalParameter4dEXT(
 	GLdouble z,
 	GLdouble w)
 {
-	RenderCommand_namedProgramLocalParameter4dEXT* __restrict packet = (RenderCommand_namedProgramLocalParameter4dEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameter4dEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameter4dEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameter4dEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11930,7 +11930,7 @@ void namedProgramLocalParameter4dvEXT(
 	GLuint index,
 	const GLdouble *params)
 {
-	RenderCommand_namedProgramLocalParameter4dvEXT* __restrict packet = (RenderCommand_namedProgramLocalParameter4dvEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameter4dvEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameter4dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameter4dvEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11946,7 +11946,7 @@ void namedProgramLocalParameter4fEXT(
 	GLfloat z,
 	GLfloat w)
 {
-	RenderCommand_namedProgramLocalParameter4fEXT* __restrict packet = (RenderCommand_namedProgramLocalParameter4fEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameter4fEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameter4fEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameter4fEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11962,7 +11962,7 @@ void namedProgramLocalParameter4fvEXT(
 	GLuint index,
 	const GLfloat *params)
 {
-	RenderCommand_namedProgramLocalParameter4fvEXT* __restrict packet = (RenderCommand_namedProgramLocalParameter4fvEXT*)getNextPacket();
+	RenderCommand_namedProgramLocalParameter4fvEXT* __restrict packet = allocatePacket<RenderCommand_namedProgramLocalParameter4fvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedProgramLocalParameter4fvEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11975,7 +11975,7 @@ void getNamedProgramLocalParameterdvEXT(
 	GLuint index,
 	GLdouble *params)
 {
-	RenderCommand_getNamedProgramLocalParameterdvEXT* __restrict packet = (RenderCommand_getNamedProgramLocalParameterdvEXT*)getNextPacket();
+	RenderCommand_getNamedProgramLocalParameterdvEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramLocalParameterdvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramLocalParameterdvEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -11988,7 +11988,7 @@ void getNamedProgramLocalParameterfvEXT(
 	GLuint index,
 	GLfloat *params)
 {
-	RenderCommand_getNamedProgramLocalParameterfvEXT* __restrict packet = (RenderCommand_getNamedProgramLocalParameterfvEXT*)getNextPacket();
+	RenderCommand_getNamedProgramLocalParameterfvEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramLocalParameterfvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramLocalParameterfvEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -12001,7 +12001,7 @@ void getNamedProgramivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedProgramivEXT* __restrict packet = (RenderCommand_getNamedProgramivEXT*)getNextPacket();
+	RenderCommand_getNamedProgramivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramivEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -12014,7 +12014,7 @@ void getNamedProgramStringEXT(
 	GLenum pname,
 	void *string)
 {
-	RenderCommand_getNamedProgramStringEXT* __restrict packet = (RenderCommand_getNamedProgramStringEXT*)getNextPacket();
+	RenderCommand_getNamedProgramStringEXT* __restrict packet = allocatePacket<RenderCommand_getNamedProgramStringEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedProgramStringEXT::execute);
 	packet->program = program;
 	packet->target = target;
@@ -12027,7 +12027,7 @@ void namedRenderbufferStorageEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorageEXT* __restrict packet = (RenderCommand_namedRenderbufferStorageEXT*)getNextPacket();
+	RenderCommand_namedRenderbufferStorageEXT* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorageEXT::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->internalformat = internalformat;
@@ -12039,7 +12039,7 @@ void getNamedRenderbufferParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedRenderbufferParameterivEXT* __restrict packet = (RenderCommand_getNamedRenderbufferParameterivEXT*)getNextPacket();
+	RenderCommand_getNamedRenderbufferParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedRenderbufferParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedRenderbufferParameterivEXT::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->pname = pname;
@@ -12052,7 +12052,7 @@ void namedRenderbufferStorageMultisampleEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorageMultisampleEXT* __restrict packet = (RenderCommand_namedRenderbufferStorageMultisampleEXT*)getNextPacket();
+	RenderCommand_namedRenderbufferStorageMultisampleEXT* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorageMultisampleEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorageMultisampleEXT::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->samples = samples;
@@ -12068,7 +12068,7 @@ void namedRenderbufferStorageMultisampleCoverageEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT* __restrict packet = (RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT*)getNextPacket();
+	RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT* __restrict packet = allocatePacket<RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT::execute);
 	packet->renderbuffer = renderbuffer;
 	packet->coverageSamples = coverageSamples;
@@ -12081,7 +12081,7 @@ GLenum checkNamedFramebufferStatusEXT(
 	GLuint framebuffer,
 	GLenum target)
 {
-	RenderCommand_checkNamedFramebufferStatusEXT* __restrict packet = (RenderCommand_checkNamedFramebufferStatusEXT*)getNextPacket();
+	RenderCommand_checkNamedFramebufferStatusEXT* __restrict packet = allocatePacket<RenderCommand_checkNamedFramebufferStatusEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_checkNamedFramebufferStatusEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->target = target;
@@ -12093,7 +12093,7 @@ void namedFramebufferTexture1DEXT(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_namedFramebufferTexture1DEXT* __restrict packet = (RenderCommand_namedFramebufferTexture1DEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTexture1DEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTexture1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTexture1DEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12108,7 +12108,7 @@ void namedFramebufferTexture2DEXT(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_namedFramebufferTexture2DEXT* __restrict packet = (RenderCommand_namedFramebufferTexture2DEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTexture2DEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTexture2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTexture2DEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12124,7 +12124,7 @@ void namedFramebufferTexture3DEXT(
 	GLint level,
 	GLint zoffset)
 {
-	RenderCommand_namedFramebufferTexture3DEXT* __restrict packet = (RenderCommand_namedFramebufferTexture3DEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTexture3DEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTexture3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTexture3DEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12139,7 +12139,7 @@ void namedFramebufferRenderbufferEXT(
 	GLenum renderbuffertarget,
 	GLuint renderbuffer)
 {
-	RenderCommand_namedFramebufferRenderbufferEXT* __restrict packet = (RenderCommand_namedFramebufferRenderbufferEXT*)getNextPacket();
+	RenderCommand_namedFramebufferRenderbufferEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferRenderbufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferRenderbufferEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12152,7 +12152,7 @@ void getNamedFramebufferAttachmentParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedFramebufferAttachmentParameterivEXT* __restrict packet = (RenderCommand_getNamedFramebufferAttachmentParameterivEXT*)getNextPacket();
+	RenderCommand_getNamedFramebufferAttachmentParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedFramebufferAttachmentParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedFramebufferAttachmentParameterivEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12163,7 +12163,7 @@ void generateTextureMipmapEXT(
 	GLuint texture,
 	GLenum target)
 {
-	RenderCommand_generateTextureMipmapEXT* __restrict packet = (RenderCommand_generateTextureMipmapEXT*)getNextPacket();
+	RenderCommand_generateTextureMipmapEXT* __restrict packet = allocatePacket<RenderCommand_generateTextureMipmapEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_generateTextureMipmapEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12172,7 +12172,7 @@ void generateMultiTexMipmapEXT(
 	GLenum texunit,
 	GLenum target)
 {
-	RenderCommand_generateMultiTexMipmapEXT* __restrict packet = (RenderCommand_generateMultiTexMipmapEXT*)getNextPacket();
+	RenderCommand_generateMultiTexMipmapEXT* __restrict packet = allocatePacket<RenderCommand_generateMultiTexMipmapEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_generateMultiTexMipmapEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -12181,7 +12181,7 @@ void framebufferDrawBufferEXT(
 	GLuint framebuffer,
 	GLenum mode)
 {
-	RenderCommand_framebufferDrawBufferEXT* __restrict packet = (RenderCommand_framebufferDrawBufferEXT*)getNextPacket();
+	RenderCommand_framebufferDrawBufferEXT* __restrict packet = allocatePacket<RenderCommand_framebufferDrawBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferDrawBufferEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->mode = mode;
@@ -12191,7 +12191,7 @@ void framebufferDrawBuffersEXT(
 	GLsizei n,
 	const GLenum *bufs)
 {
-	RenderCommand_framebufferDrawBuffersEXT* __restrict packet = (RenderCommand_framebufferDrawBuffersEXT*)getNextPacket();
+	RenderCommand_framebufferDrawBuffersEXT* __restrict packet = allocatePacket<RenderCommand_framebufferDrawBuffersEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferDrawBuffersEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->n = n;
@@ -12201,7 +12201,7 @@ void framebufferReadBufferEXT(
 	GLuint framebuffer,
 	GLenum mode)
 {
-	RenderCommand_framebufferReadBufferEXT* __restrict packet = (RenderCommand_framebufferReadBufferEXT*)getNextPacket();
+	RenderCommand_framebufferReadBufferEXT* __restrict packet = allocatePacket<RenderCommand_framebufferReadBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferReadBufferEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->mode = mode;
@@ -12211,7 +12211,7 @@ void getFramebufferParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getFramebufferParameterivEXT* __restrict packet = (RenderCommand_getFramebufferParameterivEXT*)getNextPacket();
+	RenderCommand_getFramebufferParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getFramebufferParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFramebufferParameterivEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->pname = pname;
@@ -12224,7 +12224,7 @@ void namedCopyBufferSubDataEXT(
 	GLintptr writeOffset,
 	GLsizeiptr size)
 {
-	RenderCommand_namedCopyBufferSubDataEXT* __restrict packet = (RenderCommand_namedCopyBufferSubDataEXT*)getNextPacket();
+	RenderCommand_namedCopyBufferSubDataEXT* __restrict packet = allocatePacket<RenderCommand_namedCopyBufferSubDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedCopyBufferSubDataEXT::execute);
 	packet->readBuffer = readBuffer;
 	packet->writeBuffer = writeBuffer;
@@ -12238,7 +12238,7 @@ void namedFramebufferTextureEXT(
 	GLuint texture,
 	GLint level)
 {
-	RenderCommand_namedFramebufferTextureEXT* __restrict packet = (RenderCommand_namedFramebufferTextureEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTextureEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTextureEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTextureEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12252,7 +12252,7 @@ void namedFramebufferTextureLayerEXT(
 	GLint level,
 	GLint layer)
 {
-	RenderCommand_namedFramebufferTextureLayerEXT* __restrict packet = (RenderCommand_namedFramebufferTextureLayerEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTextureLayerEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTextureLayerEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTextureLayerEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12267,7 +12267,7 @@ void namedFramebufferTextureFaceEXT(
 	GLint level,
 	GLenum face)
 {
-	RenderCommand_namedFramebufferTextureFaceEXT* __restrict packet = (RenderCommand_namedFramebufferTextureFaceEXT*)getNextPacket();
+	RenderCommand_namedFramebufferTextureFaceEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferTextureFaceEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferTextureFaceEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->attachment = attachment;
@@ -12280,7 +12280,7 @@ void textureRenderbufferEXT(
 	GLenum target,
 	GLuint renderbuffer)
 {
-	RenderCommand_textureRenderbufferEXT* __restrict packet = (RenderCommand_textureRenderbufferEXT*)getNextPacket();
+	RenderCommand_textureRenderbufferEXT* __restrict packet = allocatePacket<RenderCommand_textureRenderbufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureRenderbufferEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12291,7 +12291,7 @@ void multiTexRenderbufferEXT(
 	GLenum target,
 	GLuint renderbuffer)
 {
-	RenderCommand_multiTexRenderbufferEXT* __restrict packet = (RenderCommand_multiTexRenderbufferEXT*)getNextPacket();
+	RenderCommand_multiTexRenderbufferEXT* __restrict packet = allocatePacket<RenderCommand_multiTexRenderbufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiTexRenderbufferEXT::execute);
 	packet->texunit = texunit;
 	packet->target = target;
@@ -12305,7 +12305,7 @@ void vertexArrayVertexOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayVertexOffsetEXT* __restrict packet = (RenderCommand_vertexArrayVertexOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12322,7 +12322,7 @@ void vertexArrayColorOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayColorOffsetEXT* __restrict packet = (RenderCommand_vertexArrayColorOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayColorOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayColorOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayColorOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12337,7 +12337,7 @@ void vertexArrayEdgeFlagOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayEdgeFlagOffsetEXT* __restrict packet = (RenderCommand_vertexArrayEdgeFlagOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayEdgeFlagOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayEdgeFlagOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayEdgeFlagOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12351,7 +12351,7 @@ void vertexArrayIndexOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayIndexOffsetEXT* __restrict packet = (RenderCommand_vertexArrayIndexOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayIndexOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayIndexOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayIndexOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12366,7 +12366,7 @@ void vertexArrayNormalOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayNormalOffsetEXT* __restrict packet = (RenderCommand_vertexArrayNormalOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayNormalOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayNormalOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayNormalOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12382,7 +12382,7 @@ void vertexArrayTexCoordOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayTexCoordOffsetEXT* __restrict packet = (RenderCommand_vertexArrayTexCoordOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayTexCoordOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayTexCoordOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayTexCoordOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12400,7 +12400,7 @@ void vertexArrayMultiTexCoordOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayMultiTexCoordOffsetEXT* __restrict packet = (RenderCommand_vertexArrayMultiTexCoordOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayMultiTexCoordOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayMultiTexCoordOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayMultiTexCoordOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12417,7 +12417,7 @@ void vertexArrayFogCoordOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayFogCoordOffsetEXT* __restrict packet = (RenderCommand_vertexArrayFogCoordOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayFogCoordOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayFogCoordOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayFogCoordOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12433,7 +12433,7 @@ void vertexArraySecondaryColorOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArraySecondaryColorOffsetEXT* __restrict packet = (RenderCommand_vertexArraySecondaryColorOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArraySecondaryColorOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArraySecondaryColorOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArraySecondaryColorOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12452,7 +12452,7 @@ void vertexArrayVertexAttribOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayVertexAttribOffsetEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12472,7 +12472,7 @@ void vertexArrayVertexAttribIOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayVertexAttribIOffsetEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribIOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribIOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribIOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribIOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -12486,7 +12486,7 @@ void enableVertexArrayEXT(
 	GLuint vaobj,
 	GLenum array)
 {
-	RenderCommand_enableVertexArrayEXT* __restrict packet = (RenderCommand_enableVertexArrayEXT*)getNextPacket();
+	RenderCommand_enableVertexArrayEXT* __restrict packet = allocatePacket<RenderCommand_enableVertexArrayEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableVertexArrayEXT::execute);
 	packet->vaobj = vaobj;
 	packet->array = array;
@@ -12495,7 +12495,7 @@ void disableVertexArrayEXT(
 	GLuint vaobj,
 	GLenum array)
 {
-	RenderCommand_disableVertexArrayEXT* __restrict packet = (RenderCommand_disableVertexArrayEXT*)getNextPacket();
+	RenderCommand_disableVertexArrayEXT* __restrict packet = allocatePacket<RenderCommand_disableVertexArrayEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableVertexArrayEXT::execute);
 	packet->vaobj = vaobj;
 	packet->array = array;
@@ -12504,7 +12504,7 @@ void enableVertexArrayAttribEXT(
 	GLuint vaobj,
 	GLuint index)
 {
-	RenderCommand_enableVertexArrayAttribEXT* __restrict packet = (RenderCommand_enableVertexArrayAttribEXT*)getNextPacket();
+	RenderCommand_enableVertexArrayAttribEXT* __restrict packet = allocatePacket<RenderCommand_enableVertexArrayAttribEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_enableVertexArrayAttribEXT::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -12513,7 +12513,7 @@ void disableVertexArrayAttribEXT(
 	GLuint vaobj,
 	GLuint index)
 {
-	RenderCommand_disableVertexArrayAttribEXT* __restrict packet = (RenderCommand_disableVertexArrayAttribEXT*)getNextPacket();
+	RenderCommand_disableVertexArrayAttribEXT* __restrict packet = allocatePacket<RenderCommand_disableVertexArrayAttribEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_disableVertexArrayAttribEXT::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -12523,7 +12523,7 @@ void getVertexArrayIntegervEXT(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getVertexArrayIntegervEXT* __restrict packet = (RenderCommand_getVertexArrayIntegervEXT*)getNextPacket();
+	RenderCommand_getVertexArrayIntegervEXT* __restrict packet = allocatePacket<RenderCommand_getVertexArrayIntegervEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayIntegervEXT::execute);
 	packet->vaobj = vaobj;
 	packet->pname = pname;
@@ -12534,7 +12534,7 @@ void getVertexArrayPointervEXT(
 	GLenum pname,
 	void **param)
 {
-	RenderCommand_getVertexArrayPointervEXT* __restrict packet = (RenderCommand_getVertexArrayPointervEXT*)getNextPacket();
+	RenderCommand_getVertexArrayPointervEXT* __restrict packet = allocatePacket<RenderCommand_getVertexArrayPointervEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayPointervEXT::execute);
 	packet->vaobj = vaobj;
 	packet->pname = pname;
@@ -12546,7 +12546,7 @@ void getVertexArrayIntegeri_vEXT(
 	GLenum pname,
 	GLint *param)
 {
-	RenderCommand_getVertexArrayIntegeri_vEXT* __restrict packet = (RenderCommand_getVertexArrayIntegeri_vEXT*)getNextPacket();
+	RenderCommand_getVertexArrayIntegeri_vEXT* __restrict packet = allocatePacket<RenderCommand_getVertexArrayIntegeri_vEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayIntegeri_vEXT::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -12559,7 +12559,7 @@ void getVertexArrayPointeri_vEXT(
 	GLenum pname,
 	void **param)
 {
-	RenderCommand_getVertexArrayPointeri_vEXT* __restrict packet = (RenderCommand_getVertexArrayPointeri_vEXT*)getNextPacket();
+	RenderCommand_getVertexArrayPointeri_vEXT* __restrict packet = allocatePacket<RenderCommand_getVertexArrayPointeri_vEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexArrayPointeri_vEXT::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -12572,7 +12572,7 @@ void* mapNamedBufferRangeEXT(
 	GLsizeiptr length,
 	GLbitfield access)
 {
-	RenderCommand_mapNamedBufferRangeEXT* __restrict packet = (RenderCommand_mapNamedBufferRangeEXT*)getNextPacket();
+	RenderCommand_mapNamedBufferRangeEXT* __restrict packet = allocatePacket<RenderCommand_mapNamedBufferRangeEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_mapNamedBufferRangeEXT::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -12584,7 +12584,7 @@ void flushMappedNamedBufferRangeEXT(
 	GLintptr offset,
 	GLsizeiptr length)
 {
-	RenderCommand_flushMappedNamedBufferRangeEXT* __restrict packet = (RenderCommand_flushMappedNamedBufferRangeEXT*)getNextPacket();
+	RenderCommand_flushMappedNamedBufferRangeEXT* __restrict packet = allocatePacket<RenderCommand_flushMappedNamedBufferRangeEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_flushMappedNamedBufferRangeEXT::execute);
 	packet->buffer = buffer;
 	packet->offset = offset;
@@ -12596,7 +12596,7 @@ void namedBufferStorageEXT(
 	const void *data,
 	GLbitfield flags)
 {
-	RenderCommand_namedBufferStorageEXT* __restrict packet = (RenderCommand_namedBufferStorageEXT*)getNextPacket();
+	RenderCommand_namedBufferStorageEXT* __restrict packet = allocatePacket<RenderCommand_namedBufferStorageEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferStorageEXT::execute);
 	packet->buffer = buffer;
 	packet->size = size;
@@ -12610,7 +12610,7 @@ void clearNamedBufferDataEXT(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearNamedBufferDataEXT* __restrict packet = (RenderCommand_clearNamedBufferDataEXT*)getNextPacket();
+	RenderCommand_clearNamedBufferDataEXT* __restrict packet = allocatePacket<RenderCommand_clearNamedBufferDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedBufferDataEXT::execute);
 	packet->buffer = buffer;
 	packet->internalformat = internalformat;
@@ -12627,7 +12627,7 @@ void clearNamedBufferSubDataEXT(
 	GLenum type,
 	const void *data)
 {
-	RenderCommand_clearNamedBufferSubDataEXT* __restrict packet = (RenderCommand_clearNamedBufferSubDataEXT*)getNextPacket();
+	RenderCommand_clearNamedBufferSubDataEXT* __restrict packet = allocatePacket<RenderCommand_clearNamedBufferSubDataEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_clearNamedBufferSubDataEXT::execute);
 	packet->buffer = buffer;
 	packet->internalformat = internalformat;
@@ -12642,7 +12642,7 @@ void namedFramebufferParameteriEXT(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_namedFramebufferParameteriEXT* __restrict packet = (RenderCommand_namedFramebufferParameteriEXT*)getNextPacket();
+	RenderCommand_namedFramebufferParameteriEXT* __restrict packet = allocatePacket<RenderCommand_namedFramebufferParameteriEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferParameteriEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->pname = pname;
@@ -12653,7 +12653,7 @@ void getNamedFramebufferParameterivEXT(
 	GLenum pname,
 	GLint *params)
 {
-	RenderCommand_getNamedFramebufferParameterivEXT* __restrict packet = (RenderCommand_getNamedFramebufferParameterivEXT*)getNextPacket();
+	RenderCommand_getNamedFramebufferParameterivEXT* __restrict packet = allocatePacket<RenderCommand_getNamedFramebufferParameterivEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedFramebufferParameterivEXT::execute);
 	packet->framebuffer = framebuffer;
 	packet->pname = pname;
@@ -12664,7 +12664,7 @@ void programUniform1dEXT(
 	GLint location,
 	GLdouble x)
 {
-	RenderCommand_programUniform1dEXT* __restrict packet = (RenderCommand_programUniform1dEXT*)getNextPacket();
+	RenderCommand_programUniform1dEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1dEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1dEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12676,7 +12676,7 @@ void programUniform2dEXT(
 	GLdouble x,
 	GLdouble y)
 {
-	RenderCommand_programUniform2dEXT* __restrict packet = (RenderCommand_programUniform2dEXT*)getNextPacket();
+	RenderCommand_programUniform2dEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2dEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2dEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12690,7 +12690,7 @@ void programUniform3dEXT(
 	GLdouble y,
 	GLdouble z)
 {
-	RenderCommand_programUniform3dEXT* __restrict packet = (RenderCommand_programUniform3dEXT*)getNextPacket();
+	RenderCommand_programUniform3dEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3dEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3dEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12706,7 +12706,7 @@ void programUniform4dEXT(
 	GLdouble z,
 	GLdouble w)
 {
-	RenderCommand_programUniform4dEXT* __restrict packet = (RenderCommand_programUniform4dEXT*)getNextPacket();
+	RenderCommand_programUniform4dEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4dEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4dEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12721,7 +12721,7 @@ void programUniform1dvEXT(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform1dvEXT* __restrict packet = (RenderCommand_programUniform1dvEXT*)getNextPacket();
+	RenderCommand_programUniform1dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform1dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12734,7 +12734,7 @@ void programUniform2dvEXT(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform2dvEXT* __restrict packet = (RenderCommand_programUniform2dvEXT*)getNextPacket();
+	RenderCommand_programUniform2dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform2dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12747,7 +12747,7 @@ void programUniform3dvEXT(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform3dvEXT* __restrict packet = (RenderCommand_programUniform3dvEXT*)getNextPacket();
+	RenderCommand_programUniform3dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform3dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12760,7 +12760,7 @@ void programUniform4dvEXT(
 	GLsizei count,
 	const GLdouble *value)
 {
-	RenderCommand_programUniform4dvEXT* __restrict packet = (RenderCommand_programUniform4dvEXT*)getNextPacket();
+	RenderCommand_programUniform4dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniform4dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12774,7 +12774,7 @@ void programUniformMatrix2dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2dvEXT* __restrict packet = (RenderCommand_programUniformMatrix2dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12789,7 +12789,7 @@ void programUniformMatrix3dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3dvEXT* __restrict packet = (RenderCommand_programUniformMatrix3dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12804,7 +12804,7 @@ void programUniformMatrix4dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4dvEXT* __restrict packet = (RenderCommand_programUniformMatrix4dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12819,7 +12819,7 @@ void programUniformMatrix2x3dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2x3dvEXT* __restrict packet = (RenderCommand_programUniformMatrix2x3dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2x3dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x3dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x3dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12834,7 +12834,7 @@ void programUniformMatrix2x4dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix2x4dvEXT* __restrict packet = (RenderCommand_programUniformMatrix2x4dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix2x4dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix2x4dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix2x4dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12849,7 +12849,7 @@ void programUniformMatrix3x2dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3x2dvEXT* __restrict packet = (RenderCommand_programUniformMatrix3x2dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3x2dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x2dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x2dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12864,7 +12864,7 @@ void programUniformMatrix3x4dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix3x4dvEXT* __restrict packet = (RenderCommand_programUniformMatrix3x4dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix3x4dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix3x4dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix3x4dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12879,7 +12879,7 @@ void programUniformMatrix4x2dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4x2dvEXT* __restrict packet = (RenderCommand_programUniformMatrix4x2dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4x2dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x2dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x2dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12894,7 +12894,7 @@ void programUniformMatrix4x3dvEXT(
 	GLboolean transpose,
 	const GLdouble *value)
 {
-	RenderCommand_programUniformMatrix4x3dvEXT* __restrict packet = (RenderCommand_programUniformMatrix4x3dvEXT*)getNextPacket();
+	RenderCommand_programUniformMatrix4x3dvEXT* __restrict packet = allocatePacket<RenderCommand_programUniformMatrix4x3dvEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformMatrix4x3dvEXT::execute);
 	packet->program = program;
 	packet->location = location;
@@ -12910,7 +12910,7 @@ void textureBufferRangeEXT(
 	GLintptr offset,
 	GLsizeiptr size)
 {
-	RenderCommand_textureBufferRangeEXT* __restrict packet = (RenderCommand_textureBufferRangeEXT*)getNextPacket();
+	RenderCommand_textureBufferRangeEXT* __restrict packet = allocatePacket<RenderCommand_textureBufferRangeEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBufferRangeEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12926,7 +12926,7 @@ void textureStorage1DEXT(
 	GLenum internalformat,
 	GLsizei width)
 {
-	RenderCommand_textureStorage1DEXT* __restrict packet = (RenderCommand_textureStorage1DEXT*)getNextPacket();
+	RenderCommand_textureStorage1DEXT* __restrict packet = allocatePacket<RenderCommand_textureStorage1DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage1DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12942,7 +12942,7 @@ void textureStorage2DEXT(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_textureStorage2DEXT* __restrict packet = (RenderCommand_textureStorage2DEXT*)getNextPacket();
+	RenderCommand_textureStorage2DEXT* __restrict packet = allocatePacket<RenderCommand_textureStorage2DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage2DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12960,7 +12960,7 @@ void textureStorage3DEXT(
 	GLsizei height,
 	GLsizei depth)
 {
-	RenderCommand_textureStorage3DEXT* __restrict packet = (RenderCommand_textureStorage3DEXT*)getNextPacket();
+	RenderCommand_textureStorage3DEXT* __restrict packet = allocatePacket<RenderCommand_textureStorage3DEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage3DEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12979,7 +12979,7 @@ void textureStorage2DMultisampleEXT(
 	GLsizei height,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_textureStorage2DMultisampleEXT* __restrict packet = (RenderCommand_textureStorage2DMultisampleEXT*)getNextPacket();
+	RenderCommand_textureStorage2DMultisampleEXT* __restrict packet = allocatePacket<RenderCommand_textureStorage2DMultisampleEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage2DMultisampleEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -12999,7 +12999,7 @@ void textureStorage3DMultisampleEXT(
 	GLsizei depth,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_textureStorage3DMultisampleEXT* __restrict packet = (RenderCommand_textureStorage3DMultisampleEXT*)getNextPacket();
+	RenderCommand_textureStorage3DMultisampleEXT* __restrict packet = allocatePacket<RenderCommand_textureStorage3DMultisampleEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureStorage3DMultisampleEXT::execute);
 	packet->texture = texture;
 	packet->target = target;
@@ -13017,7 +13017,7 @@ void vertexArrayBindVertexBufferEXT(
 	GLintptr offset,
 	GLsizei stride)
 {
-	RenderCommand_vertexArrayBindVertexBufferEXT* __restrict packet = (RenderCommand_vertexArrayBindVertexBufferEXT*)getNextPacket();
+	RenderCommand_vertexArrayBindVertexBufferEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayBindVertexBufferEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayBindVertexBufferEXT::execute);
 	packet->vaobj = vaobj;
 	packet->bindingindex = bindingindex;
@@ -13033,7 +13033,7 @@ void vertexArrayVertexAttribFormatEXT(
 	GLboolean normalized,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayVertexAttribFormatEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribFormatEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribFormatEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribFormatEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribFormatEXT::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -13049,7 +13049,7 @@ void vertexArrayVertexAttribIFormatEXT(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayVertexAttribIFormatEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribIFormatEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribIFormatEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribIFormatEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribIFormatEXT::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -13064,7 +13064,7 @@ void vertexArrayVertexAttribLFormatEXT(
 	GLenum type,
 	GLuint relativeoffset)
 {
-	RenderCommand_vertexArrayVertexAttribLFormatEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribLFormatEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribLFormatEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribLFormatEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribLFormatEXT::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -13077,7 +13077,7 @@ void vertexArrayVertexAttribBindingEXT(
 	GLuint attribindex,
 	GLuint bindingindex)
 {
-	RenderCommand_vertexArrayVertexAttribBindingEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribBindingEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribBindingEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribBindingEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribBindingEXT::execute);
 	packet->vaobj = vaobj;
 	packet->attribindex = attribindex;
@@ -13088,7 +13088,7 @@ void vertexArrayVertexBindingDivisorEXT(
 	GLuint bindingindex,
 	GLuint divisor)
 {
-	RenderCommand_vertexArrayVertexBindingDivisorEXT* __restrict packet = (RenderCommand_vertexArrayVertexBindingDivisorEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexBindingDivisorEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexBindingDivisorEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexBindingDivisorEXT::execute);
 	packet->vaobj = vaobj;
 	packet->bindingindex = bindingindex;
@@ -13103,7 +13103,7 @@ void vertexArrayVertexAttribLOffsetEXT(
 	GLsizei stride,
 	GLintptr offset)
 {
-	RenderCommand_vertexArrayVertexAttribLOffsetEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribLOffsetEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribLOffsetEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribLOffsetEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribLOffsetEXT::execute);
 	packet->vaobj = vaobj;
 	packet->buffer = buffer;
@@ -13124,7 +13124,7 @@ void texturePageCommitmentEXT(
 	GLsizei depth,
 	GLboolean commit)
 {
-	RenderCommand_texturePageCommitmentEXT* __restrict packet = (RenderCommand_texturePageCommitmentEXT*)getNextPacket();
+	RenderCommand_texturePageCommitmentEXT* __restrict packet = allocatePacket<RenderCommand_texturePageCommitmentEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texturePageCommitmentEXT::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -13141,7 +13141,7 @@ void vertexArrayVertexAttribDivisorEXT(
 	GLuint index,
 	GLuint divisor)
 {
-	RenderCommand_vertexArrayVertexAttribDivisorEXT* __restrict packet = (RenderCommand_vertexArrayVertexAttribDivisorEXT*)getNextPacket();
+	RenderCommand_vertexArrayVertexAttribDivisorEXT* __restrict packet = allocatePacket<RenderCommand_vertexArrayVertexAttribDivisorEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexArrayVertexAttribDivisorEXT::execute);
 	packet->vaobj = vaobj;
 	packet->index = index;
@@ -13153,7 +13153,7 @@ void drawArraysInstancedEXT(
 	GLsizei count,
 	GLsizei primcount)
 {
-	RenderCommand_drawArraysInstancedEXT* __restrict packet = (RenderCommand_drawArraysInstancedEXT*)getNextPacket();
+	RenderCommand_drawArraysInstancedEXT* __restrict packet = allocatePacket<RenderCommand_drawArraysInstancedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawArraysInstancedEXT::execute);
 	packet->mode = mode;
 	packet->start = start;
@@ -13167,7 +13167,7 @@ void drawElementsInstancedEXT(
 	const void *indices,
 	GLsizei primcount)
 {
-	RenderCommand_drawElementsInstancedEXT* __restrict packet = (RenderCommand_drawElementsInstancedEXT*)getNextPacket();
+	RenderCommand_drawElementsInstancedEXT* __restrict packet = allocatePacket<RenderCommand_drawElementsInstancedEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawElementsInstancedEXT::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -13180,7 +13180,7 @@ void polygonOffsetClampEXT(
 	GLfloat units,
 	GLfloat clamp)
 {
-	RenderCommand_polygonOffsetClampEXT* __restrict packet = (RenderCommand_polygonOffsetClampEXT*)getNextPacket();
+	RenderCommand_polygonOffsetClampEXT* __restrict packet = allocatePacket<RenderCommand_polygonOffsetClampEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_polygonOffsetClampEXT::execute);
 	packet->factor = factor;
 	packet->units = units;
@@ -13190,7 +13190,7 @@ void rasterSamplesEXT(
 	GLuint samples,
 	GLboolean fixedsamplelocations)
 {
-	RenderCommand_rasterSamplesEXT* __restrict packet = (RenderCommand_rasterSamplesEXT*)getNextPacket();
+	RenderCommand_rasterSamplesEXT* __restrict packet = allocatePacket<RenderCommand_rasterSamplesEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_rasterSamplesEXT::execute);
 	packet->samples = samples;
 	packet->fixedsamplelocations = fixedsamplelocations;
@@ -13199,7 +13199,7 @@ void useShaderProgramEXT(
 	GLenum type,
 	GLuint program)
 {
-	RenderCommand_useShaderProgramEXT* __restrict packet = (RenderCommand_useShaderProgramEXT*)getNextPacket();
+	RenderCommand_useShaderProgramEXT* __restrict packet = allocatePacket<RenderCommand_useShaderProgramEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_useShaderProgramEXT::execute);
 	packet->type = type;
 	packet->program = program;
@@ -13207,7 +13207,7 @@ void useShaderProgramEXT(
 void activeProgramEXT(
 	GLuint program)
 {
-	RenderCommand_activeProgramEXT* __restrict packet = (RenderCommand_activeProgramEXT*)getNextPacket();
+	RenderCommand_activeProgramEXT* __restrict packet = allocatePacket<RenderCommand_activeProgramEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_activeProgramEXT::execute);
 	packet->program = program;
 }
@@ -13215,7 +13215,7 @@ GLuint createShaderProgramEXT(
 	GLenum type,
 	const GLchar *string)
 {
-	RenderCommand_createShaderProgramEXT* __restrict packet = (RenderCommand_createShaderProgramEXT*)getNextPacket();
+	RenderCommand_createShaderProgramEXT* __restrict packet = allocatePacket<RenderCommand_createShaderProgramEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createShaderProgramEXT::execute);
 	packet->type = type;
 	packet->string = string;
@@ -13223,7 +13223,7 @@ GLuint createShaderProgramEXT(
 void framebufferFetchBarrierEXT(
 	void)
 {
-	RenderCommand_framebufferFetchBarrierEXT* __restrict packet = (RenderCommand_framebufferFetchBarrierEXT*)getNextPacket();
+	RenderCommand_framebufferFetchBarrierEXT* __restrict packet = allocatePacket<RenderCommand_framebufferFetchBarrierEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferFetchBarrierEXT::execute);
 }
 void windowRectanglesEXT(
@@ -13231,7 +13231,7 @@ void windowRectanglesEXT(
 	GLsizei count,
 	const GLint *box)
 {
-	RenderCommand_windowRectanglesEXT* __restrict packet = (RenderCommand_windowRectanglesEXT*)getNextPacket();
+	RenderCommand_windowRectanglesEXT* __restrict packet = allocatePacket<RenderCommand_windowRectanglesEXT>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_windowRectanglesEXT::execute);
 	packet->mode = mode;
 	packet->count = count;
@@ -13240,13 +13240,13 @@ void windowRectanglesEXT(
 void applyFramebufferAttachmentCMAAINTEL(
 	void)
 {
-	RenderCommand_applyFramebufferAttachmentCMAAINTEL* __restrict packet = (RenderCommand_applyFramebufferAttachmentCMAAINTEL*)getNextPacket();
+	RenderCommand_applyFramebufferAttachmentCMAAINTEL* __restrict packet = allocatePacket<RenderCommand_applyFramebufferAttachmentCMAAINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_applyFramebufferAttachmentCMAAINTEL::execute);
 }
 void beginPerfQueryINTEL(
 	GLuint queryHandle)
 {
-	RenderCommand_beginPerfQueryINTEL* __restrict packet = (RenderCommand_beginPerfQueryINTEL*)getNextPacket();
+	RenderCommand_beginPerfQueryINTEL* __restrict packet = allocatePacket<RenderCommand_beginPerfQueryINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginPerfQueryINTEL::execute);
 	packet->queryHandle = queryHandle;
 }
@@ -13254,7 +13254,7 @@ void createPerfQueryINTEL(
 	GLuint queryId,
 	GLuint *queryHandle)
 {
-	RenderCommand_createPerfQueryINTEL* __restrict packet = (RenderCommand_createPerfQueryINTEL*)getNextPacket();
+	RenderCommand_createPerfQueryINTEL* __restrict packet = allocatePacket<RenderCommand_createPerfQueryINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createPerfQueryINTEL::execute);
 	packet->queryId = queryId;
 	packet->queryHandle = queryHandle;
@@ -13262,21 +13262,21 @@ void createPerfQueryINTEL(
 void deletePerfQueryINTEL(
 	GLuint queryHandle)
 {
-	RenderCommand_deletePerfQueryINTEL* __restrict packet = (RenderCommand_deletePerfQueryINTEL*)getNextPacket();
+	RenderCommand_deletePerfQueryINTEL* __restrict packet = allocatePacket<RenderCommand_deletePerfQueryINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deletePerfQueryINTEL::execute);
 	packet->queryHandle = queryHandle;
 }
 void endPerfQueryINTEL(
 	GLuint queryHandle)
 {
-	RenderCommand_endPerfQueryINTEL* __restrict packet = (RenderCommand_endPerfQueryINTEL*)getNextPacket();
+	RenderCommand_endPerfQueryINTEL* __restrict packet = allocatePacket<RenderCommand_endPerfQueryINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endPerfQueryINTEL::execute);
 	packet->queryHandle = queryHandle;
 }
 void getFirstPerfQueryIdINTEL(
 	GLuint *queryId)
 {
-	RenderCommand_getFirstPerfQueryIdINTEL* __restrict packet = (RenderCommand_getFirstPerfQueryIdINTEL*)getNextPacket();
+	RenderCommand_getFirstPerfQueryIdINTEL* __restrict packet = allocatePacket<RenderCommand_getFirstPerfQueryIdINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getFirstPerfQueryIdINTEL::execute);
 	packet->queryId = queryId;
 }
@@ -13284,7 +13284,7 @@ void getNextPerfQueryIdINTEL(
 	GLuint queryId,
 	GLuint *nextQueryId)
 {
-	RenderCommand_getNextPerfQueryIdINTEL* __restrict packet = (RenderCommand_getNextPerfQueryIdINTEL*)getNextPacket();
+	RenderCommand_getNextPerfQueryIdINTEL* __restrict packet = allocatePacket<RenderCommand_getNextPerfQueryIdINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNextPerfQueryIdINTEL::execute);
 	packet->queryId = queryId;
 	packet->nextQueryId = nextQueryId;
@@ -13302,7 +13302,7 @@ void getPerfCounterInfoINTEL(
 	GLuint *counterDataTypeEnum,
 	GLuint64 *rawCounterMaxValue)
 {
-	RenderCommand_getPerfCounterInfoINTEL* __restrict packet = (RenderCommand_getPerfCounterInfoINTEL*)getNextPacket();
+	RenderCommand_getPerfCounterInfoINTEL* __restrict packet = allocatePacket<RenderCommand_getPerfCounterInfoINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfCounterInfoINTEL::execute);
 	packet->queryId = queryId;
 	packet->counterId = counterId;
@@ -13323,7 +13323,7 @@ void getPerfQueryDataINTEL(
 	void *data,
 	GLuint *bytesWritten)
 {
-	RenderCommand_getPerfQueryDataINTEL* __restrict packet = (RenderCommand_getPerfQueryDataINTEL*)getNextPacket();
+	RenderCommand_getPerfQueryDataINTEL* __restrict packet = allocatePacket<RenderCommand_getPerfQueryDataINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfQueryDataINTEL::execute);
 	packet->queryHandle = queryHandle;
 	packet->flags = flags;
@@ -13335,7 +13335,7 @@ void getPerfQueryIdByNameINTEL(
 	GLchar *queryName,
 	GLuint *queryId)
 {
-	RenderCommand_getPerfQueryIdByNameINTEL* __restrict packet = (RenderCommand_getPerfQueryIdByNameINTEL*)getNextPacket();
+	RenderCommand_getPerfQueryIdByNameINTEL* __restrict packet = allocatePacket<RenderCommand_getPerfQueryIdByNameINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfQueryIdByNameINTEL::execute);
 	packet->queryName = queryName;
 	packet->queryId = queryId;
@@ -13349,7 +13349,7 @@ void getPerfQueryInfoINTEL(
 	GLuint *noInstances,
 	GLuint *capsMask)
 {
-	RenderCommand_getPerfQueryInfoINTEL* __restrict packet = (RenderCommand_getPerfQueryInfoINTEL*)getNextPacket();
+	RenderCommand_getPerfQueryInfoINTEL* __restrict packet = allocatePacket<RenderCommand_getPerfQueryInfoINTEL>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPerfQueryInfoINTEL::execute);
 	packet->queryId = queryId;
 	packet->queryNameLength = queryNameLength;
@@ -13366,7 +13366,7 @@ void multiDrawArraysIndirectBindlessNV(
 	GLsizei stride,
 	GLint vertexBufferCount)
 {
-	RenderCommand_multiDrawArraysIndirectBindlessNV* __restrict packet = (RenderCommand_multiDrawArraysIndirectBindlessNV*)getNextPacket();
+	RenderCommand_multiDrawArraysIndirectBindlessNV* __restrict packet = allocatePacket<RenderCommand_multiDrawArraysIndirectBindlessNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArraysIndirectBindlessNV::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -13382,7 +13382,7 @@ void multiDrawElementsIndirectBindlessNV(
 	GLsizei stride,
 	GLint vertexBufferCount)
 {
-	RenderCommand_multiDrawElementsIndirectBindlessNV* __restrict packet = (RenderCommand_multiDrawElementsIndirectBindlessNV*)getNextPacket();
+	RenderCommand_multiDrawElementsIndirectBindlessNV* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsIndirectBindlessNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsIndirectBindlessNV::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -13399,7 +13399,7 @@ void multiDrawArraysIndirectBindlessCountNV(
 	GLsizei stride,
 	GLint vertexBufferCount)
 {
-	RenderCommand_multiDrawArraysIndirectBindlessCountNV* __restrict packet = (RenderCommand_multiDrawArraysIndirectBindlessCountNV*)getNextPacket();
+	RenderCommand_multiDrawArraysIndirectBindlessCountNV* __restrict packet = allocatePacket<RenderCommand_multiDrawArraysIndirectBindlessCountNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawArraysIndirectBindlessCountNV::execute);
 	packet->mode = mode;
 	packet->indirect = indirect;
@@ -13417,7 +13417,7 @@ void multiDrawElementsIndirectBindlessCountNV(
 	GLsizei stride,
 	GLint vertexBufferCount)
 {
-	RenderCommand_multiDrawElementsIndirectBindlessCountNV* __restrict packet = (RenderCommand_multiDrawElementsIndirectBindlessCountNV*)getNextPacket();
+	RenderCommand_multiDrawElementsIndirectBindlessCountNV* __restrict packet = allocatePacket<RenderCommand_multiDrawElementsIndirectBindlessCountNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawElementsIndirectBindlessCountNV::execute);
 	packet->mode = mode;
 	packet->type = type;
@@ -13430,7 +13430,7 @@ void multiDrawElementsIndirectBindlessCountNV(
 GLuint64 getTextureHandleNV(
 	GLuint texture)
 {
-	RenderCommand_getTextureHandleNV* __restrict packet = (RenderCommand_getTextureHandleNV*)getNextPacket();
+	RenderCommand_getTextureHandleNV* __restrict packet = allocatePacket<RenderCommand_getTextureHandleNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureHandleNV::execute);
 	packet->texture = texture;
 }
@@ -13438,7 +13438,7 @@ GLuint64 getTextureSamplerHandleNV(
 	GLuint texture,
 	GLuint sampler)
 {
-	RenderCommand_getTextureSamplerHandleNV* __restrict packet = (RenderCommand_getTextureSamplerHandleNV*)getNextPacket();
+	RenderCommand_getTextureSamplerHandleNV* __restrict packet = allocatePacket<RenderCommand_getTextureSamplerHandleNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getTextureSamplerHandleNV::execute);
 	packet->texture = texture;
 	packet->sampler = sampler;
@@ -13446,14 +13446,14 @@ GLuint64 getTextureSamplerHandleNV(
 void makeTextureHandleResidentNV(
 	GLuint64 handle)
 {
-	RenderCommand_makeTextureHandleResidentNV* __restrict packet = (RenderCommand_makeTextureHandleResidentNV*)getNextPacket();
+	RenderCommand_makeTextureHandleResidentNV* __restrict packet = allocatePacket<RenderCommand_makeTextureHandleResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeTextureHandleResidentNV::execute);
 	packet->handle = handle;
 }
 void makeTextureHandleNonResidentNV(
 	GLuint64 handle)
 {
-	RenderCommand_makeTextureHandleNonResidentNV* __restrict packet = (RenderCommand_makeTextureHandleNonResidentNV*)getNextPacket();
+	RenderCommand_makeTextureHandleNonResidentNV* __restrict packet = allocatePacket<RenderCommand_makeTextureHandleNonResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeTextureHandleNonResidentNV::execute);
 	packet->handle = handle;
 }
@@ -13464,7 +13464,7 @@ GLuint64 getImageHandleNV(
 	GLint layer,
 	GLenum format)
 {
-	RenderCommand_getImageHandleNV* __restrict packet = (RenderCommand_getImageHandleNV*)getNextPacket();
+	RenderCommand_getImageHandleNV* __restrict packet = allocatePacket<RenderCommand_getImageHandleNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getImageHandleNV::execute);
 	packet->texture = texture;
 	packet->level = level;
@@ -13476,7 +13476,7 @@ void makeImageHandleResidentNV(
 	GLuint64 handle,
 	GLenum access)
 {
-	RenderCommand_makeImageHandleResidentNV* __restrict packet = (RenderCommand_makeImageHandleResidentNV*)getNextPacket();
+	RenderCommand_makeImageHandleResidentNV* __restrict packet = allocatePacket<RenderCommand_makeImageHandleResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeImageHandleResidentNV::execute);
 	packet->handle = handle;
 	packet->access = access;
@@ -13484,7 +13484,7 @@ void makeImageHandleResidentNV(
 void makeImageHandleNonResidentNV(
 	GLuint64 handle)
 {
-	RenderCommand_makeImageHandleNonResidentNV* __restrict packet = (RenderCommand_makeImageHandleNonResidentNV*)getNextPacket();
+	RenderCommand_makeImageHandleNonResidentNV* __restrict packet = allocatePacket<RenderCommand_makeImageHandleNonResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeImageHandleNonResidentNV::execute);
 	packet->handle = handle;
 }
@@ -13492,7 +13492,7 @@ void uniformHandleui64NV(
 	GLint location,
 	GLuint64 value)
 {
-	RenderCommand_uniformHandleui64NV* __restrict packet = (RenderCommand_uniformHandleui64NV*)getNextPacket();
+	RenderCommand_uniformHandleui64NV* __restrict packet = allocatePacket<RenderCommand_uniformHandleui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformHandleui64NV::execute);
 	packet->location = location;
 	packet->value = value;
@@ -13502,7 +13502,7 @@ void uniformHandleui64vNV(
 	GLsizei count,
 	const GLuint64 *value)
 {
-	RenderCommand_uniformHandleui64vNV* __restrict packet = (RenderCommand_uniformHandleui64vNV*)getNextPacket();
+	RenderCommand_uniformHandleui64vNV* __restrict packet = allocatePacket<RenderCommand_uniformHandleui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformHandleui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -13513,7 +13513,7 @@ void programUniformHandleui64NV(
 	GLint location,
 	GLuint64 value)
 {
-	RenderCommand_programUniformHandleui64NV* __restrict packet = (RenderCommand_programUniformHandleui64NV*)getNextPacket();
+	RenderCommand_programUniformHandleui64NV* __restrict packet = allocatePacket<RenderCommand_programUniformHandleui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformHandleui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -13525,7 +13525,7 @@ void programUniformHandleui64vNV(
 	GLsizei count,
 	const GLuint64 *values)
 {
-	RenderCommand_programUniformHandleui64vNV* __restrict packet = (RenderCommand_programUniformHandleui64vNV*)getNextPacket();
+	RenderCommand_programUniformHandleui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniformHandleui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformHandleui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -13535,14 +13535,14 @@ void programUniformHandleui64vNV(
 GLboolean isTextureHandleResidentNV(
 	GLuint64 handle)
 {
-	RenderCommand_isTextureHandleResidentNV* __restrict packet = (RenderCommand_isTextureHandleResidentNV*)getNextPacket();
+	RenderCommand_isTextureHandleResidentNV* __restrict packet = allocatePacket<RenderCommand_isTextureHandleResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isTextureHandleResidentNV::execute);
 	packet->handle = handle;
 }
 GLboolean isImageHandleResidentNV(
 	GLuint64 handle)
 {
-	RenderCommand_isImageHandleResidentNV* __restrict packet = (RenderCommand_isImageHandleResidentNV*)getNextPacket();
+	RenderCommand_isImageHandleResidentNV* __restrict packet = allocatePacket<RenderCommand_isImageHandleResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isImageHandleResidentNV::execute);
 	packet->handle = handle;
 }
@@ -13550,7 +13550,7 @@ void blendParameteriNV(
 	GLenum pname,
 	GLint value)
 {
-	RenderCommand_blendParameteriNV* __restrict packet = (RenderCommand_blendParameteriNV*)getNextPacket();
+	RenderCommand_blendParameteriNV* __restrict packet = allocatePacket<RenderCommand_blendParameteriNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendParameteriNV::execute);
 	packet->pname = pname;
 	packet->value = value;
@@ -13558,7 +13558,7 @@ void blendParameteriNV(
 void blendBarrierNV(
 	void)
 {
-	RenderCommand_blendBarrierNV* __restrict packet = (RenderCommand_blendBarrierNV*)getNextPacket();
+	RenderCommand_blendBarrierNV* __restrict packet = allocatePacket<RenderCommand_blendBarrierNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_blendBarrierNV::execute);
 }
 void viewportPositionWScaleNV(
@@ -13566,7 +13566,7 @@ void viewportPositionWScaleNV(
 	GLfloat xcoeff,
 	GLfloat ycoeff)
 {
-	RenderCommand_viewportPositionWScaleNV* __restrict packet = (RenderCommand_viewportPositionWScaleNV*)getNextPacket();
+	RenderCommand_viewportPositionWScaleNV* __restrict packet = allocatePacket<RenderCommand_viewportPositionWScaleNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewportPositionWScaleNV::execute);
 	packet->index = index;
 	packet->xcoeff = xcoeff;
@@ -13576,7 +13576,7 @@ void createStatesNV(
 	GLsizei n,
 	GLuint *states)
 {
-	RenderCommand_createStatesNV* __restrict packet = (RenderCommand_createStatesNV*)getNextPacket();
+	RenderCommand_createStatesNV* __restrict packet = allocatePacket<RenderCommand_createStatesNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createStatesNV::execute);
 	packet->n = n;
 	packet->states = states;
@@ -13585,7 +13585,7 @@ void deleteStatesNV(
 	GLsizei n,
 	const GLuint *states)
 {
-	RenderCommand_deleteStatesNV* __restrict packet = (RenderCommand_deleteStatesNV*)getNextPacket();
+	RenderCommand_deleteStatesNV* __restrict packet = allocatePacket<RenderCommand_deleteStatesNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteStatesNV::execute);
 	packet->n = n;
 	packet->states = states;
@@ -13593,7 +13593,7 @@ void deleteStatesNV(
 GLboolean isStateNV(
 	GLuint state)
 {
-	RenderCommand_isStateNV* __restrict packet = (RenderCommand_isStateNV*)getNextPacket();
+	RenderCommand_isStateNV* __restrict packet = allocatePacket<RenderCommand_isStateNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isStateNV::execute);
 	packet->state = state;
 }
@@ -13601,7 +13601,7 @@ void stateCaptureNV(
 	GLuint state,
 	GLenum mode)
 {
-	RenderCommand_stateCaptureNV* __restrict packet = (RenderCommand_stateCaptureNV*)getNextPacket();
+	RenderCommand_stateCaptureNV* __restrict packet = allocatePacket<RenderCommand_stateCaptureNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stateCaptureNV::execute);
 	packet->state = state;
 	packet->mode = mode;
@@ -13610,7 +13610,7 @@ GLuint getCommandHeaderNV(
 	GLenum tokenID,
 	GLuint size)
 {
-	RenderCommand_getCommandHeaderNV* __restrict packet = (RenderCommand_getCommandHeaderNV*)getNextPacket();
+	RenderCommand_getCommandHeaderNV* __restrict packet = allocatePacket<RenderCommand_getCommandHeaderNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCommandHeaderNV::execute);
 	packet->tokenID = tokenID;
 	packet->size = size;
@@ -13618,7 +13618,7 @@ GLuint getCommandHeaderNV(
 GLushort getStageIndexNV(
 	GLenum shadertype)
 {
-	RenderCommand_getStageIndexNV* __restrict packet = (RenderCommand_getStageIndexNV*)getNextPacket();
+	RenderCommand_getStageIndexNV* __restrict packet = allocatePacket<RenderCommand_getStageIndexNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getStageIndexNV::execute);
 	packet->shadertype = shadertype;
 }
@@ -13629,7 +13629,7 @@ void drawCommandsNV(
 	const GLsizei *sizes,
 	GLuint count)
 {
-	RenderCommand_drawCommandsNV* __restrict packet = (RenderCommand_drawCommandsNV*)getNextPacket();
+	RenderCommand_drawCommandsNV* __restrict packet = allocatePacket<RenderCommand_drawCommandsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawCommandsNV::execute);
 	packet->primitiveMode = primitiveMode;
 	packet->buffer = buffer;
@@ -13643,7 +13643,7 @@ void drawCommandsAddressNV(
 	const GLsizei *sizes,
 	GLuint count)
 {
-	RenderCommand_drawCommandsAddressNV* __restrict packet = (RenderCommand_drawCommandsAddressNV*)getNextPacket();
+	RenderCommand_drawCommandsAddressNV* __restrict packet = allocatePacket<RenderCommand_drawCommandsAddressNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawCommandsAddressNV::execute);
 	packet->primitiveMode = primitiveMode;
 	packet->indirects = indirects;
@@ -13658,7 +13658,7 @@ void drawCommandsStatesNV(
 	const GLuint *fbos,
 	GLuint count)
 {
-	RenderCommand_drawCommandsStatesNV* __restrict packet = (RenderCommand_drawCommandsStatesNV*)getNextPacket();
+	RenderCommand_drawCommandsStatesNV* __restrict packet = allocatePacket<RenderCommand_drawCommandsStatesNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawCommandsStatesNV::execute);
 	packet->buffer = buffer;
 	packet->indirects = indirects;
@@ -13674,7 +13674,7 @@ void drawCommandsStatesAddressNV(
 	const GLuint *fbos,
 	GLuint count)
 {
-	RenderCommand_drawCommandsStatesAddressNV* __restrict packet = (RenderCommand_drawCommandsStatesAddressNV*)getNextPacket();
+	RenderCommand_drawCommandsStatesAddressNV* __restrict packet = allocatePacket<RenderCommand_drawCommandsStatesAddressNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawCommandsStatesAddressNV::execute);
 	packet->indirects = indirects;
 	packet->sizes = sizes;
@@ -13686,7 +13686,7 @@ void createCommandListsNV(
 	GLsizei n,
 	GLuint *lists)
 {
-	RenderCommand_createCommandListsNV* __restrict packet = (RenderCommand_createCommandListsNV*)getNextPacket();
+	RenderCommand_createCommandListsNV* __restrict packet = allocatePacket<RenderCommand_createCommandListsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_createCommandListsNV::execute);
 	packet->n = n;
 	packet->lists = lists;
@@ -13695,7 +13695,7 @@ void deleteCommandListsNV(
 	GLsizei n,
 	const GLuint *lists)
 {
-	RenderCommand_deleteCommandListsNV* __restrict packet = (RenderCommand_deleteCommandListsNV*)getNextPacket();
+	RenderCommand_deleteCommandListsNV* __restrict packet = allocatePacket<RenderCommand_deleteCommandListsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deleteCommandListsNV::execute);
 	packet->n = n;
 	packet->lists = lists;
@@ -13703,7 +13703,7 @@ void deleteCommandListsNV(
 GLboolean isCommandListNV(
 	GLuint list)
 {
-	RenderCommand_isCommandListNV* __restrict packet = (RenderCommand_isCommandListNV*)getNextPacket();
+	RenderCommand_isCommandListNV* __restrict packet = allocatePacket<RenderCommand_isCommandListNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isCommandListNV::execute);
 	packet->list = list;
 }
@@ -13716,7 +13716,7 @@ void listDrawCommandsStatesClientNV(
 	const GLuint *fbos,
 	GLuint count)
 {
-	RenderCommand_listDrawCommandsStatesClientNV* __restrict packet = (RenderCommand_listDrawCommandsStatesClientNV*)getNextPacket();
+	RenderCommand_listDrawCommandsStatesClientNV* __restrict packet = allocatePacket<RenderCommand_listDrawCommandsStatesClientNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_listDrawCommandsStatesClientNV::execute);
 	packet->list = list;
 	packet->segment = segment;
@@ -13730,7 +13730,7 @@ void commandListSegmentsNV(
 	GLuint list,
 	GLuint segments)
 {
-	RenderCommand_commandListSegmentsNV* __restrict packet = (RenderCommand_commandListSegmentsNV*)getNextPacket();
+	RenderCommand_commandListSegmentsNV* __restrict packet = allocatePacket<RenderCommand_commandListSegmentsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_commandListSegmentsNV::execute);
 	packet->list = list;
 	packet->segments = segments;
@@ -13738,14 +13738,14 @@ void commandListSegmentsNV(
 void compileCommandListNV(
 	GLuint list)
 {
-	RenderCommand_compileCommandListNV* __restrict packet = (RenderCommand_compileCommandListNV*)getNextPacket();
+	RenderCommand_compileCommandListNV* __restrict packet = allocatePacket<RenderCommand_compileCommandListNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_compileCommandListNV::execute);
 	packet->list = list;
 }
 void callCommandListNV(
 	GLuint list)
 {
-	RenderCommand_callCommandListNV* __restrict packet = (RenderCommand_callCommandListNV*)getNextPacket();
+	RenderCommand_callCommandListNV* __restrict packet = allocatePacket<RenderCommand_callCommandListNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_callCommandListNV::execute);
 	packet->list = list;
 }
@@ -13753,7 +13753,7 @@ void beginConditionalRenderNV(
 	GLuint id,
 	GLenum mode)
 {
-	RenderCommand_beginConditionalRenderNV* __restrict packet = (RenderCommand_beginConditionalRenderNV*)getNextPacket();
+	RenderCommand_beginConditionalRenderNV* __restrict packet = allocatePacket<RenderCommand_beginConditionalRenderNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_beginConditionalRenderNV::execute);
 	packet->id = id;
 	packet->mode = mode;
@@ -13761,14 +13761,14 @@ void beginConditionalRenderNV(
 void endConditionalRenderNV(
 	void)
 {
-	RenderCommand_endConditionalRenderNV* __restrict packet = (RenderCommand_endConditionalRenderNV*)getNextPacket();
+	RenderCommand_endConditionalRenderNV* __restrict packet = allocatePacket<RenderCommand_endConditionalRenderNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_endConditionalRenderNV::execute);
 }
 void subpixelPrecisionBiasNV(
 	GLuint xbits,
 	GLuint ybits)
 {
-	RenderCommand_subpixelPrecisionBiasNV* __restrict packet = (RenderCommand_subpixelPrecisionBiasNV*)getNextPacket();
+	RenderCommand_subpixelPrecisionBiasNV* __restrict packet = allocatePacket<RenderCommand_subpixelPrecisionBiasNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_subpixelPrecisionBiasNV::execute);
 	packet->xbits = xbits;
 	packet->ybits = ybits;
@@ -13777,7 +13777,7 @@ void conservativeRasterParameterfNV(
 	GLenum pname,
 	GLfloat value)
 {
-	RenderCommand_conservativeRasterParameterfNV* __restrict packet = (RenderCommand_conservativeRasterParameterfNV*)getNextPacket();
+	RenderCommand_conservativeRasterParameterfNV* __restrict packet = allocatePacket<RenderCommand_conservativeRasterParameterfNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_conservativeRasterParameterfNV::execute);
 	packet->pname = pname;
 	packet->value = value;
@@ -13786,7 +13786,7 @@ void conservativeRasterParameteriNV(
 	GLenum pname,
 	GLint param)
 {
-	RenderCommand_conservativeRasterParameteriNV* __restrict packet = (RenderCommand_conservativeRasterParameteriNV*)getNextPacket();
+	RenderCommand_conservativeRasterParameteriNV* __restrict packet = allocatePacket<RenderCommand_conservativeRasterParameteriNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_conservativeRasterParameteriNV::execute);
 	packet->pname = pname;
 	packet->param = param;
@@ -13804,7 +13804,7 @@ void drawVkImageNV(
 	GLfloat s1,
 	GLfloat t1)
 {
-	RenderCommand_drawVkImageNV* __restrict packet = (RenderCommand_drawVkImageNV*)getNextPacket();
+	RenderCommand_drawVkImageNV* __restrict packet = allocatePacket<RenderCommand_drawVkImageNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawVkImageNV::execute);
 	packet->vkImage = vkImage;
 	packet->sampler = sampler;
@@ -13821,35 +13821,35 @@ void drawVkImageNV(
 GLVULKANPROCNV getVkProcAddrNV(
 	const GLchar *name)
 {
-	RenderCommand_getVkProcAddrNV* __restrict packet = (RenderCommand_getVkProcAddrNV*)getNextPacket();
+	RenderCommand_getVkProcAddrNV* __restrict packet = allocatePacket<RenderCommand_getVkProcAddrNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVkProcAddrNV::execute);
 	packet->name = name;
 }
 void waitVkSemaphoreNV(
 	GLuint64 vkSemaphore)
 {
-	RenderCommand_waitVkSemaphoreNV* __restrict packet = (RenderCommand_waitVkSemaphoreNV*)getNextPacket();
+	RenderCommand_waitVkSemaphoreNV* __restrict packet = allocatePacket<RenderCommand_waitVkSemaphoreNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_waitVkSemaphoreNV::execute);
 	packet->vkSemaphore = vkSemaphore;
 }
 void signalVkSemaphoreNV(
 	GLuint64 vkSemaphore)
 {
-	RenderCommand_signalVkSemaphoreNV* __restrict packet = (RenderCommand_signalVkSemaphoreNV*)getNextPacket();
+	RenderCommand_signalVkSemaphoreNV* __restrict packet = allocatePacket<RenderCommand_signalVkSemaphoreNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_signalVkSemaphoreNV::execute);
 	packet->vkSemaphore = vkSemaphore;
 }
 void signalVkFenceNV(
 	GLuint64 vkFence)
 {
-	RenderCommand_signalVkFenceNV* __restrict packet = (RenderCommand_signalVkFenceNV*)getNextPacket();
+	RenderCommand_signalVkFenceNV* __restrict packet = allocatePacket<RenderCommand_signalVkFenceNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_signalVkFenceNV::execute);
 	packet->vkFence = vkFence;
 }
 void fragmentCoverageColorNV(
 	GLuint color)
 {
-	RenderCommand_fragmentCoverageColorNV* __restrict packet = (RenderCommand_fragmentCoverageColorNV*)getNextPacket();
+	RenderCommand_fragmentCoverageColorNV* __restrict packet = allocatePacket<RenderCommand_fragmentCoverageColorNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_fragmentCoverageColorNV::execute);
 	packet->color = color;
 }
@@ -13857,7 +13857,7 @@ void coverageModulationTableNV(
 	GLsizei n,
 	const GLfloat *v)
 {
-	RenderCommand_coverageModulationTableNV* __restrict packet = (RenderCommand_coverageModulationTableNV*)getNextPacket();
+	RenderCommand_coverageModulationTableNV* __restrict packet = allocatePacket<RenderCommand_coverageModulationTableNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverageModulationTableNV::execute);
 	packet->n = n;
 	packet->v = v;
@@ -13866,7 +13866,7 @@ void getCoverageModulationTableNV(
 	GLsizei bufsize,
 	GLfloat *v)
 {
-	RenderCommand_getCoverageModulationTableNV* __restrict packet = (RenderCommand_getCoverageModulationTableNV*)getNextPacket();
+	RenderCommand_getCoverageModulationTableNV* __restrict packet = allocatePacket<RenderCommand_getCoverageModulationTableNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getCoverageModulationTableNV::execute);
 	packet->bufsize = bufsize;
 	packet->v = v;
@@ -13874,7 +13874,7 @@ void getCoverageModulationTableNV(
 void coverageModulationNV(
 	GLenum components)
 {
-	RenderCommand_coverageModulationNV* __restrict packet = (RenderCommand_coverageModulationNV*)getNextPacket();
+	RenderCommand_coverageModulationNV* __restrict packet = allocatePacket<RenderCommand_coverageModulationNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverageModulationNV::execute);
 	packet->components = components;
 }
@@ -13886,7 +13886,7 @@ void renderbufferStorageMultisampleCoverageNV(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_renderbufferStorageMultisampleCoverageNV* __restrict packet = (RenderCommand_renderbufferStorageMultisampleCoverageNV*)getNextPacket();
+	RenderCommand_renderbufferStorageMultisampleCoverageNV* __restrict packet = allocatePacket<RenderCommand_renderbufferStorageMultisampleCoverageNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_renderbufferStorageMultisampleCoverageNV::execute);
 	packet->target = target;
 	packet->coverageSamples = coverageSamples;
@@ -13899,7 +13899,7 @@ void uniform1i64NV(
 	GLint location,
 	GLint64EXT x)
 {
-	RenderCommand_uniform1i64NV* __restrict packet = (RenderCommand_uniform1i64NV*)getNextPacket();
+	RenderCommand_uniform1i64NV* __restrict packet = allocatePacket<RenderCommand_uniform1i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1i64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -13909,7 +13909,7 @@ void uniform2i64NV(
 	GLint64EXT x,
 	GLint64EXT y)
 {
-	RenderCommand_uniform2i64NV* __restrict packet = (RenderCommand_uniform2i64NV*)getNextPacket();
+	RenderCommand_uniform2i64NV* __restrict packet = allocatePacket<RenderCommand_uniform2i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2i64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -13921,7 +13921,7 @@ void uniform3i64NV(
 	GLint64EXT y,
 	GLint64EXT z)
 {
-	RenderCommand_uniform3i64NV* __restrict packet = (RenderCommand_uniform3i64NV*)getNextPacket();
+	RenderCommand_uniform3i64NV* __restrict packet = allocatePacket<RenderCommand_uniform3i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3i64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -13935,7 +13935,7 @@ void uniform4i64NV(
 	GLint64EXT z,
 	GLint64EXT w)
 {
-	RenderCommand_uniform4i64NV* __restrict packet = (RenderCommand_uniform4i64NV*)getNextPacket();
+	RenderCommand_uniform4i64NV* __restrict packet = allocatePacket<RenderCommand_uniform4i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4i64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -13948,7 +13948,7 @@ void uniform1i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_uniform1i64vNV* __restrict packet = (RenderCommand_uniform1i64vNV*)getNextPacket();
+	RenderCommand_uniform1i64vNV* __restrict packet = allocatePacket<RenderCommand_uniform1i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1i64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -13959,7 +13959,7 @@ void uniform2i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_uniform2i64vNV* __restrict packet = (RenderCommand_uniform2i64vNV*)getNextPacket();
+	RenderCommand_uniform2i64vNV* __restrict packet = allocatePacket<RenderCommand_uniform2i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2i64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -13970,7 +13970,7 @@ void uniform3i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_uniform3i64vNV* __restrict packet = (RenderCommand_uniform3i64vNV*)getNextPacket();
+	RenderCommand_uniform3i64vNV* __restrict packet = allocatePacket<RenderCommand_uniform3i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3i64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -13981,7 +13981,7 @@ void uniform4i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_uniform4i64vNV* __restrict packet = (RenderCommand_uniform4i64vNV*)getNextPacket();
+	RenderCommand_uniform4i64vNV* __restrict packet = allocatePacket<RenderCommand_uniform4i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4i64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -13991,7 +13991,7 @@ void uniform1ui64NV(
 	GLint location,
 	GLuint64EXT x)
 {
-	RenderCommand_uniform1ui64NV* __restrict packet = (RenderCommand_uniform1ui64NV*)getNextPacket();
+	RenderCommand_uniform1ui64NV* __restrict packet = allocatePacket<RenderCommand_uniform1ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1ui64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -14001,7 +14001,7 @@ void uniform2ui64NV(
 	GLuint64EXT x,
 	GLuint64EXT y)
 {
-	RenderCommand_uniform2ui64NV* __restrict packet = (RenderCommand_uniform2ui64NV*)getNextPacket();
+	RenderCommand_uniform2ui64NV* __restrict packet = allocatePacket<RenderCommand_uniform2ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2ui64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -14013,7 +14013,7 @@ void uniform3ui64NV(
 	GLuint64EXT y,
 	GLuint64EXT z)
 {
-	RenderCommand_uniform3ui64NV* __restrict packet = (RenderCommand_uniform3ui64NV*)getNextPacket();
+	RenderCommand_uniform3ui64NV* __restrict packet = allocatePacket<RenderCommand_uniform3ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3ui64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -14027,7 +14027,7 @@ void uniform4ui64NV(
 	GLuint64EXT z,
 	GLuint64EXT w)
 {
-	RenderCommand_uniform4ui64NV* __restrict packet = (RenderCommand_uniform4ui64NV*)getNextPacket();
+	RenderCommand_uniform4ui64NV* __restrict packet = allocatePacket<RenderCommand_uniform4ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4ui64NV::execute);
 	packet->location = location;
 	packet->x = x;
@@ -14040,7 +14040,7 @@ void uniform1ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_uniform1ui64vNV* __restrict packet = (RenderCommand_uniform1ui64vNV*)getNextPacket();
+	RenderCommand_uniform1ui64vNV* __restrict packet = allocatePacket<RenderCommand_uniform1ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform1ui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -14051,7 +14051,7 @@ void uniform2ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_uniform2ui64vNV* __restrict packet = (RenderCommand_uniform2ui64vNV*)getNextPacket();
+	RenderCommand_uniform2ui64vNV* __restrict packet = allocatePacket<RenderCommand_uniform2ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform2ui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -14062,7 +14062,7 @@ void uniform3ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_uniform3ui64vNV* __restrict packet = (RenderCommand_uniform3ui64vNV*)getNextPacket();
+	RenderCommand_uniform3ui64vNV* __restrict packet = allocatePacket<RenderCommand_uniform3ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform3ui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -14073,7 +14073,7 @@ void uniform4ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_uniform4ui64vNV* __restrict packet = (RenderCommand_uniform4ui64vNV*)getNextPacket();
+	RenderCommand_uniform4ui64vNV* __restrict packet = allocatePacket<RenderCommand_uniform4ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniform4ui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -14084,7 +14084,7 @@ void getUniformi64vNV(
 	GLint location,
 	GLint64EXT *params)
 {
-	RenderCommand_getUniformi64vNV* __restrict packet = (RenderCommand_getUniformi64vNV*)getNextPacket();
+	RenderCommand_getUniformi64vNV* __restrict packet = allocatePacket<RenderCommand_getUniformi64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformi64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14095,7 +14095,7 @@ void programUniform1i64NV(
 	GLint location,
 	GLint64EXT x)
 {
-	RenderCommand_programUniform1i64NV* __restrict packet = (RenderCommand_programUniform1i64NV*)getNextPacket();
+	RenderCommand_programUniform1i64NV* __restrict packet = allocatePacket<RenderCommand_programUniform1i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1i64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14107,7 +14107,7 @@ void programUniform2i64NV(
 	GLint64EXT x,
 	GLint64EXT y)
 {
-	RenderCommand_programUniform2i64NV* __restrict packet = (RenderCommand_programUniform2i64NV*)getNextPacket();
+	RenderCommand_programUniform2i64NV* __restrict packet = allocatePacket<RenderCommand_programUniform2i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2i64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14121,7 +14121,7 @@ void programUniform3i64NV(
 	GLint64EXT y,
 	GLint64EXT z)
 {
-	RenderCommand_programUniform3i64NV* __restrict packet = (RenderCommand_programUniform3i64NV*)getNextPacket();
+	RenderCommand_programUniform3i64NV* __restrict packet = allocatePacket<RenderCommand_programUniform3i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3i64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14137,7 +14137,7 @@ void programUniform4i64NV(
 	GLint64EXT z,
 	GLint64EXT w)
 {
-	RenderCommand_programUniform4i64NV* __restrict packet = (RenderCommand_programUniform4i64NV*)getNextPacket();
+	RenderCommand_programUniform4i64NV* __restrict packet = allocatePacket<RenderCommand_programUniform4i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4i64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14152,7 +14152,7 @@ void programUniform1i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_programUniform1i64vNV* __restrict packet = (RenderCommand_programUniform1i64vNV*)getNextPacket();
+	RenderCommand_programUniform1i64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform1i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1i64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14165,7 +14165,7 @@ void programUniform2i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_programUniform2i64vNV* __restrict packet = (RenderCommand_programUniform2i64vNV*)getNextPacket();
+	RenderCommand_programUniform2i64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform2i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2i64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14178,7 +14178,7 @@ void programUniform3i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_programUniform3i64vNV* __restrict packet = (RenderCommand_programUniform3i64vNV*)getNextPacket();
+	RenderCommand_programUniform3i64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform3i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3i64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14191,7 +14191,7 @@ void programUniform4i64vNV(
 	GLsizei count,
 	const GLint64EXT *value)
 {
-	RenderCommand_programUniform4i64vNV* __restrict packet = (RenderCommand_programUniform4i64vNV*)getNextPacket();
+	RenderCommand_programUniform4i64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform4i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4i64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14203,7 +14203,7 @@ void programUniform1ui64NV(
 	GLint location,
 	GLuint64EXT x)
 {
-	RenderCommand_programUniform1ui64NV* __restrict packet = (RenderCommand_programUniform1ui64NV*)getNextPacket();
+	RenderCommand_programUniform1ui64NV* __restrict packet = allocatePacket<RenderCommand_programUniform1ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14215,7 +14215,7 @@ void programUniform2ui64NV(
 	GLuint64EXT x,
 	GLuint64EXT y)
 {
-	RenderCommand_programUniform2ui64NV* __restrict packet = (RenderCommand_programUniform2ui64NV*)getNextPacket();
+	RenderCommand_programUniform2ui64NV* __restrict packet = allocatePacket<RenderCommand_programUniform2ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14229,7 +14229,7 @@ void programUniform3ui64NV(
 	GLuint64EXT y,
 	GLuint64EXT z)
 {
-	RenderCommand_programUniform3ui64NV* __restrict packet = (RenderCommand_programUniform3ui64NV*)getNextPacket();
+	RenderCommand_programUniform3ui64NV* __restrict packet = allocatePacket<RenderCommand_programUniform3ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14245,7 +14245,7 @@ void programUniform4ui64NV(
 	GLuint64EXT z,
 	GLuint64EXT w)
 {
-	RenderCommand_programUniform4ui64NV* __restrict packet = (RenderCommand_programUniform4ui64NV*)getNextPacket();
+	RenderCommand_programUniform4ui64NV* __restrict packet = allocatePacket<RenderCommand_programUniform4ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14260,7 +14260,7 @@ void programUniform1ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_programUniform1ui64vNV* __restrict packet = (RenderCommand_programUniform1ui64vNV*)getNextPacket();
+	RenderCommand_programUniform1ui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform1ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform1ui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14273,7 +14273,7 @@ void programUniform2ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_programUniform2ui64vNV* __restrict packet = (RenderCommand_programUniform2ui64vNV*)getNextPacket();
+	RenderCommand_programUniform2ui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform2ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform2ui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14286,7 +14286,7 @@ void programUniform3ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_programUniform3ui64vNV* __restrict packet = (RenderCommand_programUniform3ui64vNV*)getNextPacket();
+	RenderCommand_programUniform3ui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform3ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform3ui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14299,7 +14299,7 @@ void programUniform4ui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_programUniform4ui64vNV* __restrict packet = (RenderCommand_programUniform4ui64vNV*)getNextPacket();
+	RenderCommand_programUniform4ui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniform4ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniform4ui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -14314,7 +14314,7 @@ void getInternalformatSampleivNV(
 	GLsizei bufSize,
 	GLint *params)
 {
-	RenderCommand_getInternalformatSampleivNV* __restrict packet = (RenderCommand_getInternalformatSampleivNV*)getNextPacket();
+	RenderCommand_getInternalformatSampleivNV* __restrict packet = allocatePacket<RenderCommand_getInternalformatSampleivNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getInternalformatSampleivNV::execute);
 	packet->target = target;
 	packet->internalformat = internalformat;
@@ -14330,7 +14330,7 @@ void getMemoryObjectDetachedResourcesuivNV(
 	GLsizei count,
 	GLuint *params)
 {
-	RenderCommand_getMemoryObjectDetachedResourcesuivNV* __restrict packet = (RenderCommand_getMemoryObjectDetachedResourcesuivNV*)getNextPacket();
+	RenderCommand_getMemoryObjectDetachedResourcesuivNV* __restrict packet = allocatePacket<RenderCommand_getMemoryObjectDetachedResourcesuivNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getMemoryObjectDetachedResourcesuivNV::execute);
 	packet->memory = memory;
 	packet->pname = pname;
@@ -14342,7 +14342,7 @@ void resetMemoryObjectParameterNV(
 	GLuint memory,
 	GLenum pname)
 {
-	RenderCommand_resetMemoryObjectParameterNV* __restrict packet = (RenderCommand_resetMemoryObjectParameterNV*)getNextPacket();
+	RenderCommand_resetMemoryObjectParameterNV* __restrict packet = allocatePacket<RenderCommand_resetMemoryObjectParameterNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_resetMemoryObjectParameterNV::execute);
 	packet->memory = memory;
 	packet->pname = pname;
@@ -14352,7 +14352,7 @@ void texAttachMemoryNV(
 	GLuint memory,
 	GLuint64 offset)
 {
-	RenderCommand_texAttachMemoryNV* __restrict packet = (RenderCommand_texAttachMemoryNV*)getNextPacket();
+	RenderCommand_texAttachMemoryNV* __restrict packet = allocatePacket<RenderCommand_texAttachMemoryNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texAttachMemoryNV::execute);
 	packet->target = target;
 	packet->memory = memory;
@@ -14363,7 +14363,7 @@ void bufferAttachMemoryNV(
 	GLuint memory,
 	GLuint64 offset)
 {
-	RenderCommand_bufferAttachMemoryNV* __restrict packet = (RenderCommand_bufferAttachMemoryNV*)getNextPacket();
+	RenderCommand_bufferAttachMemoryNV* __restrict packet = allocatePacket<RenderCommand_bufferAttachMemoryNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferAttachMemoryNV::execute);
 	packet->target = target;
 	packet->memory = memory;
@@ -14374,7 +14374,7 @@ void textureAttachMemoryNV(
 	GLuint memory,
 	GLuint64 offset)
 {
-	RenderCommand_textureAttachMemoryNV* __restrict packet = (RenderCommand_textureAttachMemoryNV*)getNextPacket();
+	RenderCommand_textureAttachMemoryNV* __restrict packet = allocatePacket<RenderCommand_textureAttachMemoryNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureAttachMemoryNV::execute);
 	packet->texture = texture;
 	packet->memory = memory;
@@ -14385,7 +14385,7 @@ void namedBufferAttachMemoryNV(
 	GLuint memory,
 	GLuint64 offset)
 {
-	RenderCommand_namedBufferAttachMemoryNV* __restrict packet = (RenderCommand_namedBufferAttachMemoryNV*)getNextPacket();
+	RenderCommand_namedBufferAttachMemoryNV* __restrict packet = allocatePacket<RenderCommand_namedBufferAttachMemoryNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedBufferAttachMemoryNV::execute);
 	packet->buffer = buffer;
 	packet->memory = memory;
@@ -14395,7 +14395,7 @@ void drawMeshTasksNV(
 	GLuint first,
 	GLuint count)
 {
-	RenderCommand_drawMeshTasksNV* __restrict packet = (RenderCommand_drawMeshTasksNV*)getNextPacket();
+	RenderCommand_drawMeshTasksNV* __restrict packet = allocatePacket<RenderCommand_drawMeshTasksNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawMeshTasksNV::execute);
 	packet->first = first;
 	packet->count = count;
@@ -14403,7 +14403,7 @@ void drawMeshTasksNV(
 void drawMeshTasksIndirectNV(
 	GLintptr indirect)
 {
-	RenderCommand_drawMeshTasksIndirectNV* __restrict packet = (RenderCommand_drawMeshTasksIndirectNV*)getNextPacket();
+	RenderCommand_drawMeshTasksIndirectNV* __restrict packet = allocatePacket<RenderCommand_drawMeshTasksIndirectNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_drawMeshTasksIndirectNV::execute);
 	packet->indirect = indirect;
 }
@@ -14412,7 +14412,7 @@ void multiDrawMeshTasksIndirectNV(
 	GLsizei drawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawMeshTasksIndirectNV* __restrict packet = (RenderCommand_multiDrawMeshTasksIndirectNV*)getNextPacket();
+	RenderCommand_multiDrawMeshTasksIndirectNV* __restrict packet = allocatePacket<RenderCommand_multiDrawMeshTasksIndirectNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawMeshTasksIndirectNV::execute);
 	packet->indirect = indirect;
 	packet->drawcount = drawcount;
@@ -14424,7 +14424,7 @@ void multiDrawMeshTasksIndirectCountNV(
 	GLsizei maxdrawcount,
 	GLsizei stride)
 {
-	RenderCommand_multiDrawMeshTasksIndirectCountNV* __restrict packet = (RenderCommand_multiDrawMeshTasksIndirectCountNV*)getNextPacket();
+	RenderCommand_multiDrawMeshTasksIndirectCountNV* __restrict packet = allocatePacket<RenderCommand_multiDrawMeshTasksIndirectCountNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_multiDrawMeshTasksIndirectCountNV::execute);
 	packet->indirect = indirect;
 	packet->drawcount = drawcount;
@@ -14434,7 +14434,7 @@ void multiDrawMeshTasksIndirectCountNV(
 GLuint genPathsNV(
 	GLsizei range)
 {
-	RenderCommand_genPathsNV* __restrict packet = (RenderCommand_genPathsNV*)getNextPacket();
+	RenderCommand_genPathsNV* __restrict packet = allocatePacket<RenderCommand_genPathsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_genPathsNV::execute);
 	packet->range = range;
 }
@@ -14442,7 +14442,7 @@ void deletePathsNV(
 	GLuint path,
 	GLsizei range)
 {
-	RenderCommand_deletePathsNV* __restrict packet = (RenderCommand_deletePathsNV*)getNextPacket();
+	RenderCommand_deletePathsNV* __restrict packet = allocatePacket<RenderCommand_deletePathsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_deletePathsNV::execute);
 	packet->path = path;
 	packet->range = range;
@@ -14450,7 +14450,7 @@ void deletePathsNV(
 GLboolean isPathNV(
 	GLuint path)
 {
-	RenderCommand_isPathNV* __restrict packet = (RenderCommand_isPathNV*)getNextPacket();
+	RenderCommand_isPathNV* __restrict packet = allocatePacket<RenderCommand_isPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isPathNV::execute);
 	packet->path = path;
 }
@@ -14462,7 +14462,7 @@ void pathCommandsNV(
 	GLenum coordType,
 	const void *coords)
 {
-	RenderCommand_pathCommandsNV* __restrict packet = (RenderCommand_pathCommandsNV*)getNextPacket();
+	RenderCommand_pathCommandsNV* __restrict packet = allocatePacket<RenderCommand_pathCommandsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathCommandsNV::execute);
 	packet->path = path;
 	packet->numCommands = numCommands;
@@ -14477,7 +14477,7 @@ void pathCoordsNV(
 	GLenum coordType,
 	const void *coords)
 {
-	RenderCommand_pathCoordsNV* __restrict packet = (RenderCommand_pathCoordsNV*)getNextPacket();
+	RenderCommand_pathCoordsNV* __restrict packet = allocatePacket<RenderCommand_pathCoordsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathCoordsNV::execute);
 	packet->path = path;
 	packet->numCoords = numCoords;
@@ -14494,7 +14494,7 @@ void pathSubCommandsNV(
 	GLenum coordType,
 	const void *coords)
 {
-	RenderCommand_pathSubCommandsNV* __restrict packet = (RenderCommand_pathSubCommandsNV*)getNextPacket();
+	RenderCommand_pathSubCommandsNV* __restrict packet = allocatePacket<RenderCommand_pathSubCommandsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathSubCommandsNV::execute);
 	packet->path = path;
 	packet->commandStart = commandStart;
@@ -14512,7 +14512,7 @@ void pathSubCoordsNV(
 	GLenum coordType,
 	const void *coords)
 {
-	RenderCommand_pathSubCoordsNV* __restrict packet = (RenderCommand_pathSubCoordsNV*)getNextPacket();
+	RenderCommand_pathSubCoordsNV* __restrict packet = allocatePacket<RenderCommand_pathSubCoordsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathSubCoordsNV::execute);
 	packet->path = path;
 	packet->coordStart = coordStart;
@@ -14526,7 +14526,7 @@ void pathStringNV(
 	GLsizei length,
 	const void *pathString)
 {
-	RenderCommand_pathStringNV* __restrict packet = (RenderCommand_pathStringNV*)getNextPacket();
+	RenderCommand_pathStringNV* __restrict packet = allocatePacket<RenderCommand_pathStringNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathStringNV::execute);
 	packet->path = path;
 	packet->format = format;
@@ -14545,7 +14545,7 @@ void pathGlyphsNV(
 	GLuint pathParameterTemplate,
 	GLfloat emScale)
 {
-	RenderCommand_pathGlyphsNV* __restrict packet = (RenderCommand_pathGlyphsNV*)getNextPacket();
+	RenderCommand_pathGlyphsNV* __restrict packet = allocatePacket<RenderCommand_pathGlyphsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathGlyphsNV::execute);
 	packet->firstPathName = firstPathName;
 	packet->fontTarget = fontTarget;
@@ -14569,7 +14569,7 @@ void pathGlyphRangeNV(
 	GLuint pathParameterTemplate,
 	GLfloat emScale)
 {
-	RenderCommand_pathGlyphRangeNV* __restrict packet = (RenderCommand_pathGlyphRangeNV*)getNextPacket();
+	RenderCommand_pathGlyphRangeNV* __restrict packet = allocatePacket<RenderCommand_pathGlyphRangeNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathGlyphRangeNV::execute);
 	packet->firstPathName = firstPathName;
 	packet->fontTarget = fontTarget;
@@ -14587,7 +14587,7 @@ void weightPathsNV(
 	const GLuint *paths,
 	const GLfloat *weights)
 {
-	RenderCommand_weightPathsNV* __restrict packet = (RenderCommand_weightPathsNV*)getNextPacket();
+	RenderCommand_weightPathsNV* __restrict packet = allocatePacket<RenderCommand_weightPathsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_weightPathsNV::execute);
 	packet->resultPath = resultPath;
 	packet->numPaths = numPaths;
@@ -14598,7 +14598,7 @@ void copyPathNV(
 	GLuint resultPath,
 	GLuint srcPath)
 {
-	RenderCommand_copyPathNV* __restrict packet = (RenderCommand_copyPathNV*)getNextPacket();
+	RenderCommand_copyPathNV* __restrict packet = allocatePacket<RenderCommand_copyPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_copyPathNV::execute);
 	packet->resultPath = resultPath;
 	packet->srcPath = srcPath;
@@ -14609,7 +14609,7 @@ void interpolatePathsNV(
 	GLuint pathB,
 	GLfloat weight)
 {
-	RenderCommand_interpolatePathsNV* __restrict packet = (RenderCommand_interpolatePathsNV*)getNextPacket();
+	RenderCommand_interpolatePathsNV* __restrict packet = allocatePacket<RenderCommand_interpolatePathsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_interpolatePathsNV::execute);
 	packet->resultPath = resultPath;
 	packet->pathA = pathA;
@@ -14622,7 +14622,7 @@ void transformPathNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_transformPathNV* __restrict packet = (RenderCommand_transformPathNV*)getNextPacket();
+	RenderCommand_transformPathNV* __restrict packet = allocatePacket<RenderCommand_transformPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_transformPathNV::execute);
 	packet->resultPath = resultPath;
 	packet->srcPath = srcPath;
@@ -14634,7 +14634,7 @@ void pathParameterivNV(
 	GLenum pname,
 	const GLint *value)
 {
-	RenderCommand_pathParameterivNV* __restrict packet = (RenderCommand_pathParameterivNV*)getNextPacket();
+	RenderCommand_pathParameterivNV* __restrict packet = allocatePacket<RenderCommand_pathParameterivNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathParameterivNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14645,7 +14645,7 @@ void pathParameteriNV(
 	GLenum pname,
 	GLint value)
 {
-	RenderCommand_pathParameteriNV* __restrict packet = (RenderCommand_pathParameteriNV*)getNextPacket();
+	RenderCommand_pathParameteriNV* __restrict packet = allocatePacket<RenderCommand_pathParameteriNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathParameteriNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14656,7 +14656,7 @@ void pathParameterfvNV(
 	GLenum pname,
 	const GLfloat *value)
 {
-	RenderCommand_pathParameterfvNV* __restrict packet = (RenderCommand_pathParameterfvNV*)getNextPacket();
+	RenderCommand_pathParameterfvNV* __restrict packet = allocatePacket<RenderCommand_pathParameterfvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathParameterfvNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14667,7 +14667,7 @@ void pathParameterfNV(
 	GLenum pname,
 	GLfloat value)
 {
-	RenderCommand_pathParameterfNV* __restrict packet = (RenderCommand_pathParameterfNV*)getNextPacket();
+	RenderCommand_pathParameterfNV* __restrict packet = allocatePacket<RenderCommand_pathParameterfNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathParameterfNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14678,7 +14678,7 @@ void pathDashArrayNV(
 	GLsizei dashCount,
 	const GLfloat *dashArray)
 {
-	RenderCommand_pathDashArrayNV* __restrict packet = (RenderCommand_pathDashArrayNV*)getNextPacket();
+	RenderCommand_pathDashArrayNV* __restrict packet = allocatePacket<RenderCommand_pathDashArrayNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathDashArrayNV::execute);
 	packet->path = path;
 	packet->dashCount = dashCount;
@@ -14689,7 +14689,7 @@ void pathStencilFuncNV(
 	GLint ref,
 	GLuint mask)
 {
-	RenderCommand_pathStencilFuncNV* __restrict packet = (RenderCommand_pathStencilFuncNV*)getNextPacket();
+	RenderCommand_pathStencilFuncNV* __restrict packet = allocatePacket<RenderCommand_pathStencilFuncNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathStencilFuncNV::execute);
 	packet->func = func;
 	packet->ref = ref;
@@ -14699,7 +14699,7 @@ void pathStencilDepthOffsetNV(
 	GLfloat factor,
 	GLfloat units)
 {
-	RenderCommand_pathStencilDepthOffsetNV* __restrict packet = (RenderCommand_pathStencilDepthOffsetNV*)getNextPacket();
+	RenderCommand_pathStencilDepthOffsetNV* __restrict packet = allocatePacket<RenderCommand_pathStencilDepthOffsetNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathStencilDepthOffsetNV::execute);
 	packet->factor = factor;
 	packet->units = units;
@@ -14709,7 +14709,7 @@ void stencilFillPathNV(
 	GLenum fillMode,
 	GLuint mask)
 {
-	RenderCommand_stencilFillPathNV* __restrict packet = (RenderCommand_stencilFillPathNV*)getNextPacket();
+	RenderCommand_stencilFillPathNV* __restrict packet = allocatePacket<RenderCommand_stencilFillPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilFillPathNV::execute);
 	packet->path = path;
 	packet->fillMode = fillMode;
@@ -14720,7 +14720,7 @@ void stencilStrokePathNV(
 	GLint reference,
 	GLuint mask)
 {
-	RenderCommand_stencilStrokePathNV* __restrict packet = (RenderCommand_stencilStrokePathNV*)getNextPacket();
+	RenderCommand_stencilStrokePathNV* __restrict packet = allocatePacket<RenderCommand_stencilStrokePathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilStrokePathNV::execute);
 	packet->path = path;
 	packet->reference = reference;
@@ -14736,7 +14736,7 @@ void stencilFillPathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_stencilFillPathInstancedNV* __restrict packet = (RenderCommand_stencilFillPathInstancedNV*)getNextPacket();
+	RenderCommand_stencilFillPathInstancedNV* __restrict packet = allocatePacket<RenderCommand_stencilFillPathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilFillPathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -14757,7 +14757,7 @@ void stencilStrokePathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_stencilStrokePathInstancedNV* __restrict packet = (RenderCommand_stencilStrokePathInstancedNV*)getNextPacket();
+	RenderCommand_stencilStrokePathInstancedNV* __restrict packet = allocatePacket<RenderCommand_stencilStrokePathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilStrokePathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -14771,7 +14771,7 @@ void stencilStrokePathInstancedNV(
 void pathCoverDepthFuncNV(
 	GLenum func)
 {
-	RenderCommand_pathCoverDepthFuncNV* __restrict packet = (RenderCommand_pathCoverDepthFuncNV*)getNextPacket();
+	RenderCommand_pathCoverDepthFuncNV* __restrict packet = allocatePacket<RenderCommand_pathCoverDepthFuncNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathCoverDepthFuncNV::execute);
 	packet->func = func;
 }
@@ -14779,7 +14779,7 @@ void coverFillPathNV(
 	GLuint path,
 	GLenum coverMode)
 {
-	RenderCommand_coverFillPathNV* __restrict packet = (RenderCommand_coverFillPathNV*)getNextPacket();
+	RenderCommand_coverFillPathNV* __restrict packet = allocatePacket<RenderCommand_coverFillPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverFillPathNV::execute);
 	packet->path = path;
 	packet->coverMode = coverMode;
@@ -14788,7 +14788,7 @@ void coverStrokePathNV(
 	GLuint path,
 	GLenum coverMode)
 {
-	RenderCommand_coverStrokePathNV* __restrict packet = (RenderCommand_coverStrokePathNV*)getNextPacket();
+	RenderCommand_coverStrokePathNV* __restrict packet = allocatePacket<RenderCommand_coverStrokePathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverStrokePathNV::execute);
 	packet->path = path;
 	packet->coverMode = coverMode;
@@ -14802,7 +14802,7 @@ void coverFillPathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_coverFillPathInstancedNV* __restrict packet = (RenderCommand_coverFillPathInstancedNV*)getNextPacket();
+	RenderCommand_coverFillPathInstancedNV* __restrict packet = allocatePacket<RenderCommand_coverFillPathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverFillPathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -14821,7 +14821,7 @@ void coverStrokePathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_coverStrokePathInstancedNV* __restrict packet = (RenderCommand_coverStrokePathInstancedNV*)getNextPacket();
+	RenderCommand_coverStrokePathInstancedNV* __restrict packet = allocatePacket<RenderCommand_coverStrokePathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_coverStrokePathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -14836,7 +14836,7 @@ void getPathParameterivNV(
 	GLenum pname,
 	GLint *value)
 {
-	RenderCommand_getPathParameterivNV* __restrict packet = (RenderCommand_getPathParameterivNV*)getNextPacket();
+	RenderCommand_getPathParameterivNV* __restrict packet = allocatePacket<RenderCommand_getPathParameterivNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathParameterivNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14847,7 +14847,7 @@ void getPathParameterfvNV(
 	GLenum pname,
 	GLfloat *value)
 {
-	RenderCommand_getPathParameterfvNV* __restrict packet = (RenderCommand_getPathParameterfvNV*)getNextPacket();
+	RenderCommand_getPathParameterfvNV* __restrict packet = allocatePacket<RenderCommand_getPathParameterfvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathParameterfvNV::execute);
 	packet->path = path;
 	packet->pname = pname;
@@ -14857,7 +14857,7 @@ void getPathCommandsNV(
 	GLuint path,
 	GLubyte *commands)
 {
-	RenderCommand_getPathCommandsNV* __restrict packet = (RenderCommand_getPathCommandsNV*)getNextPacket();
+	RenderCommand_getPathCommandsNV* __restrict packet = allocatePacket<RenderCommand_getPathCommandsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathCommandsNV::execute);
 	packet->path = path;
 	packet->commands = commands;
@@ -14866,7 +14866,7 @@ void getPathCoordsNV(
 	GLuint path,
 	GLfloat *coords)
 {
-	RenderCommand_getPathCoordsNV* __restrict packet = (RenderCommand_getPathCoordsNV*)getNextPacket();
+	RenderCommand_getPathCoordsNV* __restrict packet = allocatePacket<RenderCommand_getPathCoordsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathCoordsNV::execute);
 	packet->path = path;
 	packet->coords = coords;
@@ -14875,7 +14875,7 @@ void getPathDashArrayNV(
 	GLuint path,
 	GLfloat *dashArray)
 {
-	RenderCommand_getPathDashArrayNV* __restrict packet = (RenderCommand_getPathDashArrayNV*)getNextPacket();
+	RenderCommand_getPathDashArrayNV* __restrict packet = allocatePacket<RenderCommand_getPathDashArrayNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathDashArrayNV::execute);
 	packet->path = path;
 	packet->dashArray = dashArray;
@@ -14889,7 +14889,7 @@ void getPathMetricsNV(
 	GLsizei stride,
 	GLfloat *metrics)
 {
-	RenderCommand_getPathMetricsNV* __restrict packet = (RenderCommand_getPathMetricsNV*)getNextPacket();
+	RenderCommand_getPathMetricsNV* __restrict packet = allocatePacket<RenderCommand_getPathMetricsNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathMetricsNV::execute);
 	packet->metricQueryMask = metricQueryMask;
 	packet->numPaths = numPaths;
@@ -14906,7 +14906,7 @@ void getPathMetricRangeNV(
 	GLsizei stride,
 	GLfloat *metrics)
 {
-	RenderCommand_getPathMetricRangeNV* __restrict packet = (RenderCommand_getPathMetricRangeNV*)getNextPacket();
+	RenderCommand_getPathMetricRangeNV* __restrict packet = allocatePacket<RenderCommand_getPathMetricRangeNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathMetricRangeNV::execute);
 	packet->metricQueryMask = metricQueryMask;
 	packet->firstPathName = firstPathName;
@@ -14925,7 +14925,7 @@ void getPathSpacingNV(
 	GLenum transformType,
 	GLfloat *returnedSpacing)
 {
-	RenderCommand_getPathSpacingNV* __restrict packet = (RenderCommand_getPathSpacingNV*)getNextPacket();
+	RenderCommand_getPathSpacingNV* __restrict packet = allocatePacket<RenderCommand_getPathSpacingNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathSpacingNV::execute);
 	packet->pathListMode = pathListMode;
 	packet->numPaths = numPaths;
@@ -14943,7 +14943,7 @@ GLboolean isPointInFillPathNV(
 	GLfloat x,
 	GLfloat y)
 {
-	RenderCommand_isPointInFillPathNV* __restrict packet = (RenderCommand_isPointInFillPathNV*)getNextPacket();
+	RenderCommand_isPointInFillPathNV* __restrict packet = allocatePacket<RenderCommand_isPointInFillPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isPointInFillPathNV::execute);
 	packet->path = path;
 	packet->mask = mask;
@@ -14955,7 +14955,7 @@ GLboolean isPointInStrokePathNV(
 	GLfloat x,
 	GLfloat y)
 {
-	RenderCommand_isPointInStrokePathNV* __restrict packet = (RenderCommand_isPointInStrokePathNV*)getNextPacket();
+	RenderCommand_isPointInStrokePathNV* __restrict packet = allocatePacket<RenderCommand_isPointInStrokePathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isPointInStrokePathNV::execute);
 	packet->path = path;
 	packet->x = x;
@@ -14966,7 +14966,7 @@ GLfloat getPathLengthNV(
 	GLsizei startSegment,
 	GLsizei numSegments)
 {
-	RenderCommand_getPathLengthNV* __restrict packet = (RenderCommand_getPathLengthNV*)getNextPacket();
+	RenderCommand_getPathLengthNV* __restrict packet = allocatePacket<RenderCommand_getPathLengthNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getPathLengthNV::execute);
 	packet->path = path;
 	packet->startSegment = startSegment;
@@ -14982,7 +14982,7 @@ GLboolean pointAlongPathNV(
 	GLfloat *tangentX,
 	GLfloat *tangentY)
 {
-	RenderCommand_pointAlongPathNV* __restrict packet = (RenderCommand_pointAlongPathNV*)getNextPacket();
+	RenderCommand_pointAlongPathNV* __restrict packet = allocatePacket<RenderCommand_pointAlongPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pointAlongPathNV::execute);
 	packet->path = path;
 	packet->startSegment = startSegment;
@@ -14997,7 +14997,7 @@ void matrixLoad3x2fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixLoad3x2fNV* __restrict packet = (RenderCommand_matrixLoad3x2fNV*)getNextPacket();
+	RenderCommand_matrixLoad3x2fNV* __restrict packet = allocatePacket<RenderCommand_matrixLoad3x2fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoad3x2fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15006,7 +15006,7 @@ void matrixLoad3x3fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixLoad3x3fNV* __restrict packet = (RenderCommand_matrixLoad3x3fNV*)getNextPacket();
+	RenderCommand_matrixLoad3x3fNV* __restrict packet = allocatePacket<RenderCommand_matrixLoad3x3fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoad3x3fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15015,7 +15015,7 @@ void matrixLoadTranspose3x3fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixLoadTranspose3x3fNV* __restrict packet = (RenderCommand_matrixLoadTranspose3x3fNV*)getNextPacket();
+	RenderCommand_matrixLoadTranspose3x3fNV* __restrict packet = allocatePacket<RenderCommand_matrixLoadTranspose3x3fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixLoadTranspose3x3fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15024,7 +15024,7 @@ void matrixMult3x2fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixMult3x2fNV* __restrict packet = (RenderCommand_matrixMult3x2fNV*)getNextPacket();
+	RenderCommand_matrixMult3x2fNV* __restrict packet = allocatePacket<RenderCommand_matrixMult3x2fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMult3x2fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15033,7 +15033,7 @@ void matrixMult3x3fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixMult3x3fNV* __restrict packet = (RenderCommand_matrixMult3x3fNV*)getNextPacket();
+	RenderCommand_matrixMult3x3fNV* __restrict packet = allocatePacket<RenderCommand_matrixMult3x3fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMult3x3fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15042,7 +15042,7 @@ void matrixMultTranspose3x3fNV(
 	GLenum matrixMode,
 	const GLfloat *m)
 {
-	RenderCommand_matrixMultTranspose3x3fNV* __restrict packet = (RenderCommand_matrixMultTranspose3x3fNV*)getNextPacket();
+	RenderCommand_matrixMultTranspose3x3fNV* __restrict packet = allocatePacket<RenderCommand_matrixMultTranspose3x3fNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_matrixMultTranspose3x3fNV::execute);
 	packet->matrixMode = matrixMode;
 	packet->m = m;
@@ -15053,7 +15053,7 @@ void stencilThenCoverFillPathNV(
 	GLuint mask,
 	GLenum coverMode)
 {
-	RenderCommand_stencilThenCoverFillPathNV* __restrict packet = (RenderCommand_stencilThenCoverFillPathNV*)getNextPacket();
+	RenderCommand_stencilThenCoverFillPathNV* __restrict packet = allocatePacket<RenderCommand_stencilThenCoverFillPathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilThenCoverFillPathNV::execute);
 	packet->path = path;
 	packet->fillMode = fillMode;
@@ -15066,7 +15066,7 @@ void stencilThenCoverStrokePathNV(
 	GLuint mask,
 	GLenum coverMode)
 {
-	RenderCommand_stencilThenCoverStrokePathNV* __restrict packet = (RenderCommand_stencilThenCoverStrokePathNV*)getNextPacket();
+	RenderCommand_stencilThenCoverStrokePathNV* __restrict packet = allocatePacket<RenderCommand_stencilThenCoverStrokePathNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilThenCoverStrokePathNV::execute);
 	packet->path = path;
 	packet->reference = reference;
@@ -15084,7 +15084,7 @@ void stencilThenCoverFillPathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_stencilThenCoverFillPathInstancedNV* __restrict packet = (RenderCommand_stencilThenCoverFillPathInstancedNV*)getNextPacket();
+	RenderCommand_stencilThenCoverFillPathInstancedNV* __restrict packet = allocatePacket<RenderCommand_stencilThenCoverFillPathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilThenCoverFillPathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -15107,7 +15107,7 @@ void stencilThenCoverStrokePathInstancedNV(
 	GLenum transformType,
 	const GLfloat *transformValues)
 {
-	RenderCommand_stencilThenCoverStrokePathInstancedNV* __restrict packet = (RenderCommand_stencilThenCoverStrokePathInstancedNV*)getNextPacket();
+	RenderCommand_stencilThenCoverStrokePathInstancedNV* __restrict packet = allocatePacket<RenderCommand_stencilThenCoverStrokePathInstancedNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_stencilThenCoverStrokePathInstancedNV::execute);
 	packet->numPaths = numPaths;
 	packet->pathNameType = pathNameType;
@@ -15127,7 +15127,7 @@ GLenum pathGlyphIndexRangeNV(
 	GLfloat emScale,
 	GLuint baseAndCount[2])
 {
-	RenderCommand_pathGlyphIndexRangeNV* __restrict packet = (RenderCommand_pathGlyphIndexRangeNV*)getNextPacket();
+	RenderCommand_pathGlyphIndexRangeNV* __restrict packet = allocatePacket<RenderCommand_pathGlyphIndexRangeNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathGlyphIndexRangeNV::execute);
 	packet->fontTarget = fontTarget;
 	packet->fontName = fontName;
@@ -15147,7 +15147,7 @@ GLenum pathGlyphIndexArrayNV(
 	GLuint pathParameterTemplate,
 	GLfloat emScale)
 {
-	RenderCommand_pathGlyphIndexArrayNV* __restrict packet = (RenderCommand_pathGlyphIndexArrayNV*)getNextPacket();
+	RenderCommand_pathGlyphIndexArrayNV* __restrict packet = allocatePacket<RenderCommand_pathGlyphIndexArrayNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathGlyphIndexArrayNV::execute);
 	packet->firstPathName = firstPathName;
 	packet->fontTarget = fontTarget;
@@ -15169,7 +15169,7 @@ GLenum pathMemoryGlyphIndexArrayNV(
 	GLuint pathParameterTemplate,
 	GLfloat emScale)
 {
-	RenderCommand_pathMemoryGlyphIndexArrayNV* __restrict packet = (RenderCommand_pathMemoryGlyphIndexArrayNV*)getNextPacket();
+	RenderCommand_pathMemoryGlyphIndexArrayNV* __restrict packet = allocatePacket<RenderCommand_pathMemoryGlyphIndexArrayNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_pathMemoryGlyphIndexArrayNV::execute);
 	packet->firstPathName = firstPathName;
 	packet->fontTarget = fontTarget;
@@ -15188,7 +15188,7 @@ void programPathFragmentInputGenNV(
 	GLint components,
 	const GLfloat *coeffs)
 {
-	RenderCommand_programPathFragmentInputGenNV* __restrict packet = (RenderCommand_programPathFragmentInputGenNV*)getNextPacket();
+	RenderCommand_programPathFragmentInputGenNV* __restrict packet = allocatePacket<RenderCommand_programPathFragmentInputGenNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programPathFragmentInputGenNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -15206,7 +15206,7 @@ void getProgramResourcefvNV(
 	GLsizei *length,
 	GLfloat *params)
 {
-	RenderCommand_getProgramResourcefvNV* __restrict packet = (RenderCommand_getProgramResourcefvNV*)getNextPacket();
+	RenderCommand_getProgramResourcefvNV* __restrict packet = allocatePacket<RenderCommand_getProgramResourcefvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getProgramResourcefvNV::execute);
 	packet->program = program;
 	packet->programInterface = programInterface;
@@ -15223,7 +15223,7 @@ void framebufferSampleLocationsfvNV(
 	GLsizei count,
 	const GLfloat *v)
 {
-	RenderCommand_framebufferSampleLocationsfvNV* __restrict packet = (RenderCommand_framebufferSampleLocationsfvNV*)getNextPacket();
+	RenderCommand_framebufferSampleLocationsfvNV* __restrict packet = allocatePacket<RenderCommand_framebufferSampleLocationsfvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferSampleLocationsfvNV::execute);
 	packet->target = target;
 	packet->start = start;
@@ -15236,7 +15236,7 @@ void namedFramebufferSampleLocationsfvNV(
 	GLsizei count,
 	const GLfloat *v)
 {
-	RenderCommand_namedFramebufferSampleLocationsfvNV* __restrict packet = (RenderCommand_namedFramebufferSampleLocationsfvNV*)getNextPacket();
+	RenderCommand_namedFramebufferSampleLocationsfvNV* __restrict packet = allocatePacket<RenderCommand_namedFramebufferSampleLocationsfvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_namedFramebufferSampleLocationsfvNV::execute);
 	packet->framebuffer = framebuffer;
 	packet->start = start;
@@ -15246,7 +15246,7 @@ void namedFramebufferSampleLocationsfvNV(
 void resolveDepthValuesNV(
 	void)
 {
-	RenderCommand_resolveDepthValuesNV* __restrict packet = (RenderCommand_resolveDepthValuesNV*)getNextPacket();
+	RenderCommand_resolveDepthValuesNV* __restrict packet = allocatePacket<RenderCommand_resolveDepthValuesNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_resolveDepthValuesNV::execute);
 }
 void scissorExclusiveNV(
@@ -15255,7 +15255,7 @@ void scissorExclusiveNV(
 	GLsizei width,
 	GLsizei height)
 {
-	RenderCommand_scissorExclusiveNV* __restrict packet = (RenderCommand_scissorExclusiveNV*)getNextPacket();
+	RenderCommand_scissorExclusiveNV* __restrict packet = allocatePacket<RenderCommand_scissorExclusiveNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissorExclusiveNV::execute);
 	packet->x = x;
 	packet->y = y;
@@ -15267,7 +15267,7 @@ void scissorExclusiveArrayvNV(
 	GLsizei count,
 	const GLint *v)
 {
-	RenderCommand_scissorExclusiveArrayvNV* __restrict packet = (RenderCommand_scissorExclusiveArrayvNV*)getNextPacket();
+	RenderCommand_scissorExclusiveArrayvNV* __restrict packet = allocatePacket<RenderCommand_scissorExclusiveArrayvNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_scissorExclusiveArrayvNV::execute);
 	packet->first = first;
 	packet->count = count;
@@ -15277,7 +15277,7 @@ void makeBufferResidentNV(
 	GLenum target,
 	GLenum access)
 {
-	RenderCommand_makeBufferResidentNV* __restrict packet = (RenderCommand_makeBufferResidentNV*)getNextPacket();
+	RenderCommand_makeBufferResidentNV* __restrict packet = allocatePacket<RenderCommand_makeBufferResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeBufferResidentNV::execute);
 	packet->target = target;
 	packet->access = access;
@@ -15285,14 +15285,14 @@ void makeBufferResidentNV(
 void makeBufferNonResidentNV(
 	GLenum target)
 {
-	RenderCommand_makeBufferNonResidentNV* __restrict packet = (RenderCommand_makeBufferNonResidentNV*)getNextPacket();
+	RenderCommand_makeBufferNonResidentNV* __restrict packet = allocatePacket<RenderCommand_makeBufferNonResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeBufferNonResidentNV::execute);
 	packet->target = target;
 }
 GLboolean isBufferResidentNV(
 	GLenum target)
 {
-	RenderCommand_isBufferResidentNV* __restrict packet = (RenderCommand_isBufferResidentNV*)getNextPacket();
+	RenderCommand_isBufferResidentNV* __restrict packet = allocatePacket<RenderCommand_isBufferResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isBufferResidentNV::execute);
 	packet->target = target;
 }
@@ -15300,7 +15300,7 @@ void makeNamedBufferResidentNV(
 	GLuint buffer,
 	GLenum access)
 {
-	RenderCommand_makeNamedBufferResidentNV* __restrict packet = (RenderCommand_makeNamedBufferResidentNV*)getNextPacket();
+	RenderCommand_makeNamedBufferResidentNV* __restrict packet = allocatePacket<RenderCommand_makeNamedBufferResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeNamedBufferResidentNV::execute);
 	packet->buffer = buffer;
 	packet->access = access;
@@ -15308,14 +15308,14 @@ void makeNamedBufferResidentNV(
 void makeNamedBufferNonResidentNV(
 	GLuint buffer)
 {
-	RenderCommand_makeNamedBufferNonResidentNV* __restrict packet = (RenderCommand_makeNamedBufferNonResidentNV*)getNextPacket();
+	RenderCommand_makeNamedBufferNonResidentNV* __restrict packet = allocatePacket<RenderCommand_makeNamedBufferNonResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_makeNamedBufferNonResidentNV::execute);
 	packet->buffer = buffer;
 }
 GLboolean isNamedBufferResidentNV(
 	GLuint buffer)
 {
-	RenderCommand_isNamedBufferResidentNV* __restrict packet = (RenderCommand_isNamedBufferResidentNV*)getNextPacket();
+	RenderCommand_isNamedBufferResidentNV* __restrict packet = allocatePacket<RenderCommand_isNamedBufferResidentNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_isNamedBufferResidentNV::execute);
 	packet->buffer = buffer;
 }
@@ -15324,7 +15324,7 @@ void getBufferParameterui64vNV(
 	GLenum pname,
 	GLuint64EXT *params)
 {
-	RenderCommand_getBufferParameterui64vNV* __restrict packet = (RenderCommand_getBufferParameterui64vNV*)getNextPacket();
+	RenderCommand_getBufferParameterui64vNV* __restrict packet = allocatePacket<RenderCommand_getBufferParameterui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getBufferParameterui64vNV::execute);
 	packet->target = target;
 	packet->pname = pname;
@@ -15335,7 +15335,7 @@ void getNamedBufferParameterui64vNV(
 	GLenum pname,
 	GLuint64EXT *params)
 {
-	RenderCommand_getNamedBufferParameterui64vNV* __restrict packet = (RenderCommand_getNamedBufferParameterui64vNV*)getNextPacket();
+	RenderCommand_getNamedBufferParameterui64vNV* __restrict packet = allocatePacket<RenderCommand_getNamedBufferParameterui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getNamedBufferParameterui64vNV::execute);
 	packet->buffer = buffer;
 	packet->pname = pname;
@@ -15345,7 +15345,7 @@ void getIntegerui64vNV(
 	GLenum value,
 	GLuint64EXT *result)
 {
-	RenderCommand_getIntegerui64vNV* __restrict packet = (RenderCommand_getIntegerui64vNV*)getNextPacket();
+	RenderCommand_getIntegerui64vNV* __restrict packet = allocatePacket<RenderCommand_getIntegerui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getIntegerui64vNV::execute);
 	packet->value = value;
 	packet->result = result;
@@ -15354,7 +15354,7 @@ void uniformui64NV(
 	GLint location,
 	GLuint64EXT value)
 {
-	RenderCommand_uniformui64NV* __restrict packet = (RenderCommand_uniformui64NV*)getNextPacket();
+	RenderCommand_uniformui64NV* __restrict packet = allocatePacket<RenderCommand_uniformui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformui64NV::execute);
 	packet->location = location;
 	packet->value = value;
@@ -15364,7 +15364,7 @@ void uniformui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_uniformui64vNV* __restrict packet = (RenderCommand_uniformui64vNV*)getNextPacket();
+	RenderCommand_uniformui64vNV* __restrict packet = allocatePacket<RenderCommand_uniformui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_uniformui64vNV::execute);
 	packet->location = location;
 	packet->count = count;
@@ -15375,7 +15375,7 @@ void getUniformui64vNV(
 	GLint location,
 	GLuint64EXT *params)
 {
-	RenderCommand_getUniformui64vNV* __restrict packet = (RenderCommand_getUniformui64vNV*)getNextPacket();
+	RenderCommand_getUniformui64vNV* __restrict packet = allocatePacket<RenderCommand_getUniformui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getUniformui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -15386,7 +15386,7 @@ void programUniformui64NV(
 	GLint location,
 	GLuint64EXT value)
 {
-	RenderCommand_programUniformui64NV* __restrict packet = (RenderCommand_programUniformui64NV*)getNextPacket();
+	RenderCommand_programUniformui64NV* __restrict packet = allocatePacket<RenderCommand_programUniformui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformui64NV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -15398,7 +15398,7 @@ void programUniformui64vNV(
 	GLsizei count,
 	const GLuint64EXT *value)
 {
-	RenderCommand_programUniformui64vNV* __restrict packet = (RenderCommand_programUniformui64vNV*)getNextPacket();
+	RenderCommand_programUniformui64vNV* __restrict packet = allocatePacket<RenderCommand_programUniformui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_programUniformui64vNV::execute);
 	packet->program = program;
 	packet->location = location;
@@ -15408,7 +15408,7 @@ void programUniformui64vNV(
 void bindShadingRateImageNV(
 	GLuint texture)
 {
-	RenderCommand_bindShadingRateImageNV* __restrict packet = (RenderCommand_bindShadingRateImageNV*)getNextPacket();
+	RenderCommand_bindShadingRateImageNV* __restrict packet = allocatePacket<RenderCommand_bindShadingRateImageNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bindShadingRateImageNV::execute);
 	packet->texture = texture;
 }
@@ -15417,7 +15417,7 @@ void getShadingRateImagePaletteNV(
 	GLuint entry,
 	GLenum *rate)
 {
-	RenderCommand_getShadingRateImagePaletteNV* __restrict packet = (RenderCommand_getShadingRateImagePaletteNV*)getNextPacket();
+	RenderCommand_getShadingRateImagePaletteNV* __restrict packet = allocatePacket<RenderCommand_getShadingRateImagePaletteNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShadingRateImagePaletteNV::execute);
 	packet->viewport = viewport;
 	packet->entry = entry;
@@ -15429,7 +15429,7 @@ void getShadingRateSampleLocationivNV(
 	GLuint index,
 	GLint *location)
 {
-	RenderCommand_getShadingRateSampleLocationivNV* __restrict packet = (RenderCommand_getShadingRateSampleLocationivNV*)getNextPacket();
+	RenderCommand_getShadingRateSampleLocationivNV* __restrict packet = allocatePacket<RenderCommand_getShadingRateSampleLocationivNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getShadingRateSampleLocationivNV::execute);
 	packet->rate = rate;
 	packet->samples = samples;
@@ -15439,7 +15439,7 @@ void getShadingRateSampleLocationivNV(
 void shadingRateImageBarrierNV(
 	GLboolean synchronize)
 {
-	RenderCommand_shadingRateImageBarrierNV* __restrict packet = (RenderCommand_shadingRateImageBarrierNV*)getNextPacket();
+	RenderCommand_shadingRateImageBarrierNV* __restrict packet = allocatePacket<RenderCommand_shadingRateImageBarrierNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shadingRateImageBarrierNV::execute);
 	packet->synchronize = synchronize;
 }
@@ -15449,7 +15449,7 @@ void shadingRateImagePaletteNV(
 	GLsizei count,
 	const GLenum *rates)
 {
-	RenderCommand_shadingRateImagePaletteNV* __restrict packet = (RenderCommand_shadingRateImagePaletteNV*)getNextPacket();
+	RenderCommand_shadingRateImagePaletteNV* __restrict packet = allocatePacket<RenderCommand_shadingRateImagePaletteNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shadingRateImagePaletteNV::execute);
 	packet->viewport = viewport;
 	packet->first = first;
@@ -15459,7 +15459,7 @@ void shadingRateImagePaletteNV(
 void shadingRateSampleOrderNV(
 	GLenum order)
 {
-	RenderCommand_shadingRateSampleOrderNV* __restrict packet = (RenderCommand_shadingRateSampleOrderNV*)getNextPacket();
+	RenderCommand_shadingRateSampleOrderNV* __restrict packet = allocatePacket<RenderCommand_shadingRateSampleOrderNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shadingRateSampleOrderNV::execute);
 	packet->order = order;
 }
@@ -15468,7 +15468,7 @@ void shadingRateSampleOrderCustomNV(
 	GLuint samples,
 	const GLint *locations)
 {
-	RenderCommand_shadingRateSampleOrderCustomNV* __restrict packet = (RenderCommand_shadingRateSampleOrderCustomNV*)getNextPacket();
+	RenderCommand_shadingRateSampleOrderCustomNV* __restrict packet = allocatePacket<RenderCommand_shadingRateSampleOrderCustomNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_shadingRateSampleOrderCustomNV::execute);
 	packet->rate = rate;
 	packet->samples = samples;
@@ -15477,14 +15477,14 @@ void shadingRateSampleOrderCustomNV(
 void textureBarrierNV(
 	void)
 {
-	RenderCommand_textureBarrierNV* __restrict packet = (RenderCommand_textureBarrierNV*)getNextPacket();
+	RenderCommand_textureBarrierNV* __restrict packet = allocatePacket<RenderCommand_textureBarrierNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_textureBarrierNV::execute);
 }
 void vertexAttribL1i64NV(
 	GLuint index,
 	GLint64EXT x)
 {
-	RenderCommand_vertexAttribL1i64NV* __restrict packet = (RenderCommand_vertexAttribL1i64NV*)getNextPacket();
+	RenderCommand_vertexAttribL1i64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1i64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15494,7 +15494,7 @@ void vertexAttribL2i64NV(
 	GLint64EXT x,
 	GLint64EXT y)
 {
-	RenderCommand_vertexAttribL2i64NV* __restrict packet = (RenderCommand_vertexAttribL2i64NV*)getNextPacket();
+	RenderCommand_vertexAttribL2i64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2i64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15506,7 +15506,7 @@ void vertexAttribL3i64NV(
 	GLint64EXT y,
 	GLint64EXT z)
 {
-	RenderCommand_vertexAttribL3i64NV* __restrict packet = (RenderCommand_vertexAttribL3i64NV*)getNextPacket();
+	RenderCommand_vertexAttribL3i64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3i64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15520,7 +15520,7 @@ void vertexAttribL4i64NV(
 	GLint64EXT z,
 	GLint64EXT w)
 {
-	RenderCommand_vertexAttribL4i64NV* __restrict packet = (RenderCommand_vertexAttribL4i64NV*)getNextPacket();
+	RenderCommand_vertexAttribL4i64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4i64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4i64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15532,7 +15532,7 @@ void vertexAttribL1i64vNV(
 	GLuint index,
 	const GLint64EXT *v)
 {
-	RenderCommand_vertexAttribL1i64vNV* __restrict packet = (RenderCommand_vertexAttribL1i64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL1i64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1i64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15541,7 +15541,7 @@ void vertexAttribL2i64vNV(
 	GLuint index,
 	const GLint64EXT *v)
 {
-	RenderCommand_vertexAttribL2i64vNV* __restrict packet = (RenderCommand_vertexAttribL2i64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL2i64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2i64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15550,7 +15550,7 @@ void vertexAttribL3i64vNV(
 	GLuint index,
 	const GLint64EXT *v)
 {
-	RenderCommand_vertexAttribL3i64vNV* __restrict packet = (RenderCommand_vertexAttribL3i64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL3i64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3i64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15559,7 +15559,7 @@ void vertexAttribL4i64vNV(
 	GLuint index,
 	const GLint64EXT *v)
 {
-	RenderCommand_vertexAttribL4i64vNV* __restrict packet = (RenderCommand_vertexAttribL4i64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL4i64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4i64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4i64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15568,7 +15568,7 @@ void vertexAttribL1ui64NV(
 	GLuint index,
 	GLuint64EXT x)
 {
-	RenderCommand_vertexAttribL1ui64NV* __restrict packet = (RenderCommand_vertexAttribL1ui64NV*)getNextPacket();
+	RenderCommand_vertexAttribL1ui64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1ui64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15578,7 +15578,7 @@ void vertexAttribL2ui64NV(
 	GLuint64EXT x,
 	GLuint64EXT y)
 {
-	RenderCommand_vertexAttribL2ui64NV* __restrict packet = (RenderCommand_vertexAttribL2ui64NV*)getNextPacket();
+	RenderCommand_vertexAttribL2ui64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2ui64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15590,7 +15590,7 @@ void vertexAttribL3ui64NV(
 	GLuint64EXT y,
 	GLuint64EXT z)
 {
-	RenderCommand_vertexAttribL3ui64NV* __restrict packet = (RenderCommand_vertexAttribL3ui64NV*)getNextPacket();
+	RenderCommand_vertexAttribL3ui64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3ui64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15604,7 +15604,7 @@ void vertexAttribL4ui64NV(
 	GLuint64EXT z,
 	GLuint64EXT w)
 {
-	RenderCommand_vertexAttribL4ui64NV* __restrict packet = (RenderCommand_vertexAttribL4ui64NV*)getNextPacket();
+	RenderCommand_vertexAttribL4ui64NV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4ui64NV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4ui64NV::execute);
 	packet->index = index;
 	packet->x = x;
@@ -15616,7 +15616,7 @@ void vertexAttribL1ui64vNV(
 	GLuint index,
 	const GLuint64EXT *v)
 {
-	RenderCommand_vertexAttribL1ui64vNV* __restrict packet = (RenderCommand_vertexAttribL1ui64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL1ui64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL1ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL1ui64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15625,7 +15625,7 @@ void vertexAttribL2ui64vNV(
 	GLuint index,
 	const GLuint64EXT *v)
 {
-	RenderCommand_vertexAttribL2ui64vNV* __restrict packet = (RenderCommand_vertexAttribL2ui64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL2ui64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL2ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL2ui64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15634,7 +15634,7 @@ void vertexAttribL3ui64vNV(
 	GLuint index,
 	const GLuint64EXT *v)
 {
-	RenderCommand_vertexAttribL3ui64vNV* __restrict packet = (RenderCommand_vertexAttribL3ui64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL3ui64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL3ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL3ui64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15643,7 +15643,7 @@ void vertexAttribL4ui64vNV(
 	GLuint index,
 	const GLuint64EXT *v)
 {
-	RenderCommand_vertexAttribL4ui64vNV* __restrict packet = (RenderCommand_vertexAttribL4ui64vNV*)getNextPacket();
+	RenderCommand_vertexAttribL4ui64vNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribL4ui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribL4ui64vNV::execute);
 	packet->index = index;
 	packet->v = v;
@@ -15653,7 +15653,7 @@ void getVertexAttribLi64vNV(
 	GLenum pname,
 	GLint64EXT *params)
 {
-	RenderCommand_getVertexAttribLi64vNV* __restrict packet = (RenderCommand_getVertexAttribLi64vNV*)getNextPacket();
+	RenderCommand_getVertexAttribLi64vNV* __restrict packet = allocatePacket<RenderCommand_getVertexAttribLi64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribLi64vNV::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -15664,7 +15664,7 @@ void getVertexAttribLui64vNV(
 	GLenum pname,
 	GLuint64EXT *params)
 {
-	RenderCommand_getVertexAttribLui64vNV* __restrict packet = (RenderCommand_getVertexAttribLui64vNV*)getNextPacket();
+	RenderCommand_getVertexAttribLui64vNV* __restrict packet = allocatePacket<RenderCommand_getVertexAttribLui64vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getVertexAttribLui64vNV::execute);
 	packet->index = index;
 	packet->pname = pname;
@@ -15676,7 +15676,7 @@ void vertexAttribLFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_vertexAttribLFormatNV* __restrict packet = (RenderCommand_vertexAttribLFormatNV*)getNextPacket();
+	RenderCommand_vertexAttribLFormatNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribLFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribLFormatNV::execute);
 	packet->index = index;
 	packet->size = size;
@@ -15689,7 +15689,7 @@ void bufferAddressRangeNV(
 	GLuint64EXT address,
 	GLsizeiptr length)
 {
-	RenderCommand_bufferAddressRangeNV* __restrict packet = (RenderCommand_bufferAddressRangeNV*)getNextPacket();
+	RenderCommand_bufferAddressRangeNV* __restrict packet = allocatePacket<RenderCommand_bufferAddressRangeNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_bufferAddressRangeNV::execute);
 	packet->pname = pname;
 	packet->index = index;
@@ -15701,7 +15701,7 @@ void vertexFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_vertexFormatNV* __restrict packet = (RenderCommand_vertexFormatNV*)getNextPacket();
+	RenderCommand_vertexFormatNV* __restrict packet = allocatePacket<RenderCommand_vertexFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexFormatNV::execute);
 	packet->size = size;
 	packet->type = type;
@@ -15711,7 +15711,7 @@ void normalFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_normalFormatNV* __restrict packet = (RenderCommand_normalFormatNV*)getNextPacket();
+	RenderCommand_normalFormatNV* __restrict packet = allocatePacket<RenderCommand_normalFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_normalFormatNV::execute);
 	packet->type = type;
 	packet->stride = stride;
@@ -15721,7 +15721,7 @@ void colorFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_colorFormatNV* __restrict packet = (RenderCommand_colorFormatNV*)getNextPacket();
+	RenderCommand_colorFormatNV* __restrict packet = allocatePacket<RenderCommand_colorFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_colorFormatNV::execute);
 	packet->size = size;
 	packet->type = type;
@@ -15731,7 +15731,7 @@ void indexFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_indexFormatNV* __restrict packet = (RenderCommand_indexFormatNV*)getNextPacket();
+	RenderCommand_indexFormatNV* __restrict packet = allocatePacket<RenderCommand_indexFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_indexFormatNV::execute);
 	packet->type = type;
 	packet->stride = stride;
@@ -15741,7 +15741,7 @@ void texCoordFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_texCoordFormatNV* __restrict packet = (RenderCommand_texCoordFormatNV*)getNextPacket();
+	RenderCommand_texCoordFormatNV* __restrict packet = allocatePacket<RenderCommand_texCoordFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_texCoordFormatNV::execute);
 	packet->size = size;
 	packet->type = type;
@@ -15750,7 +15750,7 @@ void texCoordFormatNV(
 void edgeFlagFormatNV(
 	GLsizei stride)
 {
-	RenderCommand_edgeFlagFormatNV* __restrict packet = (RenderCommand_edgeFlagFormatNV*)getNextPacket();
+	RenderCommand_edgeFlagFormatNV* __restrict packet = allocatePacket<RenderCommand_edgeFlagFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_edgeFlagFormatNV::execute);
 	packet->stride = stride;
 }
@@ -15759,7 +15759,7 @@ void secondaryColorFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_secondaryColorFormatNV* __restrict packet = (RenderCommand_secondaryColorFormatNV*)getNextPacket();
+	RenderCommand_secondaryColorFormatNV* __restrict packet = allocatePacket<RenderCommand_secondaryColorFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_secondaryColorFormatNV::execute);
 	packet->size = size;
 	packet->type = type;
@@ -15769,7 +15769,7 @@ void fogCoordFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_fogCoordFormatNV* __restrict packet = (RenderCommand_fogCoordFormatNV*)getNextPacket();
+	RenderCommand_fogCoordFormatNV* __restrict packet = allocatePacket<RenderCommand_fogCoordFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_fogCoordFormatNV::execute);
 	packet->type = type;
 	packet->stride = stride;
@@ -15781,7 +15781,7 @@ void vertexAttribFormatNV(
 	GLboolean normalized,
 	GLsizei stride)
 {
-	RenderCommand_vertexAttribFormatNV* __restrict packet = (RenderCommand_vertexAttribFormatNV*)getNextPacket();
+	RenderCommand_vertexAttribFormatNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribFormatNV::execute);
 	packet->index = index;
 	packet->size = size;
@@ -15795,7 +15795,7 @@ void vertexAttribIFormatNV(
 	GLenum type,
 	GLsizei stride)
 {
-	RenderCommand_vertexAttribIFormatNV* __restrict packet = (RenderCommand_vertexAttribIFormatNV*)getNextPacket();
+	RenderCommand_vertexAttribIFormatNV* __restrict packet = allocatePacket<RenderCommand_vertexAttribIFormatNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_vertexAttribIFormatNV::execute);
 	packet->index = index;
 	packet->size = size;
@@ -15807,7 +15807,7 @@ void getIntegerui64i_vNV(
 	GLuint index,
 	GLuint64EXT *result)
 {
-	RenderCommand_getIntegerui64i_vNV* __restrict packet = (RenderCommand_getIntegerui64i_vNV*)getNextPacket();
+	RenderCommand_getIntegerui64i_vNV* __restrict packet = allocatePacket<RenderCommand_getIntegerui64i_vNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_getIntegerui64i_vNV::execute);
 	packet->value = value;
 	packet->index = index;
@@ -15820,7 +15820,7 @@ void viewportSwizzleNV(
 	GLenum swizzlez,
 	GLenum swizzlew)
 {
-	RenderCommand_viewportSwizzleNV* __restrict packet = (RenderCommand_viewportSwizzleNV*)getNextPacket();
+	RenderCommand_viewportSwizzleNV* __restrict packet = allocatePacket<RenderCommand_viewportSwizzleNV>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_viewportSwizzleNV::execute);
 	packet->index = index;
 	packet->swizzlex = swizzlex;
@@ -15836,7 +15836,7 @@ void framebufferTextureMultiviewOVR(
 	GLint baseViewIndex,
 	GLsizei numViews)
 {
-	RenderCommand_framebufferTextureMultiviewOVR* __restrict packet = (RenderCommand_framebufferTextureMultiviewOVR*)getNextPacket();
+	RenderCommand_framebufferTextureMultiviewOVR* __restrict packet = allocatePacket<RenderCommand_framebufferTextureMultiviewOVR>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_framebufferTextureMultiviewOVR::execute);
 	packet->target = target;
 	packet->attachment = attachment;
@@ -5,10 +5,13 @@
 #include "badger/system/mem_alloc.h"
 #include "badger/assertion/assertion.h"
 
+#include <new>
 #include <vector>
 #include <functional>
 #include <mutex>
 
+class JobSystem;
+
 namespace pathos {
 
 	class Texture;
@@ -17,6 +20,7 @@ namespace pathos {
 
 		static const uint32 RENDER_COMMAND_LIST_MAX_MEMORY;
 		static const uint32 COMMAND_PARAMETERS_MAX_MEMORY;
+		static constexpr uint32 PACKET_ALIGNMENT = 8;
 
 	private:
 		struct RenderCommand_registerHook : RenderCommandBase {
@@ -28,6 +32,14 @@ namespace pathos {
 				params->hookCommandList->flushAllCommands();
 			}
 		};
+
+		struct RenderCommand_executeSecondary : RenderCommandBase {
+			RenderCommandList* secondaryCommandList;
+
+			static void APIENTRY execute(const RenderCommand_executeSecondary* __restrict params) {
+				params->secondaryCommandList->flushAllCommands();
+			}
+		};
 		
 	public:
 		RenderCommandList(const char* inDebugName, uint32 commandAllocBytes = RENDER_COMMAND_LIST_MAX_MEMORY, uint32 parametersAllocBytes = COMMAND_PARAMETERS_MAX_MEMORY)
@@ -58,6 +70,31 @@ namespace pathos {
 		// For subsequent works related to GL calls that have return values
 		void registerHook(std::function<void(RenderCommandList& cmdList)> hook);
 
+		/// Splice a secondary command list into this list. The secondary list is flushed
+		/// when this list reaches the splice point, so do not touch it until then.
+		/// The secondary list may still be recorded after this call; its commands are counted when queried.
+		void appendSecondaryCommandList(RenderCommandList* secondaryCommandList);
+
+		/// Record secondary command lists in parallel, then splice them into this list in index order.
+		/// Each secondary list is recorded by exactly one thread. Runs serially if jobSystem is null.
+		void recordSecondaryCommandLists(
+			JobSystem* jobSystem,
+			RenderCommandList* const* secondaryCommandLists,
+			uint32 numSecondaryCommandLists,
+			const std::function<void(RenderCommandList& cmdList, uint32 index)>& recordRoutine);
+
+		// Visit all packets in recorded order without executing them.
+		template<typename Visitor>
+		void forEachPacket(Visitor visitor) const {
+			uint8* base = commands_alloc.getBaseAddress();
+			const uint32 endOffset = commands_alloc.getUsedBytes();
+			for (uint32 offset = 0; offset < endOffset; ) {
+				const RenderCommandBase* packet = reinterpret_cast<const RenderCommandBase*>(base + offset);
+				visitor(packet);
+				offset += packet->packetBytes;
+			}
+		}
+
 		// Returns a memory region that will be invalidated after all commands are executed.
 		void* allocateSingleFrameMemory(uint64 bytes) {
 			CHECK(bytes <= 0xffffffff); // Well, who would do this?
@@ -76,8 +113,10 @@ namespace pathos {
 		// Free all memory that came from registerDeferredCleanup().
 		void performDeferredCleanup();
 
-		inline uint32 getNumCommands() const { return (uint32)commands.size(); }
-		inline bool isEmpty() const { return commands.size() == 0; }
+		// Includes commands of spliced secondary command lists.
+		uint32 getNumCommands() const;
+		inline bool isEmpty() const { return getNumCommands() == 0; }
+		inline uint32 getUsedCommandBytes() const { return commands_alloc.getUsedBytes(); }
 
 		// Debug only
 		const char* debugName;
@@ -88,7 +127,17 @@ namespace pathos {
 		struct SceneRenderTargets* sceneRenderTargets;
 
 	private:
-		RenderCommandBase* getNextPacket();
+		// Packets are laid out linearly, each taking only the size of its own type.
+		template<typename PacketType>
+		PacketType* allocatePacket()
+		{
+			constexpr uint32 packetBytes = (uint32)((sizeof(PacketType) + PACKET_ALIGNMENT - 1) & ~(PACKET_ALIGNMENT - 1));
+			PacketType* packet = (PacketType*)commands_alloc.alloc(packetBytes);
+			CHECKF(packet != nullptr, "Not enough memory for render command list");
+			packet->packetBytes = packetBytes;
+			++numCommands;
+			return packet;
+		}
 
 		// #todo-refactoring: Use allocateSingleFrameMemory() instead.
 		template<typename T>
@@ -105,8 +154,9 @@ namespace pathos {
 		StackAllocator parameters_alloc; // non-singular parameters should be mem-copied to this allocator, as source data could be a local variable
 		
 		std::mutex commandListLock;
-		std::vector<RenderCommandBase*> commands;
+		uint32 numCommands = 0;
 		uint32 flushDepth = 0;
+		std::vector<RenderCommandList*> secondaryCommandLists; // Spliced by appendSecondaryCommandList()
 
 		RenderCommandList* hookCommandList;
 
@@ -18412,1273 +18412,3 @@ struct RenderCommand_framebufferTextureMultiviewOVR : public RenderCommandBase {
 		);
 	}
 };
-union RenderCommandPacketUnion {
-public:
-	PFN_EXECUTE execute;
-private:
-	RenderCommand_cullFace cullFace;
-	RenderCommand_frontFace frontFace;
-	RenderCommand_hint hint;
-	RenderCommand_lineWidth lineWidth;
-	RenderCommand_pointSize pointSize;
-	RenderCommand_polygonMode polygonMode;
-	RenderCommand_scissor scissor;
-	RenderCommand_texParameterf texParameterf;
-	RenderCommand_texParameterfv texParameterfv;
-	RenderCommand_texParameteri texParameteri;
-	RenderCommand_texParameteriv texParameteriv;
-	RenderCommand_texImage1D texImage1D;
-	RenderCommand_texImage2D texImage2D;
-	RenderCommand_drawBuffer drawBuffer;
-	RenderCommand_clear clear;
-	RenderCommand_clearColor clearColor;
-	RenderCommand_clearStencil clearStencil;
-	RenderCommand_clearDepth clearDepth;
-	RenderCommand_stencilMask stencilMask;
-	RenderCommand_colorMask colorMask;
-	RenderCommand_depthMask depthMask;
-	RenderCommand_disable disable;
-	RenderCommand_enable enable;
-	RenderCommand_finish finish;
-	RenderCommand_flush flush;
-	RenderCommand_blendFunc blendFunc;
-	RenderCommand_logicOp logicOp;
-	RenderCommand_stencilFunc stencilFunc;
-	RenderCommand_stencilOp stencilOp;
-	RenderCommand_depthFunc depthFunc;
-	RenderCommand_pixelStoref pixelStoref;
-	RenderCommand_pixelStorei pixelStorei;
-	RenderCommand_readBuffer readBuffer;
-	RenderCommand_readPixels readPixels;
-	RenderCommand_getBooleanv getBooleanv;
-	RenderCommand_getDoublev getDoublev;
-	RenderCommand_getError getError;
-	RenderCommand_getFloatv getFloatv;
-	RenderCommand_getIntegerv getIntegerv;
-	RenderCommand_getString getString;
-	RenderCommand_getTexImage getTexImage;
-	RenderCommand_getTexParameterfv getTexParameterfv;
-	RenderCommand_getTexParameteriv getTexParameteriv;
-	RenderCommand_getTexLevelParameterfv getTexLevelParameterfv;
-	RenderCommand_getTexLevelParameteriv getTexLevelParameteriv;
-	RenderCommand_isEnabled isEnabled;
-	RenderCommand_depthRange depthRange;
-	RenderCommand_viewport viewport;
-	RenderCommand_drawArrays drawArrays;
-	RenderCommand_drawElements drawElements;
-	RenderCommand_getPointerv getPointerv;
-	RenderCommand_polygonOffset polygonOffset;
-	RenderCommand_copyTexImage1D copyTexImage1D;
-	RenderCommand_copyTexImage2D copyTexImage2D;
-	RenderCommand_copyTexSubImage1D copyTexSubImage1D;
-	RenderCommand_copyTexSubImage2D copyTexSubImage2D;
-	RenderCommand_texSubImage1D texSubImage1D;
-	RenderCommand_texSubImage2D texSubImage2D;
-	RenderCommand_bindTexture bindTexture;
-	RenderCommand_deleteTextures deleteTextures;
-	RenderCommand_genTextures genTextures;
-	RenderCommand_isTexture isTexture;
-	RenderCommand_drawRangeElements drawRangeElements;
-	RenderCommand_texImage3D texImage3D;
-	RenderCommand_texSubImage3D texSubImage3D;
-	RenderCommand_copyTexSubImage3D copyTexSubImage3D;
-	RenderCommand_activeTexture activeTexture;
-	RenderCommand_sampleCoverage sampleCoverage;
-	RenderCommand_compressedTexImage3D compressedTexImage3D;
-	RenderCommand_compressedTexImage2D compressedTexImage2D;
-	RenderCommand_compressedTexImage1D compressedTexImage1D;
-	RenderCommand_compressedTexSubImage3D compressedTexSubImage3D;
-	RenderCommand_compressedTexSubImage2D compressedTexSubImage2D;
-	RenderCommand_compressedTexSubImage1D compressedTexSubImage1D;
-	RenderCommand_getCompressedTexImage getCompressedTexImage;
-	RenderCommand_blendFuncSeparate blendFuncSeparate;
-	RenderCommand_multiDrawArrays multiDrawArrays;
-	RenderCommand_multiDrawElements multiDrawElements;
-	RenderCommand_pointParameterf pointParameterf;
-	RenderCommand_pointParameterfv pointParameterfv;
-	RenderCommand_pointParameteri pointParameteri;
-	RenderCommand_pointParameteriv pointParameteriv;
-	RenderCommand_blendColor blendColor;
-	RenderCommand_blendEquation blendEquation;
-	RenderCommand_genQueries genQueries;
-	RenderCommand_deleteQueries deleteQueries;
-	RenderCommand_isQuery isQuery;
-	RenderCommand_beginQuery beginQuery;
-	RenderCommand_endQuery endQuery;
-	RenderCommand_getQueryiv getQueryiv;
-	RenderCommand_getQueryObjectiv getQueryObjectiv;
-	RenderCommand_getQueryObjectuiv getQueryObjectuiv;
-	RenderCommand_bindBuffer bindBuffer;
-	RenderCommand_deleteBuffers deleteBuffers;
-	RenderCommand_genBuffers genBuffers;
-	RenderCommand_isBuffer isBuffer;
-	RenderCommand_bufferData bufferData;
-	RenderCommand_bufferSubData bufferSubData;
-	RenderCommand_getBufferSubData getBufferSubData;
-	RenderCommand_mapBuffer mapBuffer;
-	RenderCommand_unmapBuffer unmapBuffer;
-	RenderCommand_getBufferParameteriv getBufferParameteriv;
-	RenderCommand_getBufferPointerv getBufferPointerv;
-	RenderCommand_blendEquationSeparate blendEquationSeparate;
-	RenderCommand_drawBuffers drawBuffers;
-	RenderCommand_stencilOpSeparate stencilOpSeparate;
-	RenderCommand_stencilFuncSeparate stencilFuncSeparate;
-	RenderCommand_stencilMaskSeparate stencilMaskSeparate;
-	RenderCommand_attachShader attachShader;
-	RenderCommand_bindAttribLocation bindAttribLocation;
-	RenderCommand_compileShader compileShader;
-	RenderCommand_createProgram createProgram;
-	RenderCommand_createShader createShader;
-	RenderCommand_deleteProgram deleteProgram;
-	RenderCommand_deleteShader deleteShader;
-	RenderCommand_detachShader detachShader;
-	RenderCommand_disableVertexAttribArray disableVertexAttribArray;
-	RenderCommand_enableVertexAttribArray enableVertexAttribArray;
-	RenderCommand_getActiveAttrib getActiveAttrib;
-	RenderCommand_getActiveUniform getActiveUniform;
-	RenderCommand_getAttachedShaders getAttachedShaders;
-	RenderCommand_getAttribLocation getAttribLocation;
-	RenderCommand_getProgramiv getProgramiv;
-	RenderCommand_getProgramInfoLog getProgramInfoLog;
-	RenderCommand_getShaderiv getShaderiv;
-	RenderCommand_getShaderInfoLog getShaderInfoLog;
-	RenderCommand_getShaderSource getShaderSource;
-	RenderCommand_getUniformLocation getUniformLocation;
-	RenderCommand_getUniformfv getUniformfv;
-	RenderCommand_getUniformiv getUniformiv;
-	RenderCommand_getVertexAttribdv getVertexAttribdv;
-	RenderCommand_getVertexAttribfv getVertexAttribfv;
-	RenderCommand_getVertexAttribiv getVertexAttribiv;
-	RenderCommand_getVertexAttribPointerv getVertexAttribPointerv;
-	RenderCommand_isProgram isProgram;
-	RenderCommand_isShader isShader;
-	RenderCommand_linkProgram linkProgram;
-	RenderCommand_shaderSource shaderSource;
-	RenderCommand_useProgram useProgram;
-	RenderCommand_uniform1f uniform1f;
-	RenderCommand_uniform2f uniform2f;
-	RenderCommand_uniform3f uniform3f;
-	RenderCommand_uniform4f uniform4f;
-	RenderCommand_uniform1i uniform1i;
-	RenderCommand_uniform2i uniform2i;
-	RenderCommand_uniform3i uniform3i;
-	RenderCommand_uniform4i uniform4i;
-	RenderCommand_uniform1fv uniform1fv;
-	RenderCommand_uniform2fv uniform2fv;
-	RenderCommand_uniform3fv uniform3fv;
-	RenderCommand_uniform4fv uniform4fv;
-	RenderCommand_uniform1iv uniform1iv;
-	RenderCommand_uniform2iv uniform2iv;
-	RenderCommand_uniform3iv uniform3iv;
-	RenderCommand_uniform4iv uniform4iv;
-	RenderCommand_uniformMatrix2fv uniformMatrix2fv;
-	RenderCommand_uniformMatrix3fv uniformMatrix3fv;
-	RenderCommand_uniformMatrix4fv uniformMatrix4fv;
-	RenderCommand_validateProgram validateProgram;
-	RenderCommand_vertexAttrib1d vertexAttrib1d;
-	RenderCommand_vertexAttrib1dv vertexAttrib1dv;
-	RenderCommand_vertexAttrib1f vertexAttrib1f;
-	RenderCommand_vertexAttrib1fv vertexAttrib1fv;
-	RenderCommand_vertexAttrib1s vertexAttrib1s;
-	RenderCommand_vertexAttrib1sv vertexAttrib1sv;
-	RenderCommand_vertexAttrib2d vertexAttrib2d;
-	RenderCommand_vertexAttrib2dv vertexAttrib2dv;
-	RenderCommand_vertexAttrib2f vertexAttrib2f;
-	RenderCommand_vertexAttrib2fv vertexAttrib2fv;
-	RenderCommand_vertexAttrib2s vertexAttrib2s;
-	RenderCommand_vertexAttrib2sv vertexAttrib2sv;
-	RenderCommand_vertexAttrib3d vertexAttrib3d;
-	RenderCommand_vertexAttrib3dv vertexAttrib3dv;
-	RenderCommand_vertexAttrib3f vertexAttrib3f;
-	RenderCommand_vertexAttrib3fv vertexAttrib3fv;
-	RenderCommand_vertexAttrib3s vertexAttrib3s;
-	RenderCommand_vertexAttrib3sv vertexAttrib3sv;
-	RenderCommand_vertexAttrib4Nbv vertexAttrib4Nbv;
-	RenderCommand_vertexAttrib4Niv vertexAttrib4Niv;
-	RenderCommand_vertexAttrib4Nsv vertexAttrib4Nsv;
-	RenderCommand_vertexAttrib4Nub vertexAttrib4Nub;
-	RenderCommand_vertexAttrib4Nubv vertexAttrib4Nubv;
-	RenderCommand_vertexAttrib4Nuiv vertexAttrib4Nuiv;
-	RenderCommand_vertexAttrib4Nusv vertexAttrib4Nusv;
-	RenderCommand_vertexAttrib4bv vertexAttrib4bv;
-	RenderCommand_vertexAttrib4d vertexAttrib4d;
-	RenderCommand_vertexAttrib4dv vertexAttrib4dv;
-	RenderCommand_vertexAttrib4f vertexAttrib4f;
-	RenderCommand_vertexAttrib4fv vertexAttrib4fv;
-	RenderCommand_vertexAttrib4iv vertexAttrib4iv;
-	RenderCommand_vertexAttrib4s vertexAttrib4s;
-	RenderCommand_vertexAttrib4sv vertexAttrib4sv;
-	RenderCommand_vertexAttrib4ubv vertexAttrib4ubv;
-	RenderCommand_vertexAttrib4uiv vertexAttrib4uiv;
-	RenderCommand_vertexAttrib4usv vertexAttrib4usv;
-	RenderCommand_vertexAttribPointer vertexAttribPointer;
-	RenderCommand_uniformMatrix2x3fv uniformMatrix2x3fv;
-	RenderCommand_uniformMatrix3x2fv uniformMatrix3x2fv;
-	RenderCommand_uniformMatrix2x4fv uniformMatrix2x4fv;
-	RenderCommand_uniformMatrix4x2fv uniformMatrix4x2fv;
-	RenderCommand_uniformMatrix3x4fv uniformMatrix3x4fv;
-	RenderCommand_uniformMatrix4x3fv uniformMatrix4x3fv;
-	RenderCommand_colorMaski colorMaski;
-	RenderCommand_getBooleani_v getBooleani_v;
-	RenderCommand_getIntegeri_v getIntegeri_v;
-	RenderCommand_enablei enablei;
-	RenderCommand_disablei disablei;
-	RenderCommand_isEnabledi isEnabledi;
-	RenderCommand_beginTransformFeedback beginTransformFeedback;
-	RenderCommand_endTransformFeedback endTransformFeedback;
-	RenderCommand_bindBufferRange bindBufferRange;
-	RenderCommand_bindBufferBase bindBufferBase;
-	RenderCommand_transformFeedbackVaryings transformFeedbackVaryings;
-	RenderCommand_getTransformFeedbackVarying getTransformFeedbackVarying;
-	RenderCommand_clampColor clampColor;
-	RenderCommand_beginConditionalRender beginConditionalRender;
-	RenderCommand_endConditionalRender endConditionalRender;
-	RenderCommand_vertexAttribIPointer vertexAttribIPointer;
-	RenderCommand_getVertexAttribIiv getVertexAttribIiv;
-	RenderCommand_getVertexAttribIuiv getVertexAttribIuiv;
-	RenderCommand_vertexAttribI1i vertexAttribI1i;
-	RenderCommand_vertexAttribI2i vertexAttribI2i;
-	RenderCommand_vertexAttribI3i vertexAttribI3i;
-	RenderCommand_vertexAttribI4i vertexAttribI4i;
-	RenderCommand_vertexAttribI1ui vertexAttribI1ui;
-	RenderCommand_vertexAttribI2ui vertexAttribI2ui;
-	RenderCommand_vertexAttribI3ui vertexAttribI3ui;
-	RenderCommand_vertexAttribI4ui vertexAttribI4ui;
-	RenderCommand_vertexAttribI1iv vertexAttribI1iv;
-	RenderCommand_vertexAttribI2iv vertexAttribI2iv;
-	RenderCommand_vertexAttribI3iv vertexAttribI3iv;
-	RenderCommand_vertexAttribI4iv vertexAttribI4iv;
-	RenderCommand_vertexAttribI1uiv vertexAttribI1uiv;
-	RenderCommand_vertexAttribI2uiv vertexAttribI2uiv;
-	RenderCommand_vertexAttribI3uiv vertexAttribI3uiv;
-	RenderCommand_vertexAttribI4uiv vertexAttribI4uiv;
-	RenderCommand_vertexAttribI4bv vertexAttribI4bv;
-	RenderCommand_vertexAttribI4sv vertexAttribI4sv;
-	RenderCommand_vertexAttribI4ubv vertexAttribI4ubv;
-	RenderCommand_vertexAttribI4usv vertexAttribI4usv;
-	RenderCommand_getUniformuiv getUniformuiv;
-	RenderCommand_bindFragDataLocation bindFragDataLocation;
-	RenderCommand_getFragDataLocation getFragDataLocation;
-	RenderCommand_uniform1ui uniform1ui;
-	RenderCommand_uniform2ui uniform2ui;
-	RenderCommand_uniform3ui uniform3ui;
-	RenderCommand_uniform4ui uniform4ui;
-	RenderCommand_uniform1uiv uniform1uiv;
-	RenderCommand_uniform2uiv uniform2uiv;
-	RenderCommand_uniform3uiv uniform3uiv;
-	RenderCommand_uniform4uiv uniform4uiv;
-	RenderCommand_texParameterIiv texParameterIiv;
-	RenderCommand_texParameterIuiv texParameterIuiv;
-	RenderCommand_getTexParameterIiv getTexParameterIiv;
-	RenderCommand_getTexParameterIuiv getTexParameterIuiv;
-	RenderCommand_clearBufferiv clearBufferiv;
-	RenderCommand_clearBufferuiv clearBufferuiv;
-	RenderCommand_clearBufferfv clearBufferfv;
-	RenderCommand_clearBufferfi clearBufferfi;
-	RenderCommand_getStringi getStringi;
-	RenderCommand_isRenderbuffer isRenderbuffer;
-	RenderCommand_bindRenderbuffer bindRenderbuffer;
-	RenderCommand_deleteRenderbuffers deleteRenderbuffers;
-	RenderCommand_genRenderbuffers genRenderbuffers;
-	RenderCommand_renderbufferStorage renderbufferStorage;
-	RenderCommand_getRenderbufferParameteriv getRenderbufferParameteriv;
-	RenderCommand_isFramebuffer isFramebuffer;
-	RenderCommand_bindFramebuffer bindFramebuffer;
-	RenderCommand_deleteFramebuffers deleteFramebuffers;
-	RenderCommand_genFramebuffers genFramebuffers;
-	RenderCommand_checkFramebufferStatus checkFramebufferStatus;
-	RenderCommand_framebufferTexture1D framebufferTexture1D;
-	RenderCommand_framebufferTexture2D framebufferTexture2D;
-	RenderCommand_framebufferTexture3D framebufferTexture3D;
-	RenderCommand_framebufferRenderbuffer framebufferRenderbuffer;
-	RenderCommand_getFramebufferAttachmentParameteriv getFramebufferAttachmentParameteriv;
-	RenderCommand_generateMipmap generateMipmap;
-	RenderCommand_blitFramebuffer blitFramebuffer;
-	RenderCommand_renderbufferStorageMultisample renderbufferStorageMultisample;
-	RenderCommand_framebufferTextureLayer framebufferTextureLayer;
-	RenderCommand_mapBufferRange mapBufferRange;
-	RenderCommand_flushMappedBufferRange flushMappedBufferRange;
-	RenderCommand_bindVertexArray bindVertexArray;
-	RenderCommand_deleteVertexArrays deleteVertexArrays;
-	RenderCommand_genVertexArrays genVertexArrays;
-	RenderCommand_isVertexArray isVertexArray;
-	RenderCommand_drawArraysInstanced drawArraysInstanced;
-	RenderCommand_drawElementsInstanced drawElementsInstanced;
-	RenderCommand_texBuffer texBuffer;
-	RenderCommand_primitiveRestartIndex primitiveRestartIndex;
-	RenderCommand_copyBufferSubData copyBufferSubData;
-	RenderCommand_getUniformIndices getUniformIndices;
-	RenderCommand_getActiveUniformsiv getActiveUniformsiv;
-	RenderCommand_getActiveUniformName getActiveUniformName;
-	RenderCommand_getUniformBlockIndex getUniformBlockIndex;
-	RenderCommand_getActiveUniformBlockiv getActiveUniformBlockiv;
-	RenderCommand_getActiveUniformBlockName getActiveUniformBlockName;
-	RenderCommand_uniformBlockBinding uniformBlockBinding;
-	RenderCommand_drawElementsBaseVertex drawElementsBaseVertex;
-	RenderCommand_drawRangeElementsBaseVertex drawRangeElementsBaseVertex;
-	RenderCommand_drawElementsInstancedBaseVertex drawElementsInstancedBaseVertex;
-	RenderCommand_multiDrawElementsBaseVertex multiDrawElementsBaseVertex;
-	RenderCommand_provokingVertex provokingVertex;
-	RenderCommand_fenceSync fenceSync;
-	RenderCommand_isSync isSync;
-	RenderCommand_deleteSync deleteSync;
-	RenderCommand_clientWaitSync clientWaitSync;
-	RenderCommand_waitSync waitSync;
-	RenderCommand_getInteger64v getInteger64v;
-	RenderCommand_getSynciv getSynciv;
-	RenderCommand_getInteger64i_v getInteger64i_v;
-	RenderCommand_getBufferParameteri64v getBufferParameteri64v;
-	RenderCommand_framebufferTexture framebufferTexture;
-	RenderCommand_texImage2DMultisample texImage2DMultisample;
-	RenderCommand_texImage3DMultisample texImage3DMultisample;
-	RenderCommand_getMultisamplefv getMultisamplefv;
-	RenderCommand_sampleMaski sampleMaski;
-	RenderCommand_bindFragDataLocationIndexed bindFragDataLocationIndexed;
-	RenderCommand_getFragDataIndex getFragDataIndex;
-	RenderCommand_genSamplers genSamplers;
-	RenderCommand_deleteSamplers deleteSamplers;
-	RenderCommand_isSampler isSampler;
-	RenderCommand_bindSampler bindSampler;
-	RenderCommand_samplerParameteri samplerParameteri;
-	RenderCommand_samplerParameteriv samplerParameteriv;
-	RenderCommand_samplerParameterf samplerParameterf;
-	RenderCommand_samplerParameterfv samplerParameterfv;
-	RenderCommand_samplerParameterIiv samplerParameterIiv;
-	RenderCommand_samplerParameterIuiv samplerParameterIuiv;
-	RenderCommand_getSamplerParameteriv getSamplerParameteriv;
-	RenderCommand_getSamplerParameterIiv getSamplerParameterIiv;
-	RenderCommand_getSamplerParameterfv getSamplerParameterfv;
-	RenderCommand_getSamplerParameterIuiv getSamplerParameterIuiv;
-	RenderCommand_queryCounter queryCounter;
-	RenderCommand_getQueryObjecti64v getQueryObjecti64v;
-	RenderCommand_getQueryObjectui64v getQueryObjectui64v;
-	RenderCommand_vertexAttribDivisor vertexAttribDivisor;
-	RenderCommand_vertexAttribP1ui vertexAttribP1ui;
-	RenderCommand_vertexAttribP1uiv vertexAttribP1uiv;
-	RenderCommand_vertexAttribP2ui vertexAttribP2ui;
-	RenderCommand_vertexAttribP2uiv vertexAttribP2uiv;
-	RenderCommand_vertexAttribP3ui vertexAttribP3ui;
-	RenderCommand_vertexAttribP3uiv vertexAttribP3uiv;
-	RenderCommand_vertexAttribP4ui vertexAttribP4ui;
-	RenderCommand_vertexAttribP4uiv vertexAttribP4uiv;
-	RenderCommand_minSampleShading minSampleShading;
-	RenderCommand_blendEquationi blendEquationi;
-	RenderCommand_blendEquationSeparatei blendEquationSeparatei;
-	RenderCommand_blendFunci blendFunci;
-	RenderCommand_blendFuncSeparatei blendFuncSeparatei;
-	RenderCommand_drawArraysIndirect drawArraysIndirect;
-	RenderCommand_drawElementsIndirect drawElementsIndirect;
-	RenderCommand_uniform1d uniform1d;
-	RenderCommand_uniform2d uniform2d;
-	RenderCommand_uniform3d uniform3d;
-	RenderCommand_uniform4d uniform4d;
-	RenderCommand_uniform1dv uniform1dv;
-	RenderCommand_uniform2dv uniform2dv;
-	RenderCommand_uniform3dv uniform3dv;
-	RenderCommand_uniform4dv uniform4dv;
-	RenderCommand_uniformMatrix2dv uniformMatrix2dv;
-	RenderCommand_uniformMatrix3dv uniformMatrix3dv;
-	RenderCommand_uniformMatrix4dv uniformMatrix4dv;
-	RenderCommand_uniformMatrix2x3dv uniformMatrix2x3dv;
-	RenderCommand_uniformMatrix2x4dv uniformMatrix2x4dv;
-	RenderCommand_uniformMatrix3x2dv uniformMatrix3x2dv;
-	RenderCommand_uniformMatrix3x4dv uniformMatrix3x4dv;
-	RenderCommand_uniformMatrix4x2dv uniformMatrix4x2dv;
-	RenderCommand_uniformMatrix4x3dv uniformMatrix4x3dv;
-	RenderCommand_getUniformdv getUniformdv;
-	RenderCommand_getSubroutineUniformLocation getSubroutineUniformLocation;
-	RenderCommand_getSubroutineIndex getSubroutineIndex;
-	RenderCommand_getActiveSubroutineUniformiv getActiveSubroutineUniformiv;
-	RenderCommand_getActiveSubroutineUniformName getActiveSubroutineUniformName;
-	RenderCommand_getActiveSubroutineName getActiveSubroutineName;
-	RenderCommand_uniformSubroutinesuiv uniformSubroutinesuiv;
-	RenderCommand_getUniformSubroutineuiv getUniformSubroutineuiv;
-	RenderCommand_getProgramStageiv getProgramStageiv;
-	RenderCommand_patchParameteri patchParameteri;
-	RenderCommand_patchParameterfv patchParameterfv;
-	RenderCommand_bindTransformFeedback bindTransformFeedback;
-	RenderCommand_deleteTransformFeedbacks deleteTransformFeedbacks;
-	RenderCommand_genTransformFeedbacks genTransformFeedbacks;
-	RenderCommand_isTransformFeedback isTransformFeedback;
-	RenderCommand_pauseTransformFeedback pauseTransformFeedback;
-	RenderCommand_resumeTransformFeedback resumeTransformFeedback;
-	RenderCommand_drawTransformFeedback drawTransformFeedback;
-	RenderCommand_drawTransformFeedbackStream drawTransformFeedbackStream;
-	RenderCommand_beginQueryIndexed beginQueryIndexed;
-	RenderCommand_endQueryIndexed endQueryIndexed;
-	RenderCommand_getQueryIndexediv getQueryIndexediv;
-	RenderCommand_releaseShaderCompiler releaseShaderCompiler;
-	RenderCommand_shaderBinary shaderBinary;
-	RenderCommand_getShaderPrecisionFormat getShaderPrecisionFormat;
-	RenderCommand_depthRangef depthRangef;
-	RenderCommand_clearDepthf clearDepthf;
-	RenderCommand_getProgramBinary getProgramBinary;
-	RenderCommand_programBinary programBinary;
-	RenderCommand_programParameteri programParameteri;
-	RenderCommand_useProgramStages useProgramStages;
-	RenderCommand_activeShaderProgram activeShaderProgram;
-	RenderCommand_createShaderProgramv createShaderProgramv;
-	RenderCommand_bindProgramPipeline bindProgramPipeline;
-	RenderCommand_deleteProgramPipelines deleteProgramPipelines;
-	RenderCommand_genProgramPipelines genProgramPipelines;
-	RenderCommand_isProgramPipeline isProgramPipeline;
-	RenderCommand_getProgramPipelineiv getProgramPipelineiv;
-	RenderCommand_programUniform1i programUniform1i;
-	RenderCommand_programUniform1iv programUniform1iv;
-	RenderCommand_programUniform1f programUniform1f;
-	RenderCommand_programUniform1fv programUniform1fv;
-	RenderCommand_programUniform1d programUniform1d;
-	RenderCommand_programUniform1dv programUniform1dv;
-	RenderCommand_programUniform1ui programUniform1ui;
-	RenderCommand_programUniform1uiv programUniform1uiv;
-	RenderCommand_programUniform2i programUniform2i;
-	RenderCommand_programUniform2iv programUniform2iv;
-	RenderCommand_programUniform2f programUniform2f;
-	RenderCommand_programUniform2fv programUniform2fv;
-	RenderCommand_programUniform2d programUniform2d;
-	RenderCommand_programUniform2dv programUniform2dv;
-	RenderCommand_programUniform2ui programUniform2ui;
-	RenderCommand_programUniform2uiv programUniform2uiv;
-	RenderCommand_programUniform3i programUniform3i;
-	RenderCommand_programUniform3iv programUniform3iv;
-	RenderCommand_programUniform3f programUniform3f;
-	RenderCommand_programUniform3fv programUniform3fv;
-	RenderCommand_programUniform3d programUniform3d;
-	RenderCommand_programUniform3dv programUniform3dv;
-	RenderCommand_programUniform3ui programUniform3ui;
-	RenderCommand_programUniform3uiv programUniform3uiv;
-	RenderCommand_programUniform4i programUniform4i;
-	RenderCommand_programUniform4iv programUniform4iv;
-	RenderCommand_programUniform4f programUniform4f;
-	RenderCommand_programUniform4fv programUniform4fv;
-	RenderCommand_programUniform4d programUniform4d;
-	RenderCommand_programUniform4dv programUniform4dv;
-	RenderCommand_programUniform4ui programUniform4ui;
-	RenderCommand_programUniform4uiv programUniform4uiv;
-	RenderCommand_programUniformMatrix2fv programUniformMatrix2fv;
-	RenderCommand_programUniformMatrix3fv programUniformMatrix3fv;
-	RenderCommand_programUniformMatrix4fv programUniformMatrix4fv;
-	RenderCommand_programUniformMatrix2dv programUniformMatrix2dv;
-	RenderCommand_programUniformMatrix3dv programUniformMatrix3dv;
-	RenderCommand_programUniformMatrix4dv programUniformMatrix4dv;
-	RenderCommand_programUniformMatrix2x3fv programUniformMatrix2x3fv;
-	RenderCommand_programUniformMatrix3x2fv programUniformMatrix3x2fv;
-	RenderCommand_programUniformMatrix2x4fv programUniformMatrix2x4fv;
-	RenderCommand_programUniformMatrix4x2fv programUniformMatrix4x2fv;
-	RenderCommand_programUniformMatrix3x4fv programUniformMatrix3x4fv;
-	RenderCommand_programUniformMatrix4x3fv programUniformMatrix4x3fv;
-	RenderCommand_programUniformMatrix2x3dv programUniformMatrix2x3dv;
-	RenderCommand_programUniformMatrix3x2dv programUniformMatrix3x2dv;
-	RenderCommand_programUniformMatrix2x4dv programUniformMatrix2x4dv;
-	RenderCommand_programUniformMatrix4x2dv programUniformMatrix4x2dv;
-	RenderCommand_programUniformMatrix3x4dv programUniformMatrix3x4dv;
-	RenderCommand_programUniformMatrix4x3dv programUniformMatrix4x3dv;
-	RenderCommand_validateProgramPipeline validateProgramPipeline;
-	RenderCommand_getProgramPipelineInfoLog getProgramPipelineInfoLog;
-	RenderCommand_vertexAttribL1d vertexAttribL1d;
-	RenderCommand_vertexAttribL2d vertexAttribL2d;
-	RenderCommand_vertexAttribL3d vertexAttribL3d;
-	RenderCommand_vertexAttribL4d vertexAttribL4d;
-	RenderCommand_vertexAttribL1dv vertexAttribL1dv;
-	RenderCommand_vertexAttribL2dv vertexAttribL2dv;
-	RenderCommand_vertexAttribL3dv vertexAttribL3dv;
-	RenderCommand_vertexAttribL4dv vertexAttribL4dv;
-	RenderCommand_vertexAttribLPointer vertexAttribLPointer;
-	RenderCommand_getVertexAttribLdv getVertexAttribLdv;
-	RenderCommand_viewportArrayv viewportArrayv;
-	RenderCommand_viewportIndexedf viewportIndexedf;
-	RenderCommand_viewportIndexedfv viewportIndexedfv;
-	RenderCommand_scissorArrayv scissorArrayv;
-	RenderCommand_scissorIndexed scissorIndexed;
-	RenderCommand_scissorIndexedv scissorIndexedv;
-	RenderCommand_depthRangeArrayv depthRangeArrayv;
-	RenderCommand_depthRangeIndexed depthRangeIndexed;
-	RenderCommand_getFloati_v getFloati_v;
-	RenderCommand_getDoublei_v getDoublei_v;
-	RenderCommand_drawArraysInstancedBaseInstance drawArraysInstancedBaseInstance;
-	RenderCommand_drawElementsInstancedBaseInstance drawElementsInstancedBaseInstance;
-	RenderCommand_drawElementsInstancedBaseVertexBaseInstance drawElementsInstancedBaseVertexBaseInstance;
-	RenderCommand_getInternalformativ getInternalformativ;
-	RenderCommand_getActiveAtomicCounterBufferiv getActiveAtomicCounterBufferiv;
-	RenderCommand_bindImageTexture bindImageTexture;
-	RenderCommand_memoryBarrier memoryBarrier;
-	RenderCommand_texStorage1D texStorage1D;
-	RenderCommand_texStorage2D texStorage2D;
-	RenderCommand_texStorage3D texStorage3D;
-	RenderCommand_drawTransformFeedbackInstanced drawTransformFeedbackInstanced;
-	RenderCommand_drawTransformFeedbackStreamInstanced drawTransformFeedbackStreamInstanced;
-	RenderCommand_clearBufferData clearBufferData;
-	RenderCommand_clearBufferSubData clearBufferSubData;
-	RenderCommand_dispatchCompute dispatchCompute;
-	RenderCommand_dispatchComputeIndirect dispatchComputeIndirect;
-	RenderCommand_copyImageSubData copyImageSubData;
-	RenderCommand_framebufferParameteri framebufferParameteri;
-	RenderCommand_getFramebufferParameteriv getFramebufferParameteriv;
-	RenderCommand_getInternalformati64v getInternalformati64v;
-	RenderCommand_invalidateTexSubImage invalidateTexSubImage;
-	RenderCommand_invalidateTexImage invalidateTexImage;
-	RenderCommand_invalidateBufferSubData invalidateBufferSubData;
-	RenderCommand_invalidateBufferData invalidateBufferData;
-	RenderCommand_invalidateFramebuffer invalidateFramebuffer;
-	RenderCommand_invalidateSubFramebuffer invalidateSubFramebuffer;
-	RenderCommand_multiDrawArraysIndirect multiDrawArraysIndirect;
-	RenderCommand_multiDrawElementsIndirect multiDrawElementsIndirect;
-	RenderCommand_getProgramInterfaceiv getProgramInterfaceiv;
-	RenderCommand_getProgramResourceIndex getProgramResourceIndex;
-	RenderCommand_getProgramResourceName getProgramResourceName;
-	RenderCommand_getProgramResourceiv getProgramResourceiv;
-	RenderCommand_getProgramResourceLocation getProgramResourceLocation;
-	RenderCommand_getProgramResourceLocationIndex getProgramResourceLocationIndex;
-	RenderCommand_shaderStorageBlockBinding shaderStorageBlockBinding;
-	RenderCommand_texBufferRange texBufferRange;
-	RenderCommand_texStorage2DMultisample texStorage2DMultisample;
-	RenderCommand_texStorage3DMultisample texStorage3DMultisample;
-	RenderCommand_textureView textureView;
-	RenderCommand_bindVertexBuffer bindVertexBuffer;
-	RenderCommand_vertexAttribFormat vertexAttribFormat;
-	RenderCommand_vertexAttribIFormat vertexAttribIFormat;
-	RenderCommand_vertexAttribLFormat vertexAttribLFormat;
-	RenderCommand_vertexAttribBinding vertexAttribBinding;
-	RenderCommand_vertexBindingDivisor vertexBindingDivisor;
-	RenderCommand_debugMessageControl debugMessageControl;
-	RenderCommand_debugMessageInsert debugMessageInsert;
-	RenderCommand_debugMessageCallback debugMessageCallback;
-	RenderCommand_getDebugMessageLog getDebugMessageLog;
-	RenderCommand_pushDebugGroup pushDebugGroup;
-	RenderCommand_popDebugGroup popDebugGroup;
-	RenderCommand_objectLabel objectLabel;
-	RenderCommand_getObjectLabel getObjectLabel;
-	RenderCommand_objectPtrLabel objectPtrLabel;
-	RenderCommand_getObjectPtrLabel getObjectPtrLabel;
-	RenderCommand_bufferStorage bufferStorage;
-	RenderCommand_clearTexImage clearTexImage;
-	RenderCommand_clearTexSubImage clearTexSubImage;
-	RenderCommand_bindBuffersBase bindBuffersBase;
-	RenderCommand_bindBuffersRange bindBuffersRange;
-	RenderCommand_bindTextures bindTextures;
-	RenderCommand_bindSamplers bindSamplers;
-	RenderCommand_bindImageTextures bindImageTextures;
-	RenderCommand_bindVertexBuffers bindVertexBuffers;
-	RenderCommand_clipControl clipControl;
-	RenderCommand_createTransformFeedbacks createTransformFeedbacks;
-	RenderCommand_transformFeedbackBufferBase transformFeedbackBufferBase;
-	RenderCommand_transformFeedbackBufferRange transformFeedbackBufferRange;
-	RenderCommand_getTransformFeedbackiv getTransformFeedbackiv;
-	RenderCommand_getTransformFeedbacki_v getTransformFeedbacki_v;
-	RenderCommand_getTransformFeedbacki64_v getTransformFeedbacki64_v;
-	RenderCommand_createBuffers createBuffers;
-	RenderCommand_namedBufferStorage namedBufferStorage;
-	RenderCommand_namedBufferData namedBufferData;
-	RenderCommand_namedBufferSubData namedBufferSubData;
-	RenderCommand_copyNamedBufferSubData copyNamedBufferSubData;
-	RenderCommand_clearNamedBufferData clearNamedBufferData;
-	RenderCommand_clearNamedBufferSubData clearNamedBufferSubData;
-	RenderCommand_mapNamedBuffer mapNamedBuffer;
-	RenderCommand_mapNamedBufferRange mapNamedBufferRange;
-	RenderCommand_unmapNamedBuffer unmapNamedBuffer;
-	RenderCommand_flushMappedNamedBufferRange flushMappedNamedBufferRange;
-	RenderCommand_getNamedBufferParameteriv getNamedBufferParameteriv;
-	RenderCommand_getNamedBufferParameteri64v getNamedBufferParameteri64v;
-	RenderCommand_getNamedBufferPointerv getNamedBufferPointerv;
-	RenderCommand_getNamedBufferSubData getNamedBufferSubData;
-	RenderCommand_createFramebuffers createFramebuffers;
-	RenderCommand_namedFramebufferRenderbuffer namedFramebufferRenderbuffer;
-	RenderCommand_namedFramebufferParameteri namedFramebufferParameteri;
-	RenderCommand_namedFramebufferTexture namedFramebufferTexture;
-	RenderCommand_namedFramebufferTextureLayer namedFramebufferTextureLayer;
-	RenderCommand_namedFramebufferDrawBuffer namedFramebufferDrawBuffer;
-	RenderCommand_namedFramebufferDrawBuffers namedFramebufferDrawBuffers;
-	RenderCommand_namedFramebufferReadBuffer namedFramebufferReadBuffer;
-	RenderCommand_invalidateNamedFramebufferData invalidateNamedFramebufferData;
-	RenderCommand_invalidateNamedFramebufferSubData invalidateNamedFramebufferSubData;
-	RenderCommand_clearNamedFramebufferiv clearNamedFramebufferiv;
-	RenderCommand_clearNamedFramebufferuiv clearNamedFramebufferuiv;
-	RenderCommand_clearNamedFramebufferfv clearNamedFramebufferfv;
-	RenderCommand_clearNamedFramebufferfi clearNamedFramebufferfi;
-	RenderCommand_blitNamedFramebuffer blitNamedFramebuffer;
-	RenderCommand_checkNamedFramebufferStatus checkNamedFramebufferStatus;
-	RenderCommand_getNamedFramebufferParameteriv getNamedFramebufferParameteriv;
-	RenderCommand_getNamedFramebufferAttachmentParameteriv getNamedFramebufferAttachmentParameteriv;
-	RenderCommand_createRenderbuffers createRenderbuffers;
-	RenderCommand_namedRenderbufferStorage namedRenderbufferStorage;
-	RenderCommand_namedRenderbufferStorageMultisample namedRenderbufferStorageMultisample;
-	RenderCommand_getNamedRenderbufferParameteriv getNamedRenderbufferParameteriv;
-	RenderCommand_createTextures createTextures;
-	RenderCommand_textureBuffer textureBuffer;
-	RenderCommand_textureBufferRange textureBufferRange;
-	RenderCommand_textureStorage1D textureStorage1D;
-	RenderCommand_textureStorage2D textureStorage2D;
-	RenderCommand_textureStorage3D textureStorage3D;
-	RenderCommand_textureStorage2DMultisample textureStorage2DMultisample;
-	RenderCommand_textureStorage3DMultisample textureStorage3DMultisample;
-	RenderCommand_textureSubImage1D textureSubImage1D;
-	RenderCommand_textureSubImage2D textureSubImage2D;
-	RenderCommand_textureSubImage3D textureSubImage3D;
-	RenderCommand_compressedTextureSubImage1D compressedTextureSubImage1D;
-	RenderCommand_compressedTextureSubImage2D compressedTextureSubImage2D;
-	RenderCommand_compressedTextureSubImage3D compressedTextureSubImage3D;
-	RenderCommand_copyTextureSubImage1D copyTextureSubImage1D;
-	RenderCommand_copyTextureSubImage2D copyTextureSubImage2D;
-	RenderCommand_copyTextureSubImage3D copyTextureSubImage3D;
-	RenderCommand_textureParameterf textureParameterf;
-	RenderCommand_textureParameterfv textureParameterfv;
-	RenderCommand_textureParameteri textureParameteri;
-	RenderCommand_textureParameterIiv textureParameterIiv;
-	RenderCommand_textureParameterIuiv textureParameterIuiv;
-	RenderCommand_textureParameteriv textureParameteriv;
-	RenderCommand_generateTextureMipmap generateTextureMipmap;
-	RenderCommand_bindTextureUnit bindTextureUnit;
-	RenderCommand_getTextureImage getTextureImage;
-	RenderCommand_getCompressedTextureImage getCompressedTextureImage;
-	RenderCommand_getTextureLevelParameterfv getTextureLevelParameterfv;
-	RenderCommand_getTextureLevelParameteriv getTextureLevelParameteriv;
-	RenderCommand_getTextureParameterfv getTextureParameterfv;
-	RenderCommand_getTextureParameterIiv getTextureParameterIiv;
-	RenderCommand_getTextureParameterIuiv getTextureParameterIuiv;
-	RenderCommand_getTextureParameteriv getTextureParameteriv;
-	RenderCommand_createVertexArrays createVertexArrays;
-	RenderCommand_disableVertexArrayAttrib disableVertexArrayAttrib;
-	RenderCommand_enableVertexArrayAttrib enableVertexArrayAttrib;
-	RenderCommand_vertexArrayElementBuffer vertexArrayElementBuffer;
-	RenderCommand_vertexArrayVertexBuffer vertexArrayVertexBuffer;
-	RenderCommand_vertexArrayVertexBuffers vertexArrayVertexBuffers;
-	RenderCommand_vertexArrayAttribBinding vertexArrayAttribBinding;
-	RenderCommand_vertexArrayAttribFormat vertexArrayAttribFormat;
-	RenderCommand_vertexArrayAttribIFormat vertexArrayAttribIFormat;
-	RenderCommand_vertexArrayAttribLFormat vertexArrayAttribLFormat;
-	RenderCommand_vertexArrayBindingDivisor vertexArrayBindingDivisor;
-	RenderCommand_getVertexArrayiv getVertexArrayiv;
-	RenderCommand_getVertexArrayIndexediv getVertexArrayIndexediv;
-	RenderCommand_getVertexArrayIndexed64iv getVertexArrayIndexed64iv;
-	RenderCommand_createSamplers createSamplers;
-	RenderCommand_createProgramPipelines createProgramPipelines;
-	RenderCommand_createQueries createQueries;
-	RenderCommand_getQueryBufferObjecti64v getQueryBufferObjecti64v;
-	RenderCommand_getQueryBufferObjectiv getQueryBufferObjectiv;
-	RenderCommand_getQueryBufferObjectui64v getQueryBufferObjectui64v;
-	RenderCommand_getQueryBufferObjectuiv getQueryBufferObjectuiv;
-	RenderCommand_memoryBarrierByRegion memoryBarrierByRegion;
-	RenderCommand_getTextureSubImage getTextureSubImage;
-	RenderCommand_getCompressedTextureSubImage getCompressedTextureSubImage;
-	RenderCommand_getGraphicsResetStatus getGraphicsResetStatus;
-	RenderCommand_getnCompressedTexImage getnCompressedTexImage;
-	RenderCommand_getnTexImage getnTexImage;
-	RenderCommand_getnUniformdv getnUniformdv;
-	RenderCommand_getnUniformfv getnUniformfv;
-	RenderCommand_getnUniformiv getnUniformiv;
-	RenderCommand_getnUniformuiv getnUniformuiv;
-	RenderCommand_readnPixels readnPixels;
-	RenderCommand_textureBarrier textureBarrier;
-	RenderCommand_specializeShader specializeShader;
-	RenderCommand_multiDrawArraysIndirectCount multiDrawArraysIndirectCount;
-	RenderCommand_multiDrawElementsIndirectCount multiDrawElementsIndirectCount;
-	RenderCommand_polygonOffsetClamp polygonOffsetClamp;
-	RenderCommand_primitiveBoundingBoxARB primitiveBoundingBoxARB;
-	RenderCommand_getTextureHandleARB getTextureHandleARB;
-	RenderCommand_getTextureSamplerHandleARB getTextureSamplerHandleARB;
-	RenderCommand_makeTextureHandleResidentARB makeTextureHandleResidentARB;
-	RenderCommand_makeTextureHandleNonResidentARB makeTextureHandleNonResidentARB;
-	RenderCommand_getImageHandleARB getImageHandleARB;
-	RenderCommand_makeImageHandleResidentARB makeImageHandleResidentARB;
-	RenderCommand_makeImageHandleNonResidentARB makeImageHandleNonResidentARB;
-	RenderCommand_uniformHandleui64ARB uniformHandleui64ARB;
-	RenderCommand_uniformHandleui64vARB uniformHandleui64vARB;
-	RenderCommand_programUniformHandleui64ARB programUniformHandleui64ARB;
-	RenderCommand_programUniformHandleui64vARB programUniformHandleui64vARB;
-	RenderCommand_isTextureHandleResidentARB isTextureHandleResidentARB;
-	RenderCommand_isImageHandleResidentARB isImageHandleResidentARB;
-	RenderCommand_vertexAttribL1ui64ARB vertexAttribL1ui64ARB;
-	RenderCommand_vertexAttribL1ui64vARB vertexAttribL1ui64vARB;
-	RenderCommand_getVertexAttribLui64vARB getVertexAttribLui64vARB;
-	RenderCommand_createSyncFromCLeventARB createSyncFromCLeventARB;
-	RenderCommand_dispatchComputeGroupSizeARB dispatchComputeGroupSizeARB;
-	RenderCommand_debugMessageControlARB debugMessageControlARB;
-	RenderCommand_debugMessageInsertARB debugMessageInsertARB;
-	RenderCommand_debugMessageCallbackARB debugMessageCallbackARB;
-	RenderCommand_getDebugMessageLogARB getDebugMessageLogARB;
-	RenderCommand_blendEquationiARB blendEquationiARB;
-	RenderCommand_blendEquationSeparateiARB blendEquationSeparateiARB;
-	RenderCommand_blendFunciARB blendFunciARB;
-	RenderCommand_blendFuncSeparateiARB blendFuncSeparateiARB;
-	RenderCommand_drawArraysInstancedARB drawArraysInstancedARB;
-	RenderCommand_drawElementsInstancedARB drawElementsInstancedARB;
-	RenderCommand_programParameteriARB programParameteriARB;
-	RenderCommand_framebufferTextureARB framebufferTextureARB;
-	RenderCommand_framebufferTextureLayerARB framebufferTextureLayerARB;
-	RenderCommand_framebufferTextureFaceARB framebufferTextureFaceARB;
-	RenderCommand_specializeShaderARB specializeShaderARB;
-	RenderCommand_uniform1i64ARB uniform1i64ARB;
-	RenderCommand_uniform2i64ARB uniform2i64ARB;
-	RenderCommand_uniform3i64ARB uniform3i64ARB;
-	RenderCommand_uniform4i64ARB uniform4i64ARB;
-	RenderCommand_uniform1i64vARB uniform1i64vARB;
-	RenderCommand_uniform2i64vARB uniform2i64vARB;
-	RenderCommand_uniform3i64vARB uniform3i64vARB;
-	RenderCommand_uniform4i64vARB uniform4i64vARB;
-	RenderCommand_uniform1ui64ARB uniform1ui64ARB;
-	RenderCommand_uniform2ui64ARB uniform2ui64ARB;
-	RenderCommand_uniform3ui64ARB uniform3ui64ARB;
-	RenderCommand_uniform4ui64ARB uniform4ui64ARB;
-	RenderCommand_uniform1ui64vARB uniform1ui64vARB;
-	RenderCommand_uniform2ui64vARB uniform2ui64vARB;
-	RenderCommand_uniform3ui64vARB uniform3ui64vARB;
-	RenderCommand_uniform4ui64vARB uniform4ui64vARB;
-	RenderCommand_getUniformi64vARB getUniformi64vARB;
-	RenderCommand_getUniformui64vARB getUniformui64vARB;
-	RenderCommand_getnUniformi64vARB getnUniformi64vARB;
-	RenderCommand_getnUniformui64vARB getnUniformui64vARB;
-	RenderCommand_programUniform1i64ARB programUniform1i64ARB;
-	RenderCommand_programUniform2i64ARB programUniform2i64ARB;
-	RenderCommand_programUniform3i64ARB programUniform3i64ARB;
-	RenderCommand_programUniform4i64ARB programUniform4i64ARB;
-	RenderCommand_programUniform1i64vARB programUniform1i64vARB;
-	RenderCommand_programUniform2i64vARB programUniform2i64vARB;
-	RenderCommand_programUniform3i64vARB programUniform3i64vARB;
-	RenderCommand_programUniform4i64vARB programUniform4i64vARB;
-	RenderCommand_programUniform1ui64ARB programUniform1ui64ARB;
-	RenderCommand_programUniform2ui64ARB programUniform2ui64ARB;
-	RenderCommand_programUniform3ui64ARB programUniform3ui64ARB;
-	RenderCommand_programUniform4ui64ARB programUniform4ui64ARB;
-	RenderCommand_programUniform1ui64vARB programUniform1ui64vARB;
-	RenderCommand_programUniform2ui64vARB programUniform2ui64vARB;
-	RenderCommand_programUniform3ui64vARB programUniform3ui64vARB;
-	RenderCommand_programUniform4ui64vARB programUniform4ui64vARB;
-	RenderCommand_multiDrawArraysIndirectCountARB multiDrawArraysIndirectCountARB;
-	RenderCommand_multiDrawElementsIndirectCountARB multiDrawElementsIndirectCountARB;
-	RenderCommand_vertexAttribDivisorARB vertexAttribDivisorARB;
-	RenderCommand_maxShaderCompilerThreadsARB maxShaderCompilerThreadsARB;
-	RenderCommand_getGraphicsResetStatusARB getGraphicsResetStatusARB;
-	RenderCommand_getnTexImageARB getnTexImageARB;
-	RenderCommand_readnPixelsARB readnPixelsARB;
-	RenderCommand_getnCompressedTexImageARB getnCompressedTexImageARB;
-	RenderCommand_getnUniformfvARB getnUniformfvARB;
-	RenderCommand_getnUniformivARB getnUniformivARB;
-	RenderCommand_getnUniformuivARB getnUniformuivARB;
-	RenderCommand_getnUniformdvARB getnUniformdvARB;
-	RenderCommand_framebufferSampleLocationsfvARB framebufferSampleLocationsfvARB;
-	RenderCommand_namedFramebufferSampleLocationsfvARB namedFramebufferSampleLocationsfvARB;
-	RenderCommand_evaluateDepthValuesARB evaluateDepthValuesARB;
-	RenderCommand_minSampleShadingARB minSampleShadingARB;
-	RenderCommand_namedStringARB namedStringARB;
-	RenderCommand_deleteNamedStringARB deleteNamedStringARB;
-	RenderCommand_compileShaderIncludeARB compileShaderIncludeARB;
-	RenderCommand_isNamedStringARB isNamedStringARB;
-	RenderCommand_getNamedStringARB getNamedStringARB;
-	RenderCommand_getNamedStringivARB getNamedStringivARB;
-	RenderCommand_bufferPageCommitmentARB bufferPageCommitmentARB;
-	RenderCommand_namedBufferPageCommitmentEXT namedBufferPageCommitmentEXT;
-	RenderCommand_namedBufferPageCommitmentARB namedBufferPageCommitmentARB;
-	RenderCommand_texPageCommitmentARB texPageCommitmentARB;
-	RenderCommand_texBufferARB texBufferARB;
-	RenderCommand_blendBarrierKHR blendBarrierKHR;
-	RenderCommand_maxShaderCompilerThreadsKHR maxShaderCompilerThreadsKHR;
-	RenderCommand_renderbufferStorageMultisampleAdvancedAMD renderbufferStorageMultisampleAdvancedAMD;
-	RenderCommand_namedRenderbufferStorageMultisampleAdvancedAMD namedRenderbufferStorageMultisampleAdvancedAMD;
-	RenderCommand_getPerfMonitorGroupsAMD getPerfMonitorGroupsAMD;
-	RenderCommand_getPerfMonitorCountersAMD getPerfMonitorCountersAMD;
-	RenderCommand_getPerfMonitorGroupStringAMD getPerfMonitorGroupStringAMD;
-	RenderCommand_getPerfMonitorCounterStringAMD getPerfMonitorCounterStringAMD;
-	RenderCommand_getPerfMonitorCounterInfoAMD getPerfMonitorCounterInfoAMD;
-	RenderCommand_genPerfMonitorsAMD genPerfMonitorsAMD;
-	RenderCommand_deletePerfMonitorsAMD deletePerfMonitorsAMD;
-	RenderCommand_selectPerfMonitorCountersAMD selectPerfMonitorCountersAMD;
-	RenderCommand_beginPerfMonitorAMD beginPerfMonitorAMD;
-	RenderCommand_endPerfMonitorAMD endPerfMonitorAMD;
-	RenderCommand_getPerfMonitorCounterDataAMD getPerfMonitorCounterDataAMD;
-	RenderCommand_eGLImageTargetTexStorageEXT eGLImageTargetTexStorageEXT;
-	RenderCommand_eGLImageTargetTextureStorageEXT eGLImageTargetTextureStorageEXT;
-	RenderCommand_labelObjectEXT labelObjectEXT;
-	RenderCommand_getObjectLabelEXT getObjectLabelEXT;
-	RenderCommand_insertEventMarkerEXT insertEventMarkerEXT;
-	RenderCommand_pushGroupMarkerEXT pushGroupMarkerEXT;
-	RenderCommand_popGroupMarkerEXT popGroupMarkerEXT;
-	RenderCommand_matrixLoadfEXT matrixLoadfEXT;
-	RenderCommand_matrixLoaddEXT matrixLoaddEXT;
-	RenderCommand_matrixMultfEXT matrixMultfEXT;
-	RenderCommand_matrixMultdEXT matrixMultdEXT;
-	RenderCommand_matrixLoadIdentityEXT matrixLoadIdentityEXT;
-	RenderCommand_matrixRotatefEXT matrixRotatefEXT;
-	RenderCommand_matrixRotatedEXT matrixRotatedEXT;
-	RenderCommand_matrixScalefEXT matrixScalefEXT;
-	RenderCommand_matrixScaledEXT matrixScaledEXT;
-	RenderCommand_matrixTranslatefEXT matrixTranslatefEXT;
-	RenderCommand_matrixTranslatedEXT matrixTranslatedEXT;
-	RenderCommand_matrixFrustumEXT matrixFrustumEXT;
-	RenderCommand_matrixOrthoEXT matrixOrthoEXT;
-	RenderCommand_matrixPopEXT matrixPopEXT;
-	RenderCommand_matrixPushEXT matrixPushEXT;
-	RenderCommand_clientAttribDefaultEXT clientAttribDefaultEXT;
-	RenderCommand_pushClientAttribDefaultEXT pushClientAttribDefaultEXT;
-	RenderCommand_textureParameterfEXT textureParameterfEXT;
-	RenderCommand_textureParameterfvEXT textureParameterfvEXT;
-	RenderCommand_textureParameteriEXT textureParameteriEXT;
-	RenderCommand_textureParameterivEXT textureParameterivEXT;
-	RenderCommand_textureImage1DEXT textureImage1DEXT;
-	RenderCommand_textureImage2DEXT textureImage2DEXT;
-	RenderCommand_textureSubImage1DEXT textureSubImage1DEXT;
-	RenderCommand_textureSubImage2DEXT textureSubImage2DEXT;
-	RenderCommand_copyTextureImage1DEXT copyTextureImage1DEXT;
-	RenderCommand_copyTextureImage2DEXT copyTextureImage2DEXT;
-	RenderCommand_copyTextureSubImage1DEXT copyTextureSubImage1DEXT;
-	RenderCommand_copyTextureSubImage2DEXT copyTextureSubImage2DEXT;
-	RenderCommand_getTextureImageEXT getTextureImageEXT;
-	RenderCommand_getTextureParameterfvEXT getTextureParameterfvEXT;
-	RenderCommand_getTextureParameterivEXT getTextureParameterivEXT;
-	RenderCommand_getTextureLevelParameterfvEXT getTextureLevelParameterfvEXT;
-	RenderCommand_getTextureLevelParameterivEXT getTextureLevelParameterivEXT;
-	RenderCommand_textureImage3DEXT textureImage3DEXT;
-	RenderCommand_textureSubImage3DEXT textureSubImage3DEXT;
-	RenderCommand_copyTextureSubImage3DEXT copyTextureSubImage3DEXT;
-	RenderCommand_bindMultiTextureEXT bindMultiTextureEXT;
-	RenderCommand_multiTexCoordPointerEXT multiTexCoordPointerEXT;
-	RenderCommand_multiTexEnvfEXT multiTexEnvfEXT;
-	RenderCommand_multiTexEnvfvEXT multiTexEnvfvEXT;
-	RenderCommand_multiTexEnviEXT multiTexEnviEXT;
-	RenderCommand_multiTexEnvivEXT multiTexEnvivEXT;
-	RenderCommand_multiTexGendEXT multiTexGendEXT;
-	RenderCommand_multiTexGendvEXT multiTexGendvEXT;
-	RenderCommand_multiTexGenfEXT multiTexGenfEXT;
-	RenderCommand_multiTexGenfvEXT multiTexGenfvEXT;
-	RenderCommand_multiTexGeniEXT multiTexGeniEXT;
-	RenderCommand_multiTexGenivEXT multiTexGenivEXT;
-	RenderCommand_getMultiTexEnvfvEXT getMultiTexEnvfvEXT;
-	RenderCommand_getMultiTexEnvivEXT getMultiTexEnvivEXT;
-	RenderCommand_getMultiTexGendvEXT getMultiTexGendvEXT;
-	RenderCommand_getMultiTexGenfvEXT getMultiTexGenfvEXT;
-	RenderCommand_getMultiTexGenivEXT getMultiTexGenivEXT;
-	RenderCommand_multiTexParameteriEXT multiTexParameteriEXT;
-	RenderCommand_multiTexParameterivEXT multiTexParameterivEXT;
-	RenderCommand_multiTexParameterfEXT multiTexParameterfEXT;
-	RenderCommand_multiTexParameterfvEXT multiTexParameterfvEXT;
-	RenderCommand_multiTexImage1DEXT multiTexImage1DEXT;
-	RenderCommand_multiTexImage2DEXT multiTexImage2DEXT;
-	RenderCommand_multiTexSubImage1DEXT multiTexSubImage1DEXT;
-	RenderCommand_multiTexSubImage2DEXT multiTexSubImage2DEXT;
-	RenderCommand_copyMultiTexImage1DEXT copyMultiTexImage1DEXT;
-	RenderCommand_copyMultiTexImage2DEXT copyMultiTexImage2DEXT;
-	RenderCommand_copyMultiTexSubImage1DEXT copyMultiTexSubImage1DEXT;
-	RenderCommand_copyMultiTexSubImage2DEXT copyMultiTexSubImage2DEXT;
-	RenderCommand_getMultiTexImageEXT getMultiTexImageEXT;
-	RenderCommand_getMultiTexParameterfvEXT getMultiTexParameterfvEXT;
-	RenderCommand_getMultiTexParameterivEXT getMultiTexParameterivEXT;
-	RenderCommand_getMultiTexLevelParameterfvEXT getMultiTexLevelParameterfvEXT;
-	RenderCommand_getMultiTexLevelParameterivEXT getMultiTexLevelParameterivEXT;
-	RenderCommand_multiTexImage3DEXT multiTexImage3DEXT;
-	RenderCommand_multiTexSubImage3DEXT multiTexSubImage3DEXT;
-	RenderCommand_copyMultiTexSubImage3DEXT copyMultiTexSubImage3DEXT;
-	RenderCommand_enableClientStateIndexedEXT enableClientStateIndexedEXT;
-	RenderCommand_disableClientStateIndexedEXT disableClientStateIndexedEXT;
-	RenderCommand_getFloatIndexedvEXT getFloatIndexedvEXT;
-	RenderCommand_getDoubleIndexedvEXT getDoubleIndexedvEXT;
-	RenderCommand_getPointerIndexedvEXT getPointerIndexedvEXT;
-	RenderCommand_enableIndexedEXT enableIndexedEXT;
-	RenderCommand_disableIndexedEXT disableIndexedEXT;
-	RenderCommand_isEnabledIndexedEXT isEnabledIndexedEXT;
-	RenderCommand_getIntegerIndexedvEXT getIntegerIndexedvEXT;
-	RenderCommand_getBooleanIndexedvEXT getBooleanIndexedvEXT;
-	RenderCommand_compressedTextureImage3DEXT compressedTextureImage3DEXT;
-	RenderCommand_compressedTextureImage2DEXT compressedTextureImage2DEXT;
-	RenderCommand_compressedTextureImage1DEXT compressedTextureImage1DEXT;
-	RenderCommand_compressedTextureSubImage3DEXT compressedTextureSubImage3DEXT;
-	RenderCommand_compressedTextureSubImage2DEXT compressedTextureSubImage2DEXT;
-	RenderCommand_compressedTextureSubImage1DEXT compressedTextureSubImage1DEXT;
-	RenderCommand_getCompressedTextureImageEXT getCompressedTextureImageEXT;
-	RenderCommand_compressedMultiTexImage3DEXT compressedMultiTexImage3DEXT;
-	RenderCommand_compressedMultiTexImage2DEXT compressedMultiTexImage2DEXT;
-	RenderCommand_compressedMultiTexImage1DEXT compressedMultiTexImage1DEXT;
-	RenderCommand_compressedMultiTexSubImage3DEXT compressedMultiTexSubImage3DEXT;
-	RenderCommand_compressedMultiTexSubImage2DEXT compressedMultiTexSubImage2DEXT;
-	RenderCommand_compressedMultiTexSubImage1DEXT compressedMultiTexSubImage1DEXT;
-	RenderCommand_getCompressedMultiTexImageEXT getCompressedMultiTexImageEXT;
-	RenderCommand_matrixLoadTransposefEXT matrixLoadTransposefEXT;
-	RenderCommand_matrixLoadTransposedEXT matrixLoadTransposedEXT;
-	RenderCommand_matrixMultTransposefEXT matrixMultTransposefEXT;
-	RenderCommand_matrixMultTransposedEXT matrixMultTransposedEXT;
-	RenderCommand_namedBufferDataEXT namedBufferDataEXT;
-	RenderCommand_namedBufferSubDataEXT namedBufferSubDataEXT;
-	RenderCommand_mapNamedBufferEXT mapNamedBufferEXT;
-	RenderCommand_unmapNamedBufferEXT unmapNamedBufferEXT;
-	RenderCommand_getNamedBufferParameterivEXT getNamedBufferParameterivEXT;
-	RenderCommand_getNamedBufferPointervEXT getNamedBufferPointervEXT;
-	RenderCommand_getNamedBufferSubDataEXT getNamedBufferSubDataEXT;
-	RenderCommand_programUniform1fEXT programUniform1fEXT;
-	RenderCommand_programUniform2fEXT programUniform2fEXT;
-	RenderCommand_programUniform3fEXT programUniform3fEXT;
-	RenderCommand_programUniform4fEXT programUniform4fEXT;
-	RenderCommand_programUniform1iEXT programUniform1iEXT;
-	RenderCommand_programUniform2iEXT programUniform2iEXT;
-	RenderCommand_programUniform3iEXT programUniform3iEXT;
-	RenderCommand_programUniform4iEXT programUniform4iEXT;
-	RenderCommand_programUniform1fvEXT programUniform1fvEXT;
-	RenderCommand_programUniform2fvEXT programUniform2fvEXT;
-	RenderCommand_programUniform3fvEXT programUniform3fvEXT;
-	RenderCommand_programUniform4fvEXT programUniform4fvEXT;
-	RenderCommand_programUniform1ivEXT programUniform1ivEXT;
-	RenderCommand_programUniform2ivEXT programUniform2ivEXT;
-	RenderCommand_programUniform3ivEXT programUniform3ivEXT;
-	RenderCommand_programUniform4ivEXT programUniform4ivEXT;
-	RenderCommand_programUniformMatrix2fvEXT programUniformMatrix2fvEXT;
-	RenderCommand_programUniformMatrix3fvEXT programUniformMatrix3fvEXT;
-	RenderCommand_programUniformMatrix4fvEXT programUniformMatrix4fvEXT;
-	RenderCommand_programUniformMatrix2x3fvEXT programUniformMatrix2x3fvEXT;
-	RenderCommand_programUniformMatrix3x2fvEXT programUniformMatrix3x2fvEXT;
-	RenderCommand_programUniformMatrix2x4fvEXT programUniformMatrix2x4fvEXT;
-	RenderCommand_programUniformMatrix4x2fvEXT programUniformMatrix4x2fvEXT;
-	RenderCommand_programUniformMatrix3x4fvEXT programUniformMatrix3x4fvEXT;
-	RenderCommand_programUniformMatrix4x3fvEXT programUniformMatrix4x3fvEXT;
-	RenderCommand_textureBufferEXT textureBufferEXT;
-	RenderCommand_multiTexBufferEXT multiTexBufferEXT;
-	RenderCommand_textureParameterIivEXT textureParameterIivEXT;
-	RenderCommand_textureParameterIuivEXT textureParameterIuivEXT;
-	RenderCommand_getTextureParameterIivEXT getTextureParameterIivEXT;
-	RenderCommand_getTextureParameterIuivEXT getTextureParameterIuivEXT;
-	RenderCommand_multiTexParameterIivEXT multiTexParameterIivEXT;
-	RenderCommand_multiTexParameterIuivEXT multiTexParameterIuivEXT;
-	RenderCommand_getMultiTexParameterIivEXT getMultiTexParameterIivEXT;
-	RenderCommand_getMultiTexParameterIuivEXT getMultiTexParameterIuivEXT;
-	RenderCommand_programUniform1uiEXT programUniform1uiEXT;
-	RenderCommand_programUniform2uiEXT programUniform2uiEXT;
-	RenderCommand_programUniform3uiEXT programUniform3uiEXT;
-	RenderCommand_programUniform4uiEXT programUniform4uiEXT;
-	RenderCommand_programUniform1uivEXT programUniform1uivEXT;
-	RenderCommand_programUniform2uivEXT programUniform2uivEXT;
-	RenderCommand_programUniform3uivEXT programUniform3uivEXT;
-	RenderCommand_programUniform4uivEXT programUniform4uivEXT;
-	RenderCommand_namedProgramLocalParameters4fvEXT namedProgramLocalParameters4fvEXT;
-	RenderCommand_namedProgramLocalParameterI4iEXT namedProgramLocalParameterI4iEXT;
-	RenderCommand_namedProgramLocalParameterI4ivEXT namedProgramLocalParameterI4ivEXT;
-	RenderCommand_namedProgramLocalParametersI4ivEXT namedProgramLocalParametersI4ivEXT;
-	RenderCommand_namedProgramLocalParameterI4uiEXT namedProgramLocalParameterI4uiEXT;
-	RenderCommand_namedProgramLocalParameterI4uivEXT namedProgramLocalParameterI4uivEXT;
-	RenderCommand_namedProgramLocalParametersI4uivEXT namedProgramLocalParametersI4uivEXT;
-	RenderCommand_getNamedProgramLocalParameterIivEXT getNamedProgramLocalParameterIivEXT;
-	RenderCommand_getNamedProgramLocalParameterIuivEXT getNamedProgramLocalParameterIuivEXT;
-	RenderCommand_enableClientStateiEXT enableClientStateiEXT;
-	RenderCommand_disableClientStateiEXT disableClientStateiEXT;
-	RenderCommand_getFloati_vEXT getFloati_vEXT;
-	RenderCommand_getDoublei_vEXT getDoublei_vEXT;
-	RenderCommand_getPointeri_vEXT getPointeri_vEXT;
-	RenderCommand_namedProgramStringEXT namedProgramStringEXT;
-	RenderCommand_namedProgramLocalParameter4dEXT namedProgramLocalParameter4dEXT;
-	RenderCommand_namedProgramLocalParameter4dvEXT namedProgramLocalParameter4dvEXT;
-	RenderCommand_namedProgramLocalParameter4fEXT namedProgramLocalParameter4fEXT;
-	RenderCommand_namedProgramLocalParameter4fvEXT namedProgramLocalParameter4fvEXT;
-	RenderCommand_getNamedProgramLocalParameterdvEXT getNamedProgramLocalParameterdvEXT;
-	RenderCommand_getNamedProgramLocalParameterfvEXT getNamedProgramLocalParameterfvEXT;
-	RenderCommand_getNamedProgramivEXT getNamedProgramivEXT;
-	RenderCommand_getNamedProgramStringEXT getNamedProgramStringEXT;
-	RenderCommand_namedRenderbufferStorageEXT namedRenderbufferStorageEXT;
-	RenderCommand_getNamedRenderbufferParameterivEXT getNamedRenderbufferParameterivEXT;
-	RenderCommand_namedRenderbufferStorageMultisampleEXT namedRenderbufferStorageMultisampleEXT;
-	RenderCommand_namedRenderbufferStorageMultisampleCoverageEXT namedRenderbufferStorageMultisampleCoverageEXT;
-	RenderCommand_checkNamedFramebufferStatusEXT checkNamedFramebufferStatusEXT;
-	RenderCommand_namedFramebufferTexture1DEXT namedFramebufferTexture1DEXT;
-	RenderCommand_namedFramebufferTexture2DEXT namedFramebufferTexture2DEXT;
-	RenderCommand_namedFramebufferTexture3DEXT namedFramebufferTexture3DEXT;
-	RenderCommand_namedFramebufferRenderbufferEXT namedFramebufferRenderbufferEXT;
-	RenderCommand_getNamedFramebufferAttachmentParameterivEXT getNamedFramebufferAttachmentParameterivEXT;
-	RenderCommand_generateTextureMipmapEXT generateTextureMipmapEXT;
-	RenderCommand_generateMultiTexMipmapEXT generateMultiTexMipmapEXT;
-	RenderCommand_framebufferDrawBufferEXT framebufferDrawBufferEXT;
-	RenderCommand_framebufferDrawBuffersEXT framebufferDrawBuffersEXT;
-	RenderCommand_framebufferReadBufferEXT framebufferReadBufferEXT;
-	RenderCommand_getFramebufferParameterivEXT getFramebufferParameterivEXT;
-	RenderCommand_namedCopyBufferSubDataEXT namedCopyBufferSubDataEXT;
-	RenderCommand_namedFramebufferTextureEXT namedFramebufferTextureEXT;
-	RenderCommand_namedFramebufferTextureLayerEXT namedFramebufferTextureLayerEXT;
-	RenderCommand_namedFramebufferTextureFaceEXT namedFramebufferTextureFaceEXT;
-	RenderCommand_textureRenderbufferEXT textureRenderbufferEXT;
-	RenderCommand_multiTexRenderbufferEXT multiTexRenderbufferEXT;
-	RenderCommand_vertexArrayVertexOffsetEXT vertexArrayVertexOffsetEXT;
-	RenderCommand_vertexArrayColorOffsetEXT vertexArrayColorOffsetEXT;
-	RenderCommand_vertexArrayEdgeFlagOffsetEXT vertexArrayEdgeFlagOffsetEXT;
-	RenderCommand_vertexArrayIndexOffsetEXT vertexArrayIndexOffsetEXT;
-	RenderCommand_vertexArrayNormalOffsetEXT vertexArrayNormalOffsetEXT;
-	RenderCommand_vertexArrayTexCoordOffsetEXT vertexArrayTexCoordOffsetEXT;
-	RenderCommand_vertexArrayMultiTexCoordOffsetEXT vertexArrayMultiTexCoordOffsetEXT;
-	RenderCommand_vertexArrayFogCoordOffsetEXT vertexArrayFogCoordOffsetEXT;
-	RenderCommand_vertexArraySecondaryColorOffsetEXT vertexArraySecondaryColorOffsetEXT;
-	RenderCommand_vertexArrayVertexAttribOffsetEXT vertexArrayVertexAttribOffsetEXT;
-	RenderCommand_vertexArrayVertexAttribIOffsetEXT vertexArrayVertexAttribIOffsetEXT;
-	RenderCommand_enableVertexArrayEXT enableVertexArrayEXT;
-	RenderCommand_disableVertexArrayEXT disableVertexArrayEXT;
-	RenderCommand_enableVertexArrayAttribEXT enableVertexArrayAttribEXT;
-	RenderCommand_disableVertexArrayAttribEXT disableVertexArrayAttribEXT;
-	RenderCommand_getVertexArrayIntegervEXT getVertexArrayIntegervEXT;
-	RenderCommand_getVertexArrayPointervEXT getVertexArrayPointervEXT;
-	RenderCommand_getVertexArrayIntegeri_vEXT getVertexArrayIntegeri_vEXT;
-	RenderCommand_getVertexArrayPointeri_vEXT getVertexArrayPointeri_vEXT;
-	RenderCommand_mapNamedBufferRangeEXT mapNamedBufferRangeEXT;
-	RenderCommand_flushMappedNamedBufferRangeEXT flushMappedNamedBufferRangeEXT;
-	RenderCommand_namedBufferStorageEXT namedBufferStorageEXT;
-	RenderCommand_clearNamedBufferDataEXT clearNamedBufferDataEXT;
-	RenderCommand_clearNamedBufferSubDataEXT clearNamedBufferSubDataEXT;
-	RenderCommand_namedFramebufferParameteriEXT namedFramebufferParameteriEXT;
-	RenderCommand_getNamedFramebufferParameterivEXT getNamedFramebufferParameterivEXT;
-	RenderCommand_programUniform1dEXT programUniform1dEXT;
-	RenderCommand_programUniform2dEXT programUniform2dEXT;
-	RenderCommand_programUniform3dEXT programUniform3dEXT;
-	RenderCommand_programUniform4dEXT programUniform4dEXT;
-	RenderCommand_programUniform1dvEXT programUniform1dvEXT;
-	RenderCommand_programUniform2dvEXT programUniform2dvEXT;
-	RenderCommand_programUniform3dvEXT programUniform3dvEXT;
-	RenderCommand_programUniform4dvEXT programUniform4dvEXT;
-	RenderCommand_programUniformMatrix2dvEXT programUniformMatrix2dvEXT;
-	RenderCommand_programUniformMatrix3dvEXT programUniformMatrix3dvEXT;
-	RenderCommand_programUniformMatrix4dvEXT programUniformMatrix4dvEXT;
-	RenderCommand_programUniformMatrix2x3dvEXT programUniformMatrix2x3dvEXT;
-	RenderCommand_programUniformMatrix2x4dvEXT programUniformMatrix2x4dvEXT;
-	RenderCommand_programUniformMatrix3x2dvEXT programUniformMatrix3x2dvEXT;
-	RenderCommand_programUniformMatrix3x4dvEXT programUniformMatrix3x4dvEXT;
-	RenderCommand_programUniformMatrix4x2dvEXT programUniformMatrix4x2dvEXT;
-	RenderCommand_programUniformMatrix4x3dvEXT programUniformMatrix4x3dvEXT;
-	RenderCommand_textureBufferRangeEXT textureBufferRangeEXT;
-	RenderCommand_textureStorage1DEXT textureStorage1DEXT;
-	RenderCommand_textureStorage2DEXT textureStorage2DEXT;
-	RenderCommand_textureStorage3DEXT textureStorage3DEXT;
-	RenderCommand_textureStorage2DMultisampleEXT textureStorage2DMultisampleEXT;
-	RenderCommand_textureStorage3DMultisampleEXT textureStorage3DMultisampleEXT;
-	RenderCommand_vertexArrayBindVertexBufferEXT vertexArrayBindVertexBufferEXT;
-	RenderCommand_vertexArrayVertexAttribFormatEXT vertexArrayVertexAttribFormatEXT;
-	RenderCommand_vertexArrayVertexAttribIFormatEXT vertexArrayVertexAttribIFormatEXT;
-	RenderCommand_vertexArrayVertexAttribLFormatEXT vertexArrayVertexAttribLFormatEXT;
-	RenderCommand_vertexArrayVertexAttribBindingEXT vertexArrayVertexAttribBindingEXT;
-	RenderCommand_vertexArrayVertexBindingDivisorEXT vertexArrayVertexBindingDivisorEXT;
-	RenderCommand_vertexArrayVertexAttribLOffsetEXT vertexArrayVertexAttribLOffsetEXT;
-	RenderCommand_texturePageCommitmentEXT texturePageCommitmentEXT;
-	RenderCommand_vertexArrayVertexAttribDivisorEXT vertexArrayVertexAttribDivisorEXT;
-	RenderCommand_drawArraysInstancedEXT drawArraysInstancedEXT;
-	RenderCommand_drawElementsInstancedEXT drawElementsInstancedEXT;
-	RenderCommand_polygonOffsetClampEXT polygonOffsetClampEXT;
-	RenderCommand_rasterSamplesEXT rasterSamplesEXT;
-	RenderCommand_useShaderProgramEXT useShaderProgramEXT;
-	RenderCommand_activeProgramEXT activeProgramEXT;
-	RenderCommand_createShaderProgramEXT createShaderProgramEXT;
-	RenderCommand_framebufferFetchBarrierEXT framebufferFetchBarrierEXT;
-	RenderCommand_windowRectanglesEXT windowRectanglesEXT;
-	RenderCommand_applyFramebufferAttachmentCMAAINTEL applyFramebufferAttachmentCMAAINTEL;
-	RenderCommand_beginPerfQueryINTEL beginPerfQueryINTEL;
-	RenderCommand_createPerfQueryINTEL createPerfQueryINTEL;
-	RenderCommand_deletePerfQueryINTEL deletePerfQueryINTEL;
-	RenderCommand_endPerfQueryINTEL endPerfQueryINTEL;
-	RenderCommand_getFirstPerfQueryIdINTEL getFirstPerfQueryIdINTEL;
-	RenderCommand_getNextPerfQueryIdINTEL getNextPerfQueryIdINTEL;
-	RenderCommand_getPerfCounterInfoINTEL getPerfCounterInfoINTEL;
-	RenderCommand_getPerfQueryDataINTEL getPerfQueryDataINTEL;
-	RenderCommand_getPerfQueryIdByNameINTEL getPerfQueryIdByNameINTEL;
-	RenderCommand_getPerfQueryInfoINTEL getPerfQueryInfoINTEL;
-	RenderCommand_multiDrawArraysIndirectBindlessNV multiDrawArraysIndirectBindlessNV;
-	RenderCommand_multiDrawElementsIndirectBindlessNV multiDrawElementsIndirectBindlessNV;
-	RenderCommand_multiDrawArraysIndirectBindlessCountNV multiDrawArraysIndirectBindlessCountNV;
-	RenderCommand_multiDrawElementsIndirectBindlessCountNV multiDrawElementsIndirectBindlessCountNV;
-	RenderCommand_getTextureHandleNV getTextureHandleNV;
-	RenderCommand_getTextureSamplerHandleNV getTextureSamplerHandleNV;
-	RenderCommand_makeTextureHandleResidentNV makeTextureHandleResidentNV;
-	RenderCommand_makeTextureHandleNonResidentNV makeTextureHandleNonResidentNV;
-	RenderCommand_getImageHandleNV getImageHandleNV;
-	RenderCommand_makeImageHandleResidentNV makeImageHandleResidentNV;
-	RenderCommand_makeImageHandleNonResidentNV makeImageHandleNonResidentNV;
-	RenderCommand_uniformHandleui64NV uniformHandleui64NV;
-	RenderCommand_uniformHandleui64vNV uniformHandleui64vNV;
-	RenderCommand_programUniformHandleui64NV programUniformHandleui64NV;
-	RenderCommand_programUniformHandleui64vNV programUniformHandleui64vNV;
-	RenderCommand_isTextureHandleResidentNV isTextureHandleResidentNV;
-	RenderCommand_isImageHandleResidentNV isImageHandleResidentNV;
-	RenderCommand_blendParameteriNV blendParameteriNV;
-	RenderCommand_blendBarrierNV blendBarrierNV;
-	RenderCommand_viewportPositionWScaleNV viewportPositionWScaleNV;
-	RenderCommand_createStatesNV createStatesNV;
-	RenderCommand_deleteStatesNV deleteStatesNV;
-	RenderCommand_isStateNV isStateNV;
-	RenderCommand_stateCaptureNV stateCaptureNV;
-	RenderCommand_getCommandHeaderNV getCommandHeaderNV;
-	RenderCommand_getStageIndexNV getStageIndexNV;
-	RenderCommand_drawCommandsNV drawCommandsNV;
-	RenderCommand_drawCommandsAddressNV drawCommandsAddressNV;
-	RenderCommand_drawCommandsStatesNV drawCommandsStatesNV;
-	RenderCommand_drawCommandsStatesAddressNV drawCommandsStatesAddressNV;
-	RenderCommand_createCommandListsNV createCommandListsNV;
-	RenderCommand_deleteCommandListsNV deleteCommandListsNV;
-	RenderCommand_isCommandListNV isCommandListNV;
-	RenderCommand_listDrawCommandsStatesClientNV listDrawCommandsStatesClientNV;
-	RenderCommand_commandListSegmentsNV commandListSegmentsNV;
-	RenderCommand_compileCommandListNV compileCommandListNV;
-	RenderCommand_callCommandListNV callCommandListNV;
-	RenderCommand_beginConditionalRenderNV beginConditionalRenderNV;
-	RenderCommand_endConditionalRenderNV endConditionalRenderNV;
-	RenderCommand_subpixelPrecisionBiasNV subpixelPrecisionBiasNV;
-	RenderCommand_conservativeRasterParameterfNV conservativeRasterParameterfNV;
-	RenderCommand_conservativeRasterParameteriNV conservativeRasterParameteriNV;
-	RenderCommand_drawVkImageNV drawVkImageNV;
-	RenderCommand_getVkProcAddrNV getVkProcAddrNV;
-	RenderCommand_waitVkSemaphoreNV waitVkSemaphoreNV;
-	RenderCommand_signalVkSemaphoreNV signalVkSemaphoreNV;
-	RenderCommand_signalVkFenceNV signalVkFenceNV;
-	RenderCommand_fragmentCoverageColorNV fragmentCoverageColorNV;
-	RenderCommand_coverageModulationTableNV coverageModulationTableNV;
-	RenderCommand_getCoverageModulationTableNV getCoverageModulationTableNV;
-	RenderCommand_coverageModulationNV coverageModulationNV;
-	RenderCommand_renderbufferStorageMultisampleCoverageNV renderbufferStorageMultisampleCoverageNV;
-	RenderCommand_uniform1i64NV uniform1i64NV;
-	RenderCommand_uniform2i64NV uniform2i64NV;
-	RenderCommand_uniform3i64NV uniform3i64NV;
-	RenderCommand_uniform4i64NV uniform4i64NV;
-	RenderCommand_uniform1i64vNV uniform1i64vNV;
-	RenderCommand_uniform2i64vNV uniform2i64vNV;
-	RenderCommand_uniform3i64vNV uniform3i64vNV;
-	RenderCommand_uniform4i64vNV uniform4i64vNV;
-	RenderCommand_uniform1ui64NV uniform1ui64NV;
-	RenderCommand_uniform2ui64NV uniform2ui64NV;
-	RenderCommand_uniform3ui64NV uniform3ui64NV;
-	RenderCommand_uniform4ui64NV uniform4ui64NV;
-	RenderCommand_uniform1ui64vNV uniform1ui64vNV;
-	RenderCommand_uniform2ui64vNV uniform2ui64vNV;
-	RenderCommand_uniform3ui64vNV uniform3ui64vNV;
-	RenderCommand_uniform4ui64vNV uniform4ui64vNV;
-	RenderCommand_getUniformi64vNV getUniformi64vNV;
-	RenderCommand_programUniform1i64NV programUniform1i64NV;
-	RenderCommand_programUniform2i64NV programUniform2i64NV;
-	RenderCommand_programUniform3i64NV programUniform3i64NV;
-	RenderCommand_programUniform4i64NV programUniform4i64NV;
-	RenderCommand_programUniform1i64vNV programUniform1i64vNV;
-	RenderCommand_programUniform2i64vNV programUniform2i64vNV;
-	RenderCommand_programUniform3i64vNV programUniform3i64vNV;
-	RenderCommand_programUniform4i64vNV programUniform4i64vNV;
-	RenderCommand_programUniform1ui64NV programUniform1ui64NV;
-	RenderCommand_programUniform2ui64NV programUniform2ui64NV;
-	RenderCommand_programUniform3ui64NV programUniform3ui64NV;
-	RenderCommand_programUniform4ui64NV programUniform4ui64NV;
-	RenderCommand_programUniform1ui64vNV programUniform1ui64vNV;
-	RenderCommand_programUniform2ui64vNV programUniform2ui64vNV;
-	RenderCommand_programUniform3ui64vNV programUniform3ui64vNV;
-	RenderCommand_programUniform4ui64vNV programUniform4ui64vNV;
-	RenderCommand_getInternalformatSampleivNV getInternalformatSampleivNV;
-	RenderCommand_getMemoryObjectDetachedResourcesuivNV getMemoryObjectDetachedResourcesuivNV;
-	RenderCommand_resetMemoryObjectParameterNV resetMemoryObjectParameterNV;
-	RenderCommand_texAttachMemoryNV texAttachMemoryNV;
-	RenderCommand_bufferAttachMemoryNV bufferAttachMemoryNV;
-	RenderCommand_textureAttachMemoryNV textureAttachMemoryNV;
-	RenderCommand_namedBufferAttachMemoryNV namedBufferAttachMemoryNV;
-	RenderCommand_drawMeshTasksNV drawMeshTasksNV;
-	RenderCommand_drawMeshTasksIndirectNV drawMeshTasksIndirectNV;
-	RenderCommand_multiDrawMeshTasksIndirectNV multiDrawMeshTasksIndirectNV;
-	RenderCommand_multiDrawMeshTasksIndirectCountNV multiDrawMeshTasksIndirectCountNV;
-	RenderCommand_genPathsNV genPathsNV;
-	RenderCommand_deletePathsNV deletePathsNV;
-	RenderCommand_isPathNV isPathNV;
-	RenderCommand_pathCommandsNV pathCommandsNV;
-	RenderCommand_pathCoordsNV pathCoordsNV;
-	RenderCommand_pathSubCommandsNV pathSubCommandsNV;
-	RenderCommand_pathSubCoordsNV pathSubCoordsNV;
-	RenderCommand_pathStringNV pathStringNV;
-	RenderCommand_pathGlyphsNV pathGlyphsNV;
-	RenderCommand_pathGlyphRangeNV pathGlyphRangeNV;
-	RenderCommand_weightPathsNV weightPathsNV;
-	RenderCommand_copyPathNV copyPathNV;
-	RenderCommand_interpolatePathsNV interpolatePathsNV;
-	RenderCommand_transformPathNV transformPathNV;
-	RenderCommand_pathParameterivNV pathParameterivNV;
-	RenderCommand_pathParameteriNV pathParameteriNV;
-	RenderCommand_pathParameterfvNV pathParameterfvNV;
-	RenderCommand_pathParameterfNV pathParameterfNV;
-	RenderCommand_pathDashArrayNV pathDashArrayNV;
-	RenderCommand_pathStencilFuncNV pathStencilFuncNV;
-	RenderCommand_pathStencilDepthOffsetNV pathStencilDepthOffsetNV;
-	RenderCommand_stencilFillPathNV stencilFillPathNV;
-	RenderCommand_stencilStrokePathNV stencilStrokePathNV;
-	RenderCommand_stencilFillPathInstancedNV stencilFillPathInstancedNV;
-	RenderCommand_stencilStrokePathInstancedNV stencilStrokePathInstancedNV;
-	RenderCommand_pathCoverDepthFuncNV pathCoverDepthFuncNV;
-	RenderCommand_coverFillPathNV coverFillPathNV;
-	RenderCommand_coverStrokePathNV coverStrokePathNV;
-	RenderCommand_coverFillPathInstancedNV coverFillPathInstancedNV;
-	RenderCommand_coverStrokePathInstancedNV coverStrokePathInstancedNV;
-	RenderCommand_getPathParameterivNV getPathParameterivNV;
-	RenderCommand_getPathParameterfvNV getPathParameterfvNV;
-	RenderCommand_getPathCommandsNV getPathCommandsNV;
-	RenderCommand_getPathCoordsNV getPathCoordsNV;
-	RenderCommand_getPathDashArrayNV getPathDashArrayNV;
-	RenderCommand_getPathMetricsNV getPathMetricsNV;
-	RenderCommand_getPathMetricRangeNV getPathMetricRangeNV;
-	RenderCommand_getPathSpacingNV getPathSpacingNV;
-	RenderCommand_isPointInFillPathNV isPointInFillPathNV;
-	RenderCommand_isPointInStrokePathNV isPointInStrokePathNV;
-	RenderCommand_getPathLengthNV getPathLengthNV;
-	RenderCommand_pointAlongPathNV pointAlongPathNV;
-	RenderCommand_matrixLoad3x2fNV matrixLoad3x2fNV;
-	RenderCommand_matrixLoad3x3fNV matrixLoad3x3fNV;
-	RenderCommand_matrixLoadTranspose3x3fNV matrixLoadTranspose3x3fNV;
-	RenderCommand_matrixMult3x2fNV matrixMult3x2fNV;
-	RenderCommand_matrixMult3x3fNV matrixMult3x3fNV;
-	RenderCommand_matrixMultTranspose3x3fNV matrixMultTranspose3x3fNV;
-	RenderCommand_stencilThenCoverFillPathNV stencilThenCoverFillPathNV;
-	RenderCommand_stencilThenCoverStrokePathNV stencilThenCoverStrokePathNV;
-	RenderCommand_stencilThenCoverFillPathInstancedNV stencilThenCoverFillPathInstancedNV;
-	RenderCommand_stencilThenCoverStrokePathInstancedNV stencilThenCoverStrokePathInstancedNV;
-	RenderCommand_pathGlyphIndexRangeNV pathGlyphIndexRangeNV;
-	RenderCommand_pathGlyphIndexArrayNV pathGlyphIndexArrayNV;
-	RenderCommand_pathMemoryGlyphIndexArrayNV pathMemoryGlyphIndexArrayNV;
-	RenderCommand_programPathFragmentInputGenNV programPathFragmentInputGenNV;
-	RenderCommand_getProgramResourcefvNV getProgramResourcefvNV;
-	RenderCommand_framebufferSampleLocationsfvNV framebufferSampleLocationsfvNV;
-	RenderCommand_namedFramebufferSampleLocationsfvNV namedFramebufferSampleLocationsfvNV;
-	RenderCommand_resolveDepthValuesNV resolveDepthValuesNV;
-	RenderCommand_scissorExclusiveNV scissorExclusiveNV;
-	RenderCommand_scissorExclusiveArrayvNV scissorExclusiveArrayvNV;
-	RenderCommand_makeBufferResidentNV makeBufferResidentNV;
-	RenderCommand_makeBufferNonResidentNV makeBufferNonResidentNV;
-	RenderCommand_isBufferResidentNV isBufferResidentNV;
-	RenderCommand_makeNamedBufferResidentNV makeNamedBufferResidentNV;
-	RenderCommand_makeNamedBufferNonResidentNV makeNamedBufferNonResidentNV;
-	RenderCommand_isNamedBufferResidentNV isNamedBufferResidentNV;
-	RenderCommand_getBufferParameterui64vNV getBufferParameterui64vNV;
-	RenderCommand_getNamedBufferParameterui64vNV getNamedBufferParameterui64vNV;
-	RenderCommand_getIntegerui64vNV getIntegerui64vNV;
-	RenderCommand_uniformui64NV uniformui64NV;
-	RenderCommand_uniformui64vNV uniformui64vNV;
-	RenderCommand_getUniformui64vNV getUniformui64vNV;
-	RenderCommand_programUniformui64NV programUniformui64NV;
-	RenderCommand_programUniformui64vNV programUniformui64vNV;
-	RenderCommand_bindShadingRateImageNV bindShadingRateImageNV;
-	RenderCommand_getShadingRateImagePaletteNV getShadingRateImagePaletteNV;
-	RenderCommand_getShadingRateSampleLocationivNV getShadingRateSampleLocationivNV;
-	RenderCommand_shadingRateImageBarrierNV shadingRateImageBarrierNV;
-	RenderCommand_shadingRateImagePaletteNV shadingRateImagePaletteNV;
-	RenderCommand_shadingRateSampleOrderNV shadingRateSampleOrderNV;
-	RenderCommand_shadingRateSampleOrderCustomNV shadingRateSampleOrderCustomNV;
-	RenderCommand_textureBarrierNV textureBarrierNV;
-	RenderCommand_vertexAttribL1i64NV vertexAttribL1i64NV;
-	RenderCommand_vertexAttribL2i64NV vertexAttribL2i64NV;
-	RenderCommand_vertexAttribL3i64NV vertexAttribL3i64NV;
-	RenderCommand_vertexAttribL4i64NV vertexAttribL4i64NV;
-	RenderCommand_vertexAttribL1i64vNV vertexAttribL1i64vNV;
-	RenderCommand_vertexAttribL2i64vNV vertexAttribL2i64vNV;
-	RenderCommand_vertexAttribL3i64vNV vertexAttribL3i64vNV;
-	RenderCommand_vertexAttribL4i64vNV vertexAttribL4i64vNV;
-	RenderCommand_vertexAttribL1ui64NV vertexAttribL1ui64NV;
-	RenderCommand_vertexAttribL2ui64NV vertexAttribL2ui64NV;
-	RenderCommand_vertexAttribL3ui64NV vertexAttribL3ui64NV;
-	RenderCommand_vertexAttribL4ui64NV vertexAttribL4ui64NV;
-	RenderCommand_vertexAttribL1ui64vNV vertexAttribL1ui64vNV;
-	RenderCommand_vertexAttribL2ui64vNV vertexAttribL2ui64vNV;
-	RenderCommand_vertexAttribL3ui64vNV vertexAttribL3ui64vNV;
-	RenderCommand_vertexAttribL4ui64vNV vertexAttribL4ui64vNV;
-	RenderCommand_getVertexAttribLi64vNV getVertexAttribLi64vNV;
-	RenderCommand_getVertexAttribLui64vNV getVertexAttribLui64vNV;
-	RenderCommand_vertexAttribLFormatNV vertexAttribLFormatNV;
-	RenderCommand_bufferAddressRangeNV bufferAddressRangeNV;
-	RenderCommand_vertexFormatNV vertexFormatNV;
-	RenderCommand_normalFormatNV normalFormatNV;
-	RenderCommand_colorFormatNV colorFormatNV;
-	RenderCommand_indexFormatNV indexFormatNV;
-	RenderCommand_texCoordFormatNV texCoordFormatNV;
-	RenderCommand_edgeFlagFormatNV edgeFlagFormatNV;
-	RenderCommand_secondaryColorFormatNV secondaryColorFormatNV;
-	RenderCommand_fogCoordFormatNV fogCoordFormatNV;
-	RenderCommand_vertexAttribFormatNV vertexAttribFormatNV;
-	RenderCommand_vertexAttribIFormatNV vertexAttribIFormatNV;
-	RenderCommand_getIntegerui64i_vNV getIntegerui64i_vNV;
-	RenderCommand_viewportSwizzleNV viewportSwizzleNV;
-	RenderCommand_framebufferTextureMultiviewOVR framebufferTextureMultiviewOVR;
-
-};
@@ -8,12 +8,13 @@
 namespace pathos {
 
 	struct RenderCommandBase;
-	union RenderCommandPacketUnion;
 
 	typedef void (APIENTRYP PFN_EXECUTE)(const RenderCommandBase* __restrict params);
 
+	// Packets are tightly packed in a command list, so each packet knows its own size.
 	struct RenderCommandBase {
 		PFN_EXECUTE pfn_execute;
+		uint32 packetBytes; // Size of the whole packet. Next packet starts right after this one.
 	};
 
 	#include "render_commands.generated.h"
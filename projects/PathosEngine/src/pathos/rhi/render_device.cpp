@@ -1,8 +1,10 @@
 #include "render_device.h"
 #include "pathos/rhi/gl_context_manager.h"
 #include "pathos/rhi/gl_live_objects.h"
+#include "pathos/rhi/recording_gl.h"
 #include "pathos/rhi/shader_program.h"
 #include "pathos/rhi/buffer.h"
+#include "pathos/rhi/upload_ring_buffer.h"
 #include "pathos/util/log.h"
 #include "pathos/console.h"
 
@@ -59,6 +61,7 @@ namespace pathos {
 	static ConsoleVariable<int32> cvarPositionBufferPoolSize("r.positionBufferPoolSize", 32 * 1024 * 1024, "(read only) Size of global position buffer pool in bytes");
 	static ConsoleVariable<int32> cvarVaryingBufferPoolSize("r.varyingBufferPoolSize", 64 * 1024 * 1024, "(read only) Size of global varying buffer pool in bytes");
 	static ConsoleVariable<int32> cvarIndexBufferPoolSize("r.indexBufferPoolSize", 32 * 1024 * 1024, "(read only) Size of global vertex buffer pool in bytes");
+	static ConsoleVariable<int32> cvarUploadRingBufferSize("r.uploadRingBufferSize", 32 * 1024 * 1024, "(read only) Size of per-frame UBO/SSBO upload ring in bytes");
 
 	void ENQUEUE_RENDER_COMMAND(std::function<void(RenderCommandList& commandList)> lambda) {
 		//CHECK(isInMainThread());
@@ -111,17 +114,19 @@ namespace pathos {
 		bool bAllDestroyed = positionBufferPool == nullptr
 			&& varyingBufferPool == nullptr
 			&& indexBufferPool == nullptr
-			&& positionOnlyVAO == 0;
+			&& positionOnlyVAO == 0
+			&& uploadRingBuffer == nullptr;
 		CHECK(bAllDestroyed);
 		delete gGLLiveObjects;
 	}
 
 	bool OpenGLDevice::initialize() {
-		if (gl3wInit()) {
+		if (OpenGLContextManager::isHeadless()) {
+			installRecordingGL();
+		} else if (gl3wInit()) {
 			LOG(LogError, "[RenderDevice] Failed to initialize GL3W");
 			return false;
-		}
-		if (!gl3wIsSupported(REQUIRED_GL_MAJOR_VERSION, REQUIRED_GL_MINOR_VERSION)) {
+		} else if (!gl3wIsSupported(REQUIRED_GL_MAJOR_VERSION, REQUIRED_GL_MINOR_VERSION)) {
 			LOG(LogError, "[RenderDevice] GL %d.%d is not supported", REQUIRED_GL_MAJOR_VERSION, REQUIRED_GL_MINOR_VERSION);
 			return false;
 		}
@@ -179,6 +184,9 @@ namespace pathos {
 			glVertexArrayElementBuffer(positionOnlyVAO, ibuf);
 		}
 
+		uploadRingBuffer = new UploadRingBuffer;
+		uploadRingBuffer->createGPUResource(cvarUploadRingBufferSize.getInt(), "GUploadRingBuffer");
+
 		return true;
 	}
 
@@ -189,11 +197,16 @@ namespace pathos {
 		if (positionOnlyVAO != 0) {
 			deleteVertexArrays(1, &positionOnlyVAO);
 		}
+		if (uploadRingBuffer != nullptr) {
+			uploadRingBuffer->releaseGPUResource();
+			delete uploadRingBuffer;
+		}
 
 		positionBufferPool = nullptr;
 		varyingBufferPool = nullptr;
 		indexBufferPool = nullptr;
 		positionOnlyVAO = 0;
+		uploadRingBuffer = nullptr;
 	}
 
 	void OpenGLDevice::memreport(int64& outTotalBufferMemory, int64& outTotalTextureMemory) {
@@ -215,6 +228,8 @@ namespace pathos {
 		glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 0, capabilities.glMaxComputeWorkGroupSize + 0);
 		glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 1, capabilities.glMaxComputeWorkGroupSize + 1);
 		glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 2, capabilities.glMaxComputeWorkGroupSize + 2);
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &capabilities.glUniformBufferOffsetAlignment);
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &capabilities.glShaderStorageBufferOffsetAlignment);
 
 		if (extensionSupport.NVX_gpu_memory_info != 0) {
 			// https://registry.khronos.org/OpenGL/extensions/NVX/NVX_gpu_memory_info.txt
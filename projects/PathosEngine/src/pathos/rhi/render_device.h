@@ -16,6 +16,7 @@
 namespace pathos {
 
 	class BufferPool;
+	class UploadRingBuffer;
 
 	// https://developer.nvidia.com/vulkan-turing
 	struct OpenGLExtensionSupport {
@@ -46,6 +47,9 @@ namespace pathos {
 		int32 glMaxComputeWorkGroupCount[3];
 		// The maximum size of a work groups that may be used during compilation of a compute shader.
 		int32 glMaxComputeWorkGroupSize[3];
+		// Offsets of glBindBufferRange() must be multiples of these.
+		int32 glUniformBufferOffsetAlignment;
+		int32 glShaderStorageBufferOffsetAlignment;
 
 		bool bMemoryInfoAvailable = false;
 		int32 dedicatedVideoMemoryKiB = 0; // Total size of the VRAM
@@ -112,6 +116,7 @@ namespace pathos {
 		inline BufferPool* getVaryingBufferPool() const { return varyingBufferPool; }
 		inline BufferPool* getIndexBufferPool() const { return indexBufferPool; }
 		inline GLuint getPositionOnlyVAO() const { return positionOnlyVAO; }
+		inline UploadRingBuffer* getUploadRingBuffer() const { return uploadRingBuffer; }
 
 	private:
 		void queryCapabilities();
@@ -129,6 +134,7 @@ namespace pathos {
 		BufferPool* varyingBufferPool = nullptr; // Global non-position vertex buffer pool (normal, texcoord, ...)
 		BufferPool* indexBufferPool = nullptr; // Global index buffer pool
 		GLuint positionOnlyVAO = 0; // Global position-only vertex array object for indirect draw
+		UploadRingBuffer* uploadRingBuffer = nullptr; // Per-frame UBO/SSBO data
 	};
 
 	extern OpenGLDevice* gRenderDevice;
@@ -0,0 +1,230 @@
+#include "render_state_cache.h"
+
+namespace pathos {
+
+	static const GLenum TRACKED_CAPABILITIES[] = {
+		GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE, GL_STENCIL_TEST,
+		GL_SCISSOR_TEST, GL_POLYGON_OFFSET_FILL, GL_POLYGON_OFFSET_LINE, GL_DEPTH_CLAMP,
+		GL_FRAMEBUFFER_SRGB, GL_TEXTURE_CUBE_MAP_SEAMLESS, GL_PROGRAM_POINT_SIZE, GL_MULTISAMPLE,
+		GL_PRIMITIVE_RESTART, GL_RASTERIZER_DISCARD, GL_LINE_SMOOTH, GL_SAMPLE_ALPHA_TO_COVERAGE,
+	};
+	static_assert(sizeof(TRACKED_CAPABILITIES) / sizeof(GLenum) == 16, "Should match RenderStateCache::capabilities");
+
+	// Packet types are identified by their execute functions.
+	template<typename PacketType>
+	static inline bool isPacketOf(const RenderCommandBase* packet) {
+		return packet->pfn_execute == PFN_EXECUTE(PacketType::execute);
+	}
+
+	template<typename PacketType>
+	static inline const PacketType* packetAs(const RenderCommandBase* packet) {
+		return static_cast<const PacketType*>(packet);
+	}
+
+	// Returns true if the value is the same as the shadow value, otherwise updates the shadow value.
+	template<typename T>
+	static inline bool compareAndSet(T& shadowValue, T newValue) {
+		if (shadowValue == newValue) {
+			return true;
+		}
+		shadowValue = newValue;
+		return false;
+	}
+
+	RenderStateCache& RenderStateCache::get() {
+		static RenderStateCache instance;
+		return instance;
+	}
+
+	RenderStateCache::RenderStateCache() {
+		invalidate();
+	}
+
+	void RenderStateCache::invalidate() {
+		program = UNKNOWN;
+		vertexArray = UNKNOWN;
+		drawFramebuffer = UNKNOWN;
+		readFramebuffer = UNKNOWN;
+		depthFunc = UNKNOWN;
+		depthMask = UNKNOWN;
+		cullFace = UNKNOWN;
+		frontFace = UNKNOWN;
+		polygonMode = UNKNOWN;
+		bViewportKnown = false;
+		for (uint32 i = 0; i < 16; ++i) {
+			capabilities[i] = -1;
+		}
+		invalidateTextureBindings();
+		invalidateBufferBindings();
+	}
+
+	void RenderStateCache::invalidateTextureBindings() {
+		for (uint32 i = 0; i < MAX_TRACKED_UNITS; ++i) {
+			textureUnits[i] = UNKNOWN;
+			samplerUnits[i] = UNKNOWN;
+		}
+	}
+
+	void RenderStateCache::invalidateBufferBindings() {
+		for (uint32 i = 0; i < MAX_TRACKED_UNITS; ++i) {
+			uniformBuffers[i] = UNKNOWN;
+			storageBuffers[i] = UNKNOWN;
+		}
+		genericUniformBuffer = UNKNOWN;
+		genericStorageBuffer = UNKNOWN;
+	}
+
+	void RenderStateCache::beginFlush() {
+		if (flushDepth == 0) {
+			// Anything could have happened to the GL context since the last flush.
+			invalidate();
+		}
+		++flushDepth;
+	}
+
+	void RenderStateCache::endFlush() {
+		CHECK(flushDepth > 0);
+		--flushDepth;
+	}
+
+	int32 RenderStateCache::getCapabilityIndex(GLenum cap) const {
+		for (int32 i = 0; i < 16; ++i) {
+			if (TRACKED_CAPABILITIES[i] == cap) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	bool RenderStateCache::setBufferBinding(GLenum target, GLuint index, GLuint buffer) {
+		GLuint* indexedBindings;
+		GLuint* genericBinding;
+		if (target == GL_UNIFORM_BUFFER) {
+			indexedBindings = uniformBuffers;
+			genericBinding = &genericUniformBuffer;
+		} else if (target == GL_SHADER_STORAGE_BUFFER) {
+			indexedBindings = storageBuffers;
+			genericBinding = &genericStorageBuffer;
+		} else {
+			return false;
+		}
+		if (index >= MAX_TRACKED_UNITS) {
+			*genericBinding = buffer;
+			return false;
+		}
+		// glBindBufferBase() also changes the generic binding, so both should match.
+		const bool bRedundant = (indexedBindings[index] == buffer) && (*genericBinding == buffer);
+		indexedBindings[index] = buffer;
+		*genericBinding = buffer;
+		return bRedundant;
+	}
+
+	bool RenderStateCache::isRedundant(const RenderCommandBase* packet) {
+		bool bRedundant = false;
+
+		// Most frequent packets first.
+		if (isPacketOf<RenderCommand_bindTextureUnit>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindTextureUnit>(packet);
+			if (params->unit < MAX_TRACKED_UNITS) {
+				bRedundant = compareAndSet(textureUnits[params->unit], params->texture);
+			}
+		} else if (isPacketOf<RenderCommand_useProgram>(packet)) {
+			bRedundant = compareAndSet(program, packetAs<RenderCommand_useProgram>(packet)->program);
+		} else if (isPacketOf<RenderCommand_bindBufferBase>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindBufferBase>(packet);
+			bRedundant = setBufferBinding(params->target, params->index, params->buffer);
+		} else if (isPacketOf<RenderCommand_bindVertexArray>(packet)) {
+			bRedundant = compareAndSet(vertexArray, packetAs<RenderCommand_bindVertexArray>(packet)->array);
+		} else if (isPacketOf<RenderCommand_enable>(packet) || isPacketOf<RenderCommand_disable>(packet)) {
+			const bool bEnable = isPacketOf<RenderCommand_enable>(packet);
+			const GLenum cap = bEnable ? packetAs<RenderCommand_enable>(packet)->cap : packetAs<RenderCommand_disable>(packet)->cap;
+			const int32 capIndex = getCapabilityIndex(cap);
+			if (capIndex >= 0) {
+				bRedundant = compareAndSet(capabilities[capIndex], (int8)(bEnable ? 1 : 0));
+			}
+		} else if (isPacketOf<RenderCommand_bindSampler>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindSampler>(packet);
+			if (params->unit < MAX_TRACKED_UNITS) {
+				bRedundant = compareAndSet(samplerUnits[params->unit], params->sampler);
+			}
+		} else if (isPacketOf<RenderCommand_bindFramebuffer>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindFramebuffer>(packet);
+			if (params->target == GL_FRAMEBUFFER) {
+				bRedundant = (drawFramebuffer == params->framebuffer) && (readFramebuffer == params->framebuffer);
+				drawFramebuffer = readFramebuffer = params->framebuffer;
+			} else if (params->target == GL_DRAW_FRAMEBUFFER) {
+				bRedundant = compareAndSet(drawFramebuffer, params->framebuffer);
+			} else if (params->target == GL_READ_FRAMEBUFFER) {
+				bRedundant = compareAndSet(readFramebuffer, params->framebuffer);
+			}
+		} else if (isPacketOf<RenderCommand_depthFunc>(packet)) {
+			bRedundant = compareAndSet(depthFunc, packetAs<RenderCommand_depthFunc>(packet)->func);
+		} else if (isPacketOf<RenderCommand_depthMask>(packet)) {
+			bRedundant = compareAndSet(depthMask, (GLuint)packetAs<RenderCommand_depthMask>(packet)->flag);
+		} else if (isPacketOf<RenderCommand_cullFace>(packet)) {
+			bRedundant = compareAndSet(cullFace, packetAs<RenderCommand_cullFace>(packet)->mode);
+		} else if (isPacketOf<RenderCommand_frontFace>(packet)) {
+			bRedundant = compareAndSet(frontFace, packetAs<RenderCommand_frontFace>(packet)->mode);
+		} else if (isPacketOf<RenderCommand_polygonMode>(packet)) {
+			const auto* params = packetAs<RenderCommand_polygonMode>(packet);
+			if (params->face == GL_FRONT_AND_BACK) {
+				bRedundant = compareAndSet(polygonMode, params->mode);
+			} else {
+				polygonMode = UNKNOWN;
+			}
+		} else if (isPacketOf<RenderCommand_viewport>(packet)) {
+			const auto* params = packetAs<RenderCommand_viewport>(packet);
+			bRedundant = bViewportKnown
+				&& viewport[0] == params->x && viewport[1] == params->y
+				&& viewport[2] == params->width && viewport[3] == params->height;
+			viewport[0] = params->x;
+			viewport[1] = params->y;
+			viewport[2] = params->width;
+			viewport[3] = params->height;
+			bViewportKnown = true;
+		}
+		// Packets below always execute, but they invalidate some shadow states.
+		else if (isPacketOf<RenderCommand_bindBuffer>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindBuffer>(packet);
+			if (params->target == GL_UNIFORM_BUFFER) {
+				genericUniformBuffer = params->buffer;
+			} else if (params->target == GL_SHADER_STORAGE_BUFFER) {
+				genericStorageBuffer = params->buffer;
+			}
+		} else if (isPacketOf<RenderCommand_bindBufferRange>(packet)) {
+			const auto* params = packetAs<RenderCommand_bindBufferRange>(packet);
+			// A range binding never equals a base binding of the same buffer.
+			setBufferBinding(params->target, params->index, UNKNOWN);
+		} else if (isPacketOf<RenderCommand_bindBuffersBase>(packet) || isPacketOf<RenderCommand_bindBuffersRange>(packet)) {
+			invalidateBufferBindings();
+		} else if (isPacketOf<RenderCommand_bindTextures>(packet) || isPacketOf<RenderCommand_bindSamplers>(packet)
+			|| isPacketOf<RenderCommand_bindTexture>(packet)) {
+			// glBindTexture() changes the active texture unit which is not tracked.
+			invalidateTextureBindings();
+		} else if (isPacketOf<RenderCommand_enablei>(packet) || isPacketOf<RenderCommand_disablei>(packet)) {
+			const GLenum target = isPacketOf<RenderCommand_enablei>(packet)
+				? packetAs<RenderCommand_enablei>(packet)->target
+				: packetAs<RenderCommand_disablei>(packet)->target;
+			const int32 capIndex = getCapabilityIndex(target);
+			if (capIndex >= 0) {
+				capabilities[capIndex] = -1;
+			}
+		} else if (isPacketOf<RenderCommand_deleteProgram>(packet)) {
+			program = UNKNOWN;
+		} else if (isPacketOf<RenderCommand_deleteVertexArrays>(packet)) {
+			vertexArray = UNKNOWN;
+		} else if (isPacketOf<RenderCommand_deleteFramebuffers>(packet)) {
+			drawFramebuffer = readFramebuffer = UNKNOWN;
+		} else if (isPacketOf<RenderCommand_deleteBuffers>(packet)) {
+			invalidateBufferBindings();
+		} else if (isPacketOf<RenderCommand_deleteTextures>(packet) || isPacketOf<RenderCommand_deleteSamplers>(packet)) {
+			invalidateTextureBindings();
+		}
+
+		if (bRedundant) {
+			++numEliminatedCommands;
+		}
+		return bRedundant;
+	}
+
+}
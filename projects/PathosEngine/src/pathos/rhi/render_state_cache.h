@@ -0,0 +1,70 @@
+#pragma once
+
+#include "render_commands.h"
+#include "badger/types/int_types.h"
+
+namespace pathos {
+
+	// Shadow copy of GL states that are set by render command packets.
+	// RenderCommandList consults this while executing packets and drops binds and
+	// state sets that would not change anything (peephole pass at execute time).
+	//
+	// Only packets are tracked; GL calls outside of command lists are invisible to this,
+	// so the shadow state is invalidated whenever they could have happened:
+	// - At the start of every top-level flushAllCommands()
+	// - After each hook, as it may call GL directly
+	// - When objects that might be bound are deleted, as GL names can be reused
+	class RenderStateCache {
+
+	public:
+		static constexpr uint32 MAX_TRACKED_UNITS = 32; // Texture units, sampler units, and buffer binding indices
+		static constexpr GLuint UNKNOWN = 0xffffffff;
+
+		static RenderStateCache& get();
+
+		// Forget all states. Every subsequent packet will be executed until states are known again.
+		void invalidate();
+
+		// Returns true if the packet can be skipped. Otherwise updates the shadow state.
+		bool isRedundant(const RenderCommandBase* packet);
+
+		// Called around top-level flushes. Nested flushes (hooks, secondary lists) keep the shadow state.
+		void beginFlush();
+		void endFlush();
+
+		inline uint32 getNumEliminatedCommands() const { return numEliminatedCommands; }
+		inline void resetNumEliminatedCommands() { numEliminatedCommands = 0; }
+
+	private:
+		RenderStateCache();
+
+		int32 getCapabilityIndex(GLenum cap) const;
+		bool setBufferBinding(GLenum target, GLuint index, GLuint buffer);
+		void invalidateBufferBindings();
+		void invalidateTextureBindings();
+
+		uint32 flushDepth = 0;
+		uint32 numEliminatedCommands = 0;
+
+		GLuint program;
+		GLuint vertexArray;
+		GLuint drawFramebuffer;
+		GLuint readFramebuffer;
+		GLenum depthFunc;
+		GLuint depthMask; // GLboolean or UNKNOWN
+		GLenum cullFace;
+		GLenum frontFace;
+		GLenum polygonMode;
+		GLint viewport[4];
+		bool bViewportKnown;
+		int8 capabilities[16]; // 1 = enabled, 0 = disabled, -1 = unknown
+
+		GLuint textureUnits[MAX_TRACKED_UNITS];
+		GLuint samplerUnits[MAX_TRACKED_UNITS];
+		GLuint uniformBuffers[MAX_TRACKED_UNITS];
+		GLuint storageBuffers[MAX_TRACKED_UNITS];
+		GLuint genericUniformBuffer; // Also set by glBindBufferBase()
+		GLuint genericStorageBuffer;
+	};
+
+}
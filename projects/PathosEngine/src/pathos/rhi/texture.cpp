@@ -55,11 +55,29 @@ namespace pathos {
 			actualMipLevels = (createParams.mipLevels == 0) ? maxMips : std::min(createParams.mipLevels, maxMips);
 		}
 
+		bool bPrebuiltMips = false;
 		if (createParams.glDimension == GL_TEXTURE_2D) {
 			cmdList.textureStorage2D(
 				glTexture, actualMipLevels, createParams.glStorageFormat,
 				createParams.width, createParams.height);
-			if (createParams.imageBlobs.size() > 0) {
+			if (createParams.imageBlobs.size() > 0 && createParams.imageBlobs[0]->mips.size() > 0) {
+				// Cooked image with its own mip chain.
+				auto blob = createParams.imageBlobs[0];
+				const uint32 numLevels = std::min(actualMipLevels, (uint32)blob->mips.size());
+				for (uint32 level = 0; level < numLevels; ++level) {
+					const ImageMip& mip = blob->mips[level];
+					if (blob->bCompressed) {
+						cmdList.compressedTextureSubImage2D(
+							glTexture, level, 0, 0, mip.width, mip.height,
+							createParams.glStorageFormat, (GLsizei)mip.bytes, blob->rawBytes + mip.offset);
+					} else {
+						cmdList.textureSubImage2D(
+							glTexture, level, 0, 0, mip.width, mip.height,
+							blob->glPixelFormat, blob->glDataType, blob->rawBytes + mip.offset);
+					}
+				}
+				bPrebuiltMips = (numLevels == actualMipLevels);
+			} else if (createParams.imageBlobs.size() > 0) {
 				auto blob = createParams.imageBlobs[0];
 				cmdList.textureSubImage2D(
 					glTexture,
@@ -119,7 +137,7 @@ namespace pathos {
 		}
 
 		// #todo-rhi: Run only if image blob was provided.
-		if (actualMipLevels != 1) {
+		if (actualMipLevels != 1 && !bPrebuiltMips) {
 			cmdList.generateTextureMipmap(glTexture);
 		}
 
@@ -3,6 +3,7 @@
 #include "pathos/rhi/gl_handles.h"
 #include "pathos/rhi/render_device.h"
 #include "pathos/rhi/render_command_list.h"
+#include "pathos/rhi/upload_ring_buffer.h"
 #include "badger/assertion/assertion.h"
 
 namespace pathos {
@@ -54,11 +55,16 @@ namespace pathos {
 			init(sizeof(T), inDebugName);
 		}
 
+		// Data is sub-allocated from the per-frame upload ring, so it's fine to call this for every draw.
+		// The buffer of this instance is used only if the ring is full.
 		void update(RenderCommandList& cmdList, GLuint bindingIndex, void* data) {
 			CHECK(isInRenderThread());
 			CHECK(ubo != 0);
-			cmdList.namedBufferSubData(ubo, 0, bufferSize, data);
-			cmdList.bindBufferBase(GL_UNIFORM_BUFFER, bindingIndex, ubo);
+			UploadRingBuffer* uploadRing = gRenderDevice->getUploadRingBuffer();
+			if (uploadRing == nullptr || !uploadRing->bindUniformData(cmdList, bindingIndex, data, bufferSize)) {
+				cmdList.namedBufferSubData(ubo, 0, bufferSize, data);
+				cmdList.bindBufferBase(GL_UNIFORM_BUFFER, bindingIndex, ubo);
+			}
 		}
 
 		// NOTE: No need to call manually if this instance is deallocated before gRenderDevice shutdown.
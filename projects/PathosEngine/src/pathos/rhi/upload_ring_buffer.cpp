@@ -0,0 +1,106 @@
+#include "upload_ring_buffer.h"
+
+#include "pathos/rhi/render_device.h"
+#include "pathos/util/log.h"
+#include "badger/assertion/assertion.h"
+#include "badger/math/minmax.h"
+
+namespace pathos {
+
+	UploadRingBuffer::~UploadRingBuffer() {
+		releaseGPUResource();
+	}
+
+	void UploadRingBuffer::createGPUResource(uint64 totalBytes, const char* debugName) {
+		CHECK(isInRenderThread());
+		CHECK(glBuffer == 0);
+
+		const OpenGLDriverCapabilities& caps = gRenderDevice->getCapabilities();
+		if (caps.glUniformBufferOffsetAlignment > 0) uniformAlignment = (uint64)caps.glUniformBufferOffsetAlignment;
+		if (caps.glShaderStorageBufferOffsetAlignment > 0) storageAlignment = (uint64)caps.glShaderStorageBufferOffsetAlignment;
+
+		// Offset alignments are powers of two in practice, so a multiple of the larger one works for both.
+		const uint64 maxAlignment = badger::max(uniformAlignment, storageAlignment);
+		totalBytes = ((totalBytes + maxAlignment - 1) / maxAlignment) * maxAlignment;
+		CHECKF(totalBytes <= 0x7fffffff, "Upload ring is too large");
+
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gRenderDevice->createBuffers(1, &glBuffer);
+		glNamedBufferStorage(glBuffer, (GLsizeiptr)totalBytes, nullptr, flags);
+		gRenderDevice->objectLabel(GL_BUFFER, glBuffer, -1, debugName);
+		mappedMemory = reinterpret_cast<uint8*>(glMapNamedBufferRange(glBuffer, 0, (GLsizeiptr)totalBytes, flags));
+		if (mappedMemory == nullptr) {
+			LOG(LogError, "[UploadRingBuffer] Failed to map %s, every upload will fall back to glNamedBufferSubData", debugName);
+		}
+
+		allocator.initialize(totalBytes);
+	}
+
+	void UploadRingBuffer::releaseGPUResource() {
+		for (GLsync fence : fences) {
+			glDeleteSync(fence);
+		}
+		fences.clear();
+		if (glBuffer != 0) {
+			if (mappedMemory != nullptr) {
+				glUnmapNamedBuffer(glBuffer);
+				mappedMemory = nullptr;
+			}
+			gRenderDevice->deleteBuffers(1, &glBuffer);
+			glBuffer = 0;
+		}
+	}
+
+	void UploadRingBuffer::beginFrame() {
+		while (fences.size() > 0) {
+			// Just poll; never stall here.
+			const GLenum result = glClientWaitSync(fences.front(), 0, 0);
+			if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+				break;
+			}
+			glDeleteSync(fences.front());
+			fences.pop_front();
+			allocator.retireFrame();
+		}
+	}
+
+	void UploadRingBuffer::endFrame() {
+		if (glBuffer == 0) {
+			return;
+		}
+		allocator.endFrame();
+		fences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+		allocatedBytesInLastFrame = allocatedBytes;
+		numFallbacksInLastFrame = numFallbacks;
+		allocatedBytes = 0;
+		numFallbacks = 0;
+	}
+
+	bool UploadRingBuffer::bindUniformData(RenderCommandList& cmdList, GLuint bindingIndex, const void* data, uint32 bytes) {
+		return bindData(cmdList, GL_UNIFORM_BUFFER, bindingIndex, uniformAlignment, data, bytes);
+	}
+
+	bool UploadRingBuffer::bindStorageData(RenderCommandList& cmdList, GLuint bindingIndex, const void* data, uint32 bytes) {
+		return bindData(cmdList, GL_SHADER_STORAGE_BUFFER, bindingIndex, storageAlignment, data, bytes);
+	}
+
+	bool UploadRingBuffer::bindData(RenderCommandList& cmdList, GLenum target, GLuint bindingIndex, uint64 alignment, const void* data, uint32 bytes) {
+		CHECK(isInRenderThread());
+		if (mappedMemory == nullptr) {
+			return false;
+		}
+		const uint64 offset = allocator.allocate(bytes, alignment);
+		if (offset == RingAllocator::INVALID_OFFSET) {
+			++numFallbacks;
+			return false;
+		}
+
+		// The mapping is coherent and the command that reads this range is not executed yet.
+		::memcpy(mappedMemory + offset, data, bytes);
+		cmdList.bindBufferRange(target, bindingIndex, glBuffer, (GLintptr)offset, (GLsizeiptr)bytes);
+		allocatedBytes += bytes;
+		return true;
+	}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "pathos/rhi/gl_handles.h"
+#include "pathos/rhi/render_command_list.h"
+#include "pathos/util/ring_allocator.h"
+
+#include "badger/types/noncopyable.h"
+#include <deque>
+
+namespace pathos {
+
+	/// Persistently mapped buffer for per-draw constants that are valid only in the current frame.
+	/// Data is written to the mapped memory when a command is recorded, so neither
+	/// glNamedBufferSubData() nor a staging copy in the command list is needed.
+	/// A fence is inserted at the end of each frame; its range is reused after the fence is signaled.
+	/// Render thread only.
+	class UploadRingBuffer final : public Noncopyable {
+
+	public:
+		~UploadRingBuffer();
+
+		void createGPUResource(uint64 totalBytes, const char* debugName);
+		void releaseGPUResource();
+
+		/// Release the ranges of frames that the GPU has finished.
+		void beginFrame();
+		/// Call after all commands of the current frame were flushed.
+		void endFrame();
+
+		/// Copy the data to the ring and bind the range. Returns false if the ring is full,
+		/// then the caller should upload the data in another way.
+		bool bindUniformData(RenderCommandList& cmdList, GLuint bindingIndex, const void* data, uint32 bytes);
+		bool bindStorageData(RenderCommandList& cmdList, GLuint bindingIndex, const void* data, uint32 bytes);
+
+		/// Number of bindUniformData() and bindStorageData() calls that failed in the last frame.
+		inline uint32 getNumFallbacksInLastFrame() const { return numFallbacksInLastFrame; }
+		inline uint64 getAllocatedBytesInLastFrame() const { return allocatedBytesInLastFrame; }
+
+		inline GLuint internal_getGLName() const { return glBuffer; }
+
+	private:
+		bool bindData(RenderCommandList& cmdList, GLenum target, GLuint bindingIndex, uint64 alignment, const void* data, uint32 bytes);
+
+		GLuint glBuffer = 0;
+		uint8* mappedMemory = nullptr;
+		RingAllocator allocator;
+		std::deque<GLsync> fences; // One per frame in flight, oldest first
+		uint64 uniformAlignment = 256;
+		uint64 storageAlignment = 256;
+
+		uint64 allocatedBytes = 0;
+		uint64 allocatedBytesInLastFrame = 0;
+		uint32 numFallbacks = 0;
+		uint32 numFallbacksInLastFrame = 0;
+	};
+
+}
@@ -8,13 +8,16 @@
 
 #include "badger/types/half_float.h"
 #include "badger/math/minmax.h"
-#include "badger/math/hit_test.h"
 
 struct LandscapeSectorParameter {
 	vector4 uvBounds;
 	float   offsetX;
 	float   offsetY;
 	uint32  lod;
+	float   scale;      // Sectors per side
+	float   morphStart; // morphEnd <= 0 if no morphing
+	float   morphEnd;
+	uint32  divisions;  // Grid divisions per side
 	float   _pad0;
 };
 
@@ -25,6 +28,9 @@ namespace pathos {
 
 	static const uint32 LANDSCAPE_BASE_DIVISIONS = 16u;
 	static const float LANDSCAPE_BASE_CULL_DISTANCE = 500.0f;
+	// LOD range of level 0 in sectors. Each level doubles the range.
+	static const float LANDSCAPE_LOD0_RANGE_IN_SECTORS = 3.0f;
+	static const float LANDSCAPE_MORPH_START_RATIO = 0.7f;
 
 	LandscapeComponent::LandscapeComponent() {
 		cullDistance = LANDSCAPE_BASE_CULL_DISTANCE;
@@ -119,6 +125,8 @@ namespace pathos {
 			sectorParameterBuffer = makeUnique<Buffer>(bufferCreateParams);
 			sectorParameterBuffer->createGPUResource();
 		}
+
+		rebuildQuadTree();
 	}
 
 	void LandscapeComponent::initializeHeightMap(ImageBlob* blob) {
@@ -128,19 +136,23 @@ namespace pathos {
 		uint8* streamU8 = (uint8*)blob->rawBytes;
 		uint16* streamU16 = (uint16*)blob->rawBytes;
 
-		heightMapWidth = blob->width;
-		heightMapHeight = blob->height;
-		heightMapValues.reserve(heightMapWidth * heightMapHeight);
-		for (uint32 y = 0; y < heightMapHeight; ++y) {
-			for (uint32 x = 0; x < heightMapWidth; ++x) {
+		std::vector<float> heights;
+		heights.reserve(blob->width * blob->height);
+		for (uint32 y = 0; y < blob->height; ++y) {
+			for (uint32 x = 0; x < blob->width; ++x) {
 				// #todo-racing-game: Should I flip Y?
-				uint32 linearIx = y * heightMapWidth + x;
-				//uint32 linearIx = (heightMapHeight - y - 1) * heightMapWidth + x;
+				uint32 linearIx = y * blob->width + x;
+				//uint32 linearIx = (blob->height - y - 1) * blob->width + x;
 				//float h = (stride == 1) ? ((float)streamU8[linearIx] / 255.0f) : half_to_float(streamU16[linearIx]);
 				float h = (stride == 1) ? ((float)streamU8[linearIx] / 255.0f) : ((float)streamU16[linearIx] / 65535.0f);
-				heightMapValues.push_back(h);
+				heights.push_back(h);
 			}
 		}
+		if (blob->width >= 2 && blob->height >= 2) {
+			heightField.initialize(blob->width, blob->height, heights.data());
+		}
+
+		rebuildQuadTree();
 	}
 
 	vector2 LandscapeComponent::getNormalizedUV(float x, float z) const {
@@ -150,38 +162,36 @@ namespace pathos {
 	}
 
 	float LandscapeComponent::sampleHeightmap(float u, float v) const {
-		if (heightMapValues.size() == 0) return 0.0f;
+		if (!heightField.isValid()) return 0.0f;
 		u = badger::clamp(0.0f, u, 1.0f);
 		v = badger::clamp(0.0f, v, 1.0f);
-		float du = 1.0f / (float)heightMapWidth;
-		float dv = 1.0f / (float)heightMapHeight;
-
-		int32 maxX = (int32)heightMapWidth - 1;
-		int32 maxY = (int32)heightMapHeight - 1;
-
-		int32 x1 = badger::min(int32(u * (float)heightMapWidth), maxX - 1);
-		int32 y1 = badger::min(int32(v * (float)heightMapWidth), maxY - 1);
-		int32 x2 = badger::min(x1 + 1, maxX);
-		int32 y2 = badger::min(y1 + 1, maxY);
-
-		float u1 = (float)x1 / heightMapWidth;
-		float v1 = (float)y1 / heightMapHeight;
-		float u2 = u1 + du;
-		float v2 = v1 + dv;
-
-		float ku = (u2 - u) / du;
-		float kv = (v2 - v) / dv;
-
-		// #todo-racing-game: Bilinear or barycentric?
-		float h00 = heightMapValues[y1 * (int32)heightMapWidth + x1];
-		float h10 = heightMapValues[y1 * (int32)heightMapWidth + x2];
-		float h01 = heightMapValues[y2 * (int32)heightMapWidth + x1];
-		float h11 = heightMapValues[y2 * (int32)heightMapWidth + x2];
-		float h0 = h00 + ku * (h10 - h00);
-		float h1 = h01 + ku * (h11 - h01);
-		float h = h0 + kv * (h1 - h0);
-
-		return h;
+		// Samples span the landscape from corner to corner.
+		return heightField.sample(u * (float)(heightField.getWidth() - 1), v * (float)(heightField.getHeight() - 1));
+	}
+
+	bool LandscapeComponent::raycast(const vector3& start, const vector3& end, LandscapeRaycastHit& outHit) const {
+		if (!heightField.isValid() || countX <= 0 || countY <= 0 || heightMultiplier == 0.0f) {
+			return false;
+		}
+		const matrix4 worldToLocal = glm::inverse(getLocalMatrix());
+		const vector3 localStart = vector3(worldToLocal * vector4(start, 1.0f));
+		const vector3 localEnd = vector3(worldToLocal * vector4(end, 1.0f));
+
+		// Local space to the grid space of the heightfield. The mapping is affine, so ray parameters are preserved.
+		const vector3 localToGrid(
+			(float)(heightField.getWidth() - 1) / (sizeX * (float)countX),
+			(float)(heightField.getHeight() - 1) / (sizeY * (float)countY),
+			1.0f / heightMultiplier);
+		const vector3 origin = localStart * localToGrid;
+		const vector3 direction = (localEnd - localStart) * localToGrid;
+
+		badger::HeightFieldHit hit;
+		if (!heightField.raycast(origin, direction, 0.0f, 1.0f, hit)) {
+			return false;
+		}
+		outHit.fraction = hit.t;
+		outHit.position = start + hit.t * (end - start);
+		return true;
 	}
 
 	void LandscapeComponent::createRenderProxy(SceneProxy* scene) {
@@ -246,77 +256,73 @@ namespace pathos {
 		material->setConstantParameter("heightmapMultiplier", heightMultiplier);
 		material->setConstantParameter("sectorCountX", countX);
 		material->setConstantParameter("sectorCountY", countY);
+		material->setConstantParameter("sectorSizeX", sizeX);
+		material->setConstantParameter("sectorSizeY", sizeY);
 		material->setConstantParameter("baseDivisions", (int32)LANDSCAPE_BASE_DIVISIONS);
 		material->setConstantParameter("debugMode", cvarLandscapeDebugMode.getInt());
 
 		material->bWireframe = cvarLandscapeWireframe.getInt() != 0;
 	}
 
+	void LandscapeComponent::rebuildQuadTree() {
+		if (countX > 0 && countY > 0) {
+			quadTree.build((uint32)countX, (uint32)countY, heightField.isValid() ? &heightField : nullptr);
+		}
+	}
+
 	uint32 LandscapeComponent::fillIndirectDrawBuffers(SceneProxy* scene) {
-		const vector3 cameraPosition = scene->camera.getPosition();
-		const vector2 cameraXY = vector2(cameraPosition.x, cameraPosition.z);
+		LandscapeSelectionParams params;
+		scene->camera.getFrustumPlanes(params.frustum);
+		params.numFrustumPlanes = 5; // No far plane
+		params.localToWorld     = getLocalMatrix();
+		params.cameraPosition   = scene->camera.getPosition();
+		params.sectorSizeX      = sizeX;
+		params.sectorSizeY      = sizeY;
+		params.heightMultiplier = heightMultiplier;
+		params.lod0Range        = LANDSCAPE_LOD0_RANGE_IN_SECTORS * std::max(sizeX, sizeY);
+		params.morphStartRatio  = LANDSCAPE_MORPH_START_RATIO;
+
+		// Hierarchical frustum culling and CDLOD selection.
+		// Each selected node is drawn with the grid of LOD 0 (or LOD 1 for quadrants) scaled to its size.
+		quadTree.select(params, selectedNodes);
 
 		std::vector<DrawElementsIndirectCommand> drawCommands;
 		std::vector<LandscapeSectorParameter> sectorParams;
-		drawCommands.reserve(countX * countY);
-		sectorParams.reserve(countX * countY);
-
-		const vector3 basePosition = getLocation();
-		const vector2 basePositionXY = vector2(basePosition.x, basePosition.z);
-
-		Frustum3D frustum;
-		scene->camera.getFrustumPlanes(frustum);
-
-		uint32 visibleSectors = 0;
-		for (int32 sectorY = 0; sectorY < countY; ++sectorY) {
-			for (int32 sectorX = 0; sectorX < countX; ++sectorX) {
-				// Frustum culling
-				{
-					vector3 minV(sizeX * (float)sectorX, sizeY * (float)sectorY, 0.0f);
-					vector3 maxV = minV + vector3(sizeX, sizeY, heightMultiplier);
-					AABB localBounds = AABB::fromMinMax(minV, maxV);
-					AABB worldBounds = badger::calculateWorldBounds(localBounds, getLocalMatrix());
-					bool inFrustum = badger::hitTest::AABB_frustum_noFarPlane(worldBounds, frustum);
-					if (!inFrustum) {
-						continue;
-					}
-				}
-
-				// Calculate LOD (criteria: distance to camera).
-				vector2 sectorCenterXY = basePositionXY;
-				sectorCenterXY += vector2(((float)sectorX + 0.5f) * sizeX, ((float)sectorY + 0.5f) * -sizeY);
-				vector2 unitOffset = glm::abs((sectorCenterXY - cameraXY) / vector2(sizeX, sizeY));
-				uint32 distanceToCamera = (uint32)(std::max(unitOffset.x, unitOffset.y));
-
-				const int32 LOD = std::min(distanceToCamera, 2u);
-
-				DrawElementsIndirectCommand cmd{
-					numIndices[LOD],
-					1, // instanceCount
-					geometry->getFirstIndex() + indexOffsets[LOD], // CAUTION: Unlike glDrawElements, it's not byte offset.
-					0, // baseVertex
-					0, // baseInstance
-				};
-				drawCommands.emplace_back(cmd);
-
-				LandscapeSectorParameter sector{
-					vector4((float)sectorX / countX, (float)sectorY / countY, (float)(sectorX + 1) / countX, (float)(sectorY + 1) / countY),
-					sectorX * sizeX,
-					sectorY * sizeY,
-					(uint32)LOD,
-					0.0f,
-				};
-				sectorParams.emplace_back(sector);
-
-				++visibleSectors;
-			}
+		drawCommands.reserve(selectedNodes.size());
+		sectorParams.reserve(selectedNodes.size());
+
+		for (const LandscapeSelectedNode& node : selectedNodes) {
+			DrawElementsIndirectCommand cmd{
+				numIndices[node.meshLOD],
+				1, // instanceCount
+				geometry->getFirstIndex() + indexOffsets[node.meshLOD], // CAUTION: Unlike glDrawElements, it's not byte offset.
+				0, // baseVertex
+				0, // baseInstance
+			};
+			drawCommands.emplace_back(cmd);
+
+			const uint32 x0 = node.sectorX, y0 = node.sectorY;
+			const uint32 x1 = x0 + node.numSectors, y1 = y0 + node.numSectors;
+			LandscapeSectorParameter sector{
+				vector4((float)x0 / countX, (float)y0 / countY, (float)x1 / countX, (float)y1 / countY),
+				x0 * sizeX,
+				y0 * sizeY,
+				node.level,
+				(float)node.numSectors,
+				node.morphStart,
+				node.morphEnd,
+				LANDSCAPE_BASE_DIVISIONS >> node.meshLOD,
+				0.0f,
+			};
+			sectorParams.emplace_back(sector);
 		}
 
-		indirectDrawArgsBuffer->writeToGPU(0, sizeof(DrawElementsIndirectCommand) * visibleSectors, drawCommands.data());
-		indirectDrawCountBuffer->writeToGPU(0, sizeof(uint32), &visibleSectors);
-		sectorParameterBuffer->writeToGPU(0, sizeof(LandscapeSectorParameter) * visibleSectors, sectorParams.data());
+		const uint32 visibleNodes = (uint32)selectedNodes.size();
+		indirectDrawArgsBuffer->writeToGPU(0, sizeof(DrawElementsIndirectCommand) * visibleNodes, drawCommands.data());
+		indirectDrawCountBuffer->writeToGPU(0, sizeof(uint32), &visibleNodes);
+		sectorParameterBuffer->writeToGPU(0, sizeof(LandscapeSectorParameter) * visibleNodes, sectorParams.data());
 
-		return visibleSectors;
+		return visibleNodes;
 	}
 
 }
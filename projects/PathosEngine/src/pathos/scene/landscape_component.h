@@ -1,8 +1,10 @@
 #pragma once
 
 #include "pathos/scene/scene_component.h"
+#include "pathos/scene/landscape_quadtree.h"
 #include "pathos/smart_pointer.h"
 #include "badger/math/aabb.h"
+#include "badger/math/height_field.h"
 
 #include <vector>
 
@@ -38,6 +40,11 @@ namespace pathos {
 		float          heightMultiplier;
 	};
 
+	struct LandscapeRaycastHit {
+		vector3 position; // World space
+		float   fraction; // [0, 1] along the segment
+	};
+
 	class LandscapeComponent : public SceneComponent {
 
 	public:
@@ -60,6 +67,10 @@ namespace pathos {
 
 		float sampleHeightmap(float u, float v) const; // [0, 1]
 
+		// First intersection of the segment with the heightmap surface, in world space.
+		// Walks the min/max height pyramid, so only cells near the segment are tested.
+		bool raycast(const vector3& start, const vector3& end, LandscapeRaycastHit& outHit) const;
+
 		// Default value is 1.0.
 		inline float getHeightMultiplier() const { return heightMultiplier; }
 		inline void setHeightMultiplier(float multiplier) { heightMultiplier = multiplier; }
@@ -73,6 +84,7 @@ namespace pathos {
 
 	private:
 		void updateMaterial();
+		void rebuildQuadTree();
 		uint32 fillIndirectDrawBuffers(SceneProxy* scene); // CPU version
 
 		bool bGpuDriven = true;
@@ -83,11 +95,13 @@ namespace pathos {
 		std::vector<int32> indexOffsets;  // Per LOD
 
 		// To sample heightmap in CPU
-		uint32 heightMapWidth = 0;
-		uint32 heightMapHeight = 0;
-		std::vector<float> heightMapValues;
+		badger::HeightField heightField;
 		float heightMultiplier = 1.0f;
 
+		// For CPU culling and LOD selection
+		LandscapeQuadTree quadTree;
+		std::vector<LandscapeSelectedNode> selectedNodes;
+
 		assetPtr<Material> material;
 		Texture* albedoTexture = nullptr;
 		Texture* heightmapTexture = nullptr;
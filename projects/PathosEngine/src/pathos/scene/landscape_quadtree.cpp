@@ -0,0 +1,186 @@
+#include "landscape_quadtree.h"
+#include "badger/math/height_field.h"
+#include "badger/math/hit_test.h"
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace pathos {
+
+	enum class EFrustumTestResult : uint8 { Outside, Intersects, Inside };
+
+	static EFrustumTestResult testFrustum(const AABB& box, const Frustum3D& frustum, uint32 numPlanes) {
+		const vector3 center = box.getCenter();
+		const vector3 halfSize = box.getHalfSize();
+		EFrustumTestResult result = EFrustumTestResult::Inside;
+		for (uint32 i = 0; i < numPlanes; ++i) {
+			const float r = glm::dot(halfSize, glm::abs(frustum.planes[i].normal));
+			const float s = frustum.planes[i].getSignedDistance(center);
+			if (s < -r) {
+				return EFrustumTestResult::Outside;
+			}
+			if (s < r) {
+				result = EFrustumTestResult::Intersects;
+			}
+		}
+		return result;
+	}
+
+	static float distanceSquared(const AABB& box, const vector3& p) {
+		const vector3 d = glm::max(glm::max(box.minBounds - p, p - box.maxBounds), vector3(0.0f));
+		return glm::dot(d, d);
+	}
+
+	struct LandscapeQuadTree::SelectionContext {
+		const LandscapeSelectionParams& params;
+		std::vector<LandscapeSelectedNode>& outNodes;
+		LandscapeSelectionStats stats;
+
+		void emit(uint32 level, uint32 x, uint32 y, uint32 drawLevel) {
+			LandscapeSelectedNode node;
+			node.sectorX = x << level;
+			node.sectorY = y << level;
+			node.numSectors = 1u << level;
+			node.level = drawLevel;
+			node.meshLOD = drawLevel - level;
+			getMorphRange(params, drawLevel, node.morphStart, node.morphEnd);
+			outNodes.push_back(node);
+		}
+	};
+
+	void LandscapeQuadTree::build(uint32 sectorCountX, uint32 sectorCountY, const badger::HeightField* heightField) {
+		CHECK(sectorCountX > 0 && sectorCountY > 0);
+		countX = sectorCountX;
+		countY = sectorCountY;
+
+		levels.clear();
+		{
+			Level level0{ countX, countY };
+			level0.ranges.resize(countX * countY, vector2(0.0f, 1.0f));
+			if (heightField != nullptr && heightField->isValid()) {
+				const float samplesPerSectorX = (float)(heightField->getWidth() - 1) / (float)countX;
+				const float samplesPerSectorY = (float)(heightField->getHeight() - 1) / (float)countY;
+				for (uint32 y = 0; y < countY; ++y) {
+					for (uint32 x = 0; x < countX; ++x) {
+						// One more sample on each side, as texture filtering on GPU is offset by half a texel.
+						const int32 x0 = (int32)std::floor(x * samplesPerSectorX) - 1;
+						const int32 y0 = (int32)std::floor(y * samplesPerSectorY) - 1;
+						const int32 x1 = (int32)std::ceil((x + 1) * samplesPerSectorX) + 1;
+						const int32 y1 = (int32)std::ceil((y + 1) * samplesPerSectorY) + 1;
+						level0.ranges[y * countX + x] = heightField->getHeightRange(x0, y0, x1, y1);
+					}
+				}
+			}
+			levels.emplace_back(std::move(level0));
+		}
+		while (levels.back().sizeX > 1 || levels.back().sizeY > 1) {
+			const Level& below = levels.back();
+			Level level{ (below.sizeX + 1) / 2, (below.sizeY + 1) / 2 };
+			level.ranges.resize(level.sizeX * level.sizeY);
+			for (uint32 y = 0; y < level.sizeY; ++y) {
+				for (uint32 x = 0; x < level.sizeX; ++x) {
+					vector2 range(std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+					for (uint32 i = 0; i < 4; ++i) {
+						const uint32 cx = 2 * x + (i & 1), cy = 2 * y + (i >> 1);
+						if (cx < below.sizeX && cy < below.sizeY) {
+							const vector2& child = below.ranges[cy * below.sizeX + cx];
+							range.x = std::min(range.x, child.x);
+							range.y = std::max(range.y, child.y);
+						}
+					}
+					level.ranges[y * level.sizeX + x] = range;
+				}
+			}
+			levels.emplace_back(std::move(level));
+		}
+	}
+
+	void LandscapeQuadTree::select(const LandscapeSelectionParams& params, std::vector<LandscapeSelectedNode>& outNodes, LandscapeSelectionStats* outStats) const {
+		outNodes.clear();
+		SelectionContext context{ params, outNodes, LandscapeSelectionStats{ 0, 0 } };
+		if (levels.size() > 0) {
+			selectNode(context, (uint32)levels.size() - 1, 0, 0, false, true);
+		}
+		if (outStats != nullptr) {
+			*outStats = context.stats;
+		}
+	}
+
+	bool LandscapeQuadTree::selectNode(SelectionContext& context, uint32 level, uint32 x, uint32 y, bool bInsideFrustum, bool bIgnoreRange) const {
+		const LandscapeSelectionParams& params = context.params;
+		context.stats.nodesVisited += 1;
+
+		const AABB localBounds = getNodeBounds(level, x, y, params.sectorSizeX, params.sectorSizeY, params.heightMultiplier);
+		const AABB worldBounds = badger::calculateWorldBounds(localBounds, params.localToWorld);
+
+		if (!bInsideFrustum) {
+			context.stats.frustumTests += 1;
+			const EFrustumTestResult result = testFrustum(worldBounds, params.frustum, params.numFrustumPlanes);
+			if (result == EFrustumTestResult::Outside) {
+				// Nothing to draw in this area.
+				return true;
+			}
+			bInsideFrustum = (result == EFrustumTestResult::Inside);
+		}
+
+		const float distSq = distanceSquared(worldBounds, params.cameraPosition);
+		const float range = getLODRange(params, level);
+		if (!bIgnoreRange && distSq > range * range) {
+			return false;
+		}
+
+		if (level == 0) {
+			context.emit(level, x, y, level);
+			return true;
+		}
+		const float childRange = getLODRange(params, level - 1);
+		if (distSq > childRange * childRange && isNodeComplete(level, x, y)) {
+			context.emit(level, x, y, level);
+			return true;
+		}
+
+		const uint32 childLevel = level - 1;
+		for (uint32 i = 0; i < 4; ++i) {
+			const uint32 cx = 2 * x + (i & 1), cy = 2 * y + (i >> 1);
+			if (cx >= levels[childLevel].sizeX || cy >= levels[childLevel].sizeY) {
+				continue;
+			}
+			if (!selectNode(context, childLevel, cx, cy, bInsideFrustum, false)) {
+				// The child is visible but out of its range, so its area is drawn with this level's grid.
+				if (isNodeComplete(childLevel, cx, cy)) {
+					context.emit(childLevel, cx, cy, level);
+				} else {
+					// Crosses the edge of the landscape; split it further with its own LOD.
+					selectNode(context, childLevel, cx, cy, bInsideFrustum, true);
+				}
+			}
+		}
+		return true;
+	}
+
+	bool LandscapeQuadTree::isNodeComplete(uint32 level, uint32 x, uint32 y) const {
+		return ((x + 1) << level) <= countX && ((y + 1) << level) <= countY;
+	}
+
+	AABB LandscapeQuadTree::getNodeBounds(uint32 level, uint32 x, uint32 y, float sectorSizeX, float sectorSizeY, float heightMultiplier) const {
+		const vector2 range = getNodeHeightRange(level, x, y) * heightMultiplier;
+		const uint32 x0 = x << level, y0 = y << level;
+		const uint32 x1 = std::min((x + 1) << level, countX), y1 = std::min((y + 1) << level, countY);
+		return AABB::fromMinMax(
+			vector3(x0 * sectorSizeX, y0 * sectorSizeY, std::min(range.x, range.y)),
+			vector3(x1 * sectorSizeX, y1 * sectorSizeY, std::max(range.x, range.y)));
+	}
+
+	float LandscapeQuadTree::getLODRange(const LandscapeSelectionParams& params, uint32 level) {
+		return params.lod0Range * (float)(1u << level);
+	}
+
+	void LandscapeQuadTree::getMorphRange(const LandscapeSelectionParams& params, uint32 level, float& outStart, float& outEnd) {
+		const float prevRange = (level == 0) ? 0.0f : getLODRange(params, level - 1);
+		outEnd = getLODRange(params, level);
+		outStart = prevRange + (outEnd - prevRange) * params.morphStartRatio;
+	}
+
+}
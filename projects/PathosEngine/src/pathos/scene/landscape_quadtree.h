@@ -0,0 +1,93 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+#include "badger/types/matrix_types.h"
+#include "badger/math/aabb.h"
+#include "badger/math/plane.h"
+
+#include <vector>
+
+namespace badger { class HeightField; }
+
+namespace pathos {
+
+	// Quadtree over landscape sectors for CDLOD (Continuous Distance-Dependent Level of Detail).
+	// A node of level L covers (2^L x 2^L) sectors and is drawn with the same grid as a sector,
+	// so each level halves the vertex density. Vertices morph to the next level's grid
+	// as they approach the end of their LOD range, so there are no popping or cracks between levels.
+	//
+	// Local space of the landscape: sector (x, y) covers [x * sizeX, (x + 1) * sizeX] x [y * sizeY, (y + 1) * sizeY]
+	// on the XY plane and heights are on +Z.
+
+	struct LandscapeSelectionParams {
+		Frustum3D frustum;            // World space
+		uint32    numFrustumPlanes;   // 5 to ignore the far plane
+		matrix4   localToWorld;
+		vector3   cameraPosition;     // World space
+		float     sectorSizeX;
+		float     sectorSizeY;
+		float     heightMultiplier;
+		float     lod0Range;          // Range of level 0. Range of level L is (lod0Range * 2^L).
+		float     morphStartRatio;    // Vertices start to morph at this ratio of the range between the previous LOD range and its own.
+	};
+
+	// A selected area, drawn as a single grid.
+	struct LandscapeSelectedNode {
+		uint32 sectorX;     // First sector
+		uint32 sectorY;
+		uint32 numSectors;  // Sectors per side
+		uint32 level;       // LOD level. Determines the grid spacing and the morph range.
+		uint32 meshLOD;     // 0 if the area is a whole node of the level, 1 if it's a quadrant drawn with half the grid divisions.
+		float  morphStart;  // Distances from the camera where vertices start and finish morphing to the next level
+		float  morphEnd;
+	};
+
+	struct LandscapeSelectionStats {
+		uint32 nodesVisited;
+		uint32 frustumTests;
+	};
+
+	class LandscapeQuadTree {
+
+	public:
+		// Build the min/max height pyramid of the sectors.
+		// Heightmap samples span the landscape from corner to corner. If heightField is nullptr, heights are in [0, 1].
+		void build(uint32 sectorCountX, uint32 sectorCountY, const badger::HeightField* heightField);
+
+		// Hierarchical frustum culling and LOD selection. Nodes entirely inside of the frustum don't test their children.
+		// Selected areas never overlap and cover every visible sector.
+		void select(const LandscapeSelectionParams& params, std::vector<LandscapeSelectedNode>& outNodes, LandscapeSelectionStats* outStats = nullptr) const;
+
+		// Local bounds of a node, with heights scaled by heightMultiplier.
+		AABB getNodeBounds(uint32 level, uint32 x, uint32 y, float sectorSizeX, float sectorSizeY, float heightMultiplier) const;
+
+		static float getLODRange(const LandscapeSelectionParams& params, uint32 level);
+		static void getMorphRange(const LandscapeSelectionParams& params, uint32 level, float& outStart, float& outEnd);
+
+		inline uint32 getNumLevels() const { return (uint32)levels.size(); }
+		inline uint32 getSectorCountX() const { return countX; }
+		inline uint32 getSectorCountY() const { return countY; }
+		// (min, max) of normalized heights in the node.
+		inline vector2 getNodeHeightRange(uint32 level, uint32 x, uint32 y) const { return levels[level].ranges[y * levels[level].sizeX + x]; }
+
+	private:
+		struct Level {
+			uint32 sizeX;
+			uint32 sizeY;
+			std::vector<vector2> ranges;
+		};
+
+		struct SelectionContext;
+
+		// Returns false if the node is out of its LOD range, so that the parent draws the area.
+		bool selectNode(SelectionContext& context, uint32 level, uint32 x, uint32 y, bool bInsideFrustum, bool bIgnoreRange) const;
+		// A node entirely inside the landscape can be drawn as a single grid.
+		bool isNodeComplete(uint32 level, uint32 x, uint32 y) const;
+
+		uint32 countX = 0;
+		uint32 countY = 0;
+		std::vector<Level> levels;
+	};
+
+}
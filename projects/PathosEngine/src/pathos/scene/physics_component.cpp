@@ -63,18 +63,20 @@ namespace pathos {
 	void PhysicsComponent::onUnregister() {
 		auto& physicsScene = getOwner()->getWorld()->getPhysicsScene();
 		physicsScene.releaseBody(body);
+		body = badger::physics::INVALID_BODY_HANDLE;
 		if (shape != nullptr) delete shape;
 	}
 
 	void PhysicsComponent::onPrePhysicsTick(float deltaSeconds) {
+		auto& physicsScene = getOwner()->getWorld()->getPhysicsScene();
 		updateShape();
-		body->setPosition(getOwner()->getActorLocation());
-		body->setInvMass(invMass);
-		body->setElasticity(elasticity);
-		body->setFriction(friction);
+		physicsScene.setPosition(body, getOwner()->getActorLocation());
+		physicsScene.setInvMass(body, invMass);
+		physicsScene.setElasticity(body, elasticity);
+		physicsScene.setFriction(body, friction);
 		if (bForceLinearVelocity) {
 			bForceLinearVelocity = false;
-			body->setLinearVelocity(forcedLinearVelocity);
+			physicsScene.setLinearVelocity(body, forcedLinearVelocity);
 		}
 
 		if (shapeType == EShapeType::Sphere) {
@@ -87,11 +89,12 @@ namespace pathos {
 	}
 
 	void PhysicsComponent::onPostPhysicsTick(float deltaSeconds) {
-		glm::quat orientation = body->getOrientation();
+		auto& physicsScene = getOwner()->getWorld()->getPhysicsScene();
+		glm::quat orientation = physicsScene.getOrientation(body);
 		vector3 dir(orientation.x, orientation.y, orientation.z);
 		Rotator rot = Rotator::directionToYawPitch(dir);
 
-		getOwner()->setActorLocation(body->getCenterOfMassWorldSpace());
+		getOwner()->setActorLocation(physicsScene.getCenterOfMassWorldSpace(body));
 		getOwner()->setActorRotation(rot);
 	}
 
@@ -111,7 +114,7 @@ namespace pathos {
 			} else {
 				CHECK_NO_ENTRY();
 			}
-			body->setShape(shape);
+			getOwner()->getWorld()->getPhysicsScene().setShape(body, shape);
 		}
 	}
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "badger/physics/shape.h"
+#include "badger/physics/physics_scene.h"
 
 #include "actor_component.h"
 
@@ -36,7 +37,7 @@ namespace pathos {
 	private:
 		void updateShape();
 
-		badger::physics::Body* body = nullptr;
+		badger::physics::BodyHandle body = badger::physics::INVALID_BODY_HANDLE;
 		badger::physics::Shape* shape = nullptr;
 
 		StaticMeshComponent* boundsComponent = nullptr;
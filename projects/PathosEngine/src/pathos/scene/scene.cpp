@@ -128,6 +128,7 @@ namespace pathos {
 		proxy->bInvalidateSkyLighting = bInvalidateSkyLighting;
 		bInvalidateSkyLighting = false;
 
+		// Static mesh components only sync their changes to retainedSceneProxy here.
 		for (auto& actor : world->actors) {
 			if (!actor->markedForDeath) {
 				actor->updateTransformHierarchy();
@@ -136,6 +137,7 @@ namespace pathos {
 				}
 			}
 		}
+		retainedSceneProxy.fillSceneProxy(proxy);
 
 		if (godRaySource != nullptr) {
 			godRaySource->createRenderProxy_internal(proxy, proxy->godRayMeshes);
@@ -3,6 +3,7 @@
 #include "pathos/rhi/gl_handles.h"
 #include "pathos/render/image_based_lighting.h"
 #include "pathos/render/scene_proxy_common.h"
+#include "pathos/render/retained_scene_proxy.h"
 #include "pathos/material/material_id.h"
 #include "pathos/scene/actor.h"
 #include "pathos/scene/camera.h"
@@ -41,6 +42,9 @@ namespace pathos {
 
 		inline World* getWorld() const { return owner; }
 
+		// Render data of static meshes that persists across frames.
+		inline RetainedSceneProxy& getRetainedSceneProxy() { return retainedSceneProxy; }
+
 		// -----------------------------------------------------------------------
 		// Light System
 
@@ -70,6 +74,7 @@ namespace pathos {
 		std::vector<ReflectionProbeActor*>  reflectionProbes; // Actors spawned in the owner world
 		std::vector<IrradianceVolumeActor*> irradianceVolumes; // Actors spawned in the owner world
 		LightProbeScene                     lightProbeScene;
+		RetainedSceneProxy                  retainedSceneProxy;
 		bool                                bInvalidateSkyLighting = false;
 	};
 
@@ -4,17 +4,38 @@
 #include "pathos/material/material.h"
 #include "pathos/material/material_proxy.h"
 #include "pathos/render/scene_proxy.h"
+#include "pathos/render/retained_scene_proxy.h"
+#include "pathos/scene/world.h"
+#include "pathos/console.h"
 
 #include "badger/math/hit_test.h"
 #include <limits>
 
 namespace pathos {
 
+	static ConsoleVariable<int32> cvarRetainedStaticMesh("r.retainedStaticMesh", 1, "0 = create static mesh proxies every frame, 1 = register static meshes to the retained scene proxy");
+
+	StaticMeshComponent::~StaticMeshComponent() {
+		removeRetainedProxy();
+	}
+
+	void StaticMeshComponent::onUnregister() {
+		removeRetainedProxy();
+	}
+
 	void StaticMeshComponent::createRenderProxy(SceneProxy* scene) {
 		if (mesh == nullptr || getVisibility() == false) {
+			removeRetainedProxy();
 			return;
 		}
 
+		Actor* ownerActor = getOwner();
+		if (cvarRetainedStaticMesh.getInt() != 0 && ownerActor != nullptr && ownerActor->getWorld() != nullptr) {
+			updateRetainedProxy(&(ownerActor->getWorld()->getScene().getRetainedSceneProxy()));
+			return;
+		}
+		removeRetainedProxy();
+
 		// #todo-lod: Select mesh LOD
 		const uint32 LOD = 0;
 		const Geometries& geoms = mesh->getLOD(LOD).geometries;
@@ -73,6 +94,54 @@ namespace pathos {
 		return total;
 	}
 
+	void StaticMeshComponent::updateRetainedProxy(RetainedSceneProxy* inRetainedProxy) {
+		if (retainedProxy != inRetainedProxy) {
+			removeRetainedProxy();
+		}
+
+		const bool bNewlyAdded = (retainedProxy == nullptr);
+		if (bNewlyAdded || retainedProxy->isStaticMeshOutdated(retainedHandle, mesh.get(), castsShadow)) {
+			// #todo-lod: Select mesh LOD
+			const uint32 LOD = 0;
+			const Geometries& geoms = mesh->getLOD(LOD).geometries;
+			const Materials& materials = mesh->getLOD(LOD).materials;
+
+			std::vector<RetainedStaticMeshSection> sections(geoms.size());
+			for (size_t i = 0u; i < geoms.size(); ++i) {
+				sections[i].geometry    = geoms[i].get();
+				sections[i].material    = materials[i].get();
+				sections[i].localBounds = geoms[i]->getLocalBounds();
+			}
+
+			RetainedStaticMeshDesc desc;
+			desc.sections       = sections.data();
+			desc.numSections    = (uint32)sections.size();
+			desc.modelMatrix    = getLocalMatrix();
+			desc.doubleSided    = mesh->doubleSided;
+			desc.renderInternal = mesh->renderInternal;
+			desc.castsShadow    = castsShadow;
+
+			if (bNewlyAdded) {
+				retainedProxy = inRetainedProxy;
+				retainedHandle = retainedProxy->addStaticMesh(desc);
+			} else {
+				retainedProxy->updateStaticMesh(retainedHandle, desc);
+			}
+		} else if (prevModelMatrix != getLocalMatrix()) {
+			retainedProxy->updateStaticMeshTransform(retainedHandle, getLocalMatrix());
+		}
+
+		prevModelMatrix = getLocalMatrix();
+	}
+
+	void StaticMeshComponent::removeRetainedProxy() {
+		if (retainedProxy != nullptr) {
+			retainedProxy->removeStaticMesh(retainedHandle);
+			retainedProxy = nullptr;
+			retainedHandle = RetainedSceneProxy::INVALID_HANDLE;
+		}
+	}
+
 	void StaticMeshComponent::createRenderProxy_internal(SceneProxy* scene, std::vector<StaticMeshProxy*>& outProxyList) {
 		if (mesh == nullptr || getVisibility() == false) {
 			return;
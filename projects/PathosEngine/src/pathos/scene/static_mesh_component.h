@@ -10,6 +10,7 @@ namespace pathos {
 	class StaticMesh;
 	class MeshGeometry;
 	class MaterialProxy;
+	class RetainedSceneProxy;
 
 	// #todo-renderer: Further decompose
 	struct StaticMeshProxy : public SceneComponentProxy {
@@ -40,6 +41,8 @@ namespace pathos {
 		friend class Scene; // #todo-godray: due to createRenderProxy_internal()
 
 	public:
+		virtual ~StaticMeshComponent();
+
 		virtual void createRenderProxy(SceneProxy* scene) override;
 
 		inline assetPtr<StaticMesh> getStaticMesh() const { return mesh; }
@@ -47,10 +50,17 @@ namespace pathos {
 
 		AABB getWorldBounds() const;
 
+	protected:
+		virtual void onUnregister() override;
+
 	private:
 		// #todo-godray: Hack
 		void createRenderProxy_internal(SceneProxy* scene, std::vector<StaticMeshProxy*>& outProxyList);
 
+		// Register to or update the retained scene proxy instead of creating proxies every frame.
+		void updateRetainedProxy(RetainedSceneProxy* retainedProxy);
+		void removeRetainedProxy();
+
 	public:
 		bool castsShadow = true;
 
@@ -58,6 +68,9 @@ namespace pathos {
 		assetPtr<StaticMesh> mesh;
 		matrix4 prevModelMatrix;
 
+		RetainedSceneProxy* retainedProxy = nullptr;
+		uint32 retainedHandle = 0xffffffff; // RetainedSceneProxy::INVALID_HANDLE
+
 	};
 
 }
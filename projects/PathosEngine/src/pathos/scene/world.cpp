@@ -3,15 +3,19 @@
 #include "pathos/input/input_system.h"
 #include "pathos/input/input_manager.h"
 #include "pathos/input/xinput_manager.h"
+#include "pathos/console.h"
+#include "badger/math/minmax.h"
 #include "badger/assertion/assertion.h"
 
 namespace pathos {
 
+	static ConsoleVariable<int32> cvarPhysicsBroadPhase("physics.broadPhase", 1, "0 = sweep and prune 1D, 1 = sweep and prune 3D, 2 = dynamic AABB tree");
+
 	World::World()
 		: camera(PerspectiveLens(60.0f, 16.0f / 9.0f, 0.01f, 100000.0f))
 	{
 		scene.owner = this;
-		physicsScene.initialize();
+		physicsScene.initialize(gEngine->getJobSystem());
 	}
 
 	void World::destroyActor(Actor* actor) {
@@ -64,6 +68,8 @@ namespace pathos {
 		}
 
 		// Physics Tick
+		const int32 broadPhaseType = badger::clamp(0, cvarPhysicsBroadPhase.getInt(), (int32)badger::physics::EBroadPhaseType::Count - 1);
+		physicsScene.setBroadPhaseType((badger::physics::EBroadPhaseType)broadPhaseType);
 		physicsScene.update(deltaSeconds);
 
 		// Post-Physics Component Tick
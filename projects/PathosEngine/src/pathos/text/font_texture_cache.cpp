@@ -32,25 +32,10 @@ namespace pathos {
 			return false;
 		}
 
-		// Prepare glyph cells
 		maxWidth = face->size->metrics.max_advance >> 6;
 		maxHeight = face->size->metrics.height >> 6;
-		cols = TEXTURE_WIDTH / maxWidth;
-		rows = TEXTURE_HEIGHT / maxHeight;
-		float ratioX = static_cast<float>(maxWidth) / TEXTURE_WIDTH;
-		float ratioY = static_cast<float>(maxHeight) / TEXTURE_HEIGHT;
-		
-		for (auto y = 0u; y < rows; ++y) {
-			for (auto x = 0u; x < cols; ++x) {
-				GlyphInTexture g;
-				g.ch = 0;
-				g.x = x * ratioX;
-				g.y = y * ratioY;
-				g.width = ratioX;
-				g.height = ratioY;
-				cacheState.unused.emplace_back(g);
-			}
-		}
+		atlas.initialize(TEXTURE_WIDTH, TEXTURE_HEIGHT);
+		layoutCache.initialize(&atlas, getCellHeight());
 
 		// Prepare the cache texture
 		char textureObjectLabel[256];
@@ -82,8 +67,9 @@ namespace pathos {
 		FT_Done_Face(face);
 		texture->releaseGPUResource();
 		FontManager::get().unregisterCache(this);
-		cacheState.used.clear();
-		cacheState.unused.clear();
+		atlas.clear();
+		glyphs.clear();
+		layoutCache.clear();
 	}
 
 	uint32 FontTextureCache::getCharWidth(wchar_t x) const {
@@ -96,69 +82,86 @@ namespace pathos {
 	void FontTextureCache::startGetGlyph(RenderCommandList& cmdList)
 	{
 		cmdList.pixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		atlas.beginUse();
 	}
 
 	const GlyphInTexture FontTextureCache::getGlyph(RenderCommandList& cmdList, wchar_t x) {
-		insert(cmdList, x);
-		const auto& v = cacheState.used;
-		for (auto& g : v) {
-			if (g.ch == x) {
-				return g;
-			}
+		const int32 slot = getGlyphSlot(cmdList, x);
+		if (slot != GlyphAtlas::INVALID_SLOT) {
+			return glyphs[slot];
 		}
 		// #todo-text: Returns a placeholder character (like '?') for page fault
 		return GlyphInTexture{};
 	}
 
+	int32 FontTextureCache::getGlyphSlot(RenderCommandList& cmdList, wchar_t x, const GlyphEvictionHandler& onEviction) {
+		const int32 slot = atlas.find((uint32)x);
+		return (slot != GlyphAtlas::INVALID_SLOT) ? slot : insert(cmdList, x, onEviction);
+	}
+
 	void FontTextureCache::endGetGlyph(RenderCommandList& cmdList)
 	{
 		cmdList.pixelStorei(GL_UNPACK_ALIGNMENT, 4);
 	}
 
-	bool FontTextureCache::contains(wchar_t x) {
-		const auto& v = cacheState.used;
-		for (auto& g : v) {
-			if (g.ch == x) {
-				return true;
-			}
+	const TextLayout& FontTextureCache::layoutText(RenderCommandList& cmdList, const wchar_t* text, uint32 length, const GlyphEvictionHandler& onEviction) {
+		const TextLayout* cachedLayout = layoutCache.findValidLayout(text, length);
+		if (cachedLayout != nullptr) {
+			return *cachedLayout;
 		}
-		return false;
+
+		startGetGlyph(cmdList);
+		const TextLayout& layout = layoutCache.buildLayout(text, length, [this, &cmdList, &onEviction](wchar_t x, GlyphInTexture& outGlyph) {
+			const int32 slot = getGlyphSlot(cmdList, x, onEviction);
+			if (slot != GlyphAtlas::INVALID_SLOT) {
+				outGlyph = glyphs[slot];
+			}
+			return slot;
+		});
+		endGetGlyph(cmdList);
+		return layout;
 	}
 
-	bool FontTextureCache::insert(RenderCommandList& cmdList, wchar_t x) {
+	bool FontTextureCache::contains(wchar_t x) {
+		return atlas.contains((uint32)x);
+	}
+
+	int32 FontTextureCache::insert(RenderCommandList& cmdList, wchar_t x, const GlyphEvictionHandler& onEviction) {
 		if (contains(x)) {
-			return true;
+			return atlas.find((uint32)x);
 		}
 
-		GlyphInTexture g;
-
-		// #todo-text: This strategy works only for uniform cells
-		if (isFull(cacheState)) {
-			g = cacheState.used.front();
-			cacheState.used.pop_front();
-		} else {
-			g = cacheState.unused.back();
-			cacheState.unused.pop_back();
+		if (FT_Load_Char(face, x, FT_LOAD_RENDER) != 0) {
+			return GlyphAtlas::INVALID_SLOT;
 		}
+		FT_Bitmap& bmp = face->glyph->bitmap;
 
-		// Overwrites previous glyph slot data.
-		if (FT_Load_Char(face, x, FT_LOAD_RENDER) != 0) {
-			return false;
+		// Might evict other glyphs.
+		if (onEviction && atlas.wouldEvict(bmp.width, bmp.rows)) {
+			onEviction();
+		}
+		const int32 slot = atlas.insert((uint32)x, bmp.width, bmp.rows);
+		if (slot == GlyphAtlas::INVALID_SLOT) {
+			return GlyphAtlas::INVALID_SLOT;
 		}
+		if (glyphs.size() < atlas.getMaxSlots()) {
+			glyphs.resize(atlas.getMaxSlots());
+		}
+		const GlyphAtlas::Slot& rect = atlas.getSlot(slot);
 
+		GlyphInTexture& g = glyphs[slot];
+		g.ch = x;
+		g.x = static_cast<float>(rect.x) / TEXTURE_WIDTH;
+		g.y = static_cast<float>(rect.y) / TEXTURE_HEIGHT;
 		g.advanceX = static_cast<float>(face->glyph->advance.x >> 6) / TEXTURE_WIDTH;
 		g.offsetY = static_cast<float>(face->glyph->bitmap_top) / TEXTURE_HEIGHT;
-		g.ch = x;
-
-		FT_Bitmap& bmp = face->glyph->bitmap;
-
 		g.glyphPixelsX = bmp.width;
 		g.glyphPixelsY = bmp.rows;
 		g.glyphWidth = static_cast<float>(bmp.width) / TEXTURE_WIDTH;
 		g.glyphHeight = static_cast<float>(bmp.rows) / TEXTURE_HEIGHT;
+		g.width = g.glyphWidth;
+		g.height = g.glyphHeight;
 
-		cacheState.used.push_back(g);
-		
 		const uint32 glyphBufferSize = (uint32)(bmp.width * bmp.rows);
 		uint8* glyphBuffer = nullptr;
 		// e.g., white spaces have only advanceX, no actual data
@@ -202,15 +205,12 @@ namespace pathos {
 				glyphBuffer);                  // pixels
 		}
 
-		return true;
-	}
-
-	bool FontTextureCache::isFull(CacheState& cache_) const {
-		return cache_.unused.size() == 0;
+		return slot;
 	}
 
 	void FontTextureCache::onFrameEnd() {
 		glyphBufferAllocator.clear();
+		layoutCache.onFrameEnd();
 	}
 
 }
@@ -9,39 +9,25 @@
 #include "pathos/rhi/gl_handles.h"
 #include "pathos/rhi/render_command_list.h"
 #include "pathos/text/font_mgr.h"
+#include "pathos/text/glyph_atlas.h"
+#include "pathos/text/text_layout_cache.h"
 
 #include "badger/types/noncopyable.h"
 #include "badger/types/int_types.h"
 #include "badger/system/mem_alloc.h"
-#include <list>
-#include <map>
-#include <utility> // std::pair
+#include <vector>
+#include <functional>
 
 namespace pathos {
 
 	class Texture;
 
-	// A cache consists of cells of uniform size.
-	struct GlyphInTexture {
-		wchar_t ch;              // Character
-		float x, y;              // Position in uv space
-		float width, height;     // Cell size in uv space (in fact same for all GlyphInTexture instances, for now)
-		float advanceX, offsetY;
-		//int age;               // How long it had been not used
-
-		float glyphWidth;        // Width in uv space
-		float glyphHeight;       // Height in uv space
-		int glyphPixelsX;        // Width in texels
-		int glyphPixelsY;        // Height in texels
-	};
-
-	struct CacheState {
-		std::list<GlyphInTexture> used;
-		std::list<GlyphInTexture> unused;
-	};
+	// Called before glyphs in the cache texture are overwritten, e.g., to draw pending quads that sample them.
+	using GlyphEvictionHandler = std::function<void()>;
 
 	// Usage strategy: Keep a global cache for general text rendering, but allow creation of private caches if needed.
-	// #todo-text: Ideally wanna use just one bin-packing atlas for any font and size, but for now create a cache for each combination of font and size.
+	// Glyphs are packed by their bitmap sizes and evicted in least recently used order. See GlyphAtlas.
+	// #todo-text: Ideally wanna use just one atlas for any font and size, but for now create a cache for each combination of font and size.
 	//             Accordingly a Label is only able to express single font and size at a time, for now.
 	class FontTextureCache : public Noncopyable {
 		friend class FontManager;
@@ -53,11 +39,6 @@ namespace pathos {
 		FontTextureCache();
 		~FontTextureCache();
 
-		// #todo-text: Ideal interface for bin-packing atlas
-		//bool init(uint32 textureWidth, uint32 textureHeight, uint32 numAtlases);
-		//bool insert(RenderCommandList& cmdList, wchar_t x, const SomeFontDesc& fontDesc);
-		//GLuint getCacheTexture() const; // could be a texture2d array
-
 		// #todo-text: Remove filename and pixelSize parameters
 		bool init(RenderCommandList& cmdList, const char* filename, uint32 pixelSize);
 		void term();
@@ -68,6 +49,11 @@ namespace pathos {
 		const GlyphInTexture getGlyph(RenderCommandList& cmdList, wchar_t x);
 		void endGetGlyph(RenderCommandList& cmdList);
 
+		// Lay out a text, or reuse the layout of the same text if its glyphs are still in the cache texture.
+		// onEviction is invoked right before a glyph insertion overwrites other glyphs.
+		// The result is valid until the next call.
+		const TextLayout& layoutText(RenderCommandList& cmdList, const wchar_t* text, uint32 length, const GlyphEvictionHandler& onEviction = nullptr);
+
 		inline Texture* getTexture() const { return texture; }
 		inline float getCellWidth() const { return static_cast<float>(maxWidth) / TEXTURE_WIDTH; }
 		inline float getCellHeight() const { return static_cast<float>(maxHeight) / TEXTURE_HEIGHT; }
@@ -75,10 +61,13 @@ namespace pathos {
 		inline uint32 getTextureWidth() const { return TEXTURE_WIDTH; }
 		inline uint32 getTextureHeight() const { return TEXTURE_HEIGHT; }
 
+		inline const GlyphAtlas& getAtlas() const { return atlas; }
+
 	protected:
 		bool contains(wchar_t x); // does it exist in one of caches?
-		bool insert(RenderCommandList& cmdList, wchar_t x); // returns true if successful, false otherwise
-		inline bool isFull(CacheState& cache) const;
+		// Returns the slot in the atlas, or GlyphAtlas::INVALID_SLOT.
+		int32 insert(RenderCommandList& cmdList, wchar_t x, const GlyphEvictionHandler& onEviction = nullptr);
+		int32 getGlyphSlot(RenderCommandList& cmdList, wchar_t x, const GlyphEvictionHandler& onEviction = nullptr);
 
 		void onFrameEnd();
 
@@ -90,14 +79,13 @@ namespace pathos {
 		uint32 maxWidth = 0;
 		uint32 maxHeight = 0;
 
-		// Num columns and rows of the glyph grid in the cache texture
-		uint32 cols = 0;
-		uint32 rows = 0;
-
 		Texture* texture = nullptr;
-		CacheState cacheState;
+		GlyphAtlas atlas;
+		std::vector<GlyphInTexture> glyphs; // Indexed by atlas slot
 		StackAllocator glyphBufferAllocator;
 
+		TextLayoutCache layoutCache;
+
 	};
 
 }
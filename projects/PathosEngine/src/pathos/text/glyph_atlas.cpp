@@ -0,0 +1,210 @@
+#include "glyph_atlas.h"
+
+#include "badger/assertion/assertion.h"
+
+namespace pathos {
+
+	void GlyphAtlas::initialize(uint32 inWidth, uint32 inHeight, uint32 inPadding) {
+		CHECK(inWidth > 0 && inHeight > 0);
+		width = inWidth;
+		height = inHeight;
+		padding = inPadding;
+		clear();
+	}
+
+	void GlyphAtlas::clear() {
+		shelves.clear();
+		slots.clear();
+		freeSlots.clear();
+		keyToSlot.clear();
+		nextShelfY = 0;
+		numEvictedShelves = 0;
+		numEvictedGlyphs = 0;
+	}
+
+	int32 GlyphAtlas::find(uint32 key) {
+		auto it = keyToSlot.find(key);
+		if (it == keyToSlot.end()) {
+			return INVALID_SLOT;
+		}
+		const uint32 shelf = slots[it->second].shelf;
+		if (shelf != INVALID_SHELF) {
+			shelves[shelf].lastUsedTick = currentTick;
+		}
+		return it->second;
+	}
+
+	int32 GlyphAtlas::insert(uint32 key, uint32 glyphWidth, uint32 glyphHeight) {
+		CHECK(contains(key) == false);
+
+		uint32 shelf = INVALID_SHELF;
+		uint32 x = 0, y = 0;
+		if (glyphWidth > 0 && glyphHeight > 0) {
+			const uint32 paddedWidth = glyphWidth + padding;
+			const uint32 paddedHeight = glyphHeight + padding;
+			if (paddedWidth > width || paddedHeight > height) {
+				return INVALID_SLOT;
+			}
+			shelf = findShelf(paddedWidth, paddedHeight);
+			CHECK(shelf != INVALID_SHELF);
+
+			Shelf& target = shelves[shelf];
+			x = target.cursorX;
+			y = target.y;
+			target.cursorX += paddedWidth;
+			target.lastUsedTick = currentTick;
+		}
+
+		// Slots can be freed while finding a shelf.
+		const int32 slotIndex = allocateSlot();
+		slots[slotIndex] = Slot{ key, x, y, glyphWidth, glyphHeight, shelf };
+		if (shelf != INVALID_SHELF) {
+			shelves[shelf].slots.push_back(slotIndex);
+		}
+		keyToSlot.insert(std::make_pair(key, slotIndex));
+		return slotIndex;
+	}
+
+	bool GlyphAtlas::wouldEvict(uint32 glyphWidth, uint32 glyphHeight) const {
+		if (glyphWidth == 0 || glyphHeight == 0) {
+			return false;
+		}
+		const uint32 paddedWidth = glyphWidth + padding;
+		const uint32 paddedHeight = glyphHeight + padding;
+		if (paddedWidth > width || paddedHeight > height) {
+			return false; // insert() fails without eviction
+		}
+		// Same order as the first two steps of findShelf().
+		if (findShelfWithRoom(paddedWidth, paddedHeight) != INVALID_SHELF) {
+			return false;
+		}
+		return nextShelfY + alignShelfHeight(paddedHeight) > height;
+	}
+
+	GlyphAtlas::Stats GlyphAtlas::getStats() const {
+		Stats stats{};
+		uint64 glyphArea = 0;
+		for (const auto& it : keyToSlot) {
+			const Slot& slot = slots[it.second];
+			glyphArea += (uint64)slot.width * slot.height;
+		}
+		stats.numGlyphs = (uint32)keyToSlot.size();
+		stats.numShelves = (uint32)shelves.size();
+		stats.numEvictedShelves = numEvictedShelves;
+		stats.numEvictedGlyphs = numEvictedGlyphs;
+		stats.occupancy = (width * height > 0) ? (float)((double)glyphArea / ((double)width * height)) : 0.0f;
+		return stats;
+	}
+
+	uint32 GlyphAtlas::alignShelfHeight(uint32 paddedHeight) {
+		return (paddedHeight + SHELF_HEIGHT_ALIGNMENT - 1) & ~(SHELF_HEIGHT_ALIGNMENT - 1);
+	}
+
+	bool GlyphAtlas::canShareShelf(uint32 shelfHeight, uint32 paddedHeight) {
+		// Don't put small glyphs on much taller shelves. An evicted shelf keeps its height though,
+		// so it can be reused by a smaller glyph (see findShelf()).
+		return paddedHeight <= shelfHeight && shelfHeight <= alignShelfHeight(paddedHeight) + paddedHeight / 2;
+	}
+
+	uint32 GlyphAtlas::findShelfWithRoom(uint32 paddedWidth, uint32 paddedHeight) const {
+		// Best fit among the shelves that have room.
+		uint32 bestShelf = INVALID_SHELF;
+		for (uint32 i = 0; i < (uint32)shelves.size(); ++i) {
+			const Shelf& shelf = shelves[i];
+			if (canShareShelf(shelf.height, paddedHeight) && shelf.cursorX + paddedWidth <= width) {
+				if (bestShelf == INVALID_SHELF || shelf.height < shelves[bestShelf].height) {
+					bestShelf = i;
+				}
+			}
+		}
+		return bestShelf;
+	}
+
+	uint32 GlyphAtlas::findShelf(uint32 paddedWidth, uint32 paddedHeight) {
+		// 1. Best fit among the shelves that have room.
+		const uint32 bestShelf = findShelfWithRoom(paddedWidth, paddedHeight);
+		if (bestShelf != INVALID_SHELF) {
+			return bestShelf;
+		}
+
+		// 2. Open a new shelf.
+		const uint32 shelfHeight = alignShelfHeight(paddedHeight);
+		if (nextShelfY + shelfHeight <= height) {
+			Shelf shelf;
+			shelf.y = nextShelfY;
+			shelf.height = shelfHeight;
+			shelf.cursorX = 0;
+			shelf.generation = ++lastGeneration;
+			shelf.lastUsedTick = currentTick;
+			shelves.emplace_back(std::move(shelf));
+			nextShelfY += shelfHeight;
+			return (uint32)shelves.size() - 1;
+		}
+
+		// 3. Evict the least recently used shelf that is tall enough.
+		//    Shelves used in the current period are the last resort.
+		uint32 victim = INVALID_SHELF;
+		for (uint32 i = 0; i < (uint32)shelves.size(); ++i) {
+			const Shelf& shelf = shelves[i];
+			if (shelf.height < paddedHeight) {
+				continue;
+			}
+			if (victim == INVALID_SHELF) {
+				victim = i;
+				continue;
+			}
+			const Shelf& current = shelves[victim];
+			const bool bProtected = (shelf.lastUsedTick == currentTick);
+			const bool bCurrentProtected = (current.lastUsedTick == currentTick);
+			if (bProtected != bCurrentProtected) {
+				if (!bProtected) {
+					victim = i;
+				}
+			} else if (shelf.lastUsedTick < current.lastUsedTick
+				|| (shelf.lastUsedTick == current.lastUsedTick && shelf.height < current.height))
+			{
+				victim = i;
+			}
+		}
+		if (victim != INVALID_SHELF) {
+			evictShelf(victim);
+			return victim;
+		}
+
+		// 4. Taller than every shelf. Start over.
+		evictAll();
+		return findShelf(paddedWidth, paddedHeight);
+	}
+
+	void GlyphAtlas::evictShelf(uint32 shelfIndex) {
+		Shelf& shelf = shelves[shelfIndex];
+		for (int32 slotIndex : shelf.slots) {
+			keyToSlot.erase(slots[slotIndex].key);
+			freeSlots.push_back(slotIndex);
+		}
+		numEvictedGlyphs += (uint32)shelf.slots.size();
+		numEvictedShelves += 1;
+		shelf.slots.clear();
+		shelf.cursorX = 0;
+		shelf.generation = ++lastGeneration;
+	}
+
+	void GlyphAtlas::evictAll() {
+		for (uint32 i = 0; i < (uint32)shelves.size(); ++i) {
+			evictShelf(i);
+		}
+		shelves.clear();
+		nextShelfY = 0;
+	}
+
+	int32 GlyphAtlas::allocateSlot() {
+		if (freeSlots.size() > 0) {
+			int32 slotIndex = freeSlots.back();
+			freeSlots.pop_back();
+			return slotIndex;
+		}
+		slots.emplace_back();
+		return (int32)slots.size() - 1;
+	}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include <vector>
+#include <unordered_map>
+
+namespace pathos {
+
+	// Packs glyph rects of various sizes into a texture with a shelf allocator.
+	// Glyphs are found by key (e.g., character code) in a hash table.
+	// When the atlas is full, the least recently used shelf is emptied and reused.
+	// Only bookkeeping is done here; the owner uploads glyph bitmaps to the slot rects.
+	class GlyphAtlas {
+
+	public:
+		static constexpr int32 INVALID_SLOT = -1;
+		static constexpr uint32 INVALID_SHELF = 0xffffffff;
+
+		// Rect in texels. Glyphs without a bitmap (e.g., white spaces) have zero size and no shelf.
+		struct Slot {
+			uint32 key;
+			uint32 x, y;
+			uint32 width, height;
+			uint32 shelf;
+		};
+
+		struct Stats {
+			uint32 numGlyphs;
+			uint32 numShelves;
+			uint32 numEvictedShelves;
+			uint32 numEvictedGlyphs;
+			float  occupancy;         // Glyph area / atlas area
+		};
+
+		void initialize(uint32 inWidth, uint32 inHeight, uint32 inPadding = 1);
+		void clear();
+
+		// Start a new period of use. Shelves used in the current period are evicted only if no other shelf fits.
+		// A renderer calls this before looking up glyphs of a text so that its glyphs are not overwritten by each other.
+		inline void beginUse() { ++currentTick; }
+
+		// Returns the slot index of the key and marks it as used, or INVALID_SLOT.
+		int32 find(uint32 key);
+		inline bool contains(uint32 key) const { return keyToSlot.find(key) != keyToSlot.end(); }
+
+		// Allocates a rect for a key that is not in the atlas, evicting shelves if needed.
+		// Returns INVALID_SLOT if the glyph is larger than the atlas.
+		int32 insert(uint32 key, uint32 glyphWidth, uint32 glyphHeight);
+
+		inline const Slot& getSlot(int32 slotIndex) const { return slots[slotIndex]; }
+		inline uint32 getMaxSlots() const { return (uint32)slots.size(); }
+
+		// Shelf generation changes when the shelf is evicted,
+		// so that cached data referring to glyphs of the shelf can detect it.
+		inline uint32 getShelfGeneration(uint32 shelf) const { return shelves[shelf].generation; }
+		inline bool isShelfValid(uint32 shelf, uint32 generation) const {
+			return shelf < (uint32)shelves.size() && shelves[shelf].generation == generation;
+		}
+		inline void touchShelf(uint32 shelf) { shelves[shelf].lastUsedTick = currentTick; }
+
+		// True if inserting a glyph of the given size would evict other glyphs.
+		bool wouldEvict(uint32 glyphWidth, uint32 glyphHeight) const;
+
+		Stats getStats() const;
+
+		inline uint32 getWidth() const { return width; }
+		inline uint32 getHeight() const { return height; }
+
+	private:
+		struct Shelf {
+			uint32 y;
+			uint32 height;
+			uint32 cursorX;
+			uint32 generation;
+			uint64 lastUsedTick;
+			std::vector<int32> slots;
+		};
+
+		// Shelf heights are rounded up so that glyphs of similar heights share shelves.
+		static constexpr uint32 SHELF_HEIGHT_ALIGNMENT = 4;
+
+		static uint32 alignShelfHeight(uint32 paddedHeight);
+		static bool canShareShelf(uint32 shelfHeight, uint32 paddedHeight);
+
+		uint32 findShelfWithRoom(uint32 paddedWidth, uint32 paddedHeight) const;
+		uint32 findShelf(uint32 paddedWidth, uint32 paddedHeight);
+		void evictShelf(uint32 shelf);
+		void evictAll();
+		int32 allocateSlot();
+
+		uint32 width = 0;
+		uint32 height = 0;
+		uint32 padding = 0;
+		uint32 nextShelfY = 0;
+		uint64 currentTick = 1;
+		uint32 lastGeneration = 0; // Never reset, so a recreated shelf doesn't reuse a generation
+
+		std::vector<Shelf> shelves;
+		std::vector<Slot> slots;
+		std::vector<int32> freeSlots;
+		std::unordered_map<uint32, int32> keyToSlot;
+
+		uint32 numEvictedShelves = 0;
+		uint32 numEvictedGlyphs = 0;
+
+	};
+
+}
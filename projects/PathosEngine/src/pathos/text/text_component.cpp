@@ -49,8 +49,10 @@ namespace pathos {
 	}
 
 	void TextMeshComponent::setText(const wchar_t* inText) {
-		text = inText;
-		dynamicDataDirty = true;
+		if (text != inText) {
+			text = inText;
+			dynamicDataDirty = true;
+		}
 	}
 
 	void TextMeshComponent::setColor(float r, float g, float b) {
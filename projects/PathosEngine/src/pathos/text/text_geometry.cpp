@@ -5,9 +5,7 @@
 #include "pathos/util/string_conversion.h"
 
 #include "badger/types/int_types.h"
-
-#define COMPACT_FONT_GLYPH    1
-#define FLIP_GLYPH_V          0
+#include "badger/math/minmax.h"
 
 namespace pathos {
 
@@ -29,115 +27,53 @@ namespace pathos {
 		// Just skip rendering from higher interface.
 		CHECK(newText.size() > 0);
 
-		std::vector<GLfloat> positions;
-		std::vector<GLfloat> normals, tangentsDummy;
-		std::vector<GLfloat> uvs;
-		std::vector<GLuint> indices;
-
-		positions.clear();
-		uvs.clear();
-		indices.clear();
-
-		GLfloat penX = 0.0f;
-		GLfloat penY = cache.getCellHeight();
-		GLfloat penZ = 0.0f;
-		GLfloat u, v, du, dv;
-		GLuint idx = 0;
-
-		cache.startGetGlyph(cmdList);
-		for (wchar_t x : newText) {
-			if (x == L'\n') {
-				penX = 0.0f;
-				penY += cache.getCellHeight();
-				continue;
-			}
-			const GlyphInTexture& glyph = cache.getGlyph(cmdList, x);
-			// order: top-left, top-right, bottom-right, bottom-left
-			penY -= glyph.offsetY;
-
-#if COMPACT_FONT_GLYPH
-			const float dw = static_cast<float>(glyph.glyphWidth);
-			const float dh = static_cast<float>(glyph.glyphHeight);
-#else
-			const float dw = cache.getCellWidth();
-			const float dh = cache.getCellHeight();
-#endif
-
-			// v0
-			positions.push_back(penX);
-			positions.push_back(penY);
-			positions.push_back(penZ);
+		const TextLayout& layout = cache.layoutText(cmdList, newText.c_str(), (uint32)newText.size());
 
-			// v1
-			positions.push_back(penX + dw);
-			positions.push_back(penY);
-			positions.push_back(penZ);
+		// White spaces only. Keep a degenerate quad as buffers can't be empty.
+		const TextLayoutQuad emptyQuad{ vector4(0.0f), vector4(0.0f) };
+		const TextLayoutQuad* quads = layout.quads.size() > 0 ? layout.quads.data() : &emptyQuad;
+		const uint32 numQuads = badger::max(1u, (uint32)layout.quads.size());
 
-			// v2
-			positions.push_back(penX + dw);
-			positions.push_back(penY + dh);
-			positions.push_back(penZ);
+		std::vector<GLfloat> positions(numQuads * 4 * 3);
+		std::vector<GLfloat> uvs(numQuads * 4 * 2);
+		std::vector<GLuint> indices(numQuads * 6);
 
-			// v3
-			positions.push_back(penX);
-			positions.push_back(penY + dh);
-			positions.push_back(penZ);
+		for (uint32 i = 0; i < numQuads; ++i) {
+			const vector4& r = quads[i].rect;
+			const vector4& t = quads[i].uvRect;
 
-			penY += glyph.offsetY;
-
-			const float tw = static_cast<float>(cache.getTextureWidth());
-			const float th = static_cast<float>(cache.getTextureHeight());
-
-			u = glyph.x + (0.5f / tw);
-			v = glyph.y + (0.5f / th);
-#if COMPACT_FONT_GLYPH
-			du = glyph.glyphWidth - (1.0f / tw);
-			dv = glyph.glyphHeight - (1.0f / th);
-#else
-			du = glyph.width - (1.0f / tw);
-			dv = glyph.height - (1.0f / th);
-#endif
-
-#if FLIP_GLYPH_V
-			uvs.push_back(u); uvs.push_back(v + dv);
-			uvs.push_back(u + du); uvs.push_back(v + dv);
-			uvs.push_back(u + du); uvs.push_back(v);
-			uvs.push_back(u); uvs.push_back(v);
-#else
-			uvs.push_back(u); uvs.push_back(v);
-			uvs.push_back(u + du); uvs.push_back(v);
-			uvs.push_back(u + du); uvs.push_back(v + dv);
-			uvs.push_back(u); uvs.push_back(v + dv);
-#endif
-
-			indices.push_back(idx);
-			indices.push_back(idx + 2);
-			indices.push_back(idx + 1);
-			indices.push_back(idx);
-			indices.push_back(idx + 3);
-			indices.push_back(idx + 2);
-
-			if (x != L'\n') {
-				penX += glyph.advanceX;
-			}
-			idx += 4;
+			// order: top-left, top-right, bottom-right, bottom-left
+			GLfloat* p = &positions[i * 12];
+			p[0] = r.x; p[1]  = r.y; p[2]  = 0.0f;
+			p[3] = r.z; p[4]  = r.y; p[5]  = 0.0f;
+			p[6] = r.z; p[7]  = r.w; p[8]  = 0.0f;
+			p[9] = r.x; p[10] = r.w; p[11] = 0.0f;
+
+			GLfloat* uv = &uvs[i * 8];
+			uv[0] = t.x; uv[1] = t.y;
+			uv[2] = t.z; uv[3] = t.y;
+			uv[4] = t.z; uv[5] = t.w;
+			uv[6] = t.x; uv[7] = t.w;
+
+			const GLuint idx = i * 4;
+			GLuint* ix = &indices[i * 6];
+			ix[0] = idx; ix[1] = idx + 2; ix[2] = idx + 1;
+			ix[3] = idx; ix[4] = idx + 3; ix[5] = idx + 2;
 		}
-		cache.endGetGlyph(cmdList);
-
-		updatePositionData(&positions[0], static_cast<uint32>(positions.size()));
-		updateUVData(&uvs[0], static_cast<uint32>(uvs.size()));
-		updateIndexData(&indices[0], static_cast<uint32>(indices.size()));
 
-		if (normals.size() == 0) {
-			for (auto i = 0u; i < newText.size() * 4; ++i) {
-				normals.push_back(0.0f);
-				normals.push_back(0.0f);
-				normals.push_back(1.0f);
-				tangentsDummy.push_back(0.0f);
-				tangentsDummy.push_back(0.0f);
-				tangentsDummy.push_back(0.0f);
+		updatePositionData(positions.data(), static_cast<uint32>(positions.size()));
+		updateUVData(uvs.data(), static_cast<uint32>(uvs.size()));
+		updateIndexData(indices.data(), static_cast<uint32>(indices.size()));
+
+		// Normals and tangents are constant, so only resize them.
+		if (numNormals != numQuads * 4) {
+			numNormals = numQuads * 4;
+			std::vector<GLfloat> normals(numNormals * 3, 0.0f);
+			std::vector<GLfloat> tangentsDummy(numNormals * 3, 0.0f);
+			for (uint32 i = 0; i < numNormals; ++i) {
+				normals[i * 3 + 2] = 1.0f;
 			}
-			updateNormalData(&normals[0], static_cast<uint32>(normals.size()));
+			updateNormalData(normals.data(), static_cast<uint32>(normals.size()));
 			updateTangentData(tangentsDummy.data(), (uint32)tangentsDummy.size());
 			updateBitangentData(tangentsDummy.data(), (uint32)tangentsDummy.size());
 		}
@@ -19,8 +19,12 @@ namespace pathos {
 		uint32 getTextWidth(FontTextureCache& cache, const std::wstring& text) const;
 
 		// Update vertex and index buffers for new text.
+		// Glyph quads come from the layout cache of FontTextureCache.
 		void configure(RenderCommandList& cmdList, FontTextureCache& cache, const std::wstring& text);
-	
+
+	private:
+		uint32 numNormals = 0;
+
 	};
 
 }
@@ -0,0 +1,136 @@
+#include "text_layout_cache.h"
+
+#include "badger/assertion/assertion.h"
+
+#include <algorithm>
+#include <cwchar>
+#include <string_view>
+
+namespace pathos {
+
+	static uint64 hashText(const wchar_t* text, uint32 length) {
+		return std::hash<std::wstring_view>{}(std::wstring_view(text, length));
+	}
+
+	void TextLayoutCache::initialize(GlyphAtlas* inAtlas, float inLineHeight) {
+		CHECK(inAtlas != nullptr);
+		atlas = inAtlas;
+		lineHeight = inLineHeight;
+		clear();
+	}
+
+	void TextLayoutCache::clear() {
+		layouts.clear();
+	}
+
+	const TextLayout* TextLayoutCache::findValidLayout(const wchar_t* text, uint32 length) {
+		TextLayout* layout = findLayout(text, length, hashText(text, length));
+		if (layout == nullptr || !isLayoutValid(*layout)) {
+			return nullptr;
+		}
+		atlas->beginUse();
+		for (const auto& shelf : layout->shelves) {
+			atlas->touchShelf(shelf.first);
+		}
+		layout->lastUsedFrame = frameCounter;
+		return layout;
+	}
+
+	const TextLayout& TextLayoutCache::buildLayout(const wchar_t* text, uint32 length, const GetGlyphFunc& getGlyph) {
+		const uint64 hash = hashText(text, length);
+		TextLayout* layout = findLayout(text, length, hash);
+		if (layout == nullptr) {
+			auto it = layouts.emplace(hash, TextLayout{});
+			layout = &(it->second);
+			layout->text.assign(text, length);
+		}
+
+		// Glyphs of this text are not evicted by each other unless the text doesn't fit in the atlas.
+		atlas->beginUse();
+
+		const float tw = static_cast<float>(atlas->getWidth());
+		const float th = static_cast<float>(atlas->getHeight());
+		float penX = 0.0f;
+		float penY = lineHeight;
+
+		layout->quads.clear();
+		layout->quads.reserve(length);
+		layout->shelves.clear();
+
+		GlyphInTexture glyph;
+		for (wchar_t x : layout->text) {
+			if (x == L'\n') {
+				penX = 0.0f;
+				penY += lineHeight;
+				continue;
+			}
+			const int32 slot = getGlyph(x, glyph);
+			if (slot == GlyphAtlas::INVALID_SLOT) {
+				continue;
+			}
+			const uint32 shelf = atlas->getSlot(slot).shelf;
+			if (shelf != GlyphAtlas::INVALID_SHELF) {
+				const auto entry = std::make_pair(shelf, atlas->getShelfGeneration(shelf));
+				if (std::find(layout->shelves.begin(), layout->shelves.end(), entry) == layout->shelves.end()) {
+					layout->shelves.push_back(entry);
+				}
+			}
+			if (glyph.glyphWidth > 0.0f && glyph.glyphHeight > 0.0f) {
+				const float top = penY - glyph.offsetY;
+				const float u = glyph.x + (0.5f / tw);
+				const float v = glyph.y + (0.5f / th);
+				const float du = glyph.glyphWidth - (1.0f / tw);
+				const float dv = glyph.glyphHeight - (1.0f / th);
+
+				TextLayoutQuad quad;
+				quad.rect = vector4(penX, top, penX + glyph.glyphWidth, top + glyph.glyphHeight);
+				quad.uvRect = vector4(u, v, u + du, v + dv);
+				layout->quads.push_back(quad);
+			}
+			penX += glyph.advanceX;
+		}
+
+		// A text that doesn't fit in the atlas evicts its own glyphs. Don't reuse such a layout.
+		for (const auto& shelf : layout->shelves) {
+			if (!atlas->isShelfValid(shelf.first, shelf.second)) {
+				layout->shelves.push_back(std::make_pair(GlyphAtlas::INVALID_SHELF, 0u));
+				break;
+			}
+		}
+
+		layout->lastUsedFrame = frameCounter;
+		return *layout;
+	}
+
+	void TextLayoutCache::onFrameEnd() {
+		++frameCounter;
+		for (auto it = layouts.begin(); it != layouts.end(); ) {
+			if (frameCounter - it->second.lastUsedFrame > MAX_LAYOUT_AGE) {
+				it = layouts.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+
+	TextLayout* TextLayoutCache::findLayout(const wchar_t* text, uint32 length, uint64 hash) {
+		auto range = layouts.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it) {
+			const std::wstring& cached = it->second.text;
+			if (cached.size() == length && std::wmemcmp(cached.data(), text, length) == 0) {
+				return &(it->second);
+			}
+		}
+		return nullptr;
+	}
+
+	bool TextLayoutCache::isLayoutValid(const TextLayout& layout) const {
+		for (const auto& shelf : layout.shelves) {
+			if (!atlas->isShelfValid(shelf.first, shelf.second)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+}
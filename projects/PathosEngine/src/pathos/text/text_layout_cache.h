@@ -0,0 +1,83 @@
+#pragma once
+
+#include "pathos/text/glyph_atlas.h"
+
+#include "badger/types/noncopyable.h"
+#include "badger/types/int_types.h"
+#include "badger/types/vector_types.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <functional>
+
+namespace pathos {
+
+	// A glyph packed in the cache texture.
+	struct GlyphInTexture {
+		wchar_t ch;              // Character
+		float x, y;              // Position in uv space
+		float width, height;     // Size of the packed rect in uv space (same as glyphWidth and glyphHeight)
+		float advanceX, offsetY;
+
+		float glyphWidth;        // Width in uv space
+		float glyphHeight;       // Height in uv space
+		int glyphPixelsX;        // Width in texels
+		int glyphPixelsY;        // Height in texels
+	};
+
+	// Glyph quad of a laid out text. Glyphs without a bitmap are skipped.
+	struct TextLayoutQuad {
+		vector4 rect;            // (x0, y0, x1, y1) in uv units of the cache texture. Pen starts at (0, lineHeight).
+		vector4 uvRect;          // UV at (x0, y0) and (x1, y1)
+	};
+
+	// Result of laying out a text with a cache. Valid until one of its glyphs is evicted.
+	struct TextLayout {
+		std::wstring text;
+		std::vector<TextLayoutQuad> quads;
+		std::vector<std::pair<uint32, uint32>> shelves; // (shelf, generation) in the glyph atlas
+		uint32 lastUsedFrame = 0;
+	};
+
+	// Finds a glyph in the atlas or inserts it.
+	// Returns the atlas slot and fills outGlyph, or returns GlyphAtlas::INVALID_SLOT.
+	using GetGlyphFunc = std::function<int32(wchar_t ch, GlyphInTexture& outGlyph)>;
+
+	// Layouts of texts drawn with a glyph atlas, keyed by the text.
+	// A layout is reused while none of the atlas shelves it refers to is evicted.
+	// Rasterizing and uploading glyphs are up to the owner, see FontTextureCache.
+	class TextLayoutCache : public Noncopyable {
+
+	public:
+		// Layouts not used for this many frames are removed.
+		constexpr static uint32 MAX_LAYOUT_AGE = 120;
+
+		// lineHeight is in uv units of the atlas.
+		void initialize(GlyphAtlas* inAtlas, float inLineHeight);
+		void clear();
+
+		// Returns the layout of the text if all of its glyphs are still in the atlas, or nullptr.
+		// The shelves of the layout are marked as used.
+		const TextLayout* findValidLayout(const wchar_t* text, uint32 length);
+
+		// Lays out the text again. Missing glyphs are inserted by getGlyph, which might evict glyphs of other layouts.
+		const TextLayout& buildLayout(const wchar_t* text, uint32 length, const GetGlyphFunc& getGlyph);
+
+		// Removes layouts that were not used for MAX_LAYOUT_AGE frames.
+		void onFrameEnd();
+
+		inline uint32 getNumLayouts() const { return (uint32)layouts.size(); }
+
+	private:
+		TextLayout* findLayout(const wchar_t* text, uint32 length, uint64 hash);
+		bool isLayoutValid(const TextLayout& layout) const;
+
+		GlyphAtlas* atlas = nullptr;
+		float lineHeight = 0.0f;
+
+		std::unordered_multimap<uint64, TextLayout> layouts; // Keyed by the hash of text
+		uint32 frameCounter = 0;
+
+	};
+
+}
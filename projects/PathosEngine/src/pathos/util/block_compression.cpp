@@ -0,0 +1,606 @@
+#include "block_compression.h"
+
+#include <glm/gtc/packing.hpp>
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+namespace pathos {
+
+	static constexpr uint32 BLOCK_TEXELS = 16;
+
+	// BC7 interpolation weights for 4-bit indices, out of 64.
+	static const uint32 BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	static void loadTexels(const uint8* rgba, float outTexels[BLOCK_TEXELS][4]) {
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			for (uint32 c = 0; c < 4; ++c) {
+				outTexels[i][c] = (float)rgba[i * 4 + c];
+			}
+		}
+	}
+
+	// Principal axis of the block by power iteration on the covariance matrix,
+	// then the extreme projections along the axis as initial endpoints.
+	static void fitEndpointsPCA(const float texels[BLOCK_TEXELS][4], uint32 numChannels, float outLow[4], float outHigh[4]) {
+		float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			for (uint32 c = 0; c < numChannels; ++c) mean[c] += texels[i][c];
+		}
+		for (uint32 c = 0; c < numChannels; ++c) mean[c] /= (float)BLOCK_TEXELS;
+
+		float cov[4][4] = {};
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			float d[4];
+			for (uint32 c = 0; c < numChannels; ++c) d[c] = texels[i][c] - mean[c];
+			for (uint32 a = 0; a < numChannels; ++a) {
+				for (uint32 b = 0; b < numChannels; ++b) cov[a][b] += d[a] * d[b];
+			}
+		}
+
+		float axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		for (uint32 iter = 0; iter < 8; ++iter) {
+			float v[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			float maxComponent = 0.0f;
+			for (uint32 a = 0; a < numChannels; ++a) {
+				for (uint32 b = 0; b < numChannels; ++b) v[a] += cov[a][b] * axis[b];
+				maxComponent = std::max(maxComponent, std::abs(v[a]));
+			}
+			if (maxComponent < 1e-6f) {
+				break;
+			}
+			for (uint32 c = 0; c < numChannels; ++c) axis[c] = v[c] / maxComponent;
+		}
+		float axisLength = 0.0f;
+		for (uint32 c = 0; c < numChannels; ++c) axisLength += axis[c] * axis[c];
+		axisLength = std::sqrt(axisLength);
+		for (uint32 c = 0; c < numChannels; ++c) axis[c] /= axisLength;
+
+		float minT = 0.0f, maxT = 0.0f;
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			float t = 0.0f;
+			for (uint32 c = 0; c < numChannels; ++c) t += (texels[i][c] - mean[c]) * axis[c];
+			minT = std::min(minT, t);
+			maxT = std::max(maxT, t);
+		}
+		for (uint32 c = 0; c < numChannels; ++c) {
+			outLow[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * minT));
+			outHigh[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * maxT));
+		}
+	}
+
+	// Least squares endpoints for fixed indices. weights[i] is the contribution of the second endpoint to texel i.
+	// @return false if every texel uses the same weight.
+	static bool refineEndpoints(const float texels[BLOCK_TEXELS][4], const float weights[BLOCK_TEXELS], uint32 numChannels, float outFirst[4], float outSecond[4]) {
+		float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+		float ax[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, bx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			const float b = weights[i], a = 1.0f - b;
+			aa += a * a;
+			ab += a * b;
+			bb += b * b;
+			for (uint32 c = 0; c < numChannels; ++c) {
+				ax[c] += a * texels[i][c];
+				bx[c] += b * texels[i][c];
+			}
+		}
+		const float det = aa * bb - ab * ab;
+		if (std::abs(det) < 1e-6f) {
+			return false;
+		}
+		for (uint32 c = 0; c < numChannels; ++c) {
+			outFirst[c] = std::min(255.0f, std::max(0.0f, (ax[c] * bb - bx[c] * ab) / det));
+			outSecond[c] = std::min(255.0f, std::max(0.0f, (bx[c] * aa - ax[c] * ab) / det));
+		}
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// BC1
+
+	static uint16 packRGB565(const float rgb[4]) {
+		const uint32 r = (uint32)(rgb[0] * (31.0f / 255.0f) + 0.5f);
+		const uint32 g = (uint32)(rgb[1] * (63.0f / 255.0f) + 0.5f);
+		const uint32 b = (uint32)(rgb[2] * (31.0f / 255.0f) + 0.5f);
+		return (uint16)((r << 11) | (g << 5) | b);
+	}
+
+	static void unpackRGB565(uint16 color, int32 outRGB[3]) {
+		const int32 r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+		outRGB[0] = (r << 3) | (r >> 2);
+		outRGB[1] = (g << 2) | (g >> 4);
+		outRGB[2] = (b << 3) | (b >> 2);
+	}
+
+	// Palette of the 4-color mode.
+	static void makeBC1Palette(uint16 c0, uint16 c1, int32 outPalette[4][3]) {
+		unpackRGB565(c0, outPalette[0]);
+		unpackRGB565(c1, outPalette[1]);
+		for (uint32 c = 0; c < 3; ++c) {
+			outPalette[2][c] = (2 * outPalette[0][c] + outPalette[1][c]) / 3;
+			outPalette[3][c] = (outPalette[0][c] + 2 * outPalette[1][c]) / 3;
+		}
+	}
+
+	static float selectBC1Indices(const float texels[BLOCK_TEXELS][4], uint16 c0, uint16 c1, uint32& outIndices) {
+		int32 palette[4][3];
+		makeBC1Palette(c0, c1, palette);
+		float totalError = 0.0f;
+		outIndices = 0;
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			uint32 bestIx = 0;
+			float bestError = 1e30f;
+			for (uint32 p = 0; p < 4; ++p) {
+				float error = 0.0f;
+				for (uint32 c = 0; c < 3; ++c) {
+					const float d = texels[i][c] - (float)palette[p][c];
+					error += d * d;
+				}
+				if (error < bestError) {
+					bestError = error;
+					bestIx = p;
+				}
+			}
+			outIndices |= bestIx << (2 * i);
+			totalError += bestError;
+		}
+		return totalError;
+	}
+
+	static void encodeBC1Texels(const float texels[BLOCK_TEXELS][4], uint8* outBlock) {
+		float low[4], high[4];
+		fitEndpointsPCA(texels, 3, low, high);
+		uint16 c0 = packRGB565(high), c1 = packRGB565(low);
+		uint32 indices;
+		float error = selectBC1Indices(texels, c0, c1, indices);
+
+		static const float weightOfC1[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+		float weights[BLOCK_TEXELS];
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			weights[i] = weightOfC1[(indices >> (2 * i)) & 3];
+		}
+		float first[4], second[4];
+		if (refineEndpoints(texels, weights, 3, first, second)) {
+			const uint16 r0 = packRGB565(first), r1 = packRGB565(second);
+			uint32 refinedIndices;
+			const float refinedError = selectBC1Indices(texels, r0, r1, refinedIndices);
+			if (refinedError < error) {
+				c0 = r0;
+				c1 = r1;
+				indices = refinedIndices;
+			}
+		}
+
+		// c0 > c1 selects the 4-color mode. Swapping the endpoints maps index 0<->1 and 2<->3.
+		if (c0 < c1) {
+			std::swap(c0, c1);
+			indices ^= 0x55555555;
+		} else if (c0 == c1) {
+			indices = 0;
+		}
+		outBlock[0] = (uint8)(c0 & 0xff);
+		outBlock[1] = (uint8)(c0 >> 8);
+		outBlock[2] = (uint8)(c1 & 0xff);
+		outBlock[3] = (uint8)(c1 >> 8);
+		for (uint32 i = 0; i < 4; ++i) {
+			outBlock[4 + i] = (uint8)((indices >> (8 * i)) & 0xff);
+		}
+	}
+
+	void encodeBC1Block(const uint8* rgba, uint8* outBlock) {
+		float texels[BLOCK_TEXELS][4];
+		loadTexels(rgba, texels);
+		encodeBC1Texels(texels, outBlock);
+	}
+
+	void decodeBC1Block(const uint8* block, uint8* outRGBA) {
+		const uint16 c0 = (uint16)(block[0] | (block[1] << 8));
+		const uint16 c1 = (uint16)(block[2] | (block[3] << 8));
+		const uint32 indices = (uint32)block[4] | ((uint32)block[5] << 8) | ((uint32)block[6] << 16) | ((uint32)block[7] << 24);
+
+		int32 palette[4][4];
+		unpackRGB565(c0, palette[0]);
+		unpackRGB565(c1, palette[1]);
+		palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+		for (uint32 c = 0; c < 3; ++c) {
+			if (c0 > c1) {
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			} else {
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+				palette[3][c] = 0;
+			}
+		}
+		if (c0 <= c1) {
+			palette[3][3] = 0;
+		}
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			const uint32 ix = (indices >> (2 * i)) & 3;
+			for (uint32 c = 0; c < 4; ++c) {
+				outRGBA[i * 4 + c] = (uint8)palette[ix][c];
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// BC4, BC3, BC5
+
+	static void makeBC4Palette(uint32 a0, uint32 a1, uint32 outPalette[8]) {
+		outPalette[0] = a0;
+		outPalette[1] = a1;
+		if (a0 > a1) {
+			for (uint32 i = 2; i < 8; ++i) {
+				outPalette[i] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+			}
+		} else {
+			for (uint32 i = 2; i < 6; ++i) {
+				outPalette[i] = ((6 - i) * a0 + (i - 1) * a1 + 2) / 5;
+			}
+			outPalette[6] = 0;
+			outPalette[7] = 255;
+		}
+	}
+
+	void encodeBC4Block(const uint8* values, uint8* outBlock) {
+		uint32 minValue = 255, maxValue = 0;
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			minValue = std::min(minValue, (uint32)values[i]);
+			maxValue = std::max(maxValue, (uint32)values[i]);
+		}
+		// a0 > a1 selects the 8-value mode. If the block is flat, every index refers to a0.
+		uint32 palette[8];
+		makeBC4Palette(maxValue, minValue, palette);
+		uint64 indices = 0;
+		if (maxValue != minValue) {
+			for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+				uint32 bestIx = 0, bestError = 0xffffffff;
+				for (uint32 p = 0; p < 8; ++p) {
+					const int32 d = (int32)values[i] - (int32)palette[p];
+					const uint32 error = (uint32)(d * d);
+					if (error < bestError) {
+						bestError = error;
+						bestIx = p;
+					}
+				}
+				indices |= (uint64)bestIx << (3 * i);
+			}
+		}
+		outBlock[0] = (uint8)maxValue;
+		outBlock[1] = (uint8)minValue;
+		for (uint32 i = 0; i < 6; ++i) {
+			outBlock[2 + i] = (uint8)((indices >> (8 * i)) & 0xff);
+		}
+	}
+
+	void decodeBC4Block(const uint8* block, uint8* outValues) {
+		uint32 palette[8];
+		makeBC4Palette(block[0], block[1], palette);
+		uint64 indices = 0;
+		for (uint32 i = 0; i < 6; ++i) {
+			indices |= (uint64)block[2 + i] << (8 * i);
+		}
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			outValues[i] = (uint8)palette[(indices >> (3 * i)) & 7];
+		}
+	}
+
+	static void extractChannel(const uint8* rgba, uint32 channel, uint8 outValues[BLOCK_TEXELS]) {
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			outValues[i] = rgba[i * 4 + channel];
+		}
+	}
+
+	void encodeBC3Block(const uint8* rgba, uint8* outBlock) {
+		uint8 alpha[BLOCK_TEXELS];
+		extractChannel(rgba, 3, alpha);
+		encodeBC4Block(alpha, outBlock);
+		// The color block of BC3 is always decoded in the 4-color mode, which encodeBC1Block() already assumes.
+		encodeBC1Block(rgba, outBlock + 8);
+	}
+
+	void encodeBC5Block(const uint8* rgba, uint8* outBlock) {
+		uint8 values[BLOCK_TEXELS];
+		extractChannel(rgba, 0, values);
+		encodeBC4Block(values, outBlock);
+		extractChannel(rgba, 1, values);
+		encodeBC4Block(values, outBlock + 8);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// BC7
+
+	class BC7BitWriter {
+	public:
+		BC7BitWriter(uint8* inBlock) : block(inBlock), position(0) {
+			::memset(block, 0, 16);
+		}
+		void write(uint32 value, uint32 numBits) {
+			for (uint32 i = 0; i < numBits; ++i, ++position) {
+				block[position >> 3] |= (uint8)(((value >> i) & 1) << (position & 7));
+			}
+		}
+	private:
+		uint8* block;
+		uint32 position;
+	};
+
+	class BC7BitReader {
+	public:
+		BC7BitReader(const uint8* inBlock) : block(inBlock), position(0) {}
+		uint32 read(uint32 numBits) {
+			uint32 value = 0;
+			for (uint32 i = 0; i < numBits; ++i, ++position) {
+				value |= (uint32)((block[position >> 3] >> (position & 7)) & 1) << i;
+			}
+			return value;
+		}
+	private:
+		const uint8* block;
+		uint32 position;
+	};
+
+	// 7 bits per channel plus a p-bit shared by the channels of the endpoint.
+	static void quantizeBC7Endpoint(const float endpoint[4], uint32 outQuantized[4], uint32& outPBit) {
+		float bestError = 1e30f;
+		for (uint32 p = 0; p < 2; ++p) {
+			uint32 q[4];
+			float error = 0.0f;
+			for (uint32 c = 0; c < 4; ++c) {
+				const float x = (endpoint[c] - (float)p) * 0.5f;
+				q[c] = (uint32)std::min(127.0f, std::max(0.0f, std::floor(x + 0.5f)));
+				const float d = endpoint[c] - (float)((q[c] << 1) | p);
+				error += d * d;
+			}
+			if (error < bestError) {
+				bestError = error;
+				outPBit = p;
+				::memcpy(outQuantized, q, sizeof(q));
+			}
+		}
+	}
+
+	static void makeBC7Palette(const uint32 q0[4], uint32 p0, const uint32 q1[4], uint32 p1, uint32 outPalette[16][4]) {
+		for (uint32 c = 0; c < 4; ++c) {
+			const uint32 e0 = (q0[c] << 1) | p0;
+			const uint32 e1 = (q1[c] << 1) | p1;
+			for (uint32 i = 0; i < 16; ++i) {
+				outPalette[i][c] = ((64 - BC7_WEIGHTS4[i]) * e0 + BC7_WEIGHTS4[i] * e1 + 32) >> 6;
+			}
+		}
+	}
+
+	static float selectBC7Indices(const float texels[BLOCK_TEXELS][4], const uint32 palette[16][4], uint32 outIndices[BLOCK_TEXELS]) {
+		float totalError = 0.0f;
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			float bestError = 1e30f;
+			for (uint32 p = 0; p < 16; ++p) {
+				float error = 0.0f;
+				for (uint32 c = 0; c < 4; ++c) {
+					const float d = texels[i][c] - (float)palette[p][c];
+					error += d * d;
+				}
+				if (error < bestError) {
+					bestError = error;
+					outIndices[i] = p;
+				}
+			}
+			totalError += bestError;
+		}
+		return totalError;
+	}
+
+	void encodeBC7Block(const uint8* rgba, uint8* outBlock) {
+		float texels[BLOCK_TEXELS][4];
+		loadTexels(rgba, texels);
+
+		float endpoints[2][4];
+		fitEndpointsPCA(texels, 4, endpoints[0], endpoints[1]);
+
+		uint32 q[2][4], pbits[2], indices[BLOCK_TEXELS];
+		uint32 palette[16][4];
+		quantizeBC7Endpoint(endpoints[0], q[0], pbits[0]);
+		quantizeBC7Endpoint(endpoints[1], q[1], pbits[1]);
+		makeBC7Palette(q[0], pbits[0], q[1], pbits[1], palette);
+		float error = selectBC7Indices(texels, palette, indices);
+
+		float weights[BLOCK_TEXELS];
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			weights[i] = (float)BC7_WEIGHTS4[indices[i]] / 64.0f;
+		}
+		if (refineEndpoints(texels, weights, 4, endpoints[0], endpoints[1])) {
+			uint32 rq[2][4], rpbits[2], rindices[BLOCK_TEXELS];
+			quantizeBC7Endpoint(endpoints[0], rq[0], rpbits[0]);
+			quantizeBC7Endpoint(endpoints[1], rq[1], rpbits[1]);
+			makeBC7Palette(rq[0], rpbits[0], rq[1], rpbits[1], palette);
+			const float refinedError = selectBC7Indices(texels, palette, rindices);
+			if (refinedError < error) {
+				::memcpy(q, rq, sizeof(q));
+				::memcpy(pbits, rpbits, sizeof(pbits));
+				::memcpy(indices, rindices, sizeof(indices));
+			}
+		}
+
+		// The MSB of the anchor index is implicitly zero.
+		if (indices[0] & 8) {
+			for (uint32 c = 0; c < 4; ++c) std::swap(q[0][c], q[1][c]);
+			std::swap(pbits[0], pbits[1]);
+			for (uint32 i = 0; i < BLOCK_TEXELS; ++i) indices[i] = 15 - indices[i];
+		}
+
+		BC7BitWriter writer(outBlock);
+		writer.write(1 << 6, 7); // mode 6
+		for (uint32 c = 0; c < 4; ++c) {
+			writer.write(q[0][c], 7);
+			writer.write(q[1][c], 7);
+		}
+		writer.write(pbits[0], 1);
+		writer.write(pbits[1], 1);
+		writer.write(indices[0], 3);
+		for (uint32 i = 1; i < BLOCK_TEXELS; ++i) {
+			writer.write(indices[i], 4);
+		}
+	}
+
+	bool decodeBC7Block(const uint8* block, uint8* outRGBA) {
+		BC7BitReader reader(block);
+		if (reader.read(7) != (1 << 6)) {
+			return false;
+		}
+		uint32 q[2][4], pbits[2];
+		for (uint32 c = 0; c < 4; ++c) {
+			q[0][c] = reader.read(7);
+			q[1][c] = reader.read(7);
+		}
+		pbits[0] = reader.read(1);
+		pbits[1] = reader.read(1);
+
+		uint32 palette[16][4];
+		makeBC7Palette(q[0], pbits[0], q[1], pbits[1], palette);
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			const uint32 ix = reader.read(i == 0 ? 3 : 4);
+			for (uint32 c = 0; c < 4; ++c) {
+				outRGBA[i * 4 + c] = (uint8)palette[ix][c];
+			}
+		}
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// BC6H
+
+	// Unsigned BC6H interpolates 16-bit unquantized endpoints and scales the result by 31/64
+	// into the bits of a half float, so texels are fitted on their half bits, not on linear values.
+	static constexpr float BC6H_MAX_HALF = 65504.0f;
+
+	// Unquantized values are scaled to [0, 255], so the endpoint fitting of BC7 can be reused.
+	static void loadHDRTexels(const float* rgba, float outTexels[BLOCK_TEXELS][4]) {
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			for (uint32 c = 0; c < 3; ++c) {
+				// Negative and NaN are not representable in the unsigned format.
+				const float x = (rgba[i * 4 + c] > 0.0f) ? std::min(rgba[i * 4 + c], BC6H_MAX_HALF) : 0.0f;
+				outTexels[i][c] = (float)glm::packHalf1x16(x) * (64.0f / 31.0f) / 257.0f;
+			}
+			outTexels[i][3] = 0.0f;
+		}
+	}
+
+	// 10 bits per channel (mode 11).
+	static void quantizeBC6HEndpoint(const float endpoint[4], uint32 outQuantized[3]) {
+		for (uint32 c = 0; c < 3; ++c) {
+			const float x = (endpoint[c] * 257.0f - 32.0f) / 64.0f;
+			outQuantized[c] = (uint32)std::min(1023.0f, std::max(0.0f, std::floor(x + 0.5f)));
+		}
+	}
+
+	static uint32 unquantizeBC6HEndpoint(uint32 q) {
+		if (q == 0) return 0;
+		if (q == 1023) return 0xFFFF;
+		return ((q << 16) + 0x8000) >> 10;
+	}
+
+	// Palette in [0, 0xFFFF] before the final 31/64 scale. BC6H uses the same weights as BC7.
+	static void makeBC6HPalette(const uint32 q0[3], const uint32 q1[3], uint32 outPalette[16][3]) {
+		for (uint32 c = 0; c < 3; ++c) {
+			const uint32 e0 = unquantizeBC6HEndpoint(q0[c]);
+			const uint32 e1 = unquantizeBC6HEndpoint(q1[c]);
+			for (uint32 i = 0; i < 16; ++i) {
+				outPalette[i][c] = ((64 - BC7_WEIGHTS4[i]) * e0 + BC7_WEIGHTS4[i] * e1 + 32) >> 6;
+			}
+		}
+	}
+
+	static float selectBC6HIndices(const float texels[BLOCK_TEXELS][4], const uint32 palette[16][3], uint32 outIndices[BLOCK_TEXELS]) {
+		float totalError = 0.0f;
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			float bestError = 1e30f;
+			for (uint32 p = 0; p < 16; ++p) {
+				float error = 0.0f;
+				for (uint32 c = 0; c < 3; ++c) {
+					const float d = texels[i][c] - (float)palette[p][c] / 257.0f;
+					error += d * d;
+				}
+				if (error < bestError) {
+					bestError = error;
+					outIndices[i] = p;
+				}
+			}
+			totalError += bestError;
+		}
+		return totalError;
+	}
+
+	void encodeBC6HBlock(const float* rgba, uint8* outBlock) {
+		float texels[BLOCK_TEXELS][4];
+		loadHDRTexels(rgba, texels);
+
+		float endpoints[2][4];
+		fitEndpointsPCA(texels, 3, endpoints[0], endpoints[1]);
+
+		uint32 q[2][3], indices[BLOCK_TEXELS];
+		uint32 palette[16][3];
+		quantizeBC6HEndpoint(endpoints[0], q[0]);
+		quantizeBC6HEndpoint(endpoints[1], q[1]);
+		makeBC6HPalette(q[0], q[1], palette);
+		float error = selectBC6HIndices(texels, palette, indices);
+
+		float weights[BLOCK_TEXELS];
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			weights[i] = (float)BC7_WEIGHTS4[indices[i]] / 64.0f;
+		}
+		if (refineEndpoints(texels, weights, 3, endpoints[0], endpoints[1])) {
+			uint32 rq[2][3], rindices[BLOCK_TEXELS];
+			quantizeBC6HEndpoint(endpoints[0], rq[0]);
+			quantizeBC6HEndpoint(endpoints[1], rq[1]);
+			makeBC6HPalette(rq[0], rq[1], palette);
+			const float refinedError = selectBC6HIndices(texels, palette, rindices);
+			if (refinedError < error) {
+				::memcpy(q, rq, sizeof(q));
+				::memcpy(indices, rindices, sizeof(indices));
+			}
+		}
+
+		// The MSB of the anchor index is implicitly zero.
+		if (indices[0] & 8) {
+			for (uint32 c = 0; c < 3; ++c) std::swap(q[0][c], q[1][c]);
+			for (uint32 i = 0; i < BLOCK_TEXELS; ++i) indices[i] = 15 - indices[i];
+		}
+
+		// Same bit order as BC7.
+		BC7BitWriter writer(outBlock);
+		writer.write(0x03, 5); // mode 11
+		for (uint32 e = 0; e < 2; ++e) {
+			for (uint32 c = 0; c < 3; ++c) {
+				writer.write(q[e][c], 10);
+			}
+		}
+		writer.write(indices[0], 3);
+		for (uint32 i = 1; i < BLOCK_TEXELS; ++i) {
+			writer.write(indices[i], 4);
+		}
+	}
+
+	bool decodeBC6HBlock(const uint8* block, float* outRGBA) {
+		BC7BitReader reader(block);
+		if (reader.read(5) != 0x03) {
+			return false;
+		}
+		uint32 q[2][3];
+		for (uint32 e = 0; e < 2; ++e) {
+			for (uint32 c = 0; c < 3; ++c) {
+				q[e][c] = reader.read(10);
+			}
+		}
+
+		uint32 palette[16][3];
+		makeBC6HPalette(q[0], q[1], palette);
+		for (uint32 i = 0; i < BLOCK_TEXELS; ++i) {
+			const uint32 ix = reader.read(i == 0 ? 3 : 4);
+			for (uint32 c = 0; c < 3; ++c) {
+				outRGBA[i * 4 + c] = glm::unpackHalf1x16((uint16)((palette[ix][c] * 31) >> 6));
+			}
+			outRGBA[i * 4 + 3] = 1.0f;
+		}
+		return true;
+	}
+
+}
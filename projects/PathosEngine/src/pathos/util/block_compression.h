@@ -0,0 +1,41 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+
+// CPU encoders for BCn texture blocks.
+// Every function works on a single 4x4 block. Input texels are row-major; rgba is 16 x RGBA8 and values is 16 x uint8.
+// Encoders are thread-safe, so callers can split an image into tiles and compress them in parallel.
+
+namespace pathos {
+
+	constexpr uint32 BC_BLOCK_SIZE = 4;
+
+	/// 8 bytes. Always uses the 4-color mode; alpha is ignored.
+	void encodeBC1Block(const uint8* rgba, uint8* outBlock);
+
+	/// 8 bytes. Single channel with 8 interpolated values.
+	void encodeBC4Block(const uint8* values, uint8* outBlock);
+
+	/// 16 bytes. BC4 alpha followed by BC1 color.
+	void encodeBC3Block(const uint8* rgba, uint8* outBlock);
+
+	/// 16 bytes. Two BC4 blocks for the red and green channels.
+	void encodeBC5Block(const uint8* rgba, uint8* outBlock);
+
+	/// 16 bytes. Only mode 6 (one subset, RGBA 7.7.7.7 endpoints with p-bits, 4-bit indices) is searched.
+	/// Other modes would improve blocks with several distinct colors, but mode 6 is a good quality baseline.
+	void encodeBC7Block(const uint8* rgba, uint8* outBlock);
+
+	/// 16 bytes. Unsigned half float RGB; rgba is 16 x RGBA32F and alpha is ignored.
+	/// Only mode 11 (one region, 10-bit endpoints, 4-bit indices) is searched. Negative values are clamped to zero.
+	void encodeBC6HBlock(const float* rgba, uint8* outBlock);
+
+	// Decoders for validation and tests.
+	void decodeBC1Block(const uint8* block, uint8* outRGBA);
+	void decodeBC4Block(const uint8* block, uint8* outValues);
+	/// @return false if the block is not in mode 6.
+	bool decodeBC7Block(const uint8* block, uint8* outRGBA);
+	/// Writes 16 x RGBA32F with alpha of 1. @return false if the block is not in mode 11.
+	bool decodeBC6HBlock(const uint8* block, float* outRGBA);
+
+}
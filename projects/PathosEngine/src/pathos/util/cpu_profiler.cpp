@@ -9,33 +9,70 @@
 #include <fstream>
 #include <sstream>
 #include <utility>
+#include <cstring>
 
 namespace pathos {
 
-	// #todo-cpu: Cleanup everything periodically for now
-	static constexpr size_t PURGE_BETWEEN_CHECKPOINTS = 256;
-	static constexpr size_t PURGE_ITEMS_AFTER = 2048;
+	static constexpr double TICKS_TO_MS = 1000.0 * (double)std::chrono::steady_clock::period::num / (double)std::chrono::steady_clock::period::den;
 
-	ScopedCpuCounter::ScopedCpuCounter(const char* inName)
-		: name(inName)
-	{
+	static thread_local ProfilePerThread* tls_profile = nullptr;
+
+	ScopedCpuCounter::ScopedCpuCounter(const char* inName, bool bCopyName) {
 		CHECK(inName != nullptr);
-		threadId = CPU::getCurrentThreadId();
+		profile = CpuProfiler::getInstance().getCurrentThreadProfile();
+		eventIndex = profile->beginEvent(inName, bCopyName);
+	}
 
-		// #todo-cpu: Temp logic for periodic purge
-		purge_milestone = CpuProfiler::getInstance().purge_milestone.load();
+	ScopedCpuCounter::~ScopedCpuCounter() {
+		profile->finishEvent(eventIndex);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
 
-		itemHandle = CpuProfiler::getInstance().beginItem(threadId, name.c_str());
+	ProfilePerThread::ProfilePerThread(PlatformThreadId inThreadId, std::string&& inDebugName)
+		: threadId(inThreadId)
+		, threadName(std::move(inDebugName))
+		, events(new ProfileEvent[EVENT_CAPACITY])
+		, numEvents(0)
+		, names(new char[NAME_CAPACITY * NAME_LENGTH])
+		, numNames(0)
+		, currentTab(0)
+	{
 	}
 
-	ScopedCpuCounter::~ScopedCpuCounter() {
-		// #todo-cpu: Temp logic for periodic purge
-		const uint32 currentMilestone = CpuProfiler::getInstance().purge_milestone.load();
-		if (currentMilestone > purge_milestone) {
-			return;
+	uint64 ProfilePerThread::beginEvent(const char* name, bool bCopyName) {
+		const uint64 eventIndex = numEvents.load(std::memory_order_relaxed);
+		ProfileEvent& event = events[eventIndex & (EVENT_CAPACITY - 1)];
+
+		event.nameSerial = 0;
+		if (bCopyName) {
+			const uint64 nameIndex = numNames.load(std::memory_order_relaxed);
+			char* nameCopy = &names[(nameIndex % NAME_CAPACITY) * NAME_LENGTH];
+			const size_t len = strnlen(name, NAME_LENGTH - 1);
+			memcpy(nameCopy, name, len);
+			nameCopy[len] = 0;
+			numNames.store(nameIndex + 1, std::memory_order_release);
+
+			name = nameCopy;
+			event.nameSerial = nameIndex + 1;
 		}
+		event.name = name;
+		event.tab = currentTab++;
+		event.endTicks.store(0, std::memory_order_relaxed);
+		event.startTicks = CpuProfiler::readClock();
+
+		numEvents.store(eventIndex + 1, std::memory_order_release);
+		return eventIndex;
+	}
+
+	void ProfilePerThread::finishEvent(uint64 eventIndex) {
+		const int64 endTicks = CpuProfiler::readClock();
+		currentTab -= 1;
 
-		CpuProfiler::getInstance().finishItem(itemHandle, threadId);
+		// The event is lost if there were too many nested events.
+		if (numEvents.load(std::memory_order_relaxed) - eventIndex <= EVENT_CAPACITY) {
+			events[eventIndex & (EVENT_CAPACITY - 1)].endTicks.store(endTicks, std::memory_order_release);
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -45,17 +82,13 @@ namespace pathos {
 		return instance;
 	}
 
-	void CpuProfiler::initialize() {
-		const uint32 nCores = CPU::getTotalLogicalCoreCount();
-		CHECKF(nCores != 0, "Couldn't get total core count");
-
-		globalClocks.resize(nCores);
-		for (uint32 i = 0; i < nCores; ++i) {
-			globalClocks[i].start();
-		}
-
-		purge_milestone.store(0);
+	CpuProfiler::CpuProfiler()
+		: checkpoints(CHECKPOINT_CAPACITY)
+		, baseTicks(readClock())
+	{
+	}
 
+	void CpuProfiler::initialize() {
 		gEngine->registerConsoleCommand("profile_cpu", [](const std::string& command) {
 			int32 numFrames;
 			bool bText = false;
@@ -79,126 +112,141 @@ namespace pathos {
 		std::lock_guard<std::mutex> profileLock(profilesMutex);
 
 		CHECKF(profiles.find(threadId) == profiles.end(), "Current thread is already registered");
-		profiles.insert(std::make_pair(threadId, ProfilePerThread(threadId, inDebugName)));
+		profiles.insert(std::make_pair(threadId, std::make_unique<ProfilePerThread>(threadId, std::string(inDebugName))));
 	}
 
 	void CpuProfiler::beginCheckpoint(uint32 frameCounter) {
 		std::lock_guard<std::mutex> cpLock(checkpointMutex);
-		ProfileCheckpoint cp;
-		cp.startTime = getGlobalClockTime();
+		ProfileCheckpoint& cp = checkpoints[numCheckpoints % CHECKPOINT_CAPACITY];
+		cp.startTime = ticksToMs(readClock());
+		cp.endTime = -1.0f;
 		cp.frameCounter = frameCounter;
-		checkpoints.emplace_back(cp);
+		numCheckpoints += 1;
 	}
 
 	void CpuProfiler::finishCheckpoint() {
 		std::lock_guard<std::mutex> cpLock(checkpointMutex);
-		checkpoints[checkpoints.size() - 1].endTime = getGlobalClockTime();
-		if (checkpoints.size() > PURGE_BETWEEN_CHECKPOINTS) {
-			purgeEverything();
+		checkpoints[(numCheckpoints - 1) % CHECKPOINT_CAPACITY].endTime = ticksToMs(readClock());
+	}
+
+	ProfilePerThread* CpuProfiler::getCurrentThreadProfile() {
+		if (tls_profile == nullptr) {
+			tls_profile = findOrAddProfile(CPU::getCurrentThreadId());
 		}
+		return tls_profile;
 	}
 
-	uint32 CpuProfiler::beginItem(PlatformThreadId threadId, const char* counterName) {
+	ProfilePerThread* CpuProfiler::findOrAddProfile(PlatformThreadId threadId) {
 		std::lock_guard<std::mutex> profileLock(profilesMutex);
 
+		auto it = profiles.find(threadId);
 #if 0	// Create anonymous profile rather than assert
-		CHECKF(profiles.find(threadId) != profiles.end(), "No profile exists for current thread");
+		CHECKF(it != profiles.end(), "No profile exists for current thread");
 #else
-		if (profiles.find(threadId) == profiles.end()) {
+		if (it == profiles.end()) {
 			std::stringstream ss;
 			ss << "Thread " << threadId;
-			profiles.insert(std::make_pair(threadId, ProfilePerThread(threadId, ss.str())));
-			LOG(LogDebug, "[%s] Anonymous thread has been detected: %s", __FUNCTION__, ss.str());
+			LOG(LogDebug, "[%s] Anonymous thread has been detected: %s", __FUNCTION__, ss.str().c_str());
+			it = profiles.insert(std::make_pair(threadId, std::make_unique<ProfilePerThread>(threadId, ss.str()))).first;
 		}
 #endif
-		ProfilePerThread& currentProfile = profiles[threadId];
-		ProfileItem item(counterName, currentProfile.currentTab, getGlobalClockTime());
-
-		uint32 itemHandle = (uint32)profiles[threadId].items.size();
-		currentProfile.items.emplace_back(item);
-		currentProfile.currentTab += 1;
-		return itemHandle;
+		return it->second.get();
 	}
 
-	void CpuProfiler::finishItem(uint32 itemHandle, PlatformThreadId threadId) {
-		std::lock_guard<std::mutex> profileLock(profilesMutex);
+	void CpuProfiler::buildItems(const ProfilePerThread& profile, uint64 firstEvent, uint64 lastEvent, std::vector<ProfileItem>& outItems) {
+		outItems.reserve(outItems.size() + (size_t)(lastEvent - firstEvent));
+		for (uint64 i = firstEvent; i < lastEvent; ++i) {
+			const ProfileEvent& event = profile.getEvent(i);
+			const int64 endTicks = event.endTicks.load(std::memory_order_acquire);
+			const uint64 nameSerial = event.nameSerial;
+
+			ProfileItem item("", event.tab, ticksToMs(event.startTicks));
+			if (nameSerial != 0) {
+				// Might be half-written by the owner thread, so don't rely on null termination.
+				item.name.assign(event.name, strnlen(event.name, ProfilePerThread::NAME_LENGTH));
+			} else {
+				item.name = event.name;
+			}
+			if (endTicks != 0) {
+				item.endTime = ticksToMs(endTicks);
+				item.elapsedMS = (float)((double)(endTicks - event.startTicks) * TICKS_TO_MS);
+			}
 
-		ProfilePerThread& currentProfile = profiles[threadId];
-		// #todo-fatal: profilesMutex won't prevent ~ScopedCpuCounter()
-		// from calling finishItem(), but at least access to profiles is safe.
-		// If currentTab is zero, that counter is already invalidated.
-		if (currentProfile.currentTab == 0) {
-			return;
+			// Discard if the owner thread has overwritten the event or its name meanwhile.
+			// The slot of event i is being rewritten once numEvents reaches (i + EVENT_CAPACITY). Same for the name ring.
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (profile.numEvents.load(std::memory_order_relaxed) - i >= ProfilePerThread::EVENT_CAPACITY) {
+				continue;
+			}
+			if (nameSerial != 0 && profile.numNames.load(std::memory_order_relaxed) - (nameSerial - 1) >= ProfilePerThread::NAME_CAPACITY) {
+				continue;
+			}
+			outItems.emplace_back(std::move(item));
 		}
-		//CHECK(currentProfile.currentTab > 0);
-
-		ProfileItem& item = currentProfile.items[itemHandle];
-		item.endTime = getGlobalClockTime();
-		item.elapsedMS = item.endTime - item.startTime;
-
-		currentProfile.currentTab -= 1;
 	}
 
 	void CpuProfiler::getLastFrameSnapshot(PlatformThreadId threadID, std::vector<ProfileItem>& outSnapshot) {
-		std::lock_guard<std::mutex> profileLock(profilesMutex);
-
 		outSnapshot.clear();
-		if (profiles.find(threadID) == profiles.end()) {
-			return;
+
+		ProfilePerThread* profile = nullptr;
+		{
+			std::lock_guard<std::mutex> profileLock(profilesMutex);
+			auto it = profiles.find(threadID);
+			if (it == profiles.end()) {
+				return;
+			}
+			profile = it->second.get();
 		}
-		ProfilePerThread& profile = profiles[threadID];
-		const int32 numItems = (int32)profile.items.size();
-		
+
+		const uint64 lastEvent = profile->numEvents.load(std::memory_order_acquire);
+		const uint64 firstEvent = profile->getFirstEvent(lastEvent);
+
 		// This function is called in render thread so main thread counters for the latest frame
 		// might not be perfectly closed yet. Search for the second latest frame's snapshot.
-		int32 rootIx = -1, prevRootIx = -1;
-		for (int32 i = numItems - 1; i >= 0; --i) {
-			if (profile.items[i].tab == 0) {
-				if (rootIx == -1) {
+		uint64 rootIx = lastEvent, prevRootIx = lastEvent;
+		for (uint64 i = lastEvent; i-- > firstEvent; ) {
+			if (profile->getEvent(i).tab == 0) {
+				if (rootIx == lastEvent) {
 					rootIx = i;
-				} else if (prevRootIx == -1) {
+				} else {
 					prevRootIx = i;
 					break;
 				}
 			}
 		}
-		if (prevRootIx != -1) {
-			outSnapshot.reserve(rootIx - prevRootIx + 1);
-			for (int32 i = prevRootIx; i < rootIx; ++i) {
-				outSnapshot.push_back(profile.items[i]);
-			}
+		if (prevRootIx != lastEvent) {
+			buildItems(*profile, prevRootIx, rootIx, outSnapshot);
 		}
 	}
 
-	void CpuProfiler::purgeEverything() {
-		std::lock_guard<std::mutex> profileLock(profilesMutex);
-
-		purge_milestone.fetch_add(1);
-		// #todo-fatal: Ok, just atomic add won't save this from crash.
-		// 1. fetch_add() is executed.
-		// 2. New cpu counter is started.
-		// 3. Profiles are cleared.
-		// 4. New cpu counter is finished -> CRASH
-		// Inefficient but also use profilesMutex for now.
-		// Anyway all the problem comes from periodic temp purge.
-		// Or... itemHandle is just an array element index,
-		// maybe I'll need a way to check if itemHandle is invalidated.
-		for (auto it = profiles.begin(); it != profiles.end(); ++it) {
-			if (it->second.items.size() >= PURGE_ITEMS_AFTER) {
-				it->second.clearItems();
+	void CpuProfiler::dumpCPUProfile(int32 numFramesToDump, bool bChromeTracingFormat) {
+		std::vector<ProfileCheckpoint> frameCheckpoints;
+		{
+			std::lock_guard<std::mutex> cpLock(checkpointMutex);
+			const uint64 firstCheckpoint = numCheckpoints > CHECKPOINT_CAPACITY ? numCheckpoints - CHECKPOINT_CAPACITY : 0;
+			for (uint64 i = firstCheckpoint; i < numCheckpoints; ++i) {
+				frameCheckpoints.push_back(checkpoints[i % CHECKPOINT_CAPACITY]);
 			}
 		}
-		checkpoints.clear();
-	}
-
-	void CpuProfiler::dumpCPUProfile(int32 numFramesToDump, bool bChromeTracingFormat) {
-		if (checkpoints.size() == 0 || (checkpoints.size() == 1 && checkpoints[0].endTime < 0.0f)) {
+		if (frameCheckpoints.size() == 0 || (frameCheckpoints.size() == 1 && frameCheckpoints[0].endTime < 0.0f)) {
 			LOG(LogInfo, "No CPU profile data exists");
 			return;
 		}
 
-		std::lock_guard<std::mutex> cpLock(checkpointMutex);
-		std::lock_guard<std::mutex> profileLock(profilesMutex);
+		// Build items from ring buffers. Other threads keep recording meanwhile.
+		std::vector<const ProfilePerThread*> threadProfiles;
+		{
+			std::lock_guard<std::mutex> profileLock(profilesMutex);
+			for (auto it_p = profiles.begin(); it_p != profiles.end(); ++it_p) {
+				threadProfiles.push_back(it_p->second.get());
+			}
+		}
+		std::vector<std::vector<ProfileItem>> threadItems(threadProfiles.size());
+		for (size_t threadIx = 0; threadIx < threadProfiles.size(); ++threadIx) {
+			const ProfilePerThread* profile = threadProfiles[threadIx];
+			const uint64 lastEvent = profile->numEvents.load(std::memory_order_acquire);
+			buildItems(*profile, profile->getFirstEvent(lastEvent), lastEvent, threadItems[threadIx]);
+		}
 
 		std::string filepath = pathos::getSolutionDir();
 		filepath += "log/";
@@ -226,8 +274,8 @@ namespace pathos {
 
 		if (fs.is_open()) {
 			// Dump per frame checkpoint
-			int32 checkpointIxEnd = (int32)checkpoints.size() - 1;
-			if (checkpoints[checkpointIxEnd].endTime < 0.0f) {
+			int32 checkpointIxEnd = (int32)frameCheckpoints.size() - 1;
+			if (frameCheckpoints[checkpointIxEnd].endTime < 0.0f) {
 				checkpointIxEnd -= 1;
 			}
 			int32 checkpointIxStart = numFramesToDump <= 0 ? 0 : std::max(0, checkpointIxEnd - numFramesToDump);
@@ -239,26 +287,26 @@ namespace pathos {
 				std::vector<std::string> events;
 				const uint32 pid = 0; // I don't need pid
 
-				float dumpStartTime = checkpoints[checkpointIxStart].startTime;
-				float dumpEndTime = checkpoints[checkpointIxEnd].endTime;
+				float dumpStartTime = frameCheckpoints[checkpointIxStart].startTime;
+				float dumpEndTime = frameCheckpoints[checkpointIxEnd].endTime;
 
 				fs << "[" << '\n';
 				// Metadata events
-				for (auto it_p = profiles.begin(); it_p != profiles.end(); ++it_p) {
-					const PlatformThreadId tid = it_p->first;
-					const std::string tname = it_p->second.threadName;
+				for (size_t threadIx = 0; threadIx < threadProfiles.size(); ++threadIx) {
+					const PlatformThreadId tid = threadProfiles[threadIx]->threadId;
+					const std::string& tname = threadProfiles[threadIx]->threadName;
 					sprintf_s(eventMsg, "{\"name\":\"thread_name\", \"ph\":\"M\", \"pid\":%u, \"tid\":%u, \"args\":{\"name\":\"%s\"}}",
 						pid, (uint32)tid, tname.c_str());
 					fs << eventMsg;
 					fs << ",\n";
 				}
 				// Events
-				for (auto it_p = profiles.begin(); it_p != profiles.end(); ++it_p) {
-					const PlatformThreadId tid = it_p->first;
-					const ProfilePerThread& profile = it_p->second;
-					size_t numItems = profile.items.size();
+				for (size_t threadIx = 0; threadIx < threadProfiles.size(); ++threadIx) {
+					const PlatformThreadId tid = threadProfiles[threadIx]->threadId;
+					const std::vector<ProfileItem>& items = threadItems[threadIx];
+					size_t numItems = items.size();
 					for (size_t i = 0; i < numItems; ++i) {
-						const ProfileItem& item = profile.items[i];
+						const ProfileItem& item = items[i];
 						if (dumpStartTime <= item.startTime && item.startTime <= dumpEndTime && item.elapsedMS > 0.0f) {
 							sprintf_s(eventMsg, "{\"name\":\"%s\", \"cat\":\"CPU\", \"ph\":\"X\", \"ts\":%u, \"dur\":%u, \"pid\":%u, \"tid\":%u}",
 								item.name.c_str(), (uint32)(item.startTime * 1000), (uint32)(item.elapsedMS * 1000), pid, (uint32)tid);
@@ -277,29 +325,29 @@ namespace pathos {
 			} else {
 				// #todo-cpu: Text dump is missing in-between counters (checkpoints are discontinuous).
 				for (int32 checkpointIx = checkpointIxStart; checkpointIx <= checkpointIxEnd; ++checkpointIx) {
-					const ProfileCheckpoint& cp = checkpoints[checkpointIx];
+					const ProfileCheckpoint& cp = frameCheckpoints[checkpointIx];
 					fs << "[Frame " << cp.frameCounter << ']' << std::endl;
 
-					for (auto it_p = profiles.begin(); it_p != profiles.end(); ++it_p) {
-						const ProfilePerThread& profile = it_p->second;
+					for (size_t threadIx = 0; threadIx < threadProfiles.size(); ++threadIx) {
+						const std::vector<ProfileItem>& items = threadItems[threadIx];
 
-						if (profile.isEmpty()) {
+						if (items.size() == 0) {
 							continue;
 						}
 
-						size_t numItems = profile.items.size();
+						size_t numItems = items.size();
 						std::vector<size_t> validItemIndices;
 						for (size_t i = 0; i < numItems; ++i) {
-							const ProfileItem& item = profile.items[i];
+							const ProfileItem& item = items[i];
 							if (cp.startTime <= item.startTime && item.startTime <= cp.endTime) {
 								validItemIndices.push_back(i);
 							}
 						}
 
 						if (validItemIndices.size() > 0) {
-							fs << profile.threadName << std::endl;
+							fs << threadProfiles[threadIx]->threadName << std::endl;
 							for (size_t i = 0; i < validItemIndices.size(); ++i) {
-								const ProfileItem& item = profile.items[validItemIndices[i]];
+								const ProfileItem& item = items[validItemIndices[i]];
 								tab(item.tab + 1);
 								fs << item.name << ": " << item.elapsedMS << " ms" << std::endl;
 							}
@@ -316,9 +364,8 @@ namespace pathos {
 		gConsole->addLine(filepath.c_str(), false);
 	}
 
-	float CpuProfiler::getGlobalClockTime() {
-		const uint32 coreIndex = CPU::getCurrentLogicalCoreIndex();
-		return globalClocks[coreIndex].stop();
+	float CpuProfiler::ticksToMs(int64 ticks) const {
+		return (float)((double)(ticks - baseTicks) * TICKS_TO_MS);
 	}
 
 }
@@ -1,30 +1,31 @@
 #pragma once
 
 #include "badger/types/int_types.h"
-#include "badger/system/stopwatch.h"
 #include "badger/system/cpu.h"
 
 #include <vector>
 #include <string>
 #include <atomic>
 #include <mutex>
+#include <memory>
+#include <chrono>
 #include <unordered_map>
 
 namespace pathos {
 
+	struct ProfilePerThread;
+
+	// Writes to the ring buffer of current thread. No lock and no allocation.
 	struct ScopedCpuCounter {
-		ScopedCpuCounter(const char* inName);
+		// inName should outlive the profiler (string literal) unless bCopyName is true.
+		ScopedCpuCounter(const char* inName, bool bCopyName = false);
 		~ScopedCpuCounter();
 
-		PlatformThreadId threadId;
-		// #todo-stat: Skip string allocation if string literal is given.
-		std::string name;
-		uint32 itemHandle;
-
-		// #todo-cpu: Temp value due to temp periodic purge
-		uint32 purge_milestone;
+		ProfilePerThread* profile;
+		uint64 eventIndex;
 	};
 
+	// Built from ring buffers only when a snapshot or a dump is requested.
 	struct ProfileItem {
 		ProfileItem(const char* inName, uint32 inTab, float inStartTime)
 			: name(inName)
@@ -41,48 +42,49 @@ namespace pathos {
 		float elapsedMS; // in milliseconds
 	};
 
+	struct ProfileEvent {
+		const char* name;
+		int64 startTicks;
+		std::atomic<int64> endTicks; // Zero until the counter is finished
+		uint32 tab;
+		uint64 nameSerial;           // (1 + index in the name ring) if name was copied, otherwise zero
+	};
+
 	// It turned out that per-core profile is a bad idea. Let's go for per-thread profile.
+	// Only the owner thread writes to its rings. Readers copy events and discard the ones
+	// that were overwritten while being copied.
 	struct ProfilePerThread {
-		ProfilePerThread(PlatformThreadId inThreadId, const char* inDebugName)
-			: threadId(inThreadId)
-			, threadName(inDebugName)
-			, currentTab(0)
-		{
-		}
-		ProfilePerThread(PlatformThreadId inThreadId, std::string&& inDebugName)
-			: threadId(inThreadId)
-			, threadName(inDebugName)
-			, currentTab(0)
-		{
-		}
+		static constexpr uint32 EVENT_CAPACITY = 1 << 14; // Should be a power of two
+		static constexpr uint32 NAME_CAPACITY = 1024;     // Number of copied names
+		static constexpr uint32 NAME_LENGTH = 64;         // Copied names are truncated to this, including null
 
-		void clearItems() {
-			items.clear();
-			currentTab = 0;
+		ProfilePerThread(PlatformThreadId inThreadId, std::string&& inDebugName);
+
+		uint64 beginEvent(const char* name, bool bCopyName);
+		void finishEvent(uint64 eventIndex);
+
+		// Events that are not overwritten yet are in [getFirstEvent(), numEvents).
+		// The slot of the oldest event is excluded as the next event is written there.
+		inline uint64 getFirstEvent(uint64 numEventsWritten) const {
+			return numEventsWritten >= EVENT_CAPACITY ? numEventsWritten - EVENT_CAPACITY + 1 : 0;
 		}
-		bool isEmpty() const {
-			return items.size() == 0;
+		inline const ProfileEvent& getEvent(uint64 eventIndex) const {
+			return events[eventIndex & (EVENT_CAPACITY - 1)];
 		}
 
 		PlatformThreadId threadId;
 		std::string threadName;
 
-		std::vector<ProfileItem> items;
-		uint32 currentTab;
-
-	// DO NOT USE. For unordered_map only.
-	public:
-		ProfilePerThread()
-			: threadId(0xffffffff)
-			, threadName("")
-			, currentTab(0)
-		{
-		}
+		std::unique_ptr<ProfileEvent[]> events;
+		std::atomic<uint64> numEvents;      // Total number of events ever written
+		std::unique_ptr<char[]> names;      // NAME_CAPACITY strings of NAME_LENGTH
+		std::atomic<uint64> numNames;       // Total number of names ever copied
+		uint32 currentTab;                  // Owner thread only
 	};
 
 	struct ProfileCheckpoint {
-		float startTime;       // in seconds
-		float endTime = -1.0f; // in seconds
+		float startTime;       // in milliseconds
+		float endTime = -1.0f; // in milliseconds
 		uint32 frameCounter;
 	};
 
@@ -91,6 +93,10 @@ namespace pathos {
 	public:
 		static CpuProfiler& getInstance();
 
+		inline static int64 readClock() {
+			return std::chrono::steady_clock::now().time_since_epoch().count();
+		}
+
 		void initialize();
 		void registerCurrentThread(const char* inDebugName);
 		void registerThread(PlatformThreadId threadId, const char* inDebugName);
@@ -98,39 +104,42 @@ namespace pathos {
 		void beginCheckpoint(uint32 frameCounter);
 		void finishCheckpoint();
 
-		uint32 beginItem(PlatformThreadId threadId, const char* counterName);
-		void finishItem(uint32 frameHandle, PlatformThreadId threadId);
+		// Registers an anonymous profile on first use in an unknown thread.
+		ProfilePerThread* getCurrentThreadProfile();
 
 		void getLastFrameSnapshot(PlatformThreadId threadID, std::vector<ProfileItem>& outSnapshot);
 
-		// #todo-cpu: Temp
-		std::atomic<uint32> purge_milestone;
-
 	private:
-		CpuProfiler() = default;
+		CpuProfiler();
 		~CpuProfiler() = default;
 
-		void purgeEverything();
+		ProfilePerThread* findOrAddProfile(PlatformThreadId threadId);
+
+		// Copy events in [firstEvent, lastEvent) that are still valid.
+		void buildItems(const ProfilePerThread& profile, uint64 firstEvent, uint64 lastEvent, std::vector<ProfileItem>& outItems);
 
 		// bChromeTracingFormat: Dump as plain text or JSON that chrome://tracing and edge://tracing recognizes.
 		// See https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
 		void dumpCPUProfile(int32 numFramesToDump, bool bChromeTracingFormat);
 
-		float getGlobalClockTime();
+		float ticksToMs(int64 ticks) const;
 
-		std::unordered_map<PlatformThreadId, ProfilePerThread> profiles; // Map thread id to profile
-		std::mutex profilesMutex;
+		std::unordered_map<PlatformThreadId, std::unique_ptr<ProfilePerThread>> profiles; // Map thread id to profile
+		std::mutex profilesMutex; // Guards the map, not the ring buffers
 
-		std::vector<ProfileCheckpoint> checkpoints; // #todo-cpu: Switch to typed ring buffers
+		static constexpr uint32 CHECKPOINT_CAPACITY = 256;
+		std::vector<ProfileCheckpoint> checkpoints; // Ring buffer of CHECKPOINT_CAPACITY
+		uint64 numCheckpoints = 0;
 		std::mutex checkpointMutex;
 
-		std::vector<Stopwatch> globalClocks; // Per-core so that no mutex is necessary
+		int64 baseTicks; // Profile times are relative to this
 	};
 
 }
 
 #define SCOPED_CPU_COUNTER(CounterName) ScopedCpuCounter cpu_counter_##CounterName(#CounterName)
 
-#define SCOPED_CPU_COUNTER_STRING_INTERNAL2(X, Y, Z) X ## Y ## Z
-#define SCOPED_CPU_COUNTER_STRING_INTERNAL(CounterString, Line) SCOPED_CPU_COUNTER_STRING_INTERNAL2(ScopedCpuCounter cpu_counter_, Line, (CounterString));
+// For names in temporary buffers. The name is copied into a ring buffer of current thread.
+#define SCOPED_CPU_COUNTER_STRING_INTERNAL2(X, Y) X ## Y
+#define SCOPED_CPU_COUNTER_STRING_INTERNAL(CounterString, Line) ScopedCpuCounter SCOPED_CPU_COUNTER_STRING_INTERNAL2(cpu_counter_, Line)((CounterString), true);
 #define SCOPED_CPU_COUNTER_STRING(CounterString) SCOPED_CPU_COUNTER_STRING_INTERNAL(CounterString, __LINE__)
@@ -0,0 +1,116 @@
+#include "derived_data_cache.h"
+#include "pathos/util/file_system.h"
+#include "pathos/util/log.h"
+#include "pathos/console.h"
+
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+namespace pathos {
+
+	static ConsoleVariable<int32> cvarDerivedDataCache("asset.derivedDataCache", 1, "(read only) Store and reuse cooked assets in the derived data cache (0 = disable, 1 = enable)");
+
+	DerivedDataCache& DerivedDataCache::get() {
+		static DerivedDataCache instance;
+		return instance;
+	}
+
+	bool DerivedDataCache::isEnabled() const {
+		return cvarDerivedDataCache.getInt() != 0;
+	}
+
+	void DerivedDataCache::setCacheDirectory(const std::string& directory) {
+		std::lock_guard<std::mutex> lockGuard(cacheDirectoryLock);
+		cacheDirectory = directory;
+	}
+
+	std::string DerivedDataCache::getCacheDirectory() {
+		std::lock_guard<std::mutex> lockGuard(cacheDirectoryLock);
+		if (cacheDirectory.size() == 0) {
+			cacheDirectory = pathos::getSolutionDir() + "intermediate/ddc/";
+		}
+		return cacheDirectory;
+	}
+
+	std::string DerivedDataCache::getCacheFilepath(const char* bucket, uint64 key, const char* extension) {
+		char filename[64];
+		sprintf_s(filename, "%016llx%s", (unsigned long long)key, extension);
+		return getCacheDirectory() + bucket + "/" + filename;
+	}
+
+	bool DerivedDataCache::storeEntry(const std::string& filepath, const void* data, uint64 bytes) {
+		uint32 tempIndex;
+		{
+			std::lock_guard<std::mutex> lockGuard(cacheDirectoryLock);
+			tempIndex = tempFileCounter++;
+		}
+		const std::string tempFilepath = filepath + ".tmp" + std::to_string(tempIndex);
+
+		pathos::createDirectory(pathos::getDirectoryPath(filepath.c_str()).c_str());
+		{
+			std::ofstream fs(tempFilepath, std::ios::binary | std::ios::trunc);
+			if (!fs.is_open()) {
+				LOG(LogWarning, "[DDC] Can't write: %s", tempFilepath.c_str());
+				return false;
+			}
+			fs.write(reinterpret_cast<const char*>(data), (std::streamsize)bytes);
+			if (!fs.good()) {
+				LOG(LogWarning, "[DDC] Failed to write: %s", tempFilepath.c_str());
+				fs.close();
+				std::filesystem::remove(tempFilepath);
+				return false;
+			}
+		}
+
+		// Another thread might have stored the same entry already; both are identical then.
+		std::error_code err;
+		std::filesystem::rename(tempFilepath, filepath, err);
+		if (err) {
+			std::filesystem::remove(tempFilepath, err);
+			return pathos::pathExists(filepath.c_str());
+		}
+		return true;
+	}
+
+	// Based on FNV-1a, but mixes 8 bytes at once.
+	uint64 DerivedDataCache::hashBytes(const void* data, uint64 bytes, uint64 seed) {
+		constexpr uint64 PRIME = 0x100000001b3ull;
+		const uint8* p = reinterpret_cast<const uint8*>(data);
+		uint64 h = 0xcbf29ce484222325ull ^ seed;
+		uint64 i = 0;
+		for (; i + 8 <= bytes; i += 8) {
+			uint64 word;
+			::memcpy(&word, p + i, 8);
+			h = (h ^ word) * PRIME;
+			h ^= h >> 29;
+		}
+		for (; i < bytes; ++i) {
+			h = (h ^ p[i]) * PRIME;
+		}
+		return combineHash(h, bytes);
+	}
+
+	uint64 DerivedDataCache::combineHash(uint64 a, uint64 b) {
+		// splitmix64 finalizer
+		uint64 x = a ^ (b + 0x9e3779b97f4a7c15ull + (a << 6) + (a >> 2));
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+		return x ^ (x >> 31);
+	}
+
+	bool readFileBytes(const char* filepath, std::vector<uint8>& outBytes) {
+		std::ifstream fs(filepath, std::ios::binary | std::ios::ate);
+		if (!fs.is_open()) {
+			return false;
+		}
+		const std::streamsize size = fs.tellg();
+		if (size < 0) {
+			return false;
+		}
+		outBytes.resize((size_t)size);
+		fs.seekg(0, std::ios::beg);
+		return size == 0 || (bool)fs.read(reinterpret_cast<char*>(outBytes.data()), size);
+	}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace pathos {
+
+	// Local cache of cooked asset data, keyed by a hash of the source data.
+	// Entries are never invalidated; a changed source simply produces a new key.
+	// Cache files live in <solution dir>/intermediate/ddc/<bucket>/ unless setCacheDirectory() is called.
+	class DerivedDataCache {
+
+	public:
+		static DerivedDataCache& get();
+
+		// asset.derivedDataCache
+		bool isEnabled() const;
+
+		// For tests and tools. Must end with a path separator.
+		void setCacheDirectory(const std::string& directory);
+		std::string getCacheDirectory();
+
+		// @return Path of the cache entry. The file might not exist.
+		std::string getCacheFilepath(const char* bucket, uint64 key, const char* extension);
+
+		// Write to a temporary file and rename it, so readers never see a partially written entry.
+		// Can be called from worker threads.
+		bool storeEntry(const std::string& filepath, const void* data, uint64 bytes);
+
+		// Hash for cache keys. Not cryptographic.
+		static uint64 hashBytes(const void* data, uint64 bytes, uint64 seed = 0);
+		static uint64 combineHash(uint64 a, uint64 b);
+
+	private:
+		DerivedDataCache() = default;
+
+		std::string cacheDirectory;
+		std::mutex cacheDirectoryLock;
+		uint32 tempFileCounter = 0;
+
+	};
+
+	// @return false if the file does not exist or can't be read.
+	bool readFileBytes(const char* filepath, std::vector<uint8>& outBytes);
+
+}
@@ -5,8 +5,20 @@
 #include "badger/types/vector_types.h"
 #include "badger/assertion/assertion.h"
 
+#include <vector>
+
 namespace pathos {
 
+	/// <summary>
+	/// A level of a prebuilt mip chain, located in ImageBlob::rawBytes.
+	/// </summary>
+	struct ImageMip {
+		uint32 width;
+		uint32 height;
+		uint64 offset;
+		uint64 bytes;
+	};
+
 	/// <summary>
 	/// Struct to abstract raw image data.
 	/// </summary>
@@ -36,6 +48,12 @@ namespace pathos {
 		GLenum glPixelFormat = 0;
 		GLenum glDataType = 0;
 
+		// Optional. If not empty, rawBytes holds every level and textures upload them instead of generating mipmaps.
+		// mips[0] is the full-size image.
+		std::vector<ImageMip> mips;
+		// glStorageFormat is a compressed format and glPixelFormat/glDataType are unused.
+		bool bCompressed = false;
+
 		// Example) A 2D image of size 1920x1080 and of format RGBA32UI.
 		//   rawData : uint8*
 		//   width   : 1920
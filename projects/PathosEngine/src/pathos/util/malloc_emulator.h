@@ -6,6 +6,7 @@
 namespace pathos {
 
 	/// Used to emulate dynamic allocation of GPU resource from C++ side.
+	/// BufferPool uses TLSFAllocator now; this is kept as a baseline for TestTLSFAllocator.
 	class MallocEmulator {
 
 		struct Range {
@@ -0,0 +1,66 @@
+#include "mapped_file.h"
+
+#include "badger/system/platform.h"
+
+#if PLATFORM_WINDOWS
+#include <Windows.h>
+#endif
+
+namespace pathos {
+
+	MappedFile::~MappedFile() {
+		close();
+	}
+
+	bool MappedFile::open(const char* filepath) {
+		close();
+#if PLATFORM_WINDOWS
+		HANDLE hFile = ::CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (hFile == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		LARGE_INTEGER fileSize;
+		if (!::GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0) {
+			::CloseHandle(hFile);
+			return false;
+		}
+		HANDLE hMapping = ::CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (hMapping == NULL) {
+			::CloseHandle(hFile);
+			return false;
+		}
+		void* view = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr) {
+			::CloseHandle(hMapping);
+			::CloseHandle(hFile);
+			return false;
+		}
+		fileHandle = hFile;
+		mappingHandle = hMapping;
+		data = reinterpret_cast<const uint8*>(view);
+		size = (uint64)fileSize.QuadPart;
+		return true;
+#else
+		#error "Not implemented"
+#endif
+	}
+
+	void MappedFile::close() {
+#if PLATFORM_WINDOWS
+		if (data != nullptr) {
+			::UnmapViewOfFile(data);
+		}
+		if (mappingHandle != nullptr) {
+			::CloseHandle(mappingHandle);
+		}
+		if (fileHandle != nullptr) {
+			::CloseHandle(fileHandle);
+		}
+#endif
+		data = nullptr;
+		size = 0;
+		fileHandle = nullptr;
+		mappingHandle = nullptr;
+	}
+
+}
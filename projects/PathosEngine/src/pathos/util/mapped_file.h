@@ -0,0 +1,29 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include "badger/types/noncopyable.h"
+
+namespace pathos {
+
+	// Read-only memory-mapped file.
+	class MappedFile final : public Noncopyable {
+
+	public:
+		~MappedFile();
+
+		// @return true if the whole file is mapped. Empty files fail to map.
+		bool open(const char* filepath);
+		void close();
+
+		inline bool isOpen() const { return data != nullptr; }
+		inline const uint8* getData() const { return data; }
+		inline uint64 getSize() const { return size; }
+
+	private:
+		const uint8* data = nullptr;
+		uint64 size = 0;
+		void* fileHandle = nullptr;
+		void* mappingHandle = nullptr;
+	};
+
+}
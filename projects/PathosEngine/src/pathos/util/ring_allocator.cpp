@@ -0,0 +1,52 @@
+#include "ring_allocator.h"
+#include "badger/assertion/assertion.h"
+#include "badger/math/minmax.h"
+
+namespace pathos {
+
+	void RingAllocator::initialize(uint64 inTotalBytes) {
+		CHECK(inTotalBytes > 0);
+		totalBytes = inTotalBytes;
+		head = 0;
+		tail = 0;
+		frameEnds.clear();
+	}
+
+	uint64 RingAllocator::allocate(uint64 bytes, uint64 alignment) {
+		CHECK(totalBytes > 0);
+		CHECK(alignment > 0 && (totalBytes % alignment) == 0);
+		if (bytes == 0 || bytes > totalBytes) {
+			return INVALID_OFFSET;
+		}
+
+		uint64 begin = ((head + alignment - 1) / alignment) * alignment;
+		if ((begin % totalBytes) + bytes > totalBytes) {
+			// Skip the tail and start from the beginning of the range.
+			begin = ((begin / totalBytes) + 1) * totalBytes;
+		}
+		if (head == tail) {
+			// Nothing is in use, so padding and skipped bytes need not be reserved.
+			tail = begin;
+		}
+		const uint64 end = begin + bytes;
+		if (end - tail > totalBytes) {
+			// Would overwrite data of frames that are still in flight.
+			return INVALID_OFFSET;
+		}
+
+		head = end;
+		return begin % totalBytes;
+	}
+
+	void RingAllocator::endFrame() {
+		frameEnds.push_back(head);
+	}
+
+	void RingAllocator::retireFrame() {
+		CHECK(frameEnds.size() > 0);
+		// Tail might have been moved past empty frames by allocate().
+		tail = badger::max(tail, frameEnds.front());
+		frameEnds.pop_front();
+	}
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include <deque>
+
+namespace pathos {
+
+	/// Linear allocator over a circular range, for transient GPU data that lives for a few frames.
+	/// Allocations are never freed individually; a whole frame is released at once
+	/// when the GPU has finished with it (see UploadRingBuffer).
+	class RingAllocator {
+
+	public:
+		static constexpr uint64 INVALID_OFFSET = static_cast<uint64>(-1);
+
+		void initialize(uint64 inTotalBytes);
+
+		/// Returns the offset in [0, totalBytes). If failed, returns RingAllocator::INVALID_OFFSET.
+		/// An allocation never straddles the end of the range; the tail is skipped instead.
+		/// totalBytes must be a multiple of alignment.
+		uint64 allocate(uint64 bytes, uint64 alignment);
+
+		/// Every allocation since the previous endFrame() belongs to a new frame in flight.
+		void endFrame();
+
+		/// Release the oldest frame in flight.
+		void retireFrame();
+
+		inline uint64 getTotalBytes() const { return totalBytes; }
+		/// Including the skipped tail bytes of wrapped allocations.
+		inline uint64 getUsedBytes() const { return head - tail; }
+		inline uint32 getNumFramesInFlight() const { return (uint32)frameEnds.size(); }
+
+	private:
+		uint64 totalBytes = 0;
+		// Virtual positions that only increase. Physical offset is (position % totalBytes).
+		uint64 head = 0;
+		uint64 tail = 0;
+		std::deque<uint64> frameEnds; // Head position at each endFrame(), oldest first
+
+	};
+
+}
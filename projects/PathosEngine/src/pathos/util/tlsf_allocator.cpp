@@ -0,0 +1,242 @@
+#include "tlsf_allocator.h"
+#include "badger/assertion/assertion.h"
+#include "badger/math/bits.h"
+#include <algorithm>
+
+static uint64 alignBytes(uint64 size, uint64 alignment) {
+	return ((size + alignment - 1) / alignment) * alignment;
+}
+
+namespace pathos {
+
+	TLSFAllocator::~TLSFAllocator() {
+		cleanup();
+	}
+
+	void TLSFAllocator::initialize(uint64 inTotalBytes, uint64 inAlignment) {
+		CHECK(totalBytes == 0 && blocks.size() == 0);
+		alignment = (inAlignment == 0) ? 1 : inAlignment;
+		// The tail that can't hold an aligned allocation is never used.
+		totalBytes = (inTotalBytes / alignment) * alignment;
+		remainingBytes = totalBytes;
+
+		flBitmap = 0;
+		for (uint32 fl = 0; fl < FL_INDEX_COUNT; ++fl) {
+			slBitmaps[fl] = 0;
+			for (uint32 sl = 0; sl < SL_INDEX_COUNT; ++sl) {
+				freeLists[fl][sl] = NIL;
+			}
+		}
+
+		if (totalBytes > 0) {
+			uint32 blockIx = allocateBlock();
+			blocks[blockIx] = Block{ 0, totalBytes, NIL, NIL, NIL, NIL, false };
+			insertFreeBlock(blockIx);
+		}
+	}
+
+	void TLSFAllocator::cleanup() {
+		blocks.clear();
+		unusedBlocks.clear();
+		allocatedBlocks.clear();
+		flBitmap = 0;
+		totalBytes = 0;
+		remainingBytes = 0;
+		numFreeBlocks = 0;
+	}
+
+	uint64 TLSFAllocator::allocate(uint64 bytes) {
+		CHECK(bytes > 0);
+		bytes = alignBytes(bytes, alignment);
+		if (bytes > remainingBytes) {
+			return INVALID_OFFSET;
+		}
+
+		uint32 blockIx = findFreeBlock(bytes);
+		if (blockIx == NIL) {
+			return INVALID_OFFSET; // Out of memory or fragmentation.
+		}
+		removeFreeBlock(blockIx);
+
+		// Return the remainder to the free lists. It's always a multiple of the alignment.
+		if (blocks[blockIx].bytes > bytes) {
+			uint32 remainderIx = allocateBlock(); // Invalidates references into blocks.
+			Block& block = blocks[blockIx];
+			Block& remainder = blocks[remainderIx];
+			remainder.offset = block.offset + bytes;
+			remainder.bytes = block.bytes - bytes;
+			remainder.prevPhysical = blockIx;
+			remainder.nextPhysical = block.nextPhysical;
+			if (block.nextPhysical != NIL) {
+				blocks[block.nextPhysical].prevPhysical = remainderIx;
+			}
+			block.nextPhysical = remainderIx;
+			block.bytes = bytes;
+			insertFreeBlock(remainderIx);
+		}
+
+		const Block& block = blocks[blockIx];
+		allocatedBlocks.insert(std::make_pair(block.offset, blockIx));
+		remainingBytes -= block.bytes;
+		return block.offset;
+	}
+
+	void TLSFAllocator::deallocate(uint64 offset) {
+		auto it = allocatedBlocks.find(offset);
+		if (it == allocatedBlocks.end()) {
+			CHECK_NO_ENTRY(); // Nothing was allocated at the given offset
+			return;
+		}
+		uint32 blockIx = it->second;
+		allocatedBlocks.erase(it);
+		remainingBytes += blocks[blockIx].bytes;
+
+		// Merge with free neighbors right away, so that free blocks are never adjacent.
+		const uint32 prevIx = blocks[blockIx].prevPhysical;
+		if (prevIx != NIL && blocks[prevIx].bFree) {
+			removeFreeBlock(prevIx);
+			Block& prev = blocks[prevIx];
+			prev.bytes += blocks[blockIx].bytes;
+			prev.nextPhysical = blocks[blockIx].nextPhysical;
+			if (prev.nextPhysical != NIL) {
+				blocks[prev.nextPhysical].prevPhysical = prevIx;
+			}
+			releaseBlock(blockIx);
+			blockIx = prevIx;
+		}
+		const uint32 nextIx = blocks[blockIx].nextPhysical;
+		if (nextIx != NIL && blocks[nextIx].bFree) {
+			removeFreeBlock(nextIx);
+			Block& block = blocks[blockIx];
+			block.bytes += blocks[nextIx].bytes;
+			block.nextPhysical = blocks[nextIx].nextPhysical;
+			if (block.nextPhysical != NIL) {
+				blocks[block.nextPhysical].prevPhysical = blockIx;
+			}
+			releaseBlock(nextIx);
+		}
+		insertFreeBlock(blockIx);
+	}
+
+	TLSFAllocator::Stats TLSFAllocator::getStats() const {
+		Stats stats;
+		stats.totalBytes = totalBytes;
+		stats.freeBytes = remainingBytes;
+		stats.largestFreeBlock = 0;
+		stats.numFreeBlocks = numFreeBlocks;
+		stats.numAllocations = (uint32)allocatedBlocks.size();
+
+		if (flBitmap != 0) {
+			const uint32 fl = (uint32)badger::bitScanReverse64(flBitmap);
+			const uint32 sl = (uint32)badger::bitScanReverse64(slBitmaps[fl]);
+			for (uint32 blockIx = freeLists[fl][sl]; blockIx != NIL; blockIx = blocks[blockIx].nextFree) {
+				stats.largestFreeBlock = std::max(stats.largestFreeBlock, blocks[blockIx].bytes);
+			}
+		}
+		stats.fragmentation = (stats.freeBytes == 0) ? 0.0f : (1.0f - (float)((double)stats.largestFreeBlock / (double)stats.freeBytes));
+		return stats;
+	}
+
+	void TLSFAllocator::mapping(uint64 bytes, uint32& fl, uint32& sl) {
+		if (bytes < SL_INDEX_COUNT) {
+			// Small sizes are linear in the first class.
+			fl = 0;
+			sl = (uint32)bytes;
+		} else {
+			const uint32 msb = (uint32)badger::bitScanReverse64(bytes);
+			fl = msb - (SL_INDEX_COUNT_LOG2 - 1);
+			sl = (uint32)(bytes >> (msb - SL_INDEX_COUNT_LOG2)) ^ SL_INDEX_COUNT;
+		}
+	}
+
+	uint32 TLSFAllocator::findFreeBlock(uint64 bytes) const {
+		// Round up to the next class boundary, so that any block of the found class is large enough.
+		uint64 searchBytes = bytes;
+		if (searchBytes >= SL_INDEX_COUNT) {
+			searchBytes += (1ull << (badger::bitScanReverse64(searchBytes) - SL_INDEX_COUNT_LOG2)) - 1;
+		}
+		uint32 fl, sl;
+		mapping(searchBytes, fl, sl);
+		if (fl < FL_INDEX_COUNT) {
+			uint32 slMap = slBitmaps[fl] & (~0u << sl);
+			if (slMap == 0) {
+				const uint64 flMap = (fl + 1 < 64) ? (flBitmap & (~0ull << (fl + 1))) : 0;
+				fl = (flMap == 0) ? NIL : (uint32)badger::bitScanForward64(flMap);
+				slMap = (flMap == 0) ? 0 : slBitmaps[fl];
+			}
+			if (slMap != 0) {
+				sl = (uint32)badger::bitScanForward64(slMap);
+				return freeLists[fl][sl];
+			}
+		}
+
+		// Every larger class is empty. A block in the class of the request itself might still fit,
+		// e.g., when the request takes the whole remaining range.
+		mapping(bytes, fl, sl);
+		for (uint32 blockIx = freeLists[fl][sl]; blockIx != NIL; blockIx = blocks[blockIx].nextFree) {
+			if (blocks[blockIx].bytes >= bytes) {
+				return blockIx;
+			}
+		}
+		return NIL;
+	}
+
+	void TLSFAllocator::insertFreeBlock(uint32 blockIx) {
+		Block& block = blocks[blockIx];
+		uint32 fl, sl;
+		mapping(block.bytes, fl, sl);
+
+		block.bFree = true;
+		block.prevFree = NIL;
+		block.nextFree = freeLists[fl][sl];
+		if (block.nextFree != NIL) {
+			blocks[block.nextFree].prevFree = blockIx;
+		}
+		freeLists[fl][sl] = blockIx;
+		flBitmap |= 1ull << fl;
+		slBitmaps[fl] |= 1u << sl;
+		++numFreeBlocks;
+	}
+
+	void TLSFAllocator::removeFreeBlock(uint32 blockIx) {
+		Block& block = blocks[blockIx];
+		CHECK(block.bFree);
+		uint32 fl, sl;
+		mapping(block.bytes, fl, sl);
+
+		if (block.prevFree != NIL) {
+			blocks[block.prevFree].nextFree = block.nextFree;
+		} else {
+			freeLists[fl][sl] = block.nextFree;
+			if (block.nextFree == NIL) {
+				slBitmaps[fl] &= ~(1u << sl);
+				if (slBitmaps[fl] == 0) {
+					flBitmap &= ~(1ull << fl);
+				}
+			}
+		}
+		if (block.nextFree != NIL) {
+			blocks[block.nextFree].prevFree = block.prevFree;
+		}
+		block.bFree = false;
+		block.prevFree = NIL;
+		block.nextFree = NIL;
+		--numFreeBlocks;
+	}
+
+	uint32 TLSFAllocator::allocateBlock() {
+		if (unusedBlocks.size() > 0) {
+			uint32 blockIx = unusedBlocks.back();
+			unusedBlocks.pop_back();
+			return blockIx;
+		}
+		blocks.emplace_back(Block{ 0, 0, NIL, NIL, NIL, NIL, false });
+		return (uint32)(blocks.size() - 1);
+	}
+
+	void TLSFAllocator::releaseBlock(uint32 blockIx) {
+		blocks[blockIx].bFree = false;
+		unusedBlocks.push_back(blockIx);
+	}
+
+}
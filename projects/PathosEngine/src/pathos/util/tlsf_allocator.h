@@ -0,0 +1,91 @@
+#pragma once
+
+#include "badger/types/int_types.h"
+#include <vector>
+#include <unordered_map>
+
+namespace pathos {
+
+	/// Two-level segregated fit allocator for a range of offsets, e.g., suballocation of a GPU buffer.
+	/// Free blocks are kept in size classes (power-of-two first level, 32 linear subdivisions in second level)
+	/// with a bitmap per level, so both allocate() and deallocate() are O(1).
+	/// Freed blocks are merged with their physical neighbors immediately.
+	/// Bookkeeping lives in CPU memory only; nothing is written into the managed range.
+	class TLSFAllocator {
+
+	public:
+		static constexpr uint64 INVALID_OFFSET = static_cast<uint64>(-1);
+
+		struct Stats {
+			uint64 totalBytes;
+			uint64 freeBytes;
+			uint64 largestFreeBlock;
+			uint32 numFreeBlocks;
+			uint32 numAllocations;
+			// 0 if every free byte is in one block, approaches 1 as free space is scattered into small blocks.
+			float fragmentation;
+		};
+
+		~TLSFAllocator();
+
+		void initialize(uint64 totalBytes, uint64 alignment = 0);
+
+		void cleanup();
+
+		/// Returns offset. If failed, returns TLSFAllocator::INVALID_OFFSET.
+		/// Every offset is a multiple of the alignment given to initialize().
+		uint64 allocate(uint64 bytes);
+
+		/// The argument must be an offset previously returned by allocate().
+		void deallocate(uint64 offset);
+
+		/// NOTE: It's not gauranteed that allocate(remainingBytes()) succeed due to fragmentation.
+		inline uint64 getRemainingBytes() const { return remainingBytes; }
+
+		/// The number of active allocations.
+		inline uint64 getNumAllocations() const { return (uint64)allocatedBlocks.size(); }
+
+		/// Walks the free list of the largest size class only.
+		Stats getStats() const;
+
+	private:
+		static constexpr uint32 SL_INDEX_COUNT_LOG2 = 5;
+		static constexpr uint32 SL_INDEX_COUNT = 1 << SL_INDEX_COUNT_LOG2;
+		static constexpr uint32 FL_INDEX_COUNT = 64 - SL_INDEX_COUNT_LOG2 + 1;
+		static constexpr uint32 NIL = static_cast<uint32>(-1);
+
+		// Blocks are stored in a pool and linked by index, so splits don't allocate memory.
+		struct Block {
+			uint64 offset;
+			uint64 bytes;
+			uint32 prevPhysical; // Neighbors in the address order
+			uint32 nextPhysical;
+			uint32 prevFree;     // Links in the free list of the size class
+			uint32 nextFree;
+			bool bFree;
+		};
+
+		static void mapping(uint64 bytes, uint32& fl, uint32& sl);
+
+		uint32 allocateBlock();
+		void releaseBlock(uint32 blockIx);
+		void insertFreeBlock(uint32 blockIx);
+		void removeFreeBlock(uint32 blockIx);
+		uint32 findFreeBlock(uint64 bytes) const;
+
+		std::vector<Block> blocks;
+		std::vector<uint32> unusedBlocks;
+		std::unordered_map<uint64, uint32> allocatedBlocks; // offset -> block index
+
+		uint64 flBitmap = 0;
+		uint32 slBitmaps[FL_INDEX_COUNT];
+		uint32 freeLists[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
+		uint64 totalBytes = 0;
+		uint64 remainingBytes = 0;
+		uint64 alignment = 1;
+		uint32 numFreeBlocks = 0;
+
+	};
+
+}
@@ -9,6 +9,7 @@
 #include "pathos/render/render_target.h"
 #include "pathos/scene/scene_capture_component.h"
 #include "pathos/loader/asset_streamer.h"
+#include "pathos/loader/texture_cooker.h"
 #include "pathos/input/input_manager.h"
 #include "pathos/util/cpu_profiler.h"
 #include "pathos/gui/gui_window.h"
@@ -147,11 +148,16 @@ void World1::setupScene()
 	{
 		constexpr uint32 mipLevels = 0;
 		constexpr bool sRGB = true;
-		Texture* albedo = ImageUtils::createTexture2DFromImage(ImageUtils::loadImage(SANDSTONE_ALBEDO), mipLevels, sRGB);
-		Texture* normal = ImageUtils::createTexture2DFromImage(ImageUtils::loadImage(SANDSTONE_NORMAL), mipLevels, !sRGB);
-		Texture* metallic = ImageUtils::createTexture2DFromImage(ImageUtils::loadImage(SANDSTONE_METALLIC), mipLevels, !sRGB);
-		Texture* roughness = ImageUtils::createTexture2DFromImage(ImageUtils::loadImage(SANDSTONE_ROUGHNESS), mipLevels, !sRGB);
-		Texture* ao = ImageUtils::createTexture2DFromImage(ImageUtils::loadImage(SANDSTONE_LOCAL_AO), mipLevels, !sRGB);
+		// Cooked once into the derived data cache, then loaded with prebuilt compressed mips.
+		TextureCookSettings colorSettings{ ETextureCompression::BC7, sRGB };
+		TextureCookSettings normalSettings{ ETextureCompression::BC7, !sRGB, true };
+		TextureCookSettings maskSettings{ ETextureCompression::BC4, !sRGB };
+		JobSystem* jobSystem = gEngine->getJobSystem();
+		Texture* albedo = ImageUtils::createTexture2DFromImage(ImageUtils::loadCookedImage(SANDSTONE_ALBEDO, colorSettings, jobSystem), mipLevels, sRGB);
+		Texture* normal = ImageUtils::createTexture2DFromImage(ImageUtils::loadCookedImage(SANDSTONE_NORMAL, normalSettings, jobSystem), mipLevels, !sRGB);
+		Texture* metallic = ImageUtils::createTexture2DFromImage(ImageUtils::loadCookedImage(SANDSTONE_METALLIC, maskSettings, jobSystem), mipLevels, !sRGB);
+		Texture* roughness = ImageUtils::createTexture2DFromImage(ImageUtils::loadCookedImage(SANDSTONE_ROUGHNESS, maskSettings, jobSystem), mipLevels, !sRGB);
+		Texture* ao = ImageUtils::createTexture2DFromImage(ImageUtils::loadCookedImage(SANDSTONE_LOCAL_AO, maskSettings, jobSystem), mipLevels, !sRGB);
 
 		material_pbr->setConstantParameter("bOverrideAlbedo", false);
 		material_pbr->setConstantParameter("bOverrideNormal", false);
@@ -89,7 +89,7 @@ std::string browseModelFile() {
 	if (FAILED(hr)) return "";
 
 	COMDLG_FILTERSPEC filters[] = {
-		{ L"OBJ or glTF", L"*.obj;*.gltf" },
+		{ L"OBJ or glTF", L"*.obj;*.gltf;*.glb" },
 	};
 	hr = pFileOpen->SetFileTypes(_countof(filters), filters);
 	if (FAILED(hr)) return "";
@@ -121,7 +121,7 @@ EModelExt findModelFileExtension(const std::string& filepath) {
 	if (extensionIx != std::string::npos) {
 		std::string s = filepath.substr(extensionIx + 1);
 		if (s == "obj") ext = EModelExt::Obj;
-		else if (s == "gltf") ext = EModelExt::GLTF;
+		else if (s == "gltf" || s == "glb") ext = EModelExt::GLTF;
 	}
 	return ext;
 }
@@ -286,11 +286,11 @@ void World_ModelViewer::registerConsoleCommands() {
 				if (extensionIx != std::string::npos) {
 					std::string s = filepath.substr(extensionIx + 1);
 					if (s == "obj") ext = EModelExt::Obj;
-					else if (s == "gltf") ext = EModelExt::GLTF;
+					else if (s == "gltf" || s == "glb") ext = EModelExt::GLTF;
 				}
 
 				if (ext == EModelExt::Unknown) {
-					gConsole->addLine(L"> Can't recognize the file format; should be .obj or .gltf", false, true);
+					gConsole->addLine(L"> Can't recognize the file format; should be .obj, .gltf, or .glb", false, true);
 				} else {
 					wchar_t msg[256];
 					swprintf_s(msg, L"Try to load model: '%S'", filepath.c_str());
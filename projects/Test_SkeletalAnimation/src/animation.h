@@ -1,27 +1,26 @@
 #pragma once
 
-#include "assimp/scene.h"
+#include "pathos/animation/skeletal_animation.h"
 
 #include <string>
-#include <vector>
 
 namespace pathos {
 
 	class SkeletalAnimation {
 
 	public:
-		SkeletalAnimation(aiAnimation* anim) {
-			this->anim = anim;
-		}
+		SkeletalAnimation(const std::string& name, double duration)
+			: clip(name, (float)duration)
+		{}
 
-		inline const std::string getName() const { return std::string(anim->mName.C_Str()); }
-		double getLength() const { return anim->mDuration; }
+		inline const std::string& getName() const { return clip.getName(); }
+		inline double getLength() const { return clip.getDuration(); }
 
-	// TODO: encalsulate aiAnimation
-	//private:
-	public:
-		aiAnimation* anim;
+		inline AnimationClip& getClip() { return clip; }
+
+	private:
+		AnimationClip clip;
 
 	};
 
-}
\ No newline at end of file
+}
@@ -7,6 +7,7 @@
 #include "pathos/material/material.h"
 #include "pathos/loader/image_loader.h"
 #include "pathos/util/resource_finder.h"
+#include "pathos/util/log.h"
 
 #include <functional>
 #include <map>
@@ -35,6 +36,7 @@ namespace pathos {
 		scene = aiImportFile(path.c_str(), flags);
 		if (!scene) return false;
 
+		skinnedMesh = assetPtr<SkinnedMesh>(new SkinnedMesh);
 		loadNodes();
 		loadMaterials();
 		loadMeshes(invertWinding);
@@ -56,19 +58,15 @@ namespace pathos {
 	// sub functions
 
 	void DAELoader::loadNodes() {
-		 std::function<void(aiNode*,Node*)> dfs = [&](aiNode* anode, Node* node) {
-			 node->name = anode->mName.C_Str();
-			 node->localTransform = getGlmMat(anode->mTransformation);
+		// Every node becomes a joint. Depth-first order puts parents before their children.
+		Skeleton& skeleton = skinnedMesh->getSkeleton();
+		std::function<void(aiNode*, int32)> dfs = [&](aiNode* anode, int32 parent) {
+			int32 joint = skeleton.addJoint(anode->mName.C_Str(), parent, getGlmMat(anode->mTransformation));
 			for (auto i = 0u; i < anode->mNumChildren; ++i) {
-				auto achild = anode->mChildren[i];
-				Node* child = new Node;
-				dfs(achild, child);
-				node->children.push_back(child);
+				dfs(anode->mChildren[i], joint);
 			}
 		};
-		const auto aiRoot = scene->mRootNode;
-		root = new Node;
-		dfs(aiRoot, root);
+		dfs(scene->mRootNode, Skeleton::NO_PARENT);
 	}
 
 	void DAELoader::loadMaterials() {
@@ -99,7 +97,8 @@ namespace pathos {
 	}
 	
 	void DAELoader::loadMeshes(bool invertWinding) {
-		assetPtr<SkinnedMesh> pathosMesh(new SkinnedMesh);
+		assetPtr<SkinnedMesh> pathosMesh = skinnedMesh;
+		Skeleton& skeleton = pathosMesh->getSkeleton();
 
 		for (auto i = 0u; i < scene->mNumMeshes; ++i) {
 			const auto aiMeshIndex = i;
@@ -201,40 +200,58 @@ namespace pathos {
 			pathosMesh->addSection(0, G, M);
 
 			// set initial positions
-			std::vector<float> pos;
-			pos.assign(positions.data(), positions.data() + N * 3);
-			pathosMesh->setInitialPositions(aiMeshIndex, std::move(pos));
+			SoftwareSkinning& skinning = pathosMesh->setInitialPositions(aiMeshIndex, positions,
+				ai_mesh->HasNormals() ? normals : std::vector<GLfloat>());
 
 			// load bones
 			if (ai_mesh->HasBones()) {
 				for (auto i = 0u; i < ai_mesh->mNumBones; ++i) {
-					Bone bone;
 					const auto aiBone = ai_mesh->mBones[i];
-					bone.name = aiBone->mName.C_Str();
+					int32 joint = skeleton.findJoint(aiBone->mName.C_Str());
+					if (joint == Skeleton::NO_PARENT) {
+						LOG(LogWarning, "Bone without a node: %s", aiBone->mName.C_Str());
+						continue;
+					}
+					skeleton.setInverseBindMatrix(joint, getGlmMat(aiBone->mOffsetMatrix));
 					for (auto j = 0u; j < aiBone->mNumWeights; ++j) {
-						bone.vertexIDs.push_back(aiBone->mWeights[j].mVertexId);
-						bone.weights.push_back(aiBone->mWeights[j].mWeight);
+						skinning.addInfluence(aiBone->mWeights[j].mVertexId, joint, aiBone->mWeights[j].mWeight);
 					}
-					bone.offset = getGlmMat(aiBone->mOffsetMatrix);
-					pathosMesh->addBone(aiMeshIndex, bone);
 				}
 			}
 		}
 
-		pathosMesh->setRoot(root);
+		pathosMesh->finalizeSkinning();
 		pathosMesh->updateSoftwareSkinning();
 
 		mesh = pathosMesh;
 	}
 
 	void DAELoader::loadAnimations() {
-		assetPtr<SkinnedMesh> skinnedMesh = dynamicCastAsset<SkinnedMesh>(mesh);
-		if (!skinnedMesh) {
-			return;
-		}
+		// Key times stay in ticks, as the durations do.
+		const Skeleton& skeleton = skinnedMesh->getSkeleton();
 		for (auto i = 0u; i < scene->mNumAnimations; ++i) {
 			const auto aiAnim = scene->mAnimations[i];
-			SkeletalAnimation* anim = new SkeletalAnimation(aiAnim);
+			SkeletalAnimation* anim = new SkeletalAnimation(aiAnim->mName.C_Str(), aiAnim->mDuration);
+			for (auto j = 0u; j < aiAnim->mNumChannels; ++j) {
+				const aiNodeAnim* channel = aiAnim->mChannels[j];
+				int32 joint = skeleton.findJoint(channel->mNodeName.C_Str());
+				if (joint == Skeleton::NO_PARENT) {
+					continue;
+				}
+				AnimationTrack& track = anim->getClip().addTrack(joint);
+				for (auto k = 0u; k < channel->mNumPositionKeys; ++k) {
+					const aiVectorKey& key = channel->mPositionKeys[k];
+					track.translation.add((float)key.mTime, vector3(key.mValue.x, key.mValue.y, key.mValue.z));
+				}
+				for (auto k = 0u; k < channel->mNumRotationKeys; ++k) {
+					const aiQuatKey& key = channel->mRotationKeys[k];
+					track.rotation.add((float)key.mTime, glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z));
+				}
+				for (auto k = 0u; k < channel->mNumScalingKeys; ++k) {
+					const aiVectorKey& key = channel->mScalingKeys[k];
+					track.scale.add((float)key.mTime, vector3(key.mValue.x, key.mValue.y, key.mValue.z));
+				}
+			}
 			skinnedMesh->addAnimation(anim);
 		}
 	}
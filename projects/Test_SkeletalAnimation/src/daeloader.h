@@ -53,7 +53,7 @@ namespace pathos {
 	private:
 		const aiScene* scene = nullptr;
 		assetPtr<StaticMesh> mesh;
-		Node* root = nullptr;
+		assetPtr<SkinnedMesh> skinnedMesh;
 
 		std::string materialDir;
 		std::map<std::string, Texture*> textureMapping;
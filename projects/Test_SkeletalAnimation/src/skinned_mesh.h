@@ -1,47 +1,37 @@
 #pragma once
 
 #include "pathos/mesh/static_mesh.h"
+#include "pathos/animation/skeletal_animation.h"
+#include "pathos/animation/skinning.h"
 #include "pathos/smart_pointer.h"
 
-#include "badger/types/vector_types.h"
-
-#include "glm/gtx/quaternion.hpp"
-#include "assimp/anim.h"
-
-#include "bone.h"
 #include "animation.h"
 
-#include <map>
+#include <vector>
 
 namespace pathos {
 
-	struct Node {
-		std::string name;
-		std::vector<Node*> children;
-		glm::mat4 localTransform;
-		aiNode* ai;
-	};
-
 	class SkinnedMesh : public StaticMesh {
 
 	public:
 		SkinnedMesh();
 		SkinnedMesh(assetPtr<MeshGeometry> G, assetPtr<Material> M);
+		~SkinnedMesh();
 
-		void addBone(uint32_t geomIndex, const Bone& bone);
+		// Joints are added by the loader, before any skinning or animation.
+		inline Skeleton& getSkeleton() { return skeleton; }
 
 		void addAnimation(SkeletalAnimation* animation);
-		void setRoot(Node* root);
-		inline void setNodeGlobalTransform(std::string& name, glm::mat4& transform) {
-			nodeTransformMapping[name] = transform;
-		}
 
-		// #todo-skinning: switch to hardware skinning
-		void setInitialPositions(uint32_t geomIndex, const std::vector<float>& positions0);
+		// Bind pose of a geometry. Influences are added to the returned object.
+		SoftwareSkinning& setInitialPositions(uint32 geomIndex, const std::vector<float>& positions0, const std::vector<float>& normals0);
+
+		// Call after the skeleton and every skinning are complete.
+		void finalizeSkinning();
+
 		void updateSoftwareSkinning();
-		void updateAnimation(const std::string& name, double progress);
-		void updateAnimation(int index, double progress);
-		void updateGlobalTransform();
+		void updateAnimation(const std::string& name, double time);
+		void updateAnimation(int index, double time);
 
 		inline ModelTransform& getTransform() { return transform; }
 		inline SkeletalAnimation* getAnimationInfo(size_t ix) const { return animations[ix]; }
@@ -50,24 +40,12 @@ namespace pathos {
 	protected:
 		ModelTransform transform;
 
-		std::vector<std::vector<Bone>> boneMapping;
-		std::vector<std::vector<float>> initialPositionsMapping;
+		Skeleton skeleton;
+		AnimationPose pose;
+		std::vector<SoftwareSkinning> skinnings; // Per geometry
 
 		std::vector<SkeletalAnimation*> animations;
-		std::map<std::string, Node*> nodeMapping;
-		std::map<std::string, glm::mat4> nodeTransformMapping;
-		Node* root = nullptr;
-
-		// #todo-skinning: switch to hardware skinning
-		void updateBoneTransform();
-
-		int translation_lower_bound(aiNodeAnim* channel, double time);
-		int rotation_lower_bound(aiNodeAnim* channel, double time);
-		int scale_lower_bound(aiNodeAnim* channel, double time);
-
-		vector3 interpolate(aiVectorKey* keys, int len, int i, double time);
-		glm::quat interpolate(aiQuatKey* keys, int len, int i, double time);
 
 	};
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,173 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/loader/asset_streamer.h"
+#include "badger/system/job_system.h"
+
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Blob requests exercise the scheduling of AssetStreamer without any GPU resource.
+	struct BlobResult {
+		uint64 payload;
+		std::string contents; // "<null>" if the handler got no data.
+	};
+
+	void writeTextFile(const std::filesystem::path& path, const std::string& contents) {
+		std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), contents.size());
+	}
+
+	// Occupy the only worker so that requests stay pending until release() is called.
+	struct WorkerBlocker {
+		void block(AssetStreamer& streamer) {
+			JobDesc job;
+			job.routine = [this](const JobParam*) {
+				bStarted = true;
+				while (!bReleased) std::this_thread::yield();
+			};
+			streamer.internal_getJobSystem()->addJob(job);
+			while (!bStarted) std::this_thread::yield();
+		}
+		void release() { bReleased = true; }
+
+		std::atomic<bool> bStarted = { false };
+		std::atomic<bool> bReleased = { false };
+	};
+
+	// Flush in the calling thread, as the main thread would do every frame.
+	bool flushUntilIdle(AssetStreamer& streamer) {
+		for (int32 i = 0; i < 5000; ++i) {
+			streamer.internal_flushLoadedAssets();
+			if (streamer.getNumActiveRequests() == 0) return true;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return false;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestAssetStreamer) {
+	public:
+		TEST_METHOD(TestPriorityAndSharing) {
+			const std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "pathos_test_streamer";
+			std::filesystem::create_directories(tempDir);
+			const std::string pathA = (tempDir / "a.txt").string();
+			const std::string pathB = (tempDir / "b.txt").string();
+			const std::string pathC = (tempDir / "c.txt").string();
+			writeTextFile(pathA, "alpha");
+			writeTextFile(pathB, "bravo");
+			writeTextFile(pathC, "charlie");
+
+			AssetStreamer streamer;
+			streamer.initialize(1);
+
+			std::vector<BlobResult> results;
+			BlobHandler handler = [&results](const uint8* data, uint64 bytes, uint64 payload) {
+				results.push_back({ payload, data != nullptr ? std::string((const char*)data, (size_t)bytes) : std::string("<null>") });
+			};
+
+			WorkerBlocker blocker;
+			blocker.block(streamer);
+
+			AssetRequestHandle handleA = streamer.enqueueBlob(pathA.c_str(), handler, 0);
+			AssetRequestHandle handleB = streamer.enqueueBlob(pathB.c_str(), handler, 1);
+			AssetRequestHandle handleC = streamer.enqueueBlob(pathC.c_str(), handler, 2, 1.0f);
+			AssetRequestHandle handleA2 = streamer.enqueueBlob(pathA.c_str(), handler, 3);
+			Assert::IsTrue(handleA != handleA2, L"Shared requests should have their own handles");
+			Assert::AreEqual(3u, streamer.getNumActiveRequests(), L"Requests for the same file should be coalesced");
+
+			// Raise A above C, and drop B.
+			Assert::IsTrue(streamer.setRequestPriority(handleA, 2.0f), L"Pending request should accept a new priority");
+			Assert::IsTrue(streamer.cancelRequest(handleB), L"Failed to cancel a pending request");
+			Assert::IsFalse(streamer.cancelRequest(handleB), L"Cancelled handle should be invalid");
+			Assert::AreEqual(2u, streamer.getNumActiveRequests(), L"Cancelled request should leave the queue");
+
+			blocker.release();
+			Assert::IsTrue(flushUntilIdle(streamer), L"Requests did not finish");
+
+			Assert::AreEqual((size_t)3, results.size(), L"Wrong number of handler calls");
+			Assert::AreEqual((uint64)0, results[0].payload, L"Highest priority should be delivered first");
+			Assert::AreEqual(std::string("alpha"), results[0].contents, L"Wrong file contents");
+			Assert::AreEqual((uint64)3, results[1].payload, L"Every handler of a shared request should be invoked");
+			Assert::AreEqual(std::string("alpha"), results[1].contents, L"Shared handlers should see the same contents");
+			Assert::AreEqual((uint64)2, results[2].payload, L"Lower priority should be delivered later");
+			Assert::AreEqual(std::string("charlie"), results[2].contents, L"Wrong file contents");
+			Assert::IsFalse(streamer.setRequestPriority(handleC, 0.0f), L"Finished request should not accept a priority");
+
+			// Missing files are delivered as failures.
+			results.clear();
+			streamer.enqueueBlob((tempDir / "missing.txt").string().c_str(), handler, 7);
+			Assert::IsTrue(flushUntilIdle(streamer), L"Requests did not finish");
+			Assert::AreEqual((size_t)1, results.size(), L"Failed request should still invoke its handler");
+			Assert::AreEqual(std::string("<null>"), results[0].contents, L"Failed request should pass null data");
+
+			streamer.destroy();
+			std::error_code err;
+			std::filesystem::remove_all(tempDir, err);
+		}
+
+		TEST_METHOD(TestCancellation) {
+			const std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "pathos_test_streamer_cancel";
+			std::filesystem::create_directories(tempDir);
+			const std::string pathA = (tempDir / "a.txt").string();
+			const std::string pathB = (tempDir / "b.txt").string();
+			writeTextFile(pathA, "alpha");
+			writeTextFile(pathB, "bravo");
+
+			AssetStreamer streamer;
+			streamer.initialize(1);
+
+			std::vector<BlobResult> results;
+			BlobHandler handler = [&results](const uint8* data, uint64 bytes, uint64 payload) {
+				results.push_back({ payload, data != nullptr ? std::string((const char*)data, (size_t)bytes) : std::string("<null>") });
+			};
+
+			// Cancelling one of two shared handlers keeps the load alive for the other.
+			{
+				WorkerBlocker blocker;
+				blocker.block(streamer);
+				AssetRequestHandle handle0 = streamer.enqueueBlob(pathA.c_str(), handler, 0);
+				streamer.enqueueBlob(pathA.c_str(), handler, 1);
+				Assert::IsTrue(streamer.cancelRequest(handle0), L"Failed to cancel a shared request");
+				Assert::AreEqual(1u, streamer.getNumActiveRequests(), L"Shared load should survive a partial cancel");
+				blocker.release();
+				Assert::IsTrue(flushUntilIdle(streamer), L"Requests did not finish");
+				Assert::AreEqual((size_t)1, results.size(), L"Cancelled handler should not be invoked");
+				Assert::AreEqual((uint64)1, results[0].payload, L"Wrong handler was invoked");
+			}
+
+			// World transition: nothing of the old world is delivered.
+			{
+				results.clear();
+				WorkerBlocker blocker;
+				blocker.block(streamer);
+				streamer.enqueueBlob(pathA.c_str(), handler, 10);
+				streamer.enqueueBlob(pathB.c_str(), handler, 11);
+				streamer.cancelAllRequests();
+				Assert::AreEqual(0u, streamer.getNumActiveRequests(), L"Pending requests should be dropped");
+
+				AssetRequestHandle handleNew = streamer.enqueueBlob(pathB.c_str(), handler, 20);
+				blocker.release();
+				Assert::IsTrue(flushUntilIdle(streamer), L"Requests did not finish");
+				Assert::AreEqual((size_t)1, results.size(), L"Only the request after cancelAllRequests() should be delivered");
+				Assert::AreEqual((uint64)20, results[0].payload, L"Wrong handler was invoked");
+				Assert::AreEqual(std::string("bravo"), results[0].contents, L"Wrong file contents");
+				Assert::IsFalse(streamer.cancelRequest(handleNew), L"Delivered handle should be invalid");
+			}
+
+			streamer.destroy();
+			std::error_code err;
+			std::filesystem::remove_all(tempDir, err);
+		}
+	};
+}
@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/physics/broad_phase.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace badger::physics;
+
+namespace {
+	void bruteForcePairs(const std::vector<AABB>& bounds, std::vector<CollisionPair>& outPairs) {
+		outPairs.clear();
+		for (uint32 i = 0; i < bounds.size(); ++i) {
+			for (uint32 j = i + 1; j < bounds.size(); ++j) {
+				if (bounds[i].intersects(bounds[j])) {
+					outPairs.push_back(CollisionPair{ (int32)i, (int32)j });
+				}
+			}
+		}
+	}
+
+	bool samePairs(const std::vector<CollisionPair>& x, const std::vector<CollisionPair>& y) {
+		if (x.size() != y.size()) return false;
+		for (size_t i = 0; i < x.size(); ++i) {
+			if (x[i].a != y[i].a || x[i].b != y[i].b) return false;
+		}
+		return true;
+	}
+
+	// Cars on a long track. The track is perpendicular to the SAP1D axis (1,1,1),
+	// so every body projects to almost the same interval on it.
+	struct RacingTrack {
+		RacingTrack(uint32 numCars, uint32 seed)
+			: rng(seed)
+		{
+			std::uniform_real_distribution<float> along(0.0f, 4.0f * numCars);
+			std::uniform_real_distribution<float> lane(-8.0f, 8.0f);
+			std::uniform_real_distribution<float> speed(20.0f, 40.0f);
+			for (uint32 i = 0; i < numCars; ++i) {
+				distances.push_back(along(rng));
+				lanes.push_back(lane(rng));
+				speeds.push_back(speed(rng));
+			}
+			trackLength = 4.0f * numCars;
+		}
+		void step(float dt, std::vector<AABB>& outBounds) {
+			const vector3 trackDir = glm::normalize(vector3(1.0f, 0.0f, -1.0f));
+			const vector3 laneDir = glm::normalize(vector3(1.0f, 0.0f, 1.0f));
+			outBounds.resize(distances.size());
+			for (uint32 i = 0; i < distances.size(); ++i) {
+				distances[i] = std::fmod(distances[i] + speeds[i] * dt, trackLength);
+				const vector3 center = distances[i] * trackDir + lanes[i] * laneDir + vector3(0.0f, 0.75f, 0.0f);
+				outBounds[i] = AABB::fromCenterAndHalfSize(center, vector3(2.0f, 0.75f, 2.0f));
+			}
+		}
+		std::mt19937 rng;
+		std::vector<float> distances, lanes, speeds;
+		float trackLength;
+	};
+
+	// Bodies scattered in a box, each moving in a random direction.
+	struct ScatteredBodies {
+		ScatteredBodies(uint32 numBodies, uint32 seed)
+			: rng(seed)
+		{
+			const float range = 1.5f * std::cbrt((float)numBodies);
+			std::uniform_real_distribution<float> location(-range, range);
+			std::uniform_real_distribution<float> velocity(-2.0f, 2.0f);
+			std::uniform_real_distribution<float> extent(0.2f, 1.0f);
+			for (uint32 i = 0; i < numBodies; ++i) {
+				centers.push_back(vector3(location(rng), location(rng), location(rng)));
+				velocities.push_back(vector3(velocity(rng), velocity(rng), velocity(rng)));
+				halfSizes.push_back(vector3(extent(rng), extent(rng), extent(rng)));
+			}
+		}
+		void step(float dt, std::vector<AABB>& outBounds) {
+			outBounds.resize(centers.size());
+			for (uint32 i = 0; i < centers.size(); ++i) {
+				centers[i] += velocities[i] * dt;
+				outBounds[i] = AABB::fromCenterAndHalfSize(centers[i], halfSizes[i]);
+			}
+		}
+		void removeBody(uint32 index) {
+			centers[index] = centers.back(); centers.pop_back();
+			velocities[index] = velocities.back(); velocities.pop_back();
+			halfSizes[index] = halfSizes.back(); halfSizes.pop_back();
+		}
+		void addBody() {
+			std::uniform_real_distribution<float> location(-5.0f, 5.0f);
+			centers.push_back(vector3(location(rng), location(rng), location(rng)));
+			velocities.push_back(vector3(1.0f, 0.0f, -1.0f));
+			halfSizes.push_back(vector3(0.5f));
+		}
+		std::mt19937 rng;
+		std::vector<vector3> centers, velocities, halfSizes;
+	};
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestBroadPhase) {
+	public:
+		TEST_METHOD(TestBroadPhasesMatchBruteForce) {
+			JobSystem jobSystem;
+			jobSystem.start(2);
+
+			ScatteredBodies bodies(500, 1);
+			std::unique_ptr<BroadPhase> sap3D = createBroadPhase(EBroadPhaseType::SweepAndPrune3D);
+			std::unique_ptr<BroadPhase> tree = createBroadPhase(EBroadPhaseType::DynamicAABBTree, &jobSystem);
+			std::unique_ptr<BroadPhase> sap1D = createBroadPhase(EBroadPhaseType::SweepAndPrune1D);
+
+			std::vector<AABB> bounds;
+			std::vector<CollisionPair> expected, pairsSAP3D, pairsTree, pairsSAP1D;
+			bool bSAP3DMatch = true, bTreeMatch = true, bSAP1DCovers = true;
+			for (int32 frame = 0; frame < 60; ++frame) {
+				// Add and remove some bodies in the middle of the simulation.
+				if (frame % 10 == 5) {
+					for (uint32 i = 0; i < 10; ++i) {
+						const uint32 index = (frame * 31 + i * 17) % (uint32)bodies.centers.size();
+						const uint32 lastIndex = (uint32)bodies.centers.size() - 1;
+						sap3D->removeBody(index, lastIndex);
+						tree->removeBody(index, lastIndex);
+						bodies.removeBody(index);
+					}
+					for (uint32 i = 0; i < 15; ++i) {
+						bodies.addBody();
+					}
+				}
+
+				bodies.step(0.1f, bounds);
+				bruteForcePairs(bounds, expected);
+				sap3D->update(bounds, pairsSAP3D);
+				tree->update(bounds, pairsTree);
+				sap1D->update(bounds, pairsSAP1D);
+
+				bSAP3DMatch = bSAP3DMatch && samePairs(expected, pairsSAP3D);
+				bTreeMatch = bTreeMatch && samePairs(expected, pairsTree);
+				for (const CollisionPair& pair : expected) {
+					bSAP1DCovers = bSAP1DCovers && (std::find(pairsSAP1D.begin(), pairsSAP1D.end(), pair) != pairsSAP1D.end());
+				}
+			}
+
+			// parallelFor() runs serially once the job system is stopped.
+			jobSystem.stop();
+			for (int32 frame = 0; frame < 5; ++frame) {
+				bodies.step(0.1f, bounds);
+				bruteForcePairs(bounds, expected);
+				tree->update(bounds, pairsTree);
+				bTreeMatch = bTreeMatch && samePairs(expected, pairsTree);
+			}
+
+			Assert::IsTrue(expected.size() > 0, L"Test scene should have overlapping bodies");
+			Assert::IsTrue(bSAP3DMatch, L"SAP 3D should output exactly the overlapping pairs");
+			Assert::IsTrue(bTreeMatch, L"AABB tree should output exactly the overlapping pairs");
+			Assert::IsTrue(bSAP1DCovers, L"SAP 1D should not miss overlapping pairs");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkBroadPhase)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Pair generation time per step. 'racing' is the worst case of SAP 1D.
+		TEST_METHOD(BenchmarkBroadPhase) {
+			constexpr int32 NUM_FRAMES = 30;
+			const uint32 bodyCounts[] = { 1000, 5000, 20000 };
+			const wchar_t* broadPhaseNames[] = { L"SAP1D", L"SAP3D", L"AABBTree" };
+			const uint32 numWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			wchar_t msg[256];
+
+			JobSystem jobSystem;
+			jobSystem.start(numWorkers);
+
+			for (int32 scene = 0; scene < 2; ++scene) {
+				for (uint32 numBodies : bodyCounts) {
+					for (uint32 type = 0; type < (uint32)EBroadPhaseType::Count; ++type) {
+						// Almost all pairs are candidates, which takes too long and too much memory.
+						if (scene == 1 && type == (uint32)EBroadPhaseType::SweepAndPrune1D && numBodies > 5000) {
+							continue;
+						}
+						std::unique_ptr<BroadPhase> broadPhase = createBroadPhase((EBroadPhaseType)type, &jobSystem);
+						ScatteredBodies scattered(numBodies, 2);
+						RacingTrack racing(numBodies, 3);
+						std::vector<AABB> bounds;
+						std::vector<CollisionPair> pairs;
+
+						float elapsedFirst = 0.0f, elapsed = 0.0f;
+						for (int32 frame = 0; frame <= NUM_FRAMES; ++frame) {
+							if (scene == 0) scattered.step(1.0f / 60.0f, bounds);
+							else racing.step(1.0f / 60.0f, bounds);
+
+							Stopwatch stopwatch;
+							broadPhase->update(bounds, pairs);
+							// The first update builds the data structure.
+							(frame == 0 ? elapsedFirst : elapsed) += stopwatch.stop();
+						}
+
+						swprintf_s(msg, L"%ls bodies=%6u %-8ls pairs=%7u build=%8.3f ms update=%8.3f ms\n",
+							scene == 0 ? L"scattered" : L"racing   ", numBodies, broadPhaseNames[type],
+							(uint32)pairs.size(), elapsedFirst, elapsed / NUM_FRAMES);
+						Logger::WriteMessage(msg);
+					}
+				}
+			}
+
+			jobSystem.stop();
+		}
+	};
+}
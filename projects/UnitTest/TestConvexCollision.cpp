@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/physics/collision.h"
+#include "badger/physics/shape.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <memory>
+#include <random>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace badger::physics;
+
+namespace {
+	// Every point is a hull vertex.
+	std::vector<vector3> makePointsOnEllipsoid(uint32 count, uint32 seed) {
+		std::mt19937 rng(seed);
+		std::normal_distribution<float> gaussian(0.0f, 1.0f);
+		std::vector<vector3> points(count);
+		for (uint32 i = 0; i < count; ++i) {
+			points[i] = glm::normalize(vector3(gaussian(rng), gaussian(rng), gaussian(rng))) * vector3(1.0f, 0.6f, 0.8f);
+		}
+		return points;
+	}
+
+	quat makeRandomOrientation(std::mt19937& rng) {
+		std::normal_distribution<float> gaussian(0.0f, 1.0f);
+		return glm::normalize(quat(gaussian(rng), gaussian(rng), gaussian(rng), gaussian(rng)));
+	}
+
+	float bruteForceMaxDot(const std::vector<vector3>& points, const vector3& dir) {
+		float maxDist = -FLT_MAX;
+		for (const vector3& pt : points) {
+			maxDist = std::max(maxDist, glm::dot(dir, pt));
+		}
+		return maxDist;
+	}
+
+	// Body pairs that approach each other, overlap and separate again.
+	struct ConvexPairs {
+		ConvexPairs(const ShapeConvex* shape, uint32 numPairs, uint32 seed)
+			: rng(seed)
+		{
+			std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+			std::uniform_real_distribution<float> phase(0.0f, 6.28f);
+			bodiesA.resize(numPairs);
+			bodiesB.resize(numPairs);
+			for (uint32 i = 0; i < numPairs; ++i) {
+				bodiesA[i].setShape(const_cast<ShapeConvex*>(shape));
+				bodiesA[i].setPosition(vector3(4.0f * i, 0.0f, 0.0f));
+				bodiesA[i].setOrientation(makeRandomOrientation(rng));
+				bodiesB[i].setShape(const_cast<ShapeConvex*>(shape));
+				bodiesB[i].setOrientation(makeRandomOrientation(rng));
+				axes.push_back(glm::normalize(vector3(offset(rng), offset(rng), offset(rng))));
+				phases.push_back(phase(rng));
+			}
+		}
+		void step(float time) {
+			const quat spin = glm::angleAxis(0.02f, vector3(0.0f, 1.0f, 0.0f));
+			for (uint32 i = 0; i < bodiesA.size(); ++i) {
+				const vector3 center = bodiesA[i].getPosition();
+				bodiesB[i].setPosition(center + axes[i] * (2.2f * std::sin(time + phases[i])));
+				bodiesB[i].setOrientation(glm::normalize(spin * bodiesB[i].getOrientation()));
+			}
+		}
+		std::mt19937 rng;
+		std::vector<Body> bodiesA, bodiesB;
+		std::vector<vector3> axes;
+		std::vector<float> phases;
+	};
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestConvexCollision) {
+	public:
+		TEST_METHOD(TestSupportVertexMatchesBruteForce) {
+			std::mt19937 rng(1);
+			std::normal_distribution<float> gaussian(0.0f, 1.0f);
+			for (uint32 numPoints : { 7u, 30u, 500u, 3000u }) {
+				ShapeConvex shape(makePointsOnEllipsoid(numPoints, numPoints));
+				const std::vector<vector3>& points = shape.getPoints();
+
+				bool bLinearMatches = true, bClimbMatches = true;
+				uint32 hint = 0;
+				for (uint32 i = 0; i < 1000; ++i) {
+					const vector3 dir = glm::normalize(vector3(gaussian(rng), gaussian(rng), gaussian(rng)));
+					const float expected = bruteForceMaxDot(points, dir);
+
+					const uint32 linear = shape.findSupportVertexLinear(dir);
+					bLinearMatches = bLinearMatches && std::abs(glm::dot(dir, points[linear]) - expected) < 1e-5f;
+
+					// Alternate between climbing from the last result and from an arbitrary vertex.
+					hint = (i % 2 == 0) ? hint : (uint32)(rng() % points.size());
+					hint = shape.findSupportVertexHillClimb(dir, hint);
+					bClimbMatches = bClimbMatches && std::abs(glm::dot(dir, points[hint]) - expected) < 1e-5f;
+				}
+				Assert::IsTrue(bLinearMatches, L"Linear search should find the furthest vertex");
+				Assert::IsTrue(bClimbMatches, L"Hill climbing should find the furthest vertex");
+			}
+		}
+
+		TEST_METHOD(TestWarmStartMatchesColdStart) {
+			ShapeConvex shape(makePointsOnEllipsoid(200, 2));
+			ConvexPairs pairs(&shape, 50, 3);
+			std::vector<GJKCache> caches(pairs.bodiesA.size());
+
+			uint32 numIntersections = 0, numMismatches = 0;
+			for (int32 frame = 0; frame < 120; ++frame) {
+				pairs.step(frame / 30.0f);
+				for (uint32 i = 0; i < pairs.bodiesA.size(); ++i) {
+					Contact coldContact, warmContact;
+					const bool bCold = intersect(&pairs.bodiesA[i], &pairs.bodiesB[i], coldContact);
+					const bool bWarm = intersect(&pairs.bodiesA[i], &pairs.bodiesB[i], warmContact, &caches[i]);
+					if (bCold != bWarm || std::abs(coldContact.separationDistance - warmContact.separationDistance) > 1e-2f) {
+						++numMismatches;
+					}
+					numIntersections += bCold ? 1 : 0;
+				}
+			}
+			Assert::IsTrue(numIntersections > 0, L"Test scene should have intersecting pairs");
+			Assert::AreEqual(0u, numMismatches, L"Warm-started GJK should give the same result");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkConvexPairTests)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Static intersection tests per second between convex bodies.
+		TEST_METHOD(BenchmarkConvexPairTests) {
+			constexpr int32 NUM_FRAMES = 30;
+			constexpr uint32 NUM_PAIRS = 1000;
+			const uint32 hullSizes[] = { 16, 64, 256, 1024 };
+			wchar_t msg[256];
+
+			for (uint32 numPoints : hullSizes) {
+				ShapeConvex shape(makePointsOnEllipsoid(numPoints, 4));
+				ConvexPairs pairs(&shape, NUM_PAIRS, 5);
+				std::vector<GJKCache> caches(NUM_PAIRS);
+
+				float elapsedCold = 0.0f, elapsedWarm = 0.0f;
+				uint32 numIntersections = 0;
+				for (int32 frame = 0; frame < NUM_FRAMES; ++frame) {
+					pairs.step(frame / 30.0f);
+					Contact contact;
+
+					Stopwatch stopwatch;
+					for (uint32 i = 0; i < NUM_PAIRS; ++i) {
+						numIntersections += intersect(&pairs.bodiesA[i], &pairs.bodiesB[i], contact) ? 1 : 0;
+					}
+					elapsedCold += stopwatch.stop();
+
+					stopwatch.start();
+					for (uint32 i = 0; i < NUM_PAIRS; ++i) {
+						intersect(&pairs.bodiesA[i], &pairs.bodiesB[i], contact, &caches[i]);
+					}
+					elapsedWarm += stopwatch.stop();
+				}
+
+				const float numTests = (float)(NUM_PAIRS * NUM_FRAMES);
+				swprintf_s(msg, L"hull vertices=%5u intersecting=%5.1f%% cold=%9.0f tests/s warm-started=%9.0f tests/s\n",
+					(uint32)shape.getPoints().size(), 100.0f * numIntersections / numTests,
+					numTests / (elapsedCold * 0.001f), numTests / (elapsedWarm * 0.001f));
+				Logger::WriteMessage(msg);
+			}
+		}
+	};
+}
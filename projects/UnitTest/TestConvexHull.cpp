@@ -0,0 +1,215 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/math/convex_hull.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <random>
+#include <thread>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace badger;
+
+namespace {
+	std::vector<vector3> makePointsInBall(uint32 count, uint32 seed, bool bOnSurface) {
+		std::mt19937 rng(seed);
+		std::normal_distribution<float> gaussian(0.0f, 1.0f);
+		std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+		std::vector<vector3> points(count);
+		for (uint32 i = 0; i < count; ++i) {
+			vector3 dir = glm::normalize(vector3(gaussian(rng), gaussian(rng), gaussian(rng)));
+			float radius = bOnSurface ? 1.0f : std::cbrt(uniform(rng));
+			// Stretch it so that the inertia tensor is not a multiple of identity.
+			points[i] = radius * dir * vector3(1.0f, 2.0f, 0.5f) + vector3(3.0f, -1.0f, 2.0f);
+		}
+		return points;
+	}
+
+	// Every input point should be on or behind every hull triangle.
+	bool containsAllPoints(const std::vector<vector3>& input, const std::vector<vector3>& hullPoints, const std::vector<ConvexHullTriangle>& hullTriangles) {
+		for (const ConvexHullTriangle& tri : hullTriangles) {
+			const vector3 n = glm::normalize(glm::cross(hullPoints[tri.b] - hullPoints[tri.a], hullPoints[tri.c] - hullPoints[tri.a]));
+			for (const vector3& pt : input) {
+				if (glm::dot(n, pt - hullPoints[tri.a]) > 1e-4f) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	float maxAbsDifference(const matrix3& x, const matrix3& y) {
+		float diff = 0.0f;
+		for (int32 i = 0; i < 3; ++i) {
+			for (int32 j = 0; j < 3; ++j) {
+				diff = std::max(diff, std::abs(x[i][j] - y[i][j]));
+			}
+		}
+		return diff;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestConvexHull) {
+	public:
+		TEST_METHOD(TestHullOfBox) {
+			// Corners of a box and points inside of it.
+			std::vector<vector3> points = makePointsInBall(200, 1, false);
+			for (vector3& pt : points) {
+				pt = 0.2f * (pt - vector3(3.0f, -1.0f, 2.0f));
+			}
+			for (uint32 i = 0; i < 8; ++i) {
+				points.push_back(vector3((i & 1) ? 1.0f : -1.0f, (i & 2) ? 2.0f : -2.0f, (i & 4) ? 3.0f : -3.0f));
+			}
+
+			std::vector<vector3> hullPoints;
+			std::vector<ConvexHullTriangle> hullTriangles;
+			buildConvexHull(points, hullPoints, hullTriangles);
+			Assert::AreEqual((size_t)8, hullPoints.size(), L"Hull of a box should have 8 vertices");
+			Assert::AreEqual((size_t)12, hullTriangles.size(), L"Hull of a box should have 12 triangles");
+			Assert::IsTrue(containsAllPoints(points, hullPoints, hullTriangles), L"Hull should contain all points");
+
+			// Exact mass properties of a 2x4x6 box.
+			const vector3 cm = calculateCenterOfMass(hullPoints, hullTriangles);
+			const matrix3 inertia = calculateInertiaTensor(hullPoints, hullTriangles, cm);
+			const matrix3 expected(
+				(16.0f + 36.0f) / 12.0f, 0.0f, 0.0f,
+				0.0f, (4.0f + 36.0f) / 12.0f, 0.0f,
+				0.0f, 0.0f, (4.0f + 16.0f) / 12.0f);
+			Assert::IsTrue(glm::length(cm) < 1e-5f, L"Center of mass of the box is wrong");
+			Assert::IsTrue(maxAbsDifference(inertia, expected) < 1e-4f, L"Inertia tensor of the box is wrong");
+		}
+
+		TEST_METHOD(TestHullContainsAllPoints) {
+			JobSystem jobSystem;
+			jobSystem.start(2);
+
+			for (bool bOnSurface : { false, true }) {
+				std::vector<vector3> points = makePointsInBall(3000, 2, bOnSurface);
+				std::vector<vector3> hullPoints, parallelHullPoints;
+				std::vector<ConvexHullTriangle> hullTriangles, parallelHullTriangles;
+				buildConvexHull(points, hullPoints, hullTriangles);
+				buildConvexHull(points, parallelHullPoints, parallelHullTriangles, &jobSystem);
+
+				Assert::IsTrue(containsAllPoints(points, hullPoints, hullTriangles), L"Hull should contain all points");
+				// Closed triangle mesh of genus 0: V - E + F = 2 and 3F = 2E.
+				Assert::AreEqual(2 * hullPoints.size() - 4, hullTriangles.size(), L"Hull is not a closed mesh");
+				Assert::IsTrue(hullPoints == parallelHullPoints, L"Parallel build should give the same hull");
+				Assert::AreEqual(hullTriangles.size(), parallelHullTriangles.size(), L"Parallel build should give the same hull");
+			}
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestMassPropertiesMatchSampled) {
+			std::vector<vector3> points = makePointsInBall(60, 3, true);
+			std::vector<vector3> hullPoints;
+			std::vector<ConvexHullTriangle> hullTriangles;
+			buildConvexHull(points, hullPoints, hullTriangles);
+
+			const vector3 cm = calculateCenterOfMass(hullPoints, hullTriangles);
+			const vector3 sampledCm = calculateCenterOfMassSampled(hullPoints, hullTriangles);
+			const matrix3 inertia = calculateInertiaTensor(hullPoints, hullTriangles, cm);
+			const matrix3 sampledInertia = calculateInertiaTensorSampled(hullPoints, hullTriangles, cm);
+
+			// Grid samples are at the corners of cells, so the sampled result is off by a fraction of a cell.
+			Assert::IsTrue(glm::length(cm - sampledCm) < 0.02f, L"Center of mass should match the sampled one");
+			const float scale = std::max(inertia[0][0], std::max(inertia[1][1], inertia[2][2]));
+			Assert::IsTrue(maxAbsDifference(inertia, sampledInertia) < 0.02f * scale, L"Inertia tensor should match the sampled one");
+		}
+
+		TEST_METHOD(TestDegenerateInput) {
+			// A tilted square grid. Every point is on one plane.
+			std::vector<vector3> flatPoints;
+			for (uint32 i = 0; i < 100; ++i) {
+				const float u = (float)(i % 10), v = (float)(i / 10);
+				flatPoints.push_back(vector3(u, 0.5f * u + v, 2.0f - v));
+			}
+			const std::vector<vector3> linePoints = { vector3(0.0f), vector3(1.0f), vector3(2.0f), vector3(3.0f), vector3(4.0f) };
+			const std::vector<vector3> samePoints(10, vector3(1.0f, 2.0f, 3.0f));
+
+			const std::vector<vector3>* degenerateInputs[] = { &flatPoints, &linePoints, &samePoints };
+			for (const std::vector<vector3>* points : degenerateInputs) {
+				std::vector<vector3> hullPoints = { vector3(0.0f) };
+				std::vector<ConvexHullTriangle> hullTriangles = { ConvexHullTriangle{ 0, 0, 0 } };
+				Assert::IsFalse(buildConvexHull(*points, hullPoints, hullTriangles), L"Points without volume have no hull");
+				Assert::IsTrue(hullPoints.empty() && hullTriangles.empty(), L"Outputs are cleared");
+			}
+
+			// Mass properties of flat points don't assert and are finite.
+			const std::vector<ConvexHullTriangle> noTriangles;
+			const vector3 cm = calculateCenterOfMass(flatPoints, noTriangles);
+			const matrix3 inertia = calculateInertiaTensor(flatPoints, noTriangles, cm);
+			Assert::IsTrue(glm::length(cm - vector3(4.5f, 6.75f, -2.5f)) < 1e-4f, L"Center of mass is the average of points");
+			Assert::IsTrue(std::isfinite(inertia[0][0] + inertia[1][1] + inertia[2][2]) && inertia[0][0] > 0.0f, L"Inertia tensor is finite");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkConvexHull)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Hull build time for points in and on a ball, and mass properties of the hull.
+		TEST_METHOD(BenchmarkConvexHull) {
+			const uint32 pointCounts[] = { 1000, 5000, 20000 };
+			const uint32 numWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			wchar_t msg[256];
+
+			JobSystem jobSystem;
+			jobSystem.start(numWorkers);
+
+			for (bool bOnSurface : { false, true }) {
+				for (uint32 numPoints : pointCounts) {
+					std::vector<vector3> points = makePointsInBall(numPoints, 4, bOnSurface);
+					std::vector<vector3> hullPoints;
+					std::vector<ConvexHullTriangle> hullTriangles;
+
+					Stopwatch stopwatch;
+					buildConvexHull(points, hullPoints, hullTriangles);
+					const float elapsedSerial = stopwatch.stop();
+
+					stopwatch.start();
+					buildConvexHull(points, hullPoints, hullTriangles, &jobSystem);
+					const float elapsedParallel = stopwatch.stop();
+
+					stopwatch.start();
+					const vector3 cm = calculateCenterOfMass(hullPoints, hullTriangles);
+					calculateInertiaTensor(hullPoints, hullTriangles, cm);
+					const float elapsedMass = stopwatch.stop();
+
+					swprintf_s(msg, L"%ls points=%6u hull=%6u tris=%6u build: serial=%8.3f ms parallel=%8.3f ms mass properties=%7.3f ms\n",
+						bOnSurface ? L"surface" : L"ball   ", numPoints, (uint32)hullPoints.size(), (uint32)hullTriangles.size(),
+						elapsedSerial, elapsedParallel, elapsedMass);
+					Logger::WriteMessage(msg);
+				}
+			}
+
+			// Sampling is too slow for big hulls.
+			{
+				std::vector<vector3> points = makePointsInBall(100, 5, true);
+				std::vector<vector3> hullPoints;
+				std::vector<ConvexHullTriangle> hullTriangles;
+				buildConvexHull(points, hullPoints, hullTriangles);
+
+				Stopwatch stopwatch;
+				const vector3 cm = calculateCenterOfMass(hullPoints, hullTriangles);
+				calculateInertiaTensor(hullPoints, hullTriangles, cm);
+				const float elapsedAnalytic = stopwatch.stop();
+
+				stopwatch.start();
+				const vector3 sampledCm = calculateCenterOfMassSampled(hullPoints, hullTriangles);
+				calculateInertiaTensorSampled(hullPoints, hullTriangles, sampledCm);
+				const float elapsedSampled = stopwatch.stop();
+
+				swprintf_s(msg, L"mass properties of %u triangles: analytic=%8.3f ms sampled=%8.3f ms\n",
+					(uint32)hullTriangles.size(), elapsedAnalytic, elapsedSampled);
+				Logger::WriteMessage(msg);
+			}
+
+			jobSystem.stop();
+		}
+	};
+}
@@ -0,0 +1,276 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/loader/objloader.h"
+#include "pathos/loader/cooked_mesh.h"
+#include "pathos/util/derived_data_cache.h"
+#include "badger/system/stopwatch.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Triangle list of a grid with (numCells + 1)^2 vertices.
+	void makeGrid(uint32 numCells, float z, std::vector<float>& positions, std::vector<float>& texcoords, std::vector<float>& normals, std::vector<uint32>& indices) {
+		const uint32 numRows = numCells + 1;
+		for (uint32 y = 0; y < numRows; ++y) {
+			for (uint32 x = 0; x < numRows; ++x) {
+				positions.insert(positions.end(), { (float)x, (float)y, z });
+				texcoords.insert(texcoords.end(), { (float)x / numCells, (float)y / numCells });
+				normals.insert(normals.end(), { 0.0f, 0.0f, 1.0f });
+			}
+		}
+		for (uint32 y = 0; y < numCells; ++y) {
+			for (uint32 x = 0; x < numCells; ++x) {
+				uint32 i0 = y * numRows + x;
+				indices.insert(indices.end(), { i0, i0 + 1, i0 + numRows + 1, i0, i0 + numRows + 1, i0 + numRows });
+			}
+		}
+	}
+
+	// Same grid as Wavefront OBJ text; every vertex is referenced by several faces.
+	std::string makeGridOBJ(uint32 numCells) {
+		std::ostringstream obj;
+		const uint32 numRows = numCells + 1;
+		obj << "o grid\n";
+		for (uint32 y = 0; y < numRows; ++y) {
+			for (uint32 x = 0; x < numRows; ++x) {
+				obj << "v " << x << " " << y << " 0\n";
+				obj << "vt " << (float)x / numCells << " " << (float)y / numCells << "\n";
+			}
+		}
+		obj << "vn 0 0 1\n";
+		for (uint32 y = 0; y < numCells; ++y) {
+			for (uint32 x = 0; x < numCells; ++x) {
+				uint32 i0 = y * numRows + x + 1; // OBJ indices are 1-based
+				uint32 i1 = i0 + 1, i2 = i0 + numRows + 1, i3 = i0 + numRows;
+				obj << "f " << i0 << "/" << i0 << "/1 " << i1 << "/" << i1 << "/1 " << i2 << "/" << i2 << "/1\n";
+				obj << "f " << i0 << "/" << i0 << "/1 " << i2 << "/" << i2 << "/1 " << i3 << "/" << i3 << "/1\n";
+			}
+		}
+		return obj.str();
+	}
+
+	// Temporary derived data cache with OBJ files written to it.
+	struct TempOBJDirectory {
+		TempOBJDirectory() {
+			path = std::filesystem::temp_directory_path() / "pathos_test_ddc";
+			std::filesystem::create_directories(path);
+			DerivedDataCache::get().setCacheDirectory(path.string() + "/");
+		}
+		~TempOBJDirectory() {
+			std::error_code err;
+			std::filesystem::remove_all(path, err);
+			DerivedDataCache::get().setCacheDirectory("");
+		}
+		// @return Cache filepath of the OBJ. Same key as OBJLoader if there is no mtllib.
+		std::string writeOBJ(const std::string& filename, const std::string& objText) {
+			const std::string objFilepath = getFilepath(filename);
+			{
+				std::ofstream fs(objFilepath, std::ios::binary | std::ios::trunc);
+				fs << objText;
+			}
+			const uint64 sourceHash = DerivedDataCache::hashBytes(objText.data(), objText.size(), COOKED_MESH_VERSION);
+			return DerivedDataCache::get().getCacheFilepath("mesh", sourceHash, ".pmesh");
+		}
+		std::string getFilepath(const std::string& filename) const { return (path / filename).string(); }
+		std::string getDirectory() const { return path.string() + "/"; }
+		std::filesystem::path path;
+	};
+
+	bool isValidCacheEntry(const std::string& cacheFilepath, const std::string& objText) {
+		std::vector<uint8> bytes;
+		if (!readFileBytes(cacheFilepath.c_str(), bytes)) {
+			return false;
+		}
+		CookedMesh cooked;
+		const uint64 sourceHash = DerivedDataCache::hashBytes(objText.data(), objText.size(), COOKED_MESH_VERSION);
+		return cooked.initialize(bytes.data(), bytes.size(), sourceHash);
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestCookedMesh) {
+	public:
+		TEST_METHOD(TestRoundTrip) {
+			std::vector<float> smallPositions, smallTexcoords, smallNormals;
+			std::vector<uint32> smallIndices;
+			makeGrid(4, 1.0f, smallPositions, smallTexcoords, smallNormals, smallIndices);
+			// More than 65536 vertices
+			std::vector<float> largePositions, largeTexcoords, largeNormals;
+			std::vector<uint32> largeIndices;
+			makeGrid(300, -2.0f, largePositions, largeTexcoords, largeNormals, largeIndices);
+
+			CookedMeshWriter writer;
+			writer.beginShape("small");
+			writer.addSection(3, smallPositions, smallTexcoords, smallNormals, smallIndices);
+			writer.beginShape("large");
+			writer.addSection(-1, largePositions, largeTexcoords, std::vector<float>(), largeIndices);
+			writer.addSection(0, smallPositions, smallTexcoords, smallNormals, smallIndices);
+
+			std::vector<uint8> data;
+			writer.finalize(0x1234, data);
+
+			CookedMesh cooked;
+			Assert::IsTrue(cooked.initialize(data.data(), data.size(), 0x1234), L"Cooked data should be valid");
+			Assert::AreEqual(2u, cooked.getNumShapes(), L"Wrong number of shapes");
+			Assert::AreEqual(std::string("small"), std::string(cooked.getShapeName(0)), L"Wrong shape name");
+			Assert::AreEqual(std::string("large"), std::string(cooked.getShapeName(1)), L"Wrong shape name");
+			Assert::AreEqual(2u, cooked.getShape(1).numSections, L"Wrong number of sections");
+
+			const CookedMeshSection& small = cooked.getSection(cooked.getShape(0).firstSection);
+			Assert::AreEqual(3, small.materialID, L"Wrong material ID");
+			Assert::IsTrue((small.flags & COOKED_SECTION_INDEX16) != 0, L"Small section should use 16-bit indices");
+			Assert::IsTrue(cooked.getNormals(small) != nullptr, L"Normals should be stored");
+			Assert::AreEqual(1.0f, small.boundsMin[2], L"Wrong bounds");
+			Assert::AreEqual(4.0f, small.boundsMax[0], L"Wrong bounds");
+
+			const CookedMeshSection& large = cooked.getSection(cooked.getShape(1).firstSection);
+			Assert::AreEqual(-1, large.materialID, L"Wrong material ID");
+			Assert::IsTrue((large.flags & COOKED_SECTION_INDEX16) == 0, L"Large section should use 32-bit indices");
+			Assert::IsTrue(cooked.getNormals(large) == nullptr, L"Empty normals should not be stored");
+			Assert::AreEqual((uint32)largeIndices.size(), large.numIndices, L"Wrong number of indices");
+			Assert::AreEqual(300.0f, large.boundsMax[1], L"Wrong bounds");
+
+			for (uint32 i = 0; i < small.numIndices; ++i) {
+				Assert::AreEqual(smallIndices[i], cooked.getIndex(small, i), L"Index mismatch");
+			}
+			for (uint32 i = 0; i < large.numIndices; i += 97) {
+				Assert::AreEqual(largeIndices[i], cooked.getIndex(large, i), L"Index mismatch");
+			}
+			Assert::IsTrue(0 == ::memcmp(largePositions.data(), cooked.getPositions(large), largePositions.size() * sizeof(float)), L"Position mismatch");
+			Assert::IsTrue(0 == ::memcmp(smallTexcoords.data(), cooked.getTexcoords(small), smallTexcoords.size() * sizeof(float)), L"Texcoord mismatch");
+			Assert::IsTrue((reinterpret_cast<uintptr_t>(cooked.getPositions(large)) % 16) == 0, L"Streams should be aligned");
+		}
+
+		TEST_METHOD(TestValidation) {
+			std::vector<float> positions, texcoords, normals;
+			std::vector<uint32> indices;
+			makeGrid(2, 0.0f, positions, texcoords, normals, indices);
+
+			CookedMeshWriter writer;
+			writer.beginShape("grid");
+			writer.addSection(0, positions, texcoords, normals, indices);
+			std::vector<uint8> data;
+			writer.finalize(42, data);
+
+			CookedMesh cooked;
+			Assert::IsTrue(cooked.initialize(data.data(), data.size(), 42), L"Cooked data should be valid");
+			Assert::IsFalse(cooked.initialize(data.data(), data.size(), 43), L"Data of another source should be rejected");
+			Assert::IsFalse(cooked.isValid(), L"Failed initialize() should invalidate the view");
+			Assert::IsFalse(cooked.initialize(data.data(), data.size() - 4, 42), L"Truncated data should be rejected");
+
+			std::vector<uint8> otherVersion = data;
+			reinterpret_cast<CookedMeshHeader*>(otherVersion.data())->version = COOKED_MESH_VERSION + 1;
+			Assert::IsFalse(cooked.initialize(otherVersion.data(), otherVersion.size(), 42), L"Data of another version should be rejected");
+
+			std::vector<uint8> badOffset = data;
+			CookedMeshSection* section = reinterpret_cast<CookedMeshSection*>(badOffset.data() + sizeof(CookedMeshHeader) + sizeof(CookedMeshShape));
+			section->indexOffset = badOffset.size() - 2;
+			Assert::IsFalse(cooked.initialize(badOffset.data(), badOffset.size(), 42), L"Out of range streams should be rejected");
+
+			std::vector<uint8> badIndex = data;
+			section = reinterpret_cast<CookedMeshSection*>(badIndex.data() + sizeof(CookedMeshHeader) + sizeof(CookedMeshShape));
+			reinterpret_cast<uint16*>(badIndex.data() + section->indexOffset)[section->numIndices - 1] = (uint16)section->numVertices;
+			Assert::IsFalse(cooked.initialize(badIndex.data(), badIndex.size(), 42), L"Out of range indices should be rejected");
+		}
+
+		TEST_METHOD(TestLoadCooksAndReloads) {
+			TempOBJDirectory tempDir;
+			const std::string objText = makeGridOBJ(8);
+			const std::string cacheFilepath = tempDir.writeOBJ("grid.obj", objText);
+			const std::string objFilepath = tempDir.getFilepath("grid.obj");
+
+			{
+				OBJLoader loader;
+				Assert::IsTrue(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Cold load should succeed");
+				Assert::AreEqual(1u, loader.numShapes(), L"Wrong number of shapes");
+				Assert::AreEqual(std::string("grid"), loader.getShapeName(0), L"Wrong shape name");
+			}
+			Assert::IsTrue(isValidCacheEntry(cacheFilepath, objText), L"Cold load should store a valid cache entry");
+
+			{
+				OBJLoader loader;
+				Assert::IsTrue(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Warm load should succeed");
+				Assert::AreEqual(std::string("grid"), loader.getShapeName(0), L"Warm load should read the shape name from the cache entry");
+			}
+
+			// Corrupt an index of the cache entry. It should be recooked, not uploaded.
+			std::vector<uint8> bytes;
+			Assert::IsTrue(readFileBytes(cacheFilepath.c_str(), bytes), L"Can't read the cache entry");
+			const CookedMeshSection* section = reinterpret_cast<const CookedMeshSection*>(bytes.data() + sizeof(CookedMeshHeader) + sizeof(CookedMeshShape));
+			reinterpret_cast<uint16*>(bytes.data() + section->indexOffset)[0] = 0xffff;
+			{
+				std::ofstream fs(cacheFilepath, std::ios::binary | std::ios::trunc);
+				fs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			}
+			Assert::IsFalse(isValidCacheEntry(cacheFilepath, objText), L"Corrupted cache entry should be invalid");
+			{
+				OBJLoader loader;
+				Assert::IsTrue(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Load should recook a corrupted cache entry");
+			}
+			Assert::IsTrue(isValidCacheEntry(cacheFilepath, objText), L"Recooked cache entry should be valid");
+		}
+
+		TEST_METHOD(TestLoadRejectsOutOfRangeIndices) {
+			TempOBJDirectory tempDir;
+			const std::string objTexts[] = {
+				"o bad\nv 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 4\n",                // Position
+				"o bad\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nf 1/1 2/1 3/2\n", // Texcoord
+				"o bad\nv 0 0 0\nv 1 0 0\nv 0 1 0\nvn 0 0 1\nf 1//1 2//1 3//5\n", // Normal
+			};
+			for (const std::string& objText : objTexts) {
+				const std::string cacheFilepath = tempDir.writeOBJ("bad.obj", objText);
+				const std::string objFilepath = tempDir.getFilepath("bad.obj");
+
+				OBJLoader loader;
+				Assert::IsFalse(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Out of range face indices should be rejected");
+				Assert::IsFalse(loader.isValid(), L"Loader should be invalid");
+				Assert::IsFalse(std::filesystem::exists(cacheFilepath), L"Nothing should be cooked");
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkColdParseVsWarmLoad)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkColdParseVsWarmLoad) {
+			TempOBJDirectory tempDir;
+			const std::string objText = makeGridOBJ(400);
+			const std::string cacheFilepath = tempDir.writeOBJ("grid.obj", objText);
+			const std::string objFilepath = tempDir.getFilepath("grid.obj");
+
+			Stopwatch coldWatch;
+			{
+				OBJLoader loader;
+				Assert::IsTrue(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Failed to load the test OBJ");
+			}
+			const float coldMs = coldWatch.stop();
+			Assert::IsTrue(isValidCacheEntry(cacheFilepath, objText), L"Cache entry should be valid");
+
+			constexpr uint32 numWarmLoads = 10;
+			Stopwatch warmWatch;
+			for (uint32 i = 0; i < numWarmLoads; ++i) {
+				OBJLoader loader;
+				Assert::IsTrue(loader.load(objFilepath.c_str(), tempDir.getDirectory().c_str()), L"Failed to load the test OBJ");
+			}
+			const float warmMs = warmWatch.stop() / numWarmLoads;
+
+			std::vector<uint8> cookedData;
+			Assert::IsTrue(readFileBytes(cacheFilepath.c_str(), cookedData), L"Can't read the cache entry");
+			const uint32 numVertices = reinterpret_cast<const CookedMeshSection*>(cookedData.data() + sizeof(CookedMeshHeader) + sizeof(CookedMeshShape))->numVertices;
+			Assert::AreEqual(401u * 401u, numVertices, L"Vertices should be deduplicated");
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"Grid OBJ (%u vertices, %llu bytes): OBJLoader::load() cold (parse + cook) %.3f ms, warm (mmap) %.3f ms\n",
+				numVertices, (unsigned long long)objText.size(), coldMs, warmMs);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
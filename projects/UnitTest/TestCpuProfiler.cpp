@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/util/cpu_profiler.h"
+#include "badger/system/stopwatch.h"
+#include "badger/system/cpu.h"
+
+#include <vector>
+#include <thread>
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Run in a new thread so that it gets a new profile.
+	template<typename Fn>
+	void runInNewThread(Fn fn) {
+		std::thread thread(fn);
+		thread.join();
+	}
+
+	// Scoped counters per thread, returns ns per counter.
+	float measureCounters(uint32 numCounters) {
+		Stopwatch stopwatch;
+		for (uint32 i = 0; i < numCounters; ++i) {
+			SCOPED_CPU_COUNTER(BenchmarkCounter);
+		}
+		return 1000000.0f * stopwatch.stop() / numCounters;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestCpuProfiler) {
+	public:
+		TEST_METHOD(TestLastFrameSnapshot) {
+			bool bValidSnapshot = false;
+			runInNewThread([&bValidSnapshot]() {
+				for (uint32 frame = 0; frame < 4; ++frame) {
+					SCOPED_CPU_COUNTER(Frame);
+					{
+						SCOPED_CPU_COUNTER(Outer);
+						char counterName[64];
+						sprintf_s(counterName, "Inner (frame=%u)", frame);
+						SCOPED_CPU_COUNTER_STRING(counterName);
+						std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					}
+					// Overwrite every ring buffer in a frame that is not the last one.
+					if (frame == 1) {
+						for (uint32 i = 0; i < 2 * ProfilePerThread::EVENT_CAPACITY; ++i) {
+							char counterName[64];
+							sprintf_s(counterName, "Filler %u", i);
+							SCOPED_CPU_COUNTER_STRING(counterName);
+						}
+					}
+				}
+
+				// The latest frame might not be finished, so the snapshot is the frame before it.
+				std::vector<ProfileItem> snapshot;
+				CpuProfiler::getInstance().getLastFrameSnapshot(CPU::getCurrentThreadId(), snapshot);
+				bValidSnapshot = snapshot.size() == 3
+					&& snapshot[0].name == "Frame" && snapshot[0].tab == 0
+					&& snapshot[1].name == "Outer" && snapshot[1].tab == 1
+					&& snapshot[2].name == "Inner (frame=2)" && snapshot[2].tab == 2
+					&& snapshot[0].elapsedMS >= snapshot[1].elapsedMS
+					&& snapshot[1].elapsedMS >= snapshot[2].elapsedMS
+					&& snapshot[2].elapsedMS >= 1.0f;
+			});
+			Assert::IsTrue(bValidSnapshot, L"Snapshot should have the counters of the last finished frame");
+		}
+
+		TEST_METHOD(TestLongNameIsTruncated) {
+			bool bTruncated = false;
+			runInNewThread([&bTruncated]() {
+				const std::string longName(200, 'x');
+				for (uint32 frame = 0; frame < 3; ++frame) {
+					SCOPED_CPU_COUNTER_STRING(longName.c_str());
+				}
+				std::vector<ProfileItem> snapshot;
+				CpuProfiler::getInstance().getLastFrameSnapshot(CPU::getCurrentThreadId(), snapshot);
+				bTruncated = snapshot.size() == 1 && snapshot[0].name == longName.substr(0, ProfilePerThread::NAME_LENGTH - 1);
+			});
+			Assert::IsTrue(bTruncated, L"Copied counter name should be truncated");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkCpuCounter)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Cost of a scoped counter, alone and with every thread recording.
+		TEST_METHOD(BenchmarkCpuCounter) {
+			constexpr uint32 NUM_COUNTERS = 1000000;
+			constexpr uint32 NUM_THREADS = 16;
+			wchar_t msg[256];
+
+			float singleThread = 0.0f;
+			runInNewThread([&singleThread]() {
+				measureCounters(NUM_COUNTERS / 10); // Warm up
+				singleThread = measureCounters(NUM_COUNTERS);
+			});
+
+			std::vector<float> perThread(NUM_THREADS, 0.0f);
+			std::vector<std::thread> threads;
+			for (uint32 i = 0; i < NUM_THREADS; ++i) {
+				threads.emplace_back([&perThread, i]() {
+					perThread[i] = measureCounters(NUM_COUNTERS);
+				});
+			}
+			float contendedAvg = 0.0f, contendedMax = 0.0f;
+			for (uint32 i = 0; i < NUM_THREADS; ++i) {
+				threads[i].join();
+				contendedAvg += perThread[i] / NUM_THREADS;
+				contendedMax = std::max(contendedMax, perThread[i]);
+			}
+
+			// Lower bound: two clock reads.
+			Stopwatch stopwatch;
+			volatile int64 ticks = 0;
+			for (uint32 i = 0; i < NUM_COUNTERS; ++i) {
+				ticks = CpuProfiler::readClock() - CpuProfiler::readClock();
+			}
+			const float clockOnly = 1000000.0f * stopwatch.stop() / NUM_COUNTERS;
+
+			swprintf_s(msg, L"scoped counter: single thread=%.1f ns, %u threads=%.1f ns (avg) %.1f ns (max), two clock reads=%.1f ns\n",
+				singleThread, NUM_THREADS, contendedAvg, contendedMax, clockOnly);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
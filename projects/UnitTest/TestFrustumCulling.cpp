@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/scene/camera.h"
+
+#include "badger/math/hit_test.h"
+#include "badger/math/frustum_culling.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	std::vector<AABB> makeRandomBoxes(uint32 count, float range, uint32 seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> location(-range, range);
+		std::uniform_real_distribution<float> extent(0.1f, 4.0f);
+		std::vector<AABB> boxes(count);
+		for (uint32 i = 0; i < count; ++i) {
+			vector3 center(location(rng), location(rng), location(rng));
+			vector3 halfSize(extent(rng), extent(rng), extent(rng));
+			boxes[i] = AABB::fromCenterAndHalfSize(center, halfSize);
+		}
+		return boxes;
+	}
+
+	void makeFrustum(const vector3& origin, const vector3& target, Frustum3D& outFrustum) {
+		PerspectiveLens lens(60.0f, 16.0f / 9.0f, 0.1f, 300.0f);
+		Camera camera(lens);
+		camera.lookAt(origin, target, vector3(0.0f, 1.0f, 0.0f));
+		camera.getFrustumPlanes(outFrustum);
+	}
+
+	bool scalarTest(const AABB& box, const Frustum3D& frustum, uint32 numPlanes) {
+		return numPlanes == 6 ? badger::hitTest::AABB_frustum(box, frustum) : badger::hitTest::AABB_frustum_noFarPlane(box, frustum);
+	}
+
+	// Old implementation of badger::calculateWorldBounds()
+	AABB calculateWorldBoundsFromCorners(const AABB& localBounds, const matrix4& localToWorld) {
+		AABB worldBounds = AABB::fromMinMax(vector3(std::numeric_limits<float>::max()), vector3(std::numeric_limits<float>::lowest()));
+		for (uint32 i = 0; i < 8; ++i) {
+			vector3 corner;
+			corner.x = (i & 1) ? localBounds.minBounds.x : localBounds.maxBounds.x;
+			corner.y = ((i >> 1) & 1) ? localBounds.minBounds.y : localBounds.maxBounds.y;
+			corner.z = ((i >> 2) & 1) ? localBounds.minBounds.z : localBounds.maxBounds.z;
+			worldBounds.expand(vector3(localToWorld * vector4(corner, 1.0f)));
+		}
+		return worldBounds;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestFrustumCulling) {
+	public:
+		TEST_METHOD(TestWorldBounds) {
+			const AABB localBounds = AABB::fromMinMax(vector3(-1.0f, -2.0f, 0.0f), vector3(3.0f, 2.0f, 5.0f));
+			matrix4 M = glm::translate(matrix4(1.0f), vector3(10.0f, -4.0f, 2.0f));
+			M = glm::rotate(M, 0.7f, glm::normalize(vector3(1.0f, 2.0f, 3.0f)));
+			M = glm::scale(M, vector3(2.0f, 0.5f, 1.5f));
+
+			AABB expected = calculateWorldBoundsFromCorners(localBounds, M);
+			AABB actual = badger::calculateWorldBounds(localBounds, M);
+			float error = glm::length(expected.minBounds - actual.minBounds) + glm::length(expected.maxBounds - actual.maxBounds);
+			Assert::IsTrue(error < 1e-4f, L"World bounds should match the 8-corner transform");
+		}
+
+		TEST_METHOD(TestAABBStreamMatchesScalar) {
+			constexpr uint32 NUM_BOXES = 1003; // Not a multiple of SIMD width
+			std::vector<AABB> boxes = makeRandomBoxes(NUM_BOXES, 100.0f, 1);
+			badger::AABBStream stream;
+			stream.resize(NUM_BOXES);
+			for (uint32 i = 0; i < NUM_BOXES; ++i) {
+				stream.set(i, boxes[i]);
+			}
+
+			Frustum3D frustum;
+			makeFrustum(vector3(0.0f, 10.0f, 0.0f), vector3(30.0f, 0.0f, 50.0f), frustum);
+
+			for (uint32 numPlanes : { 5u, 6u }) {
+				const uint32 first = 7;
+				const uint32 count = NUM_BOXES - first;
+				std::vector<uint8> visibility(count);
+				uint32 numVisible = badger::hitTest::AABBStream_frustum(stream.getView(), first, count, frustum, numPlanes, visibility.data());
+
+				uint32 numExpected = 0;
+				bool bMatch = true;
+				for (uint32 i = 0; i < count; ++i) {
+					bool bExpected = scalarTest(boxes[first + i], frustum, numPlanes);
+					bMatch = bMatch && (bExpected == (visibility[i] != 0));
+					numExpected += bExpected ? 1 : 0;
+				}
+				Assert::IsTrue(bMatch, L"SIMD test should match hitTest::AABB_frustum");
+				Assert::AreEqual(numExpected, numVisible, L"Number of visible boxes is wrong");
+				Assert::IsTrue(0 < numVisible && numVisible < count, L"Test frustum should cull some boxes, not all");
+			}
+		}
+
+		TEST_METHOD(TestBVHMatchesBruteForce) {
+			constexpr uint32 NUM_BOXES = 5000;
+			std::vector<AABB> boxes = makeRandomBoxes(NUM_BOXES, 200.0f, 2);
+
+			badger::BoundingVolumeHierarchy bvh;
+			std::vector<uint32> order;
+			bvh.build(boxes, 8, order);
+			badger::AABBStream stream;
+			stream.resize(NUM_BOXES);
+			for (uint32 i = 0; i < NUM_BOXES; ++i) {
+				stream.set(i, boxes[order[i]]);
+			}
+
+			Frustum3D frustum;
+			makeFrustum(vector3(-20.0f, 5.0f, -20.0f), vector3(50.0f, 0.0f, 80.0f), frustum);
+
+			auto checkAgainstBruteForce = [&](const wchar_t* message) {
+				std::vector<uint8> visibility(NUM_BOXES);
+				uint32 numVisible = badger::hitTest::BVH_frustum(
+					bvh.getNodes().data(), bvh.getNumNodes(), stream.getView(),
+					frustum, 6, visibility.data());
+
+				uint32 numExpected = 0;
+				bool bMatch = true;
+				for (uint32 i = 0; i < NUM_BOXES; ++i) {
+					bool bExpected = scalarTest(boxes[order[i]], frustum, 6);
+					bMatch = bMatch && (bExpected == (visibility[i] != 0));
+					numExpected += bExpected ? 1 : 0;
+				}
+				Assert::IsTrue(bMatch, message);
+				Assert::AreEqual(numExpected, numVisible, message);
+			};
+			checkAgainstBruteForce(L"BVH culling should match brute force");
+
+			// Move some boxes far away and some into the frustum, then refit.
+			for (uint32 i = 0; i < NUM_BOXES; i += 7) {
+				const vector3 offset = (i % 2 == 0) ? vector3(0.0f, 500.0f, 0.0f) : vector3(40.0f, 0.0f, 60.0f) - boxes[order[i]].getCenter();
+				boxes[order[i]] = AABB::fromMinMax(boxes[order[i]].minBounds + offset, boxes[order[i]].maxBounds + offset);
+				stream.set(i, boxes[order[i]]);
+				bvh.markBoxMoved(i);
+			}
+			bvh.refit(stream);
+			checkAgainstBruteForce(L"BVH culling after refit should match brute force");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkFrustumCulling)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Per-proxy scalar test vs SoA + SIMD vs BVH + SIMD.
+		// Boxes are scattered in a big world and the camera sees a part of it.
+		TEST_METHOD(BenchmarkFrustumCulling) {
+			constexpr int32 NUM_ITERATIONS = 20;
+			const uint32 boxCounts[] = { 1000, 10000, 100000 };
+			wchar_t msg[256];
+
+			Frustum3D frustum;
+			makeFrustum(vector3(0.0f, 20.0f, 0.0f), vector3(100.0f, 0.0f, 100.0f), frustum);
+
+			for (uint32 numBoxes : boxCounts) {
+				std::vector<AABB> boxes = makeRandomBoxes(numBoxes, 1000.0f, 3);
+
+				// Proxies are separate allocations in the scene proxy, so chase a pointer per box.
+				struct FakeProxy { AABB worldBounds; bool bInFrustum; uint8 padding[192]; };
+				std::vector<FakeProxy> proxyStorage(numBoxes);
+				std::vector<FakeProxy*> proxies(numBoxes);
+				for (uint32 i = 0; i < numBoxes; ++i) {
+					proxyStorage[i].worldBounds = boxes[i];
+					proxies[i] = &proxyStorage[i];
+				}
+				std::shuffle(proxies.begin(), proxies.end(), std::mt19937(4));
+
+				badger::BoundingVolumeHierarchy bvh;
+				std::vector<uint32> order;
+				bvh.build(boxes, 8, order);
+				badger::AABBStream bvhStream, flatStream;
+				bvhStream.resize(numBoxes);
+				flatStream.resize(numBoxes);
+				for (uint32 i = 0; i < numBoxes; ++i) {
+					bvhStream.set(i, boxes[order[i]]);
+					flatStream.set(i, boxes[i]);
+				}
+				std::vector<uint8> visibility(numBoxes);
+
+				uint32 numScalar = 0, numSIMD = 0, numBVH = 0;
+				float elapsedScalar = 0.0f, elapsedSIMD = 0.0f, elapsedBVH = 0.0f;
+				for (int32 iter = 0; iter < NUM_ITERATIONS; ++iter) {
+					Stopwatch stopwatch;
+					numScalar = 0;
+					for (FakeProxy* proxy : proxies) {
+						proxy->bInFrustum = badger::hitTest::AABB_frustum(proxy->worldBounds, frustum);
+						numScalar += proxy->bInFrustum ? 1 : 0;
+					}
+					elapsedScalar += stopwatch.stop();
+
+					stopwatch.start();
+					numSIMD = badger::hitTest::AABBStream_frustum(flatStream.getView(), 0, numBoxes, frustum, 6, visibility.data());
+					elapsedSIMD += stopwatch.stop();
+
+					stopwatch.start();
+					numBVH = badger::hitTest::BVH_frustum(bvh.getNodes().data(), bvh.getNumNodes(), bvhStream.getView(), frustum, 6, visibility.data());
+					elapsedBVH += stopwatch.stop();
+				}
+				Assert::IsTrue(numScalar == numSIMD && numScalar == numBVH, L"All methods should cull the same boxes");
+
+				swprintf_s(msg, L"boxes=%6u visible=%6u scalar=%7.3f ms SoA+SIMD=%7.3f ms BVH+SIMD=%7.3f ms\n",
+					numBoxes, numScalar,
+					elapsedScalar / NUM_ITERATIONS, elapsedSIMD / NUM_ITERATIONS, elapsedBVH / NUM_ITERATIONS);
+				Logger::WriteMessage(msg);
+			}
+		}
+	};
+}
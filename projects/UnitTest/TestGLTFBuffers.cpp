@@ -0,0 +1,319 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/loader/gltf_buffers.h"
+#include "pathos/util/image_data.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <tiny_gltf.h>
+#include "stb_image_write.h"
+#include <Windows.h>
+#include <Psapi.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <cstring>
+
+#pragma comment(lib, "psapi.lib")
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Grid meshes with tightly packed positions, normals, texcoords, and 32-bit indices, plus PNG images.
+	// The binary payload is streamed to a .bin file so that generating it doesn't raise the peak memory of the process.
+	struct SyntheticGLTF {
+		std::string json;
+		uint64 binBytes = 0;
+		std::vector<float> firstPositions;
+	};
+
+	SyntheticGLTF makeSyntheticGLTF(uint32 numMeshes, uint32 gridSize, uint32 numImages, uint32 imageSize, const std::string& binFilepath) {
+		SyntheticGLTF result;
+		std::ofstream bin(binFilepath, std::ios::binary | std::ios::trunc);
+		std::ostringstream views, accessors, meshes, nodes, images, textures;
+		uint32 numViews = 0;
+		auto addView = [&](const void* data, size_t bytes) {
+			views << (numViews > 0 ? "," : "") << "{\"buffer\":0,\"byteOffset\":" << result.binBytes << ",\"byteLength\":" << bytes << "}";
+			const uint32 padding = 0;
+			bin.write((const char*)data, bytes);
+			bin.write((const char*)&padding, ((bytes + 3) & ~(size_t)3) - bytes);
+			result.binBytes += (bytes + 3) & ~(size_t)3;
+			return numViews++;
+		};
+
+		const uint32 numVertices = gridSize * gridSize;
+		for (uint32 meshIx = 0; meshIx < numMeshes; ++meshIx) {
+			std::vector<float> positions, normals, texcoords;
+			std::vector<uint32> indices;
+			for (uint32 y = 0; y < gridSize; ++y) {
+				for (uint32 x = 0; x < gridSize; ++x) {
+					positions.insert(positions.end(), { (float)x, (float)y, (float)meshIx });
+					normals.insert(normals.end(), { 0.0f, 0.0f, 1.0f });
+					texcoords.insert(texcoords.end(), { (float)x / gridSize, (float)y / gridSize });
+				}
+			}
+			for (uint32 y = 0; y + 1 < gridSize; ++y) {
+				for (uint32 x = 0; x + 1 < gridSize; ++x) {
+					uint32 i0 = y * gridSize + x;
+					indices.insert(indices.end(), { i0, i0 + 1, i0 + gridSize + 1, i0, i0 + gridSize + 1, i0 + gridSize });
+				}
+			}
+			if (meshIx == 0) {
+				result.firstPositions = positions;
+			}
+			const uint32 posView = addView(positions.data(), positions.size() * sizeof(float));
+			const uint32 normView = addView(normals.data(), normals.size() * sizeof(float));
+			const uint32 uvView = addView(texcoords.data(), texcoords.size() * sizeof(float));
+			const uint32 indexView = addView(indices.data(), indices.size() * sizeof(uint32));
+			const uint32 firstAccessor = meshIx * 4;
+			accessors << (meshIx > 0 ? "," : "")
+				<< "{\"bufferView\":" << posView << ",\"componentType\":5126,\"count\":" << numVertices << ",\"type\":\"VEC3\"},"
+				<< "{\"bufferView\":" << normView << ",\"componentType\":5126,\"count\":" << numVertices << ",\"type\":\"VEC3\"},"
+				<< "{\"bufferView\":" << uvView << ",\"componentType\":5126,\"count\":" << numVertices << ",\"type\":\"VEC2\"},"
+				<< "{\"bufferView\":" << indexView << ",\"componentType\":5125,\"count\":" << indices.size() << ",\"type\":\"SCALAR\"}";
+			meshes << (meshIx > 0 ? "," : "") << "{\"primitives\":[{\"attributes\":{\"POSITION\":" << firstAccessor
+				<< ",\"NORMAL\":" << (firstAccessor + 1) << ",\"TEXCOORD_0\":" << (firstAccessor + 2)
+				<< "},\"indices\":" << (firstAccessor + 3) << ",\"material\":0}]}";
+			nodes << (meshIx > 0 ? "," : "") << "{\"mesh\":" << meshIx << "}";
+		}
+
+		// Smooth gradients compress like real albedo maps rather than like noise.
+		std::vector<uint8> pixels(imageSize * imageSize * 4);
+		for (uint32 imageIx = 0; imageIx < numImages; ++imageIx) {
+			for (uint32 i = 0; i < imageSize * imageSize; ++i) {
+				const uint32 x = i % imageSize, y = i / imageSize;
+				pixels[i * 4 + 0] = (uint8)(x * 255 / imageSize);
+				pixels[i * 4 + 1] = (uint8)(y * 255 / imageSize);
+				pixels[i * 4 + 2] = (uint8)(imageIx * 37);
+				pixels[i * 4 + 3] = 255;
+			}
+			std::vector<uint8> png;
+			stbi_write_png_to_func([](void* context, void* data, int size) {
+				std::vector<uint8>* out = reinterpret_cast<std::vector<uint8>*>(context);
+				out->insert(out->end(), (uint8*)data, (uint8*)data + size);
+			}, &png, imageSize, imageSize, 4, pixels.data(), imageSize * 4);
+			const uint32 imageView = addView(png.data(), png.size());
+			images << (imageIx > 0 ? "," : "") << "{\"bufferView\":" << imageView << ",\"mimeType\":\"image/png\"}";
+			textures << (imageIx > 0 ? "," : "") << "{\"source\":" << imageIx << "}";
+		}
+
+		std::ostringstream json;
+		json << "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[";
+		for (uint32 i = 0; i < numMeshes; ++i) json << (i > 0 ? "," : "") << i;
+		json << "]}],\"nodes\":[" << nodes.str() << "],\"meshes\":[" << meshes.str() << "]"
+			<< ",\"materials\":[{\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":0}}}]"
+			<< ",\"textures\":[" << textures.str() << "],\"images\":[" << images.str() << "]"
+			<< ",\"accessors\":[" << accessors.str() << "],\"bufferViews\":[" << views.str() << "]"
+			<< ",\"buffers\":[{\"byteLength\":" << result.binBytes;
+		json << "}]}";
+		result.json = json.str();
+		return result;
+	}
+
+	// The generated buffer has no uri, which is only valid in a .glb.
+	void writeGLTF(const std::string& filepath, const SyntheticGLTF& gltf, const char* bufferURI) {
+		std::string json = gltf.json;
+		json.insert(json.size() - 3, std::string(",\"uri\":\"") + bufferURI + "\""); // Before the closing "}]}"
+		std::ofstream(filepath, std::ios::binary | std::ios::trunc) << json;
+	}
+
+	// Same payload as a single .glb file.
+	void writeGLB(const std::string& filepath, const std::string& binFilepath, const SyntheticGLTF& gltf) {
+		std::string json = gltf.json;
+		json.resize((json.size() + 3) & ~(size_t)3, ' ');
+		const uint32 totalBytes = (uint32)(12 + 8 + json.size() + 8 + gltf.binBytes);
+		const uint32 header[5] = { GLB_MAGIC, 2, totalBytes, (uint32)json.size(), GLB_CHUNK_JSON };
+		const uint32 binHeader[2] = { (uint32)gltf.binBytes, GLB_CHUNK_BIN };
+		std::ofstream fs(filepath, std::ios::binary | std::ios::trunc);
+		fs.write((const char*)header, sizeof(header));
+		fs.write(json.data(), json.size());
+		fs.write((const char*)binHeader, sizeof(binHeader));
+		std::ifstream bin(binFilepath, std::ios::binary);
+		fs << bin.rdbuf();
+	}
+
+	// Private bytes are what copies cost; mapped file pages are shared and can be dropped by the OS.
+	struct MemoryCounters {
+		uint64 peakWorkingSet = 0;
+		uint64 peakPrivateBytes = 0;
+	};
+	MemoryCounters getMemoryCounters() {
+		PROCESS_MEMORY_COUNTERS counters{};
+		::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters));
+		return MemoryCounters{ (uint64)counters.PeakWorkingSetSize, (uint64)counters.PeakPagefileUsage };
+	}
+
+	// Read vertex data like an upload would, so lazily mapped pages are paid for too.
+	double touchPositions(const float* positions, uint32 count) {
+		double sum = 0.0;
+		for (uint32 i = 0; i < count; i += 97) sum += positions[i];
+		return sum;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestGLTFBuffers) {
+	public:
+		TEST_METHOD(TestBinaryAndExternalBuffers) {
+			const std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "pathos_test_gltf";
+			std::filesystem::create_directories(tempDir);
+			const std::string glbPath = (tempDir / "grid.glb").string();
+			const std::string gltfPath = (tempDir / "grid.gltf").string();
+			const std::string binPath = (tempDir / "grid data.bin").string();
+			const SyntheticGLTF gltf = makeSyntheticGLTF(2, 8, 1, 16, binPath);
+			writeGLB(glbPath, binPath, gltf);
+			writeGLTF(gltfPath, gltf, "grid%20data.bin");
+
+			for (const std::string& path : { glbPath, gltfPath }) {
+				GLTFBuffers buffers;
+				Assert::IsTrue(buffers.open(path.c_str()), L"Failed to open the test glTF");
+				Assert::AreEqual((size_t)1, buffers.numBuffers(), L"Wrong number of buffers");
+				Assert::AreEqual((size_t)1, buffers.numImages(), L"Wrong number of images");
+				Assert::AreEqual(path == glbPath, buffers.isBinary(), L"Container type is wrong");
+
+				uint64 byteLength = 0;
+				uint32 byteStride = 0;
+				const uint8* positions = buffers.getBufferViewData(0, byteLength, byteStride);
+				Assert::IsTrue(positions != nullptr, L"Buffer view should be resolved");
+				Assert::AreEqual((uint64)(gltf.firstPositions.size() * sizeof(float)), byteLength, L"Wrong buffer view length");
+				Assert::IsTrue(0 == ::memcmp(positions, gltf.firstPositions.data(), (size_t)byteLength), L"Position mismatch");
+				Assert::IsTrue(buffers.getBufferRange(0, 0, gltf.binBytes + 1) == nullptr, L"Out of range access should fail");
+
+				// tinygltf parses the structure without touching any payload.
+				const std::string& json = buffers.getStrippedJSON();
+				Assert::IsTrue(json.find("\"images\"") == std::string::npos, L"Images should be stripped");
+				tinygltf::TinyGLTF tinyLoader;
+				tinygltf::Model tinyModel;
+				std::string err, warn;
+				Assert::IsTrue(tinyLoader.LoadASCIIFromString(&tinyModel, &err, &warn, json.c_str(), (uint32)json.size(), buffers.getBaseDirectory()),
+					L"tinygltf should accept the stripped document");
+				Assert::AreEqual((size_t)8, tinyModel.accessors.size(), L"Wrong number of accessors");
+				Assert::AreEqual((size_t)1, tinyModel.buffers[0].data.size(), L"tinygltf should only see the placeholder buffer");
+
+				ImageBlob* blob = buffers.decodeImage(0);
+				Assert::IsTrue(blob != nullptr, L"Failed to decode the embedded image");
+				Assert::AreEqual(16u, blob->width, L"Wrong image width");
+				Assert::AreEqual(32u, blob->bpp, L"Images should be decoded as RGBA8");
+				delete blob;
+			}
+
+			// Broken containers
+			{
+				std::vector<uint8> glbBytes;
+				{
+					std::ifstream fs(glbPath, std::ios::binary);
+					glbBytes.assign(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+				}
+				const std::string truncatedPath = (tempDir / "truncated.glb").string();
+				std::ofstream(truncatedPath, std::ios::binary | std::ios::trunc).write((const char*)glbBytes.data(), glbBytes.size() / 2);
+				GLTFBuffers buffers;
+				Assert::IsFalse(buffers.open(truncatedPath.c_str()), L"Truncated GLB should be rejected");
+
+				SyntheticGLTF badView = gltf;
+				badView.json.replace(badView.json.find("\"byteOffset\":0,"), 15, "\"byteOffset\":999999999,");
+				const std::string badViewPath = (tempDir / "bad_view.gltf").string();
+				writeGLTF(badViewPath, badView, "grid%20data.bin");
+				Assert::IsFalse(buffers.open(badViewPath.c_str()), L"Out of range buffer views should be rejected");
+			}
+
+			std::error_code err;
+			std::filesystem::remove_all(tempDir, err);
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkMappedVsTinyGLTF)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkMappedVsTinyGLTF) {
+			// Sponza-class: ~2M vertices, ~100 MB of geometry, and 16 1K textures.
+			const std::filesystem::path tempDir = std::filesystem::temp_directory_path() / "pathos_bench_gltf";
+			std::filesystem::create_directories(tempDir);
+			const std::string glbPath = (tempDir / "scene.glb").string();
+			const std::string gltfPath = (tempDir / "scene.gltf").string();
+			uint64 fileBytes = 0;
+			{
+				const std::string binPath = (tempDir / "scene.bin").string();
+				const SyntheticGLTF gltf = makeSyntheticGLTF(32, 256, 16, 1024, binPath);
+				writeGLB(glbPath, binPath, gltf);
+				writeGLTF(gltfPath, gltf, "scene.bin");
+				fileBytes = gltf.binBytes;
+			}
+			const uint32 numPositions = 256 * 256 * 3;
+
+			const uint32 numThreads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			JobSystem jobSystem;
+			jobSystem.start(numThreads);
+
+			// Peak counters never go down, so the path with the lower peak runs first.
+			const MemoryCounters before = getMemoryCounters();
+			Stopwatch stopwatch;
+			double mappedSum = 0.0;
+			{
+				GLTFBuffers buffers;
+				Assert::IsTrue(buffers.open(glbPath.c_str()), L"Failed to map the GLB");
+				tinygltf::TinyGLTF tinyLoader;
+				tinygltf::Model tinyModel;
+				std::string err, warn;
+				const std::string& json = buffers.getStrippedJSON();
+				Assert::IsTrue(tinyLoader.LoadASCIIFromString(&tinyModel, &err, &warn, json.c_str(), (uint32)json.size(), buffers.getBaseDirectory()), L"Failed to parse");
+				for (const tinygltf::Mesh& mesh : tinyModel.meshes) {
+					uint64 byteLength;
+					uint32 byteStride;
+					const int32 view = tinyModel.accessors[mesh.primitives[0].attributes.at("POSITION")].bufferView;
+					mappedSum += touchPositions((const float*)buffers.getBufferViewData(view, byteLength, byteStride), numPositions);
+				}
+				std::vector<ImageBlob*> blobs(buffers.numImages(), nullptr);
+				parallelFor(&jobSystem, (uint32)blobs.size(), 1, [&](uint32 begin, uint32 end) {
+					for (uint32 i = begin; i < end; ++i) blobs[i] = buffers.decodeImage(i);
+				});
+				for (ImageBlob* blob : blobs) {
+					Assert::IsTrue(blob != nullptr, L"Failed to decode an image");
+					delete blob;
+				}
+			}
+			const float mappedMs = stopwatch.stop();
+			const MemoryCounters afterMapped = getMemoryCounters();
+			jobSystem.stop();
+
+			stopwatch.start();
+			double tinySum = 0.0;
+			{
+				tinygltf::TinyGLTF tinyLoader;
+				tinygltf::Model tinyModel;
+				std::string err, warn;
+				Assert::IsTrue(tinyLoader.LoadASCIIFromFile(&tinyModel, &err, &warn, gltfPath), L"tinygltf failed to load");
+				for (const tinygltf::Mesh& mesh : tinyModel.meshes) {
+					const tinygltf::Accessor& accessor = tinyModel.accessors[mesh.primitives[0].attributes.at("POSITION")];
+					const tinygltf::BufferView& view = tinyModel.bufferViews[accessor.bufferView];
+					tinySum += touchPositions((const float*)&tinyModel.buffers[view.buffer].data[view.byteOffset], numPositions);
+				}
+				// GLTFLoader used to copy every decoded image into an ImageBlob.
+				for (const tinygltf::Image& image : tinyModel.images) {
+					ImageBlob blob;
+					blob.copyRawBytes(image.image.data(), image.width, image.height, 32);
+				}
+			}
+			const float tinyMs = stopwatch.stop();
+			const MemoryCounters afterTiny = getMemoryCounters();
+
+			Assert::AreEqual(tinySum, mappedSum, L"Both paths should see the same vertex data");
+
+			const double MB = 1024.0 * 1024.0;
+			wchar_t msg[256];
+			swprintf_s(msg, L"%.1f MB of buffers: tinygltf .gltf+.bin %.2f ms, mapped .glb + %u workers %.2f ms\n",
+				fileBytes / MB, tinyMs, numThreads, mappedMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"Peak private bytes: +%.1f MB (mapped), +%.1f MB (tinygltf); peak working set: +%.1f MB, +%.1f MB\n",
+				(afterMapped.peakPrivateBytes - before.peakPrivateBytes) / MB, (afterTiny.peakPrivateBytes - before.peakPrivateBytes) / MB,
+				(afterMapped.peakWorkingSet - before.peakWorkingSet) / MB, (afterTiny.peakWorkingSet - before.peakWorkingSet) / MB);
+			Logger::WriteMessage(msg);
+
+			std::error_code err;
+			std::filesystem::remove_all(tempDir, err);
+		}
+	};
+}
@@ -0,0 +1,424 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/text/glyph_atlas.h"
+#include "pathos/text/text_layout_cache.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <list>
+#include <random>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	constexpr uint32 ATLAS_SIZE = 512;
+	constexpr uint32 CJK_FIRST = 0x4E00;
+
+	// Bitmap sizes of a 32px font. CJK glyphs fill the em box, Latin glyphs are narrow.
+	void getGlyphSize(uint32 ch, uint32& outWidth, uint32& outHeight) {
+		const uint32 h = (ch * 2654435761u) >> 16;
+		if (ch >= CJK_FIRST) {
+			outWidth = 27 + h % 5;
+			outHeight = 27 + (h >> 4) % 5;
+		} else if (ch == L' ') {
+			outWidth = outHeight = 0;
+		} else {
+			outWidth = 8 + h % 11;
+			outHeight = 12 + (h >> 4) % 13;
+		}
+	}
+
+	// Labels of CJK-heavy UI text. Characters follow a Zipf-like distribution over 3500 common characters.
+	std::vector<std::vector<uint32>> makeCJKTexts(uint32 numTexts, uint32 seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+		std::uniform_int_distribution<uint32> textLength(4, 24);
+		std::vector<std::vector<uint32>> texts(numTexts);
+		for (std::vector<uint32>& text : texts) {
+			const uint32 length = textLength(rng);
+			for (uint32 i = 0; i < length; ++i) {
+				const float r = uniform(rng);
+				if (r < 0.2f) {
+					text.push_back(L'0' + (rng() % 75)); // ASCII digits, letters and symbols
+				} else if (r < 0.25f) {
+					text.push_back(L' ');
+				} else {
+					const uint32 rank = (uint32)std::pow(3500.0f, uniform(rng));
+					text.push_back(CJK_FIRST + rank);
+				}
+			}
+		}
+		return texts;
+	}
+
+	// Model of the previous FontTextureCache strategy for comparison, not the engine code.
+	// Uniform cells of the max advance and line height, LRU order kept in std::list and glyphs found by linear search.
+	class UniformCellCache {
+	public:
+		UniformCellCache(uint32 cellWidth, uint32 cellHeight) {
+			const uint32 numCells = (ATLAS_SIZE / cellWidth) * (ATLAS_SIZE / cellHeight);
+			for (uint32 i = 0; i < numCells; ++i) {
+				unused.push_back(0);
+			}
+		}
+		// Returns true if cache hit.
+		bool getGlyph(uint32 ch) {
+			for (uint32 x : used) {
+				if (x == ch) {
+					return true;
+				}
+			}
+			if (unused.size() == 0) {
+				used.pop_front();
+			} else {
+				unused.pop_back();
+			}
+			used.push_back(ch);
+			return false;
+		}
+	private:
+		std::list<uint32> used;
+		std::list<uint32> unused;
+	};
+
+	// Returns true if cache hit.
+	bool getGlyph(GlyphAtlas& atlas, uint32 ch) {
+		if (atlas.find(ch) != GlyphAtlas::INVALID_SLOT) {
+			return true;
+		}
+		uint32 width, height;
+		getGlyphSize(ch, width, height);
+		atlas.insert(ch, width, height);
+		return false;
+	}
+
+	// Stands in for FontTextureCache: finds or inserts glyphs without rasterizing them.
+	// Glyphs are fixedSize x fixedSize if fixedSize is not zero.
+	GetGlyphFunc makeGetGlyph(GlyphAtlas& atlas, uint32& numCalls, uint32 fixedSize = 0) {
+		return [&atlas, &numCalls, fixedSize](wchar_t ch, GlyphInTexture& outGlyph) {
+			++numCalls;
+			int32 slot = atlas.find((uint32)ch);
+			if (slot == GlyphAtlas::INVALID_SLOT) {
+				uint32 width = fixedSize, height = fixedSize;
+				if (fixedSize == 0) {
+					getGlyphSize((uint32)ch, width, height);
+				}
+				slot = atlas.insert((uint32)ch, width, height);
+			}
+			if (slot != GlyphAtlas::INVALID_SLOT) {
+				const GlyphAtlas::Slot& rect = atlas.getSlot(slot);
+				const float tw = (float)atlas.getWidth(), th = (float)atlas.getHeight();
+				outGlyph = GlyphInTexture{};
+				outGlyph.ch = ch;
+				outGlyph.x = rect.x / tw;
+				outGlyph.y = rect.y / th;
+				outGlyph.glyphWidth = outGlyph.width = rect.width / tw;
+				outGlyph.glyphHeight = outGlyph.height = rect.height / th;
+				outGlyph.advanceX = (rect.width + 2) / tw;
+				outGlyph.offsetY = rect.height / th;
+			}
+			return slot;
+		};
+	}
+
+	bool rectsOverlap(const GlyphAtlas::Slot& a, const GlyphAtlas::Slot& b, uint32 padding) {
+		return a.x < b.x + b.width + padding && b.x < a.x + a.width + padding
+			&& a.y < b.y + b.height + padding && b.y < a.y + a.height + padding;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestGlyphAtlas)
+	{
+	public:
+		TEST_METHOD(TestPackingNoOverlap)
+		{
+			GlyphAtlas atlas;
+			atlas.initialize(ATLAS_SIZE, ATLAS_SIZE, 1);
+
+			// Fewer glyphs than the atlas can hold, so nothing is evicted. Latin keys repeat.
+			std::vector<uint32> keys;
+			for (uint32 i = 0; i < 150; ++i) {
+				keys.push_back(CJK_FIRST + i);
+				keys.push_back(L'!' + i % 90);
+			}
+			for (uint32 key : keys) {
+				atlas.beginUse();
+				if (!atlas.contains(key)) {
+					getGlyph(atlas, key);
+				}
+			}
+
+			GlyphAtlas::Stats stats = atlas.getStats();
+			Assert::AreEqual(0u, stats.numEvictedGlyphs, L"Atlas is not full");
+			Assert::AreEqual(240u, stats.numGlyphs, L"Unique keys");
+
+			std::vector<GlyphAtlas::Slot> rects;
+			for (uint32 key : keys) {
+				const int32 slot = atlas.find(key);
+				Assert::IsTrue(slot != GlyphAtlas::INVALID_SLOT, L"Glyph is found");
+				const GlyphAtlas::Slot& rect = atlas.getSlot(slot);
+				uint32 width, height;
+				getGlyphSize(key, width, height);
+				Assert::IsTrue(rect.key == key && rect.width == width && rect.height == height, L"Rect is sized to the glyph");
+				Assert::IsTrue(rect.x + rect.width <= ATLAS_SIZE && rect.y + rect.height <= ATLAS_SIZE, L"Rect is in the atlas");
+				rects.push_back(rect);
+			}
+			for (size_t i = 0; i < rects.size(); ++i) {
+				for (size_t j = i + 1; j < rects.size(); ++j) {
+					if (rects[i].key != rects[j].key) {
+						Assert::IsFalse(rectsOverlap(rects[i], rects[j], 1), L"Rects don't overlap including padding");
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestLRUEviction)
+		{
+			// 15x15 glyphs with 1 texel padding: 8 glyphs per shelf, 8 shelves.
+			GlyphAtlas atlas;
+			atlas.initialize(128, 128, 1);
+			std::vector<int32> slots;
+			for (uint32 key = 0; key < 64; ++key) {
+				atlas.beginUse();
+				slots.push_back(atlas.insert(key, 15, 15));
+			}
+			Assert::AreEqual(8u, atlas.getStats().numShelves, L"Shelves");
+			Assert::IsTrue(atlas.wouldEvict(15, 15), L"Atlas is full");
+
+			// Use the first shelf again. The second shelf is the least recently used now.
+			atlas.beginUse();
+			for (uint32 key = 0; key < 8; ++key) {
+				atlas.find(key);
+			}
+			const uint32 secondShelf = atlas.getSlot(slots[8]).shelf;
+			const uint32 generation = atlas.getShelfGeneration(secondShelf);
+
+			atlas.beginUse();
+			const int32 slot = atlas.insert(1000, 15, 15);
+			Assert::IsTrue(slot != GlyphAtlas::INVALID_SLOT, L"Inserted by eviction");
+			Assert::AreEqual(secondShelf, atlas.getSlot(slot).shelf, L"Least recently used shelf is reused");
+			Assert::IsFalse(atlas.isShelfValid(secondShelf, generation), L"Generation of the evicted shelf changed");
+			for (uint32 key = 0; key < 8; ++key) {
+				Assert::IsTrue(atlas.contains(key), L"Recently used glyphs are kept");
+			}
+			for (uint32 key = 9; key < 16; ++key) {
+				Assert::IsFalse(atlas.contains(key), L"Glyphs of the evicted shelf are removed");
+			}
+			Assert::AreEqual(1u, atlas.getStats().numEvictedShelves, L"One shelf evicted");
+			Assert::AreEqual(8u, atlas.getStats().numEvictedGlyphs, L"Glyphs of one shelf evicted");
+
+			// Shelves used in the current period are evicted last.
+			atlas.beginUse();
+			for (uint32 key = 16; key < 64; ++key) {
+				atlas.find(key);
+			}
+			for (uint32 key = 1001; key < 1008; ++key) {
+				atlas.insert(key, 15, 15); // Fill the second shelf
+			}
+			const int32 slot2 = atlas.insert(1008, 15, 15);
+			Assert::AreEqual(atlas.getSlot(atlas.find(0)).shelf, atlas.getSlot(slot2).shelf, L"Only the first shelf was not used in this period");
+
+			// Taller than every shelf: start over.
+			atlas.beginUse();
+			Assert::IsTrue(atlas.insert(2000, 40, 40) != GlyphAtlas::INVALID_SLOT, L"Tall glyph");
+			Assert::AreEqual(1u, atlas.getStats().numGlyphs, L"Every shelf was evicted");
+			Assert::IsTrue(atlas.insert(2001, 200, 10) == GlyphAtlas::INVALID_SLOT, L"Larger than the atlas");
+		}
+
+		TEST_METHOD(TestWouldEvictMatchesInsert)
+		{
+			// Mixed Latin and CJK heights, so glyphs don't fit every shelf with room.
+			GlyphAtlas atlas;
+			atlas.initialize(256, 256, 1);
+			const std::vector<std::vector<uint32>> texts = makeCJKTexts(200, 77);
+			uint32 numPredictedEvictions = 0;
+			for (const std::vector<uint32>& text : texts) {
+				atlas.beginUse();
+				for (uint32 ch : text) {
+					if (atlas.find(ch) != GlyphAtlas::INVALID_SLOT) {
+						continue;
+					}
+					uint32 width, height;
+					getGlyphSize(ch, width, height);
+					const bool bPredicted = atlas.wouldEvict(width, height);
+					const uint32 numEvictedBefore = atlas.getStats().numEvictedShelves;
+					atlas.insert(ch, width, height);
+					const bool bEvicted = atlas.getStats().numEvictedShelves != numEvictedBefore;
+					Assert::IsTrue(bEvicted == bPredicted, L"wouldEvict() predicts eviction by insert()");
+					numPredictedEvictions += bPredicted ? 1 : 0;
+				}
+			}
+			Assert::IsTrue(numPredictedEvictions > 0, L"Atlas was filled up");
+		}
+
+		TEST_METHOD(TestTextLayoutReuse)
+		{
+			GlyphAtlas atlas;
+			atlas.initialize(ATLAS_SIZE, ATLAS_SIZE, 1);
+			TextLayoutCache cache;
+			cache.initialize(&atlas, 32.0f / ATLAS_SIZE);
+			uint32 numCalls = 0;
+			const GetGlyphFunc getGlyph = makeGetGlyph(atlas, numCalls);
+
+			const std::wstring text = L"HP 100\n\u4E16\u754C";
+			Assert::IsTrue(cache.findValidLayout(text.c_str(), (uint32)text.size()) == nullptr, L"Not laid out yet");
+			const TextLayout& layout = cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			Assert::AreEqual(8u, numCalls, L"Every character except the line break is looked up");
+			Assert::AreEqual((size_t)7, layout.quads.size(), L"White space has no quad");
+			Assert::IsTrue(layout.quads[6].rect.y > layout.quads[0].rect.y, L"Line break moves the pen down");
+
+			const TextLayout* cached = cache.findValidLayout(text.c_str(), (uint32)text.size());
+			Assert::IsTrue(cached == &layout, L"Unchanged text reuses the layout");
+			Assert::AreEqual(8u, numCalls, L"Reused layout doesn't look up glyphs");
+
+			const std::wstring changed = L"HP 99\n\u4E16\u754C";
+			Assert::IsTrue(cache.findValidLayout(changed.c_str(), (uint32)changed.size()) == nullptr, L"Changed text is not cached");
+			cache.buildLayout(changed.c_str(), (uint32)changed.size(), getGlyph);
+			Assert::AreEqual(2u, cache.getNumLayouts(), L"Layouts of both texts are cached");
+		}
+
+		TEST_METHOD(TestTextLayoutInvalidation)
+		{
+			// 15x15 glyphs with 1 texel padding: 8 glyphs per shelf, 8 shelves.
+			GlyphAtlas atlas;
+			atlas.initialize(128, 128, 1);
+			TextLayoutCache cache;
+			cache.initialize(&atlas, 16.0f / 128);
+			uint32 numCalls = 0;
+			const GetGlyphFunc getGlyph = makeGetGlyph(atlas, numCalls, 15);
+
+			const std::wstring text = L"abcd";
+			const TextLayout& layout = cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			Assert::AreEqual((size_t)1, layout.shelves.size(), L"Glyphs are on one shelf");
+			const uint32 shelf = layout.shelves[0].first;
+			const uint32 generation = layout.shelves[0].second;
+
+			// Other glyphs fill the atlas until the shelf of the layout is evicted.
+			uint32 key = 1000;
+			while (atlas.isShelfValid(shelf, generation) && key < 2000) {
+				atlas.beginUse();
+				atlas.insert(key++, 15, 15);
+			}
+			Assert::IsFalse(atlas.isShelfValid(shelf, generation), L"Shelf of the layout was evicted");
+			Assert::IsTrue(cache.findValidLayout(text.c_str(), (uint32)text.size()) == nullptr, L"Layout is invalidated by the shelf generation");
+
+			numCalls = 0;
+			cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			Assert::AreEqual(4u, numCalls, L"Glyphs are looked up again");
+			Assert::IsTrue(cache.findValidLayout(text.c_str(), (uint32)text.size()) != nullptr, L"Rebuilt layout is valid");
+			Assert::AreEqual(1u, cache.getNumLayouts(), L"Rebuilt in place");
+		}
+
+		TEST_METHOD(TestTextLayoutLargerThanAtlas)
+		{
+			// 4 shelves of 4 glyphs, but the text has 40 different glyphs.
+			GlyphAtlas atlas;
+			atlas.initialize(64, 64, 1);
+			TextLayoutCache cache;
+			cache.initialize(&atlas, 16.0f / 64);
+			uint32 numCalls = 0;
+			const GetGlyphFunc getGlyph = makeGetGlyph(atlas, numCalls, 15);
+
+			std::wstring text;
+			for (uint32 i = 0; i < 40; ++i) {
+				text.push_back((wchar_t)(L'A' + i));
+			}
+			const TextLayout& layout = cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			Assert::AreEqual((size_t)40, layout.quads.size(), L"Every glyph is laid out");
+			Assert::IsTrue(atlas.getStats().numEvictedGlyphs > 0, L"Text evicted its own glyphs");
+			Assert::IsTrue(cache.findValidLayout(text.c_str(), (uint32)text.size()) == nullptr, L"Self-evicting layout is never reused");
+
+			numCalls = 0;
+			cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			Assert::AreEqual(40u, numCalls, L"Laid out again");
+		}
+
+		TEST_METHOD(TestTextLayoutExpiry)
+		{
+			GlyphAtlas atlas;
+			atlas.initialize(ATLAS_SIZE, ATLAS_SIZE, 1);
+			TextLayoutCache cache;
+			cache.initialize(&atlas, 32.0f / ATLAS_SIZE);
+			uint32 numCalls = 0;
+			const GetGlyphFunc getGlyph = makeGetGlyph(atlas, numCalls);
+
+			const std::wstring text = L"Score";
+			cache.buildLayout(text.c_str(), (uint32)text.size(), getGlyph);
+			for (uint32 i = 0; i < TextLayoutCache::MAX_LAYOUT_AGE; ++i) {
+				cache.onFrameEnd();
+			}
+			Assert::AreEqual(1u, cache.getNumLayouts(), L"Kept for MAX_LAYOUT_AGE frames");
+
+			// Using the layout restarts its age.
+			Assert::IsTrue(cache.findValidLayout(text.c_str(), (uint32)text.size()) != nullptr, L"Still valid");
+			for (uint32 i = 0; i < TextLayoutCache::MAX_LAYOUT_AGE; ++i) {
+				cache.onFrameEnd();
+			}
+			Assert::AreEqual(1u, cache.getNumLayouts(), L"Age restarted by use");
+			cache.onFrameEnd();
+			Assert::AreEqual(0u, cache.getNumLayouts(), L"Removed after MAX_LAYOUT_AGE frames without use");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkCJKGlyphs)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkCJKGlyphs)
+		{
+			const uint32 numFrames = 300;
+			const uint32 labelsPerFrame = 40;
+			const std::vector<std::vector<uint32>> texts = makeCJKTexts(2000, 1234);
+
+			// Labels change over time like chat logs and item names.
+			std::vector<uint32> textOrder(numFrames * labelsPerFrame);
+			for (uint32 i = 0; i < (uint32)textOrder.size(); ++i) {
+				textOrder[i] = (i % labelsPerFrame + (i / labelsPerFrame) * 3) % (uint32)texts.size();
+			}
+
+			// Max advance and line height of a 32px CJK font.
+			UniformCellCache uniformCache(40, 38);
+			GlyphAtlas atlas;
+			atlas.initialize(ATLAS_SIZE, ATLAS_SIZE, 1);
+
+			uint64 numGlyphs = 0;
+			uint64 uniformMisses = 0, atlasMisses = 0;
+
+			Stopwatch stopwatch;
+			for (uint32 textIx : textOrder) {
+				for (uint32 ch : texts[textIx]) {
+					uniformMisses += uniformCache.getGlyph(ch) ? 0 : 1;
+				}
+			}
+			const float uniformMs = stopwatch.stop();
+
+			stopwatch.start();
+			for (uint32 textIx : textOrder) {
+				atlas.beginUse();
+				for (uint32 ch : texts[textIx]) {
+					atlasMisses += getGlyph(atlas, ch) ? 0 : 1;
+				}
+				numGlyphs += texts[textIx].size();
+			}
+			const float atlasMs = stopwatch.stop();
+
+			const GlyphAtlas::Stats stats = atlas.getStats();
+			Assert::IsTrue(atlasMisses < uniformMisses, L"Packed atlas holds more glyphs than uniform cells");
+			Assert::IsTrue(stats.occupancy > 0.5f, L"Atlas is densely packed");
+
+			wchar_t msg[512];
+			swprintf_s(msg, L"CJK text: %llu glyphs in %u frames (uniform cells is a model in this test, not the old engine code)\n", numGlyphs, numFrames);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  uniform cells (model): %.2f ms, %.2f M glyphs/s, miss rate %.2f%%\n",
+				uniformMs, (float)numGlyphs / (uniformMs * 1000.0f), 100.0f * uniformMisses / numGlyphs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  GlyphAtlas           : %.2f ms, %.2f M glyphs/s, miss rate %.2f%%, %u glyphs cached, occupancy %.1f%%\n",
+				atlasMs, (float)numGlyphs / (atlasMs * 1000.0f), 100.0f * atlasMisses / numGlyphs, stats.numGlyphs, 100.0f * stats.occupancy);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
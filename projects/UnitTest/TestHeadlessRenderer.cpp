@@ -0,0 +1,215 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/engine.h"
+#include "pathos/rhi/recording_gl.h"
+#include "pathos/scene/world.h"
+#include "pathos/scene/static_mesh_actor.h"
+#include "pathos/scene/directional_light_actor.h"
+#include "pathos/scene/sky_atmosphere_actor.h"
+#include "pathos/mesh/static_mesh.h"
+#include "pathos/mesh/geometry_primitive.h"
+#include "pathos/material/material.h"
+#include "pathos/util/cpu_profiler.h"
+#include "pathos/util/engine_thread.h"
+#include "badger/system/stopwatch.h"
+
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	constexpr uint32 GRID_SIZE = 32; // GRID_SIZE^2 static meshes
+	constexpr uint32 NUM_WARMUP_FRAMES = 30;
+	constexpr uint32 NUM_MEASURED_FRAMES = 200;
+
+	struct HeadlessBenchmarkResult {
+		uint64 numFrames = 0;
+		float elapsedMs = 0.0f;
+		RecordingGLFrame lastFrame;
+		std::vector<ProfileItem> renderThreadItems;
+	};
+
+	// Fixed camera over a grid of cubes, so every frame renders the same scene.
+	class HeadlessBenchmarkWorld : public World {
+
+	public:
+		HeadlessBenchmarkWorld(HeadlessBenchmarkResult* inResult) : result(inResult) {}
+
+		virtual void onInitialize() override {
+			getCamera().lookAt(vector3(0.0f, 20.0f, -40.0f), vector3(0.0f, 0.0f, 0.0f), vector3(0.0f, 1.0f, 0.0f));
+
+			auto dirLight = spawnActor<DirectionalLightActor>();
+			dirLight->setDirection(glm::normalize(vector3(-0.5f, -1.0f, 1.0f)));
+			dirLight->setColorAndIlluminance(vector3(1.0f, 1.0f, 1.0f), 10.0f);
+
+			spawnActor<SkyAtmosphereActor>();
+
+			auto geometry = makeAssetPtr<CubeGeometry>(vector3(0.4f));
+			assetPtr<MaterialInstance> materials[4];
+			for (uint32 i = 0; i < 4; ++i) {
+				materials[i] = Material::createMaterialInstance("solid_color");
+				materials[i]->setConstantParameter("albedo", vector3(0.2f * i, 0.5f, 0.9f - 0.2f * i));
+				materials[i]->setConstantParameter("metallic", 0.0f);
+				materials[i]->setConstantParameter("roughness", 0.25f * i);
+				materials[i]->setConstantParameter("emissive", vector3(0.0f));
+			}
+			for (uint32 x = 0; x < GRID_SIZE; ++x) {
+				for (uint32 z = 0; z < GRID_SIZE; ++z) {
+					auto mesh = makeAssetPtr<StaticMesh>(geometry, materials[(x + z) % 4]);
+					auto actor = spawnActor<StaticMeshActor>();
+					actor->setStaticMesh(mesh);
+					actor->setActorLocation(vector3((float)x - 0.5f * GRID_SIZE, 0.0f, (float)z - 0.5f * GRID_SIZE));
+				}
+			}
+		}
+
+		virtual void onTick(float deltaSeconds) override {
+			RecordingGLFrame frame;
+			getLastRecordingGLFrame(frame);
+			if (!bMeasuring && frame.frameCount >= NUM_WARMUP_FRAMES) {
+				bMeasuring = true;
+				firstFrame = frame.frameCount;
+				stopwatch.start();
+			} else if (bMeasuring && frame.frameCount >= firstFrame + NUM_MEASURED_FRAMES && !bStopped) {
+				bStopped = true;
+				result->elapsedMs = stopwatch.stop();
+				result->numFrames = frame.frameCount - firstFrame;
+				result->lastFrame = std::move(frame);
+				CpuProfiler::getInstance().getLastFrameSnapshot(gRenderThreadId, result->renderThreadItems);
+				gEngine->stop();
+			}
+		}
+
+	private:
+		HeadlessBenchmarkResult* result;
+		Stopwatch stopwatch;
+		uint64 firstFrame = 0;
+		bool bMeasuring = false;
+		bool bStopped = false;
+	};
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestHeadlessRenderer) {
+	public:
+		TEST_METHOD(TestRecordingGL) {
+			installRecordingGL();
+			presentRecordingGLFrame(); // Discard previous calls.
+
+			GLuint buffers[2];
+			glCreateBuffers(2, buffers);
+			glNamedBufferStorage(buffers[0], 256, nullptr, GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT);
+			uint8 data[64] = { 0, };
+			glNamedBufferSubData(buffers[0], 0, sizeof(data), data);
+			void* mapped = glMapNamedBufferRange(buffers[0], 128, 128, GL_MAP_WRITE_BIT);
+
+			glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, "Outer");
+			glEnable(GL_DEPTH_TEST);
+			glUseProgram(1);
+			for (uint32 i = 0; i < 2; ++i) {
+				glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, "Inner");
+				glDrawArrays(GL_TRIANGLES, 0, 3);
+				glPopDebugGroup();
+			}
+			glDispatchCompute(1, 1, 1);
+			glPopDebugGroup();
+
+			GLint linkStatus = GL_FALSE;
+			glGetProgramiv(1, GL_LINK_STATUS, &linkStatus);
+			const GLenum fboStatus = glCheckNamedFramebufferStatus(1, GL_DRAW_FRAMEBUFFER);
+			GLint viewport[4] = { -1, -1, -1, -1 };
+			glGetIntegerv(GL_VIEWPORT, viewport);
+			GLint maxViewportDims[2] = { -1, -1 };
+			glGetIntegerv(GL_MAX_VIEWPORT_DIMS, maxViewportDims);
+			glDeleteBuffers(2, buffers);
+			presentRecordingGLFrame();
+
+			RecordingGLFrame frame;
+			getLastRecordingGLFrame(frame);
+			Assert::IsTrue(buffers[0] != 0 && buffers[1] != 0 && buffers[0] != buffers[1], L"Object names should be unique");
+			Assert::IsTrue(mapped != nullptr, L"Mapping a buffer should return writable memory");
+			Assert::AreEqual(GL_TRUE, linkStatus, L"Programs should be linked");
+			Assert::AreEqual((GLenum)GL_FRAMEBUFFER_COMPLETE, fboStatus, L"Framebuffers should be complete");
+			Assert::IsTrue(viewport[0] == 0 && viewport[1] == 0 && viewport[2] == 0 && viewport[3] == 0, L"Every value of an array query should be written");
+			Assert::IsTrue(maxViewportDims[0] > 0 && maxViewportDims[1] > 0, L"Max viewport dims should be positive");
+			Assert::AreEqual(2ull, frame.stats.numDrawCalls, L"Wrong number of draw calls");
+			Assert::AreEqual(1ull, frame.stats.numDispatchCalls, L"Wrong number of dispatch calls");
+			Assert::AreEqual(2ull, frame.stats.numStateChanges, L"Wrong number of state changes");
+			Assert::AreEqual(2ull, frame.stats.numObjectsCreated, L"Wrong number of created objects");
+			Assert::AreEqual(2ull, frame.stats.numObjectsDeleted, L"Wrong number of deleted objects");
+			Assert::AreEqual(64ull + 128ull, frame.stats.bytesUploaded, L"Wrong number of uploaded bytes");
+
+			// Outer includes Inner; calls of Inner are merged.
+			Assert::AreEqual((size_t)2, frame.passes.size(), L"Wrong number of passes");
+			Assert::IsTrue(frame.passes[0].name == "Outer" && frame.passes[0].depth == 0, L"Wrong pass");
+			Assert::IsTrue(frame.passes[1].name == "Inner" && frame.passes[1].parent == 0, L"Wrong pass");
+			Assert::AreEqual(2u, frame.passes[1].numInvocations, L"Passes of same name should be merged");
+			Assert::AreEqual(2ull, frame.passes[0].stats.numDrawCalls, L"Outer pass should include inner passes");
+			Assert::AreEqual(1ull, frame.passes[0].stats.numDispatchCalls, L"Wrong dispatch calls of the pass");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkHeadlessRenderer)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// CPU cost of the whole renderer without GPU. Scene proxies are built and every render command is
+		// executed, but GL calls only go to the recording backend.
+		TEST_METHOD(BenchmarkHeadlessRenderer) {
+			HeadlessBenchmarkResult result;
+
+			EngineConfig config;
+			config.windowWidth = 1920;
+			config.windowHeight = 1080;
+			config.fullscreen = false;
+			config.title = "Headless Benchmark";
+			config.headless = true;
+			Engine::init(0, nullptr, config);
+
+			gEngine->setWorld(new HeadlessBenchmarkWorld(&result));
+			gEngine->start();
+
+			Assert::IsTrue(result.numFrames > 0, L"No frame was measured");
+			Assert::IsTrue(result.lastFrame.stats.numDrawCalls > 0, L"Renderer did not issue draw calls");
+
+			wchar_t msg[256];
+			const RecordingGLStats& stats = result.lastFrame.stats;
+			swprintf_s(msg, L"meshes=%u frames=%llu avg frame=%.3f ms\n",
+				GRID_SIZE * GRID_SIZE, result.numFrames, result.elapsedMs / result.numFrames);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"last frame: calls=%llu draws=%llu dispatches=%llu state changes=%llu created=%llu deleted=%llu uploaded=%llu bytes\n",
+				stats.numCalls, stats.numDrawCalls, stats.numDispatchCalls, stats.numStateChanges,
+				stats.numObjectsCreated, stats.numObjectsDeleted, stats.bytesUploaded);
+			Logger::WriteMessage(msg);
+
+			// GL commands per pass, from debug groups.
+			for (const RecordingGLPassStats& pass : result.lastFrame.passes) {
+				swprintf_s(msg, L"%*s%S (x%u): calls=%llu draws=%llu dispatches=%llu state changes=%llu uploaded=%llu bytes\n",
+					2 * pass.depth, L"", pass.name.c_str(), pass.numInvocations,
+					pass.stats.numCalls, pass.stats.numDrawCalls, pass.stats.numDispatchCalls,
+					pass.stats.numStateChanges, pass.stats.bytesUploaded);
+				Logger::WriteMessage(msg);
+			}
+
+			// CPU time per pass, from the render thread profile.
+			for (const ProfileItem& item : result.renderThreadItems) {
+				swprintf_s(msg, L"%*s%S: %.3f ms\n", 2 * item.tab, L"", item.name.c_str(), item.elapsedMS);
+				Logger::WriteMessage(msg);
+			}
+
+			// Most frequent GL functions.
+			std::vector<uint32> functions(getNumRecordingGLFunctions());
+			for (uint32 i = 0; i < (uint32)functions.size(); ++i) {
+				functions[i] = i;
+			}
+			const std::vector<uint32>& counts = result.lastFrame.callCounts;
+			std::sort(functions.begin(), functions.end(), [&counts](uint32 a, uint32 b) { return counts[a] > counts[b]; });
+			for (uint32 i = 0; i < 10 && counts[functions[i]] > 0; ++i) {
+				swprintf_s(msg, L"%S: %u\n", getRecordingGLFunctionName(functions[i]), counts[functions[i]]);
+				Logger::WriteMessage(msg);
+			}
+		}
+	};
+}
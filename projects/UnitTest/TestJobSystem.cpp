@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/system/job_system.h"
+#include "badger/system/thread_pool.h"
+#include "badger/system/stopwatch.h"
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+	// Each job forks two children from a worker thread and joins them,
+	// so jobs go through the workers' own deques and are spread by stealing.
+	void forkJoin(JobSystem* jobSystem, uint32 depth, std::atomic<int32>* numLeaves) {
+		if (depth == 0) {
+			numLeaves->fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		JobCounter counter;
+		JobDesc desc;
+		desc.counter = &counter;
+		desc.routine = [jobSystem, depth, numLeaves](const JobParam* param) {
+			forkJoin(jobSystem, depth - 1, numLeaves);
+		};
+		jobSystem->addJob(desc);
+		jobSystem->addJob(desc);
+		jobSystem->waitForCounter(&counter);
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestJobSystem) {
+	public:
+		TEST_METHOD(TestJobCounter) {
+			JobSystem jobSystem;
+			jobSystem.start(4);
+
+			std::atomic<int32> numExecuted = 0;
+			JobCounter counter;
+			JobDesc desc;
+			desc.counter = &counter;
+			desc.routine = [&numExecuted](const JobParam* param) {
+				numExecuted.fetch_add(1);
+			};
+			for (int32 i = 0; i < 10000; ++i) {
+				jobSystem.addJob(desc);
+			}
+			jobSystem.waitForCounter(&counter);
+
+			Assert::IsTrue(counter.isDone(), L"Counter should be zero after wait");
+			Assert::AreEqual(10000, numExecuted.load(), L"Some jobs were not executed");
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestJobDependency) {
+			JobSystem jobSystem;
+			jobSystem.start(4);
+
+			constexpr int32 NUM_JOBS = 1000;
+			std::atomic<int32> numFirstStage = 0;
+			std::atomic<int32> numViolations = 0;
+			JobCounter firstStage, secondStage;
+
+			JobDesc desc;
+			desc.counter = &firstStage;
+			desc.routine = [&numFirstStage](const JobParam* param) {
+				numFirstStage.fetch_add(1);
+			};
+			for (int32 i = 0; i < NUM_JOBS; ++i) {
+				jobSystem.addJob(desc);
+			}
+
+			desc.counter = &secondStage;
+			desc.dependency = &firstStage;
+			desc.routine = [&numFirstStage, &numViolations](const JobParam* param) {
+				if (numFirstStage.load() != NUM_JOBS) {
+					numViolations.fetch_add(1);
+				}
+			};
+			for (int32 i = 0; i < NUM_JOBS; ++i) {
+				jobSystem.addJob(desc);
+			}
+			jobSystem.waitForCounter(&secondStage);
+
+			Assert::AreEqual(0, numViolations.load(), L"Dependent job started before its dependency finished");
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestParallelFor) {
+			JobSystem jobSystem;
+			jobSystem.start(4);
+
+			constexpr uint32 COUNT = 100000;
+			std::vector<uint32> values(COUNT, 0);
+			parallelFor(&jobSystem, COUNT, 256, [&values](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					values[i] += i;
+				}
+			});
+			bool bAllVisitedOnce = true;
+			for (uint32 i = 0; i < COUNT; ++i) {
+				bAllVisitedOnce = bAllVisitedOnce && (values[i] == i);
+			}
+			Assert::IsTrue(bAllVisitedOnce, L"parallelFor should visit every index exactly once");
+
+			jobSystem.stop();
+
+			// Serial fallback
+			parallelFor(nullptr, COUNT, 256, [&values](uint32 begin, uint32 end) {
+				for (uint32 i = begin; i < end; ++i) {
+					values[i] -= i;
+				}
+			});
+			Assert::AreEqual(0u, values[COUNT - 1], L"parallelFor without job system should run serially");
+		}
+
+		// Many short-lived counters on the stack. Workers must not touch a counter
+		// after its waiter has returned from waitForCounter().
+		TEST_METHOD(TestParallelForStress) {
+			JobSystem jobSystem;
+			jobSystem.start(8);
+
+			constexpr uint32 NUM_ROUNDS = 5000;
+			constexpr uint32 COUNT = 16;
+			uint32 numWrongSums = 0;
+			for (uint32 round = 0; round < NUM_ROUNDS; ++round) {
+				std::atomic<uint32> sum = 0;
+				parallelFor(&jobSystem, COUNT, 1, [&sum](uint32 begin, uint32 end) {
+					for (uint32 i = begin; i < end; ++i) {
+						sum.fetch_add(i + 1);
+					}
+				});
+				numWrongSums += (sum.load() == COUNT * (COUNT + 1) / 2) ? 0 : 1;
+			}
+			Assert::AreEqual(0u, numWrongSums, L"Every parallelFor should finish all batches before returning");
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestStopSignalsDiscardedJobs) {
+			JobSystem jobSystem;
+			jobSystem.start(1);
+
+			// Keep the only worker busy until stop() is requested, so the jobs below are discarded.
+			std::atomic<bool> bStarted = false, bRelease = false;
+			JobDesc blocker;
+			blocker.routine = [&bStarted, &bRelease](const JobParam* param) {
+				bStarted = true;
+				while (!bRelease) {
+					std::this_thread::yield();
+				}
+			};
+			jobSystem.addJob(blocker);
+			while (!bStarted) {
+				std::this_thread::yield();
+			}
+
+			JobCounter counter;
+			JobDesc desc;
+			desc.counter = &counter;
+			desc.routine = [](const JobParam* param) {};
+			for (int32 i = 0; i < 100; ++i) {
+				jobSystem.addJob(desc);
+			}
+
+			std::thread stopThread([&jobSystem]() { jobSystem.stop(); });
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			bRelease = true;
+			stopThread.join();
+
+			Assert::IsTrue(counter.isDone(), L"Counters of discarded jobs should be signaled");
+			jobSystem.waitForCounter(&counter);
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkJobSystem)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Compare jobs/sec of the work-stealing job system against the single-queue ThreadPool.
+		// Jobs added by the main thread go through the inboxes. Fork/join jobs are added by workers,
+		// so they measure the workers' own deques and stealing.
+		TEST_METHOD(BenchmarkJobSystem) {
+			constexpr int32 NUM_JOBS = 200000;
+			constexpr uint32 FORK_JOIN_DEPTH = 17;
+			constexpr int32 NUM_FORK_JOIN_JOBS = (2 << FORK_JOIN_DEPTH) - 1;
+			const uint32 threadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+			wchar_t msg[256];
+
+			for (uint32 numThreads : threadCounts) {
+				std::atomic<int32> numDone = 0;
+				auto routine = [&numDone]() { numDone.fetch_add(1, std::memory_order_relaxed); };
+
+				float elapsedPool = 0.0f;
+				{
+					ThreadPool pool;
+					pool.Start(numThreads);
+					Stopwatch stopwatch;
+					for (int32 i = 0; i < NUM_JOBS; ++i) {
+						ThreadPoolWork work;
+						work.arg = nullptr;
+						work.routine = [&routine](const WorkItemParam* param) { routine(); };
+						pool.AddWorkSafe(work);
+					}
+					while (numDone.load() < NUM_JOBS) {
+						std::this_thread::yield();
+					}
+					elapsedPool = stopwatch.stop();
+					pool.Stop();
+				}
+
+				numDone = 0;
+				float elapsedJobSystem = 0.0f;
+				{
+					JobSystem jobSystem;
+					jobSystem.start(numThreads);
+					JobCounter counter;
+					JobDesc desc;
+					desc.counter = &counter;
+					desc.routine = [&routine](const JobParam* param) { routine(); };
+					Stopwatch stopwatch;
+					for (int32 i = 0; i < NUM_JOBS; ++i) {
+						jobSystem.addJob(desc);
+					}
+					jobSystem.waitForCounter(&counter);
+					elapsedJobSystem = stopwatch.stop();
+					jobSystem.stop();
+				}
+
+				float elapsedForkJoin = 0.0f;
+				{
+					JobSystem jobSystem;
+					jobSystem.start(numThreads);
+					std::atomic<int32> numLeaves = 0;
+					JobCounter counter;
+					JobDesc desc;
+					desc.counter = &counter;
+					desc.routine = [&jobSystem, &numLeaves](const JobParam* param) {
+						forkJoin(&jobSystem, FORK_JOIN_DEPTH, &numLeaves);
+					};
+					Stopwatch stopwatch;
+					jobSystem.addJob(desc);
+					// Don't help from the main thread. It would steal unrelated jobs while waiting
+					// and nest them on its stack without a bound.
+					while (!counter.isDone()) {
+						std::this_thread::yield();
+					}
+					elapsedForkJoin = stopwatch.stop();
+					jobSystem.waitForCounter(&counter);
+					jobSystem.stop();
+					Assert::AreEqual(1 << FORK_JOIN_DEPTH, numLeaves.load(), L"Some fork/join jobs were not executed");
+				}
+
+				swprintf_s(msg, L"threads=%2u ThreadPool=%10.0f jobs/sec JobSystem(inbox)=%10.0f jobs/sec JobSystem(fork/join)=%10.0f jobs/sec\n",
+					numThreads,
+					NUM_JOBS / (0.001f * std::max(elapsedPool, 0.001f)),
+					NUM_JOBS / (0.001f * std::max(elapsedJobSystem, 0.001f)),
+					NUM_FORK_JOIN_JOBS / (0.001f * std::max(elapsedForkJoin, 0.001f)));
+				Logger::WriteMessage(msg);
+			}
+		}
+	};
+}
@@ -0,0 +1,310 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/scene/camera.h"
+#include "pathos/scene/landscape_quadtree.h"
+
+#include "badger/math/height_field.h"
+#include "badger/math/hit_test.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Rolling hills with some noise, in [0, 1].
+	std::vector<float> makeHeightmap(uint32 width, uint32 height, uint32 seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> noise(-0.05f, 0.05f);
+		std::vector<float> values(width * height);
+		for (uint32 y = 0; y < height; ++y) {
+			for (uint32 x = 0; x < width; ++x) {
+				float h = 0.5f + 0.2f * std::sin(0.11f * x) * std::cos(0.07f * y) + 0.15f * std::sin(0.031f * (x + 2 * y));
+				values[y * width + x] = glm::clamp(h + noise(rng), 0.0f, 1.0f);
+			}
+		}
+		return values;
+	}
+
+	bool raycastBruteForce(const badger::HeightField& heightField, const vector3& origin, const vector3& direction, float tMin, float tMax, float& outT) {
+		bool bHit = false;
+		outT = std::numeric_limits<float>::max();
+		for (uint32 y = 0; y + 1 < heightField.getHeight(); ++y) {
+			for (uint32 x = 0; x + 1 < heightField.getWidth(); ++x) {
+				float t;
+				if (heightField.raycastCell(x, y, origin, direction, tMin, tMax, t) && t < outT) {
+					outT = t;
+					bHit = true;
+				}
+			}
+		}
+		return bHit;
+	}
+
+	// Same transform as LandscapeActor: local XY plane with heights on +Z, rotated so that +Z is up in the world.
+	matrix4 makeLandscapeTransform() {
+		matrix4 M = glm::translate(matrix4(1.0f), vector3(-100.0f, -5.0f, 60.0f));
+		return glm::rotate(M, glm::radians(-90.0f), vector3(1.0f, 0.0f, 0.0f));
+	}
+
+	LandscapeSelectionParams makeSelectionParams(const vector3& eye, const vector3& target) {
+		PerspectiveLens lens(60.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+		Camera camera(lens);
+		camera.lookAt(eye, target, vector3(0.0f, 1.0f, 0.0f));
+
+		LandscapeSelectionParams params;
+		camera.getFrustumPlanes(params.frustum);
+		params.numFrustumPlanes = 5;
+		params.localToWorld = makeLandscapeTransform();
+		params.cameraPosition = eye;
+		params.sectorSizeX = 8.0f;
+		params.sectorSizeY = 8.0f;
+		params.heightMultiplier = 20.0f;
+		params.lod0Range = 24.0f;
+		params.morphStartRatio = 0.7f;
+		return params;
+	}
+
+	// Level of the node that covers each sector, or -1 if not covered. Returns false if any sector is covered twice.
+	bool rasterizeSelection(const LandscapeQuadTree& tree, const std::vector<LandscapeSelectedNode>& nodes, std::vector<int32>& outLevels) {
+		const uint32 countX = tree.getSectorCountX(), countY = tree.getSectorCountY();
+		outLevels.assign(countX * countY, -1);
+		for (const LandscapeSelectedNode& node : nodes) {
+			for (uint32 y = node.sectorY; y < node.sectorY + node.numSectors; ++y) {
+				for (uint32 x = node.sectorX; x < node.sectorX + node.numSectors; ++x) {
+					if (x >= countX || y >= countY || outLevels[y * countX + x] != -1) {
+						return false;
+					}
+					outLevels[y * countX + x] = (int32)node.level;
+				}
+			}
+		}
+		return true;
+	}
+
+	float distanceSquared(const AABB& box, const vector3& p) {
+		const vector3 d = glm::max(glm::max(box.minBounds - p, p - box.maxBounds), vector3(0.0f));
+		return glm::dot(d, d);
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestLandscape) {
+	public:
+		TEST_METHOD(TestHeightPyramid) {
+			constexpr uint32 W = 67, H = 45; // Not powers of two
+			std::vector<float> values = makeHeightmap(W, H, 1);
+			badger::HeightField heightField;
+			heightField.initialize(W, H, values.data());
+
+			for (uint32 level = 0; level < heightField.getNumLevels(); ++level) {
+				for (uint32 y = 0; y < heightField.getLevelSizeY(level); ++y) {
+					for (uint32 x = 0; x < heightField.getLevelSizeX(level); ++x) {
+						// A cell of the level covers samples [x << level, (x + 1) << level].
+						const int32 x0 = x << level, y0 = y << level;
+						const vector2 expected = heightField.getHeightRange(x0, y0, ((x + 1) << level), ((y + 1) << level));
+						const vector2 actual = heightField.getCellRange(level, x, y);
+						Assert::AreEqual(expected.x, actual.x, L"Min height of the pyramid cell");
+						Assert::AreEqual(expected.y, actual.y, L"Max height of the pyramid cell");
+					}
+				}
+			}
+			const uint32 top = heightField.getNumLevels() - 1;
+			Assert::IsTrue(heightField.getLevelSizeX(top) == 1 && heightField.getLevelSizeY(top) == 1, L"Pyramid should end with a single cell");
+
+			// Sampling at sample coordinates returns the sample.
+			Assert::AreEqual(values[7 * W + 5], heightField.sample(5.0f, 7.0f), L"Sample at integer coordinates");
+			const float mid = 0.25f * (values[7 * W + 5] + values[7 * W + 6] + values[8 * W + 5] + values[8 * W + 6]);
+			Assert::AreEqual(mid, heightField.sample(5.5f, 7.5f), 1e-6f, L"Bilinear sample at the center of a cell");
+		}
+
+		TEST_METHOD(TestRaycastMatchesBruteForce) {
+			constexpr uint32 W = 97, H = 73;
+			std::vector<float> values = makeHeightmap(W, H, 2);
+			badger::HeightField heightField;
+			heightField.initialize(W, H, values.data());
+
+			std::mt19937 rng(3);
+			std::uniform_real_distribution<float> posX(-10.0f, W + 10.0f), posY(-10.0f, H + 10.0f), posZ(-0.2f, 1.5f);
+			std::uniform_real_distribution<float> dirXY(-1.0f, 1.0f), dirZ(-1.0f, 0.2f);
+
+			uint32 numHits = 0;
+			for (uint32 i = 0; i < 2000; ++i) {
+				const vector3 origin(posX(rng), posY(rng), posZ(rng));
+				vector3 direction(dirXY(rng) * 40.0f, dirXY(rng) * 40.0f, dirZ(rng));
+				if (i % 50 == 0) direction = vector3(0.0f, 0.0f, -1.0f); // Vertical
+				if (i % 50 == 1) direction.x = 0.0f;                     // Axis-aligned in xy
+				if (i % 50 == 2) direction.z = 0.0f;                     // Horizontal
+
+				float expectedT;
+				badger::HeightFieldHit hit;
+				const bool bExpected = raycastBruteForce(heightField, origin, direction, 0.0f, 3.0f, expectedT);
+				const bool bActual = heightField.raycast(origin, direction, 0.0f, 3.0f, hit);
+
+				Assert::AreEqual(bExpected, bActual, L"Hit result should match brute force");
+				if (bExpected) {
+					Assert::AreEqual(expectedT, hit.t, 1e-4f, L"Hit distance should match brute force");
+					const float surface = heightField.sample(hit.position.x, hit.position.y);
+					Assert::IsTrue(hit.position.z <= surface + 1e-3f, L"Hit point should be on or below the surface");
+					++numHits;
+				}
+			}
+			Assert::IsTrue(numHits > 200 && numHits < 1900, L"Rays should both hit and miss");
+		}
+
+		TEST_METHOD(TestSelectionCoversVisibleSectors) {
+			constexpr uint32 COUNT_X = 37, COUNT_Y = 23; // Nodes at the edges are incomplete
+			std::vector<float> values = makeHeightmap(257, 161, 4);
+			badger::HeightField heightField;
+			heightField.initialize(257, 161, values.data());
+			LandscapeQuadTree tree;
+			tree.build(COUNT_X, COUNT_Y, &heightField);
+
+			// Sector bounds contain the heightmap surface over the sector.
+			for (uint32 y = 0; y < COUNT_Y; ++y) {
+				for (uint32 x = 0; x < COUNT_X; ++x) {
+					const vector2 range = tree.getNodeHeightRange(0, x, y);
+					for (uint32 i = 0; i <= 8; ++i) {
+						const float gx = (x + i / 8.0f) * 256.0f / COUNT_X, gy = (y + (8 - i) / 8.0f) * 160.0f / COUNT_Y;
+						const float h = heightField.sample(gx, gy);
+						Assert::IsTrue(range.x <= h && h <= range.y, L"Sector height range should contain the surface");
+					}
+				}
+			}
+
+			const vector3 eyes[] = {
+				vector3(-80.0f, 30.0f, 40.0f), vector3(50.0f, 120.0f, -60.0f),
+				vector3(-120.0f, 10.0f, 80.0f), vector3(100.0f, 25.0f, -120.0f),
+			};
+			const vector3 targets[] = {
+				vector3(20.0f, 0.0f, -40.0f), vector3(40.0f, 0.0f, -70.0f),
+				vector3(0.0f, 0.0f, 0.0f), vector3(-60.0f, 5.0f, -20.0f),
+			};
+			for (uint32 cameraIx = 0; cameraIx < 4; ++cameraIx) {
+				const LandscapeSelectionParams params = makeSelectionParams(eyes[cameraIx], targets[cameraIx]);
+				std::vector<LandscapeSelectedNode> nodes;
+				LandscapeSelectionStats stats;
+				tree.select(params, nodes, &stats);
+
+				std::vector<int32> levels;
+				Assert::IsTrue(rasterizeSelection(tree, nodes, levels), L"Selected nodes should not overlap");
+
+				uint32 numVisibleSectors = 0;
+				for (uint32 y = 0; y < COUNT_Y; ++y) {
+					for (uint32 x = 0; x < COUNT_X; ++x) {
+						const AABB localBounds = tree.getNodeBounds(0, x, y, params.sectorSizeX, params.sectorSizeY, params.heightMultiplier);
+						const AABB worldBounds = badger::calculateWorldBounds(localBounds, params.localToWorld);
+						if (!badger::hitTest::AABB_frustum_noFarPlane(worldBounds, params.frustum)) {
+							continue;
+						}
+						++numVisibleSectors;
+						const int32 level = levels[y * COUNT_X + x];
+						Assert::IsTrue(level >= 0, L"Every visible sector should be selected");
+						if (distanceSquared(worldBounds, params.cameraPosition) < params.lod0Range * params.lod0Range) {
+							Assert::AreEqual(0, level, L"Sectors in the range of LOD 0 should have LOD 0");
+						}
+					}
+				}
+
+				for (const LandscapeSelectedNode& node : nodes) {
+					const uint32 nodeLevel = node.level - node.meshLOD;
+					Assert::IsTrue(node.meshLOD <= 1, L"Quadrants are drawn with the grid of at most one level up");
+					Assert::AreEqual(1u << nodeLevel, node.numSectors, L"Selected area should be a quadtree node");
+					const AABB localBounds = tree.getNodeBounds(nodeLevel, node.sectorX >> nodeLevel, node.sectorY >> nodeLevel,
+						params.sectorSizeX, params.sectorSizeY, params.heightMultiplier);
+					const AABB worldBounds = badger::calculateWorldBounds(localBounds, params.localToWorld);
+					Assert::IsTrue(badger::hitTest::AABB_frustum_noFarPlane(worldBounds, params.frustum), L"Selected nodes should be in the frustum");
+					Assert::IsTrue(node.morphStart < node.morphEnd, L"Morph range");
+				}
+
+				Assert::IsTrue(numVisibleSectors > 0, L"Camera should see the landscape");
+				Assert::IsTrue(nodes.size() <= numVisibleSectors, L"LOD selection should not draw more nodes than visible sectors");
+				Assert::IsTrue(stats.frustumTests < COUNT_X * COUNT_Y, L"Hierarchical culling should test fewer boxes than sectors");
+			}
+		}
+
+		TEST_METHOD(TestSelectionLODTransitions) {
+			constexpr uint32 COUNT = 64;
+			std::vector<float> values = makeHeightmap(129, 129, 5);
+			badger::HeightField heightField;
+			heightField.initialize(129, 129, values.data());
+			LandscapeQuadTree tree;
+			tree.build(COUNT, COUNT, &heightField);
+			Assert::AreEqual(7u, tree.getNumLevels(), L"64x64 sectors need 7 levels");
+
+			std::mt19937 rng(6);
+			std::uniform_real_distribution<float> eyeXZ(-100.0f, 400.0f), eyeY(5.0f, 80.0f);
+			for (uint32 i = 0; i < 20; ++i) {
+				const vector3 eye(eyeXZ(rng) - 100.0f, eyeY(rng), 60.0f - eyeXZ(rng));
+				const vector3 target = eye + vector3(std::cos(i * 0.7f), -0.3f, std::sin(i * 0.7f));
+				const LandscapeSelectionParams params = makeSelectionParams(eye, target);
+				std::vector<LandscapeSelectedNode> nodes;
+				tree.select(params, nodes);
+
+				std::vector<int32> levels;
+				Assert::IsTrue(rasterizeSelection(tree, nodes, levels), L"Selected nodes should not overlap");
+				// Morphing only hides the difference of one level.
+				for (uint32 y = 0; y < COUNT; ++y) {
+					for (uint32 x = 0; x < COUNT; ++x) {
+						const int32 level = levels[y * COUNT + x];
+						if (level < 0) continue;
+						const int32 right = (x + 1 < COUNT) ? levels[y * COUNT + x + 1] : -1;
+						const int32 down = (y + 1 < COUNT) ? levels[(y + 1) * COUNT + x] : -1;
+						Assert::IsTrue(right < 0 || std::abs(right - level) <= 1, L"Adjacent LODs should differ by at most 1");
+						Assert::IsTrue(down < 0 || std::abs(down - level) <= 1, L"Adjacent LODs should differ by at most 1");
+					}
+				}
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkRaycast)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkRaycast) {
+			constexpr uint32 SIZE = 513;
+			constexpr uint32 NUM_RAYS = 200;
+			std::vector<float> values = makeHeightmap(SIZE, SIZE, 7);
+			badger::HeightField heightField;
+			heightField.initialize(SIZE, SIZE, values.data());
+
+			std::mt19937 rng(8);
+			std::uniform_real_distribution<float> pos(0.0f, (float)SIZE), dir(-1.0f, 1.0f);
+			std::vector<vector3> origins(NUM_RAYS), directions(NUM_RAYS);
+			for (uint32 i = 0; i < NUM_RAYS; ++i) {
+				origins[i] = vector3(pos(rng), pos(rng), 1.2f);
+				directions[i] = vector3(dir(rng) * 200.0f, dir(rng) * 200.0f, -0.5f);
+			}
+
+			Stopwatch stopwatch;
+			stopwatch.start();
+			uint32 bruteForceHits = 0;
+			for (uint32 i = 0; i < NUM_RAYS; ++i) {
+				float t;
+				bruteForceHits += raycastBruteForce(heightField, origins[i], directions[i], 0.0f, 1.0f, t) ? 1 : 0;
+			}
+			const float bruteForceMs = stopwatch.stop();
+
+			stopwatch.start();
+			uint32 pyramidHits = 0;
+			for (uint32 i = 0; i < NUM_RAYS; ++i) {
+				badger::HeightFieldHit hit;
+				pyramidHits += heightField.raycast(origins[i], directions[i], 0.0f, 1.0f, hit) ? 1 : 0;
+			}
+			const float pyramidMs = stopwatch.stop();
+
+			Assert::AreEqual(bruteForceHits, pyramidHits, L"Both methods should hit the same rays");
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"%u rays on %ux%u heightfield: brute force %.3f ms, pyramid %.3f ms\n", NUM_RAYS, SIZE, SIZE, bruteForceMs, pyramidMs);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
@@ -0,0 +1,245 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/mesh/mesh_optimizer.h"
+#include "pathos/util/resource_finder.h"
+
+#include "tiny_obj_loader.h"
+#include <vector>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// UV sphere with shuffled triangles, the worst case for the vertex cache.
+	void makeShuffledSphere(uint32 numRings, uint32 numSegments, std::vector<float>& outPositions, std::vector<uint32>& outIndices) {
+		outPositions.clear();
+		outIndices.clear();
+		for (uint32 ring = 0; ring <= numRings; ++ring) {
+			const float theta = glm::pi<float>() * (float)ring / numRings;
+			for (uint32 seg = 0; seg <= numSegments; ++seg) {
+				const float phi = glm::two_pi<float>() * (float)seg / numSegments;
+				outPositions.push_back(std::sin(theta) * std::cos(phi));
+				outPositions.push_back(std::cos(theta));
+				outPositions.push_back(std::sin(theta) * std::sin(phi));
+			}
+		}
+		std::vector<std::array<uint32, 3>> triangles;
+		for (uint32 ring = 0; ring < numRings; ++ring) {
+			for (uint32 seg = 0; seg < numSegments; ++seg) {
+				const uint32 i0 = ring * (numSegments + 1) + seg;
+				const uint32 i1 = i0 + 1, i2 = i0 + numSegments + 2, i3 = i0 + numSegments + 1;
+				// Counter-clockwise seen from outside.
+				if (ring != 0) triangles.push_back({ i0, i1, i3 });
+				if (ring != numRings - 1) triangles.push_back({ i1, i2, i3 });
+			}
+		}
+		std::mt19937 rng(7);
+		std::shuffle(triangles.begin(), triangles.end(), rng);
+		for (const auto& tri : triangles) {
+			outIndices.insert(outIndices.end(), tri.begin(), tri.end());
+		}
+	}
+
+	// Triangles as sorted vertex triples, to compare triangle sets regardless of order.
+	std::vector<std::array<uint32, 3>> sortedTriangles(const std::vector<uint32>& indices) {
+		std::vector<std::array<uint32, 3>> triangles;
+		for (size_t i = 0; i < indices.size(); i += 3) {
+			// Rotate the smallest index to the front, to keep the winding.
+			const uint32* t = &indices[i];
+			const uint32 k = (t[0] <= t[1] && t[0] <= t[2]) ? 0 : ((t[1] <= t[2]) ? 1 : 2);
+			triangles.push_back({ t[k], t[(k + 1) % 3], t[(k + 2) % 3] });
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	vector3 getPosition(const std::vector<float>& positions, uint32 v) {
+		return vector3(positions[v * 3], positions[v * 3 + 1], positions[v * 3 + 2]);
+	}
+
+	// Bytes per vertex of a full vertex (position, uv, normal, tangent, bitangent) in each format.
+	constexpr uint32 FLOAT_VERTEX_BYTES = 12 + 8 + 12 + 16 + 12;
+	constexpr uint32 PACKED_VERTEX_BYTES = 12 + 4 + 4 + 4;                // MeshGeometry::EVaryingFormat::Packed
+	constexpr uint32 QUANTIZED_VERTEX_BYTES = 2 * 4 + 4 + 4 + 4;          // 16-bit positions, half uv, octahedral normal, snorm10 tangent
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestMeshOptimizer) {
+	public:
+		TEST_METHOD(TestVertexCacheOptimization) {
+			std::vector<float> positions;
+			std::vector<uint32> indices;
+			makeShuffledSphere(64, 128, positions, indices);
+			const uint32 numVertices = (uint32)(positions.size() / 3);
+			const uint32 numIndices = (uint32)indices.size();
+
+			VertexCacheStatistics before = MeshOptimizer::analyzeVertexCache(indices.data(), numIndices, numVertices);
+			std::vector<uint32> optimized = indices;
+			MeshOptimizer::optimizeVertexCache(optimized.data(), numIndices, numVertices);
+			VertexCacheStatistics after = MeshOptimizer::analyzeVertexCache(optimized.data(), numIndices, numVertices);
+
+			Assert::IsTrue(sortedTriangles(indices) == sortedTriangles(optimized), L"Triangles should only be reordered");
+			Assert::IsTrue(before.acmr > 2.0f, L"Shuffled triangles should miss the cache mostly");
+			Assert::IsTrue(after.acmr < 0.8f, L"ACMR of an optimized regular mesh should be close to 0.5 ~ 0.7");
+			Assert::IsTrue(after.atvr >= 1.0f && after.atvr < 1.5f, L"Vertices should be transformed only a few times");
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"Sphere (%u triangles): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+				numIndices / 3, before.acmr, after.acmr, before.atvr, after.atvr);
+			Logger::WriteMessage(msg);
+		}
+
+		TEST_METHOD(TestVertexFetchOptimization) {
+			// Vertex 1 is not referenced.
+			std::vector<uint32> indices = { 4, 2, 0, 0, 2, 3 };
+			std::vector<float> stream = { 0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f, 4.5f };
+			std::vector<uint32> remap;
+			const uint32 numNewVertices = MeshOptimizer::optimizeVertexFetch(indices.data(), (uint32)indices.size(), 5, remap);
+			MeshOptimizer::remapVertexStream(stream, 2, remap, numNewVertices);
+
+			Assert::AreEqual(4u, numNewVertices, L"Unreferenced vertices should be dropped");
+			Assert::IsTrue(indices == std::vector<uint32>({ 0, 1, 2, 2, 1, 3 }), L"Vertices should be numbered in the order of first use");
+			Assert::IsTrue(stream == std::vector<float>({ 4.0f, 4.5f, 2.0f, 2.5f, 0.0f, 0.5f, 3.0f, 3.5f }), L"Stream should follow the remap");
+			Assert::AreEqual(0xffffffffu, remap[1], L"Unreferenced vertex should have no new index");
+		}
+
+		TEST_METHOD(TestQuantization) {
+			std::mt19937 rng(11);
+			std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+			const vector3 boundsMin(-120.0f, -3.0f, 0.0f), boundsMax(80.0f, 5.0f, 1000.0f);
+			const vector3 size = boundsMax - boundsMin;
+
+			float maxNormalError = 0.0f;
+			for (uint32 i = 0; i < 10000; ++i) {
+				const vector3 t = 0.5f * (vector3(dist(rng), dist(rng), dist(rng)) + 1.0f);
+				const vector3 p = boundsMin + t * size;
+				uint16 q[4];
+				MeshOptimizer::quantizePosition(p, boundsMin, boundsMax, q);
+				const vector3 error = glm::abs(MeshOptimizer::dequantizePosition(q, boundsMin, boundsMax) - p);
+				for (int32 k = 0; k < 3; ++k) {
+					Assert::IsTrue(error[k] <= 0.5001f * size[k] / 65535.0f, L"Position error should be within half a step");
+				}
+
+				vector3 n(dist(rng), dist(rng), dist(rng));
+				if (glm::length(n) < 0.01f) continue;
+				n = glm::normalize(n);
+				const vector3 decoded = MeshOptimizer::decodeOctahedral(MeshOptimizer::encodeOctahedral(n));
+				maxNormalError = std::max(maxNormalError, glm::length(decoded - n));
+			}
+			Assert::IsTrue(maxNormalError < 1e-4f, L"Octahedral normals should be accurate to ~0.005 degrees");
+
+			// Axis-aligned vectors are exact, including the folded hemisphere.
+			for (const vector3& axis : { vector3(0, 0, 1), vector3(0, 0, -1), vector3(1, 0, 0), vector3(0, -1, 0) }) {
+				const vector3 decoded = MeshOptimizer::decodeOctahedral(MeshOptimizer::encodeOctahedral(axis));
+				Assert::IsTrue(glm::length(decoded - axis) < 1e-6f, L"Axis should survive octahedral encoding");
+			}
+		}
+
+		TEST_METHOD(TestMeshlets) {
+			std::vector<float> positions;
+			std::vector<uint32> indices;
+			makeShuffledSphere(32, 64, positions, indices);
+			const uint32 numVertices = (uint32)(positions.size() / 3);
+			MeshOptimizer::optimizeVertexCache(indices.data(), (uint32)indices.size(), numVertices);
+
+			constexpr uint32 maxVertices = 64, maxTriangles = 124;
+			std::vector<Meshlet> meshlets;
+			std::vector<uint32> meshletVertices;
+			std::vector<uint8> meshletTriangles;
+			const uint32 numMeshlets = MeshOptimizer::buildMeshlets(indices.data(), (uint32)indices.size(), positions.data(), numVertices,
+				maxVertices, maxTriangles, meshlets, meshletVertices, meshletTriangles);
+			Assert::AreEqual((uint32)meshlets.size(), numMeshlets, L"Wrong number of meshlets");
+
+			std::vector<uint32> reconstructed;
+			for (const Meshlet& meshlet : meshlets) {
+				Assert::IsTrue(meshlet.vertexCount <= maxVertices, L"Too many vertices in a meshlet");
+				Assert::IsTrue(meshlet.triangleCount <= maxTriangles, L"Too many triangles in a meshlet");
+				for (uint32 i = 0; i < meshlet.vertexCount; ++i) {
+					const vector3 p = getPosition(positions, meshletVertices[meshlet.vertexOffset + i]);
+					Assert::IsTrue(glm::length(p - meshlet.center) <= meshlet.radius * 1.0001f, L"Vertex outside of the bounding sphere");
+				}
+				for (uint32 i = 0; i < meshlet.triangleCount * 3; ++i) {
+					const uint8 local = meshletTriangles[meshlet.triangleOffset + i];
+					Assert::IsTrue(local < meshlet.vertexCount, L"Local index out of range");
+					reconstructed.push_back(meshletVertices[meshlet.vertexOffset + local]);
+				}
+			}
+			Assert::IsTrue(reconstructed == indices, L"Meshlets should cover the triangles in order");
+
+			// Cone culling should be conservative: a culled meshlet has no triangle facing the camera.
+			std::mt19937 rng(3);
+			std::uniform_real_distribution<float> dist(-4.0f, 4.0f);
+			uint32 numCulled = 0, numTested = 0;
+			for (uint32 trial = 0; trial < 64; ++trial) {
+				const vector3 camera(dist(rng), dist(rng), dist(rng));
+				if (glm::length(camera) < 1.5f) continue;
+				for (const Meshlet& meshlet : meshlets) {
+					numTested += 1;
+					if (!MeshOptimizer::isMeshletBackfacing(meshlet, camera)) continue;
+					numCulled += 1;
+					for (uint32 t = 0; t < meshlet.triangleCount; ++t) {
+						const uint8* tri = &meshletTriangles[meshlet.triangleOffset + t * 3];
+						const vector3 p0 = getPosition(positions, meshletVertices[meshlet.vertexOffset + tri[0]]);
+						const vector3 p1 = getPosition(positions, meshletVertices[meshlet.vertexOffset + tri[1]]);
+						const vector3 p2 = getPosition(positions, meshletVertices[meshlet.vertexOffset + tri[2]]);
+						const vector3 n = glm::cross(p1 - p0, p2 - p0);
+						Assert::IsTrue(glm::dot(n, camera - p0) <= 0.0f, L"Culled meshlet has a front-facing triangle");
+					}
+				}
+			}
+			Assert::IsTrue(numCulled > 0, L"Some meshlets on the far side should be culled");
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"%u meshlets for %u triangles, %u of %u culled by normal cones\n",
+				numMeshlets, (uint32)indices.size() / 3, numCulled, numTested);
+			Logger::WriteMessage(msg);
+		}
+
+		TEST_METHOD(ReportBundledModels) {
+			ResourceFinder::get().add("../../resources/");
+			wchar_t msg[256];
+			for (const char* model : { "render_challenge_1/spaceship.obj", "render_challenge_1/medieval_tower.obj" }) {
+				const std::string path = ResourceFinder::get().find(model);
+				tinyobj::attrib_t attrib;
+				std::vector<tinyobj::shape_t> shapes;
+				std::vector<tinyobj::material_t> materials;
+				std::string warn, err;
+				const bool bLoaded = path.size() > 0
+					&& tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), nullptr)
+					&& attrib.vertices.size() > 0;
+				if (!bLoaded) {
+					swprintf_s(msg, L"%S: not available (e.g., Git LFS content is not fetched), skipped\n", model);
+					Logger::WriteMessage(msg);
+					continue;
+				}
+
+				// Position indices per shape; the cache only sees vertex indices.
+				uint32 numTriangles = 0, numMissesBefore = 0, numMissesAfter = 0;
+				const uint32 numVertices = (uint32)(attrib.vertices.size() / 3);
+				for (const tinyobj::shape_t& shape : shapes) {
+					std::vector<uint32> indices;
+					for (const tinyobj::index_t& ix : shape.mesh.indices) {
+						indices.push_back((uint32)ix.vertex_index);
+					}
+					const uint32 numIndices = (uint32)indices.size();
+					numMissesBefore += (uint32)std::lround(MeshOptimizer::analyzeVertexCache(indices.data(), numIndices, numVertices).acmr * (numIndices / 3));
+					MeshOptimizer::optimizeVertexCache(indices.data(), numIndices, numVertices);
+					numMissesAfter += (uint32)std::lround(MeshOptimizer::analyzeVertexCache(indices.data(), numIndices, numVertices).acmr * (numIndices / 3));
+					numTriangles += numIndices / 3;
+				}
+
+				swprintf_s(msg, L"%S: %u triangles, ACMR %.3f -> %.3f, bytes/vertex float %u, packed %u, quantized %u\n",
+					model, numTriangles,
+					(float)numMissesBefore / std::max(1u, numTriangles), (float)numMissesAfter / std::max(1u, numTriangles),
+					FLOAT_VERTEX_BYTES, PACKED_VERTEX_BYTES, QUANTIZED_VERTEX_BYTES);
+				Logger::WriteMessage(msg);
+			}
+		}
+	};
+}
@@ -0,0 +1,243 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/loader/objloader.h"
+#include "pathos/loader/vertex_dedup.h"
+#include "pathos/loader/cooked_mesh.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include "tiny_obj_loader.h"
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <map>
+#include <cmath>
+#include <algorithm>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Grid of (numCells + 1)^2 vertices. Rows of cells are split into shapes, and alternate between two materials.
+	std::string makeGridOBJ(uint32 numCells, uint32 numShapes) {
+		std::ostringstream obj;
+		const uint32 numRows = numCells + 1;
+		obj << "mtllib grid.mtl\n";
+		for (uint32 y = 0; y < numRows; ++y) {
+			for (uint32 x = 0; x < numRows; ++x) {
+				obj << "v " << x << " " << y << " " << ((x * 7 + y * 13) % 5) << "\n";
+				obj << "vt " << (float)x / numCells << " " << (float)y / numCells << "\n";
+			}
+		}
+		obj << "vn 0 0 1\n";
+		const uint32 rowsPerShape = (numCells + numShapes - 1) / numShapes;
+		for (uint32 y = 0; y < numCells; ++y) {
+			if (y % rowsPerShape == 0) {
+				obj << "o shape" << (y / rowsPerShape) << "\n";
+			}
+			obj << ((y % 2 == 0) ? "usemtl even\n" : "usemtl odd\n");
+			for (uint32 x = 0; x < numCells; ++x) {
+				uint32 i0 = y * numRows + x + 1; // OBJ indices are 1-based
+				uint32 i1 = i0 + 1, i2 = i0 + numRows + 1, i3 = i0 + numRows;
+				obj << "f " << i0 << "/" << i0 << "/1 " << i1 << "/" << i1 << "/1 " << i2 << "/" << i2 << "/1\n";
+				obj << "f " << i0 << "/" << i0 << "/1 " << i2 << "/" << i2 << "/1 " << i3 << "/" << i3 << "/1\n";
+			}
+		}
+		return obj.str();
+	}
+
+	bool parseOBJ(const std::string& objText, tinyobj::attrib_t& attrib, std::vector<tinyobj::shape_t>& shapes) {
+		std::istringstream objStream(objText);
+		std::istringstream mtlStream("newmtl even\nnewmtl odd\n");
+		tinyobj::MaterialStreamReader mtlReader(mtlStream);
+		std::vector<tinyobj::material_t> materials;
+		std::string warn, err;
+		return tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, &objStream, &mtlReader);
+	}
+
+	// Deduplication before the flat table: node-based maps with an XOR-combined hash, one shape at a time.
+	struct LegacyVertex {
+		vector3 position;
+		vector2 texcoord;
+		vector3 normal;
+		bool operator==(const LegacyVertex& other) const {
+			return position == other.position && texcoord == other.texcoord && normal == other.normal;
+		}
+	};
+	struct LegacyVertexHash {
+		size_t operator()(const LegacyVertex& v) const {
+			return std::hash<vector3>()(v.position) ^ (std::hash<vector2>()(v.texcoord) << 1) ^ ((std::hash<vector3>()(v.normal) << 1) >> 1);
+		}
+	};
+	uint32 legacyReconstruct(const tinyobj::attrib_t& attrib, const std::vector<tinyobj::shape_t>& shapes) {
+		uint32 numVertices = 0;
+		for (const tinyobj::shape_t& shape : shapes) {
+			std::map<int32, std::unordered_map<LegacyVertex, uint32, LegacyVertexHash>> uniqueVertices;
+			std::map<int32, std::vector<float>> positions;
+			std::map<int32, std::vector<uint32>> indices;
+			for (size_t f = 0; f < shape.mesh.num_face_vertices.size(); ++f) {
+				const int32 materialID = shape.mesh.material_ids[f];
+				for (uint32 v = 0; v < 3; ++v) {
+					const tinyobj::index_t idx = shape.mesh.indices[f * 3 + v];
+					LegacyVertex vertex;
+					vertex.position = vector3(attrib.vertices[3 * idx.vertex_index], attrib.vertices[3 * idx.vertex_index + 1], attrib.vertices[3 * idx.vertex_index + 2]);
+					vertex.texcoord = vector2(attrib.texcoords[2 * idx.texcoord_index], attrib.texcoords[2 * idx.texcoord_index + 1]);
+					vertex.normal = vector3(attrib.normals[3 * idx.normal_index], attrib.normals[3 * idx.normal_index + 1], attrib.normals[3 * idx.normal_index + 2]);
+					if (uniqueVertices[materialID].count(vertex) == 0) {
+						uniqueVertices[materialID][vertex] = (uint32)(positions[materialID].size() / 3);
+						positions[materialID].insert(positions[materialID].end(), { vertex.position.x, vertex.position.y, vertex.position.z });
+					}
+					indices[materialID].push_back(uniqueVertices[materialID][vertex]);
+				}
+			}
+			for (const auto& it : positions) {
+				numVertices += (uint32)(it.second.size() / 3);
+			}
+		}
+		return numVertices;
+	}
+
+	uint32 countVertices(const CookedMesh& cooked) {
+		uint32 numVertices = 0;
+		for (uint32 shapeIx = 0; shapeIx < cooked.getNumShapes(); ++shapeIx) {
+			const CookedMeshShape& shape = cooked.getShape(shapeIx);
+			for (uint32 i = 0; i < shape.numSections; ++i) {
+				numVertices += cooked.getSection(shape.firstSection + i).numVertices;
+			}
+		}
+		return numVertices;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestOBJReconstruction) {
+	public:
+		TEST_METHOD(TestVertexDedupTable) {
+			VertexDedupTable table;
+			table.reset(1000);
+
+			MetaVertex a{ vector3(1.0f, 2.0f, 3.0f), vector2(0.5f, 0.5f), vector3(0.0f, 0.0f, 1.0f) };
+			MetaVertex b = a;
+			b.texcoord.y = std::nextafter(b.texcoord.y, 1.0f);
+
+			Assert::AreEqual(0u, table.findOrAdd(a), L"First vertex should get index 0");
+			Assert::AreEqual(1u, table.findOrAdd(b), L"Vertices that differ in one bit should be distinct");
+			Assert::AreEqual(0u, table.findOrAdd(a), L"Duplicate should return the existing index");
+			Assert::AreEqual(1u, table.findOrAdd(b), L"Duplicate should return the existing index");
+			Assert::AreEqual(2u, table.getNumVertices(), L"Wrong number of unique vertices");
+
+			// Fill up to the limit; indices follow insertion order.
+			for (uint32 i = 2; i < 1000; ++i) {
+				MetaVertex v{ vector3((float)i, 0.0f, 0.0f), vector2(0.0f), vector3(0.0f) };
+				Assert::AreEqual(i, table.findOrAdd(v), L"Wrong index for a new vertex");
+			}
+			for (uint32 i = 2; i < 1000; i += 37) {
+				MetaVertex v{ vector3((float)i, 0.0f, 0.0f), vector2(0.0f), vector3(0.0f) };
+				Assert::AreEqual(i, table.findOrAdd(v), L"Vertex should be found after many insertions");
+			}
+
+			// Nearby grid positions are the worst case for a weak hash.
+			std::vector<uint32> slotHits(1024, 0);
+			for (uint32 y = 0; y < 64; ++y) {
+				for (uint32 x = 0; x < 64; ++x) {
+					MetaVertex v{ vector3((float)x, (float)y, 0.0f), vector2(0.0f), vector3(0.0f, 0.0f, 1.0f) };
+					slotHits[VertexDedupTable::hashVertex(v) & 1023] += 1;
+				}
+			}
+			uint32 maxHits = 0;
+			for (uint32 hits : slotHits) maxHits = std::max(maxHits, hits);
+			Assert::IsTrue(maxHits <= 16, L"Hash of grid vertices is poorly distributed");
+		}
+
+		TEST_METHOD(TestReconstructShapes) {
+			tinyobj::attrib_t attrib;
+			std::vector<tinyobj::shape_t> shapes;
+			Assert::IsTrue(parseOBJ(makeGridOBJ(64, 4), attrib, shapes), L"Failed to parse the test OBJ");
+			Assert::AreEqual((size_t)4, shapes.size(), L"Wrong number of shapes");
+
+			std::vector<uint8> serialData, parallelData;
+			{
+				CookedMeshWriter writer;
+				OBJLoader::reconstructShapes(attrib, shapes, nullptr, writer);
+				writer.finalize(1, serialData);
+			}
+			{
+				JobSystem jobSystem;
+				jobSystem.start(4);
+				CookedMeshWriter writer;
+				OBJLoader::reconstructShapes(attrib, shapes, &jobSystem, writer);
+				writer.finalize(1, parallelData);
+				jobSystem.stop();
+			}
+			Assert::IsTrue(serialData == parallelData, L"Parallel reconstruction should be deterministic");
+
+			CookedMesh cooked;
+			Assert::IsTrue(cooked.initialize(serialData.data(), serialData.size(), 1), L"Invalid cooked data");
+			Assert::AreEqual(4u, cooked.getNumShapes(), L"Wrong number of shapes");
+			for (uint32 shapeIx = 0; shapeIx < cooked.getNumShapes(); ++shapeIx) {
+				const CookedMeshShape& shape = cooked.getShape(shapeIx);
+				Assert::AreEqual(2u, shape.numSections, L"Each shape should have a section per material");
+				const CookedMeshSection& even = cooked.getSection(shape.firstSection);
+				const CookedMeshSection& odd = cooked.getSection(shape.firstSection + 1);
+				Assert::AreEqual(0, even.materialID, L"Sections should be sorted by material ID");
+				Assert::AreEqual(1, odd.materialID, L"Sections should be sorted by material ID");
+				// 8 rows of 64 cells per material: each row has its own 2 * 65 vertices.
+				Assert::AreEqual(8u * 64u * 6u, even.numIndices, L"Wrong number of indices");
+				Assert::AreEqual(8u * 2u * 65u, even.numVertices, L"Vertices should be deduplicated");
+				Assert::IsTrue(cooked.getNormals(even) != nullptr, L"Normals should be kept");
+				for (uint32 i = 0; i < even.numIndices; ++i) {
+					Assert::IsTrue(cooked.getIndex(even, i) < even.numVertices, L"Index out of range");
+				}
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkReconstructShapes)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkReconstructShapes) {
+			// 2M triangles
+			tinyobj::attrib_t attrib;
+			std::vector<tinyobj::shape_t> shapes;
+			Assert::IsTrue(parseOBJ(makeGridOBJ(1000, 8), attrib, shapes), L"Failed to parse the test OBJ");
+
+			Stopwatch stopwatch;
+			const uint32 legacyVertices = legacyReconstruct(attrib, shapes);
+			const float legacyMs = stopwatch.stop();
+
+			std::vector<uint8> cookedData;
+			stopwatch.start();
+			{
+				CookedMeshWriter writer;
+				OBJLoader::reconstructShapes(attrib, shapes, nullptr, writer);
+				writer.finalize(1, cookedData);
+			}
+			const float serialMs = stopwatch.stop();
+
+			const uint32 numThreads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			JobSystem jobSystem;
+			jobSystem.start(numThreads);
+			stopwatch.start();
+			{
+				CookedMeshWriter writer;
+				OBJLoader::reconstructShapes(attrib, shapes, &jobSystem, writer);
+				writer.finalize(1, cookedData);
+			}
+			const float parallelMs = stopwatch.stop();
+			jobSystem.stop();
+
+			CookedMesh cooked;
+			Assert::IsTrue(cooked.initialize(cookedData.data(), cookedData.size(), 1), L"Invalid cooked data");
+			Assert::AreEqual(legacyVertices, countVertices(cooked), L"Should produce the same vertices as before");
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"2M triangles: legacy %.2f ms, flat table %.2f ms, flat table + %u workers %.2f ms\n",
+				legacyMs, serialMs, numThreads, parallelMs);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
@@ -0,0 +1,302 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/overlay/display_object.h"
+#include "pathos/overlay/display_object_proxy.h"
+#include "pathos/overlay/rectangle.h"
+#include "pathos/overlay/brush.h"
+#include "pathos/render/overlay/overlay_batcher.h"
+#include "pathos/rhi/texture.h"
+
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <memory>
+#include <random>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Textures are only used as batch keys, so no GL resources are created.
+	TextureCreateParams makeTextureParams(const char* debugName) {
+		TextureCreateParams params{ 64, 64, 1, 1, GL_TEXTURE_2D, GL_RGBA8 };
+		params.debugName = debugName;
+		return params;
+	}
+
+	uint32 countDrawCalls(const OverlayDrawList& drawList, OverlayBatcher& batcher) {
+		batcher.clear();
+		for (const OverlayDrawItem& item : drawList.items) {
+			batcher.addItem(item);
+		}
+		batcher.finalize();
+		return (uint32)batcher.getBatches().size();
+	}
+
+	bool rectsOverlap(const vector4& a, const vector4& b) {
+		return a.x < b.z && b.x < a.z && a.y < b.w && b.y < a.w;
+	}
+
+	// Panel with a grid of slots, each made of a solid color background and an icon.
+	// Icons alternate between two textures like in an inventory screen.
+	struct TestHud {
+		TestHud(uint32 numColumns, uint32 numRows)
+			: textureA(makeTextureParams("iconA"))
+			, textureB(makeTextureParams("iconB"))
+			, panelBrush(0.1f, 0.1f, 0.1f, 0.8f)
+			, slotBrush(0.3f, 0.3f, 0.3f)
+			, iconBrushA(&textureA)
+			, iconBrushB(&textureB)
+		{
+			root.reset(DisplayObject2D::createRoot());
+			panel = std::make_unique<Rectangle>(numColumns * 40.0f + 8.0f, numRows * 40.0f + 8.0f);
+			panel->setBrush(&panelBrush);
+			root->addChild(panel.get());
+			for (uint32 row = 0; row < numRows; ++row) {
+				for (uint32 column = 0; column < numColumns; ++column) {
+					auto slot = std::make_unique<Rectangle>(36.0f, 36.0f);
+					slot->setXY(8.0f + column * 40.0f, 8.0f + row * 40.0f);
+					slot->setBrush(&slotBrush);
+					auto icon = std::make_unique<Rectangle>(32.0f, 32.0f);
+					icon->setXY(2.0f, 2.0f);
+					icon->setBrush(((row + column) % 2 == 0) ? &iconBrushA : &iconBrushB);
+					slot->addChild(icon.get());
+					panel->addChild(slot.get());
+					slots.emplace_back(std::move(slot));
+					icons.emplace_back(std::move(icon));
+				}
+			}
+		}
+
+		Texture textureA;
+		Texture textureB;
+		SolidColorBrush panelBrush;
+		SolidColorBrush slotBrush;
+		ImageBrush iconBrushA;
+		ImageBrush iconBrushB;
+
+		std::unique_ptr<DisplayObject2D> root;
+		std::unique_ptr<Rectangle> panel;
+		std::vector<std::unique_ptr<Rectangle>> slots;
+		std::vector<std::unique_ptr<Rectangle>> icons;
+	};
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestOverlay)
+	{
+	public:
+		TEST_METHOD(TestRetainedProxies)
+		{
+			SolidColorBrush panelBrush(0.1f, 0.1f, 0.1f);
+			SolidColorBrush buttonBrush(1.0f, 0.0f, 0.0f);
+			Texture texture(makeTextureParams("image"));
+			ImageBrush imageBrush(&texture);
+
+			std::unique_ptr<DisplayObject2D> root(DisplayObject2D::createRoot());
+			Rectangle panel(400.0f, 300.0f);
+			Rectangle button(20.0f, 10.0f);
+			Rectangle image(16.0f, 16.0f);
+			Rectangle popup(100.0f, 50.0f);
+			panel.setXY(100.0f, 50.0f);
+			panel.setBrush(&panelBrush);
+			button.setXY(5.0f, 5.0f);
+			button.setBrush(&buttonBrush);
+			image.setXY(30.0f, 5.0f);
+			image.setBrush(&imageBrush);
+			popup.setBrush(&panelBrush);
+			popup.setVisible(false);
+			root->addChild(&panel);
+			panel.addChild(&button);
+			panel.addChild(&image);
+			root->addChild(&popup);
+
+			OverlayDrawList drawList;
+			OverlayProxyStats stats;
+
+			Assert::IsTrue(DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats), L"Root is visible");
+			Assert::AreEqual(4u, stats.numVisited, L"Hidden popup is not visited");
+			Assert::AreEqual(4u, stats.numRebuilt, L"Every visible object is built at first");
+			Assert::AreEqual(3u, stats.numItems, L"Root has nothing to draw");
+			Assert::AreEqual(105.0f, drawList.items[1].transform.offset.x, 0.0001f, L"Button is relative to the panel");
+			Assert::AreEqual(55.0f, drawList.items[1].transform.offset.y, 0.0001f, L"Button is relative to the panel");
+			Assert::AreEqual(20.0f, drawList.items[1].transform.scale.x, 0.0001f, L"Button width");
+			Assert::IsTrue(drawList.items[2].type == EOverlayItemType::Image && drawList.items[2].texture == &texture, L"Image item");
+
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(0u, stats.numRebuilt, L"Nothing changed");
+			Assert::AreEqual(3u, stats.numItems, L"Clean proxies are still drawn");
+
+			panel.setXY(200.0f, 50.0f);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(1u, stats.numRebuilt, L"Children of a moved object are not rebuilt");
+			Assert::AreEqual(205.0f, drawList.items[1].transform.offset.x, 0.0001f, L"Button follows the panel");
+
+			panel.setXY(200.0f, 50.0f);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(0u, stats.numRebuilt, L"Setting the same position is not a change");
+
+			panel.setScaleXY(2.0f, 2.0f);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(1u, stats.numRebuilt, L"Only the panel is rescaled");
+			Assert::AreEqual(410.0f, drawList.items[1].transform.offset.x, 0.0001f, L"Parent scale applies to child position");
+			Assert::AreEqual(110.0f, drawList.items[1].transform.offset.y, 0.0001f, L"Parent scale applies to child position");
+			Assert::AreEqual(40.0f, drawList.items[1].transform.scale.x, 0.0001f, L"Parent scale applies to child size");
+
+			buttonBrush.setColor(0.0f, 1.0f, 0.0f);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(1u, stats.numRebuilt, L"Users of a modified brush are rebuilt");
+			Assert::AreEqual(1.0f, drawList.items[1].color.y, 0.0001f, L"New brush color");
+
+			panelBrush.setColor(0.2f, 0.2f, 0.2f);
+			popup.setVisible(true);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(2u, stats.numRebuilt, L"Panel and popup share the modified brush");
+			Assert::AreEqual(4u, stats.numItems, L"Popup is shown");
+
+			panel.setVisible(false);
+			button.setSize(30.0f, 10.0f);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(2u, stats.numVisited, L"Subtree of the hidden panel is skipped");
+			Assert::AreEqual(1u, stats.numItems, L"Only the popup is drawn");
+
+			panel.setVisible(true);
+			DisplayObject2D::updateRenderProxyHierarchy(root.get(), drawList, &stats);
+			Assert::AreEqual(2u, stats.numRebuilt, L"Panel and the button resized while hidden");
+			Assert::AreEqual(60.0f, drawList.items[1].transform.scale.x, 0.0001f, L"Button size changed while hidden");
+		}
+
+		TEST_METHOD(TestBatchingPreservesOrder)
+		{
+			Texture textureA(makeTextureParams("A"));
+			Texture textureB(makeTextureParams("B"));
+			Texture textureC(makeTextureParams("C"));
+			Texture* textures[4] = { nullptr, &textureA, &textureB, &textureC };
+
+			// Quads that don't overlap are merged by texture.
+			{
+				OverlayBatcher batcher;
+				for (uint32 i = 0; i < 100; ++i) {
+					OverlayQuad quad{};
+					quad.rect = vector4(i * 10.0f, 0.0f, i * 10.0f + 10.0f, 10.0f);
+					batcher.addQuad(quad, (i % 2 == 0) ? &textureA : &textureB);
+				}
+				batcher.finalize();
+				Assert::AreEqual((size_t)2, batcher.getBatches().size(), L"One batch per texture");
+			}
+			// Overlapping quads can't be reordered.
+			{
+				OverlayBatcher batcher;
+				for (uint32 i = 0; i < 4; ++i) {
+					OverlayQuad quad{};
+					quad.rect = vector4(0.0f, 0.0f, 10.0f, 10.0f);
+					batcher.addQuad(quad, (i % 2 == 0) ? &textureA : &textureB);
+				}
+				batcher.finalize();
+				Assert::AreEqual((size_t)4, batcher.getBatches().size(), L"Stacked quads alternating textures");
+			}
+
+			// Random quads. color.x is the submission index and color.y is the texture index.
+			std::mt19937 rng(1234);
+			std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+			std::uniform_real_distribution<float> size(5.0f, 80.0f);
+			std::uniform_int_distribution<uint32> textureIndex(0, 3);
+
+			const uint32 numQuads = 2000;
+			std::vector<OverlayQuad> quads(numQuads);
+			OverlayBatcher batcher;
+			for (uint32 i = 0; i < numQuads; ++i) {
+				const float x = position(rng), y = position(rng);
+				const uint32 tex = textureIndex(rng);
+				quads[i].rect = vector4(x, y, x + size(rng), y + size(rng));
+				quads[i].color = vector4((float)i, (float)tex, 0.0f, 1.0f);
+				batcher.addQuad(quads[i], textures[tex]);
+			}
+			batcher.finalize();
+
+			const std::vector<OverlayQuad>& sortedQuads = batcher.getQuads();
+			const std::vector<OverlayBatch>& batches = batcher.getBatches();
+			Assert::AreEqual((size_t)numQuads, sortedQuads.size(), L"Every quad is drawn once");
+			Assert::IsTrue(batches.size() < numQuads / 2, L"Quads are merged");
+
+			std::vector<uint32> drawOrder(numQuads, 0xffffffff);
+			for (const OverlayBatch& batch : batches) {
+				for (uint32 i = batch.firstQuad; i < batch.firstQuad + batch.numQuads; ++i) {
+					const uint32 tex = (uint32)sortedQuads[i].color.y;
+					Assert::IsTrue(tex == 0 || textures[tex] == batch.texture, L"Textured quad is drawn with its texture");
+					drawOrder[(uint32)sortedQuads[i].color.x] = i;
+				}
+			}
+			for (uint32 i = 0; i < numQuads; ++i) {
+				Assert::IsTrue(drawOrder[i] != 0xffffffff, L"Quad is drawn");
+				for (uint32 j = i + 1; j < numQuads; ++j) {
+					if (rectsOverlap(quads[i].rect, quads[j].rect)) {
+						Assert::IsTrue(drawOrder[i] < drawOrder[j], L"Overlapping quads are drawn in submission order");
+					}
+				}
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkStaticVsAnimatedHud)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkStaticVsAnimatedHud)
+		{
+			TestHud hud(20, 20);
+			const uint32 numObjects = 1 + (uint32)(hud.slots.size() + hud.icons.size());
+			const uint32 numFrames = 200;
+
+			OverlayDrawList drawList;
+			OverlayProxyStats stats;
+			OverlayBatcher batcher;
+			DisplayObject2D::updateRenderProxyHierarchy(hud.root.get(), drawList, &stats);
+			Assert::AreEqual(numObjects + 1, stats.numRebuilt, L"First frame builds every proxy");
+			const uint32 numItems = stats.numItems;
+
+			// Static HUD: nothing changes after the first frame.
+			uint32 staticRebuilt = 0;
+			uint32 staticDrawCalls = 0;
+			Stopwatch stopwatch;
+			for (uint32 frame = 0; frame < numFrames; ++frame) {
+				DisplayObject2D::updateRenderProxyHierarchy(hud.root.get(), drawList, &stats);
+				staticRebuilt += stats.numRebuilt;
+				staticDrawCalls += countDrawCalls(drawList, batcher);
+			}
+			const float staticMs = stopwatch.stop() / numFrames;
+
+			// Animated HUD: every tenth icon bounces.
+			uint32 animatedRebuilt = 0;
+			uint32 animatedDrawCalls = 0;
+			uint32 numAnimated = 0;
+			stopwatch.start();
+			for (uint32 frame = 0; frame < numFrames; ++frame) {
+				numAnimated = 0;
+				for (size_t i = 0; i < hud.icons.size(); i += 10) {
+					hud.icons[i]->setY((frame % 2 == 0) ? 3.0f : 1.0f);
+					++numAnimated;
+				}
+				DisplayObject2D::updateRenderProxyHierarchy(hud.root.get(), drawList, &stats);
+				animatedRebuilt += stats.numRebuilt;
+				animatedDrawCalls += countDrawCalls(drawList, batcher);
+			}
+			const float animatedMs = stopwatch.stop() / numFrames;
+
+			Assert::AreEqual(0u, staticRebuilt, L"Static HUD never rebuilds proxies");
+			Assert::AreEqual(numAnimated * numFrames, animatedRebuilt, L"Only animated icons are rebuilt");
+			Assert::IsTrue(staticDrawCalls <= 3 * numFrames, L"Slots and icons are merged into a few batches");
+
+			wchar_t msg[512];
+			swprintf_s(msg, L"HUD: %u objects, %u items (previously one draw call per item)\n", numObjects, numItems);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  static:   %.2f proxies rebuilt/frame, %.2f draw calls/frame, %.3f ms/frame\n",
+				(float)staticRebuilt / numFrames, (float)staticDrawCalls / numFrames, staticMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  animated: %.2f proxies rebuilt/frame, %.2f draw calls/frame, %.3f ms/frame\n",
+				(float)animatedRebuilt / numFrames, (float)animatedDrawCalls / numFrames, animatedMs);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
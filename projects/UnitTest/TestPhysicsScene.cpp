@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/physics/physics_scene.h"
+#include "badger/physics/shape.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <memory>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace badger::physics;
+
+namespace {
+	constexpr float GROUND_TOP = 0.0f;
+
+	// Shapes are owned by the caller of PhysicsScene::setShape().
+	struct TestShapes {
+		TestShapes()
+			: sphere(0.5f)
+			, box(vector3(1.0f))
+			, ground(vector3(2000.0f, 2.0f, 2000.0f))
+		{}
+		ShapeSphere sphere;
+		ShapeBox box;
+		ShapeBox ground;
+	};
+
+	BodyHandle addGround(PhysicsScene& scene, TestShapes& shapes) {
+		BodyHandle ground = scene.allocateBody();
+		scene.setShape(ground, &shapes.ground);
+		scene.setPosition(ground, vector3(0.0f, GROUND_TOP - 1.0f, 0.0f));
+		scene.setInvMass(ground, 0.0f);
+		scene.setElasticity(ground, 0.5f);
+		scene.setFriction(ground, 0.5f);
+		return ground;
+	}
+
+	// Drop spheres and boxes from a grid of columns, alternating shapes.
+	void dropBodies(PhysicsScene& scene, TestShapes& shapes, uint32 numBodies, std::vector<BodyHandle>& outHandles) {
+		const uint32 columns = 50;
+		for (uint32 i = 0; i < numBodies; ++i) {
+			const uint32 layer = i / (columns * columns);
+			const uint32 x = i % columns;
+			const uint32 z = (i / columns) % columns;
+
+			BodyHandle body = scene.allocateBody();
+			scene.setShape(body, (i % 2 == 0) ? (Shape*)&shapes.sphere : (Shape*)&shapes.box);
+			scene.setPosition(body, vector3(3.0f * x, 2.0f + 3.0f * layer, 3.0f * z));
+			scene.setInvMass(body, 1.0f);
+			scene.setElasticity(body, 0.5f);
+			scene.setFriction(body, 0.5f);
+			outHandles.push_back(body);
+		}
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestPhysicsScene) {
+	public:
+		TEST_METHOD(TestBodyHandles) {
+			TestShapes shapes;
+			PhysicsScene scene;
+			scene.initialize();
+
+			BodyHandle handles[3];
+			for (uint32 i = 0; i < 3; ++i) {
+				handles[i] = scene.allocateBody();
+				scene.setShape(handles[i], &shapes.sphere);
+				scene.setPosition(handles[i], vector3((float)i, 0.0f, 0.0f));
+			}
+			scene.releaseBody(handles[0]);
+
+			Assert::AreEqual(2u, scene.getNumBodies(), L"Released body is still alive");
+			Assert::IsTrue(scene.getPosition(handles[1]) == vector3(1.0f, 0.0f, 0.0f), L"Handle should survive release of other bodies");
+			Assert::IsTrue(scene.getPosition(handles[2]) == vector3(2.0f, 0.0f, 0.0f), L"Handle should survive release of other bodies");
+
+			BodyHandle recycled = scene.allocateBody();
+			scene.setShape(recycled, &shapes.sphere);
+			Assert::AreEqual(handles[0], recycled, L"Released handles should be recycled");
+			Assert::IsTrue(scene.getPosition(handles[2]) == vector3(2.0f, 0.0f, 0.0f), L"Handle should survive allocation of other bodies");
+		}
+
+		TEST_METHOD(TestBodiesLandOnGround) {
+			TestShapes shapes;
+			PhysicsScene scene;
+			scene.initialize();
+			addGround(scene, shapes);
+
+			std::vector<BodyHandle> bodies;
+			dropBodies(scene, shapes, 20, bodies);
+			for (int32 frame = 0; frame < 180; ++frame) {
+				scene.update(1.0f / 60.0f);
+			}
+
+			bool bAboveGround = true, bLanded = true;
+			for (BodyHandle body : bodies) {
+				float y = scene.getCenterOfMassWorldSpace(body).y;
+				bAboveGround = bAboveGround && (y > GROUND_TOP);
+				bLanded = bLanded && (y < GROUND_TOP + 1.5f);
+			}
+			Assert::IsTrue(bAboveGround, L"Bodies fell through the ground");
+			Assert::IsTrue(bLanded, L"Bodies should land on the ground");
+		}
+
+		TEST_METHOD(TestParallelMatchesSerial) {
+			constexpr uint32 NUM_BODIES = 500;
+			TestShapes shapes;
+
+			JobSystem jobSystem;
+			jobSystem.start(4);
+
+			PhysicsScene serialScene, parallelScene;
+			serialScene.initialize(nullptr);
+			parallelScene.initialize(&jobSystem);
+			std::vector<BodyHandle> serialBodies, parallelBodies;
+			addGround(serialScene, shapes);
+			addGround(parallelScene, shapes);
+			dropBodies(serialScene, shapes, NUM_BODIES, serialBodies);
+			dropBodies(parallelScene, shapes, NUM_BODIES, parallelBodies);
+
+			for (int32 frame = 0; frame < 60; ++frame) {
+				serialScene.update(1.0f / 60.0f);
+				parallelScene.update(1.0f / 60.0f);
+			}
+			jobSystem.stop();
+
+			bool bSame = true;
+			for (uint32 i = 0; i < NUM_BODIES; ++i) {
+				bSame = bSame && (serialScene.getPosition(serialBodies[i]) == parallelScene.getPosition(parallelBodies[i]));
+			}
+			Assert::IsTrue(serialScene.getNumContacts() > 0, L"Bodies should touch the ground");
+			Assert::IsTrue(bSame, L"Parallel update should be deterministic");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkPhysicsScene)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Average step time while bodies fall and land on the ground.
+		TEST_METHOD(BenchmarkPhysicsScene) {
+			constexpr int32 NUM_FRAMES = 60;
+			const uint32 bodyCounts[] = { 1000, 5000, 10000, 20000 };
+			const uint32 numWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			wchar_t msg[256];
+
+			JobSystem jobSystem;
+			jobSystem.start(numWorkers);
+
+			for (uint32 numBodies : bodyCounts) {
+				float elapsed[2] = { 0.0f, 0.0f };
+				uint32 numContacts = 0, numIslands = 0;
+				for (int32 mode = 0; mode < 2; ++mode) {
+					TestShapes shapes;
+					PhysicsScene scene;
+					scene.initialize(mode == 0 ? nullptr : &jobSystem);
+					std::vector<BodyHandle> bodies;
+					addGround(scene, shapes);
+					dropBodies(scene, shapes, numBodies, bodies);
+
+					Stopwatch stopwatch;
+					for (int32 frame = 0; frame < NUM_FRAMES; ++frame) {
+						scene.update(1.0f / 60.0f);
+					}
+					elapsed[mode] = stopwatch.stop() / NUM_FRAMES;
+					numContacts = scene.getNumContacts();
+					numIslands = scene.getNumIslands();
+				}
+
+				swprintf_s(msg, L"bodies=%6u contacts=%6u islands=%6u step: serial=%8.3f ms parallel(%u workers)=%8.3f ms\n",
+					numBodies, numContacts, numIslands, elapsed[0], numWorkers, elapsed[1]);
+				Logger::WriteMessage(msg);
+			}
+
+			jobSystem.stop();
+		}
+	};
+}
@@ -0,0 +1,282 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/rhi/render_command_list.h"
+#include "pathos/rhi/render_state_cache.h"
+#include "pathos/rhi/recording_gl.h"
+#include "pathos/console.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	uint32 gNumStubCalls = 0;
+	std::vector<GLint> gExecutedLocations;
+
+	void APIENTRY stubExecute(const RenderCommandBase* __restrict params) {
+		++gNumStubCalls;
+	}
+	void APIENTRY stubExecuteUniform1i(const RenderCommandBase* __restrict params) {
+		gExecutedLocations.push_back(((const RenderCommand_uniform1i*)params)->location);
+	}
+
+	// Replace GL calls with stubs so that the list can be executed without a GL context.
+	// Packets that are not GL calls (e.g., splicing secondary lists) are kept as is.
+	void installStubs(RenderCommandList& cmdList) {
+		cmdList.forEachPacket([](const RenderCommandBase* packet) {
+			RenderCommandBase* mutablePacket = const_cast<RenderCommandBase*>(packet);
+			if (packet->pfn_execute == PFN_EXECUTE(RenderCommand_uniform1i::execute)) {
+				mutablePacket->pfn_execute = stubExecuteUniform1i;
+			} else if (packet->pfn_execute == PFN_EXECUTE(RenderCommand_cullFace::execute)
+				|| packet->pfn_execute == PFN_EXECUTE(RenderCommand_bindBufferBase::execute)
+				|| packet->pfn_execute == PFN_EXECUTE(RenderCommand_drawElements::execute)) {
+				mutablePacket->pfn_execute = stubExecute;
+			}
+		});
+	}
+
+	uint32 getNumGLCalls(const RecordingGLFrame& frame, const char* functionName) {
+		for (uint32 i = 0; i < getNumRecordingGLFunctions(); ++i) {
+			if (0 == strcmp(getRecordingGLFunctionName(i), functionName)) {
+				return frame.callCounts[i];
+			}
+		}
+		return 0;
+	}
+
+	void setEliminateRedundantState(bool bEnable) {
+		auto cvar = static_cast<ConsoleVariable<int32>*>(ConsoleVariableManager::get().find("r.eliminateRedundantState"));
+		cvar->setValue(bEnable ? 1 : 0);
+	}
+
+	// Typical per-draw pattern of mesh passes: most states are the same as the previous draw.
+	void recordRedundantDraws(RenderCommandList& cmdList, uint32 numDraws) {
+		for (uint32 i = 0; i < numDraws; ++i) {
+			cmdList.useProgram(1 + (i / 64));
+			cmdList.bindVertexArray(1);
+			cmdList.enable(GL_DEPTH_TEST);
+			cmdList.depthFunc(GL_GREATER);
+			cmdList.bindBufferBase(GL_UNIFORM_BUFFER, 0, 1);
+			cmdList.bindBufferBase(GL_UNIFORM_BUFFER, 1, 2 + (i % 2));
+			cmdList.bindTextureUnit(0, 1 + (i / 16));
+			cmdList.drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+		}
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestRenderCommandList) {
+	public:
+		TEST_METHOD(TestVariableSizePackets) {
+			RenderCommandList cmdList("TestVariableSizePackets", 1024 * 1024, 1024 * 1024);
+			cmdList.cullFace(GL_BACK);
+			cmdList.drawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, nullptr);
+
+			Assert::AreEqual(2u, cmdList.getNumCommands(), L"Number of commands is invalid");
+			Assert::IsTrue(cmdList.getUsedCommandBytes() < 2 * 64, L"Small commands should take only their own size");
+
+			uint32 numVisited = 0;
+			cmdList.forEachPacket([&numVisited](const RenderCommandBase* packet) {
+				Assert::IsTrue(packet->packetBytes % 8 == 0, L"Packets should be 8-byte aligned");
+				++numVisited;
+			});
+			Assert::AreEqual(2u, numVisited, L"forEachPacket should visit every packet");
+		}
+
+		TEST_METHOD(TestSecondaryCommandLists) {
+			constexpr uint32 NUM_SECONDARY = 8;
+			constexpr uint32 COMMANDS_PER_LIST = 100;
+
+			JobSystem jobSystem;
+			jobSystem.start(4);
+
+			std::vector<RenderCommandList*> secondaries;
+			for (uint32 i = 0; i < NUM_SECONDARY; ++i) {
+				secondaries.push_back(new RenderCommandList("Secondary", 1024 * 1024, 1024 * 1024));
+			}
+			RenderCommandList primary("Primary", 1024 * 1024, 1024 * 1024);
+			primary.uniform1i(-1, 0);
+			primary.recordSecondaryCommandLists(&jobSystem, secondaries.data(), NUM_SECONDARY,
+				[](RenderCommandList& cmdList, uint32 index) {
+					for (uint32 i = 0; i < COMMANDS_PER_LIST; ++i) {
+						cmdList.uniform1i((GLint)(index * COMMANDS_PER_LIST + i), 0);
+					}
+				}
+			);
+			primary.uniform1i((GLint)(NUM_SECONDARY * COMMANDS_PER_LIST), 0);
+
+			jobSystem.stop();
+
+			Assert::AreEqual(NUM_SECONDARY * COMMANDS_PER_LIST + 2, primary.getNumCommands(), L"Primary should count spliced commands");
+
+			installStubs(primary);
+			for (RenderCommandList* secondary : secondaries) {
+				installStubs(*secondary);
+			}
+
+			gExecutedLocations.clear();
+			primary.executeAllCommands();
+
+			// Expected order: -1, 0, 1, ..., NUM_SECONDARY * COMMANDS_PER_LIST
+			bool bOrdered = true;
+			for (size_t i = 0; i < gExecutedLocations.size(); ++i) {
+				bOrdered = bOrdered && (gExecutedLocations[i] == (GLint)i - 1);
+			}
+			Assert::AreEqual((size_t)(NUM_SECONDARY * COMMANDS_PER_LIST + 2), gExecutedLocations.size(), L"Some secondary commands are missing");
+			Assert::IsTrue(bOrdered, L"Secondary command lists should be spliced in index order");
+
+			for (RenderCommandList* secondary : secondaries) {
+				delete secondary;
+			}
+		}
+
+		TEST_METHOD(TestSecondaryCommandListRecordedAfterAppend) {
+			RenderCommandList secondary("Secondary", 1024 * 1024, 1024 * 1024);
+			RenderCommandList primary("Primary", 1024 * 1024, 1024 * 1024);
+			primary.uniform1i(0, 0);
+			primary.appendSecondaryCommandList(&secondary);
+			Assert::AreEqual(1u, primary.getNumCommands(), L"Empty secondary list should add no commands");
+
+			// Recorded after being spliced.
+			secondary.uniform1i(1, 0);
+			secondary.uniform1i(2, 0);
+			Assert::AreEqual(3u, primary.getNumCommands(), L"Primary should count commands recorded after the splice");
+
+			installStubs(primary);
+			installStubs(secondary);
+			gExecutedLocations.clear();
+			primary.executeAllCommands();
+			Assert::AreEqual((size_t)3, gExecutedLocations.size(), L"Commands recorded after the splice should be executed");
+
+			primary.clearAllCommands();
+			Assert::IsTrue(primary.isEmpty(), L"Clearing should forget spliced lists");
+		}
+
+		TEST_METHOD(TestRedundantStateElimination) {
+			installRecordingGL();
+			setEliminateRedundantState(true);
+
+			RenderCommandList cmdList("TestRedundantStateElimination", 1024 * 1024, 1024 * 1024);
+			for (uint32 i = 0; i < 2; ++i) {
+				cmdList.useProgram(1);
+				cmdList.bindVertexArray(2);
+				cmdList.enable(GL_DEPTH_TEST);
+				cmdList.bindBufferBase(GL_UNIFORM_BUFFER, 0, 5);
+				cmdList.bindTextureUnit(0, 7);
+				cmdList.drawArrays(GL_TRIANGLES, 0, 3);
+			}
+			cmdList.disable(GL_DEPTH_TEST);
+			cmdList.bindBuffer(GL_UNIFORM_BUFFER, 6);
+			cmdList.bindBufferBase(GL_UNIFORM_BUFFER, 0, 5); // Generic binding was changed
+			cmdList.deleteProgram(1);
+			cmdList.useProgram(1); // Name might be reused
+
+			presentRecordingGLFrame(); // Discard previous calls.
+			const uint32 numEliminatedBefore = RenderStateCache::get().getNumEliminatedCommands();
+			cmdList.flushAllCommands();
+			const uint32 numEliminated = RenderStateCache::get().getNumEliminatedCommands() - numEliminatedBefore;
+			presentRecordingGLFrame();
+
+			RecordingGLFrame frame;
+			getLastRecordingGLFrame(frame);
+			Assert::AreEqual(2u, getNumGLCalls(frame, "glUseProgram"), L"Deleting a program should invalidate it");
+			Assert::AreEqual(1u, getNumGLCalls(frame, "glBindVertexArray"), L"Redundant VAO should be skipped");
+			Assert::AreEqual(1u, getNumGLCalls(frame, "glEnable"), L"Redundant capability should be skipped");
+			Assert::AreEqual(1u, getNumGLCalls(frame, "glDisable"), L"Changed capability should be executed");
+			Assert::AreEqual(2u, getNumGLCalls(frame, "glBindBufferBase"), L"Wrong number of buffer bindings");
+			Assert::AreEqual(1u, getNumGLCalls(frame, "glBindTextureUnit"), L"Redundant texture should be skipped");
+			Assert::AreEqual(2u, getNumGLCalls(frame, "glDrawArrays"), L"Draw calls should never be skipped");
+			Assert::AreEqual(5u, numEliminated, L"Wrong number of eliminated commands");
+
+			// The shadow state is forgotten between flushes.
+			cmdList.useProgram(1);
+			cmdList.flushAllCommands();
+			presentRecordingGLFrame();
+			getLastRecordingGLFrame(frame);
+			Assert::AreEqual(1u, getNumGLCalls(frame, "glUseProgram"), L"First command of a flush should be executed");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkRedundantStateElimination)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// GL calls per 10k draws with and without redundant state elimination, on the recording backend.
+		TEST_METHOD(BenchmarkRedundantStateElimination) {
+			constexpr uint32 NUM_DRAWS = 10000;
+			constexpr int32 NUM_ITERATIONS = 10;
+			wchar_t msg[256];
+
+			installRecordingGL();
+			RenderCommandList cmdList("BenchmarkRedundantStateElimination");
+
+			for (int32 bEliminate = 0; bEliminate <= 1; ++bEliminate) {
+				setEliminateRedundantState(bEliminate != 0);
+				float totalReplay = 0.0f;
+				RecordingGLFrame frame;
+				for (int32 iter = 0; iter < NUM_ITERATIONS; ++iter) {
+					recordRedundantDraws(cmdList, NUM_DRAWS);
+					presentRecordingGLFrame();
+
+					Stopwatch stopwatch;
+					cmdList.flushAllCommands();
+					totalReplay += stopwatch.stop();
+
+					presentRecordingGLFrame();
+				}
+				getLastRecordingGLFrame(frame);
+
+				swprintf_s(msg, L"eliminate=%d: replay=%.3f ms, GL calls=%llu, state changes=%llu per %u draws\n",
+					bEliminate, totalReplay / NUM_ITERATIONS, frame.stats.numCalls, frame.stats.numStateChanges, NUM_DRAWS);
+				Logger::WriteMessage(msg);
+			}
+			setEliminateRedundantState(true);
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkRecordAndReplay)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Record and replay cost per 100k commands. GL calls are replaced with a stub.
+		TEST_METHOD(BenchmarkRecordAndReplay) {
+			constexpr uint32 NUM_COMMANDS = 100000;
+			constexpr int32 NUM_ITERATIONS = 10;
+			wchar_t msg[256];
+
+			RenderCommandList cmdList("BenchmarkRecordAndReplay");
+			float totalRecord = 0.0f, totalReplay = 0.0f;
+			uint32 usedBytes = 0;
+
+			for (int32 iter = 0; iter < NUM_ITERATIONS; ++iter) {
+				Stopwatch stopwatch;
+				for (uint32 i = 0; i < NUM_COMMANDS / 4; ++i) {
+					cmdList.cullFace(GL_BACK);
+					cmdList.bindBufferBase(GL_UNIFORM_BUFFER, 0, i);
+					cmdList.uniform1i(0, (GLint)i);
+					cmdList.drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+				}
+				totalRecord += stopwatch.stop();
+				usedBytes = cmdList.getUsedCommandBytes();
+
+				installStubs(cmdList);
+				gNumStubCalls = 0;
+				gExecutedLocations.clear();
+				gExecutedLocations.reserve(NUM_COMMANDS);
+
+				stopwatch.start();
+				cmdList.executeAllCommands();
+				totalReplay += stopwatch.stop();
+
+				cmdList.clearAllCommands();
+			}
+
+			swprintf_s(msg, L"record=%.3f ms, replay=%.3f ms per %u commands (%u bytes)\n",
+				totalRecord / NUM_ITERATIONS, totalReplay / NUM_ITERATIONS, NUM_COMMANDS, usedBytes);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
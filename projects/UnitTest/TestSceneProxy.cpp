@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/render/scene_proxy.h"
+#include "pathos/render/retained_scene_proxy.h"
+#include "pathos/scene/static_mesh_component.h"
+#include "pathos/material/material.h"
+#include "pathos/material/material_proxy.h"
+#include "pathos/material/material_shader.h"
+#include "pathos/util/engine_util.h"
+#include "pathos/console.h"
+
+#include "badger/math/hit_test.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// No GL context in unit tests, so use a material shader without a program.
+	// Not trivial for depth-only passes so that geometries are never dereferenced.
+	struct FakeMaterials {
+		FakeMaterials(uint32 numMaterials) {
+			shader.shadingModel = EMaterialShadingModel::DEFAULTLIT;
+			shader.bTrivialDepthOnlyPass = false;
+			shader.programHash = 1;
+			for (uint32 i = 0; i < numMaterials; ++i) {
+				materials.push_back(Material::createMaterialInstance(&shader));
+			}
+		}
+		MaterialShader shader;
+		std::vector<assetPtr<Material>> materials;
+	};
+
+	struct FakeStaticMesh {
+		matrix4 modelMatrix;
+		Material* material;
+		AABB localBounds;
+	};
+
+	matrix4 makeModelMatrix(uint32 index, float offset) {
+		vector3 location((float)(index % 1000), offset, (float)(index / 1000));
+		return glm::translate(matrix4(1.0f), location);
+	}
+
+	RetainedStaticMeshDesc makeDesc(const FakeStaticMesh& mesh, RetainedStaticMeshSection& outSection) {
+		outSection.geometry    = nullptr;
+		outSection.material    = mesh.material;
+		outSection.localBounds = mesh.localBounds;
+
+		RetainedStaticMeshDesc desc;
+		desc.sections    = &outSection;
+		desc.numSections = 1;
+		desc.modelMatrix = mesh.modelMatrix;
+		return desc;
+	}
+
+	// Same work as StaticMeshComponent::createRenderProxy() when not using the retained scene proxy.
+	void createProxiesFullRebuild(SceneProxy* scene, const std::vector<FakeStaticMesh>& meshes) {
+		for (const FakeStaticMesh& mesh : meshes) {
+			MaterialProxy* materialProxy = mesh.material->createMaterialProxy(scene);
+
+			ShadowMeshProxy* shadowProxy = ALLOC_RENDER_PROXY<ShadowMeshProxy>(scene);
+			shadowProxy->modelMatrix     = mesh.modelMatrix;
+			shadowProxy->geometry        = nullptr;
+			shadowProxy->material        = materialProxy;
+			shadowProxy->worldBounds     = badger::calculateWorldBounds(mesh.localBounds, mesh.modelMatrix);
+			shadowProxy->doubleSided     = false;
+			shadowProxy->renderInternal  = false;
+			scene->addShadowMeshProxy(shadowProxy);
+
+			StaticMeshProxy* proxy = ALLOC_RENDER_PROXY<StaticMeshProxy>(scene);
+			proxy->doubleSided     = false;
+			proxy->renderInternal  = false;
+			proxy->modelMatrix     = mesh.modelMatrix;
+			proxy->prevModelMatrix = mesh.modelMatrix;
+			proxy->geometry        = nullptr;
+			proxy->material        = materialProxy;
+			proxy->worldBounds     = badger::calculateWorldBounds(mesh.localBounds, mesh.modelMatrix);
+			scene->addStaticMeshProxy(proxy);
+		}
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestSceneProxy) {
+	public:
+		TEST_METHOD(TestRetainedStaticMeshes) {
+			FakeMaterials fakeMaterials(3);
+			PerspectiveLens lens(60.0f, 1.0f, 0.1f, 1000.0f);
+			Camera camera(lens);
+			SceneProxyCreateParams createParams{ SceneProxySource::MainScene, 0, camera };
+
+			RetainedSceneProxy retainedProxy;
+			std::vector<uint32> handles;
+			for (uint32 i = 0; i < 10; ++i) {
+				FakeStaticMesh mesh{ makeModelMatrix(i, 0.0f), fakeMaterials.materials[i % 3].get(), AABB::fromMinMax(vector3(-1.0f), vector3(1.0f)) };
+				RetainedStaticMeshSection section;
+				handles.push_back(retainedProxy.addStaticMesh(makeDesc(mesh, section)));
+			}
+			retainedProxy.removeStaticMesh(handles[9]);
+
+			const matrix4 movedMatrix = makeModelMatrix(0, 5.0f);
+			retainedProxy.updateStaticMeshTransform(handles[0], movedMatrix);
+
+			// Frame 1: The moved mesh keeps its old matrix as prevModelMatrix.
+			{
+				SceneProxy* scene = new SceneProxy(createParams);
+				retainedProxy.fillSceneProxy(scene);
+				scene->finalize_mainThread();
+
+				const StaticMeshProxyList& proxies = scene->getOpaqueStaticMeshes();
+				Assert::AreEqual((size_t)9, proxies.size(), L"Removed meshes should not be drawn");
+				Assert::AreEqual((size_t)9, scene->getShadowMeshes().size(), L"Shadow proxies are missing");
+
+				bool bSorted = true;
+				for (size_t i = 1; i < proxies.size(); ++i) {
+					bSorted = bSorted && (proxies[i - 1]->material->materialInstanceID <= proxies[i]->material->materialInstanceID);
+				}
+				Assert::IsTrue(bSorted, L"Retained proxies should be in draw order");
+
+				const StaticMeshProxy* movedProxy = nullptr;
+				for (const StaticMeshProxy* proxy : proxies) {
+					if (proxy->modelMatrix == movedMatrix) movedProxy = proxy;
+				}
+				Assert::IsTrue(movedProxy != nullptr, L"Transform update is missing");
+				Assert::IsTrue(movedProxy->prevModelMatrix == makeModelMatrix(0, 0.0f), L"prevModelMatrix should be the last snapshot");
+				Assert::IsTrue(movedProxy->worldBounds.minBounds.y == 4.0f, L"World bounds should follow the transform");
+
+				// Culling data should map BVH order back to the same proxies.
+				const RetainedStaticMeshCulling& culling = scene->retainedStaticMeshCulling;
+				Assert::AreEqual(9u, culling.numProxies, L"Culling data is missing");
+				Assert::AreEqual(9u, culling.worldBounds.count, L"Culling bounds are missing");
+				bool bBoundsMatch = true;
+				for (uint32 i = 0; i < culling.worldBounds.count; ++i) {
+					const AABB& bounds = culling.proxies[culling.boundsToProxy[i]].worldBounds;
+					bBoundsMatch = bBoundsMatch
+						&& culling.worldBounds.components[(uint32)badger::EAABBComponent::CenterY][i] == bounds.getCenter().y
+						&& culling.worldBounds.components[(uint32)badger::EAABBComponent::CenterX][i] == bounds.getCenter().x;
+				}
+				Assert::IsTrue(bBoundsMatch, L"Culling bounds should match world bounds of proxies");
+
+				delete scene;
+			}
+			// Frame 2: Nothing moved, so the mesh is at rest.
+			{
+				SceneProxy* scene = new SceneProxy(createParams);
+				retainedProxy.fillSceneProxy(scene);
+				scene->finalize_mainThread();
+
+				bool bAtRest = true;
+				for (const StaticMeshProxy* proxy : scene->getOpaqueStaticMeshes()) {
+					bAtRest = bAtRest && (proxy->modelMatrix == proxy->prevModelMatrix);
+				}
+				Assert::IsTrue(bAtRest, L"prevModelMatrix should settle after a frame");
+
+				delete scene;
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkRetainedSceneProxy)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Game thread cost to create a frame's scene proxy, full rebuild vs retained scene proxy.
+		// 1% of meshes move every frame in the retained case.
+		TEST_METHOD(BenchmarkRetainedSceneProxy) {
+			constexpr int32 NUM_ITERATIONS = 10;
+			constexpr uint32 NUM_MATERIALS = 64;
+			const uint32 meshCounts[] = { 1000, 10000, 100000 };
+			wchar_t msg[256];
+
+			// Full rebuild of 100k meshes does not fit in the default allocator.
+			ConsoleVariableBase* cvarAllocatorSize = ConsoleVariableManager::get().find("r.sceneProxy.allocatorSize");
+			const int32 oldAllocatorSize = cvarAllocatorSize->getInt();
+			cvarAllocatorSize->parse("128", nullptr);
+
+			FakeMaterials fakeMaterials(NUM_MATERIALS);
+			PerspectiveLens lens(60.0f, 1.0f, 0.1f, 1000.0f);
+			Camera camera(lens);
+			SceneProxyCreateParams createParams{ SceneProxySource::MainScene, 0, camera };
+
+			for (uint32 numMeshes : meshCounts) {
+				std::vector<FakeStaticMesh> meshes(numMeshes);
+				for (uint32 i = 0; i < numMeshes; ++i) {
+					meshes[i].modelMatrix = makeModelMatrix(i, 0.0f);
+					meshes[i].material    = fakeMaterials.materials[i % NUM_MATERIALS].get();
+					meshes[i].localBounds = AABB::fromMinMax(vector3(-0.5f), vector3(0.5f));
+				}
+
+				float elapsedFullRebuild = 0.0f;
+				for (int32 iter = 0; iter < NUM_ITERATIONS; ++iter) {
+					Stopwatch stopwatch;
+					SceneProxy* scene = new SceneProxy(createParams);
+					createProxiesFullRebuild(scene, meshes);
+					scene->finalize_mainThread();
+					delete scene;
+					elapsedFullRebuild += stopwatch.stop();
+				}
+
+				RetainedSceneProxy retainedProxy;
+				std::vector<uint32> handles(numMeshes);
+				for (uint32 i = 0; i < numMeshes; ++i) {
+					RetainedStaticMeshSection section;
+					handles[i] = retainedProxy.addStaticMesh(makeDesc(meshes[i], section));
+				}
+				// Registration happens once. Don't count the first snapshot which sorts everything.
+				{
+					SceneProxy* scene = new SceneProxy(createParams);
+					retainedProxy.fillSceneProxy(scene);
+					delete scene;
+				}
+
+				const uint32 numMoving = std::max(1u, numMeshes / 100);
+				float elapsedIncremental = 0.0f;
+				for (int32 iter = 0; iter < NUM_ITERATIONS; ++iter) {
+					Stopwatch stopwatch;
+					for (uint32 i = 0; i < numMoving; ++i) {
+						const uint32 meshIx = (i * 97 + iter) % numMeshes;
+						retainedProxy.updateStaticMeshTransform(handles[meshIx], makeModelMatrix(meshIx, (float)(iter + 1)));
+					}
+					SceneProxy* scene = new SceneProxy(createParams);
+					retainedProxy.fillSceneProxy(scene);
+					scene->finalize_mainThread();
+					delete scene;
+					elapsedIncremental += stopwatch.stop();
+				}
+
+				swprintf_s(msg, L"meshes=%6u full rebuild=%8.3f ms incremental=%8.3f ms\n",
+					numMeshes, elapsedFullRebuild / NUM_ITERATIONS, elapsedIncremental / NUM_ITERATIONS);
+				Logger::WriteMessage(msg);
+			}
+
+			char oldValue[16];
+			sprintf_s(oldValue, "%d", oldAllocatorSize);
+			cvarAllocatorSize->parse(oldValue, nullptr);
+		}
+	};
+}
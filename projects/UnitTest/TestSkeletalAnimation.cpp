@@ -0,0 +1,360 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/animation/skeletal_animation.h"
+#include "pathos/animation/skinning.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+#include <random>
+#include <thread>
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Last interval whose first key is not greater than the time.
+	uint32 findKeyLinear(const std::vector<float>& times, float time) {
+		uint32 i = 0;
+		while (i + 2 < times.size() && times[i + 1] <= time) ++i;
+		return i;
+	}
+
+	bool nearlyEqual(const vector3& a, const vector3& b, float epsilon) {
+		return glm::all(glm::lessThanEqual(glm::abs(a - b), vector3(epsilon)));
+	}
+
+	// Random rigid transform with uniform scale, like a joint of an animated character.
+	matrix4 randomJointTransform(std::mt19937& rng) {
+		std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+		const vector3 axis = glm::normalize(vector3(dist(rng), dist(rng), dist(rng)) + vector3(0.0f, 0.0f, 1.5f));
+		matrix4 m = glm::translate(matrix4(1.0f), vector3(dist(rng), dist(rng), dist(rng)));
+		m = glm::rotate(m, dist(rng) * 3.0f, axis);
+		return glm::scale(m, vector3(1.0f + 0.2f * dist(rng)));
+	}
+
+	struct SkinnedCharacter {
+		std::vector<float> positions;
+		std::vector<float> normals;
+		// Every influence as authored, bone-major like the original per-bone lists.
+		std::vector<std::vector<std::pair<uint32, float>>> boneVertices;
+	};
+
+	SkinnedCharacter makeCharacter(std::mt19937& rng, uint32 numVertices, uint32 numJoints, uint32 maxInfluences) {
+		std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+		SkinnedCharacter character;
+		character.boneVertices.resize(numJoints);
+		for (uint32 v = 0; v < numVertices; ++v) {
+			const vector3 p(dist(rng), dist(rng), dist(rng));
+			const vector3 n = glm::normalize(p + vector3(0.01f));
+			character.positions.insert(character.positions.end(), { p.x, p.y, p.z });
+			character.normals.insert(character.normals.end(), { n.x, n.y, n.z });
+			const uint32 numInfluences = 1 + rng() % maxInfluences;
+			for (uint32 i = 0; i < numInfluences; ++i) {
+				character.boneVertices[rng() % numJoints].push_back(std::make_pair(v, 0.05f + 0.5f * (dist(rng) + 1.0f)));
+			}
+		}
+		return character;
+	}
+
+	void bindCharacter(const SkinnedCharacter& character, SoftwareSkinning& skinning) {
+		skinning.initialize((uint32)(character.positions.size() / 3), character.positions.data(), character.normals.data());
+		for (uint32 joint = 0; joint < (uint32)character.boneVertices.size(); ++joint) {
+			for (const auto& influence : character.boneVertices[joint]) {
+				skinning.addInfluence(influence.first, joint, influence.second);
+			}
+		}
+		skinning.normalizeWeights();
+	}
+
+	// Former SkinnedMesh::updateSoftwareSkinning(): bone-major, a fresh buffer every update.
+	void legacySkinning(const SkinnedCharacter& character, const matrix4* palette, std::vector<float>& output) {
+		const std::vector<float>& positions = character.positions;
+		std::vector<float> pos(positions.size(), 0.0f);
+		for (uint32 i = 0; i < (uint32)character.boneVertices.size(); ++i) {
+			for (const auto& influence : character.boneVertices[i]) {
+				auto p = 3 * influence.first;
+				auto vert = glm::vec4(positions[p], positions[p + 1], positions[p + 2], 1.0f);
+				auto v = influence.second * palette[i] * vert;
+				pos[p] += v.x;
+				pos[p + 1] += v.y;
+				pos[p + 2] += v.z;
+			}
+		}
+		output.swap(pos);
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestSkeletalAnimation) {
+	public:
+		TEST_METHOD(TestKeySearch) {
+			std::mt19937 rng(5);
+			std::vector<float> times;
+			float t = 0.0f;
+			for (uint32 i = 0; i < 200; ++i) {
+				times.push_back(t);
+				t += 0.01f + 0.1f * (rng() % 100) / 100.0f;
+			}
+			const float duration = times.back();
+
+			// Playback forward, backward, and random seeks share a cursor.
+			uint32 cursor = 0;
+			std::vector<float> queries;
+			for (float q = -0.5f; q < duration + 0.5f; q += 0.013f) queries.push_back(q);
+			for (float q = duration + 0.5f; q > -0.5f; q -= 0.021f) queries.push_back(q);
+			for (uint32 i = 0; i < 1000; ++i) queries.push_back(duration * (rng() % 10000) / 9999.0f);
+			queries.insert(queries.end(), times.begin(), times.end());
+
+			for (float q : queries) {
+				const uint32 expected = findKeyLinear(times, q);
+				Assert::AreEqual(expected, AnimationClip::findKey(times.data(), (uint32)times.size(), q, cursor), L"Cursor search disagrees with linear search");
+				uint32 freshCursor = 0xffffffff;
+				Assert::AreEqual(expected, AnimationClip::findKey(times.data(), (uint32)times.size(), q, freshCursor), L"Binary search disagrees with linear search");
+			}
+
+			uint32 smallCursor = 0;
+			const float oneKey[] = { 1.0f };
+			Assert::AreEqual(0u, AnimationClip::findKey(oneKey, 1, 3.0f, smallCursor), L"Single key should return 0");
+		}
+
+		TEST_METHOD(TestPoseAndPalette) {
+			// root -> upper -> lower. Only the lower joint has vertices.
+			Skeleton skeleton;
+			const matrix4 rootLocal = glm::translate(matrix4(1.0f), vector3(0.0f, 1.0f, 0.0f));
+			const matrix4 upperLocal = glm::translate(matrix4(1.0f), vector3(0.0f, 2.0f, 0.0f));
+			const matrix4 lowerLocal = glm::translate(matrix4(1.0f), vector3(0.0f, 3.0f, 0.0f));
+			const matrix4 lowerBind = rootLocal * upperLocal * lowerLocal;
+			const int32 root = skeleton.addJoint("root", Skeleton::NO_PARENT, rootLocal);
+			const int32 upper = skeleton.addJoint("upper", root, upperLocal);
+			const int32 lower = skeleton.addJoint("lower", upper, lowerLocal, glm::inverse(lowerBind));
+			Assert::AreEqual(lower, skeleton.findJoint("lower"), L"Joint not found");
+			Assert::AreEqual(Skeleton::NO_PARENT, skeleton.findJoint("missing"), L"Unknown joint should not be found");
+
+			// Upper joint rotates 90 degrees around z from t=0 to t=2, and moves in x.
+			AnimationClip clip("bend", 2.0f);
+			AnimationTrack& track = clip.addTrack(upper);
+			track.rotation.add(0.0f, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+			track.rotation.add(2.0f, glm::angleAxis(glm::half_pi<float>(), vector3(0.0f, 0.0f, 1.0f)));
+			track.translation.add(0.0f, vector3(0.0f, 2.0f, 0.0f));
+			track.translation.add(1.0f, vector3(1.0f, 2.0f, 0.0f));
+			track.translation.add(2.0f, vector3(1.0f, 2.0f, 0.0f));
+
+			AnimationPose pose;
+			pose.initialize(&skeleton);
+			pose.updatePalette();
+			const vector3 bindVertex(0.5f, 6.0f, 0.0f);
+			Assert::IsTrue(nearlyEqual(vector3(pose.getPalette()[lower] * vector4(bindVertex, 1.0f)), bindVertex, 1e-5f), L"Bind pose should not move vertices");
+
+			pose.sample(clip, 1.0f);
+			pose.updatePalette();
+			const matrix4 upperAt1 = glm::translate(matrix4(1.0f), vector3(1.0f, 2.0f, 0.0f)) * glm::mat4_cast(glm::angleAxis(glm::quarter_pi<float>(), vector3(0.0f, 0.0f, 1.0f)));
+			const matrix4 expected = rootLocal * upperAt1 * lowerLocal * glm::inverse(lowerBind);
+			const vector3 skinned = vector3(pose.getPalette()[lower] * vector4(bindVertex, 1.0f));
+			Assert::IsTrue(nearlyEqual(skinned, vector3(expected * vector4(bindVertex, 1.0f)), 1e-4f), L"Wrong palette at t=1");
+
+			// Clamped beyond the duration.
+			pose.sample(clip, 5.0f);
+			pose.updatePalette();
+			const vector3 end = vector3(pose.getGlobalTransforms()[lower][3]);
+			Assert::IsTrue(nearlyEqual(end, vector3(1.0f - 3.0f, 3.0f, 0.0f), 1e-4f), L"Time should be clamped to the duration");
+		}
+
+		TEST_METHOD(TestZeroScale) {
+			// Joints scaled to zero in some axes, like a hidden prop. Only translation is animated.
+			Skeleton skeleton;
+			const matrix4 rotation = glm::rotate(matrix4(1.0f), 0.7f, vector3(0.0f, 1.0f, 0.0f));
+			const int32 flat = skeleton.addJoint("flat", Skeleton::NO_PARENT, glm::scale(rotation, vector3(2.0f, 0.0f, 1.0f)));
+			const int32 hidden = skeleton.addJoint("hidden", Skeleton::NO_PARENT, glm::scale(rotation, vector3(0.0f)));
+
+			AnimationClip clip("move", 1.0f);
+			for (int32 joint : { flat, hidden }) {
+				AnimationTrack& track = clip.addTrack(joint);
+				track.translation.add(0.0f, vector3(0.0f));
+				track.translation.add(1.0f, vector3(1.0f, 0.0f, 0.0f));
+			}
+
+			AnimationPose pose;
+			pose.initialize(&skeleton);
+			pose.sample(clip, 0.5f);
+			for (int32 joint : { flat, hidden }) {
+				const matrix4& local = pose.getLocalTransforms()[joint];
+				for (int32 i = 0; i < 4; ++i) {
+					Assert::IsTrue(glm::all(glm::equal(local[i], local[i])), L"Zero scale should not produce NaN");
+				}
+				Assert::IsTrue(nearlyEqual(vector3(local[3]), vector3(0.5f, 0.0f, 0.0f), 1e-5f), L"Translation should be sampled");
+			}
+			const matrix4& flatLocal = pose.getLocalTransforms()[flat];
+			const matrix4 expectedFlat = glm::scale(rotation, vector3(2.0f, 0.0f, 1.0f));
+			Assert::IsTrue(nearlyEqual(vector3(flatLocal[0]), vector3(expectedFlat[0]), 1e-5f), L"Rotation should be kept with one zero axis");
+			Assert::IsTrue(nearlyEqual(vector3(flatLocal[2]), vector3(expectedFlat[2]), 1e-5f), L"Rotation should be kept with one zero axis");
+		}
+
+		TEST_METHOD(TestClipChangedAfterSampling) {
+			Skeleton skeleton;
+			const int32 a = skeleton.addJoint("a", Skeleton::NO_PARENT, matrix4(1.0f));
+			const int32 b = skeleton.addJoint("b", a, matrix4(1.0f));
+
+			AnimationClip clip("grow", 1.0f);
+			AnimationTrack& trackA = clip.addTrack(a);
+			trackA.translation.add(0.0f, vector3(0.0f));
+			trackA.translation.add(1.0f, vector3(1.0f, 0.0f, 0.0f));
+
+			AnimationPose pose;
+			pose.initialize(&skeleton);
+			pose.sample(clip, 0.5f);
+
+			// Same clip object, more tracks. The pose should not reuse key cursors of the old track list.
+			const uint32 idBefore = clip.getClipID();
+			AnimationTrack& trackB = clip.addTrack(b);
+			trackB.translation.add(0.0f, vector3(0.0f));
+			trackB.translation.add(0.5f, vector3(0.0f, 1.0f, 0.0f));
+			trackB.translation.add(1.0f, vector3(0.0f, 2.0f, 0.0f));
+			Assert::IsTrue(idBefore != clip.getClipID(), L"Adding a track should change the clip ID");
+
+			pose.sample(clip, 0.75f);
+			Assert::IsTrue(nearlyEqual(vector3(pose.getLocalTransforms()[b][3]), vector3(0.0f, 1.5f, 0.0f), 1e-5f), L"New track should be sampled");
+
+			AnimationClip other("other", 1.0f);
+			Assert::IsTrue(clip.getClipID() != other.getClipID(), L"Clips should not share an ID");
+		}
+
+		TEST_METHOD(TestSkinningMatchesReference) {
+			std::mt19937 rng(17);
+			constexpr uint32 numJoints = 40;
+			SkinnedCharacter character = makeCharacter(rng, 20000, numJoints, 6);
+			std::vector<matrix4> palette(numJoints);
+			for (matrix4& m : palette) m = randomJointTransform(rng);
+
+			SoftwareSkinning skinning;
+			bindCharacter(character, skinning);
+			skinning.skin(nullptr, palette.data(), numJoints);
+			std::vector<float> serialPositions(skinning.getPositions(), skinning.getPositions() + character.positions.size());
+
+			// Scalar reference with the same rule: 4 largest weights, normalized.
+			const uint32 numVertices = (uint32)(character.positions.size() / 3);
+			std::vector<std::vector<std::pair<float, uint32>>> perVertex(numVertices);
+			for (uint32 joint = 0; joint < numJoints; ++joint) {
+				for (const auto& influence : character.boneVertices[joint]) {
+					perVertex[influence.first].push_back(std::make_pair(influence.second, joint));
+				}
+			}
+			for (uint32 v = 0; v < numVertices; ++v) {
+				auto& list = perVertex[v];
+				std::sort(list.begin(), list.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+				if (list.size() > SoftwareSkinning::MAX_INFLUENCES) list.resize(SoftwareSkinning::MAX_INFLUENCES);
+				float sum = 0.0f;
+				for (const auto& w : list) sum += w.first;
+				const vector4 p(character.positions[v * 3], character.positions[v * 3 + 1], character.positions[v * 3 + 2], 1.0f);
+				const vector4 n(character.normals[v * 3], character.normals[v * 3 + 1], character.normals[v * 3 + 2], 0.0f);
+				vector3 expectedP(0.0f), expectedN(0.0f);
+				for (const auto& w : list) {
+					expectedP += (w.first / sum) * vector3(palette[w.second] * p);
+					expectedN += (w.first / sum) * vector3(palette[w.second] * n);
+				}
+				// Weights are stored in 16 bits. The error of a normal grows where its influences nearly cancel out.
+				const float normalTolerance = 1e-4f / std::max(glm::length(expectedN), 0.01f);
+				expectedN = glm::normalize(expectedN);
+				const float* actualP = skinning.getPositions() + v * 3;
+				const float* actualN = skinning.getNormals() + v * 3;
+				Assert::IsTrue(nearlyEqual(vector3(actualP[0], actualP[1], actualP[2]), expectedP, 1e-4f), L"Skinned position differs from the reference");
+				Assert::IsTrue(nearlyEqual(vector3(actualN[0], actualN[1], actualN[2]), expectedN, normalTolerance), L"Skinned normal differs from the reference");
+			}
+
+			JobSystem jobSystem;
+			jobSystem.start(3);
+			skinning.skin(&jobSystem, palette.data(), numJoints);
+			jobSystem.stop();
+			Assert::IsTrue(std::equal(serialPositions.begin(), serialPositions.end(), skinning.getPositions()), L"Parallel skinning should match serial skinning");
+		}
+
+		TEST_METHOD(TestUnskinnedVertices) {
+			const float positions[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+			const matrix4 palette = glm::translate(matrix4(1.0f), vector3(10.0f, 0.0f, 0.0f));
+			SoftwareSkinning skinning;
+			skinning.initialize(2, positions);
+			skinning.addInfluence(1, 0, 0.25f);
+			skinning.normalizeWeights();
+			skinning.skin(nullptr, &palette, 1);
+			Assert::IsTrue(skinning.getNormals() == nullptr, L"No normals were given");
+			Assert::IsTrue(nearlyEqual(vector3(skinning.getPositions()[0], skinning.getPositions()[1], skinning.getPositions()[2]), vector3(1.0f, 2.0f, 3.0f), 0.0f), L"Vertex without influences should keep its bind position");
+			Assert::IsTrue(nearlyEqual(vector3(skinning.getPositions()[3], skinning.getPositions()[4], skinning.getPositions()[5]), vector3(14.0f, 5.0f, 6.0f), 1e-5f), L"Single influence should be normalized to weight 1");
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkSkinning)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkSkinning) {
+			constexpr uint32 numCharacters = 24;
+			constexpr uint32 numVerticesPerCharacter = 20000;
+			constexpr uint32 numJoints = 64;
+			constexpr uint32 numFrames = 10;
+			std::mt19937 rng(23);
+
+			std::vector<SkinnedCharacter> characters;
+			std::vector<SoftwareSkinning> positionSkinnings(numCharacters);
+			std::vector<SoftwareSkinning> fullSkinnings(numCharacters);
+			for (uint32 i = 0; i < numCharacters; ++i) {
+				characters.push_back(makeCharacter(rng, numVerticesPerCharacter, numJoints, 4));
+				bindCharacter(characters[i], fullSkinnings[i]);
+				// Same influences without normals, to compare with the legacy path that skins positions only.
+				positionSkinnings[i].initialize(numVerticesPerCharacter, characters[i].positions.data());
+				for (uint32 joint = 0; joint < numJoints; ++joint) {
+					for (const auto& influence : characters[i].boneVertices[joint]) {
+						positionSkinnings[i].addInfluence(influence.first, joint, influence.second);
+					}
+				}
+				positionSkinnings[i].normalizeWeights();
+			}
+			std::vector<matrix4> palette(numJoints);
+			for (matrix4& m : palette) m = randomJointTransform(rng);
+			const double totalVertices = (double)numCharacters * numVerticesPerCharacter * numFrames;
+
+			auto measure = [&](std::vector<SoftwareSkinning>& skinnings, JobSystem* jobSystem) -> double {
+				Stopwatch stopwatch;
+				stopwatch.start();
+				for (uint32 frame = 0; frame < numFrames; ++frame) {
+					for (SoftwareSkinning& skinning : skinnings) {
+						skinning.skin(jobSystem, palette.data(), numJoints);
+					}
+				}
+				return stopwatch.stop();
+			};
+
+			std::vector<float> legacyOutput;
+			Stopwatch stopwatch;
+			stopwatch.start();
+			for (uint32 frame = 0; frame < numFrames; ++frame) {
+				for (const SkinnedCharacter& character : characters) {
+					legacySkinning(character, palette.data(), legacyOutput);
+				}
+			}
+			const double legacyMs = stopwatch.stop();
+			const double positionMs = measure(positionSkinnings, nullptr);
+			const double serialMs = measure(fullSkinnings, nullptr);
+
+			const uint32 numThreads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			JobSystem jobSystem;
+			jobSystem.start(numThreads);
+			const double parallelMs = measure(fullSkinnings, &jobSystem);
+			jobSystem.stop();
+
+			wchar_t msg[256];
+			swprintf_s(msg, L"%u characters x %u vertices x %u frames\n", numCharacters, numVerticesPerCharacter, numFrames);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"Legacy, positions:                 %9.2f ms, %8.1f vertices/ms\n", legacyMs, totalVertices / legacyMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"SIMD, positions:                   %9.2f ms, %8.1f vertices/ms\n", positionMs, totalVertices / positionMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"SIMD, positions + normals:         %9.2f ms, %8.1f vertices/ms\n", serialMs, totalVertices / serialMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"SIMD, positions + normals, %2u workers: %9.2f ms, %8.1f vertices/ms\n", numThreads, parallelMs, totalVertices / parallelMs);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
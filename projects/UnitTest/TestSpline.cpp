@@ -0,0 +1,249 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/math/spline.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+	// Winding path like a camera rail. Tangents are Catmull-Rom.
+	HermiteSpline makeSpline(uint32 numPoints, uint32 seed) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+		std::vector<vector3> points(numPoints);
+		for (uint32 i = 0; i < numPoints; ++i) {
+			const float x = (float)i;
+			points[i] = vector3(x * 1.5f, 3.0f * std::sin(0.3f * x) + jitter(rng), 2.0f * std::cos(0.17f * x) + jitter(rng));
+		}
+		HermiteSpline spline;
+		for (uint32 i = 0; i < numPoints; ++i) {
+			const vector3& prev = points[i > 0 ? i - 1 : i];
+			const vector3& next = points[i + 1 < numPoints ? i + 1 : i];
+			spline.addPoint(points[i], 0.5f * (next - prev));
+		}
+		spline.updateSpline();
+		return spline;
+	}
+
+	// Dense samples of the spline by time, with accumulated chord lengths.
+	struct BruteForceSamples {
+		BruteForceSamples(const HermiteSpline& spline, uint32 samplesPerSegment) {
+			const uint32 numSamples = (uint32)(spline.getTotalTime() * samplesPerSegment) + 1;
+			locations.resize(numSamples);
+			distances.resize(numSamples);
+			for (uint32 i = 0; i < numSamples; ++i) {
+				locations[i] = spline.locationAtTime((float)i / samplesPerSegment);
+				distances[i] = (i == 0) ? 0.0f : distances[i - 1] + glm::length(locations[i] - locations[i - 1]);
+			}
+		}
+		vector3 locationAtDistance(float distance) const {
+			for (size_t i = 0; i + 1 < distances.size(); ++i) {
+				if (distances[i + 1] >= distance) {
+					const float t = (distance - distances[i]) / (distances[i + 1] - distances[i]);
+					return glm::mix(locations[i], locations[i + 1], glm::clamp(t, 0.0f, 1.0f));
+				}
+			}
+			return locations.back();
+		}
+		float nearestDistanceSq(const vector3& position) const {
+			float best = std::numeric_limits<float>::max();
+			for (const vector3& p : locations) {
+				best = (std::min)(best, glm::dot(p - position, p - position));
+			}
+			return best;
+		}
+		std::vector<vector3> locations;
+		std::vector<float> distances;
+	};
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestSpline)
+	{
+	public:
+		TEST_METHOD(TestArcLengthMatchesBruteForce)
+		{
+			HermiteSpline spline = makeSpline(50, 1);
+			BruteForceSamples reference(spline, 400);
+
+			const float totalDistance = spline.getTotalDistance();
+			Assert::AreEqual(reference.distances.back(), totalDistance, 0.001f * totalDistance, L"Total arc length");
+
+			std::mt19937 rng(2);
+			std::uniform_real_distribution<float> randomDistance(0.0f, totalDistance);
+			for (uint32 i = 0; i < 1000; ++i) {
+				const float distance = randomDistance(rng);
+				const vector3 location = spline.locationAtDistance(distance);
+				const vector3 expected = reference.locationAtDistance(distance);
+				Assert::IsTrue(glm::length(location - expected) < 0.02f, L"Location at distance");
+				// The location is on the curve at timeAtDistance().
+				const vector3 onCurve = spline.locationAtTime(spline.timeAtDistance(distance));
+				Assert::IsTrue(glm::length(location - onCurve) < 1e-4f, L"Location is on the curve");
+			}
+
+			Assert::IsTrue(spline.locationAtDistance(-1.0f) == spline.locationAtTime(0.0f), L"Clamped to start");
+			Assert::IsTrue(spline.locationAtDistance(totalDistance + 1.0f) == spline.locationAtTime(spline.getTotalTime()), L"Clamped to end");
+			Assert::AreEqual(spline.getTotalTime(), spline.timeAtDistance(totalDistance), 1e-5f, L"Time at the end");
+		}
+
+		TEST_METHOD(TestBatchMatchesSingle)
+		{
+			HermiteSpline spline = makeSpline(200, 3);
+			const float totalDistance = spline.getTotalDistance();
+
+			std::mt19937 rng(4);
+			std::uniform_real_distribution<float> randomDistance(-10.0f, totalDistance + 10.0f);
+			std::vector<float> distances(2000);
+			for (float& distance : distances) {
+				distance = randomDistance(rng);
+			}
+			std::vector<float> sortedDistances = distances;
+			std::sort(sortedDistances.begin(), sortedDistances.end());
+
+			for (const std::vector<float>* input : { &distances, &sortedDistances }) {
+				std::vector<vector3> locations(input->size()), tangents(input->size());
+				spline.locationsAtDistances(input->data(), (uint32)input->size(), locations.data(), tangents.data());
+				for (size_t i = 0; i < input->size(); ++i) {
+					const float distance = (*input)[i];
+					Assert::IsTrue(glm::length(locations[i] - spline.locationAtDistance(distance)) < 1e-5f, L"Batched location");
+					Assert::IsTrue(glm::length(tangents[i] - spline.tangentAtDistance(distance)) < 1e-5f, L"Batched tangent");
+				}
+			}
+		}
+
+		TEST_METHOD(TestNearestPointMatchesBruteForce)
+		{
+			HermiteSpline spline = makeSpline(100, 5);
+			BruteForceSamples reference(spline, 400);
+
+			std::mt19937 rng(6);
+			std::uniform_real_distribution<float> randomDistance(0.0f, spline.getTotalDistance());
+			std::uniform_real_distribution<float> offset(-4.0f, 4.0f);
+			for (uint32 i = 0; i < 300; ++i) {
+				const vector3 position = spline.locationAtDistance(randomDistance(rng)) + vector3(offset(rng), offset(rng), offset(rng));
+
+				vector3 nearest;
+				const float distance = spline.findNearestDistance(position, &nearest);
+				const float distSq = glm::dot(nearest - position, nearest - position);
+				Assert::IsTrue(distSq <= reference.nearestDistanceSq(position) + 1e-3f, L"At least as near as dense samples");
+				Assert::IsTrue(glm::length(spline.locationAtDistance(distance) - nearest) < 0.01f, L"Returned distance matches the location");
+			}
+		}
+
+		TEST_METHOD(TestSkewedIntervals)
+		{
+			// Many short segments followed by a long one, so the short ones share a few buckets.
+			const uint32 numShortSegments = 40;
+			const float shortLength = 0.01f;
+			HermiteSpline spline;
+			for (uint32 i = 0; i <= numShortSegments; ++i) {
+				spline.addPoint(vector3(shortLength * i, 0.002f * std::sin((float)i), 0.0f), vector3(shortLength, 0.0f, 0.0f));
+			}
+			spline.addPoint(vector3(shortLength * numShortSegments + 100.0f, 0.0f, 0.0f), vector3(shortLength, 0.0f, 0.0f));
+			spline.updateSpline();
+			BruteForceSamples reference(spline, 400);
+
+			const float shortDistance = reference.distances[numShortSegments * 400];
+			std::mt19937 rng(9);
+			std::uniform_real_distribution<float> randomDistance(0.0f, shortDistance);
+			for (uint32 i = 0; i < 1000; ++i) {
+				const float distance = randomDistance(rng);
+				const vector3 expected = reference.locationAtDistance(distance);
+				Assert::IsTrue(glm::length(spline.locationAtDistance(distance) - expected) < 1e-4f, L"Location at distance in short segments");
+			}
+
+			float prevTime = 0.0f;
+			for (uint32 i = 0; i <= 1000; ++i) {
+				const float time = spline.timeAtDistance(spline.getTotalDistance() * i / 1000.0f);
+				Assert::IsTrue(time >= prevTime, L"Time is monotonic in distance");
+				prevTime = time;
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkSpline10k)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkSpline10k)
+		{
+			const uint32 numPoints = 10000;
+			Stopwatch stopwatch;
+			HermiteSpline spline = makeSpline(numPoints, 7);
+			const float buildMs = stopwatch.stop();
+			const float totalDistance = spline.getTotalDistance();
+
+			std::mt19937 rng(8);
+			std::uniform_real_distribution<float> randomDistance(0.0f, totalDistance);
+			const uint32 numQueries = 100000;
+			std::vector<float> distances(numQueries);
+			for (float& distance : distances) {
+				distance = randomDistance(rng);
+			}
+			std::vector<vector3> locations(numQueries);
+
+			// Previous lookup: linear scan over the reparameterization table (10 samples per segment).
+			BruteForceSamples table(spline, 10);
+			const uint32 numLinearQueries = 1000;
+			stopwatch.start();
+			vector3 checksum(0.0f);
+			for (uint32 i = 0; i < numLinearQueries; ++i) {
+				checksum += table.locationAtDistance(distances[i]);
+			}
+			const float linearMs = stopwatch.stop();
+
+			stopwatch.start();
+			for (uint32 i = 0; i < numQueries; ++i) {
+				locations[i] = spline.locationAtDistance(distances[i]);
+			}
+			const float singleMs = stopwatch.stop();
+
+			stopwatch.start();
+			spline.locationsAtDistances(distances.data(), numQueries, locations.data());
+			const float batchMs = stopwatch.stop();
+
+			// Points along a rail, like objects following a path.
+			std::vector<float> sortedDistances = distances;
+			std::sort(sortedDistances.begin(), sortedDistances.end());
+			stopwatch.start();
+			spline.locationsAtDistances(sortedDistances.data(), numQueries, locations.data());
+			const float sortedBatchMs = stopwatch.stop();
+
+			const uint32 numNearestQueries = 1000;
+			std::uniform_real_distribution<float> offset(-4.0f, 4.0f);
+			std::vector<vector3> positions(numNearestQueries);
+			for (vector3& position : positions) {
+				position = spline.locationAtDistance(randomDistance(rng)) + vector3(offset(rng), offset(rng), offset(rng));
+			}
+			stopwatch.start();
+			float nearestChecksum = 0.0f;
+			for (const vector3& position : positions) {
+				nearestChecksum += spline.findNearestDistance(position);
+			}
+			const float nearestMs = stopwatch.stop();
+
+			Assert::IsTrue(std::isfinite(checksum.x + nearestChecksum), L"Checksum");
+
+			wchar_t msg[512];
+			swprintf_s(msg, L"Spline: %u points, length %.1f, built in %.2f ms\n", numPoints, totalDistance, buildMs);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  linear table scan     : %.3f us/query\n", 1000.0f * linearMs / numLinearQueries);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  locationAtDistance    : %.3f us/query\n", 1000.0f * singleMs / numQueries);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  batch (random)        : %.3f us/query\n", 1000.0f * batchMs / numQueries);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  batch (sorted)        : %.3f us/query\n", 1000.0f * sortedBatchMs / numQueries);
+			Logger::WriteMessage(msg);
+			swprintf_s(msg, L"  findNearestDistance   : %.3f us/query\n", 1000.0f * nearestMs / numNearestQueries);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
@@ -0,0 +1,173 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/util/tlsf_allocator.h"
+#include "pathos/util/malloc_emulator.h"
+#include "badger/system/stopwatch.h"
+
+#include <map>
+#include <vector>
+#include <random>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Mostly vertex/index sized requests, with occasional large ones.
+	uint64 randomAllocationSize(std::mt19937& rng) {
+		if (rng() % 64 == 0) {
+			return 16 * 1024 + rng() % (256 * 1024);
+		}
+		return 16 + rng() % 4096;
+	}
+
+	template<typename Allocator>
+	double benchmarkChurn(Allocator& allocator, uint32 numLive, uint32 numChurn, double& outFillMs) {
+		std::mt19937 rng(1234);
+		std::vector<uint64> offsets;
+		offsets.reserve(numLive);
+
+		Stopwatch stopwatch;
+		stopwatch.start();
+		for (uint32 i = 0; i < numLive; ++i) {
+			offsets.push_back(allocator.allocate(16 + rng() % 2048));
+		}
+		outFillMs = stopwatch.stop();
+
+		stopwatch.start();
+		for (uint32 i = 0; i < numChurn; ++i) {
+			uint32 victim = rng() % numLive;
+			allocator.deallocate(offsets[victim]);
+			offsets[victim] = allocator.allocate(16 + rng() % 2048);
+		}
+		return stopwatch.stop();
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestTLSFAllocator) {
+	public:
+		TEST_METHOD(TestCoalescing) {
+			TLSFAllocator allocator;
+			allocator.initialize(1000, 4);
+
+			uint64 a = allocator.allocate(100);
+			uint64 b = allocator.allocate(101);
+			uint64 c = allocator.allocate(100);
+			Assert::AreEqual(0ull, a, L"First allocation should start at zero");
+			Assert::AreEqual(100ull, b, L"Wrong offset");
+			Assert::AreEqual(204ull, c, L"Sizes should be rounded up to the alignment");
+			Assert::AreEqual(1000ull - 304ull, allocator.getRemainingBytes(), L"Wrong remaining bytes");
+			Assert::AreEqual(3ull, allocator.getNumAllocations(), L"Wrong number of allocations");
+
+			allocator.deallocate(a);
+			allocator.deallocate(c);
+			TLSFAllocator::Stats stats = allocator.getStats();
+			Assert::AreEqual(2u, stats.numFreeBlocks, L"c should be merged with the tail, but not a");
+			Assert::AreEqual(1000ull - 204ull, stats.largestFreeBlock, L"Wrong largest free block");
+
+			allocator.deallocate(b);
+			stats = allocator.getStats();
+			Assert::AreEqual(1u, stats.numFreeBlocks, L"Every free block should be merged into one");
+			Assert::AreEqual(0.0f, stats.fragmentation, L"No fragmentation after everything is freed");
+			Assert::AreEqual(0ull, allocator.allocate(1000), L"Whole range should be allocatable");
+			Assert::AreEqual(TLSFAllocator::INVALID_OFFSET, allocator.allocate(4), L"Range should be full");
+		}
+
+		TEST_METHOD(TestRandomizedStress) {
+			for (uint64 alignment : { 0ull, 4ull, 256ull }) {
+				constexpr uint64 totalBytes = 64ull * 1024 * 1024;
+				const uint64 unit = (alignment == 0) ? 1 : alignment;
+
+				TLSFAllocator allocator;
+				allocator.initialize(totalBytes, alignment);
+
+				std::mt19937 rng(42);
+				std::map<uint64, uint64> live; // offset -> aligned bytes
+				std::vector<uint64> liveOffsets;
+				uint64 usedBytes = 0;
+
+				for (uint32 op = 0; op < 200000; ++op) {
+					// Grow until about 10k live allocations, then keep churning around that.
+					const bool bAllocate = liveOffsets.empty() || (rng() % 20000) >= liveOffsets.size();
+					if (bAllocate) {
+						const uint64 bytes = randomAllocationSize(rng);
+						const uint64 offset = allocator.allocate(bytes);
+						if (offset == TLSFAllocator::INVALID_OFFSET) {
+							continue;
+						}
+						const uint64 alignedBytes = ((bytes + unit - 1) / unit) * unit;
+						Assert::IsTrue(offset % unit == 0, L"Offset is not aligned");
+						Assert::IsTrue(offset + alignedBytes <= totalBytes, L"Allocation is out of range");
+						auto next = live.lower_bound(offset);
+						Assert::IsTrue(next == live.end() || offset + alignedBytes <= next->first, L"Overlaps the next allocation");
+						if (next != live.begin()) {
+							auto prev = std::prev(next);
+							Assert::IsTrue(prev->first + prev->second <= offset, L"Overlaps the previous allocation");
+						}
+						live[offset] = alignedBytes;
+						liveOffsets.push_back(offset);
+						usedBytes += alignedBytes;
+					} else {
+						const uint32 victim = rng() % liveOffsets.size();
+						const uint64 offset = liveOffsets[victim];
+						liveOffsets[victim] = liveOffsets.back();
+						liveOffsets.pop_back();
+						allocator.deallocate(offset);
+						usedBytes -= live[offset];
+						live.erase(offset);
+					}
+					if (op % 10000 == 0) {
+						TLSFAllocator::Stats stats = allocator.getStats();
+						Assert::AreEqual(totalBytes - usedBytes, stats.freeBytes, L"Wrong free bytes");
+						Assert::AreEqual((uint32)live.size(), stats.numAllocations, L"Wrong number of allocations");
+						Assert::IsTrue(stats.fragmentation >= 0.0f && stats.fragmentation < 1.0f, L"Fragmentation out of range");
+					}
+				}
+				Assert::AreEqual(totalBytes - usedBytes, allocator.getRemainingBytes(), L"Wrong remaining bytes");
+
+				for (uint64 offset : liveOffsets) {
+					allocator.deallocate(offset);
+				}
+				TLSFAllocator::Stats stats = allocator.getStats();
+				Assert::AreEqual(1u, stats.numFreeBlocks, L"Free blocks should be fully coalesced");
+				Assert::AreEqual(totalBytes, stats.largestFreeBlock, L"Free blocks should be fully coalesced");
+				Assert::AreEqual(0ull, allocator.allocate(totalBytes), L"Whole range should be allocatable");
+			}
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkAgainstMallocEmulator)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkAgainstMallocEmulator) {
+			constexpr uint64 poolBytes = 1024ull * 1024 * 1024;
+			constexpr uint32 numLive = 100000;
+			constexpr uint32 numChurn = 100000;
+			wchar_t msg[256];
+
+			double fillMs;
+			TLSFAllocator tlsf;
+			tlsf.initialize(poolBytes, 4);
+			double churnMs = benchmarkChurn(tlsf, numLive, numChurn, fillMs);
+			TLSFAllocator::Stats stats = tlsf.getStats();
+			swprintf_s(msg, L"TLSFAllocator  live=%u fill=%9.3f ms churn(%u)=%9.3f ms freeBlocks=%u fragmentation=%.3f\n",
+				numLive, fillMs, numChurn, churnMs, stats.numFreeBlocks, stats.fragmentation);
+			Logger::WriteMessage(msg);
+
+			// MallocEmulator searches and updates its range tree in linear time, so fewer churn operations are measured.
+			constexpr uint32 numLegacyChurn = 1000;
+			MallocEmulator legacy;
+			legacy.initialize(poolBytes, 4);
+			double legacyChurnMs = benchmarkChurn(legacy, numLive, numLegacyChurn, fillMs);
+			swprintf_s(msg, L"MallocEmulator live=%u fill=%9.3f ms churn(%u)=%9.3f ms\n",
+				numLive, fillMs, numLegacyChurn, legacyChurnMs);
+			Logger::WriteMessage(msg);
+
+			swprintf_s(msg, L"Per churn operation: TLSF %.3f us, MallocEmulator %.3f us\n",
+				1000.0 * churnMs / numChurn, 1000.0 * legacyChurnMs / numLegacyChurn);
+			Logger::WriteMessage(msg);
+		}
+	};
+}
@@ -0,0 +1,184 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "badger/system/task_graph.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace {
+	void sleepMs(int32 ms) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+	}
+
+	// No task may start before all of its dependencies are finished.
+	bool startsAfterDependencies(const TaskGraph& graph, TaskHandle task, std::initializer_list<TaskHandle> dependencies) {
+		for (TaskHandle dep : dependencies) {
+			if (graph.getTaskTiming(task).startMs < graph.getTaskTiming(dep).endMs) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestTaskGraph) {
+	public:
+		TEST_METHOD(TestDependencies) {
+			JobSystem jobSystem;
+			jobSystem.start(3);
+
+			// Diamond: a -> (b, c) -> d
+			std::atomic<int32> order(0);
+			int32 orderA = -1, orderB = -1, orderC = -1, orderD = -1;
+
+			TaskGraph graph;
+			TaskHandle a = graph.addTask("A", ETaskThread::Main, [&]() { sleepMs(2); orderA = order++; });
+			TaskHandle b = graph.addTask("B", ETaskThread::Any, [&]() { sleepMs(5); orderB = order++; }, { a });
+			TaskHandle c = graph.addTask("C", ETaskThread::Main, [&]() { sleepMs(1); orderC = order++; }, { a });
+			TaskHandle d = graph.addTask("D", ETaskThread::Any, [&]() { orderD = order++; }, { b, c });
+			graph.execute(&jobSystem);
+
+			Assert::AreEqual(4, order.load(), L"All tasks should run exactly once");
+			Assert::AreEqual(0, orderA, L"Root task should run first");
+			Assert::AreEqual(3, orderD, L"Task should run after its dependencies");
+			Assert::IsTrue(orderB > orderA && orderC > orderA, L"Task should run after its dependencies");
+			Assert::IsTrue(startsAfterDependencies(graph, b, { a }), L"Timings do not respect dependencies");
+			Assert::IsTrue(startsAfterDependencies(graph, c, { a }), L"Timings do not respect dependencies");
+			Assert::IsTrue(startsAfterDependencies(graph, d, { b, c }), L"Timings do not respect dependencies");
+
+			// Same graph again.
+			order = 0;
+			graph.execute(&jobSystem);
+			Assert::AreEqual(4, order.load(), L"Graph should be reusable");
+			Assert::AreEqual(3, orderD, L"Task should run after its dependencies");
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestMainThreadTasks) {
+			JobSystem jobSystem;
+			jobSystem.start(2);
+
+			const std::thread::id mainThreadId = std::this_thread::get_id();
+			std::atomic<int32> numOnMainThread(0);
+
+			TaskGraph graph;
+			TaskHandle prev = graph.addTask("Root", ETaskThread::Any, []() {});
+			for (int32 i = 0; i < 16; ++i) {
+				const ETaskThread thread = (i % 2 == 0) ? ETaskThread::Main : ETaskThread::Any;
+				prev = graph.addTask("Chain", thread, [&, thread]() {
+					if (thread == ETaskThread::Main && std::this_thread::get_id() == mainThreadId) {
+						++numOnMainThread;
+					}
+				}, { prev });
+			}
+			graph.execute(&jobSystem);
+			Assert::AreEqual(8, numOnMainThread.load(), L"Main thread tasks should run on the thread that called execute()");
+
+			for (TaskHandle task = 0; task < graph.getNumTasks(); ++task) {
+				if (graph.getTaskThread(task) == ETaskThread::Main) {
+					Assert::AreEqual(-1, graph.getTaskTiming(task).workerIndex, L"Main thread task ran on a worker");
+				}
+			}
+
+			jobSystem.stop();
+		}
+
+		TEST_METHOD(TestWithoutJobSystem) {
+			std::vector<int32> order;
+			TaskGraph graph;
+			TaskHandle a = graph.addTask("A", ETaskThread::Any, [&]() { order.push_back(0); });
+			TaskHandle b = graph.addTask("B", ETaskThread::Main, [&]() { order.push_back(1); }, { a });
+			graph.addTask("C", ETaskThread::Any, [&]() { order.push_back(2); });
+			graph.addTask("D", ETaskThread::Main, [&]() { order.push_back(3); }, { a, b });
+			graph.execute(nullptr);
+
+			Assert::AreEqual((size_t)4, order.size(), L"All tasks should run exactly once");
+			for (int32 i = 0; i < 4; ++i) {
+				Assert::AreEqual(i, order[i], L"Tasks should run in the order of addTask() without job system");
+			}
+		}
+
+		TEST_METHOD(TestCriticalPath) {
+			JobSystem jobSystem;
+			jobSystem.start(2);
+
+			// a -> b -> d is the longest chain, c runs in parallel to b.
+			TaskGraph graph;
+			TaskHandle a = graph.addTask("A", ETaskThread::Main, []() { sleepMs(5); });
+			TaskHandle b = graph.addTask("B", ETaskThread::Main, []() { sleepMs(40); }, { a });
+			TaskHandle c = graph.addTask("C", ETaskThread::Any, []() { sleepMs(5); }, { a });
+			TaskHandle d = graph.addTask("D", ETaskThread::Any, []() { sleepMs(5); }, { b, c });
+			graph.addTask("E", ETaskThread::Any, []() { sleepMs(5); });
+			graph.execute(&jobSystem);
+
+			std::vector<TaskHandle> criticalPath;
+			graph.getCriticalPath(criticalPath);
+			Assert::AreEqual((size_t)3, criticalPath.size(), L"Wrong length of critical path");
+			Assert::AreEqual(a, criticalPath[0], L"Wrong critical path");
+			Assert::AreEqual(b, criticalPath[1], L"Wrong critical path");
+			Assert::AreEqual(d, criticalPath[2], L"Wrong critical path");
+			Assert::IsTrue(graph.getElapsedMs() >= graph.getTaskTiming(d).endMs, L"Total time should include all tasks");
+
+			graph.clear();
+			Assert::AreEqual(0u, graph.getNumTasks(), L"clear() should remove all tasks");
+
+			jobSystem.stop();
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkTaskGraph)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		// Overhead of scheduling tiny tasks, compared to running them in a loop.
+		TEST_METHOD(BenchmarkTaskGraph) {
+			constexpr int32 NUM_ITERATIONS = 100;
+			constexpr int32 NUM_CHAINS = 32;
+			constexpr int32 CHAIN_LENGTH = 8;
+			const uint32 numWorkers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			wchar_t msg[256];
+
+			JobSystem jobSystem;
+			jobSystem.start(numWorkers);
+
+			std::atomic<int32> counter(0);
+			TaskGraph graph;
+			for (int32 i = 0; i < NUM_CHAINS; ++i) {
+				TaskHandle prev = graph.addTask("Head", ETaskThread::Any, [&counter]() { ++counter; });
+				for (int32 j = 1; j < CHAIN_LENGTH; ++j) {
+					const ETaskThread thread = (j == CHAIN_LENGTH - 1 && i % 4 == 0) ? ETaskThread::Main : ETaskThread::Any;
+					prev = graph.addTask("Body", thread, [&counter]() { ++counter; }, { prev });
+				}
+			}
+
+			Stopwatch stopwatch;
+			for (int32 i = 0; i < NUM_ITERATIONS; ++i) {
+				graph.execute(&jobSystem);
+			}
+			const float elapsedParallel = stopwatch.stop();
+
+			stopwatch.start();
+			for (int32 i = 0; i < NUM_ITERATIONS; ++i) {
+				graph.execute(nullptr);
+			}
+			const float elapsedSerial = stopwatch.stop();
+
+			const float numTasks = (float)(NUM_ITERATIONS * graph.getNumTasks());
+			swprintf_s(msg, L"tasks=%u workers=%u per task: job system=%.3f us serial=%.3f us\n",
+				graph.getNumTasks(), numWorkers, 1000.0f * elapsedParallel / numTasks, 1000.0f * elapsedSerial / numTasks);
+			Logger::WriteMessage(msg);
+			Assert::AreEqual(2 * NUM_ITERATIONS * (int32)graph.getNumTasks(), counter.load(), L"All tasks should run");
+
+			jobSystem.stop();
+		}
+	};
+}
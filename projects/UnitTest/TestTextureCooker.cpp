@@ -0,0 +1,332 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/loader/texture_cooker.h"
+#include "pathos/util/block_compression.h"
+#include "pathos/util/image_data.h"
+#include "badger/system/job_system.h"
+#include "badger/system/stopwatch.h"
+
+#include <thread>
+#include <cmath>
+#include <algorithm>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace {
+	// Smooth gradients with some noise, like a typical photo texture.
+	ImageBlob* makeTestImage(uint32 width, uint32 height) {
+		std::vector<uint8> pixels(width * height * 4);
+		for (uint32 y = 0; y < height; ++y) {
+			for (uint32 x = 0; x < width; ++x) {
+				const uint32 noise = (x * 7919 + y * 104729) % 13;
+				uint8* p = &pixels[(y * width + x) * 4];
+				p[0] = (uint8)((x * 255) / std::max(1u, width - 1));
+				p[1] = (uint8)((y * 255) / std::max(1u, height - 1));
+				p[2] = (uint8)(128 + 100 * std::sin((float)(x + y) * 0.05f) + noise);
+				p[3] = (uint8)(255 - noise * 4);
+			}
+		}
+		ImageBlob* blob = new ImageBlob;
+		blob->copyRawBytes(pixels.data(), width, height, 32);
+		blob->glStorageFormat = GL_RGBA8;
+		blob->glPixelFormat = GL_RGBA;
+		blob->glDataType = GL_UNSIGNED_BYTE;
+		return blob;
+	}
+
+	float rmse(const uint8* a, const uint8* b, uint32 count, uint32 stride, uint32 numChannels) {
+		double sum = 0.0;
+		for (uint32 i = 0; i < count; ++i) {
+			for (uint32 c = 0; c < numChannels; ++c) {
+				const double d = (double)a[i * stride + c] - (double)b[i * stride + c];
+				sum += d * d;
+			}
+		}
+		return (float)std::sqrt(sum / (count * numChannels));
+	}
+
+	// Error relative to the source value, for RGB of RGBA32F texels.
+	float relativeRMSE(const float* a, const float* b, uint32 count) {
+		double sum = 0.0;
+		for (uint32 i = 0; i < count; ++i) {
+			for (uint32 c = 0; c < 3; ++c) {
+				const double d = ((double)a[i * 4 + c] - (double)b[i * 4 + c]) / std::max(a[i * 4 + c], 1e-3f);
+				sum += d * d;
+			}
+		}
+		return (float)std::sqrt(sum / (count * 3));
+	}
+}
+
+namespace UnitTest
+{
+	TEST_CLASS(TestTextureCooker) {
+	public:
+		TEST_METHOD(TestBlockEncoders) {
+			uint8 gradient[64], decoded[64], block[16];
+			for (uint32 i = 0; i < 16; ++i) {
+				gradient[i * 4 + 0] = (uint8)(30 + i * 12);
+				gradient[i * 4 + 1] = (uint8)(200 - i * 9);
+				gradient[i * 4 + 2] = (uint8)(90 + (i % 4) * 5);
+				gradient[i * 4 + 3] = (uint8)(255 - i * 3);
+			}
+
+			// 16 distinct values on 4 palette entries; a uniform quantizer would be off by about 15.
+			encodeBC1Block(gradient, block);
+			decodeBC1Block(block, decoded);
+			Assert::IsTrue(rmse(gradient, decoded, 16, 4, 3) < 12.0f, L"BC1 error is too large for a gradient");
+			Assert::IsTrue((block[0] | (block[1] << 8)) > (block[2] | (block[3] << 8)), L"BC1 should use the 4-color mode");
+
+			encodeBC7Block(gradient, block);
+			Assert::IsTrue(decodeBC7Block(block, decoded), L"BC7 encoder should write mode 6");
+			Assert::IsTrue(rmse(gradient, decoded, 16, 4, 4) < 3.0f, L"BC7 error is too large for a gradient");
+
+			uint8 values[16], decodedValues[16];
+			for (uint32 i = 0; i < 16; ++i) values[i] = gradient[i * 4];
+			encodeBC4Block(values, block);
+			decodeBC4Block(block, decodedValues);
+			Assert::IsTrue(rmse(values, decodedValues, 16, 1, 1) < 8.0f, L"BC4 error is too large for a gradient");
+
+			// Flat blocks
+			uint8 flat[64];
+			for (uint32 i = 0; i < 16; ++i) {
+				flat[i * 4 + 0] = 77; flat[i * 4 + 1] = 140; flat[i * 4 + 2] = 201; flat[i * 4 + 3] = 255;
+			}
+			encodeBC7Block(flat, block);
+			decodeBC7Block(block, decoded);
+			for (uint32 i = 0; i < 64; ++i) {
+				Assert::IsTrue(std::abs((int32)decoded[i] - (int32)flat[i]) <= 1, L"BC7 should reproduce a flat block within the p-bit precision");
+			}
+			encodeBC1Block(flat, block);
+			decodeBC1Block(block, decoded);
+			for (uint32 i = 0; i < 64; ++i) {
+				Assert::IsTrue(std::abs((int32)decoded[i] - (int32)flat[i]) <= 4, L"BC1 should reproduce a flat block within 565 precision");
+			}
+			std::fill(values, values + 16, (uint8)93);
+			encodeBC4Block(values, block);
+			decodeBC4Block(block, decodedValues);
+			for (uint32 i = 0; i < 16; ++i) {
+				Assert::AreEqual((uint8)93, decodedValues[i], L"BC4 should reproduce a flat block exactly");
+			}
+
+			// Brightness ramp over two stops
+			float hdr[64], decodedHDR[64];
+			for (uint32 i = 0; i < 16; ++i) {
+				const float intensity = 1.0f + (float)i * 0.2f;
+				hdr[i * 4 + 0] = intensity * 8.0f;
+				hdr[i * 4 + 1] = intensity * 5.0f;
+				hdr[i * 4 + 2] = intensity * 2.0f;
+				hdr[i * 4 + 3] = 1.0f;
+			}
+			encodeBC6HBlock(hdr, block);
+			Assert::IsTrue(decodeBC6HBlock(block, decodedHDR), L"BC6H encoder should write mode 11");
+			Assert::IsTrue(relativeRMSE(hdr, decodedHDR, 16) < 0.05f, L"BC6H error is too large for a gradient");
+
+			for (uint32 i = 0; i < 16; ++i) {
+				hdr[i * 4 + 0] = 3.7f; hdr[i * 4 + 1] = 120.0f; hdr[i * 4 + 2] = 0.02f;
+			}
+			encodeBC6HBlock(hdr, block);
+			decodeBC6HBlock(block, decodedHDR);
+			Assert::IsTrue(relativeRMSE(hdr, decodedHDR, 16) < 0.005f, L"BC6H should reproduce a flat block within 10-bit endpoint precision");
+
+			// Unsigned format
+			hdr[0] = -5.0f;
+			encodeBC6HBlock(hdr, block);
+			decodeBC6HBlock(block, decodedHDR);
+			Assert::AreEqual(0.0f, decodedHDR[0], L"BC6H should clamp negative values to zero");
+		}
+
+		TEST_METHOD(TestMipChain) {
+			Assert::AreEqual(1u, TextureCooker::getNumMips(1, 1), L"Wrong number of mips");
+			Assert::AreEqual(11u, TextureCooker::getNumMips(1024, 1024), L"Wrong number of mips");
+			Assert::AreEqual(6u, TextureCooker::getNumMips(37, 20), L"Wrong number of mips");
+
+			// Non-power-of-two and constant: every mip should keep the color.
+			std::vector<uint8> pixels(37 * 20 * 4);
+			for (uint32 i = 0; i < 37 * 20; ++i) {
+				pixels[i * 4 + 0] = 10; pixels[i * 4 + 1] = 100; pixels[i * 4 + 2] = 200; pixels[i * 4 + 3] = 50;
+			}
+			ImageBlob source;
+			source.copyRawBytes(pixels.data(), 37, 20, 32);
+			source.glPixelFormat = GL_RGBA;
+			source.glDataType = GL_UNSIGNED_BYTE;
+
+			TextureCookSettings settings;
+			settings.compression = ETextureCompression::None;
+			settings.bSRGB = true;
+			std::vector<uint8> cooked;
+			Assert::IsTrue(TextureCooker::cook(&source, settings, 1234, nullptr, cooked), L"Failed to cook");
+			ImageBlob* blob = TextureCooker::createImageBlob(cooked.data(), cooked.size(), 1234);
+			Assert::IsNotNull(blob, L"Invalid cooked data");
+			Assert::AreEqual((size_t)6, blob->mips.size(), L"Wrong number of mips");
+			Assert::AreEqual((GLenum)GL_SRGB8_ALPHA8, blob->glStorageFormat, L"Should select an sRGB format");
+			const uint32 expectedSizes[6][2] = { { 37, 20 }, { 18, 10 }, { 9, 5 }, { 4, 2 }, { 2, 1 }, { 1, 1 } };
+			for (uint32 i = 0; i < 6; ++i) {
+				const ImageMip& mip = blob->mips[i];
+				Assert::AreEqual(expectedSizes[i][0], mip.width, L"Wrong mip width");
+				Assert::AreEqual(expectedSizes[i][1], mip.height, L"Wrong mip height");
+				Assert::AreEqual(0ull, (uint64)(mip.offset % 16), L"Mips should be 16-byte aligned");
+				const uint8* texels = blob->rawBytes + mip.offset;
+				for (uint32 t = 0; t < mip.width * mip.height * 4; ++t) {
+					Assert::IsTrue(std::abs((int32)texels[t] - (int32)pixels[t % 4]) <= 1, L"Filtering should preserve a constant color");
+				}
+			}
+			delete blob;
+
+			// sRGB black and white should average in linear space.
+			const uint8 blackWhite[8] = { 0, 0, 0, 255, 255, 255, 255, 255 };
+			source.copyRawBytes(blackWhite, 2, 1, 32);
+			Assert::IsTrue(TextureCooker::cook(&source, settings, 1, nullptr, cooked), L"Failed to cook");
+			blob = TextureCooker::createImageBlob(cooked.data(), cooked.size(), 1);
+			const uint8* average = blob->rawBytes + blob->mips[1].offset;
+			Assert::IsTrue(std::abs((int32)average[0] - 188) <= 1, L"sRGB mips should be filtered in linear space");
+			delete blob;
+
+			settings.bSRGB = false;
+			Assert::IsTrue(TextureCooker::cook(&source, settings, 1, nullptr, cooked), L"Failed to cook");
+			blob = TextureCooker::createImageBlob(cooked.data(), cooked.size(), 1);
+			average = blob->rawBytes + blob->mips[1].offset;
+			Assert::IsTrue(std::abs((int32)average[0] - 128) <= 1, L"Linear mips should be a plain average");
+			delete blob;
+		}
+
+		TEST_METHOD(TestCookedContainer) {
+			ImageBlob* source = makeTestImage(70, 45);
+			TextureCookSettings settings;
+			settings.compression = ETextureCompression::BC7;
+
+			std::vector<uint8> serialData, parallelData;
+			Assert::IsTrue(TextureCooker::cook(source, settings, 42, nullptr, serialData), L"Failed to cook");
+			{
+				JobSystem jobSystem;
+				jobSystem.start(4);
+				Assert::IsTrue(TextureCooker::cook(source, settings, 42, &jobSystem, parallelData), L"Failed to cook");
+				jobSystem.stop();
+			}
+			Assert::IsTrue(serialData == parallelData, L"Parallel cooking should be deterministic");
+
+			Assert::IsNull(TextureCooker::createImageBlob(serialData.data(), serialData.size(), 43), L"Should reject another source hash");
+			Assert::IsNull(TextureCooker::createImageBlob(serialData.data(), serialData.size() - 16, 42), L"Should reject truncated data");
+
+			ImageBlob* blob = TextureCooker::createImageBlob(serialData.data(), serialData.size(), 42);
+			Assert::IsNotNull(blob, L"Invalid cooked data");
+			Assert::IsTrue(blob->bCompressed, L"Should be compressed");
+			Assert::AreEqual((GLenum)GL_COMPRESSED_RGBA_BPTC_UNORM, blob->glStorageFormat, L"Wrong storage format");
+			Assert::AreEqual((size_t)TextureCooker::getNumMips(70, 45), blob->mips.size(), L"Wrong number of mips");
+			for (const ImageMip& mip : blob->mips) {
+				const uint64 expectedBytes = (uint64)((mip.width + 3) / 4) * ((mip.height + 3) / 4) * 16;
+				Assert::AreEqual(expectedBytes, mip.bytes, L"Wrong size of a compressed mip");
+			}
+
+			// Decode mip 0 and compare with the source, ignoring the padded edge blocks.
+			const uint32 blocksX = (70 + 3) / 4;
+			std::vector<uint8> original, decoded;
+			for (uint32 by = 0; by < 45 / 4; ++by) {
+				for (uint32 bx = 0; bx < 70 / 4; ++bx) {
+					uint8 texels[64];
+					Assert::IsTrue(decodeBC7Block(blob->rawBytes + (by * blocksX + bx) * 16, texels), L"Invalid BC7 block");
+					for (uint32 t = 0; t < 16; ++t) {
+						const uint8* src = source->rawBytes + (((by * 4 + t / 4) * 70) + bx * 4 + t % 4) * 4;
+						original.insert(original.end(), src, src + 4);
+						decoded.insert(decoded.end(), texels + t * 4, texels + t * 4 + 4);
+					}
+				}
+			}
+			const float error = rmse(original.data(), decoded.data(), (uint32)original.size() / 4, 4, 4);
+			// The alpha noise of the test image is the hard part for a single subset.
+			Assert::IsTrue(error < 6.0f, L"BC7 error of the cooked image is too large");
+
+			delete blob;
+			delete source;
+		}
+
+		TEST_METHOD(TestHDRSource) {
+			constexpr uint32 width = 22, height = 13;
+			std::vector<float> pixels(width * height * 3);
+			for (uint32 y = 0; y < height; ++y) {
+				for (uint32 x = 0; x < width; ++x) {
+					float* p = &pixels[(y * width + x) * 3];
+					// Light falloff over several stops with a slowly changing hue.
+					const float intensity = 0.2f * std::exp2((float)(x + y) * 0.25f);
+					p[0] = intensity;
+					p[1] = intensity * (0.7f + 0.2f * std::sin((float)y * 0.3f));
+					p[2] = intensity * 0.4f;
+				}
+			}
+			ImageBlob source;
+			source.copyRawBytes(pixels.data(), width, height, 96);
+			source.glPixelFormat = GL_RGB;
+			source.glDataType = GL_FLOAT;
+
+			// The default BC7 can't store HDR values, so BC6H is selected.
+			TextureCookSettings settings;
+			std::vector<uint8> cooked;
+			Assert::IsTrue(TextureCooker::cook(&source, settings, 7, nullptr, cooked), L"Failed to cook");
+			ImageBlob* blob = TextureCooker::createImageBlob(cooked.data(), cooked.size(), 7);
+			Assert::IsNotNull(blob, L"Invalid cooked data");
+			Assert::IsTrue(blob->bCompressed, L"HDR source should be compressed");
+			Assert::AreEqual((GLenum)GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, blob->glStorageFormat, L"Wrong storage format");
+			Assert::AreEqual((size_t)TextureCooker::getNumMips(width, height), blob->mips.size(), L"Wrong number of mips");
+
+			// Decode mip 0 and compare with the source, ignoring the padded edge blocks.
+			const uint32 blocksX = (width + 3) / 4;
+			std::vector<float> original, decoded;
+			for (uint32 by = 0; by < height / 4; ++by) {
+				for (uint32 bx = 0; bx < width / 4; ++bx) {
+					float texels[64];
+					Assert::IsTrue(decodeBC6HBlock(blob->rawBytes + (by * blocksX + bx) * 16, texels), L"Invalid BC6H block");
+					for (uint32 t = 0; t < 16; ++t) {
+						const float* src = &pixels[(((by * 4 + t / 4) * width) + bx * 4 + t % 4) * 3];
+						original.insert(original.end(), { src[0], src[1], src[2], 1.0f });
+						decoded.insert(decoded.end(), texels + t * 4, texels + t * 4 + 4);
+					}
+				}
+			}
+			const float error = relativeRMSE(original.data(), decoded.data(), (uint32)original.size() / 4);
+			Assert::IsTrue(error < 0.05f, L"BC6H error of the cooked image is too large");
+			delete blob;
+
+			settings.compression = ETextureCompression::None;
+			Assert::IsTrue(TextureCooker::cook(&source, settings, 7, nullptr, cooked), L"Failed to cook");
+			blob = TextureCooker::createImageBlob(cooked.data(), cooked.size(), 7);
+			Assert::IsFalse(blob->bCompressed, L"Should be uncompressed");
+			Assert::AreEqual((GLenum)GL_RGBA16F, blob->glStorageFormat, L"Uncompressed HDR source should be RGBA16F");
+			delete blob;
+		}
+
+		BEGIN_TEST_METHOD_ATTRIBUTE(BenchmarkCookTexture)
+			TEST_METHOD_ATTRIBUTE(L"Category", L"Benchmark")
+			TEST_IGNORE()
+		END_TEST_METHOD_ATTRIBUTE()
+		TEST_METHOD(BenchmarkCookTexture) {
+			ImageBlob* source = makeTestImage(2048, 2048);
+			TextureCookSettings settings;
+			settings.compression = ETextureCompression::BC7;
+			settings.bSRGB = true;
+			std::vector<uint8> cooked;
+
+			Stopwatch stopwatch;
+			Assert::IsTrue(TextureCooker::cook(source, settings, 1, nullptr, cooked), L"Failed to cook");
+			const float serialMs = stopwatch.stop();
+
+			const uint32 numThreads = std::max(2u, std::thread::hardware_concurrency()) - 1;
+			JobSystem jobSystem;
+			jobSystem.start(numThreads);
+			stopwatch.start();
+			Assert::IsTrue(TextureCooker::cook(source, settings, 1, &jobSystem, cooked), L"Failed to cook");
+			const float parallelMs = stopwatch.stop();
+			jobSystem.stop();
+
+			// RGBA8 with mips vs BC7 with mips
+			const uint64 uncompressedBytes = (uint64)2048 * 2048 * 4 * 4 / 3;
+			wchar_t msg[256];
+			swprintf_s(msg, L"2048x2048 BC7 + mips: serial %.2f ms, %u workers %.2f ms, %.1f MB -> %.1f MB\n",
+				serialMs, numThreads, parallelMs, uncompressedBytes / (1024.0 * 1024.0), cooked.size() / (1024.0 * 1024.0));
+			Logger::WriteMessage(msg);
+
+			delete source;
+		}
+	};
+}
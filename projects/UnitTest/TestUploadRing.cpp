@@ -0,0 +1,85 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "pathos/util/ring_allocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace pathos;
+
+namespace UnitTest
+{
+	TEST_CLASS(TestUploadRing) {
+	public:
+		TEST_METHOD(TestWrapAround) {
+			RingAllocator ring;
+			ring.initialize(1024);
+
+			Assert::AreEqual(0ull, ring.allocate(100, 256), L"First allocation should start at zero");
+			Assert::AreEqual(256ull, ring.allocate(100, 256), L"Allocations should be aligned");
+			Assert::AreEqual(512ull, ring.allocate(300, 256), L"Wrong offset");
+			ring.endFrame();
+			ring.retireFrame();
+
+			// [768, 1024) is too small for 300 bytes, so the tail is skipped.
+			Assert::AreEqual(0ull, ring.allocate(300, 256), L"Allocation should wrap around instead of straddling the end");
+			Assert::AreEqual(512ull, ring.allocate(256, 256), L"Wrong offset after wrap-around");
+			Assert::AreEqual(768ull, ring.allocate(256, 256), L"An allocation that exactly fits the tail should not wrap");
+			Assert::AreEqual(1024ull, ring.getUsedBytes(), L"Ring should be full");
+			Assert::AreEqual(RingAllocator::INVALID_OFFSET, ring.allocate(16, 16), L"Ring should be full");
+		}
+
+		TEST_METHOD(TestFenceRetirement) {
+			RingAllocator ring;
+			ring.initialize(1024);
+
+			// Three frames in flight, 256 bytes each.
+			for (uint32 frame = 0; frame < 3; ++frame) {
+				Assert::AreEqual(frame * 256ull, ring.allocate(256, 256), L"Wrong offset");
+				ring.endFrame();
+			}
+			Assert::AreEqual(3u, ring.getNumFramesInFlight(), L"Wrong number of frames in flight");
+			Assert::AreEqual(768ull, ring.allocate(256, 256), L"The last free range should be available");
+			Assert::AreEqual(RingAllocator::INVALID_OFFSET, ring.allocate(16, 16), L"Ranges of frames in flight should not be reused");
+
+			// The fence of the oldest frame is signaled.
+			ring.retireFrame();
+			Assert::AreEqual(2u, ring.getNumFramesInFlight(), L"Wrong number of frames in flight");
+			Assert::AreEqual(0ull, ring.allocate(256, 256), L"Range of the retired frame should be reused");
+			Assert::AreEqual(RingAllocator::INVALID_OFFSET, ring.allocate(16, 16), L"Second frame is still in flight");
+
+			ring.endFrame();
+			ring.retireFrame();
+			ring.retireFrame();
+			ring.retireFrame();
+			Assert::AreEqual(0u, ring.getNumFramesInFlight(), L"All frames should be retired");
+			Assert::AreEqual(0ull, ring.getUsedBytes(), L"Ring should be empty after retiring all frames");
+			Assert::AreEqual(256ull, ring.allocate(256, 256), L"Allocation should continue from the head");
+		}
+
+		TEST_METHOD(TestOutOfSpace) {
+			RingAllocator ring;
+			ring.initialize(1024);
+
+			Assert::AreEqual(RingAllocator::INVALID_OFFSET, ring.allocate(2048, 256), L"Allocation larger than the ring should fail");
+			Assert::AreEqual(RingAllocator::INVALID_OFFSET, ring.allocate(0, 256), L"Empty allocation should fail");
+
+			// A single frame that overflows the ring: callers fall back to another upload path.
+			uint32 numAllocated = 0, numFallbacks = 0;
+			for (uint32 i = 0; i < 10; ++i) {
+				if (ring.allocate(200, 256) != RingAllocator::INVALID_OFFSET) {
+					++numAllocated;
+				} else {
+					++numFallbacks;
+				}
+			}
+			Assert::AreEqual(4u, numAllocated, L"Wrong number of successful allocations");
+			Assert::AreEqual(6u, numFallbacks, L"Wrong number of fallbacks");
+
+			// A failed allocation does not consume space.
+			ring.endFrame();
+			ring.retireFrame();
+			Assert::AreEqual(0ull, ring.getUsedBytes(), L"Failed allocations should not leave used bytes");
+			Assert::AreEqual(0ull, ring.allocate(1024, 256), L"Whole ring should be available again");
+		}
+	};
+}
@@ -20,6 +20,10 @@ struct SectorParameter {
 	float offsetX;
 	float offsetY;
 	uint  lod;
+	float scale;      // Sectors per side
+	float morphStart; // morphEnd <= 0 if no morphing
+	float morphEnd;
+	uint  divisions;  // Grid divisions per side
 	float _pad0;
 };
 
@@ -177,6 +181,10 @@ void main() {
 			sectorSize.x * fSectorCoord.x, // offsetX
 			sectorSize.y * fSectorCoord.y, // offsetY
 			LOD,                           // lod
+			1.0,                           // scale
+			0.0,                           // morphStart
+			0.0,                           // morphEnd
+			0u,                            // divisions
 			0.0                            // _pad0
 		);
 		outCommands[drawIx] = DrawElementsIndirectCommand(
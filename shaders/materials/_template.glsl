@@ -220,12 +220,19 @@ void main_staticMesh() {
 	vec4 positionWS = model * vec4(inPosition, 1.0);
 	vec4 prevPositionWS = prevModel * vec4(inPosition, 1.0);
 
+	// Packed vertex format has no bitangent stream (the attribute reads as zero);
+	// derive it from tangent handedness.
+	vec3 bitangent = inBitangent;
+	if (dot(bitangent, bitangent) == 0.0) {
+		bitangent = cross(inNormal, inTangent.xyz) * inTangent.w;
+	}
+
 	VertexShaderInput vsi;
 	vsi.position  = inPosition;
 	vsi.texcoord  = inTexcoord;
 	vsi.normal    = inNormal;
 	vsi.tangent   = inTangent;
-	vsi.bitangent = inBitangent;
+	vsi.bitangent = bitangent;
 
 	positionWS.xyz += getVertexPositionOffset(vsi);
 
@@ -235,7 +242,7 @@ void main_staticMesh() {
 	interpolants.position    = inPosition;
 	interpolants.normal      = inNormal;
 	interpolants.tangent     = inTangent;
-	interpolants.bitangent   = inBitangent;
+	interpolants.bitangent   = bitangent;
 	interpolants.texcoord    = inTexcoord;
 
 	// #todo: Precision issue.
@@ -11,6 +11,8 @@ PARAMETER_TEXTURE(2, sampler2D, normalmap)
 PARAMETER_CONSTANT(float, heightmapMultiplier)
 PARAMETER_CONSTANT(int, sectorCountX)
 PARAMETER_CONSTANT(int, sectorCountY)
+PARAMETER_CONSTANT(float, sectorSizeX)
+PARAMETER_CONSTANT(float, sectorSizeY)
 PARAMETER_CONSTANT(int, baseDivisions)
 PARAMETER_CONSTANT(int, debugMode)
 
@@ -19,7 +21,11 @@ struct SectorParameter {
 	vec4  uvBounds;
 	float offsetX;
 	float offsetY;
-	uint lod;
+	uint  lod;
+	float scale;      // Sectors per side
+	float morphStart; // morphEnd <= 0 if no morphing
+	float morphEnd;
+	uint  divisions;  // Grid divisions per side
 	float _pad0;
 };
 
@@ -39,12 +45,34 @@ int getSectorLinearIndex(ivec2 sectorCoords) {
 	return sectorCoords.y * uboMaterial.sectorCountX + sectorCoords.x;
 }
 
+// CDLOD: move odd vertices of the grid onto the grid of the next LOD as the vertex gets farther from the camera.
+// Nodes of adjacent LODs match at their borders, so no T-junction fix is needed.
+vec2 morphVertex(vec2 localUV, SectorParameter sector, mat4 model) {
+	vec2 nodeSize = vec2(uboMaterial.sectorSizeX, uboMaterial.sectorSizeY) * sector.scale;
+	vec2 localXY = vec2(sector.offsetX, sector.offsetY) + localUV * nodeSize;
+	float height = texture(heightmap, getNormalizedUV(localUV, sector.uvBounds)).r * uboMaterial.heightmapMultiplier;
+	vec3 positionWS = (model * vec4(localXY, height, 1.0)).xyz;
+
+	float dist = distance(positionWS, uboPerFrame.cameraPositionWS);
+	float morphK = clamp((dist - sector.morphStart) / (sector.morphEnd - sector.morphStart), 0.0, 1.0);
+
+	float divs = float(sector.divisions);
+	vec2 fracPart = fract(localUV * divs * 0.5) * (2.0 / divs);
+	return localUV - fracPart * morphK;
+}
+
 EMBED_GLSL_END
 
 VPO_BEGIN
 vec3 getVertexPositionOffset(VertexShaderInput vsi) {
 	SectorParameter sector = sectorParameters[gl_DrawID];
-	vec2 uv = getNormalizedUV(vsi.texcoord, sector.uvBounds);
+	bool bMorph = sector.morphEnd > 0.0;
+
+	vec2 localUV = vsi.texcoord;
+	if (bMorph) {
+		localUV = morphVertex(localUV, sector, uboPerObject.modelTransform);
+	}
+	vec2 uv = getNormalizedUV(localUV, sector.uvBounds);
 	
 	float heightFactor = texture(heightmap, uv).r; // [0.0, 1.0]
 
@@ -63,7 +91,7 @@ vec3 getVertexPositionOffset(VertexShaderInput vsi) {
 	bool neighborExists = all(greaterThanEqual(neighborCoords, ivec2(0, 0))) && all(lessThan(neighborCoords, ivec2(uboMaterial.sectorCountX, uboMaterial.sectorCountY)));
 
 	// Fix T-junction.
-	if (currentAtBorder && !currentAtCorner && neighborExists) {
+	if (!bMorph && currentAtBorder && !currentAtCorner && neighborExists) {
 		int neighborSectorIndex = getSectorLinearIndex(neighborCoords);
 		SectorParameter neighbor = sectorParameters[neighborSectorIndex];
 		if (sector.lod < neighbor.lod) {
@@ -86,7 +114,10 @@ vec3 getVertexPositionOffset(VertexShaderInput vsi) {
 
 	heightFactor *= uboMaterial.heightmapMultiplier;
 
-	vec3 vpo = vec3(sector.offsetX, sector.offsetY, heightFactor);
+	// Final local position, relative to the vertex position of the unit grid.
+	vec2 nodeSize = vec2(uboMaterial.sectorSizeX, uboMaterial.sectorSizeY) * sector.scale;
+	vec2 localXY = vec2(sector.offsetX, sector.offsetY) + localUV * nodeSize;
+	vec3 vpo = vec3(localXY, heightFactor) - vec3(vsi.position.xy, 0.0);
 	vpo = mat3(uboPerObject.modelTransform) * vpo;
 
 	return vpo.xyz;
@@ -0,0 +1,79 @@
+#version 460 core
+
+// Batched quads of the overlay. Vertices are pulled from the quad buffer, 6 vertices per quad.
+
+#define MODE_SOLID_COLOR 0
+#define MODE_IMAGE       1
+#define MODE_TEXT        2
+
+#if VERTEX_SHADER
+	#define Interpolants out
+#elif FRAGMENT_SHADER
+	#define Interpolants in
+#endif
+
+Interpolants OverlayBatchInterpolants {
+	vec2 uv;
+	vec4 color;
+	flat uint mode;
+} interpolants;
+
+layout (std140, binding = 1) uniform UBO_OverlayBatch {
+	vec4 screenToNDC; // (scaleX, scaleY, offsetX, offsetY)
+} ubo;
+
+//////////////////////////////////////////////////////////////////////////
+
+#if VERTEX_SHADER
+
+struct OverlayQuad {
+	vec4 rect;   // (x0, y0, x1, y1) in screen space
+	vec4 uvRect; // UV at (x0, y0) and (x1, y1)
+	vec4 color;
+	uint mode;
+	uint padding0;
+	uint padding1;
+	uint padding2;
+};
+
+layout (std430, binding = 0) readonly buffer SSBO_OverlayQuads {
+	OverlayQuad quads[];
+} ssbo;
+
+void main() {
+	// Two triangles: (0, 1, 2), (0, 2, 3) of corners (x0,y0), (x1,y0), (x1,y1), (x0,y1)
+	const uint cornerIndices[6] = uint[6](0, 1, 2, 0, 2, 3);
+	const vec2 corners[4] = vec2[4](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+	OverlayQuad quad = ssbo.quads[gl_VertexID / 6];
+	vec2 corner = corners[cornerIndices[gl_VertexID % 6]];
+
+	vec2 position = mix(quad.rect.xy, quad.rect.zw, corner);
+	interpolants.uv = mix(quad.uvRect.xy, quad.uvRect.zw, corner);
+	interpolants.color = quad.color;
+	interpolants.mode = quad.mode;
+
+	gl_Position = vec4(position * ubo.screenToNDC.xy + ubo.screenToNDC.zw, 0.0, 1.0);
+}
+
+#endif // VERTEX_SHADER
+
+//////////////////////////////////////////////////////////////////////////
+
+#if FRAGMENT_SHADER
+
+layout (binding = 0) uniform sampler2D quadTexture;
+
+out vec4 outColor;
+
+void main() {
+	vec4 color = interpolants.color;
+	if (interpolants.mode == MODE_IMAGE) {
+		color *= texture(quadTexture, interpolants.uv);
+	} else if (interpolants.mode == MODE_TEXT) {
+		color.a *= texture(quadTexture, interpolants.uv).r;
+	}
+	outColor = color;
+}
+
+#endif // FRAGMENT_SHADER
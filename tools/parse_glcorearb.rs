@@ -2,6 +2,7 @@
 // OVERVIEW
 // - Parse glcorearb.h and generate wrappers for GL calls.
 // - See render_commands.h and render_command_list.h.
+// - Also generates default stubs of the recording GL backend (see recording_gl.h).
 //
 // CAUTION: This script generates several ill-formed functions.
 //          Actual files in the engine are manually fixed, so
@@ -19,6 +20,8 @@ const INPUT_GLCOREARB: &str = "glcorearb.h";
 const OUTPUT_RENDER_PACKET: &str = "render_commands.generated.h";
 // Contains render commands that create render packets.
 const OUTPUT_RENDER_COMMAND_LIST: &str = "render_command_list.generated.h";
+// Contains stubs that replace gl3w function pointers in headless mode.
+const OUTPUT_RECORDING_GL: &str = "recording_gl.generated.h";
 
 // All GL function signatures are in-between these markers.
 const GLAPI_BEGIN_MARKER: &str = "#ifdef GL_GLEXT_PROTOTYPES";
@@ -30,7 +33,10 @@ struct GLFnInfo {
 	gl_func_name: String,
 	func_name: String,
 	params: Vec<String>,
-	param_names: Vec<String>
+	param_names: Vec<String>,
+	// Verbatim from glcorearb.h, as parse_api() does not handle every return type.
+	raw_return_type: String,
+	raw_params: String
 }
 
 fn main() {
@@ -61,7 +67,9 @@ fn main() {
 					gl_func_name: String::new(),
 					func_name:    String::new(),
 					params:       Vec::new(),
-					param_names:  Vec::new()
+					param_names:  Vec::new(),
+					raw_return_type: String::new(),
+					raw_params:   String::new()
 				};
 				parse_api(line, &mut parse_result);
 				function_db.push(parse_result);
@@ -116,24 +124,39 @@ r"struct RenderCommand_{} : public RenderCommandBase {{
 			gl_call_arguments)).unwrap();
 	}
 
-	// Write the union packet.
-	let mut union_members = String::new();
+	out_file.sync_all().unwrap();
+
+	println!("Generated: {}", OUTPUT_RENDER_PACKET);
+
+	// ------------------------------------------------------------------------------
+	// recording_gl.generated.h
+	// ------------------------------------------------------------------------------
+	let mut recording_file = File::create(OUTPUT_RECORDING_GL).unwrap();
+
+	// Each stub only counts the call and returns zero.
+	for (ix, fn_info) in function_db.iter().enumerate() {
+		let return_statement = if fn_info.raw_return_type == "void" { "" } else { " return {};" };
+		recording_file.write_fmt(format_args!(
+			"static {} APIENTRY recording_{}({}) {{ recordGLCall({});{} }}\n",
+			fn_info.raw_return_type,
+			fn_info.gl_func_name,
+			fn_info.raw_params,
+			ix,
+			return_statement)).unwrap();
+	}
+	recording_file.write_fmt(format_args!("\nstatic const RecordingGLProc RECORDING_GL_PROCS[] = {{\n")).unwrap();
 	for fn_info in &function_db {
-		union_members.push_str(&format!("\tRenderCommand_{} {};\n", fn_info.func_name, fn_info.func_name));
+		recording_file.write_fmt(format_args!(
+			"\t{{ \"{}\", (void**)&gl3w{}, (void*)recording_{} }},\n",
+			fn_info.gl_func_name,
+			&fn_info.gl_func_name[2..],
+			fn_info.gl_func_name)).unwrap();
 	}
+	recording_file.write_fmt(format_args!("}};\n")).unwrap();
 
-	out_file.write_fmt(format_args!(
-r"union RenderCommandPacketUnion {{
-public:
-	PFN_EXECUTE execute;
-private:
-{}
-}};
-", union_members)).unwrap();
-
-	out_file.sync_all().unwrap();
+	recording_file.sync_all().unwrap();
 
-	println!("Generated: {}", OUTPUT_RENDER_PACKET);
+	println!("Generated: {}", OUTPUT_RECORDING_GL);
 
 	// ------------------------------------------------------------------------------
 	// render_command_list.generated.h
@@ -158,7 +181,7 @@ private:
 r"{} {}(
 {})
 {{
-	RenderCommand_{}* __restrict packet = (RenderCommand_{}*)getNextPacket();
+	RenderCommand_{}* __restrict packet = allocatePacket<RenderCommand_{}>();
 	packet->pfn_execute = PFN_EXECUTE(RenderCommand_{}::execute);
 {}}}
 ",
@@ -228,6 +251,11 @@ fn parse_api(line: String, parse_result: &mut GLFnInfo) {
 		}
 	}
 
+	// GLAPI <raw_return_type> APIENTRY gl_func_name (<raw_params>);
+	let apientry_index = line.find("APIENTRY").unwrap();
+	parse_result.raw_return_type = String::from(line["GLAPI ".len()..apientry_index].trim());
+	parse_result.raw_params = String::from(&gl_func[(paren_begin_index+1)..gl_func.rfind(")").unwrap()]);
+
 	// Write GLFnInfo
 	parse_result.return_type = String::from(return_type);
 	parse_result.gl_func_name = String::from(gl_func_name);